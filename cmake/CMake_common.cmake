@@ -13,6 +13,8 @@ add_subdirectory(cpp/dts_429)
 add_subdirectory(cpp/translate_tabular)
 add_subdirectory(cpp/translate_tabular_1553)
 add_subdirectory(cpp/translate_tabular_arinc429)
+add_subdirectory(cpp/translate_tabular_canbus)
+add_subdirectory(cpp/translate_tabular_multibus)
 add_subdirectory(cpp/validation)
 add_subdirectory(cpp/video/parquet)
 add_subdirectory(cpp/parse_ch10)
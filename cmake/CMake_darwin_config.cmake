@@ -8,6 +8,7 @@ add_definitions(
     -DCH10_PARSE_EXE_NAME="${CH10_PARSE_EXE_NAME}"
     -DTRANSLATE_1553_EXE_NAME="${TRANSLATE_1553_EXE_NAME}"
     -DTRANSLATE_429_EXE_NAME="${TRANSLATE_429_EXE_NAME}"
+    -DTRANSLATE_MULTIBUS_EXE_NAME="${TRANSLATE_MULTIBUS_EXE_NAME}"
     -D__linux__
     -DPARQUET_STATIC
     -DARROW_STATIC
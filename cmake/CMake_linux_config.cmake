@@ -8,8 +8,10 @@ add_definitions(
     -DCH10_PARSE_EXE_NAME="${CH10_PARSE_EXE_NAME}"
     -DTRANSLATE_1553_EXE_NAME="${TRANSLATE_1553_EXE_NAME}"
     -DTRANSLATE_429_EXE_NAME="${TRANSLATE_429_EXE_NAME}"
+    -DTRANSLATE_MULTIBUS_EXE_NAME="${TRANSLATE_MULTIBUS_EXE_NAME}"
     -DTRANSLATE_1553_LOGNAME="${TRANSLATE_1553_LOGNAME}"
     -DTRANSLATE_429_LOGNAME="${TRANSLATE_429_LOGNAME}"
+    -DTRANSLATE_MULTIBUS_LOGNAME="${TRANSLATE_MULTIBUS_LOGNAME}"
     -DCH10_PARSE_LOGNAME="${CH10_PARSE_LOGNAME}"
     -D__linux__
     -DPARQUET_STATIC
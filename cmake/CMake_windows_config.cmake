@@ -11,9 +11,11 @@ add_compile_definitions(
     CH10_PARSE_EXE_NAME="${CH10_PARSE_EXE_NAME}"
     TRANSLATE_1553_EXE_NAME="${TRANSLATE_1553_EXE_NAME}"
     TRANSLATE_429_EXE_NAME="${TRANSLATE_429_EXE_NAME}"
+    TRANSLATE_MULTIBUS_EXE_NAME="${TRANSLATE_MULTIBUS_EXE_NAME}"
     CH10_PARSE_LOGNAME="${CH10_PARSE_LOGNAME}"
     TRANSLATE_1553_LOGNAME="${TRANSLATE_1553_LOGNAME}"
     TRANSLATE_429_LOGNAME="${TRANSLATE_429_LOGNAME}"
+    TRANSLATE_MULTIBUS_LOGNAME="${TRANSLATE_MULTIBUS_LOGNAME}"
     TINS_STATIC
     _CRT_SECURE_NO_WARNINGS
     _SILENCE_CXX17_ITERATOR_BASE_CLASS_DEPRECATION_WARNING
@@ -0,0 +1,165 @@
+#ifndef CH10_1553_MSG_DECODER_H_
+#define CH10_1553_MSG_DECODER_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "ch10_1553f1_msg_hdr_format.h"
+#include "parquet_milstd1553f1.h"
+
+/*
+A 1553 message decoded from the body of a packet. Pointers refer to the
+packet buffer or to storage held by the component which decoded the
+message and are valid until the packet is appended to the writer.
+*/
+class Ch101553DecodedMsg
+{
+   public:
+    // Absolute time of the message, nanoseconds since the epoch
+    uint64_t abs_time;
+
+    // Message header and command words, see MilStd1553F1DataHeaderCommWordFmt
+    const MilStd1553F1DataHeaderCommWordFmt* header;
+
+    // First data word of the payload
+    const uint16_t* payload;
+
+    // Status words, nullptr if not present in the message
+    const MilStd1553F1StatusWordFmt* status_word1;
+    const MilStd1553F1StatusWordFmt* status_word2;
+
+    // Expected payload word count, as interpreted from the command
+    // word, see Ch101553MsgDecoder::GetWordCountFromDataHeader
+    int8_t expected_payload_word_count;
+
+    // Payload word count written to the table, which is the expected
+    // count unless the message is shorter than expected
+    int8_t calc_payload_word_count;
+
+    // 1 if the message holds fewer payload words than expected
+    uint8_t is_payload_incomplete;
+
+    Ch101553DecodedMsg() : abs_time(0), header(nullptr), payload(nullptr),
+        status_word1(nullptr), status_word2(nullptr), expected_payload_word_count(0),
+        calc_payload_word_count(0), is_payload_incomplete(0)
+    {}
+};
+
+/*
+Decode 1553 messages into a batch and append the batch to a
+ParquetMilStd1553F1 writer once the packet has been parsed.
+
+Messages of each 1553 packet format are decoded into the same
+Ch101553DecodedMsg, such that every format is written with one schema
+and consumed by the same translator. Decoding all messages of a packet
+before any is appended keeps the per-message parse loop free of writer
+calls and lets a packet which fails part way append the messages which
+precede the failure in one pass.
+*/
+class Ch101553MsgDecoder
+{
+   private:
+    std::vector<Ch101553DecodedMsg> msgs_;
+
+    // Count of valid messages in msgs_, which is not resized when the
+    // batch is cleared to avoid reallocation for each packet
+    size_t count_;
+
+   public:
+    // Max allowed byte count per message payload.
+    // max of (32 payload words + 2 command words + 2 status words)
+    // * 2 bytes per word = 72 bytes.
+    static const uint16_t max_byte_count;
+
+    const size_t& count;
+
+    Ch101553MsgDecoder() : msgs_(), count_(0), count(count_) {}
+
+    /*
+    Remove all messages from the batch.
+    */
+    void Clear() { count_ = 0; }
+
+    /*
+    Add a decoded message to the batch.
+
+    Args:
+        msg     --> Decoded message
+    */
+    void Add(const Ch101553DecodedMsg& msg);
+
+    /*
+    Get a message of the batch.
+
+    Args:
+        index   --> Index of the message, less than count
+
+    Return:
+        Decoded message
+    */
+    const Ch101553DecodedMsg& Get(size_t index) const { return msgs_[index]; }
+
+    /*
+    Append each message of the batch to the writer, in the order in
+    which messages were added.
+
+    Args:
+        writer  --> Writer of the output table
+        doy     --> TDP day of year flag
+        csdw    --> CSDW of the packet, from which the time tag bits are
+                    written
+        chanid  --> Channel ID of the packet
+    */
+    void Append(ParquetMilStd1553F1* writer, uint8_t doy,
+        const MilStd1553F1CSDWFmt* csdw, const uint16_t& chanid) const;
+
+    /*
+    Decode the payload of a 1553 message which is laid out as in
+    Mil-Std-1553 Format 1 packets, i.e., command, data and status words
+    in the order in which they occur on the bus.
+
+    Args:
+        data        --> Pointer to the first word of the message, which
+                        is a command word
+        data_header --> Message header and command words
+        msg         --> Decoded message, of which the payload, status
+                        words and word counts are set
+
+    Return:
+        False if the message length is greater than max_byte_count,
+        otherwise true.
+    */
+    static bool DecodePayload(const uint16_t* data,
+        const MilStd1553F1DataHeaderCommWordFmt* data_header, Ch101553DecodedMsg& msg);
+
+    /*
+    Get the count of payload words expected from the command word,
+    taking into consideration that the message may be a mode code and
+    that a word count of zero indicates a 32-word payload.
+
+    Args:
+        data_header --> Message header and command words
+
+    Return:
+        Expected payload word count
+    */
+    static uint16_t GetWordCountFromDataHeader(const MilStd1553F1DataHeaderCommWordFmt* data_header);
+
+    /*
+    Set status word pointers to addresses which contain status words.
+    If a second status word does not exist, set the second status word
+    pointer to nullptr.
+
+    Args:
+        payload     --> Pointer to position of beginning of 1553 data
+                        payload, including comm words, etc.
+        header      --> Pointer to ch10 message-level header and comm words
+        status1     --> Pointer to status word 1
+        status2     --> Pointer to status word 2
+    */
+    static void ParseStatusWords(const uint16_t* payload,
+        const MilStd1553F1DataHeaderCommWordFmt* header,
+        const MilStd1553F1StatusWordFmt*& status1, const MilStd1553F1StatusWordFmt*& status2);
+};
+
+#endif
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <set>
 #include "ch10_1553f1_msg_hdr_format.h"
+#include "ch10_1553_msg_decoder.h"
 #include "ch10_packet_component.h"
 #include "ch10_time.h"
 
@@ -42,43 +43,16 @@ class Ch101553F1Component : public Ch10PacketComponent
     // Time obtained from IPTS, nanosecond units
     uint64_t ipts_time_;
 
-    //
-    // Vars for parsing the 1553 message payloads
-    //
-
     // Max allowed message count within a 1553 packet. Used to
     // check for corruption issues. This value is very rough guess.
     const uint16_t max_message_count_;
 
-    // Max allowed byte count per message payload.
-    // max of (32 payload words + 2 command words + 2 status words)
-    // * 2 bytes per word = 72 bytes.
-    const uint16_t max_byte_count_;
-
-    // Interpret the raw bytes as uint16_t words
-    const uint16_t* payload_ptr_;
-
-    // 1 if payload word count from command word is greater than
-    // the calculated payload word count from the message length,
-    // 0 otherwise.
-    uint8_t is_payload_incomplete_;
-
-    // Calculated payload word count from the message length,
-    // subtracting the command and status words. Signed integer
-    // to allow negative values, which can occur when the count
-    // of transmitted messages is in error or there are some
-    // message errors.
-    int8_t calc_payload_word_count_;
+    // Payload, status words and word counts of the current message
+    Ch101553DecodedMsg msg_;
 
-    // Expected payload word count, as interpreted from the intra-packet
-    // header and taking into consideration that the current message may
-    // be a mode code and that a word count of zero
-    // indicates a 32-word payload.
-    int8_t expected_payload_word_count_;
-
-    // Pointers to status words to avoid copying    
-    const MilStd1553F1StatusWordFmt* status_word1_;
-    const MilStd1553F1StatusWordFmt* status_word2_;
+    // Messages of the current packet, appended to the writer after
+    // all messages have been parsed
+    Ch101553MsgDecoder decoder_;
 
     Ch10Time ch10_time_;
 
@@ -103,26 +77,22 @@ class Ch101553F1Component : public Ch10PacketComponent
                                                       msg_index_(0),
                                                       abs_time_(0),
                                                       max_message_count_(10000),
-                                                      payload_ptr_(nullptr),
-                                                      max_byte_count_(72),
-                                                      expected_payload_word_count_(0),
-                                                      calc_payload_word_count_(0),
-                                                      is_payload_incomplete_(0),
-                                                      expected_payload_word_count(expected_payload_word_count_),
-                                                      calc_payload_word_count(calc_payload_word_count_),
-                                                      is_payload_incomplete(is_payload_incomplete_),
+                                                      msg_(),
+                                                      decoder_(),
+                                                      expected_payload_word_count(msg_.expected_payload_word_count),
+                                                      calc_payload_word_count(msg_.calc_payload_word_count),
+                                                      is_payload_incomplete(msg_.is_payload_incomplete),
                                                       abs_time(abs_time_),
                                                       milstd1553f1_data_hdr_commword_ptr_(nullptr),
-                                                      payload_ptr_ptr(&payload_ptr_),
+                                                      payload_ptr_ptr(&msg_.payload),
                                                       ch10_time_(),
-                                                      ipts_time_(0),
-                                                      status_word1_(nullptr), status_word2_(nullptr)
+                                                      ipts_time_(0)
     {
     }
 
     void GetStatusWordPointers(const MilStd1553F1StatusWordFmt*& word1, 
         const MilStd1553F1StatusWordFmt*& word2) const
-    { word1 = status_word1_; word2 = status_word2_; }
+    { word1 = msg_.status_word1; word2 = msg_.status_word2; }
 
     virtual Ch10Status Parse(const uint8_t*& data);
 
@@ -132,7 +102,9 @@ class Ch101553F1Component : public Ch10PacketComponent
 	stamp and a header, followed by n bytes of message payload. This
 	function parses intra-packet matter and the message payload for
 	all messages in the case of RTC format intra-packet time stamps.
-	It also sets the private member var abs_time_.
+	It also sets the private member var abs_time_. Messages are
+	appended to the writer once all have been parsed, including the
+	messages which precede a message that fails to parse.
 
 	Args:
 		msg_count	--> count of messages, each with time and header,
@@ -145,6 +117,14 @@ class Ch101553F1Component : public Ch10PacketComponent
 	*/
     Ch10Status ParseMessages(const uint32_t& msg_count, const uint8_t*& data);
 
+    /*
+    Decode the payload of the current message, see
+    Ch101553MsgDecoder::DecodePayload.
+
+    Return:
+        Ch10Status::MILSTD1553_MSG_LENGTH if the message length is greater
+        than Ch101553MsgDecoder::max_byte_count, otherwise Ch10Status::OK.
+    */
     Ch10Status ParsePayload(const uint8_t*& data,
                             const MilStd1553F1DataHeaderCommWordFmt* data_header);
 
@@ -0,0 +1,103 @@
+#ifndef CH10_1553F2_COMPONENT_H_
+#define CH10_1553F2_COMPONENT_H_
+
+#include <cstdint>
+#include <vector>
+#include "ch10_1553f2_msg_hdr_format.h"
+#include "ch10_1553_msg_decoder.h"
+#include "ch10_packet_component.h"
+#include "ch10_time.h"
+
+/*
+This class defines the structures/classes and methods
+to parse Ch10 "Mil-Std-1553 Bus Data Packets, Format 2" (16PP194).
+
+Each 16PP194 transaction is decoded into the message of the 1553
+Format 1 table such that the output is consumed by the 1553 translator
+without change:
+
+    command word    --> command word 1
+    response word   --> the single payload word
+    status word     --> status word 1
+    word errors     --> WE, any parity or Manchester error
+    TM              --> TO
+    EE              --> FE
+    TE, RE or SE    --> ME
+
+The command echo and no-go words are not written.
+*/
+class Ch101553F2Component : public Ch10PacketComponent
+{
+   private:
+    Ch10PacketElement<MilStd1553F2CSDWFmt> milstd1553f2_csdw_elem_;
+    ElemPtrVec milstd1553f2_csdw_elem_vec_;
+
+    // Intra-packet data header of the current message
+    MilStd1553F2DataHeaderFmt data_hdr_;
+
+    // Format 1 message headers of the messages of the current packet,
+    // to which the decoded messages point
+    std::vector<MilStd1553F1DataHeaderCommWordFmt> f1_hdrs_;
+
+    // Time tag bits written with each message
+    MilStd1553F1CSDWFmt f1_csdw_;
+
+    Ch101553MsgDecoder decoder_;
+
+    // Temporary holder for IPTS time
+    uint64_t ipts_time_;
+
+    Ch10Time ch10_time_;
+
+   public:
+    // Count of 32-bit words in a transaction
+    static const uint32_t transaction_word_count;
+
+    // Indices of transaction words
+    static const uint32_t command_index;
+    static const uint32_t response_index;
+    static const uint32_t status_index;
+
+    const Ch10PacketElement<MilStd1553F2CSDWFmt>& milstd1553f2_csdw_elem;
+    const Ch101553MsgDecoder& decoder;
+
+    Ch101553F2Component(Ch10Context* const ch10ctx) : Ch10PacketComponent(ch10ctx),
+        milstd1553f2_csdw_elem_vec_{dynamic_cast<Ch10PacketElementBase*>(&milstd1553f2_csdw_elem_)},
+        data_hdr_{}, f1_hdrs_(), f1_csdw_{}, decoder_(), ipts_time_(0), ch10_time_(),
+        milstd1553f2_csdw_elem(milstd1553f2_csdw_elem_), decoder(decoder_)
+    {
+    }
+
+    virtual Ch10Status Parse(const uint8_t*& data);
+
+    /*
+    Parse the transactions of a packet and append each to the writer.
+
+    Args:
+        msg_count   --> Count of messages in the packet, from the CSDW
+        data        --> Pointer to the first byte after the CSDW
+        size        --> Count of bytes after the CSDW
+
+    Return:
+        Ch10Status::MILSTD1553F2_MSG_LENGTH if a transaction is shorter
+        than transaction_word_count words or exceeds the packet body, in
+        which case the messages which precede it are appended, otherwise
+        Ch10Status::OK or the status of a failed time stamp parse.
+    */
+    Ch10Status ParseMessages(uint32_t msg_count, const uint8_t* data, size_t size);
+
+    /*
+    Decode a transaction into a 1553 message.
+
+    Args:
+        hdr     --> Intra-packet data header of the transaction
+        words   --> Pointer to the transaction words
+        f1_hdr  --> Format 1 message header to fill, to which the message
+                    points
+        msg     --> Decoded message
+    */
+    static void DecodeTransaction(const MilStd1553F2DataHeaderFmt& hdr, const uint8_t* words,
+        MilStd1553F1DataHeaderCommWordFmt& f1_hdr, Ch101553DecodedMsg& msg);
+};
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef CH10_ANALOGF1_COMPONENT_H_
+#define CH10_ANALOGF1_COMPONENT_H_
+
+#include <cstdint>
+#include <vector>
+#include "ch10_analogf1_msg_hdr_format.h"
+#include "ch10_packet_component.h"
+#include "analog_sample_unpack.h"
+
+/*
+This class defines the structures/classes and methods
+to parse Ch10 "Analog Data Packets, Format 1".
+
+The body of a packet is a sequence of sample frames, each of which holds
+one sample of every subchannel in subchannel order. All samples of a
+packet are unpacked in a single call to AnalogSampleUnpack and each
+subchannel is then appended to the writer as one strided run, see
+ParquetAnalogF1::Append. Only every Nth sample frame is appended if the
+context decimation N is greater than one.
+
+Subchannels must have the same mode, sample length and sampling rate
+factor, and samples may not be longer than 32 bits.
+*/
+class Ch10AnalogF1Component : public Ch10PacketComponent
+{
+   private:
+    Ch10PacketElement<AnalogF1CSDWFmt> analogf1_csdw_elem_;
+    ElemPtrVec analogf1_csdw_elem_vec_;
+
+    // CSDWs of the subchannels of the current packet, one if the CSDW
+    // applies to all subchannels
+    std::vector<AnalogF1CSDWFmt> csdws_;
+
+    // Unpacked samples of the current packet, frame_count_ * subchannel_count_
+    std::vector<int32_t> samples_;
+    size_t frame_count_;
+    uint32_t subchannel_count_;
+
+    uint64_t abs_time_;
+
+    AnalogSampleUnpack unpack_;
+
+   public:
+    const Ch10PacketElement<AnalogF1CSDWFmt>& analogf1_csdw_elem;
+    const std::vector<AnalogF1CSDWFmt>& csdws;
+    const std::vector<int32_t>& samples;
+    const size_t& frame_count;
+    const uint32_t& subchannel_count;
+
+    Ch10AnalogF1Component(Ch10Context* const ch10ctx) : Ch10PacketComponent(ch10ctx),
+        analogf1_csdw_elem_vec_{dynamic_cast<Ch10PacketElementBase*>(&analogf1_csdw_elem_)},
+        csdws_(), samples_(), frame_count_(0), subchannel_count_(0), abs_time_(0), unpack_(),
+        analogf1_csdw_elem(analogf1_csdw_elem_), csdws(csdws_), samples(samples_),
+        frame_count(frame_count_), subchannel_count(subchannel_count_)
+    {
+    }
+
+    virtual Ch10Status Parse(const uint8_t*& data);
+
+    /*
+    Unpack the samples of a packet and append them to the writer.
+
+    Args:
+        data        --> Pointer to the first byte after the first CSDW
+        size        --> Count of bytes after the first CSDW
+
+    Return:
+        Ch10Status::ANALOGF1_CSDW_COUNT if the subchannel CSDWs exceed
+        the packet body, Ch10Status::ANALOGF1_FORMAT if the mode is
+        reserved, samples are longer than 32 bits or the subchannels do
+        not share a format, otherwise Ch10Status::OK.
+    */
+    Ch10Status ParseSamples(const uint8_t* data, size_t size);
+
+    /*
+    Get the sample geometry of a CSDW, see AnalogSampleUnpack.
+
+    Args:
+        csdw        --> CSDW of the subchannel
+        stride_bits --> Output count of bits from one sample to the next
+        shift       --> Output count of padding bits below the sample
+
+    Return:
+        False if the mode is reserved or the sample is longer than
+        AnalogSampleUnpack::max_sample_bits; true otherwise.
+    */
+    static bool GetSampleGeometry(const AnalogF1CSDWFmt& csdw, uint32_t& stride_bits,
+        uint32_t& shift);
+};
+
+#endif
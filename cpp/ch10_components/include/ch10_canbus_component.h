@@ -0,0 +1,89 @@
+#ifndef CH10_CANBUS_COMPONENT_H_
+#define CH10_CANBUS_COMPONENT_H_
+
+#include <cstdint>
+#include <vector>
+#include "ch10_canbus_msg_hdr_format.h"
+#include "ch10_packet_component.h"
+#include "ch10_time.h"
+
+/*
+This class defines the structures/classes and methods
+to parse Ch10 "CAN Bus Data Packets".
+
+The messages of a packet are parsed into packet-sized arrays which
+are appended to the writer in a single call, see ParquetCANBus::Append,
+rather than one call per message.
+*/
+class Ch10CANBusComponent : public Ch10PacketComponent
+{
+   private:
+    Ch10PacketElement<CANBusCSDWFmt> canbus_csdw_elem_;
+    ElemPtrVec canbus_csdw_elem_vec_;
+
+    // Messages of the current packet, parsed_count_ of each
+    std::vector<uint64_t> abs_time_;
+    std::vector<CANBusMsgHdrFmt> msg_hdr_;
+    std::vector<CANBusIDWordFmt> id_word_;
+    std::vector<uint64_t> payload_;
+    size_t parsed_count_;
+
+    // Temporary holder for IPTS time
+    uint64_t ipts_time_;
+
+    Ch10Time ch10_time_;
+
+   public:
+    static const size_t max_payload_size;
+
+    const Ch10PacketElement<CANBusCSDWFmt>& canbus_csdw_elem;
+    const std::vector<uint64_t>& abs_time;
+    const std::vector<CANBusMsgHdrFmt>& msg_hdr;
+    const std::vector<CANBusIDWordFmt>& id_word;
+    const std::vector<uint64_t>& payload;
+    const size_t& parsed_count;
+
+    Ch10CANBusComponent(Ch10Context* const ch10ctx) : Ch10PacketComponent(ch10ctx),
+        canbus_csdw_elem_vec_{dynamic_cast<Ch10PacketElementBase*>(&canbus_csdw_elem_)},
+        abs_time_(), msg_hdr_(), id_word_(), payload_(), parsed_count_(0), ipts_time_(0),
+        ch10_time_(), canbus_csdw_elem(canbus_csdw_elem_), abs_time(abs_time_),
+        msg_hdr(msg_hdr_), id_word(id_word_), payload(payload_), parsed_count(parsed_count_)
+    {
+    }
+
+    virtual Ch10Status Parse(const uint8_t*& data);
+
+    /*
+    Parse the messages of a packet into the message arrays, then append
+    the parsed messages to the writer.
+
+    Args:
+        msg_count   --> Count of messages from the CSDW
+        data        --> Pointer to the first byte after the CSDW
+        size        --> Count of bytes after the CSDW
+
+    Return:
+        Ch10Status::CANBUS_MSG_LENGTH if a message length is invalid or a
+        message exceeds the packet body, in which case the messages which
+        precede it are appended, otherwise Ch10Status::OK or the status
+        of a failed time stamp parse.
+    */
+    Ch10Status ParseMessages(uint32_t msg_count, const uint8_t* data, size_t size);
+
+    /*
+    Assemble the data bytes of a message into a 64-bit value. The first
+    data byte is the least significant byte and unused bytes are zero,
+    such that the value in memory on a little-endian machine is the
+    data bytes in order.
+
+    Args:
+        data        --> Pointer to the first data byte
+        data_size   --> Count of data bytes, not greater than eight
+
+    Return:
+        Payload value
+    */
+    static uint64_t AssemblePayload(const uint8_t* data, size_t data_size);
+};
+
+#endif
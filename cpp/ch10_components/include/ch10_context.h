@@ -11,7 +11,14 @@
 #include "parquet_videodataf0.h"
 #include "parquet_ethernetf0.h"
 #include "parquet_arinc429f0.h"
-
+#include "parquet_pcmf1.h"
+#include "parquet_canbus.h"
+#include "parquet_ethernetf1.h"
+#include "parquet_analogf1.h"
+#include "parquet_uartf0.h"
+#include "parquet_messagef0.h"
+
+#include <atomic>
 #include <cstdint>
 #include <cstdio>
 #include <string>
@@ -20,19 +27,50 @@
 #include <unordered_map>
 #include <set>
 #include <cmath>
+#include <algorithm>
+#include <cctype>
 #include <memory>
 #include "managed_path.h"
+#include "perf_stats.h"
+#include "diagnostics.h"
 #include "ch10_packet_type.h"
 #include "ch10_status.h"
 #include "ch10_header_format.h"
 #include "ch10_1553f1_msg_hdr_format.h"
 #include "ch10_videof0_header_format.h"
 #include "ch10_arinc429f0_msg_hdr_format.h"
+#include "ch10_pcmf1_msg_hdr_format.h"
+#include "ch10_canbus_msg_hdr_format.h"
+#include "ch10_ethernetf1_msg_hdr_format.h"
+#include "ch10_analogf1_msg_hdr_format.h"
+#include "ch10_1553f2_msg_hdr_format.h"
+#include "ch10_uartf0_msg_hdr_format.h"
+#include "ch10_messagef0_msg_hdr_format.h"
 #include "ch10_tdpf1_hdr_format.h"
 #include "spdlog/spdlog.h"
 
 #include <fstream>
 
+// Data checksum verification policy, see Ch10Context::SetDataChecksumPolicy.
+// Header checksums are always verified because they are required to
+// find packets.
+enum class Ch10ChecksumPolicy : uint8_t
+{
+    // Verify the data checksum of every packet
+    ALWAYS = 0,
+
+    // Verify the data checksum of one of every N packets
+    SAMPLE = 1,
+
+    // Do not verify data checksums, for recordings from trusted sources
+    HEADER_ONLY = 2,
+};
+
+const std::map<std::string, Ch10ChecksumPolicy> string_to_ch10checksumpolicy_map = {
+    {"always", Ch10ChecksumPolicy::ALWAYS},
+    {"sample", Ch10ChecksumPolicy::SAMPLE},
+    {"header_only", Ch10ChecksumPolicy::HEADER_ONLY}};
+
 class Ch10Context
 {
    private:
@@ -40,8 +78,11 @@ class Ch10Context
     // ID to control or generate thread-specific log output.
     uint16_t thread_id_;
 
-    // Key components of Ch10 context.
-    uint64_t absolute_position_;
+    // Key components of Ch10 context. The absolute position is only
+    // modified by the thread which owns the context. It is atomic such
+    // that it can be sampled by other threads, e.g., ParseProgress,
+    // and is stored with relaxed ordering to avoid overhead.
+    std::atomic<uint64_t> absolute_position_;
     uint64_t tdp_rtc_;       // nanosecond
     uint64_t tdp_abs_time_;  // nanosecond
     uint64_t rtc_;           // nanosecond
@@ -148,6 +189,30 @@ class Ch10Context
     std::unique_ptr<ParquetEthernetF0> ethernetf0_pq_writer_;
     std::unique_ptr<ParquetContext> arinc429f0_pq_ctx_;
     std::unique_ptr<ParquetARINC429F0> arinc429f0_pq_writer_;
+    std::unique_ptr<ParquetContext> pcmf1_pq_ctx_;
+    std::unique_ptr<ParquetPCMF1> pcmf1_pq_writer_;
+    std::unique_ptr<ParquetContext> canbus_pq_ctx_;
+    std::unique_ptr<ParquetCANBus> canbus_pq_writer_;
+    std::unique_ptr<ParquetContext> ethernetf1_pq_ctx_;
+    std::unique_ptr<ParquetEthernetF1> ethernetf1_pq_writer_;
+    std::unique_ptr<ParquetContext> analogf1_pq_ctx_;
+    std::unique_ptr<ParquetAnalogF1> analogf1_pq_writer_;
+    std::unique_ptr<ParquetContext> milstd1553f2_pq_ctx_;
+    std::unique_ptr<ParquetMilStd1553F1> milstd1553f2_pq_writer_;
+    std::unique_ptr<ParquetContext> uartf0_pq_ctx_;
+    std::unique_ptr<ParquetUARTF0> uartf0_pq_writer_;
+    std::unique_ptr<ParquetContext> messagef0_pq_ctx_;
+    std::unique_ptr<ParquetMessageF0> messagef0_pq_writer_;
+
+    // PCM minor frame format, see SetPCMF1FrameFormat
+    PCMF1FrameFormat pcmf1_frame_format_;
+
+    // Analog F1 sample frame decimation, see SetAnalogF1Decimation
+    uint32_t analogf1_decimation_;
+
+    // Write parquet files with the direct column writer path, see
+    // SetDirectParquetWrite
+    bool direct_parquet_write_;
 
     // Internal state to be used in RegisterUnhandledPacketType()
     std::set<Ch10PacketType> registered_unhandled_packet_types_;
@@ -167,9 +232,34 @@ class Ch10Context
     // Hold TMATS matter for later recording
     std::string tmats_matter_;
 
+    // Packet selection, see SetPacketSelection. Data packets which begin
+    // before selected_begin_position_ or which have a channel ID not in
+    // the non-empty selected_channel_ids_ are not parsed.
+    uint64_t selected_begin_position_;
+    std::set<uint16_t> selected_channel_ids_;
+
+    // Data checksum verification, see SetDataChecksumPolicy. The packet
+    // count is the count of packets for which ShouldVerifyDataChecksum
+    // has been called.
+    Ch10ChecksumPolicy data_checksum_policy_;
+    uint32_t data_checksum_sample_interval_;
+    uint64_t data_checksum_packet_count_;
+    uint64_t data_checksum_verified_count_;
+
+    // Performance counters, accumulated over all calls to Initialize
+    // such that they cover all of the shifts of a worker. Packet counts
+    // are indexed by the packet header data type.
+    std::vector<uint64_t> packet_type_counts_;
+    uint64_t read_byte_count_;
+    uint64_t read_time_ns_;
+    uint64_t sync_loss_count_;
+    uint64_t resync_byte_count_;
+    uint64_t header_checksum_fail_count_;
+    uint64_t data_checksum_fail_count_;
+
    public:
     const uint16_t& thread_id;
-    const uint64_t& absolute_position;
+    const std::atomic<uint64_t>& absolute_position;
     const uint64_t& tdp_rtc;
     const uint64_t& tdp_abs_time;
     const uint64_t& rtc;
@@ -194,11 +284,35 @@ class Ch10Context
     ParquetVideoDataF0* videof0_pq_writer;
     ParquetEthernetF0* ethernetf0_pq_writer;
     ParquetARINC429F0* arinc429f0_pq_writer;
+    ParquetPCMF1* pcmf1_pq_writer;
+    ParquetCANBus* canbus_pq_writer;
+    ParquetEthernetF1* ethernetf1_pq_writer;
+    ParquetAnalogF1* analogf1_pq_writer;
+    ParquetMilStd1553F1* milstd1553f2_pq_writer;
+    ParquetUARTF0* uartf0_pq_writer;
+    ParquetMessageF0* messagef0_pq_writer;
+    const PCMF1FrameFormat& pcmf1_frame_format;
+    const uint32_t& analogf1_decimation;
     const uint32_t intrapacket_ts_size_ = sizeof(uint64_t);
     const std::set<Ch10PacketType>& parsed_packet_types;
     const std::vector<TDF1CSDWFmt>& tdf1csdw_vec;
     const std::vector<uint64_t>& tdp_abs_time_vec;
 
+    // Stage timers, started and stopped by the worker which owns this
+    // object. Body parse time includes the time spent writing row
+    // groups when writer buffers become full. Header and body parse
+    // are timed for one of every PACKET_TIMER_SAMPLE_INTERVAL packets
+    // to keep clock reads out of most iterations of the packet loop.
+    static const uint64_t PACKET_TIMER_SAMPLE_INTERVAL = 64;
+    SampledStageTimer header_parse_timer;
+    SampledStageTimer body_parse_timer;
+    StageTimer shift_timer;
+
+    // Counts of malformed data events encountered by the worker which
+    // owns this object, with the absolute positions of the first
+    // occurrences. See Diagnostics::Record.
+    Diagnostics diagnostics;
+
     Ch10Context(const uint64_t& abs_pos, uint16_t id = 0);
     Ch10Context();
     void Initialize(const uint64_t& abs_pos, uint16_t id);
@@ -234,6 +348,111 @@ class Ch10Context
     void SetSearchingForTDP(bool should_search);
     virtual Ch10Status ContinueWithPacketType(uint8_t data_type);
 
+    /*
+    Limit the data packets which are parsed. TMATS and time data packets
+    are always selected such that time can be computed for the selected
+    packets.
+
+    Args:
+        begin_position  --> Absolute position of the first data packet
+                            to parse. Data packets which begin prior
+                            to this position are skipped.
+        channel_ids     --> Set of channel IDs to parse. All channel IDs
+                            are parsed if empty.
+    */
+    void SetPacketSelection(uint64_t begin_position, const std::set<uint16_t>& channel_ids);
+
+    /*
+    Set the policy by which packet data checksums are verified.
+
+    Args:
+        policy          --> Ch10ChecksumPolicy
+        sample_interval --> Verify one of every sample_interval packets
+                            if policy is SAMPLE. Values less than one
+                            are treated as one.
+    */
+    void SetDataChecksumPolicy(Ch10ChecksumPolicy policy, uint32_t sample_interval);
+
+    /*
+    Set the format of PCM minor frames, which is not given by PCM packets.
+    All PCM channels are assumed to have the same format. Must be called
+    prior to InitializeFileWriters if PCM_F1 is enabled.
+
+    Args:
+        frame_format    --> PCMF1FrameFormat
+    */
+    void SetPCMF1FrameFormat(const PCMF1FrameFormat& frame_format)
+    {
+        pcmf1_frame_format_ = frame_format;
+    }
+
+    /*
+    Set the decimation of Analog F1 sample frames. Only every Nth sample
+    frame of each packet, beginning with the first, is written.
+
+    Args:
+        decimation  --> N, values less than one are treated as one
+    */
+    void SetAnalogF1Decimation(uint32_t decimation)
+    {
+        analogf1_decimation_ = decimation > 1 ? decimation : 1;
+    }
+
+    /*
+    Write the files of the writers created by InitializeFileWriters with
+    the parquet column writers rather than Arrow builders, see
+    ParquetContext::EnableDirectWrite. Must be called prior to
+    InitializeFileWriters.
+
+    Args:
+        enable  --> True to write with the direct path
+    */
+    void SetDirectParquetWrite(bool enable) { direct_parquet_write_ = enable; }
+
+    /*
+    Create the ParquetContext of a file writer, configured according to
+    SetDirectParquetWrite.
+
+    Return:
+        New ParquetContext
+    */
+    std::unique_ptr<ParquetContext> CreateParquetContext() const;
+
+    /*
+    Check if the data checksum of the current packet ought to be verified
+    according to the policy set by SetDataChecksumPolicy. Call once per
+    packet.
+
+    Return:
+        True if the checksum ought to be verified.
+    */
+    bool ShouldVerifyDataChecksum()
+    {
+        uint64_t packet_index = data_checksum_packet_count_++;
+        if (data_checksum_policy_ == Ch10ChecksumPolicy::ALWAYS ||
+            (data_checksum_policy_ == Ch10ChecksumPolicy::SAMPLE &&
+             packet_index % data_checksum_sample_interval_ == 0))
+        {
+            data_checksum_verified_count_++;
+            return true;
+        }
+        return false;
+    }
+
+    /*
+    Check if a packet is selected for parsing, see SetPacketSelection.
+
+    Args:
+        pkt_position    --> Absolute position of the packet header
+        channel_id      --> Packet header channel ID
+        data_type       --> Packet header data type
+
+    Return:
+        True if the packet ought to be parsed; false otherwise.
+    */
+    virtual bool IsPacketSelected(const uint64_t& pkt_position, uint16_t channel_id,
+        uint8_t data_type) const;
+
     /*
     Check if input packet type is enabled.
 
@@ -509,6 +728,58 @@ class Ch10Context
 	*/
     virtual void UpdateWithSecondaryHeaderTime(const uint64_t& time_ns);
 
+    /*
+    Record a malformed data event at the current absolute position.
+
+    Args:
+        event   --> Event name
+
+    Return:
+        True if the occurrence should be logged, see Diagnostics::Record
+    */
+    bool RecordDiagnostic(std::string_view event)
+    {
+        return diagnostics.Record(event, absolute_position_.load(std::memory_order_relaxed));
+    }
+
+    // Increment performance counters, see GetPerfStats
+    void CountPacket(uint8_t data_type) { packet_type_counts_[data_type]++; }
+    void CountSyncLoss() { sync_loss_count_++; }
+    void CountResyncBytes(uint64_t byte_count) { resync_byte_count_ += byte_count; }
+    void CountHeaderChecksumFailure() { header_checksum_fail_count_++; }
+    void CountDataChecksumFailure() { data_checksum_fail_count_++; }
+    void CountRead(uint64_t byte_count, uint64_t read_time_ns)
+    {
+        read_byte_count_ += byte_count;
+        read_time_ns_ += read_time_ns;
+    }
+
+    /*
+    Collect the performance counters and stage timers of this object
+    and the file writers it owns.
+
+    Return:
+        PerfStats with counts bytes_read, packets_<type>, sync_losses,
+        resync_bytes, header_checksum_failures, data_checksum_failures,
+        data_checksums_verified, data_checksums_skipped,
+        rows_written_<type> and row_groups_written_<type>, and times
+        read, header_parse, body_parse, worker_shift, arrow_build,
+        parquet_write and parquet_close. header_parse and body_parse
+        are estimated from the sampled packets.
+    */
+    virtual PerfStats GetPerfStats() const;
+
+    /*
+    Add the counters and timers of a ParquetContext to PerfStats.
+
+    Args:
+        pq_ctx      --> ParquetContext, may be nullptr
+        type_label  --> Label appended to the names of counts
+        stats       --> PerfStats to which the values are added
+    */
+    static void AddParquetContextStats(const ParquetContext* pq_ctx,
+                                       const std::string& type_label, PerfStats& stats);
+
 };
 
 #endif
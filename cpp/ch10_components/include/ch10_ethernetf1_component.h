@@ -0,0 +1,74 @@
+#ifndef CH10_ETHERNETF1_COMPONENT_H_
+#define CH10_ETHERNETF1_COMPONENT_H_
+
+#include <cstdint>
+#include "ch10_ethernetf1_msg_hdr_format.h"
+#include "ch10_packet_component.h"
+#include "ch10_time.h"
+
+/*
+This class defines the structures/classes and methods
+to parse Ch10 "Ethernet Data Packets, Format 1" (ARINC 664).
+
+Each message is an intra-packet header, which gives the virtual link,
+addresses and ports of the message, followed by the UDP payload. The
+payload is appended to the writer directly from the packet buffer, so
+parsing a message does not allocate memory.
+*/
+class Ch10EthernetF1Component : public Ch10PacketComponent
+{
+   private:
+    Ch10PacketElement<EthernetF1CSDW> ethernetf1_csdw_elem_;
+    ElemPtrVec ethernetf1_csdw_elem_vec_;
+
+    // Intra-packet data header of the current message
+    EthernetF1IPDHFmt ipdh_;
+
+    // Count of messages parsed from the current packet
+    uint32_t parsed_count_;
+
+    // Temporary holder for IPTS time
+    uint64_t ipts_time_;
+
+    // Absolute time of the current message
+    uint64_t abs_time_;
+
+    Ch10Time ch10_time_;
+
+   public:
+    // Maximum count of bytes in the UDP payload of an ARINC 664 frame
+    static const uint32_t max_payload_size;
+
+    const Ch10PacketElement<EthernetF1CSDW>& ethernetf1_csdw_elem;
+    const EthernetF1IPDHFmt& ipdh;
+    const uint32_t& parsed_count;
+
+    Ch10EthernetF1Component(Ch10Context* const ch10ctx) : Ch10PacketComponent(ch10ctx),
+        ethernetf1_csdw_elem_vec_{dynamic_cast<Ch10PacketElementBase*>(&ethernetf1_csdw_elem_)},
+        ipdh_{}, parsed_count_(0), ipts_time_(0), abs_time_(0), ch10_time_(),
+        ethernetf1_csdw_elem(ethernetf1_csdw_elem_), ipdh(ipdh_), parsed_count(parsed_count_)
+    {
+    }
+
+    virtual Ch10Status Parse(const uint8_t*& data);
+
+    /*
+    Parse the messages of a packet and append each to the writer.
+
+    Args:
+        csdw    --> Channel specific data word of the packet
+        data    --> Pointer to the first byte after the CSDW
+        size    --> Count of bytes after the CSDW
+
+    Return:
+        Ch10Status::ETHERNETF1_IPH_LENGTH if the intra-packet header
+        length of the CSDW is less than the time stamp and intra-packet
+        data header, Ch10Status::ETHERNETF1_MSG_LENGTH if a payload is
+        too long or a message exceeds the packet body, in which case the
+        messages which precede it are appended, otherwise Ch10Status::OK
+        or the status of a failed time stamp parse.
+    */
+    Ch10Status ParseMessages(const EthernetF1CSDW* csdw, const uint8_t* data, size_t size);
+};
+
+#endif
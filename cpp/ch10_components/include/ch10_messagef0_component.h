@@ -0,0 +1,72 @@
+#ifndef CH10_MESSAGEF0_COMPONENT_H_
+#define CH10_MESSAGEF0_COMPONENT_H_
+
+#include <cstdint>
+#include "ch10_messagef0_msg_hdr_format.h"
+#include "ch10_packet_component.h"
+#include "ch10_time.h"
+
+/*
+This class defines the structures/classes and methods
+to parse Ch10 "Message Data Packets, Format 0".
+
+Each message is an intra-packet time stamp, an intra-packet data header
+and a variable count of data bytes, padded to an even length. The data
+are appended to the writer directly from the packet buffer. A message
+which is too long for one packet is recorded as segments in consecutive
+packets, which are written as separate rows with the packet type of the
+CSDW and are not reassembled.
+*/
+class Ch10MessageF0Component : public Ch10PacketComponent
+{
+   private:
+    Ch10PacketElement<MessageF0CSDWFmt> messagef0_csdw_elem_;
+    ElemPtrVec messagef0_csdw_elem_vec_;
+
+    // Intra-packet data header of the current message
+    MessageF0DataHeaderFmt data_hdr_;
+
+    // Count of messages parsed from the current packet
+    uint32_t parsed_count_;
+
+    // Temporary holder for IPTS time
+    uint64_t ipts_time_;
+
+    // Absolute time of the current message
+    uint64_t abs_time_;
+
+    Ch10Time ch10_time_;
+
+   public:
+    const Ch10PacketElement<MessageF0CSDWFmt>& messagef0_csdw_elem;
+    const MessageF0DataHeaderFmt& data_hdr;
+    const uint32_t& parsed_count;
+
+    Ch10MessageF0Component(Ch10Context* const ch10ctx) : Ch10PacketComponent(ch10ctx),
+        messagef0_csdw_elem_vec_{dynamic_cast<Ch10PacketElementBase*>(&messagef0_csdw_elem_)},
+        data_hdr_{}, parsed_count_(0), ipts_time_(0), abs_time_(0), ch10_time_(),
+        messagef0_csdw_elem(messagef0_csdw_elem_), data_hdr(data_hdr_),
+        parsed_count(parsed_count_)
+    {
+    }
+
+    virtual Ch10Status Parse(const uint8_t*& data);
+
+    /*
+    Parse the messages of a packet and append each to the writer.
+
+    Args:
+        csdw    --> Channel specific data word of the packet
+        data    --> Pointer to the first byte after the CSDW
+        size    --> Count of bytes after the CSDW
+
+    Return:
+        Ch10Status::MESSAGEF0_MSG_LENGTH if a message exceeds the packet
+        body, in which case the messages which precede it are appended,
+        otherwise Ch10Status::OK or the status of a failed time stamp
+        parse.
+    */
+    Ch10Status ParseMessages(const MessageF0CSDWFmt* csdw, const uint8_t* data, size_t size);
+};
+
+#endif
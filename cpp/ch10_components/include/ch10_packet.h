@@ -10,6 +10,13 @@
 #include "ch10_arinc429f0_component.h"
 #include "ch10_videof0_component.h"
 #include "ch10_ethernetf0_component.h"
+#include "ch10_pcmf1_component.h"
+#include "ch10_canbus_component.h"
+#include "ch10_ethernetf1_component.h"
+#include "ch10_analogf1_component.h"
+#include "ch10_1553f2_component.h"
+#include "ch10_uartf0_component.h"
+#include "ch10_messagef0_component.h"
 #include "binbuff.h"
 #include "ch10_status.h"
 #include "ch10_packet_header_component.h"
@@ -45,6 +52,10 @@ class Ch10Packet
     // Note the assumption of relative time is not confirmed.
     uint64_t secondary_hdr_time_ns_;
 
+    // True while searching for a sync pattern after a bad sync or
+    // header checksum. Used to count each loss of sync once.
+    bool sync_lost_;
+
     // Various packet parser instances.
     Ch10PacketHeaderComponent* header_;
     Ch10TMATSComponent* tmats_;
@@ -53,6 +64,13 @@ class Ch10Packet
     Ch10VideoF0Component* videof0_component_;
     Ch10EthernetF0Component* ethernetf0_component_;
     Ch10429F0Component* arinc429f0_component_;
+    Ch10PCMF1Component* pcmf1_component_;
+    Ch10CANBusComponent* canbus_component_;
+    Ch10EthernetF1Component* ethernetf1_component_;
+    Ch10AnalogF1Component* analogf1_component_;
+    Ch101553F2Component* milstd1553f2_component_;
+    Ch10UARTF0Component* uartf0_component_;
+    Ch10MessageF0Component* messagef0_component_;
 
     // Ch10 time calculation and manipulation
     Ch10Time* const ch10_time_;
@@ -63,7 +81,7 @@ class Ch10Packet
     const Ch10PacketType& current_pkt_type;
     Ch10Packet(BinBuff* const binbuff, Ch10Context* const context,
         Ch10Time* const ch10time) :
-        ch10_time_(ch10time), secondary_hdr_time_ns_(0), bb_(binbuff), ctx_(context), data_ptr_(nullptr), bb_response_(0), status_(Ch10Status::OK), temp_pkt_size_(0), pkt_type_(Ch10PacketType::NONE), current_pkt_type(pkt_type_), header_(nullptr), tmats_(nullptr), tdp_component_(nullptr), milstd1553f1_component_(nullptr), arinc429f0_component_(nullptr), videof0_component_(nullptr), ethernetf0_component_(nullptr)
+        ch10_time_(ch10time), secondary_hdr_time_ns_(0), sync_lost_(false), bb_(binbuff), ctx_(context), data_ptr_(nullptr), bb_response_(0), status_(Ch10Status::OK), temp_pkt_size_(0), pkt_type_(Ch10PacketType::NONE), current_pkt_type(pkt_type_), header_(nullptr), tmats_(nullptr), tdp_component_(nullptr), milstd1553f1_component_(nullptr), arinc429f0_component_(nullptr), videof0_component_(nullptr), ethernetf0_component_(nullptr), pcmf1_component_(nullptr), canbus_component_(nullptr), ethernetf1_component_(nullptr), analogf1_component_(nullptr), milstd1553f2_component_(nullptr), uartf0_component_(nullptr), messagef0_component_(nullptr)
     {    }
 
 
@@ -78,11 +96,24 @@ class Ch10Packet
         video_comp      --> Pointer to Ch10VideoF0Component
         eth_comp        --> Pointer to Ch10EthernetF0Component
         arinc429_comp   --> Pointer to Ch10429F0Component
+        pcmf1_comp      --> Pointer to Ch10PCMF1Component
+        canbus_comp     --> Pointer to Ch10CANBusComponent
+        ethernetf1_comp --> Pointer to Ch10EthernetF1Component
+        analogf1_comp   --> Pointer to Ch10AnalogF1Component
+        milstd1553f2_comp--> Pointer to Ch101553F2Component
+        uartf0_comp     --> Pointer to Ch10UARTF0Component
+        messagef0_comp  --> Pointer to Ch10MessageF0Component
     */
     void SetCh10ComponentParsers(Ch10PacketHeaderComponent* header_comp, Ch10TMATSComponent* tmats_comp,
         Ch10TDPComponent* tdp_comp, Ch101553F1Component* milstd1553_comp,
         Ch10VideoF0Component* video_comp, Ch10EthernetF0Component* eth_comp,
-        Ch10429F0Component* arinc429_comp);
+        Ch10429F0Component* arinc429_comp, Ch10PCMF1Component* pcmf1_comp,
+        Ch10CANBusComponent* canbus_comp,
+        Ch10EthernetF1Component* ethernetf1_comp,
+        Ch10AnalogF1Component* analogf1_comp,
+        Ch101553F2Component* milstd1553f2_comp,
+        Ch10UARTF0Component* uartf0_comp,
+        Ch10MessageF0Component* messagef0_comp);
 
 
 
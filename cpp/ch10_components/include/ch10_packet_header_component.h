@@ -6,6 +6,7 @@
 #include "ch10_header_format.h"
 #include "ch10_packet_component.h"
 #include "ch10_time.h"
+#include "checksum_kernels.h"
 
 class Ch10PacketSecondaryHeaderChecksum
 {
@@ -49,13 +50,13 @@ class Ch10PacketHeaderComponent : public Ch10PacketComponent
     // Count of checksum units, depending on the checksum data type.
     uint32_t checksum_unit_count_;
 
-    // Pointers and vars for summing the values in the checksum.
+    // Pointers and vars for summing the values in the header checksums.
     const uint16_t* checksum_data_ptr16_;
     uint16_t checksum_value16_;
-    const uint32_t* checksum_data_ptr32_;
-    uint32_t checksum_value32_;
-    const uint8_t* checksum_data_ptr8_;
-    uint8_t checksum_value8_;
+
+    // Kernels which sum the packet body for the data checksum, selected
+    // for the CPU on which the parser runs
+    const ChecksumKernels& checksum_kernels_;
 
    public:
     // Sync value in Ch10 header as defined by Ch10 spec.
@@ -85,10 +86,7 @@ class Ch10PacketHeaderComponent : public Ch10PacketComponent
                                                             checksum_unit_count_(0),
                                                             checksum_data_ptr16_(nullptr),
                                                             checksum_value16_(0),
-                                                            checksum_data_ptr32_(nullptr),
-                                                            checksum_value32_(0),
-                                                            checksum_data_ptr8_(nullptr),
-                                                            checksum_value8_(0) {}
+                                                            checksum_kernels_(ChecksumKernels::Dispatched()) {}
     virtual Ch10Status Parse(const uint8_t*& data);
     virtual const Ch10PacketHeaderFmt* const GetHeader() const
     { return *std_hdr_elem_.element; }
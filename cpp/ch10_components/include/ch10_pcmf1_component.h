@@ -0,0 +1,176 @@
+#ifndef CH10_PCMF1_COMPONENT_H_
+#define CH10_PCMF1_COMPONENT_H_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "ch10_pcmf1_msg_hdr_format.h"
+#include "ch10_packet_component.h"
+#include "ch10_time.h"
+#include "pcm_frame_sync.h"
+
+/*
+Bit stream state of a channel recorded in throughput mode. Minor frames
+are not aligned to packets in throughput mode, so the bits which follow
+the last complete minor frame of a packet are carried over to the next
+packet of the same channel. The state is held by the component, which
+ParseWorker retains between buffers such that a minor frame may also
+span consecutive buffers, e.g., stream mode polls.
+*/
+class PCMF1ThroughputState
+{
+   public:
+    // Bit stream which has not been consumed, beginning at a byte
+    std::vector<uint8_t> carry;
+
+    // Position in carry at which the next minor frame or search begins
+    uint64_t bit_pos;
+
+    // Absolute time of the packet in which carry begins
+    uint64_t time;
+
+    // True if the position of the next sync pattern is known
+    bool locked;
+
+    PCMF1ThroughputState() : carry(), bit_pos(0), time(0), locked(false) {}
+};
+
+/*
+This class defines the structures/classes and methods
+to parse Ch10 "PCM Data Packets, Format 1".
+
+Minor frames are decommutated according to the frame format set by
+Ch10Context::SetPCMF1FrameFormat and appended one per row. In packed and
+unpacked modes each minor frame is aligned to the packet, optionally
+preceded by an intra-packet header. In throughput mode the packet body
+is an unaligned bit stream in which minor frames are located by
+searching for the sync pattern, see PCMFrameSync.
+*/
+class Ch10PCMF1Component : public Ch10PacketComponent
+{
+   private:
+    Ch10PacketElement<PCMF1CSDWFmt> pcmf1_csdw_elem_;
+    ElemPtrVec pcmf1_csdw_elem_vec_;
+    const PCMF1CSDWFmt* csdw_;
+
+    // Frame format and sync pattern search, set from the context on
+    // the first call to Parse.
+    PCMF1FrameFormat frame_format_;
+    PCMFrameSync frame_sync_;
+    bool frame_sync_configured_;
+
+    // Bit stream of the current minor frame or throughput mode packet
+    std::vector<uint8_t> stream_;
+
+    // Data words of the current minor frame
+    std::vector<uint32_t> words_;
+
+    // Throughput mode state by channel ID
+    std::unordered_map<uint32_t, PCMF1ThroughputState> throughput_state_;
+
+    // Temporary holder for IPTS time and the absolute time of the
+    // current minor frame
+    uint64_t ipts_time_;
+    uint64_t abs_time_;
+
+    Ch10Time ch10_time_;
+
+   public:
+    const Ch10PacketElement<PCMF1CSDWFmt>& pcmf1_csdw_elem;
+    const std::vector<uint32_t>& words;
+
+    Ch10PCMF1Component(Ch10Context* const ch10ctx) : Ch10PacketComponent(ch10ctx),
+        pcmf1_csdw_elem_vec_{dynamic_cast<Ch10PacketElementBase*>(&pcmf1_csdw_elem_)},
+        csdw_(nullptr), frame_format_(), frame_sync_(), frame_sync_configured_(false),
+        stream_(), words_(), throughput_state_(), ipts_time_(0), abs_time_(0), ch10_time_(),
+        pcmf1_csdw_elem(pcmf1_csdw_elem_), words(words_)
+    {
+    }
+
+    virtual Ch10Status Parse(const uint8_t*& data);
+
+    /*
+    Validate a frame format and configure the sync pattern search.
+
+    Args:
+        frame_format    --> Minor frame format
+
+    Return:
+        Ch10Status::PCMF1_FRAME_FORMAT if the frame format is not
+        configured or invalid, otherwise Ch10Status::OK.
+    */
+    Ch10Status ConfigureFrameFormat(const PCMF1FrameFormat& frame_format);
+
+    /*
+    Parse the minor frames of a packed or unpacked mode packet.
+
+    Args:
+        data    --> Pointer to the first byte after the CSDW
+        size    --> Count of bytes after the CSDW
+        packed  --> True if packed mode, false if unpacked mode
+
+    Return:
+        Ch10Status::OK if no problems, otherwise a different Ch10Status code.
+    */
+    Ch10Status ParseMinorFrames(const uint8_t* data, size_t size, bool packed);
+
+    /*
+    Search the bit stream of a throughput mode packet, including the bits
+    carried over from the previous packet of the channel, for minor frames.
+
+    Args:
+        data    --> Pointer to the first byte after the CSDW
+        size    --> Count of bytes after the CSDW
+
+    Return:
+        Ch10Status::OK
+    */
+    Ch10Status ParseThroughput(const uint8_t* data, size_t size);
+
+    /*
+    Count of bytes in a packed or unpacked minor frame, including the
+    fill which aligns the frame to 16 or 32 bits.
+    */
+    static size_t PackedFrameSize(const PCMF1FrameFormat& frame_format, bool align32);
+    static size_t UnpackedFrameSize(const PCMF1FrameFormat& frame_format, bool align32);
+
+    /*
+    Reorder the bytes of packet data into a bit stream. PCM data are
+    recorded in little-endian 16-bit words, or 32-bit words in 32-bit
+    alignment mode, with the first bit in the most significant bit of
+    the word.
+
+    Args:
+        data    --> Packet data
+        size    --> Count of bytes, a multiple of the word size
+        align32 --> True if 32-bit alignment mode
+        out     --> Bit stream, size bytes
+    */
+    static void CopyToBitStream(const uint8_t* data, size_t size, bool align32, uint8_t* out);
+
+    /*
+    Decommutate the data words of a minor frame from a bit stream into
+    the words vector.
+
+    Args:
+        stream  --> Bit stream
+        bit_pos --> Position of the first bit of the first data word,
+                    i.e., the bit after the sync pattern
+    */
+    void DecommutateStream(const uint8_t* stream, uint64_t bit_pos);
+
+    /*
+    Decommutate an unpacked minor frame into the words vector. In
+    unpacked mode the sync pattern and each data word are right-justified
+    in one or more 16-bit words.
+
+    Args:
+        data    --> Pointer to the first byte of the minor frame
+
+    Return:
+        True if the sync pattern matches the frame format.
+    */
+    bool DecommutateUnpacked(const uint8_t* data);
+};
+
+#endif
@@ -34,6 +34,16 @@ enum class Ch10Status : uint8_t
     ARINC429F0_PARITY_ERROR,
     ARINC429F0_FORMAT_ERROR,
     ARINC429F0_GAP_TIME_ERROR,
+    PCMF1_FRAME_FORMAT,
+    PCMF1_MODE,
+    CANBUS_MSG_LENGTH,
+    ETHERNETF1_IPH_LENGTH,
+    ETHERNETF1_MSG_LENGTH,
+    ANALOGF1_CSDW_COUNT,
+    ANALOGF1_FORMAT,
+    MILSTD1553F2_MSG_LENGTH,
+    UARTF0_MSG_LENGTH,
+    MESSAGEF0_MSG_LENGTH,
 };
 
 const std::unordered_map<Ch10Status, std::string> ch10status_to_string_map = {
@@ -57,7 +67,17 @@ const std::unordered_map<Ch10Status, std::string> ch10status_to_string_map = {
     {Ch10Status::MILSTD1553_MSG_LENGTH, "MILSTD1553_MSG_LENGTH"},
     {Ch10Status::ARINC429F0_PARITY_ERROR, "ARINC429F0_PARITY_ERROR"},
     {Ch10Status::ARINC429F0_FORMAT_ERROR, "ARINC429F0_FORMAT_ERROR"},
-    {Ch10Status::ARINC429F0_GAP_TIME_ERROR, "ARINC429F0_GAP_TIME_ERROR"}};
+    {Ch10Status::ARINC429F0_GAP_TIME_ERROR, "ARINC429F0_GAP_TIME_ERROR"},
+    {Ch10Status::PCMF1_FRAME_FORMAT, "PCMF1_FRAME_FORMAT"},
+    {Ch10Status::PCMF1_MODE, "PCMF1_MODE"},
+    {Ch10Status::CANBUS_MSG_LENGTH, "CANBUS_MSG_LENGTH"},
+    {Ch10Status::ETHERNETF1_IPH_LENGTH, "ETHERNETF1_IPH_LENGTH"},
+    {Ch10Status::ETHERNETF1_MSG_LENGTH, "ETHERNETF1_MSG_LENGTH"},
+    {Ch10Status::ANALOGF1_CSDW_COUNT, "ANALOGF1_CSDW_COUNT"},
+    {Ch10Status::ANALOGF1_FORMAT, "ANALOGF1_FORMAT"},
+    {Ch10Status::MILSTD1553F2_MSG_LENGTH, "MILSTD1553F2_MSG_LENGTH"},
+    {Ch10Status::UARTF0_MSG_LENGTH, "UARTF0_MSG_LENGTH"},
+    {Ch10Status::MESSAGEF0_MSG_LENGTH, "MESSAGEF0_MSG_LENGTH"}};
 
 std::string Ch10StatusString(const Ch10Status& status);
 
@@ -0,0 +1,195 @@
+#include "ch10_1553_msg_decoder.h"
+
+const uint16_t Ch101553MsgDecoder::max_byte_count = 72;
+
+void Ch101553MsgDecoder::Add(const Ch101553DecodedMsg& msg)
+{
+    if (count_ == msgs_.size())
+        msgs_.push_back(msg);
+    else
+        msgs_[count_] = msg;
+    count_++;
+}
+
+void Ch101553MsgDecoder::Append(ParquetMilStd1553F1* writer, uint8_t doy,
+    const MilStd1553F1CSDWFmt* csdw, const uint16_t& chanid) const
+{
+    for (size_t i = 0; i < count_; i++)
+    {
+        const Ch101553DecodedMsg& msg = msgs_[i];
+        writer->Append(msg.abs_time, doy, csdw, msg.header, msg.payload, chanid,
+                       msg.calc_payload_word_count, msg.is_payload_incomplete,
+                       msg.status_word1, msg.status_word2);
+    }
+}
+
+bool Ch101553MsgDecoder::DecodePayload(const uint16_t* data,
+    const MilStd1553F1DataHeaderCommWordFmt* data_header, Ch101553DecodedMsg& msg)
+{
+    // Check if the data length is too long to make sense, i.e., if it exceeds
+    // a max of (32 payload words + 2 command words + 2 status words)
+    // * 2 bytes per word = 72 bytes.
+    if (data_header->length > max_byte_count)
+        return false;
+
+    msg.header = data_header;
+    msg.expected_payload_word_count = GetWordCountFromDataHeader(data_header);
+
+    // Set the payload pointer to the position of data pointer.
+    msg.payload = data;
+
+    ParseStatusWords(data, data_header, msg.status_word1, msg.status_word2);
+
+    // Calculate the message payload count from the message length.
+    // We are interested in calculating the payload count to know if
+    // it contains fewer words than expected from the command word.
+    // In the case of BC to RT and RT to RT the series of data words
+    // is followed by a status word. Because the 1553 data are temporally
+    // scheduled, if the 1553 message is short one word it must be the
+    // final word, or the status word for the two transfer formats mentioned.
+    // Modify the subtracted word count (sum of command and status words)
+    // below to compensate for the trailing status word. Ex: An RT to RT
+    // message with a total payload of 70 bytes does not actually truncate
+    // the data payload in the case of a 32-word expected payload,
+    // 70/2 - 3 = 32 words. The fact that a RT to RT message with 32 payload
+    // words is not 72 bytes (36 words = 2 comm + 2 status + 32 data) does
+    // not matter because the data shorage, in this case one word, the final
+    // status word, always occurs at the end of the payload.
+
+    // The subtracted word count mods are:
+    // * RT to RT: 4 --> 3
+    // * BC to RT: 2 --> 1
+    if (data_header->RR)
+    {
+        msg.calc_payload_word_count = (data_header->length / 2) - 3;
+
+        // Skip recieve, transmit and status words
+        msg.payload += 3;
+    }
+    else if (data_header->tx1)
+    {
+        msg.calc_payload_word_count = (data_header->length / 2) - 2;
+
+        // Skip transmit and status words
+        msg.payload += 2;
+    }
+    else
+    {
+        msg.calc_payload_word_count = (data_header->length / 2) - 1;
+
+        // Skip receive command word
+        msg.payload += 1;
+    }
+
+    if (msg.calc_payload_word_count < msg.expected_payload_word_count)
+        msg.is_payload_incomplete = 1;
+    else
+    {
+        msg.calc_payload_word_count = msg.expected_payload_word_count;
+        msg.is_payload_incomplete = 0;
+    }
+
+    return true;
+}
+
+uint16_t Ch101553MsgDecoder::GetWordCountFromDataHeader(
+    const MilStd1553F1DataHeaderCommWordFmt* data_header)
+{
+    // If RT to RT message type, don't check for mode code.
+    if (data_header->RR == 0)
+    {
+        // Check for mode code.
+        if (data_header->sub_addr1 == 0 || data_header->sub_addr1 == 31)
+        {
+            // If mode code, a single data payload word is present if
+            // the mode code, stored in the word count field, is > 15.
+            if (data_header->word_count1 > 15)
+                return 1;
+            else
+                return 0;
+        }
+    }
+
+    if (data_header->word_count1 == 0)
+        return 32;
+    return data_header->word_count1;
+}
+
+void Ch101553MsgDecoder::ParseStatusWords(const uint16_t* payload,
+    const MilStd1553F1DataHeaderCommWordFmt* header,
+    const MilStd1553F1StatusWordFmt*& status1, 
+    const MilStd1553F1StatusWordFmt*& status2)
+{
+    // RT to RT
+    if(header->RR == 1)
+    {
+        // + 4 (rxcomm, txcomm, status . . . . status)
+        if((header->length / 2) >= (header->word_count1 + 4))
+        {
+            status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 2);
+            status2 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 3 + header->word_count1);
+        }
+        else if((header->length / 2) > 2)
+        {
+            status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 2);
+            status2 = nullptr;
+        }
+        else
+        {
+            status1 = nullptr;
+            status2 = nullptr;
+        }
+    }
+    // Mode code
+    else if(header->sub_addr1 == 0 || header->sub_addr1 == 31)
+    {
+        status1 = nullptr;
+        status2 = nullptr;
+
+        // non broadcast
+        if(header->sub_addr1 == 0)
+        {
+            // with data word
+            if(header->word_count1 > 15)
+            {
+                // (modecomm, status, data)
+                if(header->tx1 == 1)
+                {
+                    if((header->length / 2) >= 2)
+                        status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 1);
+                }
+                // (modecomm, data, status)
+                else
+                {
+                    if((header->length / 2) >= 3)
+                        status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 2);
+                }
+            }
+            // without data word (modecomm, status)
+            else if((header->length / 2) >= 2)
+                status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 1);
+        }
+    }
+    // BC to RT
+    else if(header->tx1 == 0)
+    {
+        status1 = nullptr;
+        status2 = nullptr;
+
+        // + 2 (rxcomm . . . status)
+        if((header->length / 2) >= (header->word_count1 + 2))
+        {
+            status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 1 + header->word_count1);
+        }
+    }
+    // RT to BC
+    else if(header->tx1 == 1)
+    {
+        status1 = nullptr;
+        status2 = nullptr;
+
+        // + 2 (txcomm, status . . . )
+        if((header->length / 2) >= 2)
+            status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 1);
+    }
+}
@@ -29,8 +29,10 @@ Ch10Status Ch101553F1Component::Parse(const uint8_t*& data)
 
 Ch10Status Ch101553F1Component::ParseMessages(const uint32_t& msg_count, const uint8_t*& data)
 {
+    decoder_.Clear();
+    status_ = Ch10Status::OK;
+
     // Iterate over messages
-    //uint16_t length = 0;
     for (msg_index_ = 0; msg_index_ < msg_count; msg_index_++)
     {
         // Parse the time component of the intra-packet header. The
@@ -39,7 +41,7 @@ Ch10Status Ch101553F1Component::ParseMessages(const uint32_t& msg_count, const u
         status_ = ch10_time_.ParseIPTS(data, ipts_time_, ctx_->intrapkt_ts_src,
                                        ctx_->time_format);
         if (status_ != Ch10Status::OK)
-            return status_;
+            break;
 
         // Calculate the absolute time using data that were obtained
         // from the IPTS.
@@ -58,7 +60,7 @@ Ch10Status Ch101553F1Component::ParseMessages(const uint32_t& msg_count, const u
             (const MilStd1553F1DataHeaderCommWordFmt*)(*milstd1553f1_data_hdr_elem_.element);
         status_ = ParsePayload(data, milstd1553f1_data_hdr_commword_ptr_);
         if (status_ != Ch10Status::OK)
-            return status_;
+            break;
 
         // Update channel ID to remote address maps and the channel ID to
         // command words integer map.
@@ -67,110 +69,40 @@ Ch10Status Ch101553F1Component::ParseMessages(const uint32_t& msg_count, const u
 
         data += (*milstd1553f1_data_hdr_elem_.element)->length;
 
-        // Append parsed data to the file.
-        ctx_->milstd1553f1_pq_writer->Append(abs_time_, ctx_->tdp_doy,
-                                             *milstd1553f1_csdw_elem_.element, milstd1553f1_data_hdr_commword_ptr_,
-                                             payload_ptr_, ctx_->channel_id, calc_payload_word_count_, is_payload_incomplete_,
-                                             status_word1_, status_word2_);
+        msg_.abs_time = abs_time_;
+        decoder_.Add(msg_);
     }
 
-    return Ch10Status::OK;
+    // Append parsed data to the file.
+    if (decoder_.count > 0)
+        decoder_.Append(ctx_->milstd1553f1_pq_writer, ctx_->tdp_doy,
+                        *milstd1553f1_csdw_elem_.element, ctx_->channel_id);
+
+    return status_;
 }
 
 Ch10Status Ch101553F1Component::ParsePayload(const uint8_t*& data,
                                              const MilStd1553F1DataHeaderCommWordFmt* data_header)
 {
-    // Check if the data length is too long to make sense, i.e., if it exceeds
-    // a max of (32 payload words + 2 command words + 2 status words)
-    // * 2 bytes per word = 72 bytes.
-    if (data_header->length > max_byte_count_)
+    if (!Ch101553MsgDecoder::DecodePayload(reinterpret_cast<const uint16_t*>(data),
+                                           data_header, msg_))
     {
-        uint16_t length = data_header->length;
-        SPDLOG_WARN("({:02d}) 1553 message payload length ({:d}) greater than maximum ({:d})",
-                    ctx_->thread_id, length, max_byte_count_);
+        if (ctx_->RecordDiagnostic("milstd1553f1_msg_length"))
+        {
+            uint16_t length = data_header->length;
+            SPDLOG_WARN("({:02d}) 1553 message payload length ({:d}) greater than maximum ({:d})",
+                        ctx_->thread_id, length, Ch101553MsgDecoder::max_byte_count);
+        }
         return Ch10Status::MILSTD1553_MSG_LENGTH;
     }
 
-    expected_payload_word_count_ = GetWordCountFromDataHeader(data_header);
-
-    // Set the payload pointer to the position of data pointer.
-    payload_ptr_ = (const uint16_t*)data;
-
-    ParseStatusWords(payload_ptr_, data_header, status_word1_, status_word2_);
-
-    // Calculate the message payload count from the message length.
-    // We are interested in calculating the payload count to know if
-    // it contains fewer words than expected from the command word.
-    // In the case of BC to RT and RT to RT the series of data words
-    // is followed by a status word. Because the 1553 data are temporally
-    // scheduled, if the 1553 message is short one word it must be the
-    // final word, or the status word for the two transfer formats mentioned.
-    // Modify the subtracted word count (sum of command and status words)
-    // below to compensate for the trailing status word. Ex: An RT to RT
-    // message with a total payload of 70 bytes does not actually truncate
-    // the data payload in the case of a 32-word expected payload,
-    // 70/2 - 3 = 32 words. The fact that a RT to RT message with 32 payload
-    // words is not 72 bytes (36 words = 2 comm + 2 status + 32 data) does
-    // not matter because the data shorage, in this case one word, the final
-    // status word, always occurs at the end of the payload.
-
-    // The subtracted word count mods are:
-    // * RT to RT: 4 --> 3
-    // * BC to RT: 2 --> 1
-    if (data_header->RR)
-    {
-        calc_payload_word_count_ = (data_header->length / 2) - 3;
-
-        // Skip recieve, transmit and status words
-        payload_ptr_ += 3;
-    }
-    else if (data_header->tx1)
-    {
-        calc_payload_word_count_ = (data_header->length / 2) - 2;
-
-        // Skip transmit and status words
-        payload_ptr_ += 2;
-    }
-    else
-    {
-        calc_payload_word_count_ = (data_header->length / 2) - 1;
-
-        // Skip receive command word
-        payload_ptr_ += 1;
-    }
-
-    if (calc_payload_word_count_ < expected_payload_word_count_)
-        is_payload_incomplete_ = 1;
-    else
-    {
-        calc_payload_word_count_ = expected_payload_word_count_;
-        is_payload_incomplete_ = 0;
-    }
-
     return Ch10Status::OK;
 }
 
 uint16_t Ch101553F1Component::GetWordCountFromDataHeader(
     const MilStd1553F1DataHeaderCommWordFmt* data_header)
 {
-    // If RT to RT message type, don't check for mode code.
-    if (data_header->RR == 0)
-    {
-        // Check for mode code.
-        if (data_header->sub_addr1 == 0 || data_header->sub_addr1 == 31)
-        {
-            // If mode code, a single data payload word is present if
-            // the mode code, stored in the word count field, is > 15.
-            if (data_header->word_count1 > 15)
-                return 1;
-            else
-                return 0;
-        }
-    }
-
-    if (data_header->word_count1 == 0)
-        return 32;
-    return data_header->word_count1;
+    return Ch101553MsgDecoder::GetWordCountFromDataHeader(data_header);
 }
 
 void Ch101553F1Component::ParseStatusWords(const uint16_t*& payload, 
@@ -178,76 +110,5 @@ void Ch101553F1Component::ParseStatusWords(const uint16_t*& payload,
     const MilStd1553F1StatusWordFmt*& status1, 
     const MilStd1553F1StatusWordFmt*& status2)
 {
-    // RT to RT
-    if(header->RR == 1)
-    {
-        // + 4 (rxcomm, txcomm, status . . . . status)
-        if((header->length / 2) >= (header->word_count1 + 4))
-        {
-            status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 2);
-            status2 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 3 + header->word_count1);
-        }
-        else if((header->length / 2) > 2)
-        {
-            status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 2);
-            status2 = nullptr;
-        }
-        else
-        {
-            status1 = nullptr;
-            status2 = nullptr;
-        }
-    }
-    // Mode code
-    else if(header->sub_addr1 == 0 || header->sub_addr1 == 31)
-    {
-        status1 = nullptr;
-        status2 = nullptr;
-
-        // non broadcast
-        if(header->sub_addr1 == 0)
-        {
-            // with data word
-            if(header->word_count1 > 15)
-            {
-                // (modecomm, status, data)
-                if(header->tx1 == 1)
-                {
-                    if((header->length / 2) >= 2)
-                        status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 1);
-                }
-                // (modecomm, data, status)
-                else
-                {
-                    if((header->length / 2) >= 3)
-                        status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 2);
-                }
-            }
-            // without data word (modecomm, status)
-            else if((header->length / 2) >= 2)
-                status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 1);
-        }
-    }
-    // BC to RT
-    else if(header->tx1 == 0)
-    {
-        status1 = nullptr;
-        status2 = nullptr;
-
-        // + 2 (rxcomm . . . status)
-        if((header->length / 2) >= (header->word_count1 + 2))
-        {
-            status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 1 + header->word_count1);
-        }
-    }
-    // RT to BC
-    else if(header->tx1 == 1)
-    {
-        status1 = nullptr;
-        status2 = nullptr;
-
-        // + 2 (txcomm, status . . . )
-        if((header->length / 2) >= 2)
-            status1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(payload + 1);
-    }
+    Ch101553MsgDecoder::ParseStatusWords(payload, header, status1, status2);
 }
@@ -0,0 +1,131 @@
+#include "ch10_1553f2_component.h"
+#include <cstring>
+
+const uint32_t Ch101553F2Component::transaction_word_count = 6;
+const uint32_t Ch101553F2Component::command_index = 0;
+const uint32_t Ch101553F2Component::response_index = 1;
+const uint32_t Ch101553F2Component::status_index = 5;
+
+Ch10Status Ch101553F2Component::Parse(const uint8_t*& data)
+{
+    // Parse the 1553F2 CSDW
+    ParseElements(milstd1553f2_csdw_elem_vec_, data);
+
+    size_t size = 0;
+    if (ctx_->data_size > milstd1553f2_csdw_elem_.size)
+        size = ctx_->data_size - milstd1553f2_csdw_elem_.size;
+
+    return ParseMessages((*milstd1553f2_csdw_elem_.element)->count, data, size);
+}
+
+Ch10Status Ch101553F2Component::ParseMessages(uint32_t msg_count, const uint8_t* data,
+    size_t size)
+{
+    const uint8_t* end = data + size;
+    const size_t transaction_size = transaction_word_count * sizeof(MilStd1553F2WordFmt);
+
+    // Size the header storage before any message points into it. A count
+    // greater than the packet can hold fails on the length check below
+    // before the storage is exhausted.
+    size_t max_count = size / (ctx_->intrapacket_ts_size_ + sizeof(MilStd1553F2DataHeaderFmt) +
+        transaction_size);
+    size_t hdr_count = msg_count < max_count ? msg_count : max_count;
+    if (f1_hdrs_.size() < hdr_count)
+        f1_hdrs_.resize(hdr_count);
+
+    decoder_.Clear();
+    status_ = Ch10Status::OK;
+    Ch101553DecodedMsg msg;
+    uint32_t msg_index = 0;
+    for (; msg_index < msg_count; msg_index++)
+    {
+        if (static_cast<size_t>(end - data) <
+            ctx_->intrapacket_ts_size_ + sizeof(MilStd1553F2DataHeaderFmt))
+        {
+            status_ = Ch10Status::MILSTD1553F2_MSG_LENGTH;
+            break;
+        }
+
+        if ((status_ = ch10_time_.ParseIPTS(data, ipts_time_, ctx_->intrapkt_ts_src,
+            ctx_->time_format)) != Ch10Status::OK)
+            break;
+
+        memcpy(&data_hdr_, data, sizeof(MilStd1553F2DataHeaderFmt));
+        data += sizeof(MilStd1553F2DataHeaderFmt);
+
+        if (data_hdr_.length < transaction_size ||
+            static_cast<size_t>(end - data) < data_hdr_.length)
+        {
+            status_ = Ch10Status::MILSTD1553F2_MSG_LENGTH;
+            break;
+        }
+
+        DecodeTransaction(data_hdr_, data, f1_hdrs_[msg_index], msg);
+        msg.abs_time = ctx_->CalculateIPTSAbsTime(ipts_time_);
+        ctx_->UpdateChannelIDToLRUAddressMaps(ctx_->channel_id, msg.header);
+        decoder_.Add(msg);
+
+        data += data_hdr_.length;
+    }
+
+    if (status_ == Ch10Status::MILSTD1553F2_MSG_LENGTH &&
+        ctx_->RecordDiagnostic("milstd1553f2_msg_length"))
+        SPDLOG_WARN("({:02d}) 1553 F2 message {:d} of {:d} is shorter than a transaction "
+            "or exceeds the packet, channel ID {:d}", ctx_->thread_id, msg_index, msg_count,
+            ctx_->channel_id);
+
+    if (decoder_.count > 0 && ctx_->milstd1553f2_pq_writer != nullptr)
+        decoder_.Append(ctx_->milstd1553f2_pq_writer, ctx_->tdp_doy, &f1_csdw_,
+                        ctx_->channel_id);
+
+    return status_;
+}
+
+void Ch101553F2Component::DecodeTransaction(const MilStd1553F2DataHeaderFmt& hdr,
+    const uint8_t* words, MilStd1553F1DataHeaderCommWordFmt& f1_hdr, Ch101553DecodedMsg& msg)
+{
+    MilStd1553F2WordFmt transaction[transaction_word_count];
+    memcpy(transaction, words, sizeof(transaction));
+
+    uint16_t word_error = 0;
+    for (uint32_t i = 0; i < transaction_word_count; i++)
+        word_error |= transaction[i].PE | transaction[i].WE;
+
+    memset(&f1_hdr, 0, sizeof(MilStd1553F1DataHeaderCommWordFmt));
+    f1_hdr.WE = word_error;
+    f1_hdr.TO = hdr.TM;
+    f1_hdr.FE = hdr.EE;
+    f1_hdr.ME = hdr.TE | hdr.RE | hdr.SE;
+
+    // Command, response and status words
+    f1_hdr.length = 3 * sizeof(uint16_t);
+
+    // The command word is the fourth 16-bit word of the Format 1 header,
+    // see MilStd1553F1DataHeaderCommWordOnlyFmt.
+    uint16_t command = static_cast<uint16_t>(transaction[command_index].data);
+    memcpy(reinterpret_cast<uint8_t*>(&f1_hdr) + 3 * sizeof(uint16_t), &command,
+           sizeof(uint16_t));
+
+    // The 16-bit data of a little-endian word are its first two bytes,
+    // so the response and status words are read from the packet buffer.
+    msg.header = &f1_hdr;
+    msg.payload = reinterpret_cast<const uint16_t*>(
+        words + response_index * sizeof(MilStd1553F2WordFmt));
+    msg.status_word2 = nullptr;
+    msg.expected_payload_word_count = 1;
+
+    // A transaction which times out has neither response nor status.
+    if (hdr.TM)
+    {
+        msg.status_word1 = nullptr;
+        msg.calc_payload_word_count = 0;
+        msg.is_payload_incomplete = 1;
+    }
+    else
+    {
+        msg.status_word1 = reinterpret_cast<const MilStd1553F1StatusWordFmt*>(
+            words + status_index * sizeof(MilStd1553F2WordFmt));
+        msg.calc_payload_word_count = 1;
+        msg.is_payload_incomplete = 0;
+    }
+}
@@ -0,0 +1,97 @@
+#include "ch10_analogf1_component.h"
+#include <cstring>
+
+Ch10Status Ch10AnalogF1Component::Parse(const uint8_t*& data)
+{
+    // Parse the first Analog F1 CSDW
+    ParseElements(analogf1_csdw_elem_vec_, data);
+
+    size_t size = 0;
+    if (ctx_->data_size > analogf1_csdw_elem_.size)
+        size = ctx_->data_size - analogf1_csdw_elem_.size;
+
+    return ParseSamples(data, size);
+}
+
+bool Ch10AnalogF1Component::GetSampleGeometry(const AnalogF1CSDWFmt& csdw,
+    uint32_t& stride_bits, uint32_t& shift)
+{
+    uint32_t length = csdw.length == 0 ? 64 : csdw.length;
+    if (csdw.mode == 2 || length > AnalogSampleUnpack::max_sample_bits)
+        return false;
+
+    if (csdw.mode == 0)
+    {
+        stride_bits = length;
+        shift = 0;
+        return true;
+    }
+
+    // Unpacked samples occupy one or two 16-bit words.
+    stride_bits = length > 16 ? 32 : 16;
+    shift = csdw.mode == 1 ? stride_bits - length : 0;
+    return true;
+}
+
+Ch10Status Ch10AnalogF1Component::ParseSamples(const uint8_t* data, size_t size)
+{
+    const AnalogF1CSDWFmt* first = *analogf1_csdw_elem_.element;
+    frame_count_ = 0;
+    subchannel_count_ = first->totchan == 0 ? 256 : first->totchan;
+
+    // Read the CSDWs of the remaining subchannels.
+    csdws_.resize(first->same ? 1 : subchannel_count_);
+    csdws_[0] = *first;
+    size_t csdw_bytes = (csdws_.size() - 1) * sizeof(AnalogF1CSDWFmt);
+    if (csdw_bytes > size)
+    {
+        if (ctx_->RecordDiagnostic("analogf1_csdw_count"))
+            SPDLOG_WARN("({:02d}) Analog F1 packet is too short for {:d} subchannel CSDWs, "
+                "channel ID {:d}", ctx_->thread_id, subchannel_count_, ctx_->channel_id);
+        return Ch10Status::ANALOGF1_CSDW_COUNT;
+    }
+    if (csdw_bytes > 0)
+        memcpy(csdws_.data() + 1, data, csdw_bytes);
+    data += csdw_bytes;
+    size -= csdw_bytes;
+
+    uint32_t stride_bits = 0;
+    uint32_t shift = 0;
+    bool valid = GetSampleGeometry(csdws_[0], stride_bits, shift);
+    for (size_t i = 1; i < csdws_.size() && valid; i++)
+    {
+        valid = (csdws_[i].mode == csdws_[0].mode && csdws_[i].length == csdws_[0].length &&
+            csdws_[i].factor == csdws_[0].factor);
+    }
+    if (!valid)
+    {
+        if (ctx_->RecordDiagnostic("analogf1_format"))
+            SPDLOG_WARN("({:02d}) Analog F1 sample format (mode {:d}, length {:d}) is not "
+                "supported or differs among subchannels, channel ID {:d}", ctx_->thread_id,
+                static_cast<uint32_t>(csdws_[0].mode), static_cast<uint32_t>(csdws_[0].length),
+                ctx_->channel_id);
+        return Ch10Status::ANALOGF1_FORMAT;
+    }
+
+    // Bits which follow the last complete sample frame are ignored.
+    uint64_t frame_bits = static_cast<uint64_t>(stride_bits) * subchannel_count_;
+    frame_count_ = static_cast<size_t>((static_cast<uint64_t>(size) * 8) / frame_bits);
+    size_t sample_count = frame_count_ * subchannel_count_;
+    if (samples_.size() < sample_count)
+        samples_.resize(sample_count);
+    uint32_t sample_bits = csdws_[0].length;
+    unpack_.Unpack(data, size, sample_count, stride_bits, shift, sample_bits,
+        samples_.data());
+
+    if (ctx_->analogf1_pq_writer == nullptr || frame_count_ == 0)
+        return Ch10Status::OK;
+
+    abs_time_ = ctx_->GetPacketAbsoluteTimeFromHeaderRTC();
+    for (uint32_t subchan = 0; subchan < subchannel_count_; subchan++)
+    {
+        ctx_->analogf1_pq_writer->Append(abs_time_, ctx_->tdp_doy, ctx_->channel_id,
+            static_cast<uint16_t>(subchan + 1), samples_.data() + subchan, frame_count_,
+            subchannel_count_, ctx_->analogf1_decimation);
+    }
+    return Ch10Status::OK;
+}
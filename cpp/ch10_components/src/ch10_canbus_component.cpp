@@ -0,0 +1,94 @@
+#include "ch10_canbus_component.h"
+#include <algorithm>
+#include <cstring>
+
+const size_t Ch10CANBusComponent::max_payload_size = sizeof(uint64_t);
+
+Ch10Status Ch10CANBusComponent::Parse(const uint8_t*& data)
+{
+    // Parse the CAN bus CSDW
+    ParseElements(canbus_csdw_elem_vec_, data);
+
+    size_t size = 0;
+    if (ctx_->data_size > canbus_csdw_elem_.size)
+        size = ctx_->data_size - canbus_csdw_elem_.size;
+
+    return ParseMessages((*canbus_csdw_elem_.element)->count, data, size);
+}
+
+Ch10Status Ch10CANBusComponent::ParseMessages(uint32_t msg_count, const uint8_t* data,
+    size_t size)
+{
+    const uint8_t* end = data + size;
+
+    // Each message is at least the time stamp, message header and ID word.
+    // Don't size the arrays by a count which can't fit in the packet.
+    const size_t min_msg_size = ctx_->intrapacket_ts_size_ + sizeof(CANBusMsgHdrFmt) +
+        sizeof(CANBusIDWordFmt);
+    size_t capacity = std::min<size_t>(msg_count, size / min_msg_size);
+    if (abs_time_.size() < capacity)
+    {
+        abs_time_.resize(capacity);
+        msg_hdr_.resize(capacity);
+        id_word_.resize(capacity);
+        payload_.resize(capacity);
+    }
+
+    status_ = Ch10Status::OK;
+    size_t data_size = 0;
+    size_t msg_size = 0;
+    parsed_count_ = 0;
+    for (uint32_t msg_index = 0; msg_index < msg_count; msg_index++)
+    {
+        if (static_cast<size_t>(end - data) < min_msg_size)
+        {
+            status_ = Ch10Status::CANBUS_MSG_LENGTH;
+            break;
+        }
+
+        if ((status_ = ch10_time_.ParseIPTS(data, ipts_time_, ctx_->intrapkt_ts_src,
+            ctx_->time_format)) != Ch10Status::OK)
+            break;
+
+        CANBusMsgHdrFmt& hdr = msg_hdr_[parsed_count_];
+        memcpy(&hdr, data, sizeof(CANBusMsgHdrFmt));
+        data += sizeof(CANBusMsgHdrFmt);
+
+        // The length includes the ID word. Messages are padded to
+        // a 16-bit boundary.
+        msg_size = hdr.length + (hdr.length & 1);
+        if (hdr.length < sizeof(CANBusIDWordFmt) ||
+            hdr.length > sizeof(CANBusIDWordFmt) + max_payload_size ||
+            static_cast<size_t>(end - data) < msg_size)
+        {
+            status_ = Ch10Status::CANBUS_MSG_LENGTH;
+            break;
+        }
+
+        memcpy(&id_word_[parsed_count_], data, sizeof(CANBusIDWordFmt));
+        data_size = hdr.length - sizeof(CANBusIDWordFmt);
+        payload_[parsed_count_] = AssemblePayload(data + sizeof(CANBusIDWordFmt), data_size);
+        abs_time_[parsed_count_] = ctx_->CalculateIPTSAbsTime(ipts_time_);
+        data += msg_size;
+        parsed_count_++;
+    }
+
+    if (status_ == Ch10Status::CANBUS_MSG_LENGTH && ctx_->RecordDiagnostic("canbus_msg_length"))
+        SPDLOG_WARN("({:02d}) CAN bus message {:d} of {:d} has an invalid length or exceeds "
+            "the packet, channel ID {:d}", ctx_->thread_id, parsed_count_, msg_count,
+            ctx_->channel_id);
+
+    if (parsed_count_ > 0)
+        ctx_->canbus_pq_writer->Append(abs_time_.data(), msg_hdr_.data(), id_word_.data(),
+            payload_.data(), parsed_count_, ctx_->tdp_doy, ctx_->channel_id);
+
+    return status_;
+}
+
+uint64_t Ch10CANBusComponent::AssemblePayload(const uint8_t* data, size_t data_size)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < data_size; i++)
+        value |= static_cast<uint64_t>(data[i]) << (8 * i);
+    return value;
+}
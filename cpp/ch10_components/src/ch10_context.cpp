@@ -49,6 +49,25 @@ Ch10Context::Ch10Context(const uint64_t& abs_pos, uint16_t id) : absolute_positi
                                                                  ethernetf0_pq_writer(nullptr),
                                                                  arinc429f0_pq_writer_(nullptr),
                                                                  arinc429f0_pq_writer(nullptr),
+                                                                 pcmf1_pq_writer_(nullptr),
+                                                                 pcmf1_pq_writer(nullptr),
+                                                                 canbus_pq_writer_(nullptr),
+                                                                 canbus_pq_writer(nullptr),
+                                                                 ethernetf1_pq_writer_(nullptr),
+                                                                 ethernetf1_pq_writer(nullptr),
+                                                                 analogf1_pq_writer_(nullptr),
+                                                                 analogf1_pq_writer(nullptr),
+                                                                 milstd1553f2_pq_writer_(nullptr),
+                                                                 milstd1553f2_pq_writer(nullptr),
+                                                                 uartf0_pq_writer_(nullptr),
+                                                                 uartf0_pq_writer(nullptr),
+                                                                 messagef0_pq_writer_(nullptr),
+                                                                 messagef0_pq_writer(nullptr),
+                                                                 pcmf1_frame_format_(),
+                                                                 pcmf1_frame_format(pcmf1_frame_format_),
+                                                                 analogf1_decimation_(1),
+                                                                 direct_parquet_write_(false),
+                                                                 analogf1_decimation(analogf1_decimation_),
                                                                  chanid_minvideotimestamp_map(chanid_minvideotimestamp_map_),
                                                                  pkt_type_paths_map(pkt_type_paths_enabled_map_),
                                                                  milstd1553f1_pq_ctx_(nullptr),
@@ -56,7 +75,22 @@ Ch10Context::Ch10Context(const uint64_t& abs_pos, uint16_t id) : absolute_positi
                                                                  parsed_packet_types(parsed_packet_types_),
                                                                  tdf1csdw_vec(tdf1csdw_vec_),
                                                                  tdp_abs_time_vec(tdp_abs_time_vec_),
-                                                                 tmats_matter_()
+                                                                 header_parse_timer(PACKET_TIMER_SAMPLE_INTERVAL),
+                                                                 body_parse_timer(PACKET_TIMER_SAMPLE_INTERVAL),
+                                                                 tmats_matter_(),
+                                                                 selected_begin_position_(0),
+                                                                 selected_channel_ids_(),
+                                                                 data_checksum_policy_(Ch10ChecksumPolicy::ALWAYS),
+                                                                 data_checksum_sample_interval_(1),
+                                                                 data_checksum_packet_count_(0),
+                                                                 data_checksum_verified_count_(0),
+                                                                 packet_type_counts_(256, 0),
+                                                                 read_byte_count_(0),
+                                                                 read_time_ns_(0),
+                                                                 sync_loss_count_(0),
+                                                                 resync_byte_count_(0),
+                                                                 header_checksum_fail_count_(0),
+                                                                 data_checksum_fail_count_(0)
 {
     CreateDefaultPacketTypeConfig(pkt_type_config_map_);
 }
@@ -110,12 +144,46 @@ Ch10Context::Ch10Context() : absolute_position_(0),
                              ethernetf0_pq_writer(nullptr),
                              arinc429f0_pq_writer_(nullptr),
                              arinc429f0_pq_writer(nullptr),
+                             pcmf1_pq_writer_(nullptr),
+                             pcmf1_pq_writer(nullptr),
+                             canbus_pq_writer_(nullptr),
+                             canbus_pq_writer(nullptr),
+                             ethernetf1_pq_writer_(nullptr),
+                             ethernetf1_pq_writer(nullptr),
+                             analogf1_pq_writer_(nullptr),
+                             analogf1_pq_writer(nullptr),
+                             milstd1553f2_pq_writer_(nullptr),
+                             milstd1553f2_pq_writer(nullptr),
+                             uartf0_pq_writer_(nullptr),
+                             uartf0_pq_writer(nullptr),
+                             messagef0_pq_writer_(nullptr),
+                             messagef0_pq_writer(nullptr),
+                             pcmf1_frame_format_(),
+                             pcmf1_frame_format(pcmf1_frame_format_),
+                             analogf1_decimation_(1),
+                             direct_parquet_write_(false),
+                             analogf1_decimation(analogf1_decimation_),
                              chanid_minvideotimestamp_map(chanid_minvideotimestamp_map_),
                              pkt_type_paths_map(pkt_type_paths_enabled_map_),
                              parsed_packet_types(parsed_packet_types_),
                              tdf1csdw_vec(tdf1csdw_vec_),
                              tdp_abs_time_vec(tdp_abs_time_vec_),
-                             tmats_matter_()
+                             header_parse_timer(PACKET_TIMER_SAMPLE_INTERVAL),
+                             body_parse_timer(PACKET_TIMER_SAMPLE_INTERVAL),
+                             tmats_matter_(),
+                             selected_begin_position_(0),
+                             selected_channel_ids_(),
+                             data_checksum_policy_(Ch10ChecksumPolicy::ALWAYS),
+                             data_checksum_sample_interval_(1),
+                             data_checksum_packet_count_(0),
+                             data_checksum_verified_count_(0),
+                             packet_type_counts_(256, 0),
+                             read_byte_count_(0),
+                             read_time_ns_(0),
+                             sync_loss_count_(0),
+                             resync_byte_count_(0),
+                             header_checksum_fail_count_(0),
+                             data_checksum_fail_count_(0)
 {
     CreateDefaultPacketTypeConfig(pkt_type_config_map_);
 }
@@ -136,7 +204,7 @@ bool Ch10Context::IsPacketTypeEnabled(const Ch10PacketType& pkt_type)
 
 void Ch10Context::Initialize(const uint64_t& abs_pos, uint16_t id)
 {
-    absolute_position_ = abs_pos;
+    absolute_position_.store(abs_pos, std::memory_order_relaxed);
     thread_id_ = id;
 }
 
@@ -150,6 +218,35 @@ void Ch10Context::SetSearchingForTDP(bool should_search)
     found_tdp_ = false;
 }
 
+void Ch10Context::SetPacketSelection(uint64_t begin_position, 
+    const std::set<uint16_t>& channel_ids)
+{
+    selected_begin_position_ = begin_position;
+    selected_channel_ids_ = channel_ids;
+}
+
+void Ch10Context::SetDataChecksumPolicy(Ch10ChecksumPolicy policy, uint32_t sample_interval)
+{
+    data_checksum_policy_ = policy;
+    data_checksum_sample_interval_ = (sample_interval < 1) ? 1 : sample_interval;
+}
+
+bool Ch10Context::IsPacketSelected(const uint64_t& pkt_position, uint16_t channel_id,
+    uint8_t data_type) const
+{
+    if (data_type == static_cast<uint8_t>(Ch10PacketType::COMPUTER_GENERATED_DATA_F1) ||
+        data_type == static_cast<uint8_t>(Ch10PacketType::TIME_DATA_F1))
+        return true;
+
+    if (pkt_position < selected_begin_position_)
+        return false;
+
+    if (!selected_channel_ids_.empty() && selected_channel_ids_.count(channel_id) == 0)
+        return false;
+
+    return true;
+}
+
 Ch10Status Ch10Context::ContinueWithPacketType(uint8_t data_type)
 {
     // If the boolean searching_for_tdp_ is true then return false unless
@@ -186,7 +283,8 @@ Ch10Status Ch10Context::ContinueWithPacketType(uint8_t data_type)
 
 void Ch10Context::AdvanceAbsPos(uint64_t advance_bytes)
 {
-    absolute_position_ += advance_bytes;
+    absolute_position_.store(absolute_position_.load(std::memory_order_relaxed) + advance_bytes,
+        std::memory_order_relaxed);
 }
 
 Ch10Status Ch10Context::UpdateContext(
@@ -194,7 +292,7 @@ Ch10Status Ch10Context::UpdateContext(
     const Ch10PacketHeaderFmt* const hdr_fmt_ptr,
     const uint64_t& rtc_time)
 {
-    absolute_position_ = abs_pos;
+    absolute_position_.store(abs_pos, std::memory_order_relaxed);
     pkt_size_ = hdr_fmt_ptr->pkt_size;
     data_size_ = hdr_fmt_ptr->data_size;
     intrapkt_ts_src_ = hdr_fmt_ptr->intrapkt_ts_source;
@@ -220,7 +318,8 @@ Ch10Status Ch10Context::UpdateContext(
     // If the channel ID to remote LRU address maps don't have a mapping for the
     // current channel id, then add it, but only if the current packet type is
     // 1553.
-    if (hdr_fmt_ptr->data_type == static_cast<uint8_t>(Ch10PacketType::MILSTD1553_F1))
+    if (hdr_fmt_ptr->data_type == static_cast<uint8_t>(Ch10PacketType::MILSTD1553_F1) ||
+        hdr_fmt_ptr->data_type == static_cast<uint8_t>(Ch10PacketType::MILSTD1553_F2))
     {
         if (chanid_remoteaddr1_map_.count(channel_id_) == 0)
         {
@@ -251,6 +350,13 @@ void Ch10Context::CreateDefaultPacketTypeConfig(std::unordered_map<Ch10PacketTyp
     input[Ch10PacketType::VIDEO_DATA_F0] = true;
     input[Ch10PacketType::ETHERNET_DATA_F0] = true;
     input[Ch10PacketType::ARINC429_F0] = true;
+    input[Ch10PacketType::PCM_F1] = true;
+    input[Ch10PacketType::CAN_BUS] = true;
+    input[Ch10PacketType::ETHERNET_DATA_F1] = true;
+    input[Ch10PacketType::ANALOG_F1] = true;
+    input[Ch10PacketType::MILSTD1553_F2] = true;
+    input[Ch10PacketType::UART_F0] = true;
+    input[Ch10PacketType::MESSAGE_F0] = true;
 }
 
 bool Ch10Context::SetPacketTypeConfig(const std::map<Ch10PacketType, bool>& user_config,
@@ -441,6 +547,14 @@ bool Ch10Context::IsConfigured()
     return is_configured_;
 }
 
+std::unique_ptr<ParquetContext> Ch10Context::CreateParquetContext() const
+{
+    std::unique_ptr<ParquetContext> pq_ctx = std::make_unique<ParquetContext>();
+    if (direct_parquet_write_)
+        pq_ctx->EnableDirectWrite();
+    return pq_ctx;
+}
+
 int Ch10Context::InitializeFileWriters(const std::map<Ch10PacketType, ManagedPath>& enabled_paths)
 {
     // Loop over enabled packet types and create, then submit to relevant parser,
@@ -461,7 +575,7 @@ int Ch10Context::InitializeFileWriters(const std::map<Ch10PacketType, ManagedPat
                 pkt_type_paths_enabled_map_[Ch10PacketType::MILSTD1553_F1] = it->second;
 
                 // Create the writer object.
-                milstd1553f1_pq_ctx_ = std::make_unique<ParquetContext>();
+                milstd1553f1_pq_ctx_ = CreateParquetContext();
                 milstd1553f1_pq_writer_ = std::make_unique<ParquetMilStd1553F1>(milstd1553f1_pq_ctx_.get());
 
                 // Creating this publically accessible pointer is probably not the best
@@ -481,7 +595,7 @@ int Ch10Context::InitializeFileWriters(const std::map<Ch10PacketType, ManagedPat
                 pkt_type_paths_enabled_map_[Ch10PacketType::VIDEO_DATA_F0] = it->second;
 
                 // Create the writer object.
-                videof0_pq_ctx_ = std::make_unique<ParquetContext>();
+                videof0_pq_ctx_ = CreateParquetContext();
                 videof0_pq_writer_ = std::make_unique<ParquetVideoDataF0>(videof0_pq_ctx_.get());
                 if ((retcode = videof0_pq_writer_->Initialize(it->second, thread_id)) != 0)
                     return retcode;
@@ -491,7 +605,7 @@ int Ch10Context::InitializeFileWriters(const std::map<Ch10PacketType, ManagedPat
 
                 pkt_type_file_writers_enabled_map_[Ch10PacketType::ETHERNET_DATA_F0] = true;
                 pkt_type_paths_enabled_map_[Ch10PacketType::ETHERNET_DATA_F0] = it->second;
-                ethernetf0_pq_ctx_ = std::make_unique<ParquetContext>();
+                ethernetf0_pq_ctx_ = CreateParquetContext();
                 ethernetf0_pq_writer_ = std::make_unique<ParquetEthernetF0>(ethernetf0_pq_ctx_.get());
                 if ((retcode = ethernetf0_pq_writer_->Initialize(it->second, thread_id)) != 0)
                     return retcode;
@@ -504,7 +618,7 @@ int Ch10Context::InitializeFileWriters(const std::map<Ch10PacketType, ManagedPat
                 pkt_type_paths_enabled_map_[Ch10PacketType::ARINC429_F0] = it->second;
 
                 // Create the writer object.
-                arinc429f0_pq_ctx_ = std::make_unique<ParquetContext>();
+                arinc429f0_pq_ctx_ = CreateParquetContext();
                 arinc429f0_pq_writer_ = std::make_unique<ParquetARINC429F0>(arinc429f0_pq_ctx_.get());
 
                 // See note after the milstd1553f1_pq_writer_ defined above.
@@ -513,6 +627,73 @@ int Ch10Context::InitializeFileWriters(const std::map<Ch10PacketType, ManagedPat
                     return retcode;
                 arinc429f0_pq_writer = arinc429f0_pq_writer_.get();
                 break;
+            case Ch10PacketType::PCM_F1:
+                pkt_type_file_writers_enabled_map_[Ch10PacketType::PCM_F1] = true;
+                pkt_type_paths_enabled_map_[Ch10PacketType::PCM_F1] = it->second;
+                pcmf1_pq_ctx_ = CreateParquetContext();
+                pcmf1_pq_writer_ = std::make_unique<ParquetPCMF1>(pcmf1_pq_ctx_.get());
+
+                // The list column size is the count of data words per minor
+                // frame, see SetPCMF1FrameFormat.
+                if ((retcode = pcmf1_pq_writer_->Initialize(it->second, thread_id,
+                    pcmf1_frame_format_.words_per_minor_frame)) != 0)
+                    return retcode;
+                pcmf1_pq_writer = pcmf1_pq_writer_.get();
+                break;
+            case Ch10PacketType::CAN_BUS:
+                pkt_type_file_writers_enabled_map_[Ch10PacketType::CAN_BUS] = true;
+                pkt_type_paths_enabled_map_[Ch10PacketType::CAN_BUS] = it->second;
+                canbus_pq_ctx_ = CreateParquetContext();
+                canbus_pq_writer_ = std::make_unique<ParquetCANBus>(canbus_pq_ctx_.get());
+                if ((retcode = canbus_pq_writer_->Initialize(it->second, thread_id)) != 0)
+                    return retcode;
+                canbus_pq_writer = canbus_pq_writer_.get();
+                break;
+            case Ch10PacketType::ETHERNET_DATA_F1:
+                pkt_type_file_writers_enabled_map_[Ch10PacketType::ETHERNET_DATA_F1] = true;
+                pkt_type_paths_enabled_map_[Ch10PacketType::ETHERNET_DATA_F1] = it->second;
+                ethernetf1_pq_ctx_ = CreateParquetContext();
+                ethernetf1_pq_writer_ = std::make_unique<ParquetEthernetF1>(ethernetf1_pq_ctx_.get());
+                if ((retcode = ethernetf1_pq_writer_->Initialize(it->second, thread_id)) != 0)
+                    return retcode;
+                ethernetf1_pq_writer = ethernetf1_pq_writer_.get();
+                break;
+            case Ch10PacketType::ANALOG_F1:
+                pkt_type_file_writers_enabled_map_[Ch10PacketType::ANALOG_F1] = true;
+                pkt_type_paths_enabled_map_[Ch10PacketType::ANALOG_F1] = it->second;
+                analogf1_pq_ctx_ = CreateParquetContext();
+                analogf1_pq_writer_ = std::make_unique<ParquetAnalogF1>(analogf1_pq_ctx_.get());
+                if ((retcode = analogf1_pq_writer_->Initialize(it->second, thread_id)) != 0)
+                    return retcode;
+                analogf1_pq_writer = analogf1_pq_writer_.get();
+                break;
+            case Ch10PacketType::MILSTD1553_F2:
+                pkt_type_file_writers_enabled_map_[Ch10PacketType::MILSTD1553_F2] = true;
+                pkt_type_paths_enabled_map_[Ch10PacketType::MILSTD1553_F2] = it->second;
+                milstd1553f2_pq_ctx_ = CreateParquetContext();
+                milstd1553f2_pq_writer_ = std::make_unique<ParquetMilStd1553F1>(milstd1553f2_pq_ctx_.get());
+                if ((retcode = milstd1553f2_pq_writer_->Initialize(it->second, thread_id)) != 0)
+                    return retcode;
+                milstd1553f2_pq_writer = milstd1553f2_pq_writer_.get();
+                break;
+            case Ch10PacketType::UART_F0:
+                pkt_type_file_writers_enabled_map_[Ch10PacketType::UART_F0] = true;
+                pkt_type_paths_enabled_map_[Ch10PacketType::UART_F0] = it->second;
+                uartf0_pq_ctx_ = CreateParquetContext();
+                uartf0_pq_writer_ = std::make_unique<ParquetUARTF0>(uartf0_pq_ctx_.get());
+                if ((retcode = uartf0_pq_writer_->Initialize(it->second, thread_id)) != 0)
+                    return retcode;
+                uartf0_pq_writer = uartf0_pq_writer_.get();
+                break;
+            case Ch10PacketType::MESSAGE_F0:
+                pkt_type_file_writers_enabled_map_[Ch10PacketType::MESSAGE_F0] = true;
+                pkt_type_paths_enabled_map_[Ch10PacketType::MESSAGE_F0] = it->second;
+                messagef0_pq_ctx_ = CreateParquetContext();
+                messagef0_pq_writer_ = std::make_unique<ParquetMessageF0>(messagef0_pq_ctx_.get());
+                if ((retcode = messagef0_pq_writer_->Initialize(it->second, thread_id)) != 0)
+                    return retcode;
+                messagef0_pq_writer = messagef0_pq_writer_.get();
+                break;
             default:
                 SPDLOG_WARN("({:02d}) No writer defined for {:s}",
                             thread_id, ch10packettype_to_string_map.at(it->first));
@@ -546,6 +727,34 @@ void Ch10Context::CloseFileWriters() const
                 if (pkt_type_file_writers_enabled_map_.at(Ch10PacketType::ARINC429_F0))
                     arinc429f0_pq_ctx_->Close(thread_id_);
                 break;
+            case Ch10PacketType::PCM_F1:
+                if (pkt_type_file_writers_enabled_map_.at(Ch10PacketType::PCM_F1))
+                    pcmf1_pq_ctx_->Close(thread_id_);
+                break;
+            case Ch10PacketType::CAN_BUS:
+                if (pkt_type_file_writers_enabled_map_.at(Ch10PacketType::CAN_BUS))
+                    canbus_pq_ctx_->Close(thread_id_);
+                break;
+            case Ch10PacketType::ETHERNET_DATA_F1:
+                if (pkt_type_file_writers_enabled_map_.at(Ch10PacketType::ETHERNET_DATA_F1))
+                    ethernetf1_pq_ctx_->Close(thread_id_);
+                break;
+            case Ch10PacketType::ANALOG_F1:
+                if (pkt_type_file_writers_enabled_map_.at(Ch10PacketType::ANALOG_F1))
+                    analogf1_pq_ctx_->Close(thread_id_);
+                break;
+            case Ch10PacketType::MILSTD1553_F2:
+                if (pkt_type_file_writers_enabled_map_.at(Ch10PacketType::MILSTD1553_F2))
+                    milstd1553f2_pq_ctx_->Close(thread_id_);
+                break;
+            case Ch10PacketType::UART_F0:
+                if (pkt_type_file_writers_enabled_map_.at(Ch10PacketType::UART_F0))
+                    uartf0_pq_ctx_->Close(thread_id_);
+                break;
+            case Ch10PacketType::MESSAGE_F0:
+                if (pkt_type_file_writers_enabled_map_.at(Ch10PacketType::MESSAGE_F0))
+                    messagef0_pq_ctx_->Close(thread_id_);
+                break;
             case Ch10PacketType::COMPUTER_GENERATED_DATA_F1:
                 // No writer for this type
                 break;
@@ -581,4 +790,67 @@ bool Ch10Context::RegisterUnhandledPacketType(const Ch10PacketType& pkt_type)
     }
 
     return false;
-}
\ No newline at end of file
+}
+
+PerfStats Ch10Context::GetPerfStats() const
+{
+    PerfStats stats;
+    stats.AddCount("bytes_read", read_byte_count_);
+    stats.AddCount("sync_losses", sync_loss_count_);
+    stats.AddCount("resync_bytes", resync_byte_count_);
+    stats.AddCount("header_checksum_failures", header_checksum_fail_count_);
+    stats.AddCount("data_checksum_failures", data_checksum_fail_count_);
+    stats.AddCount("data_checksums_verified", data_checksum_verified_count_);
+    stats.AddCount("data_checksums_skipped", 
+        data_checksum_packet_count_ - data_checksum_verified_count_);
+    for (size_t i = 0; i < packet_type_counts_.size(); i++)
+    {
+        if (packet_type_counts_[i] == 0)
+            continue;
+
+        Ch10PacketType pkt_type = static_cast<Ch10PacketType>(i);
+        std::string type_label;
+        if (ch10packettype_to_string_map.count(pkt_type) == 1)
+            type_label = ch10packettype_to_string_map.at(pkt_type);
+        else
+        {
+            char buffer[16];
+            snprintf(buffer, sizeof(buffer), "type_0x%02zX", i);
+            type_label = buffer;
+        }
+        std::transform(type_label.begin(), type_label.end(), type_label.begin(),
+            [](unsigned char c) { return std::tolower(c); });
+        stats.AddCount("packets_" + type_label, packet_type_counts_[i]);
+    }
+
+    stats.AddTime("read", read_time_ns_);
+    stats.AddTime("header_parse", header_parse_timer.GetElapsedNs());
+    stats.AddTime("body_parse", body_parse_timer.GetElapsedNs());
+    stats.AddTime("worker_shift", shift_timer.GetElapsedNs());
+
+    AddParquetContextStats(milstd1553f1_pq_ctx_.get(), "milstd1553_f1", stats);
+    AddParquetContextStats(videof0_pq_ctx_.get(), "video_data_f0", stats);
+    AddParquetContextStats(ethernetf0_pq_ctx_.get(), "ethernet_data_f0", stats);
+    AddParquetContextStats(arinc429f0_pq_ctx_.get(), "arinc429_f0", stats);
+    AddParquetContextStats(pcmf1_pq_ctx_.get(), "pcm_f1", stats);
+    AddParquetContextStats(canbus_pq_ctx_.get(), "can_bus", stats);
+    AddParquetContextStats(ethernetf1_pq_ctx_.get(), "ethernet_data_f1", stats);
+    AddParquetContextStats(analogf1_pq_ctx_.get(), "analog_f1", stats);
+    AddParquetContextStats(milstd1553f2_pq_ctx_.get(), "milstd1553_f2", stats);
+    AddParquetContextStats(uartf0_pq_ctx_.get(), "uart_f0", stats);
+    AddParquetContextStats(messagef0_pq_ctx_.get(), "message_f0", stats);
+    return stats;
+}
+
+void Ch10Context::AddParquetContextStats(const ParquetContext* pq_ctx,
+    const std::string& type_label, PerfStats& stats)
+{
+    if (pq_ctx == nullptr)
+        return;
+
+    stats.AddCount("rows_written_" + type_label, pq_ctx->written_row_count);
+    stats.AddCount("row_groups_written_" + type_label, pq_ctx->written_row_group_count);
+    stats.AddTime("arrow_build", pq_ctx->build_time_ns);
+    stats.AddTime("parquet_write", pq_ctx->write_time_ns);
+    stats.AddTime("parquet_close", pq_ctx->close_time_ns);
+}
@@ -10,9 +10,12 @@ Ch10Status Ch10EthernetF0Component::Parse(const uint8_t*& data)
     // large. This value is a guess and subject to change.
     if ((*ethernetf0_csdw_elem_.element)->frame_count > max_frame_count_)
     {
-        uint16_t frame_count = (*ethernetf0_csdw_elem_.element)->frame_count;
-        SPDLOG_WARN("({:02d}) Frame count ({:d}) > maximum allowed count ({:d})",
-                    ctx_->thread_id, frame_count, max_frame_count_);
+        if (ctx_->RecordDiagnostic("ethernetf0_frame_count"))
+        {
+            uint16_t frame_count = (*ethernetf0_csdw_elem_.element)->frame_count;
+            SPDLOG_WARN("({:02d}) Frame count ({:d}) > maximum allowed count ({:d})",
+                        ctx_->thread_id, frame_count, max_frame_count_);
+        }
         return Ch10Status::ETHERNETF0_FRAME_COUNT;
     }
 
@@ -51,11 +54,14 @@ Ch10Status Ch10EthernetF0Component::ParseFrames(const EthernetF0CSDW* const csdw
         // sample ch10 files. We don't yet know what this means.
         if (data_length_ == 0)
         {
-            SPDLOG_WARN(
-                "({:02d}) MAC frame data length equal to zero, "
-                "frame index {:d}/{:d}, channel ID {:d}",
-                ctx_->thread_id, frame_index_, csdw_ptr->frame_count - 1,
-                ctx_->channel_id);
+            if (ctx_->RecordDiagnostic("ethernetf0_frame_length_zero"))
+            {
+                SPDLOG_WARN(
+                    "({:02d}) MAC frame data length equal to zero, "
+                    "frame index {:d}/{:d}, channel ID {:d}",
+                    ctx_->thread_id, frame_index_, csdw_ptr->frame_count - 1,
+                    ctx_->channel_id);
+            }
             //continue;
             return Ch10Status::ETHERNETF0_FRAME_LENGTH;
         }
@@ -64,11 +70,14 @@ Ch10Status Ch10EthernetF0Component::ParseFrames(const EthernetF0CSDW* const csdw
         // has not been determined.
         if (data_length_ > mac_frame_max_length_)
         {
-            SPDLOG_WARN(
-                "({:02d}) MAC frame data length ({:d}) > maximum ({:d}), "
-                "frame index {:d}/{:d}, channel ID {:d}",
-                ctx_->thread_id, data_length_, mac_frame_max_length_,
-                frame_index_, csdw_ptr->frame_count - 1, ctx_->channel_id);
+            if (ctx_->RecordDiagnostic("ethernetf0_frame_length_max"))
+            {
+                SPDLOG_WARN(
+                    "({:02d}) MAC frame data length ({:d}) > maximum ({:d}), "
+                    "frame index {:d}/{:d}, channel ID {:d}",
+                    ctx_->thread_id, data_length_, mac_frame_max_length_,
+                    frame_index_, csdw_ptr->frame_count - 1, ctx_->channel_id);
+            }
             return Ch10Status::ETHERNETF0_FRAME_LENGTH;
         }
 
@@ -79,11 +88,14 @@ Ch10Status Ch10EthernetF0Component::ParseFrames(const EthernetF0CSDW* const csdw
         if (!npp_ptr->Parse(data_ptr, data_length_, eth_data_ptr_,
                             ctx_->channel_id))
         {
-            SPDLOG_WARN(
-                "({:02d}) Failed to parse ethernet, frame index {:d}/{:d}, "
-                "channel ID {:d}",
-                ctx_->thread_id, frame_index_,
-                csdw_ptr->frame_count - 1, ctx_->channel_id);
+            if (ctx_->RecordDiagnostic("ethernetf0_frame_parse_error"))
+            {
+                SPDLOG_WARN(
+                    "({:02d}) Failed to parse ethernet, frame index {:d}/{:d}, "
+                    "channel ID {:d}",
+                    ctx_->thread_id, frame_index_,
+                    csdw_ptr->frame_count - 1, ctx_->channel_id);
+            }
             status_ = Ch10Status::ETHERNETF0_FRAME_PARSE_ERROR;
 
             // Do not return status immediately so other ethernet frames
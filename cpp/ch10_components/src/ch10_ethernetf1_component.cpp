@@ -0,0 +1,77 @@
+#include "ch10_ethernetf1_component.h"
+#include <cstring>
+
+// 1518-byte maximum frame less the MAC, IP and UDP headers and the
+// frame check sequence and sequence number
+const uint32_t Ch10EthernetF1Component::max_payload_size = 1471;
+
+Ch10Status Ch10EthernetF1Component::Parse(const uint8_t*& data)
+{
+    // Parse the Ethernet F1 CSDW
+    ParseElements(ethernetf1_csdw_elem_vec_, data);
+
+    size_t size = 0;
+    if (ctx_->data_size > ethernetf1_csdw_elem_.size)
+        size = ctx_->data_size - ethernetf1_csdw_elem_.size;
+
+    return ParseMessages(*ethernetf1_csdw_elem_.element, data, size);
+}
+
+Ch10Status Ch10EthernetF1Component::ParseMessages(const EthernetF1CSDW* csdw,
+    const uint8_t* data, size_t size)
+{
+    const uint8_t* end = data + size;
+    parsed_count_ = 0;
+
+    // The intra-packet header length may exceed the known header, in
+    // which case the remainder is skipped.
+    size_t iph_length = csdw->iph_length;
+    if (iph_length < ctx_->intrapacket_ts_size_ + sizeof(EthernetF1IPDHFmt))
+    {
+        if (ctx_->RecordDiagnostic("ethernetf1_iph_length"))
+            SPDLOG_WARN("({:02d}) Ethernet F1 intra-packet header length ({:d}) is less "
+                "than the known header, channel ID {:d}", ctx_->thread_id, iph_length,
+                ctx_->channel_id);
+        return Ch10Status::ETHERNETF1_IPH_LENGTH;
+    }
+    size_t ipdh_skip = iph_length - ctx_->intrapacket_ts_size_;
+
+    status_ = Ch10Status::OK;
+    for (uint32_t msg_index = 0; msg_index < csdw->msg_count; msg_index++)
+    {
+        if (static_cast<size_t>(end - data) < iph_length)
+        {
+            status_ = Ch10Status::ETHERNETF1_MSG_LENGTH;
+            break;
+        }
+
+        if ((status_ = ch10_time_.ParseIPTS(data, ipts_time_, ctx_->intrapkt_ts_src,
+            ctx_->time_format)) != Ch10Status::OK)
+            break;
+        abs_time_ = ctx_->CalculateIPTSAbsTime(ipts_time_);
+
+        memcpy(&ipdh_, data, sizeof(EthernetF1IPDHFmt));
+        data += ipdh_skip;
+
+        if (ipdh_.data_length > max_payload_size ||
+            static_cast<size_t>(end - data) < ipdh_.data_length)
+        {
+            status_ = Ch10Status::ETHERNETF1_MSG_LENGTH;
+            break;
+        }
+
+        if (ctx_->ethernetf1_pq_writer != nullptr)
+            ctx_->ethernetf1_pq_writer->Append(abs_time_, ctx_->tdp_doy, ctx_->channel_id,
+                                               ipdh_, data);
+        data += ipdh_.data_length;
+        parsed_count_++;
+    }
+
+    if (status_ == Ch10Status::ETHERNETF1_MSG_LENGTH &&
+        ctx_->RecordDiagnostic("ethernetf1_msg_length"))
+        SPDLOG_WARN("({:02d}) Ethernet F1 message {:d} of {:d} has a payload longer than "
+            "{:d} bytes or exceeds the packet, channel ID {:d}", ctx_->thread_id,
+            parsed_count_, csdw->msg_count, max_payload_size, ctx_->channel_id);
+
+    return status_;
+}
@@ -0,0 +1,64 @@
+#include "ch10_messagef0_component.h"
+#include <algorithm>
+#include <cstring>
+
+Ch10Status Ch10MessageF0Component::Parse(const uint8_t*& data)
+{
+    // Parse the Message F0 CSDW
+    ParseElements(messagef0_csdw_elem_vec_, data);
+
+    size_t size = 0;
+    if (ctx_->data_size > messagef0_csdw_elem_.size)
+        size = ctx_->data_size - messagef0_csdw_elem_.size;
+
+    return ParseMessages(*messagef0_csdw_elem_.element, data, size);
+}
+
+Ch10Status Ch10MessageF0Component::ParseMessages(const MessageF0CSDWFmt* csdw,
+    const uint8_t* data, size_t size)
+{
+    const uint8_t* end = data + size;
+    const size_t iph_length = ctx_->intrapacket_ts_size_ + sizeof(MessageF0DataHeaderFmt);
+    parsed_count_ = 0;
+
+    status_ = Ch10Status::OK;
+    for (uint32_t msg_index = 0; msg_index < csdw->count; msg_index++)
+    {
+        if (static_cast<size_t>(end - data) < iph_length)
+        {
+            status_ = Ch10Status::MESSAGEF0_MSG_LENGTH;
+            break;
+        }
+
+        if ((status_ = ch10_time_.ParseIPTS(data, ipts_time_, ctx_->intrapkt_ts_src,
+            ctx_->time_format)) != Ch10Status::OK)
+            break;
+        abs_time_ = ctx_->CalculateIPTSAbsTime(ipts_time_);
+
+        memcpy(&data_hdr_, data, sizeof(MessageF0DataHeaderFmt));
+        data += sizeof(MessageF0DataHeaderFmt);
+
+        if (static_cast<size_t>(end - data) < data_hdr_.length)
+        {
+            status_ = Ch10Status::MESSAGEF0_MSG_LENGTH;
+            break;
+        }
+
+        if (ctx_->messagef0_pq_writer != nullptr)
+            ctx_->messagef0_pq_writer->Append(abs_time_, ctx_->tdp_doy, ctx_->channel_id,
+                                              csdw->pkt_type, data_hdr_, data);
+        parsed_count_++;
+
+        // Data are padded to an even count of bytes. Padding of the
+        // last message may be omitted.
+        data += std::min<size_t>(data_hdr_.length + (data_hdr_.length & 1), end - data);
+    }
+
+    if (status_ == Ch10Status::MESSAGEF0_MSG_LENGTH &&
+        ctx_->RecordDiagnostic("messagef0_msg_length"))
+        SPDLOG_WARN("({:02d}) Message F0 message {:d} of {:d} exceeds the packet, "
+            "channel ID {:d}", ctx_->thread_id, parsed_count_, csdw->count,
+            ctx_->channel_id);
+
+    return status_;
+}
@@ -3,7 +3,13 @@
 void Ch10Packet::SetCh10ComponentParsers(Ch10PacketHeaderComponent* header_comp,
         Ch10TMATSComponent* tmats_comp, Ch10TDPComponent* tdp_comp,
         Ch101553F1Component* milstd1553_comp, Ch10VideoF0Component* video_comp,
-        Ch10EthernetF0Component* eth_comp, Ch10429F0Component* arinc429_comp)
+        Ch10EthernetF0Component* eth_comp, Ch10429F0Component* arinc429_comp,
+        Ch10PCMF1Component* pcmf1_comp, Ch10CANBusComponent* canbus_comp,
+        Ch10EthernetF1Component* ethernetf1_comp,
+        Ch10AnalogF1Component* analogf1_comp,
+        Ch101553F2Component* milstd1553f2_comp,
+        Ch10UARTF0Component* uartf0_comp,
+        Ch10MessageF0Component* messagef0_comp)
 {
     header_ = header_comp;
     tmats_ = tmats_comp;
@@ -12,6 +18,13 @@ void Ch10Packet::SetCh10ComponentParsers(Ch10PacketHeaderComponent* header_comp,
     videof0_component_ = video_comp;
     ethernetf0_component_ = eth_comp;
     arinc429f0_component_ = arinc429_comp;
+    pcmf1_component_ = pcmf1_comp;
+    canbus_component_ = canbus_comp;
+    ethernetf1_component_ = ethernetf1_comp;
+    analogf1_component_ = analogf1_comp;
+    milstd1553f2_component_ = milstd1553f2_comp;
+    uartf0_component_ = uartf0_comp;
+    messagef0_component_ = messagef0_comp;
 }
 
 bool Ch10Packet::IsConfigured()
@@ -70,6 +83,41 @@ bool Ch10Packet::IsConfigured()
         SPDLOG_CRITICAL("Ch10429F0Component pointer is nullptr");
         return false;
     }
+    if(pcmf1_component_ == nullptr)
+    {
+        SPDLOG_CRITICAL("Ch10PCMF1Component pointer is nullptr");
+        return false;
+    }
+    if(canbus_component_ == nullptr)
+    {
+        SPDLOG_CRITICAL("Ch10CANBusComponent pointer is nullptr");
+        return false;
+    }
+    if(ethernetf1_component_ == nullptr)
+    {
+        SPDLOG_CRITICAL("Ch10EthernetF1Component pointer is nullptr");
+        return false;
+    }
+    if(analogf1_component_ == nullptr)
+    {
+        SPDLOG_CRITICAL("Ch10AnalogF1Component pointer is nullptr");
+        return false;
+    }
+    if(milstd1553f2_component_ == nullptr)
+    {
+        SPDLOG_CRITICAL("Ch101553F2Component pointer is nullptr");
+        return false;
+    }
+    if(uartf0_component_ == nullptr)
+    {
+        SPDLOG_CRITICAL("Ch10UARTF0Component pointer is nullptr");
+        return false;
+    }
+    if(messagef0_component_ == nullptr)
+    {
+        SPDLOG_CRITICAL("Ch10MessageF0Component pointer is nullptr");
+        return false;
+    }
 
     return true;
 }
@@ -105,10 +153,25 @@ Ch10Status Ch10Packet::ManageHeaderParseStatus(const Ch10Status& status,
         // packet header. Treat it as a bad sync and look for the next sync.
         if (status == Ch10Status::BAD_SYNC || status == Ch10Status::CHECKSUM_FALSE)
         {
-            if (ctx_->thread_id == 0)
+            if (status == Ch10Status::CHECKSUM_FALSE)
+                ctx_->CountHeaderChecksumFailure();
+            bool new_sync_loss = !sync_lost_;
+            if (new_sync_loss)
             {
-                SPDLOG_DEBUG("({:02d}) status = {:s}", ctx_->thread_id,
-                             Ch10StatusString(status));
+                sync_lost_ = true;
+                ctx_->CountSyncLoss();
+            }
+
+            // A bad sync is recorded once per search, not per byte
+            // searched. Only the first occurrences are logged. Corrupt
+            // recordings may otherwise produce one line per search.
+            if ((status == Ch10Status::CHECKSUM_FALSE || new_sync_loss) &&
+                ctx_->RecordDiagnostic(status == Ch10Status::BAD_SYNC ?
+                "bad_sync" : "header_checksum_false"))
+            {
+                SPDLOG_DEBUG("({:02d}) status = {:s}, absolute position {:d}",
+                             ctx_->thread_id, Ch10StatusString(status),
+                             ctx_->absolute_position.load(std::memory_order_relaxed));
             }
             status_ = AdvanceBuffer(1);
 
@@ -118,6 +181,7 @@ Ch10Status Ch10Packet::ManageHeaderParseStatus(const Ch10Status& status,
 
             // Advance the absolute position the same amount.
             ctx_->AdvanceAbsPos(1);
+            ctx_->CountResyncBytes(1);
 
             // Otherwise indicate the bad sync status.
             return Ch10Status::BAD_SYNC;
@@ -127,6 +191,7 @@ Ch10Status Ch10Packet::ManageHeaderParseStatus(const Ch10Status& status,
         // beginning of the next packet.
         else
         {
+            sync_lost_ = false;
             SPDLOG_DEBUG("({:02d}) status = {:s}", ctx_->thread_id,
                          Ch10StatusString(status));
             status_ = AdvanceBuffer(pkt_size);
@@ -143,6 +208,7 @@ Ch10Status Ch10Packet::ManageHeaderParseStatus(const Ch10Status& status,
             return Ch10Status::PKT_TYPE_NO;
         }
     }
+    sync_lost_ = false;
     return Ch10Status::OK;
 }
 
@@ -197,6 +263,12 @@ Ch10Status Ch10Packet::ParseHeader()
     if (!bb_->BytesAvailable(temp_pkt_size_))
         return Ch10Status::BUFFER_LIMITED;
 
+    // Skip packets which are not selected, i.e., outside of a selected
+    // range or channel ID, without verifying the data checksum.
+    if (!ctx_->IsPacketSelected(ctx_->absolute_position.load(std::memory_order_relaxed),
+        hdr->chanID, hdr->data_type))
+        return ManageHeaderParseStatus(Ch10Status::PKT_TYPE_NO, temp_pkt_size_);
+
     // Whether the header (possibly secondary header) have been parsed correctly,
     // move the absolute position and buffer position to the beginning of the next
     // ch10 header, which ought to occur after pkt_size bytes. Configuring these
@@ -209,7 +281,8 @@ Ch10Status Ch10Packet::ParseHeader()
         return status_;
 
     // Configure context to prepare for use by the packet body parsers.
-    status_ = ctx_->UpdateContext(ctx_->absolute_position + temp_pkt_size_,
+    status_ = ctx_->UpdateContext(
+        ctx_->absolute_position.load(std::memory_order_relaxed) + temp_pkt_size_,
                                   hdr,
                                   ch10_time_->CalculateRTCTimeFromComponents(hdr->rtc1,
                                                                             hdr->rtc2));
@@ -222,11 +295,20 @@ Ch10Status Ch10Packet::ParseHeader()
     //
     // At this point data_ptr_ has been modified to point at the bytes immediately
     // after the header or header+secondary header.
-    status_ = header_->VerifyDataChecksum(data_ptr_, hdr->checksum_existence,
-                                         hdr->pkt_size, hdr->secondary_hdr);
-    // If the checksum does not match, Skip this pkt.
-    if (status_ == Ch10Status::CHECKSUM_FALSE)
-        return Ch10Status::PKT_TYPE_NO;
+    //
+    // The checksum of some or all packets is not verified if the user
+    // trusts the recording source, see Ch10Context::SetDataChecksumPolicy.
+    if (ctx_->ShouldVerifyDataChecksum())
+    {
+        status_ = header_->VerifyDataChecksum(data_ptr_, hdr->checksum_existence,
+                                             hdr->pkt_size, hdr->secondary_hdr);
+        // If the checksum does not match, Skip this pkt.
+        if (status_ == Ch10Status::CHECKSUM_FALSE)
+        {
+            ctx_->CountDataChecksumFailure();
+            return Ch10Status::PKT_TYPE_NO;
+        }
+    }
 
     // Handle parsing of the secondary header. This is currently not
     // completed. Data parsed in this step are not utilized.
@@ -262,7 +344,9 @@ void Ch10Packet::ParseBody()
     // an argument and then ParseHeader, then ParseBody can be called. The
     // pkt_type_ can be checked via current_pkt_type.
     pkt_type_ = Ch10PacketType::NONE;
-    switch (header_->GetHeader()->data_type)
+    uint8_t data_type = header_->GetHeader()->data_type;
+    ctx_->CountPacket(data_type);
+    switch (data_type)
     {
         case static_cast<uint8_t>(Ch10PacketType::COMPUTER_GENERATED_DATA_F1):
             if (ctx_->IsPacketTypeEnabled(Ch10PacketType::COMPUTER_GENERATED_DATA_F1))
@@ -316,12 +400,60 @@ void Ch10Packet::ParseBody()
                 arinc429f0_component_->Parse(data_ptr_);
             }
             break;
+        case static_cast<uint8_t>(Ch10PacketType::PCM_F1):
+            if (ctx_->IsPacketTypeEnabled(Ch10PacketType::PCM_F1))
+            {
+                pkt_type_ = Ch10PacketType::PCM_F1;
+                pcmf1_component_->Parse(data_ptr_);
+            }
+            break;
+        case static_cast<uint8_t>(Ch10PacketType::CAN_BUS):
+            if (ctx_->IsPacketTypeEnabled(Ch10PacketType::CAN_BUS))
+            {
+                pkt_type_ = Ch10PacketType::CAN_BUS;
+                canbus_component_->Parse(data_ptr_);
+            }
+            break;
+        case static_cast<uint8_t>(Ch10PacketType::ETHERNET_DATA_F1):
+            if (ctx_->IsPacketTypeEnabled(Ch10PacketType::ETHERNET_DATA_F1))
+            {
+                pkt_type_ = Ch10PacketType::ETHERNET_DATA_F1;
+                ethernetf1_component_->Parse(data_ptr_);
+            }
+            break;
+        case static_cast<uint8_t>(Ch10PacketType::ANALOG_F1):
+            if (ctx_->IsPacketTypeEnabled(Ch10PacketType::ANALOG_F1))
+            {
+                pkt_type_ = Ch10PacketType::ANALOG_F1;
+                analogf1_component_->Parse(data_ptr_);
+            }
+            break;
+        case static_cast<uint8_t>(Ch10PacketType::MILSTD1553_F2):
+            if (ctx_->IsPacketTypeEnabled(Ch10PacketType::MILSTD1553_F2))
+            {
+                pkt_type_ = Ch10PacketType::MILSTD1553_F2;
+                milstd1553f2_component_->Parse(data_ptr_);
+            }
+            break;
+        case static_cast<uint8_t>(Ch10PacketType::UART_F0):
+            if (ctx_->IsPacketTypeEnabled(Ch10PacketType::UART_F0))
+            {
+                pkt_type_ = Ch10PacketType::UART_F0;
+                uartf0_component_->Parse(data_ptr_);
+            }
+            break;
+        case static_cast<uint8_t>(Ch10PacketType::MESSAGE_F0):
+            if (ctx_->IsPacketTypeEnabled(Ch10PacketType::MESSAGE_F0))
+            {
+                pkt_type_ = Ch10PacketType::MESSAGE_F0;
+                messagef0_component_->Parse(data_ptr_);
+            }
+            break;
         default:
             // If the packet type is configured (exists in the pkt_type_config_map)
             // and enabled (has a value of true) and does not have a parser, then
             // alert the user.
-            Ch10PacketType pkt_type = static_cast<Ch10PacketType>(
-                header_->GetHeader()->data_type);
+            Ch10PacketType pkt_type = static_cast<Ch10PacketType>(data_type);
             if (ctx_->RegisterUnhandledPacketType(pkt_type))
             {
                 SPDLOG_WARN("({:02d}) No parser exists for {:s}", ctx_->thread_id,
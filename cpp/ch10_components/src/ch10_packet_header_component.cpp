@@ -1,5 +1,6 @@
 
 #include "ch10_packet_header_component.h"
+#include <cstring>
 
 Ch10Status Ch10PacketHeaderComponent::Parse(const uint8_t*& data)
 {
@@ -71,7 +72,8 @@ Ch10Status Ch10PacketHeaderComponent::VerifyHeaderChecksum(const uint8_t* pkt_da
     if (checksum_value16_ == checksum_value)
         return Ch10Status::CHECKSUM_TRUE;
 
-    SPDLOG_WARN("({:02d}) Header checksum fail", ctx_->thread_id);
+    // Failures are counted and the first occurrences logged by
+    // Ch10Packet, which treats them as a loss of sync.
     return Ch10Status::CHECKSUM_FALSE;
 }
 
@@ -86,10 +88,13 @@ Ch10Status Ch10PacketHeaderComponent::VerifySecondaryHeaderChecksum(const uint8_
     if (checksum_value16_ == checksum_value)
         return Ch10Status::CHECKSUM_TRUE;
 
-    SPDLOG_WARN(
-        "({:02d}) Secondary header checksum fail: calculated value = {:d}, "
-        "expected value = {:d}",
-        ctx_->thread_id, checksum_value16_, checksum_value);
+    if (ctx_->RecordDiagnostic("secondary_header_checksum_false"))
+    {
+        SPDLOG_WARN(
+            "({:02d}) Secondary header checksum fail: calculated value = {:d}, "
+            "expected value = {:d}",
+            ctx_->thread_id, checksum_value16_, checksum_value);
+    }
     return Ch10Status::CHECKSUM_FALSE;
 }
 
@@ -104,31 +109,18 @@ Ch10Status Ch10PacketHeaderComponent::VerifyDataChecksum(const uint8_t* body_dat
     else
         checksum_byte_count = pkt_size - std_hdr_size_;
 
+    // The recorded checksum value occupies the last bytes of the packet,
+    // which are not included in the sum. Copy the value because it need
+    // not be aligned.
+    bool match = false;
+
     // 16-bit data checksum
     if (checksum_existence == 2)
     {
-        // Adjust total byte count by the last few bytes in the footer
-        // which are occupied by the value of the data checksum.
         checksum_byte_count -= 2;
-
-        // Get the last 2 bytes from the packet and interpret as
-        // the recorded checksum value.
-        checksum_data_ptr16_ = (const uint16_t*)(body_data + checksum_byte_count);
-        uint16_t checksum_value = *checksum_data_ptr16_;
-
-        checksum_unit_count_ = checksum_byte_count / 2;
-        checksum_data_ptr16_ = (const uint16_t*)body_data;
-        checksum_value16_ = 0;
-        for (uint32_t i = 0; i < checksum_unit_count_; i++)
-        {
-            checksum_value16_ += checksum_data_ptr16_[i];
-            //printf("summing %hu\n", checksum_data_ptr16_[i]);
-        }
-        /*printf("Ch10PacketHeaderComponent::VerifyDataChecksum(): checksum_value16_ = %hu\n",
-            checksum_value16_);
-        printf("expected value = %hu\n", checksum_value);*/
-        if (checksum_value16_ == checksum_value)
-            return Ch10Status::CHECKSUM_TRUE;
+        uint16_t checksum_value = 0;
+        memcpy(&checksum_value, body_data + checksum_byte_count, sizeof(checksum_value));
+        match = (checksum_kernels_.sum16(body_data, checksum_byte_count / 2) == checksum_value);
     }
     // No data checksum present.
     else if (checksum_existence == 0)
@@ -137,42 +129,22 @@ Ch10Status Ch10PacketHeaderComponent::VerifyDataChecksum(const uint8_t* body_dat
     else if (checksum_existence == 1)
     {
         checksum_byte_count -= 1;
-
-        checksum_data_ptr8_ = (const uint8_t*)(body_data + checksum_byte_count);
-        uint8_t checksum_value = *checksum_data_ptr8_;
-
-        checksum_unit_count_ = checksum_byte_count;
-        checksum_data_ptr8_ = body_data;
-        checksum_value8_ = 0;
-        for (uint32_t i = 0; i < checksum_unit_count_; i++)
-        {
-            checksum_value8_ += checksum_data_ptr8_[i];
-            //printf("summing %hhu\n", checksum_data_ptr8_[i]);
-        }
-        /*printf("Ch10PacketHeaderComponent::VerifyDataChecksum(): checksum_value8_ = %hhu\n",
-            checksum_value8_);
-        printf("expected value = %hhu\n", checksum_value);*/
-        if (checksum_value8_ == checksum_value)
-            return Ch10Status::CHECKSUM_TRUE;
+        uint8_t checksum_value = body_data[checksum_byte_count];
+        match = (checksum_kernels_.sum8(body_data, checksum_byte_count) == checksum_value);
     }
     // 32-bit data checksum
     else if (checksum_existence == 3)
     {
         checksum_byte_count -= 4;
-
-        checksum_data_ptr32_ = (const uint32_t*)(body_data + checksum_byte_count);
-        uint32_t checksum_value = *checksum_data_ptr32_;
-
-        checksum_unit_count_ = checksum_byte_count / 4;
-        checksum_data_ptr32_ = (const uint32_t*)body_data;
-        checksum_value32_ = 0;
-        for (uint32_t i = 0; i < checksum_unit_count_; i++)
-            checksum_value32_ += checksum_data_ptr32_[i];
-
-        if (checksum_value32_ == checksum_value)
-            return Ch10Status::CHECKSUM_TRUE;
+        uint32_t checksum_value = 0;
+        memcpy(&checksum_value, body_data + checksum_byte_count, sizeof(checksum_value));
+        match = (checksum_kernels_.sum32(body_data, checksum_byte_count / 4) == checksum_value);
     }
 
-    SPDLOG_WARN("({:02d}) Data checksum fail", ctx_->thread_id);
+    if (match)
+        return Ch10Status::CHECKSUM_TRUE;
+
+    if (ctx_->RecordDiagnostic("data_checksum_false"))
+        SPDLOG_WARN("({:02d}) Data checksum fail", ctx_->thread_id);
     return Ch10Status::CHECKSUM_FALSE;
-}
\ No newline at end of file
+}
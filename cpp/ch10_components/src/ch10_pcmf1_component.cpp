@@ -0,0 +1,251 @@
+#include "ch10_pcmf1_component.h"
+#include <cstring>
+
+Ch10Status Ch10PCMF1Component::Parse(const uint8_t*& data)
+{
+    // Parse the PCM F1 CSDW
+    ParseElements(pcmf1_csdw_elem_vec_, data);
+    csdw_ = *pcmf1_csdw_elem_.element;
+
+    if (!frame_sync_configured_)
+    {
+        if ((status_ = ConfigureFrameFormat(ctx_->pcmf1_frame_format)) != Ch10Status::OK)
+            return status_;
+    }
+
+    size_t size = 0;
+    if (ctx_->data_size > pcmf1_csdw_elem_.size)
+        size = ctx_->data_size - pcmf1_csdw_elem_.size;
+
+    if (csdw_->THR)
+        return ParseThroughput(data, size);
+    if (csdw_->PM || csdw_->UM)
+        return ParseMinorFrames(data, size, csdw_->PM);
+
+    if (ctx_->RecordDiagnostic("pcmf1_mode"))
+        SPDLOG_WARN("({:02d}) PCM F1 packet mode is not packed, unpacked or throughput",
+            ctx_->thread_id);
+    return Ch10Status::PCMF1_MODE;
+}
+
+Ch10Status Ch10PCMF1Component::ConfigureFrameFormat(const PCMF1FrameFormat& frame_format)
+{
+    if (!frame_format.IsConfigured() || frame_format.word_bits < 1 ||
+        frame_format.word_bits > 32 ||
+        !frame_sync_.Configure(frame_format.sync_pattern, frame_format.sync_bits))
+    {
+        if (ctx_->RecordDiagnostic("pcmf1_frame_format"))
+            SPDLOG_WARN("({:02d}) PCM F1 frame format is not configured or invalid",
+                ctx_->thread_id);
+        return Ch10Status::PCMF1_FRAME_FORMAT;
+    }
+
+    frame_format_ = frame_format;
+    words_.resize(frame_format_.words_per_minor_frame);
+    frame_sync_configured_ = true;
+    return Ch10Status::OK;
+}
+
+Ch10Status Ch10PCMF1Component::ParseMinorFrames(const uint8_t* data, size_t size, bool packed)
+{
+    const uint8_t* end = data + size;
+    bool align32 = csdw_->AL;
+    size_t align_bytes = align32 ? sizeof(uint32_t) : sizeof(uint16_t);
+    size_t frame_size = packed ? PackedFrameSize(frame_format_, align32) :
+        UnpackedFrameSize(frame_format_, align32);
+
+    // The intra-packet header is the time stamp followed by the intra-packet
+    // data header, which has the size of the alignment.
+    size_t iph_size = csdw_->IPH ? ctx_->intrapacket_ts_size_ + align_bytes : 0;
+    if (packed && stream_.size() < frame_size)
+        stream_.resize(frame_size);
+
+    uint8_t lockst = 0;
+    PCMF1IPDHFmt ipdh;
+    bool sync_match = false;
+    while (static_cast<size_t>(end - data) >= iph_size + frame_size)
+    {
+        if (csdw_->IPH)
+        {
+            status_ = ch10_time_.ParseIPTS(data, ipts_time_, ctx_->intrapkt_ts_src,
+                                           ctx_->time_format);
+            if (status_ != Ch10Status::OK)
+                return status_;
+            abs_time_ = ctx_->CalculateIPTSAbsTime(ipts_time_);
+
+            memcpy(&ipdh, data, sizeof(PCMF1IPDHFmt));
+            lockst = static_cast<uint8_t>(ipdh.lockst);
+            data += align_bytes;
+        }
+        else
+            abs_time_ = ctx_->GetPacketAbsoluteTimeFromHeaderRTC();
+
+        if (packed)
+        {
+            CopyToBitStream(data, frame_size, align32, stream_.data());
+            sync_match = frame_sync_.Match(stream_.data(), frame_size, 0);
+            DecommutateStream(stream_.data(), frame_format_.sync_bits);
+        }
+        else
+            sync_match = DecommutateUnpacked(data);
+
+        // The frame is written regardless, as indicated by the lock status.
+        if (!sync_match && ctx_->RecordDiagnostic("pcmf1_sync_mismatch"))
+            SPDLOG_WARN("({:02d}) PCM F1 minor frame sync pattern does not match, channel ID {:d}",
+                ctx_->thread_id, ctx_->channel_id);
+
+        ctx_->pcmf1_pq_writer->Append(abs_time_, ctx_->tdp_doy, ctx_->channel_id, csdw_,
+                                      lockst, words_.data());
+        data += frame_size;
+    }
+
+    // Remaining bytes which are not a complete minor frame indicate that
+    // the frame format does not match the data.
+    if (data != end && ctx_->RecordDiagnostic("pcmf1_frame_length"))
+        SPDLOG_WARN("({:02d}) PCM F1 packet has {:d} bytes which are not a complete "
+            "minor frame, channel ID {:d}", ctx_->thread_id, end - data, ctx_->channel_id);
+
+    return Ch10Status::OK;
+}
+
+Ch10Status Ch10PCMF1Component::ParseThroughput(const uint8_t* data, size_t size)
+{
+    PCMF1ThroughputState& state = throughput_state_[ctx_->channel_id];
+    uint64_t packet_time = ctx_->GetPacketAbsoluteTimeFromHeaderRTC();
+    bool align32 = csdw_->AL;
+    size -= size % (align32 ? sizeof(uint32_t) : sizeof(uint16_t));
+
+    // Bit stream of the carried bits followed by the bits of this packet
+    size_t carry_size = state.carry.size();
+    stream_.resize(carry_size + size);
+    std::copy(state.carry.cbegin(), state.carry.cend(), stream_.begin());
+    CopyToBitStream(data, size, align32, stream_.data() + carry_size);
+
+    const uint8_t* stream = stream_.data();
+    size_t stream_size = stream_.size();
+    uint64_t total_bits = static_cast<uint64_t>(stream_size) * 8;
+    uint64_t frame_bits = frame_format_.MinorFrameBits();
+    uint64_t pos = state.bit_pos;
+    while (true)
+    {
+        if (!state.locked)
+        {
+            uint64_t found = frame_sync_.Find(stream, stream_size, pos);
+            if (found == PCMFrameSync::npos)
+            {
+                // A pattern may begin in the final sync_bits - 1 bits and
+                // end in the next packet.
+                uint64_t tail = total_bits - std::min<uint64_t>(total_bits,
+                    frame_format_.sync_bits - 1);
+                if (tail > pos)
+                    pos = tail;
+                break;
+            }
+            pos = found;
+            state.locked = true;
+        }
+
+        // Wait for the remainder of the minor frame in the next packet.
+        if (pos + frame_bits > total_bits)
+            break;
+
+        // Resume the search at the next bit if the sync pattern is not
+        // where it is expected.
+        if (!frame_sync_.Match(stream, stream_size, pos))
+        {
+            if (ctx_->RecordDiagnostic("pcmf1_sync_loss"))
+                SPDLOG_WARN("({:02d}) PCM F1 throughput mode sync loss, channel ID {:d}",
+                    ctx_->thread_id, ctx_->channel_id);
+            state.locked = false;
+            pos++;
+            continue;
+        }
+
+        DecommutateStream(stream, pos + frame_format_.sync_bits);
+        abs_time_ = (pos < static_cast<uint64_t>(carry_size) * 8) ? state.time : packet_time;
+        ctx_->pcmf1_pq_writer->Append(abs_time_, ctx_->tdp_doy, ctx_->channel_id, csdw_,
+                                      0, words_.data());
+        pos += frame_bits;
+    }
+
+    size_t keep = static_cast<size_t>(pos / 8);
+    if (keep >= carry_size)
+        state.time = packet_time;
+    state.carry.assign(stream + keep, stream + stream_size);
+    state.bit_pos = pos - static_cast<uint64_t>(keep) * 8;
+    return Ch10Status::OK;
+}
+
+size_t Ch10PCMF1Component::PackedFrameSize(const PCMF1FrameFormat& frame_format, bool align32)
+{
+    uint64_t align_bits = align32 ? 32 : 16;
+    uint64_t aligned_words = (frame_format.MinorFrameBits() + align_bits - 1) / align_bits;
+    return static_cast<size_t>(aligned_words * (align_bits / 8));
+}
+
+size_t Ch10PCMF1Component::UnpackedFrameSize(const PCMF1FrameFormat& frame_format, bool align32)
+{
+    size_t sync_count = (frame_format.sync_bits + 15) / 16;
+    size_t word_count = static_cast<size_t>(frame_format.words_per_minor_frame) *
+        ((frame_format.word_bits + 15) / 16);
+    size_t size = (sync_count + word_count) * sizeof(uint16_t);
+    if (align32)
+        size = (size + sizeof(uint32_t) - 1) / sizeof(uint32_t) * sizeof(uint32_t);
+    return size;
+}
+
+void Ch10PCMF1Component::CopyToBitStream(const uint8_t* data, size_t size, bool align32,
+    uint8_t* out)
+{
+    // Index of a byte within its word, reversed by XOR.
+    size_t flip = align32 ? 3 : 1;
+    size_t whole_size = size - size % (flip + 1);
+    for (size_t i = 0; i < whole_size; i++)
+        out[i] = data[i ^ flip];
+    for (size_t i = whole_size; i < size; i++)
+        out[i] = data[i];
+}
+
+void Ch10PCMF1Component::DecommutateStream(const uint8_t* stream, uint64_t bit_pos)
+{
+    uint32_t word_bits = frame_format_.word_bits;
+    for (uint32_t i = 0; i < frame_format_.words_per_minor_frame; i++)
+    {
+        words_[i] = static_cast<uint32_t>(PCMFrameSync::ReadBits(stream, bit_pos, word_bits));
+        bit_pos += word_bits;
+    }
+}
+
+bool Ch10PCMF1Component::DecommutateUnpacked(const uint8_t* data)
+{
+    // Concatenate the 16-bit little-endian containers of one item and
+    // keep the low bits.
+    size_t index = 0;
+    uint16_t container = 0;
+    uint32_t container_count = (frame_format_.sync_bits + 15) / 16;
+    uint64_t sync = 0;
+    for (uint32_t i = 0; i < container_count; i++, index++)
+    {
+        memcpy(&container, data + index * sizeof(uint16_t), sizeof(uint16_t));
+        sync = (sync << 16) | container;
+    }
+    if (frame_format_.sync_bits < 64)
+        sync &= (uint64_t(1) << frame_format_.sync_bits) - 1;
+
+    uint32_t word_bits = frame_format_.word_bits;
+    uint64_t word_mask = (uint64_t(1) << word_bits) - 1;
+    container_count = (word_bits + 15) / 16;
+    uint64_t word = 0;
+    for (uint32_t i = 0; i < frame_format_.words_per_minor_frame; i++)
+    {
+        word = 0;
+        for (uint32_t j = 0; j < container_count; j++, index++)
+        {
+            memcpy(&container, data + index * sizeof(uint16_t), sizeof(uint16_t));
+            word = (word << 16) | container;
+        }
+        words_[i] = static_cast<uint32_t>(word & word_mask);
+    }
+
+    return sync == frame_format_.sync_pattern;
+}
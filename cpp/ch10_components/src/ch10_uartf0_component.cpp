@@ -0,0 +1,72 @@
+#include "ch10_uartf0_component.h"
+#include <algorithm>
+#include <cstring>
+
+Ch10Status Ch10UARTF0Component::Parse(const uint8_t*& data)
+{
+    // Parse the UART F0 CSDW
+    ParseElements(uartf0_csdw_elem_vec_, data);
+
+    size_t size = 0;
+    if (ctx_->data_size > uartf0_csdw_elem_.size)
+        size = ctx_->data_size - uartf0_csdw_elem_.size;
+
+    return ParseMessages(*uartf0_csdw_elem_.element, data, size);
+}
+
+Ch10Status Ch10UARTF0Component::ParseMessages(const UARTF0CSDWFmt* csdw,
+    const uint8_t* data, size_t size)
+{
+    const uint8_t* end = data + size;
+    parsed_count_ = 0;
+
+    size_t iph_length = sizeof(UARTF0DataHeaderFmt);
+    if (csdw->IPH)
+        iph_length += ctx_->intrapacket_ts_size_;
+    else
+        abs_time_ = ctx_->GetPacketAbsoluteTimeFromHeaderRTC();
+
+    status_ = Ch10Status::OK;
+    while (data < end)
+    {
+        if (static_cast<size_t>(end - data) < iph_length)
+        {
+            status_ = Ch10Status::UARTF0_MSG_LENGTH;
+            break;
+        }
+
+        if (csdw->IPH)
+        {
+            if ((status_ = ch10_time_.ParseIPTS(data, ipts_time_, ctx_->intrapkt_ts_src,
+                ctx_->time_format)) != Ch10Status::OK)
+                break;
+            abs_time_ = ctx_->CalculateIPTSAbsTime(ipts_time_);
+        }
+
+        memcpy(&data_hdr_, data, sizeof(UARTF0DataHeaderFmt));
+        data += sizeof(UARTF0DataHeaderFmt);
+
+        if (static_cast<size_t>(end - data) < data_hdr_.data_length)
+        {
+            status_ = Ch10Status::UARTF0_MSG_LENGTH;
+            break;
+        }
+
+        if (ctx_->uartf0_pq_writer != nullptr)
+            ctx_->uartf0_pq_writer->Append(abs_time_, ctx_->tdp_doy, ctx_->channel_id,
+                                           data_hdr_, data);
+        parsed_count_++;
+
+        // Data are padded to an even count of bytes. Padding of the
+        // last message may be omitted.
+        data += std::min<size_t>(data_hdr_.data_length + (data_hdr_.data_length & 1),
+                                 end - data);
+    }
+
+    if (status_ == Ch10Status::UARTF0_MSG_LENGTH &&
+        ctx_->RecordDiagnostic("uartf0_msg_length"))
+        SPDLOG_WARN("({:02d}) UART F0 message {:d} exceeds the packet, channel ID {:d}",
+            ctx_->thread_id, parsed_count_, ctx_->channel_id);
+
+    return status_;
+}
@@ -0,0 +1,79 @@
+#ifndef PARQUET_ANALOGF1_H
+#define PARQUET_ANALOGF1_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "sysexits.h"
+#include "parquet_context.h"
+#include "managed_path.h"
+#include "spdlog/spdlog.h"
+
+/*
+Write one row per analog sample. The samples of a packet are appended
+one subchannel at a time, such that consecutive rows share channel and
+subchannel. Analog packets carry only the time of the first sample frame,
+which is written to every row, and index gives the position of the
+sample frame in the packet from which the time of the sample may be
+computed given the sampling rate.
+*/
+class ParquetAnalogF1
+{
+   private:
+    ParquetContext* pq_ctx_;
+    int max_temp_element_count_;
+
+   public:
+    static const int ANALOGF1_ROW_GROUP_COUNT;
+    static const int ANALOGF1_BUFFER_SIZE_MULTIPLIER;
+    uint16_t thread_id_;
+    std::string outfile_;
+
+    // Arrays of data to be written to the Parquet table.
+    std::vector<int64_t> time_stamp_;
+    std::vector<uint8_t> doy_;
+    std::vector<int32_t> channel_id_;
+    std::vector<int16_t> subchannel_;
+    std::vector<int32_t> index_;
+    std::vector<int32_t> sample_;
+
+    // Static functions which return static const data
+    // remove the need to declare exports when building
+    // dynamic libraries in Windows.
+    static int GetRowGroupRowCount();
+    static int GetRowGroupBufferCount();
+
+    ParquetAnalogF1(ParquetContext* pq_ctx);
+
+    /*
+    Allocate buffers, define the schema and open the output file.
+
+    Args:
+        outfile     --> Output file path
+        thread_id   --> ID of the worker which owns the writer
+
+    Return:
+        EX_OK if no errors, otherwise a sysexits code.
+    */
+    int Initialize(const ManagedPath& outfile, uint16_t thread_id);
+
+    /*
+    Append the samples of one subchannel of a packet.
+
+    Args:
+        time_stamp  --> Absolute time of the first sample frame
+        doy         --> TDP day of year flag
+        chanid      --> Channel ID
+        subchan     --> Subchannel number
+        samples     --> First sample of the subchannel
+        frame_count --> Count of sample frames
+        stride      --> Count of samples from one frame to the next
+        decimation  --> Append every decimation-th frame, beginning with
+                        the first. Values less than one are treated as one.
+    */
+    void Append(const uint64_t& time_stamp, uint8_t doy, const uint32_t& chanid,
+        uint16_t subchan, const int32_t* samples, size_t frame_count, size_t stride,
+        uint32_t decimation);
+};
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef PARQUET_CANBUS_H
+#define PARQUET_CANBUS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "sysexits.h"
+#include "parquet_context.h"
+#include "managed_path.h"
+#include "ch10_canbus_msg_hdr_format.h"
+#include "spdlog/spdlog.h"
+
+/*
+Write one row per CAN bus message. Identifier, length and flags are
+stored in the narrowest columns which hold them and the data bytes
+are stored in a single int64 column, first data byte in the least
+significant byte, with unused bytes zero. The column holds the two's
+complement bit pattern of the 8 data bytes since unsigned columns are
+not written. Messages are appended a packet at a time, see Append.
+*/
+class ParquetCANBus
+{
+   private:
+    ParquetContext* pq_ctx_;
+    int max_temp_element_count_;
+
+   public:
+    static const int CANBUS_ROW_GROUP_COUNT;
+    static const int CANBUS_BUFFER_SIZE_MULTIPLIER;
+    uint16_t thread_id_;
+    std::string outfile_;
+
+    // Arrays of data to be written to the Parquet table.
+    std::vector<int64_t> time_stamp_;
+    std::vector<uint8_t> doy_;
+    std::vector<int32_t> channel_id_;
+    std::vector<int16_t> subchannel_;
+    std::vector<uint8_t> DE_;           // data error
+    std::vector<uint8_t> FE_;           // format error
+    std::vector<uint8_t> IDE_;          // extended identifier
+    std::vector<uint8_t> RTR_;          // remote transfer request
+    std::vector<int32_t> id_;
+    std::vector<int8_t> DLC_;           // count of data bytes
+    std::vector<int64_t> data_;
+
+    // Static functions which return static const data
+    // remove the need to declare exports when building
+    // dynamic libraries in Windows.
+    static int GetRowGroupRowCount();
+    static int GetRowGroupBufferCount();
+
+    ParquetCANBus(ParquetContext* pq_ctx);
+
+    /*
+    Allocate buffers, define the schema and open the output file.
+
+    Args:
+        outfile     --> Output file path
+        thread_id   --> ID of the worker which owns the writer
+
+    Return:
+        EX_OK if no errors, otherwise a sysexits code.
+    */
+    int Initialize(const ManagedPath& outfile, uint16_t thread_id);
+
+    /*
+    Append the messages of a packet. Rows are filled in runs which end
+    at the end of the buffers, such that each run is followed by a single
+    ParquetContext::IncrementAndWriteRows call.
+
+    Args:
+        time_stamp  --> Absolute time of each message
+        msg_hdr     --> Intra-packet message header of each message
+        id_word     --> ID word of each message
+        payload     --> Data bytes of each message, see class description
+        count       --> Count of messages
+        doy         --> TDP day of year flag
+        chanid      --> Channel ID
+    */
+    void Append(const uint64_t* time_stamp, const CANBusMsgHdrFmt* msg_hdr,
+        const CANBusIDWordFmt* id_word, const uint64_t* payload, size_t count,
+        uint8_t doy, const uint32_t& chanid);
+};
+
+#endif
@@ -18,17 +18,19 @@ class ParquetEthernetF0
    public:
     static const size_t DEFAULT_ROW_GROUP_COUNT;
     static const size_t DEFAULT_BUFFER_SIZE_MULTIPLIER;
+
+    // Max count of payload bytes of a frame. The payload column holds
+    // only the payload_size_ bytes of each frame.
     static const size_t PAYLOAD_LIST_COUNT;
     static const size_t MAX_TEMP_ELEMENT_COUNT;
     uint16_t thread_id_;
-    int16_t* payload_ptr_;
     std::string outfile_;
 
     // Arrays of data to be written to the Parquet table. See EthernetData for a
     // description of the columns.
     std::vector<int64_t> time_stamp_;   // save as int64
     std::vector<int32_t> channel_id_;   // save as int32
-    std::vector<int16_t> payload_;       // save as int16
+    ListColumnBuffer<int16_t> payload_;  // save as variable-length list of int16
     std::vector<int64_t> payload_size_;  // original type is uint32_t
     std::vector<std::string> dst_mac_addr_;
     std::vector<std::string> src_mac_addr_;
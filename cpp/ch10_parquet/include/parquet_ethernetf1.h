@@ -0,0 +1,86 @@
+#ifndef PARQUET_ETHERNETF1_H
+#define PARQUET_ETHERNETF1_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "sysexits.h"
+#include "parquet_context.h"
+#include "managed_path.h"
+#include "ch10_ethernetf1_msg_hdr_format.h"
+#include "spdlog/spdlog.h"
+
+/*
+Write one row per ARINC 664 message. Virtual link, addresses and ports
+are integer columns, such that row groups can be filtered by their
+statistics. IP addresses are stored as the bit pattern of the 32-bit
+address. The UDP payload is written to a variable-length list column
+which holds only the payload_sz bytes of each message.
+*/
+class ParquetEthernetF1
+{
+   private:
+    ParquetContext* pq_ctx_;
+    int max_temp_element_count_;
+
+   public:
+    static const int ETHERNETF1_ROW_GROUP_COUNT;
+    static const int ETHERNETF1_BUFFER_SIZE_MULTIPLIER;
+
+    // Max count of payload bytes of a message. Longer payloads are
+    // truncated.
+    static const int PAYLOAD_LIST_COUNT;
+    uint16_t thread_id_;
+    std::string outfile_;
+
+    // Arrays of data to be written to the Parquet table.
+    std::vector<int64_t> time_stamp_;
+    std::vector<uint8_t> doy_;
+    std::vector<int32_t> channel_id_;
+    std::vector<int32_t> virtual_link_;
+    std::vector<int32_t> src_ip_;
+    std::vector<int32_t> dst_ip_;
+    std::vector<int32_t> src_port_;
+    std::vector<int32_t> dst_port_;
+    std::vector<int16_t> error_;
+    std::vector<int16_t> flags_;
+    std::vector<int16_t> payload_size_;
+    ListColumnBuffer<int8_t> payload_;  // save as variable-length list of int8
+
+    // Static functions which return static const data
+    // remove the need to declare exports when building
+    // dynamic libraries in Windows.
+    static int GetRowGroupRowCount();
+    static int GetRowGroupBufferCount();
+    static int GetPayloadListElementCount();
+
+    ParquetEthernetF1(ParquetContext* pq_ctx);
+
+    /*
+    Allocate buffers, define the schema and open the output file.
+
+    Args:
+        outfile     --> Output file path
+        thread_id   --> ID of the worker which owns the writer
+
+    Return:
+        EX_OK if no errors, otherwise a sysexits code.
+    */
+    int Initialize(const ManagedPath& outfile, uint16_t thread_id);
+
+    /*
+    Append one message.
+
+    Args:
+        time_stamp  --> Absolute time of the message
+        doy         --> TDP day of year flag
+        chanid      --> Channel ID
+        ipdh        --> Intra-packet data header of the message
+        payload     --> UDP payload, ipdh.data_length bytes, of which
+                        at most PAYLOAD_LIST_COUNT are written
+    */
+    void Append(const uint64_t& time_stamp, uint8_t doy, const uint32_t& chanid,
+        const EthernetF1IPDHFmt& ipdh, const uint8_t* payload);
+};
+
+#endif
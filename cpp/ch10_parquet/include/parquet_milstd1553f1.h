@@ -24,6 +24,9 @@ class ParquetMilStd1553F1
       uint16_t thread_id_;
       static const int DEFAULT_ROW_GROUP_COUNT;
       static const int DEFAULT_BUFFER_SIZE_MULTIPLIER;
+
+      // Max count of payload words of a message. The data column holds
+      // only the words received, calcwrdcnt, for each message.
       static const int DATA_PAYLOAD_LIST_COUNT;
       std::string outfile_; 
 
@@ -41,7 +44,7 @@ class ParquetMilStd1553F1
       std::vector<int16_t> gap1_;         // save as int16
       std::vector<int16_t> gap2_;         // save as int16
       std::vector<uint8_t> mode_code_;    // save as single bit
-      std::vector<int32_t> data_;        // for all data payloads, save as int16
+      ListColumnBuffer<int32_t> data_;   // payload words received, variable-length list
       std::vector<int32_t> comm_word1_;
       std::vector<int32_t> comm_word2_;
       std::vector<int8_t> rtaddr1_;
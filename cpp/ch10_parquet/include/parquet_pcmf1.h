@@ -0,0 +1,98 @@
+#ifndef PARQUET_PCMF1_H
+#define PARQUET_PCMF1_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "sysexits.h"
+#include "parquet_context.h"
+#include "managed_path.h"
+#include "ch10_pcmf1_msg_hdr_format.h"
+#include "spdlog/spdlog.h"
+
+/*
+Write one row per PCM minor frame. The data words of the minor frame,
+which exclude the sync pattern, are written to a fixed-size list column.
+Row groups are sized by the count of data words rather than the count
+of minor frames such that the buffered memory is independent of the
+minor frame length.
+*/
+class ParquetPCMF1
+{
+   private:
+    ParquetContext* pq_ctx_;
+    int max_temp_element_count_;
+    int row_group_count_;
+    uint32_t words_per_minor_frame_;
+
+   public:
+    static const int PCMF1_ROW_GROUP_WORD_COUNT;
+    static const int PCMF1_MIN_ROW_GROUP_COUNT;
+    static const int PCMF1_BUFFER_SIZE_MULTIPLIER;
+    uint16_t thread_id_;
+    std::string outfile_;
+
+    // Arrays of data to be written to the Parquet table.
+    std::vector<int64_t> time_stamp_;
+    std::vector<uint8_t> doy_;
+    std::vector<int32_t> channel_id_;
+    std::vector<uint8_t> THR_;          // throughput mode
+    std::vector<int8_t> MJF_;           // major frame status
+    std::vector<int8_t> MNF_;           // minor frame status
+    std::vector<int8_t> lockst_;        // intra-packet data header lock status
+
+    // Data words, words_per_minor_frame_ per row. Words of 32 bits
+    // are stored as their two's complement bit pattern.
+    std::vector<int32_t> words_;
+
+    // Static functions which return static const data
+    // remove the need to declare exports when building
+    // dynamic libraries in Windows.
+    static int GetRowGroupBufferCount();
+
+    /*
+    Get the count of rows in a row group.
+
+    Args:
+        words_per_minor_frame   --> Count of data words in each row
+
+    Return:
+        PCMF1_ROW_GROUP_WORD_COUNT / words_per_minor_frame rows, and
+        not fewer than PCMF1_MIN_ROW_GROUP_COUNT.
+    */
+    static int GetRowGroupRowCount(uint32_t words_per_minor_frame);
+
+    ParquetPCMF1(ParquetContext* pq_ctx);
+
+    /*
+    Allocate buffers, define the schema and open the output file.
+
+    Args:
+        outfile                 --> Output file path
+        thread_id               --> ID of the worker which owns the writer
+        words_per_minor_frame   --> Count of data words per minor frame,
+                                    which must be greater than zero
+
+    Return:
+        EX_OK if no errors, otherwise a sysexits code.
+    */
+    int Initialize(const ManagedPath& outfile, uint16_t thread_id,
+        uint32_t words_per_minor_frame);
+
+    /*
+    Append one minor frame.
+
+    Args:
+        time_stamp  --> Absolute time of the minor frame
+        doy         --> TDP day of year flag
+        chanid      --> Channel ID
+        csdw        --> Channel specific data word of the packet
+        lockst      --> Lock status from the intra-packet data header,
+                        zero if not present
+        words       --> Data words, words_per_minor_frame of them
+    */
+    void Append(const uint64_t& time_stamp, uint8_t doy, const uint32_t& chanid,
+        const PCMF1CSDWFmt* csdw, uint8_t lockst, const uint32_t* words);
+};
+
+#endif
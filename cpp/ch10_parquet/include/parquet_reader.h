@@ -7,12 +7,18 @@
 #include <parquet/arrow/reader.h>
 #include <parquet/arrow/schema.h>
 #include <parquet/arrow/writer.h>
+#include <parquet/metadata.h>
+#include <parquet/statistics.h>
 #include <string>
 #include <vector>
+#include <map>
+#include <set>
 #include <memory>
 #include <algorithm>
+#include <future>
 #include "spdlog/spdlog.h"
 #include "managed_path.h"
+#include "parquet_row_group.h"
 
 class ParquetReader
 {
@@ -35,8 +41,50 @@ class ParquetReader
     bool data_found_;
     std::shared_ptr<arrow::Schema> schema_;
 
+    // Sorted schema column indices read by GetNextRGColumns,
+    // all columns if empty.
+    std::vector<int> projected_cols_;
+
+    // If enabled, GetNextRGColumns reads the following row group of
+    // the current file in a background thread, which is used by the
+    // next call if it requests that row group.
+    bool prefetch_enabled_;
+    int prefetch_row_group_;
+    std::future<arrow::Status> prefetch_future_;
+    std::shared_ptr<arrow::Table> prefetch_table_;
+
+    // Row group filters, schema column index to the set of values of
+    // interest, see SetRowGroupFilter.
+    std::map<int, std::set<int64_t>> rg_filters_;
+
+    // For each row group of the current file, false if column chunk
+    // statistics show that no row satisfies the filters.
+    std::vector<bool> rg_may_match_;
+
     bool OpenNextParquetFile();
 
+    // Evaluate the filters against the statistics of each row group
+    // of the current file and fill rg_may_match_.
+    void EvaluateRowGroupFilters();
+
+    /*
+		Read columns of a row group of the current file
+		in a single read and combine chunks such that
+		each column has a single chunk. All columns are
+		read if cols is empty. Does not modify member
+		state other than the reader, so it can be called
+		from the prefetch thread.
+	*/
+    arrow::Status ReadRowGroupColumns(int row_group, const std::vector<int>& cols,
+                                      std::shared_ptr<arrow::Table>& table);
+
+    // Begin reading a row group of the current file in the background
+    void StartPrefetch(int row_group);
+
+    // Wait for a background read to complete and discard the result.
+    // Must be called prior to any other use of the reader.
+    void CancelPrefetch();
+
    public:
 
     const int& current_row_group;
@@ -48,10 +96,13 @@ class ParquetReader
         current_file_ = 0;
         data_found_ = false;
         schema_ = arrow::schema(initial_fields_);
+        prefetch_enabled_ = false;
+        prefetch_row_group_ = -1;
     };
 
     ~ParquetReader()
     {
+        CancelPrefetch();
         if (arrow_file_ != nullptr)
         {
             if (!arrow_file_->closed())
@@ -96,6 +147,92 @@ class ParquetReader
                          int& size,
                          bool list = false);
 
+    /*
+		Gets the next row group with all columns in
+		a single read. Chunks are combined such that
+		each column of the output table has a single
+		chunk. Row group increment behavior is the
+		same as GetNextRG.
+
+		Returns: False -> If it is the end of file or
+						  the read fails
+				 True  -> If the row group was read successfully
+	*/
+    bool GetNextRGTable(std::shared_ptr<arrow::Table>& table);
+
+    /*
+		Gets the next row group with the columns selected
+		by SetColumnProjection, or all columns if none are
+		selected, in a single read. Data are accessed via
+		the ParquetRowGroup, without copying if the types
+		match. Row group increment behavior is the same as
+		GetNextRG.
+
+		If prefetch is enabled, the following row group of
+		the current file is read in the background while
+		the caller processes the returned row group.
+
+		Returns: False -> If it is the end of file or
+						  the read fails
+				 True  -> If the row group was read successfully
+	*/
+    bool GetNextRGColumns(ParquetRowGroup& row_group);
+
+    /*
+		Select the columns read by GetNextRGColumns.
+		The selection is cleared by SetPQPath.
+
+		Returns: False -> If a column name does not exist,
+						  in which case the selection is
+						  not changed
+				 True  -> Otherwise
+	*/
+    bool SetColumnProjection(const std::vector<std::string>& col_names);
+
+    /*
+		Enable or disable reading the next row group in
+		the background in GetNextRGColumns.
+	*/
+    void SetPrefetch(bool enable);
+
+    /*
+		Filter row groups by column chunk statistics.
+		A row group may match the filters if, for each
+		filtered column, at least one of the values is
+		within the min and max of the column chunk, or
+		the chunk has no min and max. Filters are only
+		evaluated from file metadata, so data pages of
+		row groups which can't match are never read.
+		Only integer columns may be filtered. Filters
+		are cleared by SetPQPath.
+
+		Returns: False -> If the column name does not exist
+						  or is not an integer column
+				 True  -> Otherwise
+	*/
+    bool SetRowGroupFilter(const std::string& col_name, const std::set<int64_t>& values);
+    void ClearRowGroupFilters();
+
+    /*
+		Returns: False -> If statistics show that no row of
+						  the row group in the current file
+						  satisfies the filters
+				 True  -> Otherwise, including if the row
+						  group does not exist
+	*/
+    bool RowGroupMayMatch(int row_group) const;
+
+    /*
+		Check if a set of values intersects the min and
+		max of column chunk statistics.
+
+		Returns: False -> If statistics have a min and max
+						  and no value is within them
+				 True  -> Otherwise
+	*/
+    static bool StatisticsMayMatch(const std::shared_ptr<parquet::Statistics>& stats,
+                                   const std::set<int64_t>& values);
+
     /*
 		GetColumnNumberFromName get the column number
 		from a column name
@@ -189,6 +326,8 @@ bool ParquetReader::GetNextRG(int col,
 
     //printf("\rExtracting row group %03d\n", (current_row_group_ + 1));
 
+    CancelPrefetch();
+
     // Read row group from first file
     std::shared_ptr<arrow::Table> arrow_table;
     st_ = arrow_reader_->ReadRowGroup(current_row_group_,
@@ -0,0 +1,213 @@
+
+#ifndef PARQUET_ROW_GROUP_H_
+#define PARQUET_ROW_GROUP_H_
+
+#include <arrow/api.h>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+/*
+ParquetRowGroup holds a set of columns of a single row group which were
+read by ParquetReader::GetNextRGColumns in a single read. Chunks are
+combined such that each column is a single contiguous array.
+
+Primitive column data can be accessed in place via GetValues, which
+returns a pointer into the Arrow buffer, or copied with type conversion
+via CopyValues. Pointers returned by GetValues are valid until the
+object is reset or destroyed.
+*/
+class ParquetRowGroup
+{
+   private:
+    std::shared_ptr<arrow::Table> table_;
+
+    // Schema column index of each column of table_
+    std::vector<int> columns_;
+
+   public:
+    ParquetRowGroup() : table_(nullptr), columns_() {}
+
+    /*
+    Set the table read from the row group.
+
+    Args:
+        table       --> Table with a single chunk per column
+        columns     --> Schema column index of each column in table
+    */
+    void Set(std::shared_ptr<arrow::Table> table, const std::vector<int>& columns);
+
+    // Release the table and Arrow buffers
+    void Reset();
+
+    // Count of rows in the row group, zero if not set
+    int64_t GetRowCount() const;
+
+    /*
+    Get the array for a column.
+
+    Args:
+        col     --> Schema column index, as returned by
+                    ParquetReader::GetColumnNumberFromName
+        list    --> True if the column is a list type column,
+                    in which case the flattened values array
+                    is returned
+
+    Return:
+        Array, or nullptr if the column was not read
+    */
+    std::shared_ptr<arrow::Array> GetArray(int col, bool list) const;
+
+    /*
+    Get a pointer to column data in the Arrow buffer without copying.
+    Only possible if none of the values are null, since the buffer value
+    at a null position is not defined.
+
+    Args:
+        col     --> Schema column index
+        data    --> Output, pointer to the first value
+        count   --> Output, count of values. Count of rows for a
+                    non-list column or count of all list elements
+                    for a list column.
+        list    --> True if the column is a list type column
+
+    Return:
+        True if the column was read, has the Arrow type A and has no
+        null values; false otherwise.
+    */
+    template <typename A>
+    bool GetValues(int col, const typename A::TypeClass::c_type*& data,
+                   int64_t& count, bool list = false) const;
+
+    /*
+    Copy column data into a vector with conversion to type T. Null
+    values are set to zero. The vector is resized if it is smaller
+    than the count of values.
+
+    Args:
+        col     --> Schema column index
+        data    --> Output vector
+        size    --> Output, count of values copied
+        list    --> True if the column is a list type column
+
+    Return:
+        True if the column was read and has the Arrow type A; false
+        otherwise.
+    */
+    template <typename T, typename A>
+    bool CopyValues(int col, std::vector<T>& data, int& size, bool list = false) const;
+
+    /*
+    Copy the values of a list column into a vector with a fixed count of
+    elements per row and conversion to type T. Elements of row i are
+    placed at i * elements_per_row. Rows with fewer elements, which
+    includes null rows, are zero-filled and rows with more elements are
+    truncated, such that variable-length and fixed-size list columns are
+    read in the same layout. The vector is resized if it is smaller than
+    the count of rows times elements_per_row.
+
+    Args:
+        col                 --> Schema column index
+        data                --> Output vector
+        row_count           --> Output, count of rows copied
+        elements_per_row    --> Count of elements per row of data
+
+    Return:
+        True if the column was read, is a list column and has values of
+        the Arrow type A; false otherwise.
+    */
+    template <typename T, typename A>
+    bool CopyListValues(int col, std::vector<T>& data, int& row_count,
+                        size_t elements_per_row) const;
+};
+
+template <typename A>
+bool ParquetRowGroup::GetValues(int col, const typename A::TypeClass::c_type*& data,
+                                int64_t& count, bool list) const
+{
+    data = nullptr;
+    count = 0;
+    std::shared_ptr<arrow::Array> arr = GetArray(col, list);
+    if (arr == nullptr || arr->type_id() != A::TypeClass::type_id)
+        return false;
+
+    if (arr->null_count() > 0)
+        return false;
+
+    const A* typed_arr = static_cast<const A*>(arr.get());
+    data = typed_arr->raw_values();
+    count = typed_arr->length();
+    return true;
+}
+
+template <typename T, typename A>
+bool ParquetRowGroup::CopyValues(int col, std::vector<T>& data, int& size, bool list) const
+{
+    size = 0;
+    std::shared_ptr<arrow::Array> arr = GetArray(col, list);
+    if (arr == nullptr || arr->type_id() != A::TypeClass::type_id)
+        return false;
+
+    const A* typed_arr = static_cast<const A*>(arr.get());
+    size = static_cast<int>(typed_arr->length());
+    if (data.size() < static_cast<size_t>(size))
+        data.resize(size);
+
+    if (typed_arr->null_count() > 0)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            // See ParquetReader::GetNextRG regarding nulls
+            if (typed_arr->IsNull(i))
+                data[i] = 0;
+            else
+                data[i] = static_cast<T>(typed_arr->Value(i));
+        }
+    }
+    else
+    {
+        for (int i = 0; i < size; i++)
+            data[i] = static_cast<T>(typed_arr->Value(i));
+    }
+    return true;
+}
+
+template <typename T, typename A>
+bool ParquetRowGroup::CopyListValues(int col, std::vector<T>& data, int& row_count,
+                                     size_t elements_per_row) const
+{
+    row_count = 0;
+    std::shared_ptr<arrow::Array> arr = GetArray(col, false);
+    if (arr == nullptr || arr->type_id() != arrow::Type::LIST)
+        return false;
+
+    const arrow::ListArray* list_arr = static_cast<const arrow::ListArray*>(arr.get());
+    if (list_arr->values()->type_id() != A::TypeClass::type_id)
+        return false;
+
+    const A* values = static_cast<const A*>(list_arr->values().get());
+    row_count = static_cast<int>(list_arr->length());
+    size_t size = row_count * elements_per_row;
+    if (data.size() < size)
+        data.resize(size);
+    std::fill(data.begin(), data.begin() + size, 0);
+
+    for (int i = 0; i < row_count; i++)
+    {
+        if (list_arr->IsNull(i))
+            continue;
+
+        int64_t offset = list_arr->value_offset(i);
+        int64_t count = std::min<int64_t>(list_arr->value_length(i), elements_per_row);
+        T* row = data.data() + i * elements_per_row;
+        for (int64_t j = 0; j < count; j++)
+        {
+            if (!values->IsNull(offset + j))
+                row[j] = static_cast<T>(values->Value(offset + j));
+        }
+    }
+    return true;
+}
+
+#endif  // PARQUET_ROW_GROUP_H_
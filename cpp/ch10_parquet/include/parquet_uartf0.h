@@ -0,0 +1,75 @@
+#ifndef PARQUET_UARTF0_H
+#define PARQUET_UARTF0_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "sysexits.h"
+#include "parquet_context.h"
+#include "managed_path.h"
+#include "ch10_uartf0_msg_hdr_format.h"
+#include "spdlog/spdlog.h"
+
+/*
+Write one row per UART message. The data of each message are written
+to a variable-length binary column, such that only the bytes received
+are stored, see BinaryColumnBuffer.
+*/
+class ParquetUARTF0
+{
+   private:
+    ParquetContext* pq_ctx_;
+    int max_temp_element_count_;
+
+   public:
+    static const int UARTF0_ROW_GROUP_COUNT;
+    static const int UARTF0_BUFFER_SIZE_MULTIPLIER;
+
+    // Initial size of the data buffer per row, in bytes
+    static const int DATA_BYTES_PER_ROW;
+    uint16_t thread_id_;
+    std::string outfile_;
+
+    // Arrays of data to be written to the Parquet table.
+    std::vector<int64_t> time_stamp_;
+    std::vector<uint8_t> doy_;
+    std::vector<int32_t> channel_id_;
+    std::vector<int16_t> subchannel_;
+    std::vector<uint8_t> parity_error_;
+    BinaryColumnBuffer data_;
+
+    // Static functions which return static const data
+    // remove the need to declare exports when building
+    // dynamic libraries in Windows.
+    static int GetRowGroupRowCount();
+    static int GetRowGroupBufferCount();
+
+    ParquetUARTF0(ParquetContext* pq_ctx);
+
+    /*
+    Allocate buffers, define the schema and open the output file.
+
+    Args:
+        outfile     --> Output file path
+        thread_id   --> ID of the worker which owns the writer
+
+    Return:
+        EX_OK if no errors, otherwise a sysexits code.
+    */
+    int Initialize(const ManagedPath& outfile, uint16_t thread_id);
+
+    /*
+    Append one message.
+
+    Args:
+        time_stamp  --> Absolute time of the message
+        doy         --> TDP day of year flag
+        chanid      --> Channel ID
+        hdr         --> Intra-packet data header of the message
+        data        --> Data of the message, hdr.data_length bytes
+    */
+    void Append(const uint64_t& time_stamp, uint8_t doy, const uint32_t& chanid,
+        const UARTF0DataHeaderFmt& hdr, const uint8_t* data);
+};
+
+#endif
@@ -0,0 +1,109 @@
+#include "parquet_analogf1.h"
+#include <algorithm>
+
+const int ParquetAnalogF1::ANALOGF1_ROW_GROUP_COUNT = 100000;
+const int ParquetAnalogF1::ANALOGF1_BUFFER_SIZE_MULTIPLIER = 10;
+
+int ParquetAnalogF1::GetRowGroupRowCount()
+{
+    return ANALOGF1_ROW_GROUP_COUNT;
+}
+
+int ParquetAnalogF1::GetRowGroupBufferCount()
+{
+    return ANALOGF1_BUFFER_SIZE_MULTIPLIER;
+}
+
+ParquetAnalogF1::ParquetAnalogF1(ParquetContext* pq_ctx) : pq_ctx_(pq_ctx),
+    max_temp_element_count_(0), thread_id_(UINT16_MAX), outfile_("")
+{
+}
+
+int ParquetAnalogF1::Initialize(const ManagedPath& outfile, uint16_t thread_id)
+{
+    thread_id_ = thread_id;
+    outfile_ = outfile.string();
+    max_temp_element_count_ = ANALOGF1_ROW_GROUP_COUNT * ANALOGF1_BUFFER_SIZE_MULTIPLIER;
+
+    // Allocate vector memory.
+    time_stamp_.resize(max_temp_element_count_);
+    doy_.resize(max_temp_element_count_);
+    channel_id_.resize(max_temp_element_count_);
+    subchannel_.resize(max_temp_element_count_);
+    index_.resize(max_temp_element_count_);
+    sample_.resize(max_temp_element_count_);
+
+    // Add fields to table.
+    pq_ctx_->AddField(arrow::int64(), "time");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::boolean(), "doy");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "channelid");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int16(), "subchannel");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "index");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "sample");  // GCOVR_EXCL_LINE
+
+    // Set memory locations.
+    pq_ctx_->SetMemoryLocation(time_stamp_, "time");
+    pq_ctx_->SetMemoryLocation(doy_, "doy");
+    pq_ctx_->SetMemoryLocation(channel_id_, "channelid");
+    pq_ctx_->SetMemoryLocation(subchannel_, "subchannel");
+    pq_ctx_->SetMemoryLocation(index_, "index");
+    pq_ctx_->SetMemoryLocation(sample_, "sample");
+
+    if (!pq_ctx_->OpenForWrite(outfile_, true))
+    {
+        SPDLOG_ERROR("({:03d}) OpenForWrite failed for file {:s}", thread_id_,
+                     outfile_);
+        return EX_IOERR;
+    }
+
+    // Setup automatic tracking of appended data.
+    if (!pq_ctx_->SetupRowCountTracking(ANALOGF1_ROW_GROUP_COUNT,
+                               ANALOGF1_BUFFER_SIZE_MULTIPLIER, true, "AnalogF1"))
+    {
+        SPDLOG_ERROR("({:03d}) SetupRowCountTracking not configured correctly",
+                     thread_id_);
+        return EX_SOFTWARE;
+    }
+
+    pq_ctx_->EnableEmptyFileDeletion(outfile_);
+    return EX_OK;
+}
+
+void ParquetAnalogF1::Append(const uint64_t& time_stamp, uint8_t doy, const uint32_t& chanid,
+    uint16_t subchan, const int32_t* samples, size_t frame_count, size_t stride,
+    uint32_t decimation)
+{
+    if (max_temp_element_count_ == 0)
+        return;
+
+    size_t step = decimation > 1 ? decimation : 1;
+    size_t count = (frame_count + step - 1) / step;
+    size_t frame_step = step * stride;
+
+    size_t begin = 0;
+    size_t run = 0;
+    size_t row = 0;
+    int64_t time64 = static_cast<int64_t>(time_stamp);
+    int32_t chanid32 = static_cast<int32_t>(chanid);
+    int16_t subchan16 = static_cast<int16_t>(subchan);
+    while (begin < count)
+    {
+        // Fill rows up to the end of the buffers.
+        row = pq_ctx_->append_count_;
+        run = std::min<size_t>(count - begin, max_temp_element_count_ - row);
+        std::fill_n(time_stamp_.begin() + row, run, time64);
+        std::fill_n(doy_.begin() + row, run, doy);
+        std::fill_n(channel_id_.begin() + row, run, chanid32);
+        std::fill_n(subchannel_.begin() + row, run, subchan16);
+        const int32_t* src = samples + begin * frame_step;
+        for (size_t i = 0; i < run; i++, row++, src += frame_step)
+        {
+            index_[row] = static_cast<int32_t>((begin + i) * step);
+            sample_[row] = *src;
+        }
+
+        // Increment the count variable and write data if row group(s) are filled.
+        pq_ctx_->IncrementAndWriteRows(run, thread_id_);
+        begin += run;
+    }
+}
@@ -0,0 +1,124 @@
+#include "parquet_canbus.h"
+#include <algorithm>
+
+const int ParquetCANBus::CANBUS_ROW_GROUP_COUNT = 50000;
+const int ParquetCANBus::CANBUS_BUFFER_SIZE_MULTIPLIER = 10;
+
+int ParquetCANBus::GetRowGroupRowCount()
+{
+    return CANBUS_ROW_GROUP_COUNT;
+}
+
+int ParquetCANBus::GetRowGroupBufferCount()
+{
+    return CANBUS_BUFFER_SIZE_MULTIPLIER;
+}
+
+ParquetCANBus::ParquetCANBus(ParquetContext* pq_ctx) : pq_ctx_(pq_ctx),
+    max_temp_element_count_(0), thread_id_(UINT16_MAX), outfile_("")
+{
+}
+
+int ParquetCANBus::Initialize(const ManagedPath& outfile, uint16_t thread_id)
+{
+    thread_id_ = thread_id;
+    outfile_ = outfile.string();
+    max_temp_element_count_ = CANBUS_ROW_GROUP_COUNT * CANBUS_BUFFER_SIZE_MULTIPLIER;
+
+    // Allocate vector memory.
+    time_stamp_.resize(max_temp_element_count_);
+    doy_.resize(max_temp_element_count_);
+    channel_id_.resize(max_temp_element_count_);
+    subchannel_.resize(max_temp_element_count_);
+    DE_.resize(max_temp_element_count_);
+    FE_.resize(max_temp_element_count_);
+    IDE_.resize(max_temp_element_count_);
+    RTR_.resize(max_temp_element_count_);
+    id_.resize(max_temp_element_count_);
+    DLC_.resize(max_temp_element_count_);
+    data_.resize(max_temp_element_count_);
+
+    // Add fields to table.
+    pq_ctx_->AddField(arrow::int64(), "time");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::boolean(), "doy");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "channelid");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int16(), "subchannel");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::boolean(), "DE");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::boolean(), "FE");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::boolean(), "IDE");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::boolean(), "RTR");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "id");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int8(), "DLC");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int64(), "data");  // GCOVR_EXCL_LINE
+
+    // Set memory locations.
+    pq_ctx_->SetMemoryLocation(time_stamp_, "time");
+    pq_ctx_->SetMemoryLocation(doy_, "doy");
+    pq_ctx_->SetMemoryLocation(channel_id_, "channelid");
+    pq_ctx_->SetMemoryLocation(subchannel_, "subchannel");
+    pq_ctx_->SetMemoryLocation(DE_, "DE");
+    pq_ctx_->SetMemoryLocation(FE_, "FE");
+    pq_ctx_->SetMemoryLocation(IDE_, "IDE");
+    pq_ctx_->SetMemoryLocation(RTR_, "RTR");
+    pq_ctx_->SetMemoryLocation(id_, "id");
+    pq_ctx_->SetMemoryLocation(DLC_, "DLC");
+    pq_ctx_->SetMemoryLocation(data_, "data");
+
+    if (!pq_ctx_->OpenForWrite(outfile_, true))
+    {
+        SPDLOG_ERROR("({:03d}) OpenForWrite failed for file {:s}", thread_id_,
+                     outfile_);
+        return EX_IOERR;
+    }
+
+    // Setup automatic tracking of appended data.
+    if (!pq_ctx_->SetupRowCountTracking(CANBUS_ROW_GROUP_COUNT,
+                               CANBUS_BUFFER_SIZE_MULTIPLIER, true, "CANBus"))
+    {
+        SPDLOG_ERROR("({:03d}) SetupRowCountTracking not configured correctly",
+                     thread_id_);
+        return EX_SOFTWARE;
+    }
+
+    pq_ctx_->EnableEmptyFileDeletion(outfile_);
+    return EX_OK;
+}
+
+void ParquetCANBus::Append(const uint64_t* time_stamp, const CANBusMsgHdrFmt* msg_hdr,
+    const CANBusIDWordFmt* id_word, const uint64_t* payload, size_t count,
+    uint8_t doy, const uint32_t& chanid)
+{
+    if (max_temp_element_count_ == 0)
+        return;
+
+    size_t begin = 0;
+    size_t run = 0;
+    size_t row = 0;
+    int32_t chanid32 = static_cast<int32_t>(chanid);
+    while (begin < count)
+    {
+        // Fill rows up to the end of the buffers.
+        row = pq_ctx_->append_count_;
+        run = std::min<size_t>(count - begin, max_temp_element_count_ - row);
+        for (size_t i = 0; i < run; i++, row++)
+        {
+            const CANBusMsgHdrFmt& hdr = msg_hdr[begin + i];
+            const CANBusIDWordFmt& id = id_word[begin + i];
+            time_stamp_[row] = static_cast<int64_t>(time_stamp[begin + i]);
+            doy_[row] = doy;
+            channel_id_[row] = chanid32;
+            subchannel_[row] = static_cast<int16_t>(hdr.subchan);
+            DE_[row] = hdr.DE;
+            FE_[row] = hdr.FE;
+            IDE_[row] = id.IDE;
+            RTR_[row] = id.RTR;
+            id_[row] = static_cast<int32_t>(id.ID);
+            DLC_[row] = static_cast<int8_t>(hdr.length - sizeof(CANBusIDWordFmt));
+            data_[row] = static_cast<int64_t>(payload[begin + i]);
+        }
+
+        // Increment the count variable and write data if row group(s) are filled.
+        pq_ctx_->IncrementAndWriteRows(run, thread_id_);
+        begin += run;
+    }
+}
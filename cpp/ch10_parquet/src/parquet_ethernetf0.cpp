@@ -9,7 +9,7 @@ const size_t ParquetEthernetF0::MAX_TEMP_ELEMENT_COUNT =
 
 ParquetEthernetF0::ParquetEthernetF0(ParquetContext* pq_ctx) : pq_ctx_(pq_ctx),
                                          thread_id_(UINT16_MAX),
-                                         payload_ptr_(nullptr), outfile_("")
+                                         outfile_("")
 {
 }
 
@@ -36,8 +36,9 @@ int ParquetEthernetF0::Initialize(const ManagedPath& outfile, uint16_t thread_id
     // Allocate vector memory.
     time_stamp_.resize(MAX_TEMP_ELEMENT_COUNT);
     channel_id_.resize(MAX_TEMP_ELEMENT_COUNT);
-    payload_.resize(MAX_TEMP_ELEMENT_COUNT * PAYLOAD_LIST_COUNT, 0);
-    payload_ptr_ = payload_.data();
+    // Most frames are much shorter than the max payload size. The values
+    // buffer grows if a buffer of rows exceeds the initial size.
+    payload_.Allocate(MAX_TEMP_ELEMENT_COUNT, MAX_TEMP_ELEMENT_COUNT * (PAYLOAD_LIST_COUNT / 8));
     payload_size_.resize(MAX_TEMP_ELEMENT_COUNT);
     dst_mac_addr_.resize(MAX_TEMP_ELEMENT_COUNT);
     src_mac_addr_.resize(MAX_TEMP_ELEMENT_COUNT);
@@ -58,7 +59,7 @@ int ParquetEthernetF0::Initialize(const ManagedPath& outfile, uint16_t thread_id
     // Add fields to table.
     pq_ctx_->AddField(arrow::int64(), "time");  // GCOVR_EXCL_LINE
     pq_ctx_->AddField(arrow::int32(), "channelid");  // GCOVR_EXCL_LINE
-    pq_ctx_->AddField(arrow::int16(), "payload", PAYLOAD_LIST_COUNT);  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int16(), "payload", ParquetContext::VARIABLE_LIST_SIZE);  // GCOVR_EXCL_LINE
     pq_ctx_->AddField(arrow::int64(), "payload_sz");  // GCOVR_EXCL_LINE
     pq_ctx_->AddField(arrow::utf8(), "dstmac");  // GCOVR_EXCL_LINE
     pq_ctx_->AddField(arrow::utf8(), "srcmac");  // GCOVR_EXCL_LINE
@@ -141,13 +142,8 @@ void ParquetEthernetF0::Append(const uint64_t& time_stamp, const uint32_t& chani
     src_port_[pq_ctx_->append_count_] = static_cast<int32_t>(eth_data->src_port_);
 
     // Copy payload
-    std::copy(eth_data->payload_ptr_, eth_data->payload_ptr_ + eth_data->payload_size_,
-              payload_ptr_ + pq_ctx_->append_count_ * PAYLOAD_LIST_COUNT);
+    payload_.Set(pq_ctx_->append_count_, eth_data->payload_ptr_, eth_data->payload_size_);
 
     // Increment the count variable and write data if row group(s) are filled.
-    if (pq_ctx_->IncrementAndWrite(thread_id_))
-    {
-        // Reset list buffers.
-        std::fill(payload_.begin(), payload_.end(), 0);
-    }
+    pq_ctx_->IncrementAndWrite(thread_id_);
 }
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "parquet_ethernetf1.h"
+#include <algorithm>
+
+const int ParquetEthernetF1::ETHERNETF1_ROW_GROUP_COUNT = 2000;
+const int ParquetEthernetF1::ETHERNETF1_BUFFER_SIZE_MULTIPLIER = 10;
+const int ParquetEthernetF1::PAYLOAD_LIST_COUNT = 1471;
+
+int ParquetEthernetF1::GetRowGroupRowCount()
+{
+    return ETHERNETF1_ROW_GROUP_COUNT;
+}
+
+int ParquetEthernetF1::GetRowGroupBufferCount()
+{
+    return ETHERNETF1_BUFFER_SIZE_MULTIPLIER;
+}
+
+int ParquetEthernetF1::GetPayloadListElementCount()
+{
+    return PAYLOAD_LIST_COUNT;
+}
+
+ParquetEthernetF1::ParquetEthernetF1(ParquetContext* pq_ctx) : pq_ctx_(pq_ctx),
+    max_temp_element_count_(0), thread_id_(UINT16_MAX), outfile_("")
+{
+}
+
+int ParquetEthernetF1::Initialize(const ManagedPath& outfile, uint16_t thread_id)
+{
+    thread_id_ = thread_id;
+    outfile_ = outfile.string();
+    max_temp_element_count_ = ETHERNETF1_ROW_GROUP_COUNT * ETHERNETF1_BUFFER_SIZE_MULTIPLIER;
+
+    // Allocate vector memory.
+    time_stamp_.resize(max_temp_element_count_);
+    doy_.resize(max_temp_element_count_);
+    channel_id_.resize(max_temp_element_count_);
+    virtual_link_.resize(max_temp_element_count_);
+    src_ip_.resize(max_temp_element_count_);
+    dst_ip_.resize(max_temp_element_count_);
+    src_port_.resize(max_temp_element_count_);
+    dst_port_.resize(max_temp_element_count_);
+    error_.resize(max_temp_element_count_);
+    flags_.resize(max_temp_element_count_);
+    payload_size_.resize(max_temp_element_count_);
+
+    // Most payloads are much shorter than the max payload size. The values
+    // buffer grows if a buffer of rows exceeds the initial size.
+    payload_.Allocate(max_temp_element_count_, max_temp_element_count_ * (PAYLOAD_LIST_COUNT / 8));
+
+    // Add fields to table.
+    pq_ctx_->AddField(arrow::int64(), "time");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::boolean(), "doy");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "channelid");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "vl");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "srcip");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "dstip");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "srcport");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "dstport");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int16(), "error");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int16(), "flags");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int16(), "payload_sz");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int8(), "payload", ParquetContext::VARIABLE_LIST_SIZE);  // GCOVR_EXCL_LINE
+
+    // Set memory locations.
+    pq_ctx_->SetMemoryLocation(time_stamp_, "time");
+    pq_ctx_->SetMemoryLocation(doy_, "doy");
+    pq_ctx_->SetMemoryLocation(channel_id_, "channelid");
+    pq_ctx_->SetMemoryLocation(virtual_link_, "vl");
+    pq_ctx_->SetMemoryLocation(src_ip_, "srcip");
+    pq_ctx_->SetMemoryLocation(dst_ip_, "dstip");
+    pq_ctx_->SetMemoryLocation(src_port_, "srcport");
+    pq_ctx_->SetMemoryLocation(dst_port_, "dstport");
+    pq_ctx_->SetMemoryLocation(error_, "error");
+    pq_ctx_->SetMemoryLocation(flags_, "flags");
+    pq_ctx_->SetMemoryLocation(payload_size_, "payload_sz");
+    pq_ctx_->SetMemoryLocation(payload_, "payload");
+
+    if (!pq_ctx_->OpenForWrite(outfile_, true))
+    {
+        SPDLOG_ERROR("({:03d}) OpenForWrite failed for file {:s}", thread_id_,
+                     outfile_);
+        return EX_IOERR;
+    }
+
+    // Setup automatic tracking of appended data.
+    if (!pq_ctx_->SetupRowCountTracking(ETHERNETF1_ROW_GROUP_COUNT,
+                               ETHERNETF1_BUFFER_SIZE_MULTIPLIER, true, "EthernetF1"))
+    {
+        SPDLOG_ERROR("({:03d}) SetupRowCountTracking not configured correctly",
+                     thread_id_);
+        return EX_SOFTWARE;
+    }
+
+    pq_ctx_->EnableEmptyFileDeletion(outfile_);
+    return EX_OK;
+}
+
+void ParquetEthernetF1::Append(const uint64_t& time_stamp, uint8_t doy, const uint32_t& chanid,
+    const EthernetF1IPDHFmt& ipdh, const uint8_t* payload)
+{
+    if (max_temp_element_count_ == 0)
+        return;
+
+    size_t row = pq_ctx_->append_count_;
+    time_stamp_[row] = static_cast<int64_t>(time_stamp);
+    doy_[row] = doy;
+    channel_id_[row] = static_cast<int32_t>(chanid);
+    virtual_link_[row] = static_cast<int32_t>(ipdh.virtual_link);
+    src_ip_[row] = static_cast<int32_t>(ipdh.src_ip);
+    dst_ip_[row] = static_cast<int32_t>(ipdh.dst_ip);
+    src_port_[row] = static_cast<int32_t>(ipdh.src_port);
+    dst_port_[row] = static_cast<int32_t>(ipdh.dst_port);
+    error_[row] = static_cast<int16_t>(ipdh.error);
+    flags_[row] = static_cast<int16_t>(ipdh.flags);
+
+    // Copy payload
+    size_t size = std::min<size_t>(ipdh.data_length, PAYLOAD_LIST_COUNT);
+    payload_size_[row] = static_cast<int16_t>(size);
+    payload_.Set(row, payload, size);
+
+    // Increment the count variable and write data if row group(s) are filled.
+    pq_ctx_->IncrementAndWrite(thread_id_);
+}
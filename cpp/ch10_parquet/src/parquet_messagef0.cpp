@@ -0,0 +1,87 @@
+#include "parquet_messagef0.h"
+
+const int ParquetMessageF0::MESSAGEF0_ROW_GROUP_COUNT = 10000;
+const int ParquetMessageF0::MESSAGEF0_BUFFER_SIZE_MULTIPLIER = 10;
+const int ParquetMessageF0::DATA_BYTES_PER_ROW = 64;
+
+int ParquetMessageF0::GetRowGroupRowCount()
+{
+    return MESSAGEF0_ROW_GROUP_COUNT;
+}
+
+int ParquetMessageF0::GetRowGroupBufferCount()
+{
+    return MESSAGEF0_BUFFER_SIZE_MULTIPLIER;
+}
+
+ParquetMessageF0::ParquetMessageF0(ParquetContext* pq_ctx) : pq_ctx_(pq_ctx),
+    max_temp_element_count_(0), thread_id_(UINT16_MAX), outfile_("")
+{
+}
+
+int ParquetMessageF0::Initialize(const ManagedPath& outfile, uint16_t thread_id)
+{
+    thread_id_ = thread_id;
+    outfile_ = outfile.string();
+    max_temp_element_count_ = MESSAGEF0_ROW_GROUP_COUNT * MESSAGEF0_BUFFER_SIZE_MULTIPLIER;
+
+    // Allocate vector memory.
+    time_stamp_.resize(max_temp_element_count_);
+    doy_.resize(max_temp_element_count_);
+    channel_id_.resize(max_temp_element_count_);
+    subchannel_.resize(max_temp_element_count_);
+    pkt_type_.resize(max_temp_element_count_);
+    format_error_.resize(max_temp_element_count_);
+    data_error_.resize(max_temp_element_count_);
+    data_.Allocate(max_temp_element_count_,
+                   static_cast<size_t>(max_temp_element_count_) * DATA_BYTES_PER_ROW);
+
+    // Add fields to table and set memory locations.
+    pq_ctx_->AddColumn<arrow::Int64Type>(time_stamp_, "time");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddColumn<arrow::BooleanType>(doy_, "doy");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddColumn<arrow::Int32Type>(channel_id_, "channelid");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddColumn<arrow::Int16Type>(subchannel_, "subchannel");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddColumn<arrow::Int8Type>(pkt_type_, "pkttype");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddColumn<arrow::BooleanType>(format_error_, "FE");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddColumn<arrow::BooleanType>(data_error_, "DE");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddColumn<arrow::BinaryType>(data_, "data");  // GCOVR_EXCL_LINE
+
+    if (!pq_ctx_->OpenForWrite(outfile_, true))
+    {
+        SPDLOG_ERROR("({:03d}) OpenForWrite failed for file {:s}", thread_id_,
+                     outfile_);
+        return EX_IOERR;
+    }
+
+    // Setup automatic tracking of appended data.
+    if (!pq_ctx_->SetupRowCountTracking(MESSAGEF0_ROW_GROUP_COUNT,
+                               MESSAGEF0_BUFFER_SIZE_MULTIPLIER, true, "MessageF0"))
+    {
+        SPDLOG_ERROR("({:03d}) SetupRowCountTracking not configured correctly",
+                     thread_id_);
+        return EX_SOFTWARE;
+    }
+
+    pq_ctx_->EnableEmptyFileDeletion(outfile_);
+    return EX_OK;
+}
+
+void ParquetMessageF0::Append(const uint64_t& time_stamp, uint8_t doy, const uint32_t& chanid,
+    uint8_t pkt_type, const MessageF0DataHeaderFmt& hdr, const uint8_t* data)
+{
+    if (max_temp_element_count_ == 0)
+        return;
+
+    size_t row = pq_ctx_->append_count_;
+    time_stamp_[row] = static_cast<int64_t>(time_stamp);
+    doy_[row] = doy;
+    channel_id_[row] = static_cast<int32_t>(chanid);
+    subchannel_[row] = static_cast<int16_t>(hdr.subchannel);
+    pkt_type_[row] = static_cast<int8_t>(pkt_type);
+    format_error_[row] = hdr.FE;
+    data_error_[row] = hdr.DE;
+    data_.Set(row, data, hdr.length);
+
+    // Increment the count variable and write data if row group(s) are filled.
+    pq_ctx_->IncrementAndWrite(thread_id_);
+}
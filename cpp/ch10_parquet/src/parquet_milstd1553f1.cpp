@@ -47,7 +47,10 @@ int ParquetMilStd1553F1::Initialize(const ManagedPath& outfile, uint16_t thread_
     gap1_.resize(max_temp_element_count_);
     gap2_.resize(max_temp_element_count_);
     mode_code_.resize(max_temp_element_count_);
-    data_.resize(max_temp_element_count_ * DATA_PAYLOAD_LIST_COUNT, 0);
+    // Most messages carry fewer than the max count of payload words. The
+    // values buffer grows if a buffer of rows exceeds the initial size.
+    data_.Allocate(max_temp_element_count_,
+                   max_temp_element_count_ * (DATA_PAYLOAD_LIST_COUNT / 2));
     comm_word1_.resize(max_temp_element_count_);
     comm_word2_.resize(max_temp_element_count_);
     rtaddr1_.resize(max_temp_element_count_);
@@ -101,7 +104,7 @@ int ParquetMilStd1553F1::Initialize(const ManagedPath& outfile, uint16_t thread_
     pq_ctx_->AddField(arrow::int16(), "gap1");  // GCOVR_EXCL_LINE
     pq_ctx_->AddField(arrow::int16(), "gap2");  // GCOVR_EXCL_LINE
     pq_ctx_->AddField(arrow::boolean(), "mode");  // GCOVR_EXCL_LINE
-    pq_ctx_->AddField(arrow::int32(), "data", DATA_PAYLOAD_LIST_COUNT);  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "data", ParquetContext::VARIABLE_LIST_SIZE);  // GCOVR_EXCL_LINE
     pq_ctx_->AddField(arrow::int32(), "txcommwrd");  // GCOVR_EXCL_LINE
     pq_ctx_->AddField(arrow::int32(), "rxcommwrd");  // GCOVR_EXCL_LINE
     pq_ctx_->AddField(arrow::int8(), "txrtaddr");  // GCOVR_EXCL_LINE
@@ -296,12 +299,8 @@ void ParquetMilStd1553F1::Append(const uint64_t& time_stamp, uint8_t doy,
     payload_incomplete_[pq_ctx_->append_count_] = payload_incomplete;
 
     // If the calculated word count is less than or equal to zero,
-    // do not copy any data. The payload for the current row shall
-    // remain all zeros.
-    if (calcwrdcnt > 0)
-    {
-        std::copy(data, data + calcwrdcnt, data_.data() + pq_ctx_->append_count_ * DATA_PAYLOAD_LIST_COUNT);
-    }
+    // do not copy any data. The payload for the current row is empty.
+    data_.Set(pq_ctx_->append_count_, data, calcwrdcnt > 0 ? calcwrdcnt : 0);
 
     // Check for mode code.
     if (msg->sub_addr1 > 0 && msg->sub_addr1 < 31)
@@ -370,9 +369,5 @@ void ParquetMilStd1553F1::Append(const uint64_t& time_stamp, uint8_t doy,
 
 
     // Increment the count variable and write data if row group(s) are filled.
-    if (pq_ctx_->IncrementAndWrite(thread_id_))
-    {
-        // Reset list buffers.
-        std::fill(data_.begin(), data_.end(), 0);
-    }
+    pq_ctx_->IncrementAndWrite(thread_id_);
 }
@@ -0,0 +1,110 @@
+#include "parquet_pcmf1.h"
+
+const int ParquetPCMF1::PCMF1_ROW_GROUP_WORD_COUNT = 1000000;
+const int ParquetPCMF1::PCMF1_MIN_ROW_GROUP_COUNT = 100;
+const int ParquetPCMF1::PCMF1_BUFFER_SIZE_MULTIPLIER = 10;
+
+int ParquetPCMF1::GetRowGroupBufferCount()
+{
+    return PCMF1_BUFFER_SIZE_MULTIPLIER;
+}
+
+int ParquetPCMF1::GetRowGroupRowCount(uint32_t words_per_minor_frame)
+{
+    if (words_per_minor_frame == 0)
+        return PCMF1_MIN_ROW_GROUP_COUNT;
+    int count = PCMF1_ROW_GROUP_WORD_COUNT / static_cast<int>(words_per_minor_frame);
+    return count < PCMF1_MIN_ROW_GROUP_COUNT ? PCMF1_MIN_ROW_GROUP_COUNT : count;
+}
+
+ParquetPCMF1::ParquetPCMF1(ParquetContext* pq_ctx) : pq_ctx_(pq_ctx),
+    max_temp_element_count_(0), row_group_count_(0), words_per_minor_frame_(0),
+    thread_id_(UINT16_MAX), outfile_("")
+{
+}
+
+int ParquetPCMF1::Initialize(const ManagedPath& outfile, uint16_t thread_id,
+    uint32_t words_per_minor_frame)
+{
+    thread_id_ = thread_id;
+    outfile_ = outfile.string();
+    if (words_per_minor_frame == 0)
+    {
+        SPDLOG_ERROR("({:03d}) PCM minor frame word count is not configured", thread_id_);
+        return EX_CONFIG;
+    }
+    words_per_minor_frame_ = words_per_minor_frame;
+    row_group_count_ = GetRowGroupRowCount(words_per_minor_frame_);
+    max_temp_element_count_ = row_group_count_ * PCMF1_BUFFER_SIZE_MULTIPLIER;
+
+    // Allocate vector memory.
+    time_stamp_.resize(max_temp_element_count_);
+    doy_.resize(max_temp_element_count_);
+    channel_id_.resize(max_temp_element_count_);
+    THR_.resize(max_temp_element_count_);
+    MJF_.resize(max_temp_element_count_);
+    MNF_.resize(max_temp_element_count_);
+    lockst_.resize(max_temp_element_count_);
+    words_.resize(static_cast<size_t>(max_temp_element_count_) * words_per_minor_frame_);
+
+    // Add fields to table.
+    pq_ctx_->AddField(arrow::int64(), "time");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::boolean(), "doy");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "channelid");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::boolean(), "THR");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int8(), "MJF");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int8(), "MNF");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int8(), "lockst");  // GCOVR_EXCL_LINE
+    pq_ctx_->AddField(arrow::int32(), "words", words_per_minor_frame_);  // GCOVR_EXCL_LINE
+
+    // Set memory locations.
+    pq_ctx_->SetMemoryLocation(time_stamp_, "time");
+    pq_ctx_->SetMemoryLocation(doy_, "doy");
+    pq_ctx_->SetMemoryLocation(channel_id_, "channelid");
+    pq_ctx_->SetMemoryLocation(THR_, "THR");
+    pq_ctx_->SetMemoryLocation(MJF_, "MJF");
+    pq_ctx_->SetMemoryLocation(MNF_, "MNF");
+    pq_ctx_->SetMemoryLocation(lockst_, "lockst");
+    pq_ctx_->SetMemoryLocation(words_, "words");
+
+    if (!pq_ctx_->OpenForWrite(outfile_, true))
+    {
+        SPDLOG_ERROR("({:03d}) OpenForWrite failed for file {:s}", thread_id_,
+                     outfile_);
+        return EX_IOERR;
+    }
+
+    // Setup automatic tracking of appended data.
+    if (!pq_ctx_->SetupRowCountTracking(row_group_count_,
+                               PCMF1_BUFFER_SIZE_MULTIPLIER, true, "PCMF1"))
+    {
+        SPDLOG_ERROR("({:03d}) SetupRowCountTracking not configured correctly",
+                     thread_id_);
+        return EX_SOFTWARE;
+    }
+
+    pq_ctx_->EnableEmptyFileDeletion(outfile_);
+    return EX_OK;
+}
+
+void ParquetPCMF1::Append(const uint64_t& time_stamp, uint8_t doy, const uint32_t& chanid,
+        const PCMF1CSDWFmt* csdw, uint8_t lockst, const uint32_t* words)
+{
+    time_stamp_[pq_ctx_->append_count_] = static_cast<int64_t>(time_stamp);
+    doy_[pq_ctx_->append_count_] = doy;
+    channel_id_[pq_ctx_->append_count_] = static_cast<int32_t>(chanid);
+    THR_[pq_ctx_->append_count_] = csdw->THR;
+    MJF_[pq_ctx_->append_count_] = static_cast<int8_t>(csdw->MJF);
+    MNF_[pq_ctx_->append_count_] = static_cast<int8_t>(csdw->MNF);
+    lockst_[pq_ctx_->append_count_] = static_cast<int8_t>(lockst);
+
+    int32_t* dest = words_.data() + static_cast<size_t>(pq_ctx_->append_count_) *
+        words_per_minor_frame_;
+    for (uint32_t i = 0; i < words_per_minor_frame_; i++)
+        dest[i] = static_cast<int32_t>(words[i]);
+
+    // Increment the count variable and write data if row group(s) are filled.
+    if (pq_ctx_->IncrementAndWrite(thread_id_))
+    {
+    }
+}
@@ -2,6 +2,8 @@
 
 bool ParquetReader::OpenNextParquetFile()
 {
+    CancelPrefetch();
+
     if (arrow_file_ != nullptr)
     {
         if (!arrow_file_->closed())
@@ -58,6 +60,7 @@ bool ParquetReader::OpenNextParquetFile()
     // Total count of row groups.
     row_group_count_ = arrow_reader_->num_row_groups();
     //printf("%02d row groups\n", row_group_count_);
+    EvaluateRowGroupFilters();
 
     current_file_++;
     return true;
@@ -65,6 +68,10 @@ bool ParquetReader::OpenNextParquetFile()
 
 bool ParquetReader::SetPQPath(ManagedPath base_path)
 {
+    CancelPrefetch();
+    projected_cols_.clear();
+    rg_filters_.clear();
+    rg_may_match_.clear();
     current_row_group_ = 0;
     current_file_ = 0;
     row_group_count_ = 0;
@@ -305,6 +312,8 @@ bool ParquetReader::GetNextRGBool(int col, std::vector<uint8_t>& data,
 
     //printf("\rExtracting row group %03d\n", (current_row_group_ + 1));
 
+    CancelPrefetch();
+
     // Read row group from first file
     std::shared_ptr<arrow::Table> arrow_table;
     st_ = arrow_reader_->ReadRowGroup(current_row_group_,
@@ -403,6 +412,8 @@ bool ParquetReader::GetNextRGString(int col, std::vector<std::string>& data,
 
     //printf("\rExtracting row group %03d\n", (current_row_group_ + 1));
 
+    CancelPrefetch();
+
     // Read row group from first file
     std::shared_ptr<arrow::Table> arrow_table;
     st_ = arrow_reader_->ReadRowGroup(current_row_group_,
@@ -470,6 +481,268 @@ bool ParquetReader::GetNextRGString(int col, std::vector<std::string>& data,
     return true;
 }
 
+bool ParquetReader::GetNextRGTable(std::shared_ptr<arrow::Table>& table)
+{
+    if (current_row_group_ >= row_group_count_)
+    {
+        if (!OpenNextParquetFile())
+            return false;
+    }
+
+    CancelPrefetch();
+    st_ = ReadRowGroupColumns(current_row_group_, std::vector<int>(), table);
+    if (!st_.ok())
+    {
+        printf("ParquetReader::ReadRowGroupColumns error (ID %s): %s\n",
+               st_.CodeAsString().c_str(), st_.message().c_str());
+        return false;
+    }
+
+    if (!manual_rowgroup_increment_mode_)
+        current_row_group_++;
+    return true;
+}
+
+bool ParquetReader::GetNextRGColumns(ParquetRowGroup& row_group)
+{
+    row_group.Reset();
+
+    if (current_row_group_ >= row_group_count_)
+    {
+        if (!OpenNextParquetFile())
+            return false;
+    }
+
+    // Use the prefetched row group if it is the requested row group,
+    // otherwise discard it and read the requested row group.
+    std::shared_ptr<arrow::Table> table;
+    if (prefetch_future_.valid() && prefetch_row_group_ == current_row_group_)
+    {
+        st_ = prefetch_future_.get();
+        table = prefetch_table_;
+        prefetch_table_.reset();
+        prefetch_row_group_ = -1;
+    }
+    else
+    {
+        CancelPrefetch();
+        st_ = ReadRowGroupColumns(current_row_group_, projected_cols_, table);
+    }
+
+    if (!st_.ok())
+    {
+        printf("ParquetReader::ReadRowGroupColumns error (ID %s): %s\n",
+               st_.CodeAsString().c_str(), st_.message().c_str());
+        return false;
+    }
+
+    std::vector<int> cols = projected_cols_;
+    if (cols.empty())
+    {
+        cols.resize(schema_->num_fields());
+        for (int i = 0; i < static_cast<int>(cols.size()); i++)
+            cols[i] = i;
+    }
+
+    if (table->num_columns() != static_cast<int>(cols.size()))
+    {
+        printf("ParquetReader::GetNextRGColumns: read %d columns, expected %zu\n",
+               table->num_columns(), cols.size());
+        return false;
+    }
+    row_group.Set(table, cols);
+
+    // Prefetch the next row group which is not excluded by the filters,
+    // which is expected to be the next requested row group.
+    if (prefetch_enabled_)
+    {
+        int next_row_group = current_row_group_ + 1;
+        while (next_row_group < row_group_count_ && !RowGroupMayMatch(next_row_group))
+            next_row_group++;
+        if (next_row_group < row_group_count_)
+            StartPrefetch(next_row_group);
+    }
+
+    if (!manual_rowgroup_increment_mode_)
+        current_row_group_++;
+    return true;
+}
+
+bool ParquetReader::SetColumnProjection(const std::vector<std::string>& col_names)
+{
+    std::vector<int> cols;
+    int col = 0;
+    for (std::vector<std::string>::const_iterator it = col_names.cbegin();
+         it != col_names.cend(); ++it)
+    {
+        if ((col = GetColumnNumberFromName(*it)) < 0)
+        {
+            SPDLOG_WARN("Column name {:s} not present in schema", *it);
+            return false;
+        }
+        cols.push_back(col);
+    }
+
+    // Read columns in schema order regardless of the order of names.
+    std::sort(cols.begin(), cols.end());
+    cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+
+    CancelPrefetch();
+    projected_cols_ = cols;
+    return true;
+}
+
+void ParquetReader::SetPrefetch(bool enable)
+{
+    if (!enable)
+        CancelPrefetch();
+    prefetch_enabled_ = enable;
+}
+
+bool ParquetReader::SetRowGroupFilter(const std::string& col_name,
+                                      const std::set<int64_t>& values)
+{
+    int col = GetColumnNumberFromName(col_name);
+    if (col < 0)
+    {
+        SPDLOG_WARN("Column name {:s} not present in schema", col_name);
+        return false;
+    }
+
+    if (!arrow::is_integer(schema_->field(col)->type()->id()))
+    {
+        SPDLOG_WARN("Row group filter column {:s} is not an integer column", col_name);
+        return false;
+    }
+
+    CancelPrefetch();
+    rg_filters_[col] = values;
+    EvaluateRowGroupFilters();
+    return true;
+}
+
+void ParquetReader::ClearRowGroupFilters()
+{
+    CancelPrefetch();
+    rg_filters_.clear();
+    EvaluateRowGroupFilters();
+}
+
+bool ParquetReader::RowGroupMayMatch(int row_group) const
+{
+    if (row_group < 0 || row_group >= static_cast<int>(rg_may_match_.size()))
+        return true;
+    return rg_may_match_[row_group];
+}
+
+bool ParquetReader::StatisticsMayMatch(const std::shared_ptr<parquet::Statistics>& stats,
+                                       const std::set<int64_t>& values)
+{
+    if (stats == nullptr || !stats->HasMinMax())
+        return true;
+
+    int64_t min = 0;
+    int64_t max = 0;
+    switch (stats->physical_type())
+    {
+        case parquet::Type::INT32:
+        {
+            std::shared_ptr<parquet::Int32Statistics> int32_stats =
+                std::static_pointer_cast<parquet::Int32Statistics>(stats);
+            min = int32_stats->min();
+            max = int32_stats->max();
+            break;
+        }
+        case parquet::Type::INT64:
+        {
+            std::shared_ptr<parquet::Int64Statistics> int64_stats =
+                std::static_pointer_cast<parquet::Int64Statistics>(stats);
+            min = int64_stats->min();
+            max = int64_stats->max();
+            break;
+        }
+        default:
+            return true;
+    }
+
+    std::set<int64_t>::const_iterator it = values.lower_bound(min);
+    return (it != values.cend() && *it <= max);
+}
+
+void ParquetReader::EvaluateRowGroupFilters()
+{
+    rg_may_match_.clear();
+    if (rg_filters_.empty() || arrow_reader_ == nullptr)
+        return;
+
+    std::shared_ptr<parquet::FileMetaData> metadata = arrow_reader_->parquet_reader()->metadata();
+    rg_may_match_.resize(row_group_count_, true);
+    for (int rg = 0; rg < row_group_count_; rg++)
+    {
+        std::unique_ptr<parquet::RowGroupMetaData> rg_metadata = metadata->RowGroup(rg);
+        for (std::map<int, std::set<int64_t>>::const_iterator it = rg_filters_.cbegin();
+             it != rg_filters_.cend(); ++it)
+        {
+            if (it->first >= rg_metadata->num_columns())
+                continue;
+
+            std::unique_ptr<parquet::ColumnChunkMetaData> col_metadata =
+                rg_metadata->ColumnChunk(it->first);
+            if (!col_metadata->is_stats_set())
+                continue;
+
+            if (!StatisticsMayMatch(col_metadata->statistics(), it->second))
+            {
+                rg_may_match_[rg] = false;
+                break;
+            }
+        }
+    }
+}
+
+arrow::Status ParquetReader::ReadRowGroupColumns(int row_group, const std::vector<int>& cols,
+                                                 std::shared_ptr<arrow::Table>& table)
+{
+    std::shared_ptr<arrow::Table> arrow_table;
+    arrow::Status st;
+    if (cols.empty())
+        st = arrow_reader_->ReadRowGroup(row_group, &arrow_table);
+    else
+        st = arrow_reader_->ReadRowGroup(row_group, cols, &arrow_table);
+    if (!st.ok())
+        return st;
+
+#ifdef NEWARROW
+    arrow::Result<std::shared_ptr<arrow::Table>> combined =
+        arrow_table->CombineChunks(pool_);
+    if (!combined.ok())
+        return combined.status();
+    table = combined.ValueOrDie();
+    return arrow::Status::OK();
+#else
+    return arrow_table->CombineChunks(pool_, &table);
+#endif
+}
+
+void ParquetReader::StartPrefetch(int row_group)
+{
+    CancelPrefetch();
+    prefetch_row_group_ = row_group;
+    std::vector<int> cols = projected_cols_;
+    prefetch_future_ = std::async(std::launch::async, [this, row_group, cols]()
+    {
+        return ReadRowGroupColumns(row_group, cols, prefetch_table_);
+    });
+}
+
+void ParquetReader::CancelPrefetch()
+{
+    if (prefetch_future_.valid())
+        prefetch_future_.get();
+    prefetch_table_.reset();
+    prefetch_row_group_ = -1;
+}
+
 int ParquetReader::GetColumnNumberFromName(std::string col_name)
 {
     return schema_->GetFieldIndex(col_name);
@@ -0,0 +1,49 @@
+#include "parquet_row_group.h"
+
+void ParquetRowGroup::Set(std::shared_ptr<arrow::Table> table, const std::vector<int>& columns)
+{
+    table_ = table;
+    columns_ = columns;
+}
+
+void ParquetRowGroup::Reset()
+{
+    table_.reset();
+    columns_.clear();
+}
+
+int64_t ParquetRowGroup::GetRowCount() const
+{
+    if (table_ == nullptr)
+        return 0;
+    return table_->num_rows();
+}
+
+std::shared_ptr<arrow::Array> ParquetRowGroup::GetArray(int col, bool list) const
+{
+    if (table_ == nullptr)
+        return nullptr;
+
+    std::vector<int>::const_iterator it = std::find(columns_.cbegin(), columns_.cend(), col);
+    if (it == columns_.cend())
+        return nullptr;
+    int table_col = static_cast<int>(it - columns_.cbegin());
+
+#ifdef NEWARROW
+    if (table_->column(table_col)->num_chunks() != 1)
+        return nullptr;
+    std::shared_ptr<arrow::Array> arr = table_->column(table_col)->chunk(0);
+#else
+    if (table_->column(table_col)->data()->num_chunks() != 1)
+        return nullptr;
+    std::shared_ptr<arrow::Array> arr = table_->column(table_col)->data()->chunk(0);
+#endif
+
+    if (list)
+    {
+        if (arr->type_id() != arrow::Type::LIST)
+            return nullptr;
+        return std::static_pointer_cast<arrow::ListArray>(arr)->values();
+    }
+    return arr;
+}
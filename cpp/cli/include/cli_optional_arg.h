@@ -250,11 +250,18 @@ bool CLIOptionalArg<std::vector<ArgDataType>>::Parse(const std::string& input)
     std::string input_str = input;
     std::string fail_msg("Optional argument " + GetPrintName());
     std::string arg_raw_value = "";
+    bool matched = false;
     while(input_str.size() > 0)
     {
         // printf("input_str: %s\n", input_str.c_str());
         if(!ValidateUser(input_str))
         {
+            // Remaining input, such as other options following the last
+            // occurrence, does not contain this arg. Keep the values
+            // already parsed from earlier occurrences.
+            if(matched)
+                break;
+
             // printf("Input \"%s\" contains character(s) which are not valid for "
             //     "optional argument %s\n", input.c_str(), GetUsageRepr().c_str());
             ComputeDefaultSpecialConfig();
@@ -262,6 +269,7 @@ bool CLIOptionalArg<std::vector<ArgDataType>>::Parse(const std::string& input)
             return true;
         }
         arg_present_ = true; 
+        matched = true;
 
         arg_raw_value = GetSMatch()[2].str();
         // printf("Got match: %s\n", arg_raw_value.c_str());
@@ -353,11 +361,18 @@ bool CLIOptionalArg<std::map<ArgDataType, ArgDataType2>>::Parse(const std::strin
     std::string input_str = input;
     std::string fail_msg("Optional argument " + GetPrintName());
     std::string arg_raw_value = "";
+    bool matched = false;
     while(input_str.size() > 0)
     {
         // printf("input_str: %s\n", input_str.c_str());
         if(!ValidateUser(input_str))
         {
+            // Remaining input, such as other options following the last
+            // occurrence, does not contain this arg. Keep the values
+            // already parsed from earlier occurrences.
+            if(matched)
+                break;
+
             // printf("Input \"%s\" contains character(s) which are not valid for "
             //     "optional argument %s\n", input.c_str(), GetUsageRepr().c_str());
             ComputeDefaultSpecialConfig();
@@ -365,6 +380,7 @@ bool CLIOptionalArg<std::map<ArgDataType, ArgDataType2>>::Parse(const std::strin
             return true;
         }
         arg_present_ = true; 
+        matched = true;
 
         arg_raw_value = GetSMatch()[2].str();
         // printf("Got match: %s\n", arg_raw_value.c_str());
@@ -0,0 +1,41 @@
+#ifndef CH10_1553F2_MSG_HDR_FORMAT_H_
+#define CH10_1553F2_MSG_HDR_FORMAT_H_
+
+#include <cstdint>
+
+class MilStd1553F2CSDWFmt
+{
+   public:
+    uint32_t count;  // count of messages in packet
+};
+
+// Intra-packet data header which follows the intra-packet time stamp
+// of each 16PP194 transaction. The transaction words follow.
+class MilStd1553F2DataHeaderFmt
+{
+   public:
+    uint32_t length : 16;  // total bytes in the transaction words
+    uint32_t : 10;
+    uint32_t EE : 1;       // command echo error
+    uint32_t SE : 1;       // status error
+    uint32_t TM : 1;       // response time out
+    uint32_t : 1;
+    uint32_t RE : 1;       // RIU reset
+    uint32_t TE : 1;       // transaction error
+};
+
+// 16PP194 word. A transaction is a series of words in the order
+// command, response, command echo, no-go, no-go echo and status.
+class MilStd1553F2WordFmt
+{
+   public:
+    uint32_t data : 16;     // 16-bit word as transmitted on the bus
+    uint32_t riu_sub_addr : 4;
+    uint32_t riu_addr : 4;
+    uint32_t PE : 1;        // parity error
+    uint32_t WE : 1;        // Manchester word error
+    uint32_t : 3;
+    uint32_t bus_id : 3;
+};
+
+#endif
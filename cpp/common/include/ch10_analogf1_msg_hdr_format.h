@@ -0,0 +1,24 @@
+#ifndef CH10_ANALOGF1_MSG_HDR_FORMAT_H_
+#define CH10_ANALOGF1_MSG_HDR_FORMAT_H_
+
+#include <cstdint>
+
+// Channel specific data word. If same is zero, the packet begins with
+// one CSDW per subchannel, otherwise the single CSDW applies to all
+// subchannels.
+class AnalogF1CSDWFmt
+{
+   public:
+    // 0 = packed, 1 = unpacked with padding in the least significant
+    // bits, 2 = reserved, 3 = unpacked with padding in the most
+    // significant bits. Unpacked samples are aligned to 16-bit words.
+    uint32_t mode : 2;
+    uint32_t length : 6;    // count of bits in each sample, 0 = 64
+    uint32_t subchan : 8;   // subchannel number
+    uint32_t totchan : 8;   // count of subchannels in packet, 0 = 256
+    uint32_t factor : 4;    // subchannel sampling rate is 2^-factor of the base rate
+    uint32_t same : 1;      // CSDW applies to all subchannels
+    uint32_t : 3;
+};
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef CH10_CANBUS_MSG_HDR_FORMAT_H_
+#define CH10_CANBUS_MSG_HDR_FORMAT_H_
+
+#include <cstdint>
+
+class CANBusCSDWFmt
+{
+   public:
+    uint32_t count : 24;    // count of CAN messages in packet
+    uint32_t : 8;
+};
+
+// Intra-packet message header which follows the intra-packet time
+// stamp of each message.
+class CANBusMsgHdrFmt
+{
+   public:
+    uint32_t length : 4;    // count of bytes in message, including the ID word
+    uint32_t : 12;
+    uint32_t subchan : 14;  // subchannel number
+    uint32_t FE : 1;        // format error
+    uint32_t DE : 1;        // data error
+};
+
+// First word of each message, followed by zero to eight data bytes
+// and fill to a 16-bit boundary.
+class CANBusIDWordFmt
+{
+   public:
+    uint32_t ID : 29;       // 11-bit standard or 29-bit extended identifier
+    uint32_t : 1;
+    uint32_t RTR : 1;       // remote transfer request
+    uint32_t IDE : 1;       // identifier extension, 1 = extended identifier
+};
+
+#endif
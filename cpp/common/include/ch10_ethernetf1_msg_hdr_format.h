@@ -0,0 +1,32 @@
+#ifndef CH10_ETHERNETF1_MSG_HDR_FORMAT_H_
+#define CH10_ETHERNETF1_MSG_HDR_FORMAT_H_
+
+#include <cstdint>
+
+class EthernetF1CSDW
+{
+   public:
+    uint32_t msg_count : 16;    // count of messages in packet
+
+    // Count of bytes in the intra-packet header of each message,
+    // including the intra-packet time stamp
+    uint32_t iph_length : 16;
+};
+
+// Intra-packet data header which follows the intra-packet time stamp
+// of each ARINC 664 message. The UDP payload of the message follows.
+class EthernetF1IPDHFmt
+{
+   public:
+    uint32_t data_length : 16;  // count of bytes in the UDP payload
+    uint32_t error : 8;         // error bits, 0 = no error
+    uint32_t flags : 8;
+    uint32_t virtual_link : 16; // ARINC 664 virtual link ID
+    uint32_t : 16;
+    uint32_t src_ip;            // source IP address
+    uint32_t dst_ip;            // destination IP address
+    uint32_t src_port : 16;     // UDP source port
+    uint32_t dst_port : 16;     // UDP destination port
+};
+
+#endif
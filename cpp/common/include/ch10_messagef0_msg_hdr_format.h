@@ -0,0 +1,29 @@
+#ifndef CH10_MESSAGEF0_MSG_HDR_FORMAT_H_
+#define CH10_MESSAGEF0_MSG_HDR_FORMAT_H_
+
+#include <cstdint>
+
+class MessageF0CSDWFmt
+{
+   public:
+    uint32_t count : 16;        // count of messages in packet
+
+    // Packet type: 0 = complete messages, 1 = first segment of a
+    // message, 2 = middle segment, 3 = last segment
+    uint32_t pkt_type : 2;
+    uint32_t : 14;
+};
+
+// Intra-packet data header of each message, which follows the
+// intra-packet time stamp. The data follow, padded to an even count
+// of bytes.
+class MessageF0DataHeaderFmt
+{
+   public:
+    uint32_t length : 16;       // count of bytes of data, not including padding
+    uint32_t subchannel : 14;   // subchannel ID
+    uint32_t FE : 1;            // format error
+    uint32_t DE : 1;            // data error
+};
+
+#endif
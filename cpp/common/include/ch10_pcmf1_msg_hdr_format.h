@@ -0,0 +1,69 @@
+#ifndef CH10_PCMF1_MSG_HDR_FORMAT_H_
+#define CH10_PCMF1_MSG_HDR_FORMAT_H_
+
+#include <cstdint>
+
+class PCMF1CSDWFmt
+{
+   public:
+    uint32_t sync_offset : 18;  // word offset into major frame of first data word,
+                                // unpacked mode only
+    uint32_t UM : 1;            // unpacked mode
+    uint32_t PM : 1;            // packed mode
+    uint32_t THR : 1;           // throughput mode
+    uint32_t AL : 1;            // alignment, 0 = 16-bit, 1 = 32-bit
+    uint32_t : 2;
+    uint32_t MJF : 2;           // major frame status
+    uint32_t MNF : 2;           // minor frame status
+    uint32_t MI : 1;            // minor frame indicator
+    uint32_t MA : 1;            // major frame indicator
+    uint32_t IPH : 1;           // intra-packet headers present
+    uint32_t : 1;
+};
+
+// Intra-packet data header which follows the intra-packet time stamp
+// of each minor frame in packed and unpacked modes. The header is
+// 16 bits in 16-bit alignment mode and 32 bits in 32-bit alignment
+// mode, in which case the upper 16 bits are reserved.
+class PCMF1IPDHFmt
+{
+   public:
+    uint16_t : 12;
+    uint16_t lockst : 4;        // minor frame lock status
+};
+
+/*
+Geometry of the minor frames in a PCM stream, which is not given by
+the PCM packets. A minor frame begins with the sync pattern and is
+followed by words_per_minor_frame data words of word_bits bits each.
+*/
+class PCMF1FrameFormat
+{
+   public:
+    uint32_t words_per_minor_frame;
+    uint32_t word_bits;
+    uint32_t sync_bits;
+    uint64_t sync_pattern;
+
+    PCMF1FrameFormat() : words_per_minor_frame(0), word_bits(16), sync_bits(32),
+        sync_pattern(0) {}
+
+    // Frames can't be decommutated until the data words are defined.
+    bool IsConfigured() const { return words_per_minor_frame > 0; }
+
+    // Count of bits in a minor frame, including the sync pattern
+    uint64_t MinorFrameBits() const
+    {
+        return static_cast<uint64_t>(sync_bits) +
+            static_cast<uint64_t>(words_per_minor_frame) * word_bits;
+    }
+
+    bool operator==(const PCMF1FrameFormat& rhs) const
+    {
+        return ((words_per_minor_frame == rhs.words_per_minor_frame) &&
+            (word_bits == rhs.word_bits) && (sync_bits == rhs.sync_bits) &&
+            (sync_pattern == rhs.sync_pattern));
+    }
+};
+
+#endif
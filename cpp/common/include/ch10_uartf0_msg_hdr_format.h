@@ -0,0 +1,25 @@
+#ifndef CH10_UARTF0_MSG_HDR_FORMAT_H_
+#define CH10_UARTF0_MSG_HDR_FORMAT_H_
+
+#include <cstdint>
+
+class UARTF0CSDWFmt
+{
+   public:
+    uint32_t : 31;
+    uint32_t IPH : 1;   // 1 = each message is preceded by an intra-packet time stamp
+};
+
+// Intra-packet data header of each UART message, which follows the
+// intra-packet time stamp if present. The data follow, padded to an
+// even count of bytes.
+class UARTF0DataHeaderFmt
+{
+   public:
+    uint32_t data_length : 16;  // count of bytes of data, not including padding
+    uint32_t subchannel : 14;   // subchannel ID
+    uint32_t : 1;
+    uint32_t PE : 1;            // parity error
+};
+
+#endif
@@ -130,6 +130,43 @@ class DTS1553
 	*/
     bool FillSupplBusNameToMsgKeyMap(const YAML::Node& suppl_busmap_comm_words_node,
                                      std::map<std::string, std::set<uint64_t>>& output_suppl_busname_to_msg_key_map);
+
+    /*
+
+		WriteCache
+
+		writer:						Binary cache writer to which the result of
+									IngestLines is written.
+
+		msg_name_substitutions:		Message name substitutions output by
+									IngestLines.
+
+		elem_name_substitutions:	Element name substitutions output by
+									IngestLines.
+	*/
+    void WriteCache(BinaryCacheWriter& writer,
+                    const std::map<std::string, std::string>& msg_name_substitutions,
+                    const std::map<std::string, std::string>& elem_name_substitutions) const;
+
+    /*
+
+		ReadCache
+
+		Restore the result of IngestLines from a cache written by WriteCache,
+		in place of calling IngestLines.
+
+		reader:						Binary cache reader, opened and validated
+
+		msg_name_substitutions:		Output message name substitutions
+
+		elem_name_substitutions:	Output element name substitutions
+
+		return:						True if the cache was read completely,
+									otherwise false.
+	*/
+    bool ReadCache(BinaryCacheReader& reader,
+                   std::map<std::string, std::string>& msg_name_substitutions,
+                   std::map<std::string, std::string>& elem_name_substitutions);
 };
 
 #endif
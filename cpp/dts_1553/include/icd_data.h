@@ -30,7 +30,7 @@ class ICDData
     std::unordered_map<std::string, ICDElementSchema> string_to_icdschema_map_;
     using icdelem_vec = std::vector<ICDElement>;
     using table_inds_vec = std::set<size_t>;
-    using bus_to_elem_map = std::unordered_map<std::string, icdelem_vec>;
+    using bus_to_elem_map = std::unordered_map<InternedString, icdelem_vec>;
     using xlru_to_elem_map = std::unordered_map<uint8_t, icdelem_vec>;
     using dlru_to_elem_map = std::unordered_map<uint8_t, icdelem_vec>;
     using xsub_to_elem_map = std::unordered_map<uint8_t, icdelem_vec>;
@@ -90,7 +90,9 @@ class ICDData
 
    public:
     const size_t& valid_message_count;
-    const std::vector<std::string>& table_names;
+
+    // Names of the organized message tables, ordered by table index
+    const std::vector<std::string>& GetTableNames() const { return table_names_; }
 
     ICDData();
     ~ICDData();
@@ -106,6 +108,20 @@ class ICDData
                                           uint8_t dest_lru_addr, uint8_t xmit_lru_subaddr, uint8_t dest_lru_subaddr);
     std::set<size_t> LookupTableIndex(uint16_t chanid, uint8_t xmit_lru_addr,
                                       uint8_t dest_lru_addr, uint8_t xmit_lru_subaddr, uint8_t dest_lru_subaddr);
+
+    /*
+    Same as LookupTableIndex, except the lookup is not modified and the
+    set of table indices is not copied, such that an ICDData object may
+    be shared by translation threads.
+
+    Return:
+        Reference to the set of indices of the tables which match the
+        arguments, valid for the life of the object. Empty if there is
+        no match.
+    */
+    const std::set<size_t>& FindTableIndices(uint16_t chanid, uint8_t xmit_lru_addr,
+                                             uint8_t dest_lru_addr, uint8_t xmit_lru_subaddr,
+                                             uint8_t dest_lru_subaddr) const;
     std::string LookupTableNameByIndex(size_t index) const;
     bool ReplaceBusNameWithChannelIDInLookup(const std::map<std::string, std::set<uint64_t>>& input_map);
     std::map<std::string, std::set<uint64_t>> GetBusNameToLRUAddrsMap();
@@ -125,7 +141,7 @@ class ICDData
         of the table name within the vector otherwise.
     */
     size_t GetTableIndexByName(const std::string& table_name,
-                               const std::vector<std::string>& all_table_names);
+                               const std::vector<std::string>& all_table_names) const;
 
     /*
     Get a set of indices of the tables which are represented by
@@ -145,7 +161,39 @@ class ICDData
         will be included.
     */
     std::set<size_t> GetSelectedTableIndicesSet(const std::set<std::string>& selected_msg_names,
-                                                const std::vector<std::string>& all_table_names);
+                                                const std::vector<std::string>& all_table_names) const;
+
+    /*
+    Get the channel IDs and transmit LRU addresses of lookup entries
+    which map to at least one of a set of tables, i.e., the values of
+    the channelid and txrtaddr columns of parsed data which may be
+    translated to one of the tables.
+
+    Args:
+        table_inds          --> Set of table indices
+        chanids             --> Output set of channel IDs
+        xmit_lru_addrs      --> Output set of transmit LRU addresses
+    */
+    void GetLookupKeys(const std::set<size_t>& table_inds, std::set<uint16_t>& chanids,
+                       std::set<uint8_t>& xmit_lru_addrs) const;
+
+    /*
+    Write the state produced by PrepareICDQuery to a binary cache, or
+    restore it from a cache in place of PrepareICDQuery. The lookup is
+    cached prior to ReplaceBusNameWithChannelIDInLookup, which depends
+    on the bus map of the data being translated. ICDData must be the last
+    data written to the cache.
+
+    Args:
+        writer/reader   --> Binary cache writer or reader
+
+    Return:
+        ReadCache: True if the remainder of the cache was read; false
+        otherwise, in which case the object is in the same state as
+        a newly constructed object.
+    */
+    void WriteCache(BinaryCacheWriter& writer) const;
+    bool ReadCache(BinaryCacheReader& reader);
 
     /*
 	* Below are primarily for testing and shouldn't be called by the user.
@@ -335,6 +383,11 @@ class ICDData
                                 const std::vector<std::string> required_params,
                                 T& output);
 
+    // Overload for the InternedString members of ICDElement
+    bool GetMappedValueFromNode(const YAML::Node& node, std::string param_name,
+                                const std::vector<std::string> required_params,
+                                InternedString& output);
+
     /*
     Fill an output vector from a yaml sequence node.
     If the parameter name is not in a vector of required parameters, then the
@@ -6,8 +6,12 @@
 #include <vector>
 #include <map>
 #include "parse_text.h"
+#include "interned_string.h"
 #include "yaml-cpp/yaml.h"
 
+class BinaryCacheWriter;
+class BinaryCacheReader;
+
 enum class ICDElementSchema : uint8_t
 {
     // Not currently used. This value is here to be
@@ -92,6 +96,10 @@ const std::map<ICDElementSchema, std::string> ICDElementSchemaToStringMap = {
 	{ICDElementSchema::SIGNMAG, "SIGNMAG"}
 };
 
+// String members are InternedString handles to strings in the global
+// StringPool, such that copies of elements, which are made as elements
+// are organized into lookup tables and per-thread translation contexts,
+// copy pointers rather than the strings themselves.
 class ICDElement
 {
    private:
@@ -125,7 +133,7 @@ class ICDElement
 			2. MSG02
 
 	*/
-    std::string msg_name_;
+    InternedString msg_name_;
 
     /*
 		-name:			element_name
@@ -140,7 +148,7 @@ class ICDElement
 				word 1 bit 5 of message MSG01)
 
 	*/
-    std::string elem_name_;
+    InternedString elem_name_;
 
     /*
 		-name:			xmit_word
@@ -250,7 +258,7 @@ class ICDElement
 		-special cases:
 		-examples:
 	*/
-    std::string bus_name_;
+    InternedString bus_name_;
 
     /*
 		-name:			xmit_lru_name
@@ -259,7 +267,7 @@ class ICDElement
 		-special cases:
 		-examples:
 	*/
-    std::string xmit_lru_name_;
+    InternedString xmit_lru_name_;
 
     /*
 		-name:			xmit_lru_addr
@@ -277,7 +285,7 @@ class ICDElement
 		-special cases:
 		-examples:
 	*/
-    std::string dest_lru_name_;
+    InternedString dest_lru_name_;
 
     /*
 		-name:			dest_lru_name
@@ -499,7 +507,7 @@ class ICDElement
 			1. "LATITUDE"
 			2. "LONGITUDE"
 	*/
-    std::string description_;
+    InternedString description_;
 
     /*
 		-name:			msb_val
@@ -539,7 +547,7 @@ class ICDElement
 			1. FT-SEC
 			2. PIRAD
 	*/
-    std::string uom_;
+    InternedString uom_;
 
 	/*
 		-name:			bcd_partial
@@ -605,6 +613,19 @@ class ICDElement
     bool Fill(const std::string& icdelem_str);
     bool FillElements(const std::vector<std::string>& input_str_vec);
 	static int GetFillElementCount();
+
+    /*
+    Write all data members to a binary cache, or read them in the
+    same order.
+
+    Args:
+        writer/reader   --> Binary cache writer or reader
+
+    Return:
+        ReadCache: True if all members were read; false otherwise.
+    */
+    void WriteCache(BinaryCacheWriter& writer) const;
+    bool ReadCache(BinaryCacheReader& reader);
 };
 
 #endif
@@ -1,4 +1,5 @@
 #include "dts1553.h"
+#include "binary_cache.h"
 
 bool DTS1553::IngestLines(const ManagedPath& dts_path, const std::vector<std::string>& lines,
                           std::map<std::string, std::string>& msg_name_substitutions,
@@ -186,4 +187,92 @@ bool DTS1553::FillSupplBusNameToMsgKeyMap(const YAML::Node& suppl_busmap_comm_wo
         }
     }
     return true;
-}
\ No newline at end of file
+}
+
+static void WriteCacheStringMap(BinaryCacheWriter& writer,
+                                const std::map<std::string, std::string>& input_map)
+{
+    writer.WriteSize(input_map.size());
+    for (std::map<std::string, std::string>::const_iterator it = input_map.cbegin();
+         it != input_map.cend(); ++it)
+    {
+        writer.WriteString(it->first);
+        writer.WriteString(it->second);
+    }
+}
+
+static bool ReadCacheStringMap(BinaryCacheReader& reader,
+                               std::map<std::string, std::string>& output_map)
+{
+    size_t count = 0;
+    std::string key;
+    if (!reader.ReadSize(count))
+        return false;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!reader.ReadString(key) || !reader.ReadString(output_map[key]))
+            return false;
+    }
+    return true;
+}
+
+void DTS1553::WriteCache(BinaryCacheWriter& writer,
+                         const std::map<std::string, std::string>& msg_name_substitutions,
+                         const std::map<std::string, std::string>& elem_name_substitutions) const
+{
+    WriteCacheStringMap(writer, msg_name_substitutions);
+    WriteCacheStringMap(writer, elem_name_substitutions);
+
+    writer.WriteSize(suppl_bus_name_to_message_key_map_.size());
+    for (std::map<std::string, std::set<uint64_t>>::const_iterator it =
+             suppl_bus_name_to_message_key_map_.cbegin();
+         it != suppl_bus_name_to_message_key_map_.cend(); ++it)
+    {
+        writer.WriteString(it->first);
+        writer.WriteSize(it->second.size());
+        for (std::set<uint64_t>::const_iterator key_it = it->second.cbegin();
+             key_it != it->second.cend(); ++key_it)
+            writer.Write(*key_it);
+    }
+
+    icd_data_.WriteCache(writer);
+}
+
+bool DTS1553::ReadCache(BinaryCacheReader& reader,
+                        std::map<std::string, std::string>& msg_name_substitutions,
+                        std::map<std::string, std::string>& elem_name_substitutions)
+{
+    msg_name_substitutions.clear();
+    elem_name_substitutions.clear();
+    suppl_bus_name_to_message_key_map_.clear();
+
+    size_t count = 0;
+    size_t key_count = 0;
+    uint64_t key = 0;
+    std::string bus_name;
+    bool success = ReadCacheStringMap(reader, msg_name_substitutions) &&
+        ReadCacheStringMap(reader, elem_name_substitutions) && reader.ReadSize(count);
+    for (size_t i = 0; i < count && success; i++)
+    {
+        success = reader.ReadString(bus_name) && reader.ReadSize(key_count);
+        if (!success)
+            break;
+
+        std::set<uint64_t>& keys = suppl_bus_name_to_message_key_map_[bus_name];
+        for (size_t j = 0; j < key_count && success; j++)
+        {
+            if ((success = reader.Read(key)))
+                keys.insert(key);
+        }
+    }
+
+    if (!success || !icd_data_.ReadCache(reader))
+    {
+        SPDLOG_ERROR("DTS1553: Failed to read DTS1553 cache");
+        msg_name_substitutions.clear();
+        elem_name_substitutions.clear();
+        suppl_bus_name_to_message_key_map_.clear();
+        return false;
+    }
+    return true;
+}
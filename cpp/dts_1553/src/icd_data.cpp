@@ -1,6 +1,7 @@
 #include "icd_data.h"
+#include "binary_cache.h"
 
-ICDData::ICDData() : icd_ingest_success_(false), organize_icd_success_(false), iter_tools_(), yaml_msg_body_keys_({"msg_data", "word_elem", "bit_elem"}), yaml_msg_data_keys_({"lru_addr", "lru_subaddr", "bus", "wrdcnt", "rate"}), yaml_word_elem_keys_({"offset", "cnt", "schema", "msbval"}), yaml_bit_elem_keys_({"offset", "cnt", "schema", "msbval", "msb", "lsb", "bitcnt"}), valid_message_count_(0), valid_message_count(valid_message_count_), uri_percent_encode_(), table_names(table_names_)
+ICDData::ICDData() : icd_ingest_success_(false), organize_icd_success_(false), iter_tools_(), yaml_msg_body_keys_({"msg_data", "word_elem", "bit_elem"}), yaml_msg_data_keys_({"lru_addr", "lru_subaddr", "bus", "wrdcnt", "rate"}), yaml_word_elem_keys_({"offset", "cnt", "schema", "msbval"}), yaml_bit_elem_keys_({"offset", "cnt", "schema", "msbval", "msb", "lsb", "bitcnt"}), valid_message_count_(0), valid_message_count(valid_message_count_), uri_percent_encode_()
 {
     MapICDElementSchemaToString();
 }
@@ -241,6 +242,21 @@ std::vector<std::vector<size_t>> ICDData::GetTableOrganizationIndices()
     return tables_;
 }
 
+// Copy the value of an InternedString member of each element, as in
+// IterableTools::VectorOfMember.
+static std::vector<std::string> VectorOfStringMember(const std::vector<ICDElement>& icd_elems,
+                                                     InternedString ICDElement::*member)
+{
+    std::vector<std::string> output;
+    output.reserve(icd_elems.size());
+    for (std::vector<ICDElement>::const_iterator it = icd_elems.cbegin();
+         it != icd_elems.cend(); ++it)
+    {
+        output.push_back((*it).*member);
+    }
+    return output;
+}
+
 bool ICDData::CreateTables(const std::vector<ICDElement>& icd_elems,
                            std::vector<std::vector<size_t>>& output_organized_inds)
 {
@@ -248,8 +264,8 @@ bool ICDData::CreateTables(const std::vector<ICDElement>& icd_elems,
         return false;
 
     // Obtain a vector of ICDElement.msg_name_.
-    std::vector<std::string> msg_name_vec = iter_tools_.VectorOfMember(icd_elems,
-                                                                       &ICDElement::msg_name_);
+    std::vector<std::string> msg_name_vec = VectorOfStringMember(icd_elems,
+                                                                 &ICDElement::msg_name_);
 
     // Find the unique values in msg_name_vec.
     std::vector<std::string> msg_name_unique = iter_tools_.UniqueElements(msg_name_vec);
@@ -332,7 +348,7 @@ bool ICDData::CreateTableNameLookup(const std::vector<ICDElement>& icd_message_e
     // Create the table name lookup. Note that it is a lookup in the sense
     // that the index of the matching table can be used to index into the
     // resulting vector to obtain the message name.
-    output_table_names = iter_tools_.VectorOfMember(icd_message_elements, &ICDElement::msg_name_);
+    output_table_names = VectorOfStringMember(icd_message_elements, &ICDElement::msg_name_);
 
     // Check if the table_names_ are unique.
     std::vector<std::string> unique_names = iter_tools_.UniqueElements(output_table_names);
@@ -351,7 +367,7 @@ std::string ICDData::LookupTableNameByIndex(size_t index) const
 }
 
 size_t ICDData::GetTableIndexByName(const std::string& table_name,
-                                    const std::vector<std::string>& all_table_names)
+                                    const std::vector<std::string>& all_table_names) const
 {
     std::vector<size_t> match_inds = iter_tools_.IndicesOfMatching(all_table_names, table_name);
 
@@ -362,7 +378,7 @@ size_t ICDData::GetTableIndexByName(const std::string& table_name,
 }
 
 std::set<size_t> ICDData::GetSelectedTableIndicesSet(const std::set<std::string>& selected_msg_names,
-                                                     const std::vector<std::string>& all_table_names)
+                                                     const std::vector<std::string>& all_table_names) const
 {
     std::set<size_t> indices_set;
     size_t temp_ind;
@@ -455,7 +471,7 @@ void ICDData::UpdateMapFromICDElementsToIndices(const dsub_to_elem_map& dsub_ele
     for (it = dsub_elem_map.begin(); it != dsub_elem_map.end(); ++it)
     {
         // Get a vector of the element names from the vector of ICDElements.
-        current_elem_names = iter_tools_.VectorOfMember(it->second, &ICDElement::msg_name_);
+        current_elem_names = VectorOfStringMember(it->second, &ICDElement::msg_name_);
 
         // Loop over each of the element names.
         table_inds_vec all_inds;
@@ -516,6 +532,71 @@ std::set<size_t> ICDData::LookupTableIndex(uint16_t chanid, uint8_t xmit_lru_add
     return temp_table_inds_;
 }
 
+const std::set<size_t>& ICDData::FindTableIndices(uint16_t chanid, uint8_t xmit_lru_addr,
+                                                  uint8_t dest_lru_addr, uint8_t xmit_lru_subaddr,
+                                                  uint8_t dest_lru_subaddr) const
+{
+    static const table_inds_vec empty_inds;
+
+    complete_lookup::const_iterator chanid_it = icd_lookup_.find(chanid);
+    if (chanid_it == icd_lookup_.cend())
+        return empty_inds;
+    xlru_to_dlru_to_xsub_to_dsub_to_inds::const_iterator xlru_it =
+        chanid_it->second.find(xmit_lru_addr);
+    if (xlru_it == chanid_it->second.cend())
+        return empty_inds;
+    dlru_to_xsub_to_dsub_to_inds::const_iterator dlru_it = xlru_it->second.find(dest_lru_addr);
+    if (dlru_it == xlru_it->second.cend())
+        return empty_inds;
+    xsub_to_dsub_to_inds::const_iterator xsub_it = dlru_it->second.find(xmit_lru_subaddr);
+    if (xsub_it == dlru_it->second.cend())
+        return empty_inds;
+    dsub_to_inds_map::const_iterator dsub_it = xsub_it->second.find(dest_lru_subaddr);
+    if (dsub_it == xsub_it->second.cend())
+        return empty_inds;
+    return dsub_it->second;
+}
+
+void ICDData::GetLookupKeys(const std::set<size_t>& table_inds, std::set<uint16_t>& chanids,
+                            std::set<uint8_t>& xmit_lru_addrs) const
+{
+    chanids.clear();
+    xmit_lru_addrs.clear();
+
+    // LookupTableIndex may insert entries with empty sets of table
+    // indices, which do not contribute keys.
+    for (complete_lookup::const_iterator chanid_it = icd_lookup_.cbegin();
+         chanid_it != icd_lookup_.cend(); ++chanid_it)
+    {
+        for (xlru_to_dlru_to_xsub_to_dsub_to_inds::const_iterator xlru_it = chanid_it->second.cbegin();
+             xlru_it != chanid_it->second.cend(); ++xlru_it)
+        {
+            for (dlru_to_xsub_to_dsub_to_inds::const_iterator dlru_it = xlru_it->second.cbegin();
+                 dlru_it != xlru_it->second.cend(); ++dlru_it)
+            {
+                for (xsub_to_dsub_to_inds::const_iterator xsub_it = dlru_it->second.cbegin();
+                     xsub_it != dlru_it->second.cend(); ++xsub_it)
+                {
+                    for (dsub_to_inds_map::const_iterator dsub_it = xsub_it->second.cbegin();
+                         dsub_it != xsub_it->second.cend(); ++dsub_it)
+                    {
+                        for (table_inds_vec::const_iterator ind_it = dsub_it->second.cbegin();
+                             ind_it != dsub_it->second.cend(); ++ind_it)
+                        {
+                            if (table_inds.count(*ind_it) == 1)
+                            {
+                                chanids.insert(chanid_it->first);
+                                xmit_lru_addrs.insert(xlru_it->first);
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
 bool ICDData::ReplaceBusNameWithChannelIDInLookup(const std::map<std::string,
                                                                  std::set<uint64_t>>& input_map)
 {
@@ -580,7 +661,7 @@ bool ICDData::CreateBusNameToLRUAddressSetMap(
 
     // Group the elements in the vector of message elements by the bus
     // name.
-    std::unordered_map<std::string, icdelem_vec> group_by_bus = iter_tools_.GroupByMember(
+    bus_to_elem_map group_by_bus = iter_tools_.GroupByMember(
         icd_message_elements, &ICDElement::bus_name_);
 
     // For each bus group, get the vector of transmitting LRU addresses
@@ -589,7 +670,7 @@ bool ICDData::CreateBusNameToLRUAddressSetMap(
     //
     // Insert the bus name and set of LRU addresses into the map.
 
-    std::unordered_map<std::string, icdelem_vec>::const_iterator it;
+    bus_to_elem_map::const_iterator it;
     std::vector<uint8_t> xmit_addrs;
     std::vector<uint8_t> dest_addrs;
     std::set<uint64_t> unique_addrs;
@@ -632,6 +713,17 @@ const ICDElement* ICDData::GetElementPointerByIndex(const size_t& index)
     return &icd_elements_[index];
 }
 
+bool ICDData::GetMappedValueFromNode(const YAML::Node& node, std::string param_name,
+                                     const std::vector<std::string> required_params,
+                                     InternedString& output)
+{
+    std::string value = output;
+    if (!GetMappedValueFromNode<std::string>(node, param_name, required_params, value))
+        return false;
+    output = value;
+    return true;
+}
+
 bool ICDData::IsYamlFile(const ManagedPath& icd_path)
 {
     // Get the extension and cast to lower case.
@@ -1201,3 +1293,178 @@ bool ICDData::ConfigureBitElementFromYamlNodes(ICDElement& icd_elem, const std::
 
     return true;
 }
+
+static void WriteCacheElements(BinaryCacheWriter& writer, const std::vector<ICDElement>& elems)
+{
+    writer.WriteSize(elems.size());
+    for (std::vector<ICDElement>::const_iterator it = elems.cbegin(); it != elems.cend(); ++it)
+        it->WriteCache(writer);
+}
+
+static bool ReadCacheElements(BinaryCacheReader& reader, std::vector<ICDElement>& elems)
+{
+    size_t count = 0;
+    if (!reader.ReadSize(count))
+        return false;
+    elems.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!elems[i].ReadCache(reader))
+            return false;
+    }
+    return true;
+}
+
+// Write a set of integers or nested unordered_maps with integer keys
+// and, at the innermost level, set values.
+template <typename K>
+static void WriteCacheNested(BinaryCacheWriter& writer, const std::set<K>& vals)
+{
+    writer.WriteSize(vals.size());
+    for (typename std::set<K>::const_iterator it = vals.cbegin(); it != vals.cend(); ++it)
+        writer.Write(*it);
+}
+
+template <typename K, typename V>
+static void WriteCacheNested(BinaryCacheWriter& writer, const std::unordered_map<K, V>& map)
+{
+    writer.WriteSize(map.size());
+    for (typename std::unordered_map<K, V>::const_iterator it = map.cbegin(); it != map.cend(); ++it)
+    {
+        writer.Write(it->first);
+        WriteCacheNested(writer, it->second);
+    }
+}
+
+template <typename K>
+static bool ReadCacheNested(BinaryCacheReader& reader, std::set<K>& vals)
+{
+    size_t count = 0;
+    K val;
+    if (!reader.ReadSize(count))
+        return false;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!reader.Read(val))
+            return false;
+        vals.insert(vals.end(), val);
+    }
+    return true;
+}
+
+template <typename K, typename V>
+static bool ReadCacheNested(BinaryCacheReader& reader, std::unordered_map<K, V>& map)
+{
+    size_t count = 0;
+    K key;
+    if (!reader.ReadSize(count))
+        return false;
+    map.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!reader.Read(key) || !ReadCacheNested(reader, map[key]))
+            return false;
+    }
+    return true;
+}
+
+void ICDData::WriteCache(BinaryCacheWriter& writer) const
+{
+    writer.Write(icd_ingest_success_);
+    writer.Write(organize_icd_success_);
+    writer.WriteSize(valid_message_count_);
+    WriteCacheElements(writer, icd_elements_);
+    WriteCacheElements(writer, icd_msg_elements_);
+
+    writer.WriteSize(tables_.size());
+    for (size_t i = 0; i < tables_.size(); i++)
+    {
+        writer.WriteSize(tables_[i].size());
+        for (size_t j = 0; j < tables_[i].size(); j++)
+            writer.WriteSize(tables_[i][j]);
+    }
+
+    writer.WriteSize(table_names_.size());
+    for (size_t i = 0; i < table_names_.size(); i++)
+        writer.WriteString(table_names_[i]);
+
+    writer.WriteSize(bus_name_to_lru_addrs_map_.size());
+    for (std::map<std::string, std::set<uint64_t>>::const_iterator it =
+             bus_name_to_lru_addrs_map_.cbegin(); it != bus_name_to_lru_addrs_map_.cend(); ++it)
+    {
+        writer.WriteString(it->first);
+        WriteCacheNested(writer, it->second);
+    }
+
+    writer.WriteSize(icd_temp_lookup_.size());
+    for (complete_temp_lookup::const_iterator it = icd_temp_lookup_.cbegin();
+         it != icd_temp_lookup_.cend(); ++it)
+    {
+        writer.WriteString(it->first);
+        WriteCacheNested(writer, it->second);
+    }
+}
+
+bool ICDData::ReadCache(BinaryCacheReader& reader)
+{
+    size_t count = 0;
+    size_t inner_count = 0;
+    std::string name;
+    bool success = reader.Read(icd_ingest_success_) && reader.Read(organize_icd_success_) &&
+        reader.ReadSize(valid_message_count_) && ReadCacheElements(reader, icd_elements_) &&
+        ReadCacheElements(reader, icd_msg_elements_) && reader.ReadSize(count);
+
+    if (success)
+    {
+        tables_.resize(count);
+        for (size_t i = 0; i < count && success; i++)
+        {
+            success = reader.ReadSize(inner_count);
+            if (success)
+                tables_[i].resize(inner_count);
+            for (size_t j = 0; j < inner_count && success; j++)
+                success = reader.ReadSize(tables_[i][j]);
+        }
+    }
+
+    if (success && (success = reader.ReadSize(count)))
+    {
+        table_names_.resize(count);
+        for (size_t i = 0; i < count && success; i++)
+            success = reader.ReadString(table_names_[i]);
+    }
+
+    if (success && (success = reader.ReadSize(count)))
+    {
+        for (size_t i = 0; i < count && success; i++)
+        {
+            success = reader.ReadString(name) &&
+                ReadCacheNested(reader, bus_name_to_lru_addrs_map_[name]);
+        }
+    }
+
+    if (success && (success = reader.ReadSize(count)))
+    {
+        for (size_t i = 0; i < count && success; i++)
+        {
+            success = reader.ReadString(name) &&
+                ReadCacheNested(reader, icd_temp_lookup_[name]);
+        }
+    }
+
+    if (!success || !reader.AtEnd())
+    {
+        SPDLOG_WARN("ICDData::ReadCache(): Cache is incomplete or corrupt");
+        icd_ingest_success_ = false;
+        organize_icd_success_ = false;
+        valid_message_count_ = 0;
+        icd_elements_.clear();
+        icd_msg_elements_.clear();
+        tables_.clear();
+        table_names_.clear();
+        bus_name_to_lru_addrs_map_.clear();
+        icd_temp_lookup_.clear();
+        return false;
+    }
+    return true;
+}
@@ -1,4 +1,5 @@
 #include "icd_element.h"
+#include "binary_cache.h"
 
 const int ICDElement::kFillElementCount = 25; // 27;
 
@@ -377,3 +378,80 @@ bool ICDElement::FillElements(const std::vector<std::string>& input_str_vec)
 
     return true;
 }
+
+void ICDElement::WriteCache(BinaryCacheWriter& writer) const
+{
+    writer.WriteString(msg_name_);
+    writer.WriteString(elem_name_);
+    writer.Write(xmit_word_);
+    writer.Write(dest_word_);
+    writer.Write(msg_word_count_);
+    writer.WriteString(bus_name_);
+    writer.WriteString(xmit_lru_name_);
+    writer.Write(xmit_lru_addr_);
+    writer.WriteString(dest_lru_name_);
+    writer.Write(dest_lru_addr_);
+    writer.Write(xmit_lru_subaddr_);
+    writer.Write(dest_lru_subaddr_);
+    writer.Write(rate_);
+    writer.Write(offset_);
+    writer.Write(elem_word_count_);
+    writer.Write(schema_);
+    writer.Write(is_bitlevel_);
+    writer.Write(is_multiformat_);
+    writer.Write(bitmsb_);
+    writer.Write(bitlsb_);
+    writer.Write(bit_count_);
+    writer.Write(classification_);
+    writer.WriteString(description_);
+    writer.Write(msb_val_);
+    writer.WriteString(uom_);
+    writer.Write(channel_id_);
+    writer.Write(bcd_partial_);
+    writer.Write(label_);
+    writer.Write(sdi_);
+}
+
+// Read a string from the cache into the string pool
+static bool ReadInternedString(BinaryCacheReader& reader, InternedString& value)
+{
+    std::string temp;
+    if (!reader.ReadString(temp))
+        return false;
+    value = temp;
+    return true;
+}
+
+bool ICDElement::ReadCache(BinaryCacheReader& reader)
+{
+    return (
+        ReadInternedString(reader, msg_name_) &&
+        ReadInternedString(reader, elem_name_) &&
+        reader.Read(xmit_word_) &&
+        reader.Read(dest_word_) &&
+        reader.Read(msg_word_count_) &&
+        ReadInternedString(reader, bus_name_) &&
+        ReadInternedString(reader, xmit_lru_name_) &&
+        reader.Read(xmit_lru_addr_) &&
+        ReadInternedString(reader, dest_lru_name_) &&
+        reader.Read(dest_lru_addr_) &&
+        reader.Read(xmit_lru_subaddr_) &&
+        reader.Read(dest_lru_subaddr_) &&
+        reader.Read(rate_) &&
+        reader.Read(offset_) &&
+        reader.Read(elem_word_count_) &&
+        reader.Read(schema_) &&
+        reader.Read(is_bitlevel_) &&
+        reader.Read(is_multiformat_) &&
+        reader.Read(bitmsb_) &&
+        reader.Read(bitlsb_) &&
+        reader.Read(bit_count_) &&
+        reader.Read(classification_) &&
+        ReadInternedString(reader, description_) &&
+        reader.Read(msb_val_) &&
+        ReadInternedString(reader, uom_) &&
+        reader.Read(channel_id_) &&
+        reader.Read(bcd_partial_) &&
+        reader.Read(label_) &&
+        reader.Read(sdi_));
+}
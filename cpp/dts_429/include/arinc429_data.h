@@ -4,8 +4,11 @@
 #include <sstream>
 #include <vector>
 #include <map>
+#include <set>
 #include <unordered_map>
 #include <string>
+#include <limits>
+#include <memory>
 #include "icd_data.h"
 #include "icd_element.h"
 #include "spdlog/spdlog.h"
@@ -18,59 +21,94 @@
 class ARINC429Data
 {
    private:
-    std::unordered_map<uint16_t,std::unordered_map<uint16_t, std::unordered_map<
-                        uint16_t,std::unordered_map<int8_t, size_t>>>> organized_lookup_map_;
-    std::vector<std::vector<std::vector<ICDElement>>> element_table_;
+    using lookup_map = std::unordered_map<uint16_t,std::unordered_map<uint16_t,
+        std::unordered_map<uint16_t,std::unordered_map<int8_t, size_t>>>>;
 
-    // map providing the arinc word name at a given table_index and index equal to the
-    // arinc word data vector, vector<vector<ICDElement>>, found in element_table_
-    std::unordered_map<size_t,std::vector<std::string>> arinc_word_names_;
+    // Organized ICD tables, which are not modified after construction.
+    // Copies of ARINC429Data, such as those held by the translation
+    // context of each thread, share a single Tables object.
+    struct Tables
+    {
+        lookup_map organized_lookup_map;
+        std::vector<std::vector<std::vector<ICDElement>>> element_table;
+
+        // map providing the arinc word name at a given table_index and index equal to the
+        // arinc word data vector, vector<vector<ICDElement>>, found in element_table
+        std::unordered_map<size_t,std::vector<std::string>> arinc_word_names;
+        std::unordered_map<std::string, size_t> arinc_word_name_to_unique_index_map;
+
+        // Word names and unique indices ordered by the table index from
+        // IdentifyWord and the position in the group, such that per-row
+        // lookups are by index rather than by hashing names.
+        std::vector<std::vector<std::string>> word_group_names;
+        std::vector<std::vector<size_t>> word_group_unique_indices;
+
+        // Dense lookup compiled from organized_lookup_map by CompileLookup.
+        // Each channel ID and bus has a block of label_count_ x sdi_slot_count_
+        // table indices in dense_lookup, at the offset given by
+        // dense_lookup_offsets for the key (channelid << 16 | subchannel id).
+        // Slots 0-3 are SDI values 0-3, with the SDI -1 wildcard entry
+        // substituted if there is no entry for the SDI. Slot 4 holds only
+        // the wildcard entry, for SDI values outside of 0-3.
+        std::unordered_map<uint32_t, size_t> dense_lookup_offsets;
+        std::vector<size_t> dense_lookup;
+    };
+    std::shared_ptr<const Tables> tables_;
 
     // count of valid 429 words in ICD
     size_t valid_arinc_word_count_;
-    std::unordered_map<std::string, size_t> arinc_word_name_to_unique_index_map_;
+
+    static const size_t label_count_;
+    static const size_t sdi_slot_count_;
+    static const size_t no_table_index_;
+
+    /*
+    Build the dense lookup from organized_lookup_map. Labels greater
+    than 255 can't occur in an ARINC 429 word and are not included.
+    */
+    static void CompileLookup(Tables& tables);
+
+    /*
+    Fill the word group names and unique indices from arinc_word_names
+    and arinc_word_name_to_unique_index_map.
+    */
+    static void CompileWordGroups(Tables& tables);
+
+    /*
+    Compile the lookup and word groups of a Tables object and share it.
+
+    Args:
+        tables          --> Tables object with organized_lookup_map,
+                            element_table and arinc_word_names filled
+        index_names     --> True if arinc_word_name_to_unique_index_map
+                            and the word groups ought to be filled
+    */
+    void SetTables(std::shared_ptr<Tables> tables, bool index_names);
 
 
    public:
-    ARINC429Data() {}
+    ARINC429Data() : tables_(std::make_shared<Tables>()), valid_arinc_word_count_(0) {}
     virtual ~ARINC429Data() {}
 
     ARINC429Data(std::unordered_map<uint16_t,std::unordered_map<uint16_t, std::unordered_map<
                   uint16_t,std::unordered_map<int8_t, size_t>>>>& organized_lookup_map,
-                  std::vector<std::vector<std::vector<ICDElement>>>& element_table)
-    {
-        organized_lookup_map_ = organized_lookup_map;
-        element_table_ = element_table;
-    }
+                  std::vector<std::vector<std::vector<ICDElement>>>& element_table);
 
     ARINC429Data(std::unordered_map<uint16_t,std::unordered_map<uint16_t, std::unordered_map<
                 uint16_t,std::unordered_map<int8_t, size_t>>>>& organized_lookup_map,
                 std::vector<std::vector<std::vector<ICDElement>>>& element_table,
-                std::unordered_map<size_t,std::vector<std::string>>& arinc_word_names)
-    {
-        organized_lookup_map_ = organized_lookup_map;
-        element_table_ = element_table;
-        arinc_word_names_ = arinc_word_names;
-        SetNamesToUniqueIndexMap(arinc_word_names_,arinc_word_name_to_unique_index_map_);
-    }
+                std::unordered_map<size_t,std::vector<std::string>>& arinc_word_names);
 
     ARINC429Data(std::unordered_map<uint16_t,std::unordered_map<uint16_t, std::unordered_map<
                 uint16_t,std::unordered_map<int8_t, size_t>>>>& organized_lookup_map,
                 std::vector<std::vector<std::vector<ICDElement>>>& element_table,
                 std::unordered_map<size_t,std::vector<std::string>>& arinc_word_names,
-                size_t& valid_arinc_word_count)
-    {
-        organized_lookup_map_ = organized_lookup_map;
-        element_table_ = element_table;
-        arinc_word_names_ = arinc_word_names;
-        valid_arinc_word_count_ = valid_arinc_word_count;
-        SetNamesToUniqueIndexMap(arinc_word_names_,arinc_word_name_to_unique_index_map_);
-    }
+                size_t& valid_arinc_word_count);
 
-    size_t GetTableSize() { return element_table_.size(); }
-    std::unordered_map<size_t,std::vector<std::string>> GetArincWordNamesMap()
+    size_t GetTableSize() { return tables_->element_table.size(); }
+    const std::unordered_map<size_t,std::vector<std::string>>& GetArincWordNamesMap() const
     {
-        return arinc_word_names_;
+        return tables_->arinc_word_names;
     }
 
     // build  arinc_word_name_to_unique_index_map_ from arinc_word_names.
@@ -96,21 +134,34 @@ class ARINC429Data
         return true;
     }
 
-    std::unordered_map<std::string, size_t> GetNamesToUniqueIndexMap()
+    const std::unordered_map<std::string, size_t>& GetNamesToUniqueIndexMap() const
+    {
+        return tables_->arinc_word_name_to_unique_index_map;
+    }
+
+    // Word names and unique table indices of the words in the group at
+    // a table index from IdentifyWord, ordered as in GetWordElements.
+    // Empty if the object was not constructed with word names.
+    const std::vector<std::vector<std::string>>& GetWordGroupNames() const
     {
-        return arinc_word_name_to_unique_index_map_;
+        return tables_->word_group_names;
+    }
+    const std::vector<std::vector<size_t>>& GetWordGroupUniqueIndices() const
+    {
+        return tables_->word_group_unique_indices;
     }
 
     virtual size_t GetValidArincWordCount() {return valid_arinc_word_count_;}
 
    /*
     Identify word. Provides the index to a vector of ICDElements vectors.
-    Locates index from organized_lookup_map_ with the inputs channelid,
-    subchannel_id, label, and sdi. If found, stores in table_index.
+    Locates index from the dense lookup compiled from organized_lookup_map
+    with the inputs channelid, subchannel_id, label, and sdi. If found,
+    stores in table_index.
 
     Args:
         table_index --> size_t index where 429 word related information
-                        is located in element_table_
+                        is located in element_table
 
         chan_id     --> uint16_t id of channel in ch10 recording.
 
@@ -126,24 +177,54 @@ class ARINC429Data
     virtual bool IdentifyWord(size_t& table_index, uint16_t& channelid, uint16_t& subchan_id,
                         uint16_t& label, int8_t& sdi);
 
+   /*
+    Get the channel IDs and labels in organized_lookup_map, i.e., the
+    values of the channelid and label columns of parsed data which may
+    be identified as a word by IdentifyWord.
+
+    Args:
+        channelids  --> Output set of channel IDs
+
+        labels      --> Output set of labels
+    */
+    void GetLookupKeys(std::set<uint16_t>& channelids, std::set<uint16_t>& labels) const;
+
    /*
     Find vector vector<ICDElement> which are associated with an ARINC429
-    word, and are stored in element_table_ at given table index
+    word, and are stored in element_table at given table index
 
     Args:
         table_index --> size_t index where 429 word related information
-                        is located in element_table_
+                        is located in element_table
 
         arinc_elems --> ICDElement information related to a set of ARINC 429
                         identifiers (channelid, subchannel_id, label, sdi).
                         This vector of vectors is found at index, table_index,
-                        in element_table_.
+                        in element_table.
 
     Return:
         true if index found in elem_vec, false otherwise
     */
     virtual bool GetWordElements(size_t& table_index, std::vector<std::vector<ICDElement>>& arinc_elems);
 
+   /*
+    Same as above, without copying the ICDElement vectors. Used per
+    row during translation.
+
+    Args:
+        table_index --> size_t index where 429 word related information
+                        is located in element_table
+
+        arinc_elems --> Output pointer to the vector of vectors at index,
+                        table_index, in element_table. Valid for the
+                        life of the object.
+
+    Return:
+        true if index found in elem_vec, false otherwise
+    */
+    bool GetWordElements(const size_t& table_index,
+                         const std::vector<std::vector<ICDElement>>*& arinc_elems) const;
+
     /*
     Identify the name of and ARINC 429 word, as given in DTS429, which is stored in the
     arinc_word_name_ map at a given key (table_index) and position in the vector (vector_index)
@@ -151,10 +232,10 @@ class ARINC429Data
 
     Args:
         table_index     --> size_t index where 429 word related information
-                            is located in element_table_
+                            is located in element_table
 
         vector_index    --> size_t index where 429 word related information
-                            is located in element_table_
+                            is located in element_table
 
         word_name       --> std:string variable to store a arinc word name,
                             if located in a vector in the arinc_word_names map
@@ -169,8 +250,8 @@ class ARINC429Data
     arinc_word_name_ map at a given key (table_index) and position in the vector (vector_index)
 
     Return:
-        String which when output depicts the contents of organized_lookup_map_ and
-        element_table_
+        String which when output depicts the contents of organized_lookup_map and
+        element_table
     */
     std::string LookupMapToString();
 
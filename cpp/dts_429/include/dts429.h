@@ -100,6 +100,37 @@ class DTS429
     bool BuildNameToICDElementMap(YAML::Node& transl_wrd_defs_node,
                      std::unordered_map<std::string, std::vector<ICDElement>>& word_elements);
 
+    /*
+		WriteCache
+
+		writer:             Binary cache writer to which the output of
+		                    IngestLines is written.
+
+        word_elements:      Map of ARINC 429 word name to vector of all elements
+                            associated with it, as output by IngestLines
+
+	*/
+    void WriteCache(BinaryCacheWriter& writer,
+                    const std::unordered_map<std::string, std::vector<ICDElement>>& word_elements) const;
+
+    /*
+		ReadCache
+
+		Restore the output of IngestLines from a cache written by WriteCache,
+		in place of calling IngestLines.
+
+		reader:             Binary cache reader, opened and validated
+
+        word_elements:      Output map of ARINC 429 word name to vector
+                            of elements
+
+		return:		        True if the cache was read completely,
+		                    false otherwise.
+
+	*/
+    bool ReadCache(BinaryCacheReader& reader,
+                   std::unordered_map<std::string, std::vector<ICDElement>>& word_elements);
+
     /*
     Perform validation of single word_node, the key:value YAML::Node in which
     the key is a 429 word name and the value is a map with keys 'wrd_data' and
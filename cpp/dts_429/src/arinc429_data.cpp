@@ -1,96 +1,233 @@
 #include "arinc429_data.h"
 
+const size_t ARINC429Data::label_count_ = 256;
+const size_t ARINC429Data::sdi_slot_count_ = 5;
+const size_t ARINC429Data::no_table_index_ = std::numeric_limits<size_t>::max();
+
+ARINC429Data::ARINC429Data(lookup_map& organized_lookup_map,
+    std::vector<std::vector<std::vector<ICDElement>>>& element_table) : valid_arinc_word_count_(0)
+{
+    std::shared_ptr<Tables> tables = std::make_shared<Tables>();
+    tables->organized_lookup_map = organized_lookup_map;
+    tables->element_table = element_table;
+    SetTables(tables, false);
+}
+
+ARINC429Data::ARINC429Data(lookup_map& organized_lookup_map,
+    std::vector<std::vector<std::vector<ICDElement>>>& element_table,
+    std::unordered_map<size_t,std::vector<std::string>>& arinc_word_names)
+    : valid_arinc_word_count_(0)
+{
+    std::shared_ptr<Tables> tables = std::make_shared<Tables>();
+    tables->organized_lookup_map = organized_lookup_map;
+    tables->element_table = element_table;
+    tables->arinc_word_names = arinc_word_names;
+    SetTables(tables, true);
+}
+
+ARINC429Data::ARINC429Data(lookup_map& organized_lookup_map,
+    std::vector<std::vector<std::vector<ICDElement>>>& element_table,
+    std::unordered_map<size_t,std::vector<std::string>>& arinc_word_names,
+    size_t& valid_arinc_word_count) : valid_arinc_word_count_(valid_arinc_word_count)
+{
+    std::shared_ptr<Tables> tables = std::make_shared<Tables>();
+    tables->organized_lookup_map = organized_lookup_map;
+    tables->element_table = element_table;
+    tables->arinc_word_names = arinc_word_names;
+    SetTables(tables, true);
+}
+
+void ARINC429Data::SetTables(std::shared_ptr<Tables> tables, bool index_names)
+{
+    if (index_names)
+    {
+        SetNamesToUniqueIndexMap(tables->arinc_word_names,
+            tables->arinc_word_name_to_unique_index_map);
+        CompileWordGroups(*tables);
+    }
+    CompileLookup(*tables);
+    tables_ = tables;
+}
+
+void ARINC429Data::CompileWordGroups(Tables& tables)
+{
+    for (std::unordered_map<size_t, std::vector<std::string>>::const_iterator it =
+         tables.arinc_word_names.cbegin(); it != tables.arinc_word_names.cend(); ++it)
+    {
+        if (it->first >= tables.word_group_names.size())
+        {
+            tables.word_group_names.resize(it->first + 1);
+            tables.word_group_unique_indices.resize(it->first + 1);
+        }
+        tables.word_group_names[it->first] = it->second;
+        for (size_t i = 0; i < it->second.size(); i++)
+        {
+            tables.word_group_unique_indices[it->first].push_back(
+                tables.arinc_word_name_to_unique_index_map.at(it->second[i]));
+        }
+    }
+}
+
+void ARINC429Data::CompileLookup(Tables& tables)
+{
+    tables.dense_lookup_offsets.clear();
+    tables.dense_lookup.clear();
+
+    size_t block_size = label_count_ * sdi_slot_count_;
+    for (auto chan_it = tables.organized_lookup_map.cbegin(); chan_it != tables.organized_lookup_map.cend();
+         ++chan_it)
+    {
+        for (auto subchan_it = chan_it->second.cbegin(); subchan_it != chan_it->second.cend();
+             ++subchan_it)
+        {
+            // IdentifyWord is given the zero-based bus number from ch10 and
+            // the lookup map holds the one-based subchannel from TMATS.
+            uint32_t key = (static_cast<uint32_t>(chan_it->first) << 16) |
+                static_cast<uint16_t>(subchan_it->first - 1);
+            size_t offset = tables.dense_lookup.size();
+            tables.dense_lookup.resize(offset + block_size, no_table_index_);
+            tables.dense_lookup_offsets[key] = offset;
+
+            for (auto label_it = subchan_it->second.cbegin();
+                 label_it != subchan_it->second.cend(); ++label_it)
+            {
+                if (label_it->first >= label_count_)
+                {
+                    SPDLOG_WARN("ARINC429Data::CompileLookup(): Label {:d} (channelid {:d}, "
+                        "subchannel {:d}) exceeds 8 bits and can't be identified",
+                        label_it->first, chan_it->first, subchan_it->first);
+                    continue;
+                }
+
+                size_t* slots = tables.dense_lookup.data() + offset + label_it->first * sdi_slot_count_;
+                auto wildcard_it = label_it->second.find(-1);
+                if (wildcard_it != label_it->second.end())
+                {
+                    for (size_t slot = 0; slot < sdi_slot_count_; slot++)
+                        slots[slot] = wildcard_it->second;
+                }
+
+                for (auto sdi_it = label_it->second.cbegin(); sdi_it != label_it->second.cend();
+                     ++sdi_it)
+                {
+                    if (sdi_it->first >= 0 && static_cast<size_t>(sdi_it->first) < sdi_slot_count_ - 1)
+                        slots[sdi_it->first] = sdi_it->second;
+                }
+            }
+        }
+    }
+}
+
 bool ARINC429Data::IdentifyWord(size_t& table_index, uint16_t& channelid, uint16_t& subchan_id,
                         uint16_t& label, int8_t& sdi)
 {
     // validity checks.
-    if(organized_lookup_map_.empty())
+    if(tables_->organized_lookup_map.empty())
     {
         SPDLOG_WARN("ARINC429Data::IdentifyWord(): Empty lookup map");
         return false;
     }
 
-    if(element_table_.empty())
+    if(tables_->element_table.empty())
     {
         SPDLOG_WARN("ARINC429Data::IdentifyWord(): Empty element table");
         return false;
     }
 
-    // if channel id not in map
-    if(organized_lookup_map_.find(channelid)
-        ==organized_lookup_map_.end()) return false;
+    if(label >= label_count_) return false;
 
+    // if channel id and subchannel id not in lookup
+    std::unordered_map<uint32_t, size_t>::const_iterator it =
+        tables_->dense_lookup_offsets.find((static_cast<uint32_t>(channelid) << 16) | subchan_id);
+    if(it == tables_->dense_lookup_offsets.end()) return false;
 
-    // if subchannel_id not in map
-    if(organized_lookup_map_[channelid].find(subchan_id+1)
-        ==organized_lookup_map_[channelid].end()) return false;
+    // SDI values other than 0-3 only match the wildcard (-1) entry
+    size_t slot = (sdi >= 0 && static_cast<size_t>(sdi) < sdi_slot_count_ - 1) ?
+        static_cast<size_t>(sdi) : sdi_slot_count_ - 1;
+    size_t index = tables_->dense_lookup[it->second + label * sdi_slot_count_ + slot];
+    if(index == no_table_index_) return false;
 
-    // if label not in map
-    if(organized_lookup_map_[channelid][subchan_id+1].find(label)
-        ==organized_lookup_map_[channelid][subchan_id+1].end()) return false;
+    table_index = index;
+    return true;
+}
+
+void ARINC429Data::GetLookupKeys(std::set<uint16_t>& channelids, std::set<uint16_t>& labels) const
+{
+    channelids.clear();
+    labels.clear();
 
-    // if sdi not in map
-    if(organized_lookup_map_[channelid][subchan_id+1][label].find(sdi)
-        ==organized_lookup_map_[channelid][subchan_id+1][label].end())
+    // IdentifyWord may insert empty maps, which do not contribute keys.
+    for (auto chan_it = tables_->organized_lookup_map.cbegin(); chan_it != tables_->organized_lookup_map.cend();
+         ++chan_it)
     {
-        // check for SDI of -1, indicating the DTS doesn't care what the SDI is
-        if(organized_lookup_map_[channelid][subchan_id+1][label].find(-1)
-            ==organized_lookup_map_[channelid][subchan_id+1][label].end())
+        for (auto subchan_it = chan_it->second.cbegin(); subchan_it != chan_it->second.cend();
+             ++subchan_it)
         {
-            return false;
-        }
-        else
-        {
-            table_index =organized_lookup_map_[channelid][subchan_id+1][label][-1];
-            return true;
+            for (auto label_it = subchan_it->second.cbegin();
+                 label_it != subchan_it->second.cend(); ++label_it)
+            {
+                if (!label_it->second.empty())
+                {
+                    channelids.insert(chan_it->first);
+                    labels.insert(label_it->first);
+                }
+            }
         }
     }
-
-    table_index = organized_lookup_map_[channelid][subchan_id+1][label][sdi];
-
-    return true;
 }
 
 bool ARINC429Data::GetWordElements(size_t& table_index, std::vector<std::vector<ICDElement>>& arinc_elems)
 {
     // validity checks.
-    if(organized_lookup_map_.empty())
+    if(tables_->organized_lookup_map.empty())
     {
         SPDLOG_WARN("ARINC429Data::GetWordElements(): Empty lookup map");
         return false;
     }
 
-    if(element_table_.empty())
+    if(tables_->element_table.empty())
     {
         SPDLOG_WARN("ARINC429Data::GetWordElements(): Empty element table");
         return false;
     }
 
-    if(table_index >= element_table_.size())
+    if(table_index >= tables_->element_table.size())
     {
         return false;
     }
 
-    arinc_elems = element_table_[table_index];
+    arinc_elems = tables_->element_table[table_index];
+
+    return true;
+}
+
+bool ARINC429Data::GetWordElements(const size_t& table_index,
+                                   const std::vector<std::vector<ICDElement>>*& arinc_elems) const
+{
+    arinc_elems = nullptr;
+    if(table_index >= tables_->element_table.size())
+        return false;
 
+    arinc_elems = &tables_->element_table[table_index];
     return true;
 }
 
 bool ARINC429Data::GetArincWordNames(size_t& table_index, size_t& vector_index, std::string& word_name)
 {
-    if(arinc_word_names_.empty())
+    if(tables_->arinc_word_names.empty())
     {
         SPDLOG_WARN("ARINC429Data::GetArincWordNames(): Empty word name map");
         return false;
     }
 
-    if(arinc_word_names_.find(table_index)
-        ==arinc_word_names_.end()) return false;
+    std::unordered_map<size_t, std::vector<std::string>>::const_iterator it =
+        tables_->arinc_word_names.find(table_index);
+    if(it == tables_->arinc_word_names.end()) return false;
 
-    if(vector_index >= arinc_word_names_[table_index].size())
+    if(vector_index >= it->second.size())
         return false;
 
-    word_name = arinc_word_names_[table_index][vector_index];
+    word_name = it->second[vector_index];
 
     return true;
 }
@@ -100,7 +237,7 @@ std::string ARINC429Data::LookupMapToString()
     std::string map_string = "ARINC 429 LOOKUP MAP\n";
 
     // iterate channel ids
-    for (auto& it: organized_lookup_map_) {
+    for (auto& it: tables_->organized_lookup_map) {
         //append channel id
         map_string.append("channelid: ");
         map_string.append(std::to_string(it.first));
@@ -125,16 +262,20 @@ std::string ARINC429Data::LookupMapToString()
                     map_string.append(std::to_string(it4.first));
 
                     // append arinc word name
-                    size_t index = organized_lookup_map_[it.first][ it2.first][ it3.first][ it4.first];
+                    size_t index = it4.second;
 
-                    std::vector<std::string> element_name_vec = arinc_word_names_[index];
+                    std::unordered_map<size_t, std::vector<std::string>>::const_iterator names_it =
+                        tables_->arinc_word_names.find(index);
+                    if (names_it == tables_->arinc_word_names.end())
+                        continue;
+                    const std::vector<std::string>& element_name_vec = names_it->second;
                     for(int i=0; i < element_name_vec.size(); i++){
                         map_string.append("\n|----|----|----|---- 429WordName: ");
                         map_string.append(element_name_vec[i]);
                         map_string.append("\n|----|----|----|----|---- ICDElement.elem_name_: ");
 
                         // get element and append element name + info
-                        std::vector<ICDElement> elem_vec = element_table_[index][i];
+                        const std::vector<ICDElement>& elem_vec = tables_->element_table.at(index).at(i);
                         for(int j = 0; j < elem_vec.size(); j++)
                         {
                             map_string.append(elem_vec[j].elem_name_);
@@ -1,4 +1,5 @@
 #include "dts429.h"
+#include "binary_cache.h"
 
 
 bool DTS429::IngestLines(const std::vector<std::string>& lines,
@@ -185,7 +186,10 @@ bool DTS429::CreateICDElementFromWordNodes(const std::string& msg_name,
 
         arinc_param.label_=wrd_data["label"].as<uint16_t>();
         arinc_param.sdi_=static_cast<int8_t>(wrd_data["sdi"].as<int16_t>());
-        arinc_param.bus_name_=wrd_data["bus"].as<std::string>();
+        // handle all 429 bus names as Uppercase to eliminate case sensitivity
+        std::string bus_name = wrd_data["bus"].as<std::string>();
+        std::transform(bus_name.begin(), bus_name.end(), bus_name.begin(), ::toupper);
+        arinc_param.bus_name_ = bus_name;
         arinc_param.msg_name_= msg_name;
         arinc_param.rate_=wrd_data["rate"].as<float>();
         arinc_param.xmit_lru_name_=wrd_data["lru_name"].as<std::string>();
@@ -203,10 +207,6 @@ bool DTS429::CreateICDElementFromWordNodes(const std::string& msg_name,
         arinc_param.offset_=static_cast<uint8_t>(0);
         arinc_param.elem_word_count_=static_cast<uint8_t>(1);
         arinc_param.bitmsb_=static_cast<uint8_t>(msb);
-
-        // handle all 429 bus names as Uppercase to eliminate case sensitivity
-        std::transform(arinc_param.bus_name_.begin(), arinc_param.bus_name_.end(),
-                arinc_param.bus_name_.begin(), ::toupper);
     }
     catch(...)
     {
@@ -273,4 +273,47 @@ bool DTS429::ValidateRootNode(const YAML::Node& root_node)
         return false;
     }
     return true;
-}
\ No newline at end of file
+}
+
+void DTS429::WriteCache(BinaryCacheWriter& writer,
+                const std::unordered_map<std::string, std::vector<ICDElement>>& word_elements) const
+{
+    writer.WriteSize(word_elements.size());
+    for(std::unordered_map<std::string, std::vector<ICDElement>>::const_iterator it =
+        word_elements.cbegin(); it != word_elements.cend(); ++it)
+    {
+        writer.WriteString(it->first);
+        writer.WriteSize(it->second.size());
+        for(size_t i = 0; i < it->second.size(); i++)
+            it->second[i].WriteCache(writer);
+    }
+}
+
+bool DTS429::ReadCache(BinaryCacheReader& reader,
+                std::unordered_map<std::string, std::vector<ICDElement>>& word_elements)
+{
+    word_elements.clear();
+    size_t word_count = 0;
+    size_t elem_count = 0;
+    std::string word_name;
+    bool success = reader.ReadSize(word_count);
+    for(size_t i = 0; i < word_count && success; i++)
+    {
+        success = reader.ReadString(word_name) && reader.ReadSize(elem_count);
+        if(!success)
+            break;
+
+        std::vector<ICDElement>& elems = word_elements[word_name];
+        elems.resize(elem_count);
+        for(size_t j = 0; j < elem_count && success; j++)
+            success = elems[j].ReadCache(reader);
+    }
+
+    if(!success || !reader.AtEnd())
+    {
+        SPDLOG_ERROR("DTS429::ReadCache(): Cache is incomplete or corrupt");
+        word_elements.clear();
+        return false;
+    }
+    return true;
+}
@@ -116,7 +116,7 @@ class NetworkPacketParser
 	directory alongside the *_ethernet__xxx.parquet files. File names have a 
 	leading underscore to avoid conflict with parquet file readers that ingest
 	the entire parquet directory. One pcap file is written per thread, per
-	channel ID.
+	channel ID. Pcap files opened for a previously enabled path are closed.
 
 	Args:
 		pq_output_file		--> The path for the thread-specific parquet
@@ -217,6 +217,8 @@ bool NetworkPacketParser::ParserSelector(Tins::PDU* pdu_ptr, EthernetData* const
 
 ManagedPath NetworkPacketParser::EnablePcapOutput(const ManagedPath& pq_output_file)
 {
+    ClearPcapWriterMap();
+
     ManagedPath file_name("_" + pq_output_file.filename().RawString());
     pcap_base_path_ = pq_output_file.parent_path().CreatePathObject(file_name,
                                                                     ".pcap");
@@ -59,7 +59,8 @@ inline bool ConfigureTranslateCLI(CLIGroup& translate_cli_group,
         MetaCLIHelpStrings::translate_help, "clitranslate");
 
     // Positional arg, required
-    std::set<std::string> permitted_translate_subcommands{"1553", "arinc429"};
+    std::set<std::string> permitted_translate_subcommands{"1553", "arinc429",
+        "multibus"};
     translate_cli->AddOption<std::string>(
         "subcommand", 
         MetaCLIHelpStrings::translate_subcommand_help, 
@@ -27,7 +27,7 @@ namespace MetaCLIHelpStrings
         R"(Translate parsed intermediate files to engineering unit data)";
 
     const std::string translate_subcommand_help = 
-        R"(Subcommands include: 1553, arinc429)"; 
+        R"(Subcommands include: 1553, arinc429, multibus)"; 
 
     const std::string util_hl_desc = 
         R"(Entry point for utilities)";
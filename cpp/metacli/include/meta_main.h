@@ -18,6 +18,7 @@
 #include "meta_cli.h"
 #include "translate_tabular_1553_main.h"
 #include "translate_tabular_arinc429_main.h"
+#include "translate_tabular_multibus_main.h"
 #include "binary_comparison_main.h"
 #include "validate_yaml_main.h"
 
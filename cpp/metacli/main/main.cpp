@@ -19,6 +19,10 @@
 #error "translate_tabular_arinc429.cpp: TRANSLATE_429_EXE_NAME must be defined"
 #endif
 
+#ifndef TRANSLATE_MULTIBUS_EXE_NAME
+#error "translate_tabular_multibus.cpp: TRANSLATE_MULTIBUS_EXE_NAME must be defined"
+#endif
+
 
 #include "meta_main.h"
 
@@ -126,6 +126,10 @@ int ExecuteTranslateCLI(int argc, char** argv, CLIGroup& translate_cli_group,
     {
         return TranslateTabularARINC429Main(temp_argc, temp_argv);
     }
+    else if (config.translate_subcommand_ == "multibus")
+    {
+        return TranslateTabularMultiBusMain(temp_argc, temp_argv);
+    }
 
     return EX__MAX;
 }
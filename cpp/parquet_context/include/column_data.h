@@ -2,166 +2,118 @@
 #define COLUMNDATA_H
 
 #include <arrow/api.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <vector>
 #include <typeinfo>
 #include <memory>
 #include "spdlog/spdlog.h"
 
-enum CastFromType
-{
-    TypeUINT64,
-    TypeINT64,
-    TypeUINT32,
-    TypeINT32,
-    TypeUINT16,
-    TypeINT16,
-    TypeUINT8,
-    TypeINT8,
-    TypeNONE,
-};
+/*
+Copy count values, beginning at offset, from the vector set by
+SetMemoryLocation to a buffer of the native type of the column,
+converting each value. The function is resolved from both types once
+when the memory location is set, see CastCopy.
+*/
+typedef void (*CastFunc)(const void* from, void* to, int count, int offset);
 
-class InputDataBase
+template <typename From, typename To>
+void CastCopy(const void* from, void* to, int count, int offset)
 {
-    private:
-        void PrintNotImplWarning(const char* type_name) const 
-        { SPDLOG_ERROR("CopyToCompatible NOT IMPLEMENTED for type: {:s}!", type_name); }
-
-    protected:
-
-        // Pointer to return which can be casted as needed
-        const void* data_ptr_;
-
-    public:
-        // const void* const data_ptr; 
-        InputDataBase() : data_ptr_(nullptr) {}
-        virtual ~InputDataBase() {}
-
-        virtual void CopyToCompatible(int8_t* to_data_ptr, const int& size,
-            const int& offset) const {PrintNotImplWarning(typeid(int8_t).name());}
-        virtual void CopyToCompatible(double* to_data_ptr, const int& size,
-            const int& offset) const { PrintNotImplWarning(typeid(double).name()); }
-        virtual void CopyToCompatible(float* to_data_ptr, const int& size,
-            const int& offset) const {PrintNotImplWarning(typeid(float).name());}
-
-        virtual void CopyToCompatible(int16_t* to_data_ptr, const int& size,
-            const int& offset) const {}
-        virtual void CopyToCompatible(int32_t* to_data_ptr, const int& size,
-            const int& offset) const {}
-        virtual void CopyToCompatible(int64_t* to_data_ptr, const int& size,
-            const int& offset) const {}
-        virtual void CopyToCompatible(uint16_t* to_data_ptr, const int& size,
-            const int& offset) const {PrintNotImplWarning(typeid(uint16_t).name());}
-        virtual void CopyToCompatible(uint32_t* to_data_ptr, const int& size,
-            const int& offset) const {PrintNotImplWarning(typeid(uint32_t).name());}
-        virtual void CopyToCompatible(uint64_t* to_data_ptr, const int& size,
-            const int& offset) const {PrintNotImplWarning(typeid(uint64_t).name());}
-        virtual void CopyToCompatible(uint8_t* to_data_ptr, const int& size,
-            const int& offset) const {PrintNotImplWarning(typeid(uint8_t).name());}
+    const From* from_data = static_cast<const From*>(from) + offset;
+    To* to_data = static_cast<To*>(to);
+    for (int i = 0; i < count; i++)
+        to_data[i] = static_cast<To>(from_data[i]);
+}
+
+/*
+Caller-owned buffers of a variable-length list or binary column. The
+value of row i is the elements of values in [offsets[i], offsets[i + 1]).
+Rows are set in order beginning at row 0, for which offsets[0] is always
+zero, so setting a row writes one offset and copies the elements. The
+values buffer is only resized when the total length of the buffered rows
+exceeds its size, which does not occur once it has grown to the largest
+total of a buffer of rows.
+*/
+template <typename T>
+class ListColumnBuffer
+{
+   public:
+    std::vector<int32_t> offsets;
+    std::vector<T> values;
 
+    ListColumnBuffer() : offsets(), values() {}
 
-};
+    /*
+    Allocate buffers.
 
-template<typename T>
-class InputData : public InputDataBase
-{
-    private:
-        const T* const orig_data_ptr_;
-    
-    public:
-        InputData(const T* const input_ptr) : orig_data_ptr_(input_ptr)
-        {
-            data_ptr_ = reinterpret_cast<const void*>(input_ptr);
-        }
-        virtual ~InputData() {}
+    Args:
+        row_count   --> Count of rows which may be buffered
+        value_count --> Initial count of elements of the values buffer
+    */
+    void Allocate(size_t row_count, size_t value_count)
+    {
+        offsets.assign(row_count + 1, 0);
+        values.resize(value_count);
+    }
 
-        const void* const Data() const 
-        { return data_ptr_; }
+    // Count of rows which may be buffered
+    size_t GetRowCount() const
+    {
+        return offsets.empty() ? 0 : offsets.size() - 1;
+    }
 
-        virtual void CopyToCompatible(int8_t* to_data_ptr, const int& size, 
-            const int& offset) const 
-        {
-            for(size_t i = 0; i < size; i++)
-            {
-                to_data_ptr[i] = static_cast<int8_t>(orig_data_ptr_[offset+i]);
-            }
-        }
-        virtual void CopyToCompatible(int16_t* to_data_ptr, const int& size, 
-            const int& offset) const 
-        {
-            for(size_t i = 0; i < size; i++)
-            {
-                to_data_ptr[i] = static_cast<int16_t>(orig_data_ptr_[offset+i]);
-            }
-        }
-        virtual void CopyToCompatible(int32_t* to_data_ptr, const int& size, 
-            const int& offset) const 
-        {
-            for(size_t i = 0; i < size; i++)
-            {
-                to_data_ptr[i] = static_cast<int32_t>(orig_data_ptr_[offset+i]);
-            }
-        }
-        virtual void CopyToCompatible(int64_t* to_data_ptr, const int& size, 
-            const int& offset) const
-        {
-            for(size_t i = 0; i < size; i++)
-            {
-                to_data_ptr[i] = static_cast<int64_t>(orig_data_ptr_[offset+i]);
-            }
-        }
+    /*
+    Set the value of a row, converting elements to T. The values of
+    rows which follow the row are invalidated.
+
+    Args:
+        row     --> Index of the row, less than GetRowCount()
+        data    --> Elements of the value
+        count   --> Count of elements
+
+    Return:
+        False if row is out of range or the total length of the buffered
+        rows would exceed the range of the offsets, otherwise true.
+    */
+    template <typename U>
+    bool Set(size_t row, const U* data, size_t count)
+    {
+        if (row >= GetRowCount())
+            return false;
+
+        size_t begin = static_cast<size_t>(offsets[row]);
+        size_t end = begin + count;
+        if (end > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+            return false;
+
+        if (end > values.size())
+            values.resize(std::max(end, 2 * values.size()));
+        std::copy(data, data + count, values.data() + begin);
+        offsets[row + 1] = static_cast<int32_t>(end);
+        return true;
+    }
 };
 
+// Buffers of a variable-length binary column, of which the values are
+// bytes
+using BinaryColumnBuffer = ListColumnBuffer<uint8_t>;
+
 class ColumnData
 {
-   private:
-    std::shared_ptr<InputDataBase> input_data_;
-    void SetTypeEnum(std::string name)
-    {
-        if (name == typeid(int8_t).name())
-        {
-            cast_from_ = CastFromType::TypeINT8;
-        }
-        else if (name == typeid(uint8_t).name())
-        {
-            cast_from_ = CastFromType::TypeUINT8;
-        }
-        else if (name == typeid(int16_t).name())
-        {
-            cast_from_ = CastFromType::TypeINT16;
-        }
-        else if (name == typeid(uint16_t).name())
-        {
-            cast_from_ = CastFromType::TypeUINT16;
-        }
-        else if (name == typeid(int32_t).name())
-        {
-            cast_from_ = CastFromType::TypeINT32;
-        }
-        else if (name == typeid(uint32_t).name())
-        {
-            cast_from_ = CastFromType::TypeUINT32;
-        }
-        else if (name == typeid(int64_t).name())
-        {
-            cast_from_ = CastFromType::TypeINT64;
-        }
-        else if (name == typeid(uint64_t).name())
-        {
-            cast_from_ = CastFromType::TypeUINT64;
-        }
-        else
-        {
-            cast_from_ = CastFromType::TypeNONE;
-        }
-    }
-
    public:
     std::string field_name_;
     std::shared_ptr<arrow::DataType> type_;
     void* data_;
     std::vector<uint8_t>* null_values_;
     std::vector<std::string>* str_ptr_;
+    // Offsets and values, a std::vector of the native type of the
+    // column, of a variable-length list or binary column, see
+    // ListColumnBuffer. offsets_ is nullptr for other columns.
+    std::vector<int32_t>* offsets_;
+    void* values_;
     bool is_list_;
     int list_size_;
     int initial_max_row_size_;
@@ -171,12 +123,15 @@ class ColumnData
     bool ready_for_write_;
     std::string type_ID_;  //intended output type (arrow type)
     int byte_size_;
-    CastFromType cast_from_;
 
-    ColumnData() : type_(nullptr), pointer_set_(false), ready_for_write_(false), cast_from_(CastFromType::TypeNONE), builder_(), list_builder_(), initial_max_row_size_(0), input_data_(nullptr), field_name_("") {}
+    // Conversion from the type of the vector set by SetMemoryLocation
+    // to the native type of the column, nullptr if the types are equal
+    CastFunc cast_func_;
+
+    ColumnData() : type_(nullptr), pointer_set_(false), ready_for_write_(false), cast_func_(nullptr), builder_(), list_builder_(), initial_max_row_size_(0), field_name_(""), offsets_(nullptr), values_(nullptr) {}
 
     ColumnData(std::shared_ptr<arrow::DataType> type, std::string fieldName, std::string typeID,
-               int byteSize, int listSize = 0) : field_name_(fieldName), type_ID_(typeID), byte_size_(byteSize), type_(type), pointer_set_(false), ready_for_write_(false), cast_from_(CastFromType::TypeNONE), builder_(), list_builder_(), initial_max_row_size_(0), input_data_(nullptr)
+               int byteSize, int listSize = 0) : field_name_(fieldName), type_ID_(typeID), byte_size_(byteSize), type_(type), pointer_set_(false), ready_for_write_(false), cast_func_(nullptr), builder_(), list_builder_(), initial_max_row_size_(0), offsets_(nullptr), values_(nullptr)
     {
         if (listSize == 0)
         {
@@ -191,14 +146,14 @@ class ColumnData
     }
 
     void SetColumnData(void* data, std::string name,
-                       std::string castFrom,
+                       CastFunc castFunc,
                        std::vector<uint8_t>* boolField,
                        int initialRowSize)
     {
         data_ = data;
         field_name_ = name;
         str_ptr_ = nullptr;
-        SetTypeEnum(castFrom);
+        cast_func_ = castFunc;
         if (boolField == nullptr)
         {
             null_values_ = nullptr;
@@ -220,7 +175,7 @@ class ColumnData
     {
         data_ = nullptr;
         str_ptr_ = &data;
-        cast_from_ = CastFromType::TypeNONE;
+        cast_func_ = nullptr;
         field_name_ = name;
         if (boolField == nullptr)
         {
@@ -237,14 +192,19 @@ class ColumnData
             initial_max_row_size_ = static_cast<int>(data.size());
     }
 
-    void SetInputData(std::shared_ptr<InputDataBase> input_data)
+    void SetColumnData(std::vector<int32_t>& offsets, void* values, std::string name)
     {
-        input_data_ = input_data;
+        data_ = nullptr;
+        str_ptr_ = nullptr;
+        null_values_ = nullptr;
+        offsets_ = &offsets;
+        values_ = values;
+        cast_func_ = nullptr;
+        field_name_ = name;
+        pointer_set_ = true;
+        initial_max_row_size_ = offsets.empty() ? 0 : static_cast<int>(offsets.size()) - 1;
     }
 
-    const std::shared_ptr<InputDataBase> GetInputData() const
-    { return input_data_; }
-
     ~ColumnData() {}
 };
 
@@ -2,9 +2,16 @@
 #define PARQUET_CONTEXT_H
 
 #include <arrow/api.h>
+#include <arrow/type_traits.h>
 #include <arrow/io/api.h>
 #include <parquet/arrow/writer.h>
 #include <parquet/arrow/schema.h>
+#include <parquet/column_writer.h>
+#include <parquet/file_writer.h>
+#ifdef NEWARROW
+#include <arrow/ipc/writer.h>
+#include <arrow/util/base64.h>
+#endif
 #include <vector>
 #include <cstdint>
 #include <cstdio>
@@ -14,7 +21,9 @@
 #include <algorithm>
 #include <string>
 #include <typeinfo>
+#include <type_traits>
 #include <filesystem>
+#include <chrono>
 #include "column_data.h"
 #include "spdlog/spdlog.h"
 
@@ -29,6 +38,58 @@ if linking to the library statically.
 
 */
 
+/*
+Native type of the data of a column of Arrow type ArrowType, i.e., the
+type which is appended to the column without conversion. Boolean and
+binary columns are set from uint8_t.
+*/
+template <typename ArrowType>
+struct ParquetNativeType
+{
+    typedef typename ArrowType::c_type type;
+};
+
+template <>
+struct ParquetNativeType<arrow::BooleanType>
+{
+    typedef uint8_t type;
+};
+
+template <>
+struct ParquetNativeType<arrow::StringType>
+{
+    typedef std::string type;
+};
+
+template <>
+struct ParquetNativeType<arrow::BinaryType>
+{
+    typedef uint8_t type;
+};
+
+/*
+Handle of a column added with ParquetContext::AddColumn, typed by the
+Arrow type of the column and the native type of its data. The column is
+referred to by schema index, such that it is addressed without lookup by
+field name after it has been added.
+*/
+template <typename ArrowType, typename NativeType = typename ParquetNativeType<ArrowType>::type>
+class ParquetColumnHandle
+{
+   private:
+    int index_;
+
+   public:
+    ParquetColumnHandle() : index_(-1) {}
+    explicit ParquetColumnHandle(int index) : index_(index) {}
+
+    // Schema index of the column, -1 if the column was not added
+    int GetIndex() const { return index_; }
+
+    // True if the column was added and its memory location set
+    bool IsValid() const { return index_ >= 0; }
+};
+
 class ParquetContext
 {
    private:
@@ -55,6 +116,48 @@ class ParquetContext
     std::vector<std::shared_ptr<arrow::Field>> fields_;
     std::vector<uint8_t> cast_vec_;
 
+    // List offsets of the current row group of a list column, relative
+    // to the first value of the row group
+    std::vector<int32_t> list_offsets_;
+
+    // Append the rows of the current row group of a column beginning at
+    // row offset. Instantiated for the native and builder types of the
+    // column, see GetAppendFunc.
+    typedef bool (ParquetContext::*AppendFunc)(ColumnData& columnData, const int offset);
+
+    // Write the rows of the current row group of a column beginning at
+    // row offset to the column writer, see EnableDirectWrite.
+    typedef bool (ParquetContext::*WriteFunc)(ColumnData& columnData,
+        parquet::ColumnWriter* writer, const int offset);
+
+    // Typed descriptor of a column. The append and write functions are
+    // resolved from the column type by AddField, such that each row group
+    // is appended and written without lookups by field name or type.
+    struct ColumnDesc
+    {
+        ColumnData* column;
+        AppendFunc append;
+        WriteFunc write;
+    };
+
+    // Write row groups with the parquet column writers, see
+    // EnableDirectWrite. file_writer_ is used in place of writer_.
+    bool direct_write_;
+    std::unique_ptr<parquet::ParquetFileWriter> file_writer_;
+
+    // Definition and repetition levels, values converted to the parquet
+    // physical type, validity bitmap and byte array values of the current
+    // column, reused for each column written by the direct path
+    std::vector<int16_t> def_levels_;
+    std::vector<int16_t> rep_levels_;
+    std::vector<uint8_t> physical_vec_;
+    std::vector<uint8_t> valid_bits_;
+    std::vector<parquet::ByteArray> byte_array_vec_;
+
+    // Columns in schema order, the index of which is the handle index,
+    // see ParquetColumnHandle
+    std::vector<ColumnDesc> columns_;
+
     // Initialize as false and set true when rows are written
     // to the file. Used to determine if the parquet file is empty
     // and should be deleted.
@@ -68,16 +171,99 @@ class ParquetContext
         const std::shared_ptr<arrow::DataType> dtype,
         const bool& is_list_builder);
 
-    bool AppendColumn(ColumnData& dataInfo,
-                      const int& rows,
-                      const int offset = 0);
+    // Append append_row_count_ rows of a column beginning at row offset.
+    bool AppendColumn(const ColumnDesc& column, const int offset);
+
+    // True if the buffer of a column holds append_row_count_ rows
+    // beginning at row offset.
+    bool CheckRowRange(const ColumnData& columnData, const int offset) const;
+
+    /*
+    Get the append function of a column from the Arrow type and whether
+    the column is variable-length.
+
+    Return:
+        Append function, or nullptr if the type is not available.
+    */
+    static AppendFunc GetAppendFunc(const ColumnData& columnData);
+
+    // Append functions, see AppendFunc. T is the native type of the
+    // column and B the builder type of the column or list values.
+    template <typename T, typename B>
+    bool Append(ColumnData& columnData, const int offset);
+
+    template <typename T, typename B>
+    bool AppendVariableList(ColumnData& columnData, const int offset);
+
+    bool AppendBinary(ColumnData& columnData, const int offset);
+
+    bool AppendStrings(ColumnData& columnData, const int offset);
+
+    /*
+    Get the function which converts values from the type of the data
+    set by SetMemoryLocation to the integer type of a column.
+
+    Args:
+        to      --> Arrow type ID of the column
+
+    Return:
+        Conversion function, or nullptr if the column is not a signed
+        integer column.
+    */
+    template <typename From>
+    static CastFunc GetCastFunc(arrow::Type::type to);
+
+    /*
+    Get the function which writes a column to its parquet column writer,
+    see EnableDirectWrite.
+
+    Return:
+        Write function, or nullptr if the type is not available.
+    */
+    static WriteFunc GetWriteFunc(const ColumnData& columnData);
+
+    // Write functions, see WriteFunc. T is the native type of the column
+    // and PT the parquet type, e.g., parquet::Int32Type for int16_t.
+    template <typename T, typename PT>
+    bool WriteValues(ColumnData& columnData, parquet::ColumnWriter* writer, const int offset);
+
+    template <typename T, typename PT>
+    bool WriteVariableList(ColumnData& columnData, parquet::ColumnWriter* writer,
+                           const int offset);
+
+    bool WriteBinary(ColumnData& columnData, parquet::ColumnWriter* writer, const int offset);
+
+    bool WriteStrings(ColumnData& columnData, parquet::ColumnWriter* writer, const int offset);
+
+    /*
+    Get values in the parquet physical type, C, of a column. Values are
+    returned without copy if T is C, otherwise converted into
+    physical_vec_.
+
+    Args:
+        values  --> Native values of the column
+        count   --> Count of values
+
+    Return:
+        Pointer to count values of type C
+    */
+    template <typename T, typename C>
+    const C* GetPhysicalValues(const T* values, int count);
+
+    // Fill definition and repetition levels of rows of list_size values
+    // each, such that each value is defined at max_def.
+    void FillFixedListLevels(int rows, int list_size, int16_t max_def);
 
-    template <typename T, typename A>
-    void Append(const bool& isList,
-                const bool& castRequired,
-                const int& listCount,
-                const int& offset,
-                const ColumnData& columnData);
+    // Fill definition levels of rows of a non-list column from the null
+    // values of the column and set valid_bits_, see WriteBatchSpaced.
+    void FillNullLevels(const uint8_t* null_values, int rows, int16_t max_def);
+
+    // Open file_writer_ with the parquet schema converted from schema_.
+    bool OpenDirectWriter();
+
+    // Write a row group of append_row_count_ rows beginning at row offset
+    // with the parquet column writers.
+    bool WriteRowGroupDirect(const int offset);
 
     void CreateBuilders();
 
@@ -93,6 +279,13 @@ class ParquetContext
 
     bool IsUnsigned(const std::shared_ptr<arrow::DataType> type);
 
+    // Write all buffered row groups and reset the appended row count,
+    // see IncrementAndWrite.
+    void WriteBufferedRowGroups(const uint16_t& thread_id);
+
+    // Nanoseconds elapsed since start
+    static uint64_t ElapsedNs(const std::chrono::steady_clock::time_point& start);
+
     std::string GetTypeIDFromArrowType(const std::shared_ptr<arrow::DataType> type,
                                        int& byteSize);
 
@@ -107,12 +300,33 @@ class ParquetContext
     bool print_activity_;
     std::string print_msg_;
 
+    // Performance counters, accumulated over the life of the object.
+    // Build time is spent copying buffers into Arrow builders and
+    // finishing arrays, write time is spent encoding, compressing and
+    // writing column chunks and close time is spent writing the footer.
+    // The direct path, see EnableDirectWrite, accumulates write time only.
+    uint64_t written_row_count_;
+    uint64_t written_row_group_count_;
+    uint64_t build_time_ns_;
+    uint64_t write_time_ns_;
+    uint64_t close_time_ns_;
+
    public:
     const bool& parquet_stop;
     // User-available variable to access the current
     // count of rows appended to buffers.
     const size_t& append_count_ = appended_row_count_;
     const size_t& row_group_count;
+    const uint64_t& written_row_count;
+    const uint64_t& written_row_group_count;
+    const uint64_t& build_time_ns;
+    const uint64_t& write_time_ns;
+    const uint64_t& close_time_ns;
+
+    // List size passed to AddField for a list column of which each row
+    // may hold a different count of values, see
+    // SetMemoryLocation(ListColumnBuffer)
+    static const int VARIABLE_LIST_SIZE;
 
     /*
 		Initializes parquet context with a default row
@@ -186,6 +400,11 @@ class ParquetContext
 								arrow::boolean()
 								arrow::float32() -> float
 								arrow::float64() -> double
+								arrow::binary() -> variable-length byte
+									strings, see
+									SetMemoryLocation(ListColumnBuffer).
+									Casting and lists are not
+									available.
 
 				fieldName	-> name of the column
 								Must be consistent with fieldName when
@@ -197,7 +416,11 @@ class ParquetContext
 								of values) specify the size of the list
 								Example: if there are to be 32 integers
 								per row listSize=32. If the column is
-								not a list, leave as NULL.
+								not a list, leave as NULL. If the count
+								of values varies from row to row, use
+								VARIABLE_LIST_SIZE, in which case the
+								data are set with
+								SetMemoryLocation(ListColumnBuffer).
 
 		Returns:				True if field created successfully
 								False if output type is unsigned
@@ -269,6 +492,67 @@ class ParquetContext
                            ColumnData* col_data,
                            std::vector<uint8_t>* boolField);
 
+    /*
+    Add a column and set the vector from which its data are appended,
+    equivalent to AddField followed by SetMemoryLocation. NativeType is
+    checked against ArrowType at compile time such that values are never
+    cast, see ParquetNativeType.
+
+    Example:
+        ParquetColumnHandle<arrow::Int64Type> time_col =
+            pq_ctx.AddColumn<arrow::Int64Type>(time_stamp, "time");
+
+    Args:
+        data        --> Vector of data, as for SetMemoryLocation
+        fieldName   --> Name of the column
+        listSize    --> Count of values per row of a list column, zero
+                        if the column is not a list, see AddField
+        boolField   --> Null values, as for SetMemoryLocation
+
+    Return:
+        Handle of the column, which is not valid if AddField or
+        SetMemoryLocation fails.
+    */
+    template <typename ArrowType, typename NativeType>
+    ParquetColumnHandle<ArrowType, NativeType> AddColumn(std::vector<NativeType>& data,
+        const std::string& fieldName, int listSize = 0,
+        std::vector<uint8_t>* boolField = nullptr);
+
+    /*
+    Add a variable-length list column, or a binary column if ArrowType is
+    arrow::BinaryType, and set its buffers, equivalent to AddField
+    followed by SetMemoryLocation(ListColumnBuffer).
+
+    Args:
+        buffer      --> Offsets and values of the column
+        fieldName   --> Name of the column
+
+    Return:
+        Handle of the column, which is not valid if AddField or
+        SetMemoryLocation fails.
+    */
+    template <typename ArrowType, typename NativeType>
+    ParquetColumnHandle<ArrowType, NativeType> AddColumn(ListColumnBuffer<NativeType>& buffer,
+        const std::string& fieldName);
+
+    /*
+    Set the vector of a column added with AddColumn, without lookup by
+    field name, e.g., to swap buffers between row groups.
+
+    Args:
+        column      --> Handle of the column
+        data        --> Vector of data, as for SetMemoryLocation
+        boolField   --> Null values, as for SetMemoryLocation
+
+    Return:
+        True if successful, false if the handle is not valid or the
+        vector can't be set as for SetMemoryLocation.
+    */
+    template <typename ArrowType, typename NativeType>
+    bool SetMemoryLocation(const ParquetColumnHandle<ArrowType, NativeType>& column,
+                           std::vector<NativeType>& data,
+                           std::vector<uint8_t>* boolField = nullptr);
+
     /*
     Virtual functions to call based on SetMemoryLocation specializations.
     Facilitate mocking.
@@ -286,6 +570,53 @@ class ParquetContext
     virtual bool SetMemLocUI8(std::vector<uint8_t>& data, const std::string& fieldName,
                            std::vector<uint8_t>* boolField);
 
+    /*
+    Set the buffers of a variable-length column, i.e., a list column
+    added with AddField(type, fieldName, VARIABLE_LIST_SIZE) or a binary
+    column added with AddField(arrow::binary(), fieldName). Used in place
+    of SetMemoryLocation(std::vector). The buffers are allocated and
+    filled by the caller, see ListColumnBuffer, such that only the values
+    of each row are stored, and each row group is copied from them into
+    the column without per-row allocation.
+
+    NativeType must be the type of the column, casting is not available.
+    Use uint8_t for binary columns, see BinaryColumnBuffer. Variable-length
+    lists are available for the integer and floating point types.
+
+    Args:
+        buffer      --> Offsets and values of the column. The row count of
+                        the buffer must be at least the maximum intended
+                        row group size, as for the vectors passed to
+                        SetMemoryLocation(std::vector).
+        fieldName   --> Name of the column
+
+    Return:
+        True if successful, false if fieldName was not added previously
+        with AddField, is not a variable-length column or NativeType is
+        not the type of the column.
+    */
+    template <typename NativeType>
+    bool SetMemoryLocation(ListColumnBuffer<NativeType>& buffer,
+                           const std::string& fieldName)
+    {
+        return SetListMemLoc(buffer.offsets, &buffer.values, typeid(NativeType).name(),
+                             fieldName);
+    }
+
+    /*
+    Virtual function called by SetMemoryLocation(ListColumnBuffer).
+    Facilitates mocking.
+
+    Args:
+        offsets     --> ListColumnBuffer offsets
+        values      --> ListColumnBuffer values, std::vector of the type
+                        identified by typeID
+        typeID      --> typeid(NativeType).name()
+        fieldName   --> Name of the column
+    */
+    virtual bool SetListMemLoc(std::vector<int32_t>& offsets, void* values,
+                               const std::string& typeID, const std::string& fieldName);
+
     /*
 		Creates the parquet file with an initial schema
 		specified by AddField calls.
@@ -401,6 +732,19 @@ class ParquetContext
     */
     virtual void EnableEmptyFileDeletion(const std::string& path);
 
+    /*
+        Write row groups with the parquet column writers directly from the
+        buffers set by SetMemoryLocation, rather than by copying each
+        buffer into an Arrow builder and writing the finished arrays as a
+        table. Definition and repetition levels are generated for list
+        and null values. The file schema is converted from the same
+        Arrow schema, such that the output is read back with the same
+        column types. Must be called before OpenForWrite.
+
+        Return:     False if OpenForWrite has been called, otherwise true.
+    */
+    bool EnableDirectWrite();
+
     /*
 
 		Function to be called after the buffers are filled for the current row.
@@ -436,6 +780,33 @@ class ParquetContext
 	*/
     virtual bool IncrementAndWrite(const uint16_t& thread_id = 0);
 
+    /*
+    Same as IncrementAndWrite for a batch of rows which have been filled
+    at indices append_count_ through append_count_ + row_count - 1. The
+    caller must not fill beyond the buffer, see GetAvailableRowCount.
+
+    Args:
+        row_count   --> Count of rows filled, not greater than
+                        GetAvailableRowCount()
+        thread_id   --> Optional index of current thread
+
+    Return:
+        True if the data row group(s) were written and false otherwise,
+        including if row_count exceeds the available row count, in which
+        case no rows are added.
+    */
+    virtual bool IncrementAndWriteRows(size_t row_count, const uint16_t& thread_id = 0);
+
+    /*
+    Get the count of rows which may be filled before the buffers are
+    written, i.e., the maximum row_count for IncrementAndWriteRows.
+    Zero if SetupRowCountTracking has not been called.
+    */
+    size_t GetAvailableRowCount() const
+    {
+        return max_temp_element_count_ - appended_row_count_;
+    }
+
     /*
 
 		Write the data remaining in the buffers to disk. Generally used prior to closing
@@ -470,106 +841,143 @@ class ParquetContext
         std::map<std::string, ColumnData>& col_data_map, ColumnData*& col_data);
 };
 
-template <typename T, typename A>
-void ParquetContext::Append(const bool& isList,
-                            const bool& castRequired,
-                            const int& listCount,
-                            const int& offset,
-                            const ColumnData& columnData)
+template <typename T, typename B>
+bool ParquetContext::Append(ColumnData& columnData, const int offset)
 {
-    if (isList)
+    const T* data = static_cast<const T*>(columnData.data_);
+    if (columnData.is_list_)
     {
-        // Get the relevant builder for the data type.
-        std::shared_ptr<arrow::ListBuilder> bldr =
-            std::dynamic_pointer_cast<arrow::ListBuilder>(columnData.builder_);
+        arrow::ListBuilder* bldr = static_cast<arrow::ListBuilder*>(columnData.builder_.get());
+        B* sub_bldr = static_cast<B*>(bldr->value_builder());
+        const int listCount = columnData.list_size_;
+        const int count = append_row_count_ * listCount;
 
         // Resize array to allocate space and append data.
         bldr->Resize(append_row_count_);
 
-        // Resize the global cast vector to the minimum size needed
-        // in bytes
-        if (cast_vec_.size() < (append_row_count_ * listCount * sizeof(T)))
-            cast_vec_.resize(append_row_count_ * listCount * sizeof(T));
+        // Offsets of fixed-size rows, relative to the values already in
+        // the value builder
+        if (list_offsets_.size() < static_cast<size_t>(append_row_count_))
+            list_offsets_.resize(append_row_count_);
+        int32_t first = static_cast<int32_t>(sub_bldr->length());
+        for (int i = 0; i < append_row_count_; i++)
+            list_offsets_[i] = first + i * listCount;
+        bldr->AppendValues(list_offsets_.data(), append_row_count_);
 
-        if (castRequired)
+        if (columnData.cast_func_ != nullptr)
         {
-            std::vector<int32_t> offsets_vec =
-                GetOffsetsVector(append_row_count_, listCount, 0);
-
-            bldr->AppendValues(offsets_vec.data(), append_row_count_);
-
-            A* sub_bldr =
-                static_cast<A*>(bldr->value_builder());
-
-            columnData.GetInputData()->CopyToCompatible(
-                reinterpret_cast<T*>(cast_vec_.data()),
-                append_row_count_ * listCount, offset*listCount);
-
-            sub_bldr->AppendValues(reinterpret_cast<T*>(cast_vec_.data()),
-                                   append_row_count_ * listCount);
+            // Resize the global cast vector to the minimum size needed
+            // in bytes
+            if (cast_vec_.size() < (count * sizeof(T)))
+                cast_vec_.resize(count * sizeof(T));
+            columnData.cast_func_(columnData.data_, cast_vec_.data(), count,
+                                  offset * listCount);
+            sub_bldr->AppendValues(reinterpret_cast<const T*>(cast_vec_.data()), count);
         }
         else
-        {
-            std::vector<int32_t> offsets_vec =
-                GetOffsetsVector(append_row_count_, listCount, 0);
-
-            bldr->AppendValues(offsets_vec.data(), append_row_count_);
-            A* sub_bldr =
-                static_cast<A*>(bldr->value_builder());
-            sub_bldr->AppendValues(reinterpret_cast<T*>(columnData.data_) + (offset * listCount),
-                                   append_row_count_ * listCount);
-        }
+            sub_bldr->AppendValues(data + offset * listCount, count);
     }
     else
     {
-        std::shared_ptr<A> bldr =
-            std::dynamic_pointer_cast<A>(columnData.builder_);
+        B* bldr = static_cast<B*>(columnData.builder_.get());
 
         // Resize array to allocate space and append data.
         bldr->Resize(append_row_count_);
 
-        // Resize the global cast vector to the minimum size needed
-        // in bytes
-        if (cast_vec_.size() < (append_row_count_ * sizeof(T)))
-            cast_vec_.resize(append_row_count_ * sizeof(T));
-
-        if (columnData.null_values_ == nullptr)
+        if (columnData.cast_func_ != nullptr)
         {
-            if (castRequired)
-            {
-                columnData.GetInputData()->CopyToCompatible(
-                    reinterpret_cast<T*>(cast_vec_.data()),
-                    append_row_count_, offset);
-
-                bldr->AppendValues(reinterpret_cast<T*>(cast_vec_.data()),
-                                   append_row_count_);
-            }
-            else
-            {
-                bldr->AppendValues(reinterpret_cast<T*>(columnData.data_) + offset,
-                                   append_row_count_);
-            }
+            if (cast_vec_.size() < (append_row_count_ * sizeof(T)))
+                cast_vec_.resize(append_row_count_ * sizeof(T));
+            columnData.cast_func_(columnData.data_, cast_vec_.data(), append_row_count_,
+                                  offset);
+            data = reinterpret_cast<const T*>(cast_vec_.data());
         }
         else
-        {
-            if (castRequired)
-            {
-                columnData.GetInputData()->CopyToCompatible(
-                    reinterpret_cast<T*>(cast_vec_.data()),
-                    append_row_count_, offset);
-
-                bldr->AppendValues(reinterpret_cast<T*>(cast_vec_.data()),
-                                   append_row_count_,
-                                   columnData.null_values_->data() + offset);
-            }
-            else
-                bldr->AppendValues(reinterpret_cast<T*>(columnData.data_) + offset,
-                                   append_row_count_,
-                                   columnData.null_values_->data() + offset);
-        }
+            data += offset;
+
+        if (columnData.null_values_ == nullptr)
+            bldr->AppendValues(data, append_row_count_);
+        else
+            bldr->AppendValues(data, append_row_count_,
+                               columnData.null_values_->data() + offset);
+    }
+    return true;
+}
+
+template <typename From>
+CastFunc ParquetContext::GetCastFunc(arrow::Type::type to)
+{
+    switch (to)
+    {
+        case arrow::Type::INT64:
+            return &CastCopy<From, int64_t>;
+        case arrow::Type::INT32:
+            return &CastCopy<From, int32_t>;
+        case arrow::Type::INT16:
+            return &CastCopy<From, int16_t>;
+        case arrow::Type::INT8:
+            return &CastCopy<From, int8_t>;
+        default:
+            return nullptr;
     }
 }
 
+template <typename ArrowType, typename NativeType>
+ParquetColumnHandle<ArrowType, NativeType> ParquetContext::AddColumn(
+    std::vector<NativeType>& data, const std::string& fieldName, int listSize,
+    std::vector<uint8_t>* boolField)
+{
+    static_assert(std::is_same<NativeType, typename ParquetNativeType<ArrowType>::type>::value,
+                  "NativeType must be the native type of ArrowType");
+    static_assert(!std::is_unsigned<NativeType>::value ||
+                  std::is_same<ArrowType, arrow::BooleanType>::value,
+                  "Unsigned types are not available for writing parquet");
+
+    int index = static_cast<int>(columns_.size());
+    if (!AddField(arrow::TypeTraits<ArrowType>::type_singleton(), fieldName, listSize))
+        return ParquetColumnHandle<ArrowType, NativeType>();
+
+    if (!SetMemoryLocation(data, fieldName, boolField))
+        return ParquetColumnHandle<ArrowType, NativeType>();
+
+    return ParquetColumnHandle<ArrowType, NativeType>(index);
+}
+
+template <typename ArrowType, typename NativeType>
+ParquetColumnHandle<ArrowType, NativeType> ParquetContext::AddColumn(
+    ListColumnBuffer<NativeType>& buffer, const std::string& fieldName)
+{
+    static_assert(std::is_same<NativeType, typename ParquetNativeType<ArrowType>::type>::value,
+                  "NativeType must be the native type of ArrowType");
+    static_assert(!std::is_unsigned<NativeType>::value ||
+                  std::is_same<ArrowType, arrow::BinaryType>::value,
+                  "Unsigned types are not available for writing parquet");
+
+    int index = static_cast<int>(columns_.size());
+    int listSize = std::is_same<ArrowType, arrow::BinaryType>::value ? 0 : VARIABLE_LIST_SIZE;
+    if (!AddField(arrow::TypeTraits<ArrowType>::type_singleton(), fieldName, listSize))
+        return ParquetColumnHandle<ArrowType, NativeType>();
+
+    if (!SetMemoryLocation(buffer, fieldName))
+        return ParquetColumnHandle<ArrowType, NativeType>();
+
+    return ParquetColumnHandle<ArrowType, NativeType>(index);
+}
+
+template <typename ArrowType, typename NativeType>
+bool ParquetContext::SetMemoryLocation(const ParquetColumnHandle<ArrowType, NativeType>& column,
+                                       std::vector<NativeType>& data,
+                                       std::vector<uint8_t>* boolField)
+{
+    if (!column.IsValid() || column.GetIndex() >= static_cast<int>(columns_.size()))
+    {
+        SPDLOG_CRITICAL("Invalid column handle, index {:d}", column.GetIndex());
+        parquet_stop_ = true;
+        return false;
+    }
+    return SetColumnMemoryLocation(data, columns_[column.GetIndex()].column, boolField);
+}
+
 template <>
 inline bool ParquetContext::SetMemoryLocation(std::vector<int64_t>& data,
                                        const std::string& fieldName,
@@ -623,158 +1031,142 @@ bool ParquetContext::SetMemoryLocation(std::vector<NativeType>& data,
                                        const std::string& fieldName,
                                        std::vector<uint8_t>* boolField)
 {
-    for (std::map<std::string, ColumnData>::iterator
-             it = column_data_map_.begin();
-         it != column_data_map_.end();
-         ++it)
+    ColumnData* col_data = nullptr;
+    if (!GetColumnDataByField(fieldName, column_data_map_, col_data))
+        return false;
+
+    return SetColumnMemoryLocation(data, col_data, boolField);
+}
+
+template <typename T, typename B>
+bool ParquetContext::AppendVariableList(ColumnData& columnData, const int offset)
+{
+    arrow::ListBuilder* bldr = static_cast<arrow::ListBuilder*>(columnData.builder_.get());
+    B* value_bldr = static_cast<B*>(bldr->value_builder());
+
+    const int32_t* offsets = columnData.offsets_->data() + offset;
+    const T* values = static_cast<const std::vector<T>*>(columnData.values_)->data();
+
+    // Offsets of the buffer are relative to the first row of the buffer
+    // and list offsets to the values already in the value builder.
+    if (list_offsets_.size() < static_cast<size_t>(append_row_count_))
+        list_offsets_.resize(append_row_count_);
+    int32_t shift = static_cast<int32_t>(value_bldr->length()) - offsets[0];
+    for (int i = 0; i < append_row_count_; i++)
+        list_offsets_[i] = offsets[i] + shift;
+
+    bldr->AppendValues(list_offsets_.data(), append_row_count_);
+    value_bldr->AppendValues(values + offsets[0], offsets[append_row_count_] - offsets[0]);
+    return true;
+}
+
+template <typename T, typename C>
+const C* ParquetContext::GetPhysicalValues(const T* values, int count)
+{
+    if constexpr (std::is_same<T, C>::value)
+        return values;
+    else
+    {
+        // Widen int8_t and int16_t to the INT32 physical type and
+        // boolean bytes to bool.
+        if (physical_vec_.size() < count * sizeof(C))
+            physical_vec_.resize(count * sizeof(C));
+        C* physical = reinterpret_cast<C*>(physical_vec_.data());
+        for (int i = 0; i < count; i++)
+            physical[i] = static_cast<C>(values[i]);
+        return physical;
+    }
+}
+
+template <typename T, typename PT>
+bool ParquetContext::WriteValues(ColumnData& columnData, parquet::ColumnWriter* writer,
+                                 const int offset)
+{
+    typedef typename PT::c_type C;
+    parquet::TypedColumnWriter<PT>* typed_writer =
+        static_cast<parquet::TypedColumnWriter<PT>*>(writer);
+    const int16_t max_def = writer->descr()->max_definition_level();
+    const int list_size = columnData.is_list_ ? columnData.list_size_ : 1;
+    const int count = append_row_count_ * list_size;
+
+    const T* values = static_cast<const T*>(columnData.data_) + offset * list_size;
+    if (columnData.cast_func_ != nullptr)
+    {
+        if (cast_vec_.size() < (count * sizeof(T)))
+            cast_vec_.resize(count * sizeof(T));
+        columnData.cast_func_(columnData.data_, cast_vec_.data(), count, offset * list_size);
+        values = reinterpret_cast<const T*>(cast_vec_.data());
+    }
+    const C* physical = GetPhysicalValues<T, C>(values, count);
+
+    if (columnData.is_list_)
+    {
+        FillFixedListLevels(append_row_count_, list_size, max_def);
+        typed_writer->WriteBatch(count, def_levels_.data(), rep_levels_.data(), physical);
+    }
+    else if (columnData.null_values_ != nullptr)
+    {
+        // Null rows are skipped by the validity bitmap, such that values
+        // are written in place without compaction.
+        FillNullLevels(columnData.null_values_->data() + offset, append_row_count_, max_def);
+        typed_writer->WriteBatchSpaced(append_row_count_, def_levels_.data(), nullptr,
+                                       valid_bits_.data(), 0, physical);
+    }
+    else
+    {
+        if (def_levels_.size() < static_cast<size_t>(count))
+            def_levels_.resize(count);
+        std::fill(def_levels_.begin(), def_levels_.begin() + count, max_def);
+        typed_writer->WriteBatch(count, def_levels_.data(), nullptr, physical);
+    }
+    return true;
+}
+
+template <typename T, typename PT>
+bool ParquetContext::WriteVariableList(ColumnData& columnData, parquet::ColumnWriter* writer,
+                                       const int offset)
+{
+    typedef typename PT::c_type C;
+    parquet::TypedColumnWriter<PT>* typed_writer =
+        static_cast<parquet::TypedColumnWriter<PT>*>(writer);
+    const int32_t* offsets = columnData.offsets_->data() + offset;
+    const T* values = static_cast<const std::vector<T>*>(columnData.values_)->data();
+    const int count = offsets[append_row_count_] - offsets[0];
+
+    // Values are defined at the max definition level. An empty row is a
+    // single level at which the list, but neither the repeated group nor
+    // the optional element, is defined.
+    const int16_t max_def = writer->descr()->max_definition_level();
+    const int16_t empty_def = max_def - 1 -
+        (writer->descr()->schema_node()->is_optional() ? 1 : 0);
+    const size_t max_levels = static_cast<size_t>(count + append_row_count_);
+    if (def_levels_.size() < max_levels)
+    {
+        def_levels_.resize(max_levels);
+        rep_levels_.resize(max_levels);
+    }
+
+    int64_t level_count = 0;
+    for (int i = 0; i < append_row_count_; i++)
     {
-        if (it->first == fieldName)
+        int32_t row_size = offsets[i + 1] - offsets[i];
+        if (row_size == 0)
         {
-            NativeType a;
-            // If it is a list and boolField is defined
-            // make sure to reset boolField to null since
-            // null lists aren't available
-            if (it->second.is_list_)
-            {
-                // Check that the list size is a multiple of the
-                // vector size provided
-                if (data.size() % it->second.list_size_ != 0)
-                {
-                    SPDLOG_CRITICAL(
-                        "list size specified {:d}"
-                        " is not a multiple of total data length {:d} "
-                        "for column: {:s}",
-                        it->second.list_size_,
-                        data.size(),
-                        fieldName);
-                    parquet_stop_ = true;
-                    return false;
-                }
-
-                if (boolField != nullptr)
-                {
-                    SPDLOG_WARN(
-                        "Null fields for lists "
-                        "are currently unavailable: {:s}",
-                        fieldName);
-                    boolField = nullptr;
-                }
-            }
-
-            // The null field vector must be the same size as the
-            // data vector
-            if (boolField != nullptr)
-            {
-                if (boolField->size() != data.size())
-                {
-                    SPDLOG_CRITICAL(
-                        "null field vector must be the "
-                        "same size as data vector: {:s}",
-                        fieldName);
-                    parquet_stop_ = true;
-                    return false;
-                }
-            }
-
-            // Check if ptr is already set
-            if (it->second.pointer_set_)
-            {
-                SPDLOG_WARN("ptr is already set for: {:s}", fieldName);
-            }
-
-            // If casting is required
-            if (typeid(NativeType).name() != it->second.type_ID_)
-            {
-                SPDLOG_WARN("Casting is required for field \"{:s}\"", fieldName);
-                // Check if other types are being written
-                // to or from a string or to boolean from
-                // anything but uint8_t
-                // NativeType is they type being cast FROM and second.type_->id()
-                // is the type being cast TO which is the original arrow type passed
-                // to AddField
-                // Note: It is impossible to stop boolean from being cast
-                // up to a larger type, since NativeType for boolean is uint8_t.
-                // The only way to stop boolean from being cast
-                // up would be to stop all uint8_t from being cast up.
-                // Also note that it->second.type_ID_ is originally retrieved from
-                // ParquetContext::GetTypeIDFromArrowType and every type is as
-                // expected except boolean. Boolean arrow types will result in
-                // uint8_t being assigned to it->second.type_ID_
-                if (it->second.type_->id() == arrow::StringType::type_id ||
-                    typeid(std::string).name() == typeid(NativeType).name() ||
-                    it->second.type_->id() == arrow::BooleanType::type_id)
-                {
-                    SPDLOG_CRITICAL(
-                        "can't cast from other data type "
-                        "to string or bool for: {:s}",
-                        fieldName);
-                    parquet_stop_ = true;
-                    return false;
-                }
-
-                // Cast to larger datatype check
-                if (it->second.byte_size_ < sizeof(a))
-                {
-                    SPDLOG_CRITICAL(
-                        "Intended datatype to be cast "
-                        "is smaller than the given datatype for: {:s}",
-                        fieldName);
-                    parquet_stop_ = true;
-                    return false;
-                }
-
-                // Check if floating point casting is happening
-                if (it->second.type_ID_ == typeid(float).name() ||
-                    it->second.type_ID_ == typeid(double).name() ||
-                    typeid(NativeType).name() == typeid(float).name() ||
-                    typeid(NativeType).name() == typeid(double).name())
-                {
-                    SPDLOG_CRITICAL("Can't cast floating point data types: {:s}",
-                                    fieldName);
-                    parquet_stop_ = true;
-                    return false;
-                }
-
-                // Equal size datatypes check
-                if (it->second.byte_size_ == sizeof(a))
-                {
-                    SPDLOG_DEBUG(
-                        "Intended datatype to "
-                        "be cast is equal to the casting type for: {:s}",
-                        fieldName);
-                }
-
-                it->second.SetColumnData(data.data(),
-                                         fieldName,
-                                         typeid(NativeType).name(),
-                                         boolField,
-                                         static_cast<int>(data.size()));
-
-                SPDLOG_DEBUG("Cast from {:s} planned for: {:s}",
-                             typeid(NativeType).name(),
-                             fieldName);
-            }
-            // Data types are the same and no casting required
-            else
-            {
-                it->second.SetColumnData(data.data(),
-                                         fieldName,
-                                         "",
-                                         boolField,
-                                         static_cast<int>(data.size()));
-            }
-
-            std::shared_ptr<InputDataBase> input_data =
-                std::make_shared<InputData<NativeType>>(data.data());
-            it->second.SetInputData(input_data);
-
-            return true;
+            def_levels_[level_count] = empty_def;
+            rep_levels_[level_count++] = 0;
+            continue;
         }
+        std::fill(def_levels_.begin() + level_count,
+                  def_levels_.begin() + level_count + row_size, max_def);
+        std::fill(rep_levels_.begin() + level_count,
+                  rep_levels_.begin() + level_count + row_size, 1);
+        rep_levels_[level_count] = 0;
+        level_count += row_size;
     }
 
-    SPDLOG_CRITICAL("Field name doesn't exist: {:s}", fieldName);
-    parquet_stop_ = true;
-    return false;
+    typed_writer->WriteBatch(level_count, def_levels_.data(), rep_levels_.data(),
+                             GetPhysicalValues<T, C>(values + offsets[0], count));
+    return true;
 }
 
 template <typename NativeType>
@@ -783,6 +1175,15 @@ bool ParquetContext::SetColumnMemoryLocation(std::vector<NativeType>& data,
                            std::vector<uint8_t>* boolField)
 {
     NativeType a;
+    if (col_data->list_size_ == VARIABLE_LIST_SIZE ||
+        col_data->type_->id() == arrow::BinaryType::type_id)
+    {
+        SPDLOG_CRITICAL("Variable-length column requires a ListColumnBuffer: {:s}",
+            col_data->field_name_);
+        parquet_stop_ = true;
+        return false;
+    }
+
     // If it is a list and boolField is defined
     // make sure to reset boolField to null since
     // null lists aren't available
@@ -878,20 +1279,27 @@ bool ParquetContext::SetColumnMemoryLocation(std::vector<NativeType>& data,
                 col_data->field_name_);
         }
 
-        col_data->SetColumnData(data.data(), col_data->field_name_, typeid(NativeType).name(),
+        // Resolve the conversion once, such that values are converted
+        // without type dispatch for each row group.
+        CastFunc cast_func = GetCastFunc<NativeType>(col_data->type_->id());
+        if (cast_func == nullptr)
+        {
+            SPDLOG_CRITICAL("Casting to type {:s} is not available for: {:s}",
+                col_data->type_->name(), col_data->field_name_);
+            parquet_stop_ = true;
+            return false;
+        }
+
+        col_data->SetColumnData(data.data(), col_data->field_name_, cast_func,
                                     boolField, static_cast<int>(data.size()));
 
         SPDLOG_DEBUG("Cast from {:s} planned for: {:s}", typeid(NativeType).name(), col_data->field_name_);
     }
     // Data types are the same and no casting required
     else
-        col_data->SetColumnData(data.data(), col_data->field_name_, "", boolField, 
+        col_data->SetColumnData(data.data(), col_data->field_name_, nullptr, boolField, 
             static_cast<int>(data.size()));
 
-    std::shared_ptr<InputDataBase> input_data =
-        std::make_shared<InputData<NativeType>>(data.data());
-    col_data->SetInputData(input_data);
-
     return true;
 }
 
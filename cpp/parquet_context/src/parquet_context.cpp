@@ -1,5 +1,7 @@
 #include "parquet_context.h"
 
+const int ParquetContext::VARIABLE_LIST_SIZE = -1;
+
 ParquetContext::ParquetContext() : ROW_GROUP_COUNT_(10000),
                                    have_created_table_(false),
                                    path_(""),
@@ -12,6 +14,8 @@ ParquetContext::ParquetContext() : ROW_GROUP_COUNT_(10000),
                                    port_(-1),
                                    have_created_schema_(false),
                                    writer_(nullptr),
+                                   direct_write_(false),
+                                   file_writer_(nullptr),
                                    parquet_stop_(false),
                                    truncate_(true),
                                    appended_row_count_(0),
@@ -22,7 +26,17 @@ ParquetContext::ParquetContext() : ROW_GROUP_COUNT_(10000),
                                    print_msg_(""),
                                    did_write_columns_(false),
                                    empty_file_deletion_enabled_(false),
+                                   written_row_count_(0),
+                                   written_row_group_count_(0),
+                                   build_time_ns_(0),
+                                   write_time_ns_(0),
+                                   close_time_ns_(0),
                                    row_group_count(ROW_GROUP_COUNT_),
+                                   written_row_count(written_row_count_),
+                                   written_row_group_count(written_row_group_count_),
+                                   build_time_ns(build_time_ns_),
+                                   write_time_ns(write_time_ns_),
+                                   close_time_ns(close_time_ns_),
                                    parquet_stop(parquet_stop_)
 {
 }
@@ -39,6 +53,8 @@ ParquetContext::ParquetContext(int rgSize) : ROW_GROUP_COUNT_(rgSize),
                                              port_(-1),
                                              have_created_schema_(false),
                                              writer_(nullptr),
+                                             direct_write_(false),
+                                             file_writer_(nullptr),
                                              parquet_stop_(false),
                                              truncate_(true),
                                              appended_row_count_(0),
@@ -49,7 +65,17 @@ ParquetContext::ParquetContext(int rgSize) : ROW_GROUP_COUNT_(rgSize),
                                              print_msg_(""),
                                              did_write_columns_(false),
                                              empty_file_deletion_enabled_(false),
+                                             written_row_count_(0),
+                                             written_row_group_count_(0),
+                                             build_time_ns_(0),
+                                             write_time_ns_(0),
+                                             close_time_ns_(0),
                                              row_group_count(ROW_GROUP_COUNT_),
+                                             written_row_count(written_row_count_),
+                                             written_row_group_count(written_row_group_count_),
+                                             build_time_ns(build_time_ns_),
+                                             write_time_ns(write_time_ns_),
+                                             close_time_ns(close_time_ns_),
                                              parquet_stop(parquet_stop_)
 {
 }
@@ -59,6 +85,12 @@ ParquetContext::~ParquetContext()
     Close();
 }
 
+uint64_t ParquetContext::ElapsedNs(const std::chrono::steady_clock::time_point& start)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
 void ParquetContext::Close(const uint16_t& thread_id)
 {
     // If automatic row count tracking and writing
@@ -71,8 +103,22 @@ void ParquetContext::Close(const uint16_t& thread_id)
 
     if (have_created_writer_)
     {
-        writer_->Close();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        if (direct_write_)
+        {
+            try
+            {
+                file_writer_->Close();
+            }
+            catch (const std::exception& e)
+            {
+                SPDLOG_ERROR("ParquetFileWriter::Close error: {:s}", e.what());
+            }
+        }
+        else
+            writer_->Close();
         ostream_->Close();
+        close_time_ns_ += ElapsedNs(start);
         have_created_writer_ = false;
 
         if (ready_for_automatic_tracking_ && !did_write_columns_)
@@ -122,15 +168,12 @@ bool ParquetContext::OpenForWrite(const std::string path, const bool truncate)
     }
 
     // Check to see if all memory locations are set for each column
-    for (std::map<std::string, ColumnData>::iterator
-             it = column_data_map_.begin();
-         it != column_data_map_.end();
-         ++it)
+    for (std::vector<ColumnDesc>::iterator it = columns_.begin(); it != columns_.end(); ++it)
     {
-        if (!it->second.pointer_set_)
+        if (!it->column->pointer_set_)
         {
             SPDLOG_CRITICAL("memory location for field not set: {:s}",
-                            it->second.field_name_);
+                            it->column->field_name_);
             parquet_stop_ = true;
             return false;
         }
@@ -181,6 +224,9 @@ bool ParquetContext::OpenForWrite(const std::string path, const bool truncate)
         props_builder.enable_statistics();
         props_ = props_builder.build();
 
+        if (direct_write_)
+            return OpenDirectWriter();
+
 #ifdef NEWARROW
         std::shared_ptr<parquet::ArrowWriterProperties> arrow_props = 
             parquet::ArrowWriterProperties::Builder().store_schema()->build();
@@ -312,6 +358,8 @@ ParquetContext::GetBuilderFromDataType(const std::shared_ptr<arrow::DataType> dt
             else
                 return std::make_unique<arrow::StringBuilder>(pool_);
         }
+        case arrow::BinaryType::type_id:
+            return std::make_unique<arrow::BinaryBuilder>(pool_);
 
         default:
             return std::make_unique<arrow::NullBuilder>(pool_);
@@ -321,18 +369,10 @@ ParquetContext::GetBuilderFromDataType(const std::shared_ptr<arrow::DataType> dt
 void ParquetContext::CreateBuilders()
 {
     pool_ = arrow::default_memory_pool();
-    arrow::NullType null_type;
-    arrow::Type::type dtype = arrow::Type::NA;
-    for (std::map<std::string, ColumnData>::iterator
-             it = column_data_map_.begin();
-         it != column_data_map_.end();
-         ++it)
+    for (std::vector<ColumnDesc>::iterator it = columns_.begin(); it != columns_.end(); ++it)
     {
-        std::string fieldName = it->second.field_name_;
-        dtype = it->second.type_->id();
-
-        it->second.builder_ = GetBuilderFromDataType(
-            it->second.type_, it->second.is_list_);
+        it->column->builder_ = GetBuilderFromDataType(
+            it->column->type_, it->column->is_list_);
     }
 
 #ifdef NEWARROW
@@ -356,12 +396,12 @@ bool ParquetContext::WriteColsIfReady()
         arrow::ArrayVector arr_vec;
 #endif
         // Loop over the builders and "Finish" them in order.
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
         for (int field_ind = 0; field_ind < schema_->num_fields(); field_ind++)
         {
             std::shared_ptr<arrow::Array> temp_array_ptr;
 
-            st_ = column_data_map_[schema_->field(field_ind)->name()]
-                      .builder_->Finish(&temp_array_ptr);
+            st_ = columns_[field_ind].column->builder_->Finish(&temp_array_ptr);
 
             if (!st_.ok())
             {
@@ -374,7 +414,10 @@ bool ParquetContext::WriteColsIfReady()
 
         // Make the Table and write it.
         std::shared_ptr<arrow::Table> table = arrow::Table::Make(schema_, arr_vec);
+        build_time_ns_ += ElapsedNs(start);
+        start = std::chrono::steady_clock::now();
         st_ = writer_->WriteTable(*table, append_row_count_);
+        write_time_ns_ += ElapsedNs(start);
         if (!st_.ok())
         {
             SPDLOG_ERROR("WriteTable error (ID {:s}): {:s}",
@@ -398,7 +441,9 @@ bool ParquetContext::WriteColsIfReady()
         for (int field_ind = 0; field_ind < schema_->num_fields(); field_ind++)
         {
             std::shared_ptr<arrow::Array> temp_array_ptr;
-            st_ = column_data_map_[schema_->field(field_ind)->name()].builder_->Finish(&temp_array_ptr);
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            st_ = columns_[field_ind].column->builder_->Finish(&temp_array_ptr);
+            build_time_ns_ += ElapsedNs(start);
 
             if (!st_.ok())
             {
@@ -406,7 +451,9 @@ bool ParquetContext::WriteColsIfReady()
                              st_.CodeAsString(), st_.message());
                 return false;
             }
+            start = std::chrono::steady_clock::now();
             st_ = writer_->WriteColumnChunk(*temp_array_ptr);
+            write_time_ns_ += ElapsedNs(start);
             if (!st_.ok())
             {
                 SPDLOG_ERROR("WriteColumnChunk error (ID {:s}): {:s}",
@@ -419,240 +466,373 @@ bool ParquetContext::WriteColsIfReady()
     return true;
 }
 
-bool ParquetContext::AppendColumn(ColumnData& columnData,
-                                  const int& rows,
-                                  const int offset)
+bool ParquetContext::AppendColumn(const ColumnDesc& column, const int offset)
 {
-    int datatypeID = columnData.type_->id();
-    bool isList = columnData.is_list_;
-    bool castRequired;
-
-    if (columnData.cast_from_ == CastFromType::TypeNONE)
-        castRequired = false;
-    else
-    {
-        SPDLOG_WARN("Cast required for column \"{:s}\"",
-            columnData.field_name_);
-        castRequired = true;
-    }
-
-    int listCount = 0;
+    ColumnData& columnData = *column.column;
+    if (!CheckRowRange(columnData, offset))
+        return false;
 
-    if (isList)
-        listCount = columnData.list_size_;
+    if (!(this->*column.append)(columnData, offset))
+        return false;
 
-    SPDLOG_TRACE("AppendColumn(): name {:s}, datatypename {:s}", columnData.field_name_,
-                 columnData.type_->name());
+    // Make note that this column has been updated by setting the relevant bool.
+    columnData.ready_for_write_ = true;
 
-    append_row_count_ = rows;
+    return true;
+}
 
-    if (rows + offset > columnData.initial_max_row_size_)
+bool ParquetContext::CheckRowRange(const ColumnData& columnData, const int offset) const
+{
+    if (append_row_count_ + offset > columnData.initial_max_row_size_)
     {
         SPDLOG_CRITICAL(
             "initial vector does not"
             " contain enough information to write"
             " {:d} rows with a {:d} offset for column {:s}",
-            rows, offset, columnData.type_->name());
+            append_row_count_, offset, columnData.field_name_);
         return false;
     }
+    return true;
+}
 
-    switch (datatypeID)
+ParquetContext::AppendFunc ParquetContext::GetAppendFunc(const ColumnData& columnData)
+{
+    bool variable = columnData.list_size_ == VARIABLE_LIST_SIZE;
+    switch (columnData.type_->id())
     {
         case arrow::Int64Type::type_id:
-        {
-            Append<int64_t, arrow::NumericBuilder<arrow::Int64Type>>(isList,
-                                                                     castRequired,
-                                                                     listCount,
-                                                                     offset,
-                                                                     columnData);
-            break;
-        }
+            if (variable)
+                return &ParquetContext::AppendVariableList<int64_t, arrow::Int64Builder>;
+            return &ParquetContext::Append<int64_t, arrow::Int64Builder>;
+        case arrow::Int32Type::type_id:
+            if (variable)
+                return &ParquetContext::AppendVariableList<int32_t, arrow::Int32Builder>;
+            return &ParquetContext::Append<int32_t, arrow::Int32Builder>;
+        case arrow::Int16Type::type_id:
+            if (variable)
+                return &ParquetContext::AppendVariableList<int16_t, arrow::Int16Builder>;
+            return &ParquetContext::Append<int16_t, arrow::Int16Builder>;
+        case arrow::Int8Type::type_id:
+            if (variable)
+                return &ParquetContext::AppendVariableList<int8_t, arrow::Int8Builder>;
+            return &ParquetContext::Append<int8_t, arrow::Int8Builder>;
+        case arrow::DoubleType::type_id:
+            if (variable)
+                return &ParquetContext::AppendVariableList<double, arrow::DoubleBuilder>;
+            return &ParquetContext::Append<double, arrow::DoubleBuilder>;
+        case arrow::FloatType::type_id:
+            if (variable)
+                return &ParquetContext::AppendVariableList<float, arrow::FloatBuilder>;
+            return &ParquetContext::Append<float, arrow::FloatBuilder>;
+        case arrow::BooleanType::type_id:
+            return &ParquetContext::Append<uint8_t, arrow::BooleanBuilder>;
+        case arrow::StringType::type_id:
+            return &ParquetContext::AppendStrings;
+        case arrow::BinaryType::type_id:
+            return &ParquetContext::AppendBinary;
+        default:
+            return nullptr;
+    }
+}
 
-        case arrow::UInt64Type::type_id:
+bool ParquetContext::AppendStrings(ColumnData& columnData, const int offset)
+{
+    int listCount = columnData.list_size_;
+    if (columnData.is_list_)
+    {
+        // Get the relevant builder for the data type.
+        arrow::ListBuilder* bldr = static_cast<arrow::ListBuilder*>(columnData.builder_.get());
+
+        // Resize array to allocate space and append data.
+        bldr->Resize(append_row_count_);
+
+        std::vector<int32_t> offsets_vec =
+            GetOffsetsVector(append_row_count_, listCount, 0);
+
+        bldr->AppendValues(offsets_vec.data(), append_row_count_);
+        arrow::StringBuilder* sub_bldr =
+            static_cast<arrow::StringBuilder*>(bldr->value_builder());
+
+        // The only way to convey to Arrow the row count for the
+        // StringBuilder class is via the implicit vector size.
+        //
+        // If the desired append row count is not equivalent
+        // to initial_max_row_size_, a new string vector is built
+        // with a size consistent with the desired row count.
+        // For lists initial_max_row_size_ = initial vector size / list size
+        // For non list columns initial_max_row_size_ = initial vector size
+        if (append_row_count_ == columnData.initial_max_row_size_)
         {
-            Append<uint64_t, arrow::NumericBuilder<arrow::UInt64Type>>(isList,
-                                                                       castRequired,
-                                                                       listCount,
-                                                                       offset,
-                                                                       columnData);
-            break;
+            sub_bldr->AppendValues(*columnData.str_ptr_);
         }
-
-        case arrow::Int32Type::type_id:
+        else
         {
-            Append<int32_t, arrow::NumericBuilder<arrow::Int32Type>>(isList,
-                                                                     castRequired,
-                                                                     listCount,
-                                                                     offset,
-                                                                     columnData);
-            break;
-        }
+            FillStringVec(columnData.str_ptr_,
+                          append_row_count_ * listCount,
+                          offset * listCount);
 
-        case arrow::UInt32Type::type_id:
-        {
-            Append<uint32_t, arrow::NumericBuilder<arrow::UInt32Type>>(isList,
-                                                                       castRequired,
-                                                                       listCount,
-                                                                       offset,
-                                                                       columnData);
-            break;
+            sub_bldr->AppendValues(temp_string_vec_);
         }
+    }
+    else
+    {
+        arrow::StringBuilder* bldr =
+            static_cast<arrow::StringBuilder*>(columnData.builder_.get());
 
-        case arrow::Int16Type::type_id:
-        {
-            Append<int16_t, arrow::NumericBuilder<arrow::Int16Type>>(isList,
-                                                                     castRequired,
-                                                                     listCount,
-                                                                     offset,
-                                                                     columnData);
-            break;
-        }
+        // Resize array to allocate space and append data.
+        bldr->Resize(append_row_count_);
 
-        case arrow::UInt16Type::type_id:
+        if (append_row_count_ == columnData.initial_max_row_size_)
         {
-            Append<uint16_t, arrow::NumericBuilder<arrow::UInt16Type>>(isList,
-                                                                       castRequired,
-                                                                       listCount,
-                                                                       offset,
-                                                                       columnData);
-            break;
+            if (columnData.null_values_ == nullptr)
+            {
+                bldr->AppendValues(*columnData.str_ptr_);
+            }
+            else
+            {
+                bldr->AppendValues(*columnData.str_ptr_, columnData.null_values_->data() + offset);
+            }
         }
-
-        case arrow::Int8Type::type_id:
+        else
         {
-            Append<int8_t, arrow::NumericBuilder<arrow::Int8Type>>(isList,
-                                                                   castRequired,
-                                                                   listCount,
-                                                                   offset,
-                                                                   columnData);
-            break;
+            FillStringVec(columnData.str_ptr_, append_row_count_, offset);
+            if (columnData.null_values_ == nullptr)
+            {
+                bldr->AppendValues(temp_string_vec_);
+            }
+            else
+            {
+                bldr->AppendValues(temp_string_vec_, columnData.null_values_->data() + offset);
+            }
         }
+    }
+    return true;
+}
 
-        case arrow::UInt8Type::type_id:
-        {
-            Append<uint8_t, arrow::NumericBuilder<arrow::UInt8Type>>(isList,
-                                                                     castRequired,
-                                                                     listCount,
-                                                                     offset,
-                                                                     columnData);
-            break;
-        }
+bool ParquetContext::AppendBinary(ColumnData& columnData, const int offset)
+{
+    arrow::BinaryBuilder* bldr = static_cast<arrow::BinaryBuilder*>(columnData.builder_.get());
+
+    // Reserve the row group once and copy each value from the
+    // contiguous values buffer.
+    const int32_t* offsets = columnData.offsets_->data() + offset;
+    const uint8_t* values =
+        static_cast<const std::vector<uint8_t>*>(columnData.values_)->data();
+    bldr->Reserve(append_row_count_);
+    bldr->ReserveData(offsets[append_row_count_] - offsets[0]);
+    for (int i = 0; i < append_row_count_; i++)
+        bldr->UnsafeAppend(values + offsets[i], offsets[i + 1] - offsets[i]);
+    return true;
+}
 
+ParquetContext::WriteFunc ParquetContext::GetWriteFunc(const ColumnData& columnData)
+{
+    bool variable = columnData.list_size_ == VARIABLE_LIST_SIZE;
+    switch (columnData.type_->id())
+    {
+        case arrow::Int64Type::type_id:
+            if (variable)
+                return &ParquetContext::WriteVariableList<int64_t, parquet::Int64Type>;
+            return &ParquetContext::WriteValues<int64_t, parquet::Int64Type>;
+        case arrow::Int32Type::type_id:
+            if (variable)
+                return &ParquetContext::WriteVariableList<int32_t, parquet::Int32Type>;
+            return &ParquetContext::WriteValues<int32_t, parquet::Int32Type>;
+        case arrow::Int16Type::type_id:
+            if (variable)
+                return &ParquetContext::WriteVariableList<int16_t, parquet::Int32Type>;
+            return &ParquetContext::WriteValues<int16_t, parquet::Int32Type>;
+        case arrow::Int8Type::type_id:
+            if (variable)
+                return &ParquetContext::WriteVariableList<int8_t, parquet::Int32Type>;
+            return &ParquetContext::WriteValues<int8_t, parquet::Int32Type>;
         case arrow::DoubleType::type_id:
-        {
-            castRequired = false;
-            Append<double, arrow::NumericBuilder<arrow::DoubleType>>(isList,
-                                                                     castRequired,
-                                                                     listCount,
-                                                                     offset,
-                                                                     columnData);
-            break;
-        }
-
+            if (variable)
+                return &ParquetContext::WriteVariableList<double, parquet::DoubleType>;
+            return &ParquetContext::WriteValues<double, parquet::DoubleType>;
         case arrow::FloatType::type_id:
-        {
-            castRequired = false;
-            Append<float, arrow::NumericBuilder<arrow::FloatType>>(isList,
-                                                                   castRequired,
-                                                                   listCount,
-                                                                   offset,
-                                                                   columnData);
-            break;
-        }
-
+            if (variable)
+                return &ParquetContext::WriteVariableList<float, parquet::FloatType>;
+            return &ParquetContext::WriteValues<float, parquet::FloatType>;
         case arrow::BooleanType::type_id:
+            return &ParquetContext::WriteValues<uint8_t, parquet::BooleanType>;
+        case arrow::StringType::type_id:
+            return &ParquetContext::WriteStrings;
+        case arrow::BinaryType::type_id:
+            return &ParquetContext::WriteBinary;
+        default:
+            return nullptr;
+    }
+}
+
+void ParquetContext::FillFixedListLevels(int rows, int list_size, int16_t max_def)
+{
+    size_t count = static_cast<size_t>(rows) * list_size;
+    if (def_levels_.size() < count)
+    {
+        def_levels_.resize(count);
+        rep_levels_.resize(count);
+    }
+    std::fill(def_levels_.begin(), def_levels_.begin() + count, max_def);
+    std::fill(rep_levels_.begin(), rep_levels_.begin() + count, 1);
+    for (size_t i = 0; i < count; i += list_size)
+        rep_levels_[i] = 0;
+}
+
+void ParquetContext::FillNullLevels(const uint8_t* null_values, int rows, int16_t max_def)
+{
+    if (def_levels_.size() < static_cast<size_t>(rows))
+        def_levels_.resize(rows);
+    valid_bits_.assign((rows + 7) / 8, 0);
+    for (int i = 0; i < rows; i++)
+    {
+        if (null_values[i])
         {
-            castRequired = false;
-            Append<uint8_t, arrow::BooleanBuilder>(isList,
-                                                   castRequired,
-                                                   listCount,
-                                                   offset,
-                                                   columnData);
-            break;
+            def_levels_[i] = max_def;
+            valid_bits_[i / 8] |= static_cast<uint8_t>(1 << (i % 8));
         }
+        else
+            def_levels_[i] = max_def - 1;
+    }
+}
 
-        case arrow::StringType::type_id:
-        {
-            if (isList)
-            {
-                // Get the relevant builder for the data type.
-                std::shared_ptr<arrow::ListBuilder> bldr =
-                    std::dynamic_pointer_cast<arrow::ListBuilder>(columnData.builder_);
-
-                // Resize array to allocate space and append data.
-                bldr->Resize(append_row_count_);
-
-                std::vector<int32_t> offsets_vec =
-                    GetOffsetsVector(append_row_count_, listCount, 0);
-
-                bldr->AppendValues(offsets_vec.data(), append_row_count_);
-                arrow::StringBuilder* sub_bldr =
-                    static_cast<arrow::StringBuilder*>(bldr->value_builder());
-
-                // The only way to convey to Arrow the row count for the
-                // StringBuilder class is via the implicit vector size.
-                //
-                // If the desired append row count is not equivalent
-                // to initial_max_row_size_, a new string vector is built
-                // with a size consistent with the desired row count.
-                // For lists initial_max_row_size_ = initial vector size / list size
-                // For non list columns initial_max_row_size_ = initial vector size
-                if (append_row_count_ == columnData.initial_max_row_size_)
-                {
-                    sub_bldr->AppendValues(*columnData.str_ptr_);
-                }
-                else
-                {
-                    FillStringVec(columnData.str_ptr_,
-                                  append_row_count_ * listCount,
-                                  offset * listCount);
+bool ParquetContext::WriteBinary(ColumnData& columnData, parquet::ColumnWriter* writer,
+                                 const int offset)
+{
+    parquet::ByteArrayWriter* typed_writer = static_cast<parquet::ByteArrayWriter*>(writer);
+    const int32_t* offsets = columnData.offsets_->data() + offset;
+    const uint8_t* values =
+        static_cast<const std::vector<uint8_t>*>(columnData.values_)->data();
+
+    // Byte arrays refer to the values buffer without copy.
+    if (byte_array_vec_.size() < static_cast<size_t>(append_row_count_))
+        byte_array_vec_.resize(append_row_count_);
+    for (int i = 0; i < append_row_count_; i++)
+        byte_array_vec_[i] = parquet::ByteArray(
+            static_cast<uint32_t>(offsets[i + 1] - offsets[i]), values + offsets[i]);
+
+    if (def_levels_.size() < static_cast<size_t>(append_row_count_))
+        def_levels_.resize(append_row_count_);
+    std::fill(def_levels_.begin(), def_levels_.begin() + append_row_count_,
+              writer->descr()->max_definition_level());
+    typed_writer->WriteBatch(append_row_count_, def_levels_.data(), nullptr,
+                             byte_array_vec_.data());
+    return true;
+}
 
-                    sub_bldr->AppendValues(temp_string_vec_);
-                }
-            }
-            else
-            {
-                std::shared_ptr<arrow::StringBuilder> bldr =
-                    std::dynamic_pointer_cast<arrow::StringBuilder>(columnData.builder_);
+bool ParquetContext::WriteStrings(ColumnData& columnData, parquet::ColumnWriter* writer,
+                                  const int offset)
+{
+    parquet::ByteArrayWriter* typed_writer = static_cast<parquet::ByteArrayWriter*>(writer);
+    const int16_t max_def = writer->descr()->max_definition_level();
+    const int list_size = columnData.is_list_ ? columnData.list_size_ : 1;
+    const int count = append_row_count_ * list_size;
+
+    if (byte_array_vec_.size() < static_cast<size_t>(count))
+        byte_array_vec_.resize(count);
+    const std::string* strings = columnData.str_ptr_->data() + offset * list_size;
+    for (int i = 0; i < count; i++)
+        byte_array_vec_[i] = parquet::ByteArray(static_cast<uint32_t>(strings[i].size()),
+            reinterpret_cast<const uint8_t*>(strings[i].data()));
+
+    if (columnData.is_list_)
+    {
+        FillFixedListLevels(append_row_count_, list_size, max_def);
+        typed_writer->WriteBatch(count, def_levels_.data(), rep_levels_.data(),
+                                 byte_array_vec_.data());
+    }
+    else if (columnData.null_values_ != nullptr)
+    {
+        FillNullLevels(columnData.null_values_->data() + offset, append_row_count_, max_def);
+        typed_writer->WriteBatchSpaced(append_row_count_, def_levels_.data(), nullptr,
+                                       valid_bits_.data(), 0, byte_array_vec_.data());
+    }
+    else
+    {
+        if (def_levels_.size() < static_cast<size_t>(count))
+            def_levels_.resize(count);
+        std::fill(def_levels_.begin(), def_levels_.begin() + count, max_def);
+        typed_writer->WriteBatch(count, def_levels_.data(), nullptr, byte_array_vec_.data());
+    }
+    return true;
+}
 
-                // Resize array to allocate space and append data.
-                bldr->Resize(append_row_count_);
+bool ParquetContext::OpenDirectWriter()
+{
+    // Convert the schema and metadata with the same properties as the
+    // Arrow writer of OpenForWrite, such that files written by either
+    // path are read with the same schema.
+#ifdef NEWARROW
+    std::shared_ptr<parquet::ArrowWriterProperties> arrow_props =
+        parquet::ArrowWriterProperties::Builder().store_schema()->build();
+#else
+    std::shared_ptr<parquet::arrow::ArrowWriterProperties> arrow_props =
+        parquet::arrow::ArrowWriterProperties::Builder().build();
+#endif
 
-                if (append_row_count_ == columnData.initial_max_row_size_)
-                {
-                    if (columnData.null_values_ == nullptr)
-                    {
-                        bldr->AppendValues(*columnData.str_ptr_);
-                    }
-                    else
-                    {
-                        bldr->AppendValues(*columnData.str_ptr_, columnData.null_values_->data() + offset);
-                    }
-                }
-                else
-                {
-                    FillStringVec(columnData.str_ptr_, append_row_count_, offset);
-                    if (columnData.null_values_ == nullptr)
-                    {
-                        bldr->AppendValues(temp_string_vec_);
-                    }
-                    else
-                    {
-                        bldr->AppendValues(temp_string_vec_, columnData.null_values_->data() + offset);
-                    }
-                }
-            }
-            break;
-        }
-        default:
-            SPDLOG_CRITICAL("Data type not included: {:s}", columnData.type_->name());
-            return false;
-            break;
+    std::shared_ptr<parquet::SchemaDescriptor> parquet_schema;
+    st_ = parquet::arrow::ToParquetSchema(schema_.get(), *props_, *arrow_props,
+                                          &parquet_schema);
+    if (!st_.ok())
+    {
+        SPDLOG_CRITICAL("parquet::arrow::ToParquetSchema error (ID {:s}): {:s}",
+                        st_.CodeAsString(), st_.message());
+        return false;
     }
 
-    // Make note that this column has been updated by setting the relevant bool.
-    columnData.ready_for_write_ = true;
+    std::shared_ptr<arrow::KeyValueMetadata> metadata = (schema_->metadata() == nullptr) ?
+        std::make_shared<arrow::KeyValueMetadata>() : schema_->metadata()->Copy();
+#ifdef NEWARROW
+    // Serialized Arrow schema, as stored by parquet::arrow::FileWriter
+    arrow::Result<std::shared_ptr<arrow::Buffer>> serialized =
+        arrow::ipc::SerializeSchema(*schema_, pool_);
+    if (!serialized.ok())
+    {
+        SPDLOG_CRITICAL("arrow::ipc::SerializeSchema error (ID {:s}): {:s}",
+                        serialized.status().CodeAsString(), serialized.status().message());
+        return false;
+    }
+    metadata->Append("ARROW:schema",
+                     arrow::util::base64_encode((*serialized)->ToString()));
+#endif
 
+    try
+    {
+        file_writer_ = parquet::ParquetFileWriter::Open(ostream_,
+            std::static_pointer_cast<parquet::schema::GroupNode>(parquet_schema->schema_root()),
+            props_, metadata);
+    }
+    catch (const std::exception& e)
+    {
+        SPDLOG_CRITICAL("parquet::ParquetFileWriter::Open error: {:s}", e.what());
+        return false;
+    }
+    have_created_writer_ = true;
+    return true;
+}
+
+bool ParquetContext::WriteRowGroupDirect(const int offset)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // Check all columns before the row group is appended, such that an
+    // out-of-range column does not leave a partial row group in the file.
+    for (std::vector<ColumnDesc>::const_iterator it = columns_.begin(); it != columns_.end(); ++it)
+    {
+        if (!CheckRowRange(*it->column, offset))
+            return false;
+    }
+    parquet::RowGroupWriter* rg_writer = file_writer_->AppendRowGroup();
+
+    // Columns are written in schema order, which is the order of the
+    // column writers of the row group.
+    for (std::vector<ColumnDesc>::const_iterator it = columns_.begin(); it != columns_.end(); ++it)
+    {
+        if (!(this->*it->write)(*it->column, rg_writer->NextColumn(), offset))
+            return false;
+    }
+    rg_writer->Close();
+    write_time_ns_ += ElapsedNs(start);
     return true;
 }
 
@@ -673,13 +853,43 @@ bool ParquetContext::AddField(const std::shared_ptr<arrow::DataType> type,
         SPDLOG_CRITICAL("Unsigned types are currently not available for writing parquet");
         return false;
     }
+
+    if (isList && type->id() == arrow::BinaryType::type_id)
+    {
+        SPDLOG_CRITICAL("Lists of binary values are not available: {:s}", fieldName);
+        return false;
+    }
+
+    if (listSize < 0 && (listSize != VARIABLE_LIST_SIZE ||
+        type->id() == arrow::StringType::type_id || type->id() == arrow::BooleanType::type_id))
+    {
+        SPDLOG_CRITICAL("Invalid list size {:d} or variable-length lists not available "
+                        "for type {:s}: {:s}", listSize, type->name(), fieldName);
+        return false;
+    }
+
+    if (column_data_map_.count(fieldName) > 0)
+    {
+        SPDLOG_CRITICAL("Field has already been added: {:s}", fieldName);
+        return false;
+    }
+
     int byteSize;
     std::string typeID = GetTypeIDFromArrowType(type, byteSize);
-    column_data_map_[fieldName] = ColumnData(type,
-                                             fieldName,
-                                             typeID,
-                                             byteSize,
-                                             listSize);
+    ColumnData& column_data = column_data_map_[fieldName];
+    column_data = ColumnData(type, fieldName, typeID, byteSize, listSize);
+
+    // Resolve the append routine once, such that each row group is
+    // appended without a per-column type switch.
+    AppendFunc append = GetAppendFunc(column_data);
+    WriteFunc write = GetWriteFunc(column_data);
+    if (append == nullptr || write == nullptr)
+    {
+        SPDLOG_CRITICAL("Data type not included: {:s}", type->name());
+        column_data_map_.erase(fieldName);
+        return false;
+    }
+    columns_.push_back(ColumnDesc{&column_data, append, write});
 
     std::shared_ptr<arrow::Field> tempField;
 
@@ -726,36 +936,45 @@ bool ParquetContext::WriteColumns(const int& rows, const int offset)
 
     try
     {
-        if (rows > 0)
+        if (direct_write_)
         {
-            for (std::map<std::string, ColumnData>::iterator
-                     it = column_data_map_.begin();
-                 it != column_data_map_.end();
-                 ++it)
+            if (!WriteRowGroupDirect(offset))
             {
-                ret_val = AppendColumn(it->second, rows, offset);
+                SPDLOG_CRITICAL("WriteRowGroupDirect() failure");
+                return false;
+            }
+        }
+        else if (rows > 0)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (std::vector<ColumnDesc>::const_iterator it = columns_.begin();
+                 it != columns_.end(); ++it)
+            {
+                ret_val = AppendColumn(*it, offset);
                 if (!ret_val)
                 {
                     SPDLOG_CRITICAL("AppendColumn() failure");
                     return false;
                 }
             }
+            build_time_ns_ += ElapsedNs(start);
         }
 
-        if (!WriteColsIfReady())
+        if (!direct_write_ && !WriteColsIfReady())
         {
             SPDLOG_CRITICAL("WriteColsIfReady() failure");
             return false;
         }
 
-        // Reset the status of each column.
-        for (std::map<std::string, ColumnData>::iterator
-                 it = column_data_map_.begin();
-             it != column_data_map_.end();
-             ++it)
+        if (rows > 0)
         {
-            it->second.ready_for_write_ = false;
+            written_row_count_ += static_cast<uint64_t>(rows);
+            written_row_group_count_++;
         }
+
+        // Reset the status of each column.
+        for (std::vector<ColumnDesc>::iterator it = columns_.begin(); it != columns_.end(); ++it)
+            it->column->ready_for_write_ = false;
         return true;
     }
 
@@ -862,6 +1081,14 @@ std::string ParquetContext::GetTypeIDFromArrowType(const std::shared_ptr<arrow::
             return typeid(a).name();
             break;
         }
+        // Binary values are copied as bytes from a BinaryColumnBuffer.
+        case arrow::BinaryType::type_id:
+        {
+            uint8_t a;
+            byteSize = sizeof(a);
+            return typeid(a).name();
+            break;
+        }
 
         default:
             SPDLOG_ERROR("Data type not included in add field");
@@ -890,34 +1117,57 @@ bool ParquetContext::IncrementAndWrite(const uint16_t& thread_id)
     // If the buffer is full, write the data to disk.
     if (appended_row_count_ == max_temp_element_count_)
     {
-        if (print_activity_)
-        {
-            SPDLOG_INFO("({:02d}) {:s}: Writing {:d} rows", thread_id,
-                        print_msg_, appended_row_count_);
-        }
-
-        // Indicate that some data have been written.
-        did_write_columns_ = true;
+        WriteBufferedRowGroups(thread_id);
 
-        // Write each of the row groups.
-        bool result = false;
-        for (int i = 0; i < row_group_count_multiplier_; i++)
-        {
-            //printf("writecolumns(%zu, %zu)\n", ROW_GROUP_COUNT_, i * ROW_GROUP_COUNT_);
-            result = WriteColumns(static_cast<int>(ROW_GROUP_COUNT_), static_cast<int>(i * ROW_GROUP_COUNT_));
-            if (!result)
-                SPDLOG_ERROR("WriteColumns() failure");
-        }
+        // Return true to indicate that buffers were written.
+        return true;
+    }
+    return false;
+}
 
-        // Reset
-        appended_row_count_ = 0;
+bool ParquetContext::IncrementAndWriteRows(size_t row_count, const uint16_t& thread_id)
+{
+    if (row_count > GetAvailableRowCount())
+    {
+        SPDLOG_ERROR("({:02d}) {:s}: Row count {:d} exceeds available row count {:d}",
+                     thread_id, print_msg_, row_count, GetAvailableRowCount());
+        return false;
+    }
 
-        // Return true to indicate that buffers were written.
+    appended_row_count_ += row_count;
+    if (row_count > 0 && appended_row_count_ == max_temp_element_count_)
+    {
+        WriteBufferedRowGroups(thread_id);
         return true;
     }
     return false;
 }
 
+void ParquetContext::WriteBufferedRowGroups(const uint16_t& thread_id)
+{
+    if (print_activity_)
+    {
+        SPDLOG_INFO("({:02d}) {:s}: Writing {:d} rows", thread_id,
+                    print_msg_, appended_row_count_);
+    }
+
+    // Indicate that some data have been written.
+    did_write_columns_ = true;
+
+    // Write each of the row groups.
+    bool result = false;
+    for (int i = 0; i < row_group_count_multiplier_; i++)
+    {
+        //printf("writecolumns(%zu, %zu)\n", ROW_GROUP_COUNT_, i * ROW_GROUP_COUNT_);
+        result = WriteColumns(static_cast<int>(ROW_GROUP_COUNT_), static_cast<int>(i * ROW_GROUP_COUNT_));
+        if (!result)
+            SPDLOG_ERROR("WriteColumns() failure");
+    }
+
+    // Reset
+    appended_row_count_ = 0;
+}
+
 bool ParquetContext::SetupRowCountTracking(size_t row_group_count,
                                            size_t row_group_count_multiplier,
                                            bool print_activity, std::string print_msg)
@@ -1008,6 +1258,17 @@ void ParquetContext::Finalize(const uint16_t& thread_id)
     }
 }
 
+bool ParquetContext::EnableDirectWrite()
+{
+    if (have_created_writer_)
+    {
+        SPDLOG_ERROR("EnableDirectWrite must be called before OpenForWrite");
+        return false;
+    }
+    direct_write_ = true;
+    return true;
+}
+
 void ParquetContext::EnableEmptyFileDeletion(const std::string& path)
 {
     path_ = path;
@@ -1090,3 +1351,34 @@ bool ParquetContext::SetMemLocUI8(std::vector<uint8_t>& data, const std::string&
 
     return SetColumnMemoryLocation(data, col_data, boolField);
 }
+
+bool ParquetContext::SetListMemLoc(std::vector<int32_t>& offsets, void* values,
+                                   const std::string& typeID, const std::string& fieldName)
+{
+    ColumnData* col_data = nullptr;
+    if (!GetColumnDataByField(fieldName, column_data_map_, col_data))
+        return false;
+
+    if (col_data->list_size_ != VARIABLE_LIST_SIZE &&
+        col_data->type_->id() != arrow::BinaryType::type_id)
+    {
+        SPDLOG_CRITICAL("ListColumnBuffer set for column which is not a variable-length "
+                        "list or binary: {:s}", fieldName);
+        parquet_stop_ = true;
+        return false;
+    }
+
+    if (typeID != col_data->type_ID_)
+    {
+        SPDLOG_CRITICAL("ListColumnBuffer type does not match the column type, casting "
+                        "is not available: {:s}", fieldName);
+        parquet_stop_ = true;
+        return false;
+    }
+
+    if (col_data->pointer_set_)
+        SPDLOG_WARN("ptr is already set for: {:s}", fieldName);
+
+    col_data->SetColumnData(offsets, values, fieldName);
+    return true;
+}
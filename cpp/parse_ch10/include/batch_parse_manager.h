@@ -0,0 +1,224 @@
+// batch_parse_manager.h
+
+/* BatchParseManager parses multiple ch10 files with a single, bounded
+   pool of ParseWorker threads. Work units from all files are scheduled
+   onto the pool in file order such that threads do not idle at file
+   boundaries. Each file is configured, parsed and its metadata recorded
+   exactly as in the single file case, so outputs are per-file.
+*/
+
+#ifndef BATCH_PARSE_MANAGER_H_
+#define BATCH_PARSE_MANAGER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <set>
+#include <memory>
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+
+#include "sysexits.h"
+#include "parse_manager.h"
+#include "parser_config_params.h"
+#include "parser_paths.h"
+#include "parser_metadata.h"
+#include "managed_path.h"
+#include "argument_validation.h"
+#include "file_reader.h"
+#include "spdlog/spdlog.h"
+
+// State of a single ch10 file in a batch
+class BatchFile
+{
+   public:
+    ManagedPath input_path_;
+    ParserPaths parser_paths_;
+    ParserMetadata metadata_;
+    std::ifstream ch10_stream_;
+    std::vector<WorkUnit> work_units_;
+    std::vector<WorkUnit*> work_unit_ptrs_;
+
+    // Indices of work units currently executing
+    std::vector<uint16_t> active_workers_;
+
+    // True after ParseManager::Configure succeeds
+    bool configured_;
+
+    // True if the append mode work units are being scheduled
+    bool append_mode_;
+
+    // Index of the next work unit to be activated in the
+    // current mode
+    uint16_t next_worker_;
+
+    // Read position passed to ActivateWorker
+    uint64_t read_pos_;
+
+    // Count of bytes in the ch10 file
+    uint64_t file_size_;
+
+    // True if parsing is complete or has failed
+    bool complete_;
+    int retcode_;
+
+    std::chrono::high_resolution_clock::time_point start_time_;
+    double duration_;
+
+    explicit BatchFile(const ManagedPath& input_path) : input_path_(input_path),
+        configured_(false), append_mode_(false), next_worker_(0), read_pos_(0),
+        file_size_(0), complete_(false), retcode_(0), duration_(0.0)
+    {}
+
+    /*
+    Count of work units which must be activated in the current mode.
+    In append mode there is no append worker for the final work unit.
+    */
+    uint16_t ModeWorkerCount() const
+    {
+        uint16_t count = static_cast<uint16_t>(work_units_.size());
+        if (append_mode_ && count > 0)
+            count--;
+        return count;
+    }
+
+    // True if a work unit in the current mode is waiting to be activated.
+    // No further work units are scheduled after any worker has failed.
+    bool HasPendingWorker() const
+    {
+        return configured_ && !complete_ && retcode_ == 0 &&
+            next_worker_ < ModeWorkerCount();
+    }
+};
+
+class BatchParseManager
+{
+   private:
+    ParseManager pm_;
+    ParseManagerFunctions pmf_;
+
+    // Summary of the most recent call to Parse
+    uint64_t total_bytes_;
+    double total_duration_;
+    size_t failed_count_;
+
+   public:
+    const uint64_t& total_bytes;
+    const double& total_duration;
+    const size_t& failed_count;
+
+    BatchParseManager();
+    virtual ~BatchParseManager() {}
+
+    /*
+    Match a file name against a pattern in which '*' matches
+    any sequence of characters, including none, and '?' matches
+    any single character.
+
+    Args:
+        pattern         --> Pattern with optional wildcards
+        name            --> File name to be matched
+
+    Return:
+        True if name matches the pattern; false otherwise.
+    */
+    static bool MatchWildcard(const std::string& pattern, const std::string& name);
+
+    /*
+    Build the list of ch10 files to parse from a batch input
+    specification, which is one of:
+
+    - A directory, in which case all files in the directory with
+      the case-insensitive extensions ch10 or c10 are selected
+    - A text file with extension txt, in which each non-empty line
+      not beginning with '#' is the path to a ch10 file
+    - A path in which the final component contains the wildcards
+      '*' or '?', in which case all matching ch10 files in the parent
+      directory are selected
+    - A single ch10 file
+
+    Args:
+        input           --> Batch input specification
+        av              --> ArgumentValidation instance
+        input_paths     --> Output vector of ch10 paths, sorted in the
+                            case of a directory or wildcard pattern and
+                            in file order in the case of a list
+
+    Outputs are named from the stem of each input file, so selected
+    files must have unique stems. For example, a list containing
+    dir1/flight.ch10 and dir2/flight.ch10 is rejected.
+
+    Return:
+        EX_OK if at least one ch10 file is selected, all selected
+        files exist and no two files have the same stem; EX_NOINPUT
+        or EX_DATAERR otherwise.
+    */
+    static int CollectInputPaths(const std::string& input, const ArgumentValidation* av,
+        std::vector<ManagedPath>& input_paths);
+
+    /*
+    Calculate the maximum count of concurrently active workers from
+    the configured thread count and memory limit. Each active worker
+    holds a buffer of up to parse_chunk_bytes_ MB.
+
+    Args:
+        user_config     --> ParserConfigParams object
+
+    Return:
+        Maximum count of active workers, at least one.
+    */
+    static uint16_t GetMaxActiveWorkers(const ParserConfigParams& user_config);
+
+    /*
+    Parse all input files. A failure to parse one file is logged
+    and does not stop parsing of the remaining files.
+
+    Args:
+        input_paths     --> Ch10 files to parse
+        output_dir      --> Directory in which per-file outputs are placed
+        user_config     --> ParserConfigParams object
+
+    Return:
+        EX_OK if all files were parsed, otherwise the return code
+        of the first failure.
+    */
+    virtual int Parse(const std::vector<ManagedPath>& input_paths, const ManagedPath& output_dir,
+        const ParserConfigParams& user_config);
+
+
+
+    //////////////////////////////////////////////////////////////////////////////
+    // Functions below are considered to be internal functions. They
+    // are made public to facilitate testing.
+    //////////////////////////////////////////////////////////////////////////////
+
+    /*
+    Join completed work units of a file.
+
+    Args:
+        file            --> BatchFile with active workers
+
+    Return:
+        Count of joined work units.
+    */
+    uint16_t JoinCompleted(BatchFile* file);
+
+    /*
+    If all work units in the current mode of a file are complete,
+    transition to append mode or finalize the file by recording
+    metadata and releasing buffers and streams.
+
+    Args:
+        file            --> BatchFile to update
+    */
+    void AdvanceFile(BatchFile* file);
+
+    /*
+    Record per-file and aggregate throughput.
+    */
+    void LogFileComplete(const BatchFile* file) const;
+    void LogSummary(size_t file_count) const;
+};
+
+#endif  // BATCH_PARSE_MANAGER_H_
@@ -0,0 +1,217 @@
+// ch10_packet_index.h
+
+/* Ch10PacketIndex is a compact record of the position, channel ID,
+   data type and time of each packet in a ch10 file. It is built once
+   by a scan of packet headers, which skips packet bodies except those
+   of time data packets, and cached beside the ch10 file. The index is
+   used to resolve a time range, byte range or both to the packet-aligned
+   byte range which must be parsed, such that a window of a large
+   recording can be parsed without reading the remainder of the file.
+*/
+
+#ifndef CH10_PACKET_INDEX_H_
+#define CH10_PACKET_INDEX_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <set>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+
+#include "sysexits.h"
+#include "managed_path.h"
+#include "memory_mapped_file.h"
+#include "parse_text.h"
+#include "ch10_context.h"
+#include "ch10_packet_type.h"
+#include "ch10_header_format.h"
+#include "ch10_tdp_component.h"
+#include "ch10_time.h"
+#include "parser_config_params.h"
+#include "spdlog/spdlog.h"
+
+// A single packet. Fixed size and trivially copyable such that the
+// index can be written and read as a block.
+struct Ch10PacketIndexEntry
+{
+    // Absolute position of the packet header
+    uint64_t position;
+
+    // Header RTC in nanoseconds
+    uint64_t rtc;
+
+    // Absolute time in nanoseconds since the epoch, calculated from
+    // the most recent time data packet, or zero if no time data packet
+    // precedes the packet
+    uint64_t abs_time;
+
+    uint32_t pkt_size;
+    uint16_t channel_id;
+    uint8_t data_type;
+    uint8_t reserved;
+};
+
+// Data selected by the user for a selective parse
+class Ch10PacketSelection
+{
+   public:
+    // Time range in seconds relative to the first packet with
+    // absolute time
+    bool has_time_range_;
+    double start_sec_;
+    double end_sec_;
+
+    // Byte range [begin_byte_, end_byte_)
+    bool has_byte_range_;
+    uint64_t begin_byte_;
+    uint64_t end_byte_;
+
+    // Channel IDs to parse, all if empty
+    std::set<uint16_t> channel_ids_;
+
+    Ch10PacketSelection() : has_time_range_(false), start_sec_(0.0), end_sec_(0.0),
+        has_byte_range_(false), begin_byte_(0), end_byte_(0), channel_ids_()
+    {}
+
+    /*
+    Interpret the selection strings in ParserConfigParams:
+
+    - time_range_str_, "<start>:<end>" in seconds relative to the first
+      packet with absolute time, e.g., "3600:4200"
+    - byte_range_str_, "<begin>:<end>" byte offsets, each decimal or
+      hexadecimal with a "0x" prefix
+    - channel_ids_str_, comma-separated channel IDs, e.g., "1,5,12"
+
+    Empty strings are not selections.
+
+    Args:
+        config      --> ParserConfigParams object
+
+    Return:
+        True if all non-empty strings are valid; false otherwise.
+    */
+    bool Initialize(const ParserConfigParams& config);
+
+    // True if a time or byte range is selected, which requires an index
+    bool HasRange() const { return has_time_range_ || has_byte_range_; }
+
+    // True if any selection is made
+    bool IsActive() const { return HasRange() || !channel_ids_.empty(); }
+};
+
+class Ch10PacketIndex
+{
+   private:
+    std::vector<Ch10PacketIndexEntry> entries_;
+
+    // Size and modification time of the ch10 file from which the
+    // index was built, used to determine if a cached index is stale
+    uint64_t ch10_size_;
+    int64_t ch10_mtime_;
+
+    // Get the size and modification time of a file
+    static bool GetFileStamp(const ManagedPath& path, uint64_t& size, int64_t& mtime);
+
+   public:
+    static const char magic_[8];
+    static const uint32_t version_;
+    static const std::string extension_;
+
+    const std::vector<Ch10PacketIndexEntry>& entries;
+
+    Ch10PacketIndex();
+    virtual ~Ch10PacketIndex() {}
+
+    /*
+    Get the path of the index cached beside a ch10 file, i.e., the
+    ch10 path with extension_ appended.
+    */
+    static ManagedPath GetIndexPath(const ManagedPath& ch10_path);
+
+    /*
+    Build the index by scanning the packet headers of a ch10 file.
+    Bytes which do not begin with a valid header are skipped one at
+    a time, as in the parser. A packet which extends beyond the end
+    of the file is not indexed.
+
+    Args:
+        ch10_path       --> Path of the ch10 file
+
+    Return:
+        EX_OK if successful; EX_NOINPUT or EX_IOERR otherwise.
+    */
+    virtual int Build(const ManagedPath& ch10_path);
+
+    /*
+    Index the packets in a buffer. Used by Build.
+
+    Args:
+        data            --> Pointer to ch10 data beginning at absolute
+                            position zero
+        size            --> Count of bytes in data
+    */
+    void IndexBuffer(const uint8_t* data, uint64_t size);
+
+    /*
+    Write the index to a file.
+
+    Return:
+        EX_OK if successful; EX_CANTCREAT or EX_IOERR otherwise.
+    */
+    virtual int Write(const ManagedPath& index_path) const;
+
+    /*
+    Read an index file.
+
+    Args:
+        index_path      --> Path of the index file
+        ch10_path       --> Path of the ch10 file from which the index
+                            was built. The index is rejected if the ch10
+                            size or modification time differ from those
+                            recorded in the index.
+
+    Return:
+        EX_OK if the index is read and current; EX_NOINPUT if the file
+        does not exist or EX_DATAERR if it is invalid or stale.
+    */
+    virtual int Read(const ManagedPath& index_path, const ManagedPath& ch10_path);
+
+    /*
+    Read the index cached beside the ch10 file or, if it does not exist
+    or is stale, build the index and attempt to cache it. Failure to
+    write the cache is not an error.
+
+    Return:
+        EX_OK if an index is read or built; exit code otherwise.
+    */
+    virtual int LoadOrBuild(const ManagedPath& ch10_path);
+
+    /*
+    Resolve a selection to the range of bytes to parse. The range begins
+    at the time data packet which precedes the first selected packet,
+    such that the absolute time of the selected packets can be computed,
+    and ends after the last selected packet. Time is assumed to be
+    non-decreasing in file order.
+
+    Args:
+        selection       --> Ch10PacketSelection with at least one range
+        parse_begin     --> Output, position at which to begin parsing
+        data_begin      --> Output, position of the first selected packet.
+                            Data packets prior to this position are not
+                            selected, see Ch10Context::SetPacketSelection.
+        parse_end       --> Output, position one past the last selected byte
+
+    Return:
+        True if at least one packet is selected; false otherwise.
+    */
+    bool SelectRange(const Ch10PacketSelection& selection, uint64_t& parse_begin,
+        uint64_t& data_begin, uint64_t& parse_end) const;
+};
+
+#endif  // CH10_PACKET_INDEX_H_
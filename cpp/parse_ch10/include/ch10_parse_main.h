@@ -5,8 +5,11 @@
 #include <string>
 #include <cstdio>
 #include <iostream>
+#include <vector>
 #include "sysexits.h"
 #include "parse_manager.h"
+#include "batch_parse_manager.h"
+#include "stream_parse_manager.h"
 #include "parser_config_params.h"
 #include "parser_cli.h"
 #include "managed_path.h"
@@ -18,9 +21,43 @@
 #include "stream_buffering.h"
 #include "yaml_schema_validation.h"
 #include "parser_metadata.h"
+#include "perf_stats.h"
 
 int Ch10ParseMain(int argc, char** argv);
 
+/*
+Validate batch mode paths and parse all selected ch10 files
+with a single BatchParseManager.
+
+Args:
+    config      --> ParserConfigParams configured from CLI
+    av          --> ArgumentValidation instance
+
+Return:
+    EX_OK if all files were parsed; nonzero otherwise.
+*/
+int Ch10BatchParseMain(const ParserConfigParams& config, const ArgumentValidation* av);
+
+/*
+Follow a ch10 file which is being written with a StreamParseManager.
+Paths must be validated by ValidatePaths.
+
+Args:
+    config      --> ParserConfigParams configured from CLI
+    input_path  --> Ch10 file path
+    output_path --> Output directory
+    log_dir     --> Log directory
+
+Return:
+    EX_OK if parsing and metadata recording succeed; nonzero otherwise.
+*/
+int Ch10StreamParseMain(const ParserConfigParams& config, const ManagedPath& input_path,
+    const ManagedPath& output_path, const ManagedPath& log_dir);
+
+int ValidateBatchPaths(const std::string& str_input_path, const std::string& str_output_path,
+                   const std::string& str_log_dir, std::vector<ManagedPath>& input_paths, 
+                   ManagedPath& output_path, ManagedPath& log_dir, const ArgumentValidation* av);
+
 int ValidatePaths(const std::string& str_input_path, const std::string& str_output_path,
                    const std::string& str_log_dir, ManagedPath& input_path, 
                    ManagedPath& output_path, ManagedPath& log_dir, 
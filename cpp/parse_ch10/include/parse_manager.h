@@ -22,6 +22,7 @@
 
 #include "sysexits.h"
 #include "parse_worker.h"
+#include "parse_progress.h"
 #include "parser_config_params.h"
 #include "parser_paths.h"
 #include "managed_path.h"
@@ -30,6 +31,7 @@
 #include "ch10_packet_type.h"
 #include "ch10_context.h"
 #include "parser_metadata.h"
+#include "ch10_packet_index.h"
 
 
 class WorkUnit
@@ -175,6 +177,18 @@ class ParseManager
 	private:
 		int retcode_; 
 
+		// Absolute position at which the first worker begins parsing,
+		// non-zero if a byte or time range is selected
+		uint64_t parse_begin_position_;
+
+		// Absolute position at which parsing ends, less than the file
+		// size if a byte or time range is selected
+		uint64_t parse_end_position_;
+
+		// Progress reporter to which workers are registered as they
+		// are started and joined, nullptr if progress is not reported
+		ParseProgress* progress_;
+
    public:
 	// Count of bytes of raw ch10 data to be parsed by
     // each worker in append mode
@@ -186,6 +200,17 @@ class ParseManager
     virtual ~ParseManager();
 	static uint32_t GetAppendChunkSizeBytes();
 	static std::string GetMetadataFilename(); 
+	uint64_t GetParseBeginPosition() const { return parse_begin_position_; }
+	uint64_t GetParseEndPosition() const { return parse_end_position_; }
+
+	/*
+	Set the progress reporter to which workers are registered as they
+	are started and joined in non-append mode.
+
+	Args:
+		progress	--> ParseProgress instance, or nullptr to disable
+	*/
+	void SetProgress(ParseProgress* progress) { progress_ = progress; }
 
 
     //////////////////////////////////////////////////////////////////////////////
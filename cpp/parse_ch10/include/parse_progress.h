@@ -0,0 +1,191 @@
+#ifndef PARSE_PROGRESS_H_
+#define PARSE_PROGRESS_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include "sysexits.h"
+#include "managed_path.h"
+#include "spdlog/spdlog.h"
+
+// Progress of a single worker at the time of a sample
+struct WorkerProgress
+{
+    uint16_t worker_index;
+
+    // Bytes of the worker chunk which have been parsed and total
+    // bytes in the chunk
+    uint64_t done_bytes;
+    uint64_t chunk_bytes;
+
+    // Average rate since the worker was started, MB/s
+    double mb_per_sec;
+
+    // Bytes by which the worker trails the active worker which has
+    // parsed the most bytes. Zero for complete workers.
+    uint64_t lag_bytes;
+
+    bool complete;
+};
+
+// Overall progress at the time of a sample
+struct ProgressSample
+{
+    double elapsed_sec;
+    uint64_t done_bytes;
+    uint64_t total_bytes;
+
+    // Rate since the previous sample and average rate since Start, MB/s
+    double mb_per_sec;
+    double average_mb_per_sec;
+
+    // Estimated time to completion, negative if unknown
+    double eta_sec;
+
+    std::vector<WorkerProgress> workers;
+};
+
+/*
+Report the progress of a parse at a regular interval from a dedicated
+thread. Workers are registered as they are started. The thread samples
+the absolute position of the Ch10Context of each registered worker,
+which is an atomic that the worker stores with relaxed ordering, such
+that the parse loop is not slowed by reporting.
+
+Each report is logged to the ParseManager logger. If an output path is
+given, each report is also written to the file as a JSON object which
+replaces the previous report, for consumption by job schedulers.
+*/
+class ParseProgress
+{
+   private:
+    struct WorkerState
+    {
+        uint16_t worker_index;
+        uint64_t start_position;
+        uint64_t chunk_bytes;
+        const std::atomic<uint64_t>* position;
+        std::chrono::steady_clock::time_point start_time;
+        bool complete;
+    };
+
+    // Absolute positions at which parsing begins and ends
+    uint64_t begin_position_;
+    uint64_t end_position_;
+
+    std::chrono::milliseconds interval_;
+    ManagedPath output_path_;
+    bool write_output_;
+
+    std::vector<WorkerState> workers_;
+    std::chrono::steady_clock::time_point start_time_;
+
+    // Values at the previous sample, used to calculate the recent rate
+    std::chrono::steady_clock::time_point last_sample_time_;
+    uint64_t last_done_bytes_;
+
+    std::mutex mutex_;
+    std::condition_variable stop_cv_;
+    bool stop_requested_;
+    std::thread thread_;
+
+    // Thread function which reports until Stop is called
+    void Run();
+
+   public:
+    /*
+    Args:
+        begin_position  --> Absolute position at which parsing begins
+        end_position    --> Absolute position at which parsing ends
+        interval_sec    --> Seconds between reports
+        output_path     --> JSON output file path, empty string for none
+    */
+    ParseProgress(uint64_t begin_position, uint64_t end_position, int interval_sec,
+        const std::string& output_path);
+    virtual ~ParseProgress();
+
+    // Start the reporting thread
+    void Start();
+
+    /*
+    Stop the reporting thread. If an output path is given, write a
+    final report with state "complete".
+
+    Args:
+        success --> False if the parse failed, in which case the state
+                    is "failed"
+    */
+    void Stop(bool success);
+
+    /*
+    Register a worker which has been started. Call from the thread
+    which starts workers.
+
+    Args:
+        worker_index    --> Worker index
+        start_position  --> Absolute position at which the worker begins
+        chunk_bytes     --> Count of bytes the worker parses
+        position        --> Absolute position of the worker context,
+                            which must remain valid until Stop is called
+    */
+    void WorkerStarted(uint16_t worker_index, uint64_t start_position, uint64_t chunk_bytes,
+        const std::atomic<uint64_t>* position);
+
+    /*
+    Mark a registered worker complete. Workers which have not been
+    registered are ignored.
+
+    Args:
+        worker_index    --> Worker index
+    */
+    void WorkerComplete(uint16_t worker_index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    //                          Internal functions
+    ///////////////////////////////////////////////////////////////////////////
+
+    /*
+    Sample the progress of all registered workers.
+
+    Args:
+        now --> Time of the sample
+
+    Return:
+        ProgressSample
+    */
+    ProgressSample Sample(const std::chrono::steady_clock::time_point& now);
+
+    // Format a sample as a single log line
+    static std::string FormatLog(const ProgressSample& sample);
+
+    /*
+    Format a sample as a JSON object.
+
+    Args:
+        sample  --> ProgressSample
+        state   --> "running", "complete" or "failed"
+
+    Return:
+        JSON string
+    */
+    static std::string FormatJSON(const ProgressSample& sample, const std::string& state);
+
+    /*
+    Write text to a file via a temporary file and rename, such that
+    readers never see a partial file.
+
+    Return:
+        EX_CANTCREAT if the file can't be written, EX_OK otherwise
+    */
+    static int WriteFile(const ManagedPath& path, const std::string& text);
+};
+
+#endif  // PARSE_PROGRESS_H_
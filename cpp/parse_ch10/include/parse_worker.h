@@ -23,6 +23,43 @@ parser_rewrite lib.
 #include "worker_config.h"
 #include "spdlog/spdlog.h"
 
+/*
+Component parsers used by ParseWorker::ParseBufferData. Some parsers carry
+state from one buffer to the next, such as the PCM throughput mode bits
+which follow the last complete minor frame and the open pcap writers of
+the Ethernet parser, so the parsers persist between calls for the life of
+the Ch10Context with which they were created.
+*/
+class ParseWorkerComponents
+{
+   public:
+    Ch10Context* const ctx_;
+    Ch10PacketHeaderComponent header_;
+    Ch10TMATSComponent tmats_;
+    Ch10TDPComponent tdp_;
+    Ch101553F1Component milstd1553_;
+    Ch10VideoF0Component vid_;
+    Ch10EthernetF0Component eth_;
+    Ch10429F0Component arinc429_;
+    Ch10PCMF1Component pcmf1_;
+    Ch10CANBusComponent canbus_;
+    Ch10EthernetF1Component ethernetf1_;
+    Ch10AnalogF1Component analogf1_;
+    Ch101553F2Component milstd1553f2_;
+    Ch10UARTF0Component uartf0_;
+    Ch10MessageF0Component messagef0_;
+
+    // Parquet output path from which the current pcap output paths
+    // were created, empty if pcap output is not enabled
+    ManagedPath pcap_pq_output_file_;
+
+    explicit ParseWorkerComponents(Ch10Context* ctx) : ctx_(ctx), header_(ctx), tmats_(ctx),
+        tdp_(ctx), milstd1553_(ctx), vid_(ctx), eth_(ctx), arinc429_(ctx), pcmf1_(ctx),
+        canbus_(ctx), ethernetf1_(ctx), analogf1_(ctx), milstd1553f2_(ctx), uartf0_(ctx),
+        messagef0_(ctx), pcap_pq_output_file_()
+    {}
+};
+
 class ParseWorker
 {
    private:
@@ -32,6 +69,9 @@ class ParseWorker
 	// Return code from operator() function
 	std::atomic<int> retval_;
 
+	// Component parsers created by the first call to ParseBufferData
+	std::unique_ptr<ParseWorkerComponents> components_;
+
    public:
     ParseWorker();
 
@@ -82,7 +122,10 @@ class ParseWorker
                           const std::map<Ch10PacketType, ManagedPath>& output_file_paths_map);
 
     /*
-	Parse the ch10 binary data until complete.
+	Parse the ch10 binary data until complete. Component parsers are
+	retained between calls with the same Ch10Context, such that a
+	stream which is parsed in consecutive buffers, i.e., by
+	StreamParseManager or in append mode, is parsed as a whole.
 
 	Args:
 		ctx			--> Pointer to configured Ch10Context instance
@@ -91,6 +134,13 @@ class ParseWorker
 						found TMATs data
 	*/
     void ParseBufferData(Ch10Context* ctx, BinBuff* bb);
+
+    /*
+	Destroy the component parsers retained by ParseBufferData, which closes
+	pcap output files. To be called when the file writers of the Ch10Context
+	are closed.
+	*/
+    void ReleaseComponents();
 };
 
 #endif
\ No newline at end of file
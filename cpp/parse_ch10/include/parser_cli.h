@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include <set>
+#include <climits>
 #include "cli_group.h"
 #include "parser_cli_help_strings.h"
 #include "parser_config_params.h"
@@ -58,6 +59,44 @@ inline bool ConfigureParserCLI(CLIGroup& cli_group, ParserConfigParams& config,
         config.worker_offset_wait_ms_)->ValidateInclusiveRangeIs(1, 30000);
     cli->AddOption("--worker_wait", "", worker_shift_wait_help, 200, 
         config.worker_shift_wait_ms_)->ValidateInclusiveRangeIs(1, 30000);
+    cli->AddOption("--memory_limit", "", memory_limit_help, 0, 
+        config.memory_limit_mb_)->ValidateInclusiveRangeIs(0, INT_MAX);
+    cli->AddOption("--poll_interval", "", stream_poll_ms_help, 500, 
+        config.stream_poll_ms_)->ValidateInclusiveRangeIs(1, 60000);
+    cli->AddOption("--commit_interval", "", stream_commit_sec_help, 10, 
+        config.stream_commit_sec_)->ValidateInclusiveRangeIs(1, 86400);
+    cli->AddOption("--idle_timeout", "", stream_idle_timeout_help, 60, 
+        config.stream_idle_timeout_sec_)->ValidateInclusiveRangeIs(1, INT_MAX);
+    cli->AddOption("--progress_interval", "", progress_interval_help, 0, 
+        config.progress_interval_sec_)->ValidateInclusiveRangeIs(0, 86400);
+    cli->AddOption("--checksum_sample_interval", "", checksum_sample_interval_help, 
+        ParserConfigParams::DEFAULT_CHECKSUM_SAMPLE_INTERVAL, 
+        config.checksum_sample_interval_)->ValidateInclusiveRangeIs(1, INT_MAX);
+    cli->AddOption("--pcm_words", "", pcm_words_help, 0, 
+        config.pcm_words_)->ValidateInclusiveRangeIs(0, 65536);
+    cli->AddOption("--pcm_word_bits", "", pcm_word_bits_help, 16, 
+        config.pcm_word_bits_)->ValidateInclusiveRangeIs(1, 32);
+    cli->AddOption("--pcm_sync_bits", "", pcm_sync_bits_help, 32, 
+        config.pcm_sync_bits_)->ValidateInclusiveRangeIs(16, 64);
+    cli->AddOption("--analog_decimation", "", analog_decimation_help, 1, 
+        config.analog_decimation_)->ValidateInclusiveRangeIs(1, INT_MAX);
+
+    cli->AddOption<std::string>("--time_range", "", time_range_help, "", 
+        config.time_range_str_);
+    cli->AddOption<std::string>("--byte_range", "", byte_range_help, "", 
+        config.byte_range_str_);
+    cli->AddOption<std::string>("--channel_ids", "", channel_ids_help, "", 
+        config.channel_ids_str_);
+    cli->AddOption<std::string>("--perf_stats", "", perf_stats_path_help, "", 
+        config.perf_stats_path_str_);
+    cli->AddOption<std::string>("--progress_path", "", progress_path_help, "", 
+        config.progress_path_str_);
+    cli->AddOption<std::string>("--pcm_sync_pattern", "", pcm_sync_pattern_help, "FE6B2840", 
+        config.pcm_sync_pattern_str_);
+
+    std::set<std::string> permitted_checksum_policies{"always", "sample", "header_only"};
+    cli->AddOption<std::string>("--checksum_policy", "", checksum_policy_help, "always", 
+        config.checksum_policy_str_)->ValidatePermittedValuesAre(permitted_checksum_policies);
 
     std::set<std::string> permitted_log_levels{"trace", "debug", "info", "warn", "error", 
         "critical", "off"};
@@ -71,6 +110,16 @@ inline bool ConfigureParserCLI(CLIGroup& cli_group, ParserConfigParams& config,
     cli->AddOption("--disable_videof0", "", disable_videof0_help, false, config.disable_videof0_);
     cli->AddOption("--disable_eth0", "", disable_eth0_help, false, config.disable_eth0_);
     cli->AddOption("--disable_arinc0", "", disable_arinc0_help, false, config.disable_arinc0_);
+    cli->AddOption("--disable_pcmf1", "", disable_pcmf1_help, false, config.disable_pcmf1_);
+    cli->AddOption("--disable_canbus", "", disable_canbus_help, false, config.disable_canbus_);
+    cli->AddOption("--disable_eth1", "", disable_eth1_help, false, config.disable_eth1_);
+    cli->AddOption("--disable_analog1", "", disable_analog1_help, false, config.disable_analog1_);
+    cli->AddOption("--disable_1553f2", "", disable_1553f2_help, false, config.disable_1553f2_);
+    cli->AddOption("--disable_uartf0", "", disable_uartf0_help, false, config.disable_uartf0_);
+    cli->AddOption("--disable_messagef0", "", disable_messagef0_help, false, config.disable_messagef0_);
+    cli->AddOption("--batch", "-b", batch_mode_help, false, config.batch_mode_);
+    cli->AddOption("--follow", "-f", stream_mode_help, false, config.stream_mode_);
+    cli->AddOption("--direct_write", "", direct_write_help, false, config.direct_write_);
 
     if(!cli_group.CheckConfiguration())
         return false;
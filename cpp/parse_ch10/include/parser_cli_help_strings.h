@@ -14,7 +14,9 @@ const std::string version_request_help =
     R"(Print version, either latest commit git SHA or tag.)";
 
 const std::string input_path_help = 
-    R"(Ch10 input file path)";
+    R"(Ch10 input file path. In batch mode, a directory of ch10 files, a text file 
+       (.txt) listing one ch10 path per line, or a path with '*' or '?' wildcards in 
+       the file name, e.g., "/data/flight_*.ch10")";
 
 const std::string output_path_help = 
     R"(Output directory for artifacts created at parse time)";
@@ -33,7 +35,123 @@ const std::string disable_eth0_help =
 
 const std::string disable_arinc0_help = 
     R"(Disable parsing of ARINC429_FORMAT0 packets)";
+
+const std::string disable_pcmf1_help = 
+    R"(Disable parsing of PCM_FORMAT1 packets. PCM packets are only parsed if 
+       --pcm_words is given.)";
+
+const std::string disable_canbus_help = 
+    R"(Disable parsing of CAN_BUS packets)";
+
+const std::string disable_eth1_help = 
+    R"(Disable parsing of ETHERNET_DATA_F1 (ARINC 664) packets)";
+
+const std::string disable_analog1_help = 
+    R"(Disable parsing of ANALOG_F1 packets)";
+
+const std::string disable_1553f2_help = 
+    R"(Disable parsing of MILSTD1553_F2 (16PP194) packets)";
+
+const std::string disable_uartf0_help = 
+    R"(Disable parsing of UART_F0 packets)";
+
+const std::string disable_messagef0_help = 
+    R"(Disable parsing of MESSAGE_F0 packets)";
                                          
+const std::string batch_mode_help = 
+    R"(Parse multiple ch10 files with a single pool of --thread_count workers. See 
+       input_path for the accepted inputs. Outputs and metadata are created for each 
+       ch10 file in the output directory and aggregate throughput is logged.)";
+
+const std::string memory_limit_help = 
+    R"(Batch mode only. Limit the memory, in units of MB, used by all ch10 data buffers 
+       by reducing the count of concurrently active workers, each of which holds
+       --chunk_size MB. Zero is no limit.)";
+
+const std::string stream_mode_help = 
+    R"(Follow a ch10 file which is being written. Appended packets are parsed as they 
+       become complete, with a single worker, and parsed data are committed to a new 
+       Parquet file in each output directory every --commit_interval seconds. Parsing 
+       ends when the file has not grown for --idle_timeout seconds.)";
+
+const std::string stream_poll_ms_help = 
+    R"(Follow mode only. Interval, in units of ms, at which the ch10 file size is polled.)";
+
+const std::string stream_commit_sec_help = 
+    R"(Follow mode only. Interval, in units of seconds, at which parsed data are committed, 
+       i.e., the current Parquet files are closed and become readable.)";
+
+const std::string stream_idle_timeout_help = 
+    R"(Follow mode only. Parsing ends and metadata are recorded when the ch10 file has 
+       not grown for this count of seconds.)";
+
+const std::string time_range_help = 
+    R"(Parse only packets in the time range "<start>:<end>", in seconds relative to the 
+       first packet with absolute time, e.g., "3600:4200". A packet index is built on 
+       first use and cached beside the ch10 file with extension .tipidx.)";
+
+const std::string byte_range_help = 
+    R"(Parse only packets which begin in the byte range "<begin>:<end>" of the ch10 file, 
+       decimal or hexadecimal with "0x" prefix. May be combined with --time_range. Uses 
+       the packet index, see --time_range.)";
+
+const std::string channel_ids_help = 
+    R"(Parse only data packets with the comma-separated channel IDs, e.g., "1,5,12". 
+       TMATS and time data packets are always parsed.)";
+
+const std::string perf_stats_path_help = 
+    R"(Write per-worker counters and stage times to this file in addition to _metadata.yaml. 
+       The format is JSON if the extension is .json and Prometheus text if the extension is 
+       .prom, e.g., for the node exporter textfile collector. In batch mode the ch10 file 
+       stem is appended to the file stem.)";
+
+const std::string progress_interval_help = 
+    R"(Log a progress report every N seconds, which includes the parsed fraction of the file, 
+       the parse rate in MB/s, the estimated time remaining and the rate and lag of each 
+       active worker. Lag is the quantity of bytes by which a worker trails the active worker 
+       which has parsed the most bytes. Zero disables progress reports. Not used in batch 
+       or stream mode.)";
+
+const std::string progress_path_help = 
+    R"(Also write each progress report to this file as a JSON object which replaces the 
+       previous report, e.g., for a job scheduler. The final report has state "complete" 
+       or "failed". Requires --progress_interval greater than zero.)";
+
+const std::string checksum_policy_help = 
+    R"(Policy by which packet data checksums are verified. "always" verifies every packet. 
+       "sample" verifies one of every N packets, see --checksum_sample_interval. 
+       "header_only" verifies no data checksums, for recordings from trusted sources. Header 
+       checksums are always verified. Packets which fail verification are not parsed.)";
+
+const std::string checksum_sample_interval_help = 
+    R"(Verify the data checksum of one of every N packets parsed by each worker if 
+       --checksum_policy is "sample".)";
+
+const std::string pcm_words_help = 
+    R"(Count of data words in each PCM minor frame, excluding the sync pattern. PCM 
+       packets do not describe the minor frame format, which is given by --pcm_words, 
+       --pcm_word_bits, --pcm_sync_bits and --pcm_sync_pattern and applies to all PCM 
+       channels. Zero disables parsing of PCM_FORMAT1 packets.)";
+
+const std::string pcm_word_bits_help = 
+    R"(Count of bits in each PCM data word.)";
+
+const std::string pcm_sync_bits_help = 
+    R"(Count of bits in the PCM minor frame sync pattern, which begins each minor frame.)";
+
+const std::string pcm_sync_pattern_help = 
+    R"(PCM minor frame sync pattern as a hexadecimal string of at most --pcm_sync_bits 
+       significant bits, e.g., "FE6B2840".)";
+
+const std::string analog_decimation_help = 
+    R"(Write only every Nth sample frame of each ANALOG_F1 packet, beginning with the 
+       first. The index column gives the position of the sample frame in the packet.)";
+
+const std::string direct_write_help = 
+    R"(Write parquet row groups with the parquet column writers directly from the parser 
+       buffers instead of building Arrow arrays and tables. Output schemas and values are 
+       the same.)";
+
 const std::string chunk_bytes_help =
     R"(Quantity of bytes, in units of millions, ingested for parsing by each worker thread. Must be 
        in range [135, 1000].)";
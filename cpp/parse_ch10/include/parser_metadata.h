@@ -21,6 +21,8 @@
 #include "provenance_data.h"
 #include "tip_md_document.h"
 #include "sha256_tools.h"
+#include "perf_stats.h"
+#include "diagnostics.h"
 #include "spdlog/spdlog.h"
 #include "ch10_packet_type.h"
 #include "ch10_packet_type_specific_metadata.h"
@@ -184,6 +186,76 @@ class ParserMetadataFunctions
 
 
 
+        /*
+        Collect the performance counters and stage timers of each worker.
+
+        Args:
+            ctx_vec         --> Vector of Ch10Contexts, one per worker
+            report          --> PerfReport to which the stats of each worker
+                                are added, labeled by zero-padded worker index
+        */
+        void AssemblePerfReport(const std::vector<const Ch10Context*>& ctx_vec,
+            PerfReport& report);
+
+
+
+        /*
+        Record the summed counts and stage times and the stage times of
+        each worker in the runtime metadata.
+
+        Args:
+            report              --> PerfReport, see AssemblePerfReport
+            runtime_metadata    --> MDCategoryMap to which the values are added
+        */
+        virtual void RecordPerfReport(const PerfReport& report, MDCategoryMap* runtime_metadata);
+
+
+
+        /*
+        Combine the diagnostic events of all workers.
+
+        Args:
+            ctx_vec         --> Vector of Ch10Context pointers
+            diagnostics     --> Diagnostics to which the events of each
+                                worker are merged
+        */
+        void AssembleDiagnostics(const std::vector<const Ch10Context*>& ctx_vec,
+            Diagnostics& diagnostics);
+
+
+
+        /*
+        Record the count and exemplar absolute positions of each diagnostic
+        event in the runtime metadata.
+
+        Args:
+            diagnostics         --> Diagnostics, see AssembleDiagnostics
+            runtime_metadata    --> MDCategoryMap to which the values are added
+        */
+        virtual void RecordDiagnostics(const Diagnostics& diagnostics, 
+            MDCategoryMap* runtime_metadata);
+
+
+
+        /*
+        Write the PerfReport to the path given by the user, if any.
+
+        Args:
+            report          --> PerfReport, see AssemblePerfReport
+            config          --> ParserConfigParams which holds the path
+            ch10_path       --> Ch10 input file path, used to label the 
+                                output and, in batch mode, to create a 
+                                unique file name
+
+        Return:
+            EX_OK if no path is configured or the report is written; 
+            see PerfReport::Write otherwise.
+        */
+        virtual int WritePerfReport(const PerfReport& report, const ParserConfigParams& config,
+            const ManagedPath& ch10_path);
+
+
+
         virtual bool RecordCh10PktTypeSpecificMetadata(Ch10PacketType pkt_type, 
             const std::vector<const Ch10Context*>& context_vec, MDCategoryMap* runtime_metadata, 
             const TMATSData* tmats, Ch10PacketTypeSpecificMetadata* spec_md);
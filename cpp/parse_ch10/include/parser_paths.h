@@ -140,6 +140,29 @@ class ParserPaths
 
 
 
+        /*
+        Generate a map of Ch10PacketType to ManagedPath for a single index. The
+        file name is the index, zero-padded to width characters, and the
+        extension, i.e., <output dir>/<index>.<file_extension>. Used for worker
+        output files and the sequentially committed output files of stream mode.
+
+        Args:
+            index                       --> Worker or file sequence index
+            pkt_type_output_dir_map		--> Map of Ch10PacketType to base output
+                                            directory, see CreateCh10PacketWorkerFileNames
+            file_extension				--> String not including the '.'.
+            width                       --> Minimum count of digits in the file name
+
+        Return:
+            Map of Ch10PacketType to output file path, one for each entry 
+            in pkt_type_output_dir_map.
+        */
+        std::map<Ch10PacketType, ManagedPath> CreateCh10PacketIndexedFileNames(uint32_t index,
+                                            const std::map<Ch10PacketType, ManagedPath>& pkt_type_output_dir_map,
+                                            std::string file_extension, int width) const;
+
+
+
         /*
         Remove output dirs which represent packets types that were not parsed and
         which do not contain any output data.
@@ -0,0 +1,153 @@
+// stream_parse_manager.h
+
+/* StreamParseManager parses a ch10 file which is being written, for
+   example by a recorder during a ground test. The file size is polled
+   and newly appended bytes are parsed with a single ParseWorker and a
+   single Ch10Context which persist for the life of the stream, such
+   that time, TMATS and component parser state, e.g., open pcap files
+   and PCM throughput mode bits, are retained between polls. Parsing of
+   a packet which is not yet complete is deferred until the next poll.
+
+   Parquet files can't be read until the footer is written when the
+   file is closed. Parsed data are committed periodically by closing
+   the current output files and opening new files with the next
+   sequence index, so each output directory is a multi-file Parquet
+   dataset which grows while the ch10 file grows.
+*/
+
+#ifndef STREAM_PARSE_MANAGER_H_
+#define STREAM_PARSE_MANAGER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include <algorithm>
+
+#include "sysexits.h"
+#include "parse_manager.h"
+#include "parse_worker.h"
+#include "parser_config_params.h"
+#include "parser_paths.h"
+#include "parser_metadata.h"
+#include "managed_path.h"
+#include "binbuff.h"
+#include "ch10_context.h"
+#include "ch10_packet_index.h"
+#include "spdlog/spdlog.h"
+
+class StreamParseManager
+{
+   private:
+    ParseWorker worker_;
+    Ch10Context ctx_;
+    BinBuff bb_;
+    ParseManagerFunctions pmf_;
+    ParserPaths parser_paths_;
+    ParserMetadata metadata_;
+    ParserConfigParams config_;
+    std::ifstream ch10_stream_;
+    ManagedPath input_path_;
+
+    // Maximum count of bytes read and parsed per poll
+    uint64_t read_limit_;
+
+    // Count of bytes in the ch10 file at the last poll
+    uint64_t file_size_;
+
+    // Absolute position in the ch10 file at which parsing will
+    // resume, i.e., the first byte of the first incomplete packet
+    uint64_t parsed_position_;
+
+    // Value of parsed_position_ when output was last committed
+    uint64_t committed_position_;
+
+    // Sequence index of the current output files
+    uint32_t file_index_;
+
+    bool configured_;
+
+    /*
+    Open the output files for the current file_index_ and pass
+    the writers to the Ch10Context.
+
+    Return:
+        EX_OK if successful; exit code otherwise.
+    */
+    int OpenOutputFiles();
+
+   public:
+    // Minimum count of digits in output file names, e.g., 000000.parquet,
+    // such that files sort in sequence for many commits.
+    static const int output_file_index_width_;
+
+    const uint64_t& file_size;
+    const uint64_t& parsed_position;
+    const uint32_t& file_index;
+
+    StreamParseManager();
+    virtual ~StreamParseManager() {}
+
+    /*
+    Open the ch10 file, create output directories and open the
+    first output files.
+
+    Args:
+        input_ch10_file_path    --> Path of the ch10 file to follow, which
+                                    must exist and may be empty
+        output_dir              --> Output directory
+        user_config             --> ParserConfigParams object
+
+    Return:
+        EX_OK if successful; exit code otherwise.
+    */
+    virtual int Configure(const ManagedPath& input_ch10_file_path, const ManagedPath& output_dir,
+        const ParserConfigParams& user_config);
+
+    /*
+    Parse bytes appended to the ch10 file since the previous poll.
+    At most --chunk_size MB are read per call.
+
+    Args:
+        progress        --> Output, true if the parsed position advanced
+
+    Return:
+        EX_OK if successful; EX_DATAERR if the file was truncated or
+        EX_IOERR if the file can't be read.
+    */
+    virtual int Poll(bool& progress);
+
+    /*
+    Make all data parsed since the previous commit readable by closing
+    the current output files and opening files with the next sequence
+    index. Does nothing if no bytes have been parsed since the previous
+    commit.
+
+    Return:
+        EX_OK if successful; exit code otherwise.
+    */
+    virtual int Commit();
+
+    /*
+    Close the output files and record metadata.
+
+    Return:
+        EX_OK if successful; exit code otherwise.
+    */
+    virtual int Finalize();
+
+    /*
+    Poll the ch10 file every stream_poll_ms_ until it has not grown for
+    stream_idle_timeout_sec_, committing parsed data every
+    stream_commit_sec_, then finalize.
+
+    Return:
+        EX_OK if successful; exit code otherwise.
+    */
+    virtual int Follow();
+};
+
+#endif  // STREAM_PARSE_MANAGER_H_
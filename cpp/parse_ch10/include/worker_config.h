@@ -3,6 +3,7 @@
 #define WORKER_CONFIG_H_
 
 #include <cstdint>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <sstream>
@@ -31,6 +32,9 @@ class WorkerConfig
     uint64_t append_read_bytes_;
     uint64_t total_bytes_;
 
+    // Time spent reading actual_read_bytes_ into the buffer, nanoseconds
+    uint64_t read_time_ns_;
+
     std::ifstream* input_stream_;
 
     /////////////////////////////////////// end new //////////////////////////////
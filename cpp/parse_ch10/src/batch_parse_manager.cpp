@@ -0,0 +1,417 @@
+// batch_parse_manager.cpp
+
+#include "batch_parse_manager.h"
+
+BatchParseManager::BatchParseManager() : pm_(), pmf_(), total_bytes_(0),
+    total_duration_(0.0), failed_count_(0), total_bytes(total_bytes_),
+    total_duration(total_duration_), failed_count(failed_count_)
+{}
+
+bool BatchParseManager::MatchWildcard(const std::string& pattern, const std::string& name)
+{
+    size_t pat_ind = 0;
+    size_t name_ind = 0;
+
+    // Position of the most recent '*' in pattern and the position in
+    // name at which it began matching, for backtracking
+    size_t star_ind = std::string::npos;
+    size_t star_match_ind = 0;
+
+    while (name_ind < name.size())
+    {
+        if (pat_ind < pattern.size() &&
+            (pattern[pat_ind] == '?' || pattern[pat_ind] == name[name_ind]))
+        {
+            pat_ind++;
+            name_ind++;
+        }
+        else if (pat_ind < pattern.size() && pattern[pat_ind] == '*')
+        {
+            star_ind = pat_ind;
+            star_match_ind = name_ind;
+            pat_ind++;
+        }
+        else if (star_ind != std::string::npos)
+        {
+            // Let the previous '*' consume one more char
+            pat_ind = star_ind + 1;
+            star_match_ind++;
+            name_ind = star_match_ind;
+        }
+        else
+            return false;
+    }
+
+    while (pat_ind < pattern.size() && pattern[pat_ind] == '*')
+        pat_ind++;
+
+    return pat_ind == pattern.size();
+}
+
+int BatchParseManager::CollectInputPaths(const std::string& input, const ArgumentValidation* av,
+    std::vector<ManagedPath>& input_paths)
+{
+    input_paths.clear();
+    std::vector<std::string> ch10_exts{"ch10", "c10"};
+    ManagedPath input_path(input);
+    bool success = false;
+
+    if (input_path.is_directory())
+    {
+        std::vector<ManagedPath> entries;
+        input_path.ListDirectoryEntries(success, entries);
+        if (!success)
+        {
+            printf("Failed to list entries in batch input directory: %s\n", input.c_str());
+            return EX_NOINPUT;
+        }
+
+        for (const auto& entry : ManagedPath::SelectFiles(entries))
+        {
+            if (av->CheckExtension(entry.RawString(), ch10_exts))
+                input_paths.push_back(entry);
+        }
+        std::sort(input_paths.begin(), input_paths.end(),
+            [](const ManagedPath& a, const ManagedPath& b) { return a.RawString() < b.RawString(); });
+    }
+    else if (input_path.filename().RawString().find_first_of("*?") != std::string::npos)
+    {
+        std::string pattern = input_path.filename().RawString();
+        ManagedPath parent_dir = input_path.parent_path();
+        if (parent_dir.RawString() == "")
+            parent_dir = ManagedPath(std::string("."));
+
+        std::vector<ManagedPath> entries;
+        parent_dir.ListDirectoryEntries(success, entries);
+        if (!success)
+        {
+            printf("Failed to list entries in directory: %s\n", parent_dir.RawString().c_str());
+            return EX_NOINPUT;
+        }
+
+        for (const auto& entry : ManagedPath::SelectFiles(entries))
+        {
+            if (MatchWildcard(pattern, entry.filename().RawString()) &&
+                av->CheckExtension(entry.RawString(), ch10_exts))
+                input_paths.push_back(entry);
+        }
+        std::sort(input_paths.begin(), input_paths.end(),
+            [](const ManagedPath& a, const ManagedPath& b) { return a.RawString() < b.RawString(); });
+    }
+    else if (av->CheckExtension(input, {"txt"}))
+    {
+        FileReader fr;
+        if (fr.ReadFile(input_path.string()) != 0)
+        {
+            printf("Failed to read batch input list: %s\n", input.c_str());
+            return EX_NOINPUT;
+        }
+
+        std::string whitespace(" \t\r\n");
+        std::string line;
+        size_t begin = 0;
+        for (const auto& raw_line : fr.GetLines())
+        {
+            begin = raw_line.find_first_not_of(whitespace);
+            if (begin == std::string::npos)
+                continue;
+            line = raw_line.substr(begin, raw_line.find_last_not_of(whitespace) - begin + 1);
+            if (line[0] == '#')
+                continue;
+
+            if (!av->CheckExtension(line, ch10_exts))
+            {
+                printf("Batch input list entry does not have one of the case-insensitive "
+                    "extensions ch10, c10: %s\n", line.c_str());
+                return EX_DATAERR;
+            }
+            input_paths.push_back(ManagedPath(line));
+        }
+    }
+    else
+    {
+        if (!av->CheckExtension(input, ch10_exts))
+        {
+            printf("Batch input (%s) is not a directory, list file (txt), wildcard pattern, "
+                "or file with one of the case-insensitive extensions: ch10, c10\n",
+                input.c_str());
+            return EX_DATAERR;
+        }
+        input_paths.push_back(input_path);
+    }
+
+    if (input_paths.size() == 0)
+    {
+        printf("No ch10 files found for batch input: %s\n", input.c_str());
+        return EX_NOINPUT;
+    }
+
+    for (const auto& path : input_paths)
+    {
+        if (!path.is_regular_file())
+        {
+            printf("Batch input path is not a file/does not exist: %s\n",
+                path.RawString().c_str());
+            return EX_NOINPUT;
+        }
+    }
+
+    // Per-file output directories are named from the input stem
+    std::set<std::string> stems;
+    for (const auto& path : input_paths)
+    {
+        if (!stems.insert(path.stem().RawString()).second)
+        {
+            printf("Batch input file name (%s) is not unique, outputs would collide: %s\n",
+                path.stem().RawString().c_str(), path.RawString().c_str());
+            return EX_DATAERR;
+        }
+    }
+
+    return EX_OK;
+}
+
+uint16_t BatchParseManager::GetMaxActiveWorkers(const ParserConfigParams& user_config)
+{
+    int max_active = std::max(user_config.parse_thread_count_, 1);
+    if (user_config.memory_limit_mb_ > 0 && user_config.parse_chunk_bytes_ > 0)
+    {
+        int mem_limited_count = user_config.memory_limit_mb_ / user_config.parse_chunk_bytes_;
+        max_active = std::min(max_active, std::max(mem_limited_count, 1));
+    }
+    return static_cast<uint16_t>(std::min(max_active, static_cast<int>(UINT16_MAX)));
+}
+
+int BatchParseManager::Parse(const std::vector<ManagedPath>& input_paths,
+    const ManagedPath& output_dir, const ParserConfigParams& user_config)
+{
+    total_bytes_ = 0;
+    total_duration_ = 0.0;
+    failed_count_ = 0;
+
+    std::vector<std::unique_ptr<BatchFile>> files;
+    for (const auto& path : input_paths)
+        files.push_back(std::make_unique<BatchFile>(path));
+
+    std::chrono::milliseconds worker_offset_wait_ms(user_config.worker_offset_wait_ms_);
+    std::chrono::milliseconds worker_shift_wait_ms(user_config.worker_shift_wait_ms_);
+    uint16_t max_active = GetMaxActiveWorkers(user_config);
+    spdlog::get("pm_logger")->info("BatchParse: {:d} files, {:d} maximum active workers",
+        files.size(), max_active);
+
+    auto batch_start_time = std::chrono::high_resolution_clock::now();
+    size_t complete_count = 0;
+    size_t active_count = 0;
+    bool progress = false;
+    bool success = false;
+    int retcode = 0;
+    while (complete_count < files.size())
+    {
+        progress = false;
+        active_count = 0;
+
+        // Join completed workers and finalize complete files
+        for (auto& file : files)
+        {
+            if (!file->configured_ || file->complete_)
+                continue;
+
+            if (JoinCompleted(file.get()) > 0)
+                progress = true;
+
+            AdvanceFile(file.get());
+            if (file->complete_)
+            {
+                complete_count++;
+                progress = true;
+                LogFileComplete(file.get());
+            }
+            active_count += file->active_workers_.size();
+        }
+
+        // Fill available slots with work units in file order. Files
+        // are configured only when all work units of prior files have
+        // been activated.
+        for (auto& file : files)
+        {
+            if (active_count >= max_active)
+                break;
+
+            if (file->complete_)
+                continue;
+
+            if (!file->configured_)
+            {
+                spdlog::get("pm_logger")->info("BatchParse: configuring {:s}",
+                    file->input_path_.RawString());
+                file->start_time_ = std::chrono::high_resolution_clock::now();
+                file->input_path_.GetFileSize(success, file->file_size_);
+                if ((retcode = pm_.Configure(&file->input_path_, output_dir, user_config,
+                    &pmf_, &file->parser_paths_, &file->metadata_, file->work_units_,
+                    file->ch10_stream_)) != 0)
+                {
+                    spdlog::get("pm_logger")->error("BatchParse: Configure failure for {:s}",
+                        file->input_path_.RawString());
+                    file->retcode_ = retcode;
+                    file->complete_ = true;
+                    file->ch10_stream_.close();
+                    complete_count++;
+                    LogFileComplete(file.get());
+                    continue;
+                }
+
+                for (auto& work_unit : file->work_units_)
+                    file->work_unit_ptrs_.push_back(&work_unit);
+                file->read_pos_ = pm_.GetParseBeginPosition();
+                file->configured_ = true;
+            }
+
+            while (active_count < max_active && file->HasPendingWorker())
+            {
+                if (!pmf_.ActivateWorker(file->work_unit_ptrs_.at(file->next_worker_),
+                    file->active_workers_, file->next_worker_, file->append_mode_,
+                    file->read_pos_))
+                {
+                    spdlog::get("pm_logger")->error("BatchParse: failed to activate worker "
+                        "{:d} for {:s}", file->next_worker_, file->input_path_.RawString());
+                    file->retcode_ = EX_SOFTWARE;
+                    break;
+                }
+                file->read_pos_ += file->work_unit_ptrs_.at(file->next_worker_)->GetReadBytes();
+                file->next_worker_++;
+                active_count++;
+                progress = true;
+
+                if (!file->append_mode_)
+                    std::this_thread::sleep_for(worker_offset_wait_ms);
+            }
+
+            // A file with no work units or an activation failure may
+            // be complete without any active workers.
+            AdvanceFile(file.get());
+            if (file->complete_)
+            {
+                complete_count++;
+                LogFileComplete(file.get());
+            }
+        }
+
+        if (!progress)
+            std::this_thread::sleep_for(worker_shift_wait_ms);
+    }
+
+    auto batch_stop_time = std::chrono::high_resolution_clock::now();
+    total_duration_ = (batch_stop_time - batch_start_time).count() / 1.0e9;
+
+    int batch_retcode = EX_OK;
+    for (const auto& file : files)
+    {
+        if (file->retcode_ != 0)
+        {
+            failed_count_++;
+            if (batch_retcode == EX_OK)
+                batch_retcode = file->retcode_;
+        }
+        else
+            total_bytes_ += file->file_size_;
+    }
+
+    LogSummary(files.size());
+    return batch_retcode;
+}
+
+uint16_t BatchParseManager::JoinCompleted(BatchFile* file)
+{
+    uint16_t joined_count = 0;
+    uint16_t worker_ind = 0;
+    int worker_retcode = 0;
+    size_t active_ind = 0;
+    while (active_ind < file->active_workers_.size())
+    {
+        worker_ind = file->active_workers_[active_ind];
+        if (!file->work_unit_ptrs_.at(worker_ind)->IsComplete())
+        {
+            active_ind++;
+            continue;
+        }
+
+        worker_retcode = file->work_unit_ptrs_.at(worker_ind)->ReturnValue();
+
+        // JoinWorker removes the element at active_ind
+        pmf_.JoinWorker(file->work_unit_ptrs_.at(worker_ind), file->active_workers_,
+            static_cast<uint16_t>(active_ind));
+        joined_count++;
+
+        if (worker_retcode != 0 && file->retcode_ == 0)
+        {
+            spdlog::get("pm_logger")->error("BatchParse: worker {:d} retcode = {:d} for {:s}",
+                worker_ind, worker_retcode, file->input_path_.RawString());
+            file->retcode_ = worker_retcode;
+        }
+    }
+    return joined_count;
+}
+
+void BatchParseManager::AdvanceFile(BatchFile* file)
+{
+    if (!file->configured_ || file->complete_ || !file->active_workers_.empty())
+        return;
+
+    if (file->retcode_ == 0)
+    {
+        if (file->next_worker_ < file->ModeWorkerCount())
+            return;
+
+        if (!file->append_mode_ && file->work_units_.size() > 1)
+        {
+            spdlog::get("pm_logger")->debug("BatchParse: begin append mode for {:s}",
+                file->input_path_.RawString());
+            file->append_mode_ = true;
+            file->next_worker_ = 0;
+            file->read_pos_ = 0;
+            return;
+        }
+
+        ManagedPath metadata_fname(pm_.metadata_filename_);
+        if (pm_.RecordMetadata(file->work_unit_ptrs_, &file->metadata_, metadata_fname) != 0)
+        {
+            spdlog::get("pm_logger")->error("BatchParse: RecordMetadata failure for {:s}",
+                file->input_path_.RawString());
+            file->retcode_ = EX_SOFTWARE;
+        }
+    }
+
+    file->ch10_stream_.close();
+    file->complete_ = true;
+    file->duration_ = (std::chrono::high_resolution_clock::now() - file->start_time_).count() / 1.0e9;
+
+    // Release contexts and buffers before the remaining files are parsed
+    file->work_unit_ptrs_.clear();
+    file->work_units_.clear();
+    file->work_units_.shrink_to_fit();
+}
+
+void BatchParseManager::LogFileComplete(const BatchFile* file) const
+{
+    if (file->retcode_ != 0)
+    {
+        spdlog::get("pm_logger")->error("BatchParse: failed to parse {:s} (retcode = {:d})",
+            file->input_path_.RawString(), file->retcode_);
+        return;
+    }
+
+    double mb = file->file_size_ / (1000.0 * 1000.0);
+    double rate = (file->duration_ > 0.0) ? mb / file->duration_ : 0.0;
+    spdlog::get("pm_logger")->info("BatchParse: parsed {:s}, {:.1f} MB in {:.3f} sec ({:.1f} MB/s)",
+        file->input_path_.RawString(), mb, file->duration_, rate);
+}
+
+void BatchParseManager::LogSummary(size_t file_count) const
+{
+    double mb = total_bytes_ / (1000.0 * 1000.0);
+    double rate = (total_duration_ > 0.0) ? mb / total_duration_ : 0.0;
+    spdlog::get("pm_logger")->info("BatchParse: {:d} of {:d} files parsed, {:d} failed",
+        file_count - failed_count_, file_count, failed_count_);
+    spdlog::get("pm_logger")->info("BatchParse: aggregate {:.1f} MB in {:.3f} sec ({:.1f} MB/s)",
+        mb, total_duration_, rate);
+}
@@ -0,0 +1,359 @@
+// ch10_packet_index.cpp
+
+#include "ch10_packet_index.h"
+
+namespace
+{
+bool ParseUInt64(const std::string& str, uint64_t& value)
+{
+    int base = 10;
+    std::string digits = str;
+    if (str.size() > 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X'))
+    {
+        base = 16;
+        digits = str.substr(2);
+    }
+
+    // strtoull accepts leading whitespace and sign, neither is permitted
+    if (digits.empty() || !isxdigit(static_cast<unsigned char>(digits[0])))
+        return false;
+
+    errno = 0;
+    char* end = nullptr;
+    value = strtoull(digits.c_str(), &end, base);
+    if (errno != 0 || *end != '\0')
+        return false;
+    return true;
+}
+
+// Split "<first>:<second>" into its components
+bool SplitRange(const std::string& str, std::string& first, std::string& second)
+{
+    size_t delim_pos = str.find(':');
+    if (delim_pos == std::string::npos)
+        return false;
+    first = str.substr(0, delim_pos);
+    second = str.substr(delim_pos + 1);
+    return true;
+}
+}  // namespace
+
+bool Ch10PacketSelection::Initialize(const ParserConfigParams& config)
+{
+    std::string first;
+    std::string second;
+    ParseText pt;
+
+    has_time_range_ = false;
+    if (config.time_range_str_ != "")
+    {
+        if (!SplitRange(config.time_range_str_, first, second) ||
+            !pt.ConvertDouble(first, start_sec_) || !pt.ConvertDouble(second, end_sec_))
+        {
+            printf("Time range \"%s\" must be of the form <start>:<end> in seconds\n",
+                   config.time_range_str_.c_str());
+            return false;
+        }
+        if (start_sec_ < 0.0 || end_sec_ <= start_sec_)
+        {
+            printf("Time range \"%s\" start must be non-negative and less than end\n",
+                   config.time_range_str_.c_str());
+            return false;
+        }
+        has_time_range_ = true;
+    }
+
+    has_byte_range_ = false;
+    if (config.byte_range_str_ != "")
+    {
+        if (!SplitRange(config.byte_range_str_, first, second) ||
+            !ParseUInt64(first, begin_byte_) || !ParseUInt64(second, end_byte_))
+        {
+            printf("Byte range \"%s\" must be of the form <begin>:<end>\n",
+                   config.byte_range_str_.c_str());
+            return false;
+        }
+        if (end_byte_ <= begin_byte_)
+        {
+            printf("Byte range \"%s\" begin must be less than end\n",
+                   config.byte_range_str_.c_str());
+            return false;
+        }
+        has_byte_range_ = true;
+    }
+
+    channel_ids_.clear();
+    if (config.channel_ids_str_ != "")
+    {
+        int chanid = 0;
+        std::vector<std::string> chanid_strs = pt.Split(config.channel_ids_str_, ',');
+        for (const auto& chanid_str : chanid_strs)
+        {
+            if (!pt.ConvertInt(chanid_str, chanid) || chanid < 0 || chanid > UINT16_MAX)
+            {
+                printf("Channel ID \"%s\" is not an integer in range [0, %d]\n",
+                       chanid_str.c_str(), UINT16_MAX);
+                return false;
+            }
+            channel_ids_.insert(static_cast<uint16_t>(chanid));
+        }
+    }
+
+    return true;
+}
+
+const char Ch10PacketIndex::magic_[8] = {'T', 'I', 'P', 'P', 'K', 'I', 'D', 'X'};
+const uint32_t Ch10PacketIndex::version_ = 1;
+const std::string Ch10PacketIndex::extension_ = ".tipidx";
+
+Ch10PacketIndex::Ch10PacketIndex() : entries_(), ch10_size_(0), ch10_mtime_(0),
+    entries(entries_)
+{}
+
+ManagedPath Ch10PacketIndex::GetIndexPath(const ManagedPath& ch10_path)
+{
+    ManagedPath index_path(ch10_path);
+    index_path += extension_;
+    return index_path;
+}
+
+bool Ch10PacketIndex::GetFileStamp(const ManagedPath& path, uint64_t& size, int64_t& mtime)
+{
+    std::error_code ec;
+    size = static_cast<uint64_t>(std::filesystem::file_size(path, ec));
+    if (ec)
+        return false;
+
+    std::filesystem::file_time_type write_time = std::filesystem::last_write_time(path, ec);
+    if (ec)
+        return false;
+    mtime = static_cast<int64_t>(write_time.time_since_epoch().count());
+    return true;
+}
+
+int Ch10PacketIndex::Build(const ManagedPath& ch10_path)
+{
+    entries_.clear();
+    if (!GetFileStamp(ch10_path, ch10_size_, ch10_mtime_))
+    {
+        spdlog::get("pm_logger")->error("Ch10PacketIndex: failed to stat {:s}",
+            ch10_path.RawString());
+        return EX_NOINPUT;
+    }
+
+    MemoryMappedFile ch10_file;
+    int retcode = 0;
+    if ((retcode = ch10_file.Open(ch10_path)) != EX_OK)
+        return retcode;
+
+    IndexBuffer(ch10_file.data(), ch10_file.size());
+    spdlog::get("pm_logger")->info("Ch10PacketIndex: indexed {:d} packets", entries_.size());
+    return EX_OK;
+}
+
+void Ch10PacketIndex::IndexBuffer(const uint8_t* data, uint64_t size)
+{
+    entries_.clear();
+
+    // Time data packets are parsed with the same component used by
+    // the parser to obtain identical absolute time.
+    Ch10Context ctx(0, 0);
+    Ch10TDPComponent tdp(&ctx);
+    Ch10Time ch10_time;
+
+    const uint64_t std_hdr_size = sizeof(Ch10PacketHeaderFmt);
+    const uint64_t secondary_hdr_size = 12;
+    const uint16_t sync = 0xEB25;
+    const Ch10PacketHeaderFmt* hdr = nullptr;
+    const uint16_t* hdr_words = nullptr;
+    const uint8_t* body = nullptr;
+    uint16_t checksum = 0;
+    Ch10PacketIndexEntry entry{};
+
+    uint64_t pos = 0;
+    while (pos + std_hdr_size <= size)
+    {
+        hdr = reinterpret_cast<const Ch10PacketHeaderFmt*>(data + pos);
+        if (hdr->sync != sync)
+        {
+            pos++;
+            continue;
+        }
+
+        // The header checksum is the 16-bit sum of the header words which
+        // precede it. A failed checksum is treated as a bad sync.
+        hdr_words = reinterpret_cast<const uint16_t*>(hdr);
+        checksum = 0;
+        for (uint64_t i = 0; i < (std_hdr_size - 2) / 2; i++)
+            checksum += hdr_words[i];
+        if (checksum != hdr->checksum || hdr->pkt_size < std_hdr_size)
+        {
+            pos++;
+            continue;
+        }
+
+        // Incomplete final packet
+        if (pos + hdr->pkt_size > size)
+            break;
+
+        entry.position = pos;
+        entry.rtc = ch10_time.CalculateRTCTimeFromComponents(hdr->rtc1, hdr->rtc2);
+        entry.pkt_size = hdr->pkt_size;
+        entry.channel_id = static_cast<uint16_t>(hdr->chanID);
+        entry.data_type = static_cast<uint8_t>(hdr->data_type);
+
+        if (hdr->data_type == static_cast<uint8_t>(Ch10PacketType::TIME_DATA_F1))
+        {
+            if (ctx.UpdateContext(pos + hdr->pkt_size, hdr, entry.rtc) == Ch10Status::OK)
+            {
+                body = data + pos + std_hdr_size;
+                if (hdr->secondary_hdr)
+                    body += secondary_hdr_size;
+                tdp.Parse(body);
+            }
+        }
+
+        entry.abs_time = ctx.found_tdp ? ctx.CalculateAbsTimeFromRTCFormat(entry.rtc) : 0;
+        entries_.push_back(entry);
+        pos += hdr->pkt_size;
+    }
+}
+
+int Ch10PacketIndex::Write(const ManagedPath& index_path) const
+{
+    std::ofstream outfile(index_path.string(), std::ios::binary | std::ios::trunc);
+    if (!outfile.is_open())
+        return EX_CANTCREAT;
+
+    uint32_t entry_size = sizeof(Ch10PacketIndexEntry);
+    uint64_t count = entries_.size();
+    outfile.write(magic_, sizeof(magic_));
+    outfile.write(reinterpret_cast<const char*>(&version_), sizeof(version_));
+    outfile.write(reinterpret_cast<const char*>(&entry_size), sizeof(entry_size));
+    outfile.write(reinterpret_cast<const char*>(&ch10_size_), sizeof(ch10_size_));
+    outfile.write(reinterpret_cast<const char*>(&ch10_mtime_), sizeof(ch10_mtime_));
+    outfile.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    outfile.write(reinterpret_cast<const char*>(entries_.data()), count * entry_size);
+    if (!outfile.good())
+        return EX_IOERR;
+    return EX_OK;
+}
+
+int Ch10PacketIndex::Read(const ManagedPath& index_path, const ManagedPath& ch10_path)
+{
+    entries_.clear();
+    std::ifstream infile(index_path.string(), std::ios::binary);
+    if (!infile.is_open())
+        return EX_NOINPUT;
+
+    char magic[sizeof(magic_)];
+    uint32_t version = 0;
+    uint32_t entry_size = 0;
+    uint64_t count = 0;
+    infile.read(magic, sizeof(magic));
+    infile.read(reinterpret_cast<char*>(&version), sizeof(version));
+    infile.read(reinterpret_cast<char*>(&entry_size), sizeof(entry_size));
+    infile.read(reinterpret_cast<char*>(&ch10_size_), sizeof(ch10_size_));
+    infile.read(reinterpret_cast<char*>(&ch10_mtime_), sizeof(ch10_mtime_));
+    infile.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (!infile.good() || memcmp(magic, magic_, sizeof(magic_)) != 0 ||
+        version != version_ || entry_size != sizeof(Ch10PacketIndexEntry))
+        return EX_DATAERR;
+
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    if (!GetFileStamp(ch10_path, size, mtime) || size != ch10_size_ || mtime != ch10_mtime_)
+        return EX_DATAERR;
+
+    // Bound the allocation by the ch10 size, each packet is at
+    // least a header.
+    if (count > ch10_size_ / sizeof(Ch10PacketHeaderFmt))
+        return EX_DATAERR;
+
+    entries_.resize(count);
+    infile.read(reinterpret_cast<char*>(entries_.data()), count * entry_size);
+    if (static_cast<uint64_t>(infile.gcount()) != count * entry_size)
+    {
+        entries_.clear();
+        return EX_DATAERR;
+    }
+    return EX_OK;
+}
+
+int Ch10PacketIndex::LoadOrBuild(const ManagedPath& ch10_path)
+{
+    ManagedPath index_path = GetIndexPath(ch10_path);
+    if (Read(index_path, ch10_path) == EX_OK)
+    {
+        spdlog::get("pm_logger")->info("Ch10PacketIndex: read {:d} packets from {:s}",
+            entries_.size(), index_path.RawString());
+        return EX_OK;
+    }
+
+    int retcode = 0;
+    if ((retcode = Build(ch10_path)) != EX_OK)
+        return retcode;
+
+    if (Write(index_path) != EX_OK)
+        spdlog::get("pm_logger")->warn("Ch10PacketIndex: failed to write {:s}",
+            index_path.RawString());
+    return EX_OK;
+}
+
+bool Ch10PacketIndex::SelectRange(const Ch10PacketSelection& selection, uint64_t& parse_begin,
+    uint64_t& data_begin, uint64_t& parse_end) const
+{
+    using EntryIt = std::vector<Ch10PacketIndexEntry>::const_iterator;
+    EntryIt lo = entries_.cbegin();
+    EntryIt hi = entries_.cend();
+
+    if (selection.has_byte_range_)
+    {
+        lo = std::partition_point(entries_.cbegin(), entries_.cend(),
+            [&selection](const Ch10PacketIndexEntry& e) { return e.position < selection.begin_byte_; });
+        hi = std::partition_point(entries_.cbegin(), entries_.cend(),
+            [&selection](const Ch10PacketIndexEntry& e) { return e.position < selection.end_byte_; });
+    }
+
+    if (selection.has_time_range_)
+    {
+        EntryIt first_timed = std::find_if(entries_.cbegin(), entries_.cend(),
+            [](const Ch10PacketIndexEntry& e) { return e.abs_time != 0; });
+        if (first_timed == entries_.cend())
+        {
+            spdlog::get("pm_logger")->error("Ch10PacketIndex: time range selected but "
+                "no packets have absolute time");
+            return false;
+        }
+
+        // Packets without absolute time precede first_timed and compare
+        // less than any time in the range.
+        uint64_t start_time = first_timed->abs_time + static_cast<uint64_t>(selection.start_sec_ * 1e9);
+        uint64_t end_time = first_timed->abs_time + static_cast<uint64_t>(selection.end_sec_ * 1e9);
+        EntryIt time_lo = std::partition_point(entries_.cbegin(), entries_.cend(),
+            [start_time](const Ch10PacketIndexEntry& e) { return e.abs_time < start_time; });
+        EntryIt time_hi = std::partition_point(entries_.cbegin(), entries_.cend(),
+            [end_time](const Ch10PacketIndexEntry& e) { return e.abs_time <= end_time; });
+        lo = std::max(lo, time_lo);
+        hi = std::min(hi, time_hi);
+    }
+
+    if (lo >= hi)
+        return false;
+
+    data_begin = lo->position;
+    parse_end = (hi - 1)->position + (hi - 1)->pkt_size;
+
+    // Begin at the preceding time data packet, if any.
+    parse_begin = data_begin;
+    for (EntryIt it = lo + 1; it != entries_.cbegin();)
+    {
+        --it;
+        if (it->data_type == static_cast<uint8_t>(Ch10PacketType::TIME_DATA_F1))
+        {
+            parse_begin = it->position;
+            break;
+        }
+    }
+    return true;
+}
@@ -34,14 +34,37 @@ int Ch10ParseMain(int argc, char** argv)
 
     config.MakeCh10PacketEnabledMap();
 
+    // Validate the packet selection before logging is configured
+    // such that errors are printed.
+    Ch10PacketSelection selection;
+    if (!selection.Initialize(config))
+        return EX_USAGE;
+    if (config.stream_mode_ && selection.HasRange())
+    {
+        printf("Time and byte ranges can't be selected in follow mode\n");
+        return EX_USAGE;
+    }
+    if (config.perf_stats_path_str_ != "" && 
+        !PerfReport::IsSupportedPath(ManagedPath(config.perf_stats_path_str_)))
+    {
+        printf("Performance statistics path must have extension .json or .prom\n");
+        return EX_USAGE;
+    }
+
     ManagedPath input_path;
     ManagedPath output_path;
     ManagedPath log_dir;
     ArgumentValidation av;
+    if (config.batch_mode_)
+        return Ch10BatchParseMain(config, &av);
+
     if ((retcode = ValidatePaths(config.input_path_str_, config.output_path_str_, 
                        config.log_path_str_, input_path, output_path, log_dir, &av)) != 0)
         return retcode;
 
+    if (config.stream_mode_)
+        return Ch10StreamParseMain(config, input_path, output_path, log_dir);
+
     spdlog::level::level_enum stdout_level = spdlog::level::from_str(config.stdout_log_level_);
     spdlog::level::level_enum file_level = spdlog::level::from_str(config.file_log_level_);
     if ((retcode = SetupLogging(log_dir, stdout_level, file_level)) != 0)
@@ -66,6 +89,98 @@ int Ch10ParseMain(int argc, char** argv)
 
 }
 
+int Ch10BatchParseMain(const ParserConfigParams& config, const ArgumentValidation* av)
+{
+    int retcode = 0;
+    std::vector<ManagedPath> input_paths;
+    ManagedPath output_path;
+    ManagedPath log_dir;
+    if ((retcode = ValidateBatchPaths(config.input_path_str_, config.output_path_str_, 
+                       config.log_path_str_, input_paths, output_path, log_dir, av)) != 0)
+        return retcode;
+
+    spdlog::level::level_enum stdout_level = spdlog::level::from_str(config.stdout_log_level_);
+    spdlog::level::level_enum file_level = spdlog::level::from_str(config.file_log_level_);
+    if ((retcode = SetupLogging(log_dir, stdout_level, file_level)) != 0)
+        return retcode;
+
+    spdlog::get("pm_logger")->info(CH10_PARSE_EXE_NAME " version: {:s}", GetVersionString());
+    spdlog::get("pm_logger")->info("Batch input: {:s} ({:d} ch10 files)", 
+        config.input_path_str_, input_paths.size());
+    spdlog::get("pm_logger")->info("Output path: {:s}", output_path.absolute().RawString());
+    spdlog::get("pm_logger")->info("Log directory: {:s}", log_dir.absolute().RawString());
+
+    BatchParseManager bpm;
+    retcode = bpm.Parse(input_paths, output_path, config);
+    spdlog::get("pm_logger")->info("Duration: {:.3f} sec", bpm.total_duration);
+
+    // Avoid deadlock in windows, see Ch10ParseMain
+    spdlog::shutdown();
+
+    return retcode;
+}
+
+int Ch10StreamParseMain(const ParserConfigParams& config, const ManagedPath& input_path,
+    const ManagedPath& output_path, const ManagedPath& log_dir)
+{
+    int retcode = 0;
+    spdlog::level::level_enum stdout_level = spdlog::level::from_str(config.stdout_log_level_);
+    spdlog::level::level_enum file_level = spdlog::level::from_str(config.file_log_level_);
+    if ((retcode = SetupLogging(log_dir, stdout_level, file_level)) != 0)
+        return retcode;
+
+    spdlog::get("pm_logger")->info(CH10_PARSE_EXE_NAME " version: {:s}", GetVersionString());
+    spdlog::get("pm_logger")->info("Ch10 file path (follow): {:s}", input_path.absolute().RawString());
+    spdlog::get("pm_logger")->info("Output path: {:s}", output_path.absolute().RawString());
+    spdlog::get("pm_logger")->info("Log directory: {:s}", log_dir.absolute().RawString());
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    StreamParseManager spm;
+    if ((retcode = spm.Configure(input_path, output_path, config)) == EX_OK)
+        retcode = spm.Follow();
+
+    auto stop_time = std::chrono::high_resolution_clock::now();
+    spdlog::get("pm_logger")->info("Duration: {:.3f} sec", 
+        (stop_time - start_time).count() / 1.0e9);
+
+    // Avoid deadlock in windows, see Ch10ParseMain
+    spdlog::shutdown();
+
+    return retcode;
+}
+
+int ValidateBatchPaths(const std::string& str_input_path, const std::string& str_output_path,
+                   const std::string& str_log_dir, std::vector<ManagedPath>& input_paths, 
+                   ManagedPath& output_path, ManagedPath& log_dir, const ArgumentValidation* av)
+{
+    int retcode = 0;
+    if ((retcode = BatchParseManager::CollectInputPaths(str_input_path, av, input_paths)) != 0)
+        return retcode;
+
+    // If no output path is specified, use the directory of the first input.
+    if (str_output_path == "")
+    {
+        output_path = input_paths.at(0).absolute().parent_path();
+    }
+    else
+    {
+        if (!av->ValidateDirectoryPath(str_output_path, output_path))
+        {
+            printf("Output path is not a directory: %s\n",
+                   str_output_path.c_str());
+            return EX_NOINPUT;
+        }
+    }
+
+    if (!av->ValidateDirectoryPath(str_log_dir, log_dir))
+    {
+        printf("Log path is not a directory: %s\n", str_log_dir.c_str());
+        return EX_NOINPUT;
+    }
+
+    return EX_OK;
+}
+
 int ValidatePaths(const std::string& str_input_path, const std::string& str_output_path,
                    const std::string& str_log_dir, ManagedPath& input_path, 
                    ManagedPath& output_path, ManagedPath& log_dir, const ArgumentValidation* av)
@@ -2,7 +2,8 @@
 
 #include "parse_manager.h"
 
-ParseManager::ParseManager() : retcode_(0) {}
+ParseManager::ParseManager() : retcode_(0), parse_begin_position_(0), parse_end_position_(0),
+    progress_(nullptr) {}
 
 ParseManager::~ParseManager()
 {}
@@ -43,7 +44,22 @@ int Parse(ManagedPath ch10_path, ManagedPath out_dir, const ParserConfigParams&
     for (std::vector<WorkUnit>::iterator it = work_units.begin(); it != work_units.end(); ++it)
         work_unit_ptrs.push_back(&(*it));
 
-    if((retcode = ParseCh10(work_unit_ptrs, &pmf, &pm, config)) != 0)
+    std::unique_ptr<ParseProgress> progress;
+    if (config.progress_interval_sec_ > 0)
+    {
+        progress = std::make_unique<ParseProgress>(pm.GetParseBeginPosition(),
+            pm.GetParseEndPosition(), config.progress_interval_sec_, config.progress_path_str_);
+        pm.SetProgress(progress.get());
+        progress->Start();
+    }
+
+    retcode = ParseCh10(work_unit_ptrs, &pmf, &pm, config);
+    if (progress)
+    {
+        progress->Stop(retcode == 0);
+        pm.SetProgress(nullptr);
+    }
+    if(retcode != 0)
     {
         spdlog::get("pm_logger")->error("Parse error: ParseCh10 failure");
         ch10_input_stream.close();
@@ -77,9 +93,46 @@ int ParseManager::Configure(const ManagedPath* input_ch10_file_path, ManagedPath
     }
     spdlog::get("pm_logger")->info("Ch10 file size: {:f} MB", ch10_file_size / (1000.0 * 1000.0));
 
+    // Restrict parsing to the packets in the selected range, if any.
+    int retcode = 0;
+    uint64_t parse_end = ch10_file_size;
+    uint64_t data_begin = 0;
+    parse_begin_position_ = 0;
+    Ch10PacketSelection selection;
+    if (!selection.Initialize(user_config))
+    {
+        spdlog::get("pm_logger")->error("Configure error: invalid packet selection");
+        return EX_USAGE;
+    }
+    PCMF1FrameFormat pcmf1_frame_format;
+    if (!user_config.MakePCMF1FrameFormat(pcmf1_frame_format))
+    {
+        spdlog::get("pm_logger")->error("Configure error: invalid PCM frame format");
+        return EX_USAGE;
+    }
+    if (selection.HasRange())
+    {
+        Ch10PacketIndex index;
+        if ((retcode = index.LoadOrBuild(*input_ch10_file_path)) != EX_OK)
+        {
+            spdlog::get("pm_logger")->error("Configure error: Ch10PacketIndex failure");
+            return retcode;
+        }
+        if (!index.SelectRange(selection, parse_begin_position_, data_begin, parse_end))
+        {
+            spdlog::get("pm_logger")->error("Configure error: no packets in selected range");
+            return EX_DATAERR;
+        }
+        spdlog::get("pm_logger")->info("Selected range: [{:d}, {:d}), parsing from {:d}",
+            data_begin, parse_end, parse_begin_position_);
+    }
+
+    parse_end_position_ = parse_end;
+
     uint64_t chunk_bytes = 0;
     uint16_t worker_count = 0;
-    pmf->IngestUserConfig(user_config, ch10_file_size, chunk_bytes, worker_count);
+    pmf->IngestUserConfig(user_config, parse_end - parse_begin_position_, chunk_bytes, 
+        worker_count);
 
     if(!parser_paths->CreateOutputPaths(*input_ch10_file_path, output_dir, 
         user_config.ch10_packet_enabled_map_, worker_count))
@@ -89,13 +142,32 @@ int ParseManager::Configure(const ManagedPath* input_ch10_file_path, ManagedPath
     }
 
     if(!pmf->MakeWorkUnits(work_units, worker_count, chunk_bytes, append_chunk_size_bytes_, 
-        ch10_file_size, ch10_stream, parser_paths))
+        parse_end, ch10_stream, parser_paths))
     {
         spdlog::get("pm_logger")->error("Configure error: MakeWorkUnits failure");
         return EX_SOFTWARE;
     }
 
-    int retcode = 0;
+    if (selection.IsActive())
+    {
+        for (std::vector<WorkUnit>::iterator it = work_units.begin(); it != work_units.end(); ++it)
+            it->ctx_->SetPacketSelection(data_begin, selection.channel_ids_);
+    }
+
+    Ch10ChecksumPolicy checksum_policy = Ch10ChecksumPolicy::ALWAYS;
+    if (string_to_ch10checksumpolicy_map.count(user_config.checksum_policy_str_) == 1)
+        checksum_policy = string_to_ch10checksumpolicy_map.at(user_config.checksum_policy_str_);
+    for (std::vector<WorkUnit>::iterator it = work_units.begin(); it != work_units.end(); ++it)
+        it->ctx_->SetDataChecksumPolicy(checksum_policy, 
+            static_cast<uint32_t>(user_config.checksum_sample_interval_));
+
+    for (std::vector<WorkUnit>::iterator it = work_units.begin(); it != work_units.end(); ++it)
+    {
+        it->ctx_->SetPCMF1FrameFormat(pcmf1_frame_format);
+        it->ctx_->SetAnalogF1Decimation(static_cast<uint32_t>(user_config.analog_decimation_));
+        it->ctx_->SetDirectParquetWrite(user_config.direct_write_);
+    }
+
     if((retcode = metadata->Initialize(*input_ch10_file_path, user_config, *parser_paths)) != 0)
     {
         spdlog::get("pm_logger")->error("Configure error: ParserMetadata::Initialize failure");
@@ -168,7 +240,7 @@ int ParseManager::StartThreads(bool append_mode,
 
     uint16_t active_thread_count = 0;
     bool thread_started = false;
-    uint64_t total_read_pos = 0;
+    uint64_t total_read_pos = parse_begin_position_;
 
     spdlog::get("pm_logger")->debug("StartThreads: Starting worker threads");
     for (uint16_t worker_ind = 0; worker_ind < effective_worker_count; worker_ind++)
@@ -204,6 +276,9 @@ int ParseManager::ActivateInitialThread(ParseManagerFunctions* pmf, bool append_
 
         if(!pmf->ActivateWorker(work_unit, active_workers, worker_index, append_mode, read_pos))
             return EX_SOFTWARE;
+        if (progress_ != nullptr && !append_mode)
+            progress_->WorkerStarted(worker_index, read_pos, work_unit->GetReadBytes(),
+                &work_unit->ctx_->absolute_position);
 
         active_thread_count += 1;
         read_pos += work_unit->GetReadBytes();
@@ -245,6 +320,8 @@ int ParseManager::ActivateAvailableThread(ParseManagerFunctions* pmf, bool appen
                 // Join the recently completed worker
                 pmf->JoinWorker(work_units.at(current_active_worker), active_workers,
                     active_worker_ind);
+                if (progress_ != nullptr)
+                    progress_->WorkerComplete(current_active_worker);
 
                 if(retcode != 0)
                 {
@@ -256,6 +333,10 @@ int ParseManager::ActivateAvailableThread(ParseManagerFunctions* pmf, bool appen
                 if(!pmf->ActivateWorker(work_units.at(worker_index), active_workers, 
                     worker_index, append_mode, read_pos))
                     return EX_SOFTWARE;
+                if (progress_ != nullptr && !append_mode)
+                    progress_->WorkerStarted(worker_index, read_pos,
+                        work_units.at(worker_index)->GetReadBytes(),
+                        &work_units.at(worker_index)->ctx_->absolute_position);
 
                 thread_started = true;
                 read_pos += work_units.at(worker_index)->GetReadBytes();
@@ -298,6 +379,8 @@ bool ParseManager::StopThreads(std::vector<WorkUnit*>& work_units,
 
                 pmf->JoinWorker(work_units.at(current_active_worker), active_workers_vec,
                     active_worker_ind);
+                if (progress_ != nullptr)
+                    progress_->WorkerComplete(current_active_worker);
 
                 spdlog::get("pm_logger")->debug("StopThreads: worker {:d} joined", 
                     current_active_worker);
@@ -0,0 +1,247 @@
+#include "parse_progress.h"
+
+ParseProgress::ParseProgress(uint64_t begin_position, uint64_t end_position, int interval_sec,
+    const std::string& output_path) : begin_position_(begin_position),
+    end_position_(end_position < begin_position ? begin_position : end_position),
+    interval_(std::chrono::milliseconds(static_cast<int64_t>(interval_sec) * 1000)),
+    output_path_(output_path), write_output_(output_path != ""), workers_(),
+    start_time_(std::chrono::steady_clock::now()), last_sample_time_(start_time_),
+    last_done_bytes_(0), stop_requested_(false), thread_()
+{}
+
+ParseProgress::~ParseProgress()
+{
+    if (thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_requested_ = true;
+        }
+        stop_cv_.notify_all();
+        thread_.join();
+    }
+}
+
+void ParseProgress::Start()
+{
+    start_time_ = std::chrono::steady_clock::now();
+    last_sample_time_ = start_time_;
+    last_done_bytes_ = 0;
+    stop_requested_ = false;
+    thread_ = std::thread(&ParseProgress::Run, this);
+}
+
+void ParseProgress::Stop(bool success)
+{
+    if (thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_requested_ = true;
+        }
+        stop_cv_.notify_all();
+        thread_.join();
+    }
+
+    if (write_output_)
+    {
+        ProgressSample sample = Sample(std::chrono::steady_clock::now());
+        WriteFile(output_path_, FormatJSON(sample, success ? "complete" : "failed"));
+    }
+}
+
+void ParseProgress::Run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_cv_.wait_for(lock, interval_, [this] { return stop_requested_; }))
+    {
+        lock.unlock();
+        ProgressSample sample = Sample(std::chrono::steady_clock::now());
+        spdlog::get("pm_logger")->info(FormatLog(sample));
+        if (write_output_)
+            WriteFile(output_path_, FormatJSON(sample, "running"));
+        lock.lock();
+    }
+}
+
+void ParseProgress::WorkerStarted(uint16_t worker_index, uint64_t start_position,
+    uint64_t chunk_bytes, const std::atomic<uint64_t>* position)
+{
+    WorkerState state{worker_index, start_position, chunk_bytes, position,
+        std::chrono::steady_clock::now(), false};
+    std::lock_guard<std::mutex> lock(mutex_);
+    workers_.push_back(state);
+}
+
+void ParseProgress::WorkerComplete(uint16_t worker_index)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::vector<WorkerState>::iterator it = workers_.begin(); it != workers_.end(); ++it)
+    {
+        if (it->worker_index == worker_index)
+            it->complete = true;
+    }
+}
+
+ProgressSample ParseProgress::Sample(const std::chrono::steady_clock::time_point& now)
+{
+    ProgressSample sample;
+    sample.total_bytes = end_position_ - begin_position_;
+    sample.done_bytes = 0;
+    sample.elapsed_sec = std::chrono::duration<double>(now - start_time_).count();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t max_active_done = 0;
+    uint64_t position = 0;
+    for (std::vector<WorkerState>::const_iterator it = workers_.cbegin();
+         it != workers_.cend(); ++it)
+    {
+        WorkerProgress worker;
+        worker.worker_index = it->worker_index;
+        worker.chunk_bytes = it->chunk_bytes;
+        worker.complete = it->complete;
+        worker.lag_bytes = 0;
+        if (it->complete)
+            worker.done_bytes = it->chunk_bytes;
+        else
+        {
+            // The position may be stale until the worker initializes its
+            // context and may exceed the chunk when the final packet
+            // extends beyond it.
+            position = it->position->load(std::memory_order_relaxed);
+            if (position <= it->start_position)
+                worker.done_bytes = 0;
+            else
+                worker.done_bytes = std::min(position - it->start_position, it->chunk_bytes);
+            max_active_done = std::max(max_active_done, worker.done_bytes);
+        }
+
+        double worker_sec = std::chrono::duration<double>(now - it->start_time).count();
+        worker.mb_per_sec = (worker_sec > 0.0) ? worker.done_bytes / 1.0e6 / worker_sec : 0.0;
+        sample.done_bytes += worker.done_bytes;
+        sample.workers.push_back(worker);
+    }
+
+    for (std::vector<WorkerProgress>::iterator it = sample.workers.begin();
+         it != sample.workers.end(); ++it)
+    {
+        if (!it->complete)
+            it->lag_bytes = max_active_done - it->done_bytes;
+    }
+    sample.done_bytes = std::min(sample.done_bytes, sample.total_bytes);
+
+    sample.average_mb_per_sec = (sample.elapsed_sec > 0.0) ?
+        sample.done_bytes / 1.0e6 / sample.elapsed_sec : 0.0;
+    double interval_sec = std::chrono::duration<double>(now - last_sample_time_).count();
+    if (interval_sec > 0.0 && sample.done_bytes >= last_done_bytes_)
+        sample.mb_per_sec = (sample.done_bytes - last_done_bytes_) / 1.0e6 / interval_sec;
+    else
+        sample.mb_per_sec = sample.average_mb_per_sec;
+    last_sample_time_ = now;
+    last_done_bytes_ = sample.done_bytes;
+
+    // Estimate the time remaining from the average rate, which is less
+    // sensitive than the recent rate to workers starting and stopping.
+    uint64_t remaining_bytes = sample.total_bytes - sample.done_bytes;
+    if (remaining_bytes == 0)
+        sample.eta_sec = 0.0;
+    else if (sample.average_mb_per_sec > 0.0)
+        sample.eta_sec = remaining_bytes / 1.0e6 / sample.average_mb_per_sec;
+    else
+        sample.eta_sec = -1.0;
+
+    return sample;
+}
+
+std::string ParseProgress::FormatLog(const ProgressSample& sample)
+{
+    char buffer[256];
+    double percent = (sample.total_bytes > 0) ?
+        100.0 * sample.done_bytes / sample.total_bytes : 100.0;
+    if (sample.eta_sec < 0.0)
+        snprintf(buffer, sizeof(buffer), "Progress: %.1f%% (%.1f/%.1f MB), %.1f MB/s, ETA unknown",
+            percent, sample.done_bytes / 1.0e6, sample.total_bytes / 1.0e6, sample.mb_per_sec);
+    else
+        snprintf(buffer, sizeof(buffer), "Progress: %.1f%% (%.1f/%.1f MB), %.1f MB/s, ETA %.0f s",
+            percent, sample.done_bytes / 1.0e6, sample.total_bytes / 1.0e6, sample.mb_per_sec,
+            sample.eta_sec);
+    std::string line(buffer);
+
+    // Lag of active workers
+    std::string lag;
+    for (std::vector<WorkerProgress>::const_iterator it = sample.workers.cbegin();
+         it != sample.workers.cend(); ++it)
+    {
+        if (it->complete)
+            continue;
+        snprintf(buffer, sizeof(buffer), "%s%02u %.1f MB/s %.1f MB", lag.empty() ? "" : ", ",
+            static_cast<unsigned int>(it->worker_index), it->mb_per_sec, it->lag_bytes / 1.0e6);
+        lag += buffer;
+    }
+    if (!lag.empty())
+        line += ", worker rate/lag: " + lag;
+    return line;
+}
+
+std::string ParseProgress::FormatJSON(const ProgressSample& sample, const std::string& state)
+{
+    char buffer[512];
+    snprintf(buffer, sizeof(buffer),
+        "{\n"
+        "  \"state\": \"%s\",\n"
+        "  \"elapsed_sec\": %.3f,\n"
+        "  \"done_bytes\": %llu,\n"
+        "  \"total_bytes\": %llu,\n"
+        "  \"mb_per_sec\": %.3f,\n"
+        "  \"average_mb_per_sec\": %.3f,\n"
+        "  \"eta_sec\": %.3f,\n"
+        "  \"workers\": [",
+        state.c_str(), sample.elapsed_sec,
+        static_cast<unsigned long long>(sample.done_bytes),
+        static_cast<unsigned long long>(sample.total_bytes),
+        sample.mb_per_sec, sample.average_mb_per_sec, sample.eta_sec);
+    std::string json(buffer);
+
+    for (std::vector<WorkerProgress>::const_iterator it = sample.workers.cbegin();
+         it != sample.workers.cend(); ++it)
+    {
+        snprintf(buffer, sizeof(buffer),
+            "%s\n    {\"worker\": %u, \"done_bytes\": %llu, \"chunk_bytes\": %llu, "
+            "\"mb_per_sec\": %.3f, \"lag_bytes\": %llu, \"complete\": %s}",
+            it == sample.workers.cbegin() ? "" : ",",
+            static_cast<unsigned int>(it->worker_index),
+            static_cast<unsigned long long>(it->done_bytes),
+            static_cast<unsigned long long>(it->chunk_bytes), it->mb_per_sec,
+            static_cast<unsigned long long>(it->lag_bytes), it->complete ? "true" : "false");
+        json += buffer;
+    }
+    json += (sample.workers.empty() ? "]\n}\n" : "\n  ]\n}\n");
+    return json;
+}
+
+int ParseProgress::WriteFile(const ManagedPath& path, const std::string& text)
+{
+    ManagedPath temp_path(path.string() + ".tmp");
+    FILE* file = fopen(temp_path.string().c_str(), "wb");
+    if (file == NULL)
+    {
+        spdlog::get("pm_logger")->warn("ParseProgress: Failed to open {:s}",
+            temp_path.RawString());
+        return EX_CANTCREAT;
+    }
+    bool write_ok = (fwrite(text.data(), 1, text.size(), file) == text.size());
+    if (fclose(file) != 0)
+        write_ok = false;
+
+    std::error_code ec;
+    if (write_ok)
+        fs::rename(temp_path, path, ec);
+    if (!write_ok || ec)
+    {
+        spdlog::get("pm_logger")->warn("ParseProgress: Failed to write {:s}",
+            path.RawString());
+        temp_path.remove();
+        return EX_CANTCREAT;
+    }
+    return EX_OK;
+}
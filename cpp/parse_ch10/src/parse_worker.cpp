@@ -1,7 +1,7 @@
 // parse_worker.cpp
 #include "parse_worker.h"
 
-ParseWorker::ParseWorker() : complete_(false), retval_(0)
+ParseWorker::ParseWorker() : complete_(false), retval_(0), components_(nullptr)
 {
 }
 
@@ -9,6 +9,7 @@ void ParseWorker::operator()(WorkerConfig& worker_config, Ch10Context* ctx)
 {
     // Reset completion status.
     complete_ = false;
+    ctx->shift_timer.Start();
 
     if (worker_config.append_mode_)
         SPDLOG_INFO("({:02d}) APPEND MODE ParseWorker now active", worker_config.worker_index_);
@@ -24,9 +25,11 @@ void ParseWorker::operator()(WorkerConfig& worker_config, Ch10Context* ctx)
     // writer state.
     ctx->Initialize(worker_config.start_position_, worker_config.worker_index_);
     ctx->SetSearchingForTDP(!worker_config.append_mode_);
+    ctx->CountRead(worker_config.actual_read_bytes_, worker_config.read_time_ns_);
 
     if ((retval_ = ConfigureContext(ctx, worker_config.ch10_packet_type_map_, worker_config.output_file_paths_)) != 0)
     {
+        ctx->shift_timer.Stop();
         complete_ = true;
         return;
     }
@@ -34,7 +37,7 @@ void ParseWorker::operator()(WorkerConfig& worker_config, Ch10Context* ctx)
     ParseBufferData(ctx, worker_config.bb_);
 
     // Update last_position_;
-    worker_config.last_position_ = ctx->absolute_position;
+    worker_config.last_position_ = ctx->absolute_position.load(std::memory_order_relaxed);
 
     // Close all file writers if append_mode is true or
     // this is the final worker which has no append mode.
@@ -42,6 +45,7 @@ void ParseWorker::operator()(WorkerConfig& worker_config, Ch10Context* ctx)
     {
         SPDLOG_DEBUG("({:02d}) Closing file writers", worker_config.worker_index_);
         ctx->CloseFileWriters();
+        ReleaseComponents();
     }
 
     SPDLOG_INFO("({:02d}) End of worker's shift", worker_config.worker_index_);
@@ -51,6 +55,7 @@ void ParseWorker::operator()(WorkerConfig& worker_config, Ch10Context* ctx)
     //new
     worker_config.bb_->Clear();
 
+    ctx->shift_timer.Stop();
     complete_ = true;
     retval_ = 0;
 }
@@ -98,25 +103,31 @@ int ParseWorker::ConfigureContext(Ch10Context* ctx,
 
 void ParseWorker::ParseBufferData(Ch10Context* ctx, BinBuff* bb)
 {
-    Ch10PacketHeaderComponent header(ctx);
-    Ch10TMATSComponent tmats(ctx);
-    Ch10TDPComponent tdp(ctx);
-    Ch101553F1Component milstd1553(ctx);
-    Ch10VideoF0Component vid(ctx);
-    Ch10EthernetF0Component eth(ctx);
-    Ch10429F0Component arinc429(ctx);
+    if (components_ == nullptr || components_->ctx_ != ctx)
+        components_ = std::make_unique<ParseWorkerComponents>(ctx);
+    ParseWorkerComponents* comp = components_.get();
     Ch10Time ch10time;
 
-    // Enable Pcap output if Ethernet data packet parsing is enabled.
+    // Enable Pcap output if Ethernet data packet parsing is enabled. Pcap
+    // writers are retained until the parquet output path changes, which
+    // occurs when StreamParseManager commits data to a new set of files.
     if (ctx->pkt_type_config_map.at(Ch10PacketType::ETHERNET_DATA_F0))
     {
-        eth.EnablePcapOutput(
-            ctx->pkt_type_paths_map.at(Ch10PacketType::ETHERNET_DATA_F0));
+        const ManagedPath& eth_pq_path =
+            ctx->pkt_type_paths_map.at(Ch10PacketType::ETHERNET_DATA_F0);
+        if (eth_pq_path.RawString() != comp->pcap_pq_output_file_.RawString())
+        {
+            comp->eth_.EnablePcapOutput(eth_pq_path);
+            comp->pcap_pq_output_file_ = eth_pq_path;
+        }
     }
 
     // Instantiate Ch10Packet object
     Ch10Packet packet(bb, ctx, &ch10time);
-    packet.SetCh10ComponentParsers(&header, &tmats, &tdp, &milstd1553, &vid, &eth, &arinc429);
+    packet.SetCh10ComponentParsers(&comp->header_, &comp->tmats_, &comp->tdp_,
+        &comp->milstd1553_, &comp->vid_, &comp->eth_, &comp->arinc429_, &comp->pcmf1_,
+        &comp->canbus_, &comp->ethernetf1_, &comp->analogf1_, &comp->milstd1553f2_,
+        &comp->uartf0_, &comp->messagef0_);
     if(!packet.IsConfigured())
         return;
 
@@ -125,7 +136,9 @@ void ParseWorker::ParseBufferData(Ch10Context* ctx, BinBuff* bb)
     Ch10Status status;
     while (continue_parsing)
     {
+        ctx->header_parse_timer.Start();
         status = packet.ParseHeader();
+        ctx->header_parse_timer.Stop();
         if (status == Ch10Status::BAD_SYNC || status == Ch10Status::PKT_TYPE_NO)
         {
             continue;
@@ -137,6 +150,13 @@ void ParseWorker::ParseBufferData(Ch10Context* ctx, BinBuff* bb)
         }
 
         // Parse body if the header is parsed and validated.
+        ctx->body_parse_timer.Start();
         packet.ParseBody();
+        ctx->body_parse_timer.Stop();
     }
 }
+
+void ParseWorker::ReleaseComponents()
+{
+    components_.reset();
+}
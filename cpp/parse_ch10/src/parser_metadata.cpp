@@ -67,6 +67,19 @@ int ParserMetadata::RecordMetadata(ManagedPath md_filename,
 
     parser_paths_.RemoveCh10PacketOutputDirs(parsed_pkt_types);
 
+    PerfReport perf_report;
+    funcs.AssemblePerfReport(context_vec, perf_report);
+    if((retcode = funcs.WritePerfReport(perf_report, config_, parser_paths_.GetCh10Path())) != 0)
+        return retcode;
+
+    // Individual occurrences beyond the first few of each event are not
+    // logged by workers.
+    Diagnostics diagnostics;
+    funcs.AssembleDiagnostics(context_vec, diagnostics);
+    std::vector<std::string> summary = diagnostics.FormatSummary("absolute position");
+    for (std::vector<std::string>::const_iterator it = summary.cbegin(); it != summary.cend(); ++it)
+        spdlog::get("pm_logger")->warn("Diagnostic {:s}", *it);
+
     spdlog::get("pm_logger")->debug("RecordMetadata: complete record metadata");
     return EX_OK;
 }
@@ -201,6 +214,7 @@ bool ParserMetadataFunctions::RecordCh10PktTypeSpecificMetadata(Ch10PacketType p
     switch(pkt_type)
     {
         case Ch10PacketType::MILSTD1553_F1:
+        case Ch10PacketType::MILSTD1553_F2:
         {
             return spec_md->RecordMilStd1553F1SpecificMetadata(context_vec,
                 runtime_metadata);
@@ -323,6 +337,71 @@ bool ParserMetadataFunctions::RecordCh10PktTypeSpecificMetadata(Ch10PacketType p
         tmats, &spec_md);
 }
 
+void ParserMetadataFunctions::AssemblePerfReport(const std::vector<const Ch10Context*>& ctx_vec,
+    PerfReport& report)
+{
+    char buffer[16];
+    for (size_t i = 0; i < ctx_vec.size(); i++)
+    {
+        snprintf(buffer, sizeof(buffer), "%02zu", i);
+        report.AddWorker(buffer, ctx_vec.at(i)->GetPerfStats());
+    }
+}
+
+void ParserMetadataFunctions::RecordPerfReport(const PerfReport& report,
+    MDCategoryMap* runtime_metadata)
+{
+    runtime_metadata->SetArbitraryMappedValue("perf_counts", report.GetTotal().GetCounts());
+    runtime_metadata->SetArbitraryMappedValue("perf_times_sec", report.GetTotal().GetTimesSec());
+    runtime_metadata->SetArbitraryMappedValue("perf_worker_times_sec", 
+        report.GetWorkerTimesSec());
+}
+
+void ParserMetadataFunctions::AssembleDiagnostics(const std::vector<const Ch10Context*>& ctx_vec,
+    Diagnostics& diagnostics)
+{
+    for (std::vector<const Ch10Context*>::const_iterator it = ctx_vec.cbegin();
+        it != ctx_vec.cend(); ++it)
+    {
+        diagnostics.Merge((*it)->diagnostics);
+    }
+}
+
+void ParserMetadataFunctions::RecordDiagnostics(const Diagnostics& diagnostics,
+    MDCategoryMap* runtime_metadata)
+{
+    runtime_metadata->SetArbitraryMappedValue("diagnostic_counts", diagnostics.GetCounts());
+    runtime_metadata->SetArbitraryMappedValue("diagnostic_exemplar_positions",
+        diagnostics.GetExemplarOffsets());
+}
+
+int ParserMetadataFunctions::WritePerfReport(const PerfReport& report,
+    const ParserConfigParams& config, const ManagedPath& ch10_path)
+{
+    if (config.perf_stats_path_str_ == "")
+        return EX_OK;
+
+    ManagedPath perf_stats_path(config.perf_stats_path_str_);
+    if (config.batch_mode_)
+    {
+        ManagedPath file_name = perf_stats_path.stem();
+        file_name += "_" + ch10_path.stem().RawString() + 
+            perf_stats_path.extension().RawString();
+        perf_stats_path = perf_stats_path.parent_path() / file_name;
+    }
+
+    std::map<std::string, std::string> labels{{"input", ch10_path.filename().RawString()}};
+    int retcode = 0;
+    if ((retcode = report.Write(perf_stats_path, "tip_parse", labels)) != 0)
+    {
+        spdlog::get("pm_logger")->error("Failed to write performance statistics: {:s}",
+            perf_stats_path.RawString());
+        return retcode;
+    }
+    spdlog::get("pm_logger")->info("Performance statistics: {:s}", perf_stats_path.RawString());
+    return EX_OK;
+}
+
 void ParserMetadataFunctions::GatherTMATSData(const std::vector<const Ch10Context*>& ctx_vec,
     std::vector<std::string>& tmats_vec)
 {
@@ -350,13 +429,22 @@ int ParserMetadata::RecordMetadataForPktType(const ManagedPath& md_filename,
     md_funcs->RecordProvenanceData(tip_md, parser_paths->GetCh10Path(), pkt_type_label, prov_data);
     md_funcs->RecordUserConfigData(tip_md->GetConfigCategory(), config);
 
+    std::shared_ptr<MDCategoryMap> runtime_category = tip_md->GetRuntimeCategory();
     if(!md_funcs->RecordCh10PktTypeSpecificMetadata(pkt_type, context_vec, 
-        tip_md->GetRuntimeCategory().get(), tmats_data))
+        runtime_category.get(), tmats_data))
         return EX_SOFTWARE;
 
     if(!md_funcs->ProcessTMATSForType(tmats_data, tip_md, pkt_type))
         return EX_SOFTWARE;
 
+    PerfReport perf_report;
+    md_funcs->AssemblePerfReport(context_vec, perf_report);
+    md_funcs->RecordPerfReport(perf_report, runtime_category.get());
+
+    Diagnostics diagnostics;
+    md_funcs->AssembleDiagnostics(context_vec, diagnostics);
+    md_funcs->RecordDiagnostics(diagnostics, runtime_category.get());
+
     // Write the complete Yaml record to the metadata file.
     tip_md->CreateDocument();
     if(!md_funcs->WriteStringToFile(md_file_path, tip_md->GetMetadataString()))
@@ -78,30 +78,13 @@ void ParserPaths::CreateCh10PacketWorkerFileNames(const uint16_t& total_worker_c
     std::vector<std::map<Ch10PacketType, ManagedPath>>& output_vec_mapped_paths,
     std::string file_extension)
 {
-    std::string replacement_ext = "";
-    std::map<Ch10PacketType, ManagedPath>::const_iterator it;
-
     for (uint16_t worker_index = 0; worker_index < total_worker_count; worker_index++)
     {
-        // Create the replacement extension for the current index.
-        std::stringstream ss;
-        ss << std::setfill('0') << std::setw(3) << worker_index;
-        if (file_extension != "")
-        {
-            ss << "." << file_extension;
-        }
-        replacement_ext = ss.str();
-
         // Create a temporary map to hold all of the output file paths for the
         // current index.
-        std::map<Ch10PacketType, ManagedPath> temp_output_file_map;
-
-        // Add an output file path for each Ch10PacketType and output dir
-        // in pkt_type_output_dir_map.
-        for (it = pkt_type_output_dir_map.cbegin(); it != pkt_type_output_dir_map.cend(); ++it)
-        {
-            temp_output_file_map[it->first] = it->second / replacement_ext;
-        }
+        std::map<Ch10PacketType, ManagedPath> temp_output_file_map = 
+            CreateCh10PacketIndexedFileNames(worker_index, pkt_type_output_dir_map, 
+            file_extension, 3);
 
         // Add the temp map to the vector maps if the temp map has items.
         if (temp_output_file_map.size() > 0)
@@ -109,6 +92,30 @@ void ParserPaths::CreateCh10PacketWorkerFileNames(const uint16_t& total_worker_c
     }
 }
 
+std::map<Ch10PacketType, ManagedPath> ParserPaths::CreateCh10PacketIndexedFileNames(
+    uint32_t index, const std::map<Ch10PacketType, ManagedPath>& pkt_type_output_dir_map,
+    std::string file_extension, int width) const
+{
+    // Create the replacement extension for the current index.
+    std::stringstream ss;
+    ss << std::setfill('0') << std::setw(width) << index;
+    if (file_extension != "")
+    {
+        ss << "." << file_extension;
+    }
+    std::string replacement_ext = ss.str();
+
+    // Add an output file path for each Ch10PacketType and output dir
+    // in pkt_type_output_dir_map.
+    std::map<Ch10PacketType, ManagedPath> output_file_map;
+    std::map<Ch10PacketType, ManagedPath>::const_iterator it;
+    for (it = pkt_type_output_dir_map.cbegin(); it != pkt_type_output_dir_map.cend(); ++it)
+    {
+        output_file_map[it->first] = it->second / replacement_ext;
+    }
+    return output_file_map;
+}
+
 
 bool ParserPaths::RemoveCh10PacketOutputDirs(const std::set<Ch10PacketType>& parsed_packet_types) const
 {
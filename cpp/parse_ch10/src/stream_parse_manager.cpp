@@ -0,0 +1,235 @@
+// stream_parse_manager.cpp
+
+#include "stream_parse_manager.h"
+
+const int StreamParseManager::output_file_index_width_ = 6;
+
+StreamParseManager::StreamParseManager() : worker_(), ctx_(), bb_(), pmf_(), read_limit_(0),
+    file_size_(0), parsed_position_(0), committed_position_(0), file_index_(0),
+    configured_(false), file_size(file_size_), parsed_position(parsed_position_),
+    file_index(file_index_)
+{}
+
+int StreamParseManager::Configure(const ManagedPath& input_ch10_file_path,
+    const ManagedPath& output_dir, const ParserConfigParams& user_config)
+{
+    input_path_ = input_ch10_file_path;
+    config_ = user_config;
+    read_limit_ = static_cast<uint64_t>(user_config.parse_chunk_bytes_ * 1e6);
+
+    // A single set of output dirs, one for each enabled packet type.
+    if(!parser_paths_.CreateOutputPaths(input_path_, output_dir,
+        user_config.ch10_packet_enabled_map_, 1))
+    {
+        spdlog::get("pm_logger")->error("StreamParse: CreateOutputPaths failure");
+        return EX_CANTCREAT;
+    }
+
+    if(!pmf_.OpenCh10File(input_path_, ch10_stream_))
+        return EX_IOERR;
+
+    Ch10PacketSelection selection;
+    if (!selection.Initialize(user_config))
+        return EX_USAGE;
+
+    PCMF1FrameFormat pcmf1_frame_format;
+    if (!user_config.MakePCMF1FrameFormat(pcmf1_frame_format))
+    {
+        spdlog::get("pm_logger")->error("StreamParse: invalid PCM frame format");
+        return EX_USAGE;
+    }
+
+    ctx_.Initialize(0, 0);
+    ctx_.SetSearchingForTDP(true);
+    ctx_.SetPacketSelection(0, selection.channel_ids_);
+    if (string_to_ch10checksumpolicy_map.count(user_config.checksum_policy_str_) == 1)
+        ctx_.SetDataChecksumPolicy(
+            string_to_ch10checksumpolicy_map.at(user_config.checksum_policy_str_),
+            static_cast<uint32_t>(user_config.checksum_sample_interval_));
+    ctx_.SetPCMF1FrameFormat(pcmf1_frame_format);
+    ctx_.SetAnalogF1Decimation(static_cast<uint32_t>(user_config.analog_decimation_));
+    ctx_.SetDirectParquetWrite(user_config.direct_write_);
+
+    int retcode = 0;
+    if((retcode = OpenOutputFiles()) != EX_OK)
+        return retcode;
+
+    configured_ = true;
+    return EX_OK;
+}
+
+int StreamParseManager::OpenOutputFiles()
+{
+    std::map<Ch10PacketType, ManagedPath> output_paths =
+        parser_paths_.CreateCh10PacketIndexedFileNames(file_index_,
+        parser_paths_.GetCh10PacketTypeOutputDirMap(), "parquet", output_file_index_width_);
+
+    // The first call configures packet parsing and creates the writers.
+    if (!ctx_.IsConfigured())
+        return worker_.ConfigureContext(&ctx_, parser_paths_.GetCh10PacketTypeEnabledMap(),
+            output_paths);
+
+    // Subsequent calls replace the writers with new writers for the
+    // current output paths.
+    std::map<Ch10PacketType, ManagedPath> enabled_paths;
+    if (!ctx_.CheckConfiguration(ctx_.pkt_type_config_map, output_paths, enabled_paths))
+        return EX_SOFTWARE;
+    return ctx_.InitializeFileWriters(enabled_paths);
+}
+
+int StreamParseManager::Poll(bool& progress)
+{
+    progress = false;
+    if (!configured_)
+        return EX_SOFTWARE;
+
+    bool success = false;
+    uint64_t current_size = 0;
+    input_path_.GetFileSize(success, current_size);
+    if (!success)
+    {
+        spdlog::get("pm_logger")->error("StreamParse: GetFileSize failure");
+        return EX_IOERR;
+    }
+
+    if (current_size < file_size_)
+    {
+        spdlog::get("pm_logger")->error("StreamParse: ch10 file truncated from {:d} to "
+            "{:d} bytes", file_size_, current_size);
+        return EX_DATAERR;
+    }
+    file_size_ = current_size;
+
+    // The position may exceed the file size if the header of a skipped
+    // packet was parsed and the body has not been written yet.
+    if (parsed_position_ >= file_size_)
+        return EX_OK;
+
+    uint64_t read_count = std::min(file_size_ - parsed_position_, read_limit_);
+
+    // A prior read may have reached the end of the file.
+    ch10_stream_.clear();
+    if (bb_.Initialize(ch10_stream_, file_size_, parsed_position_, read_count) == UINT64_MAX)
+    {
+        spdlog::get("pm_logger")->error("StreamParse: failed to read {:d} bytes at "
+            "position {:d}", read_count, parsed_position_);
+        return EX_IOERR;
+    }
+
+    // Parsing stops at the first incomplete packet, the position of
+    // which is the absolute position of the context.
+    ctx_.Initialize(parsed_position_, 0);
+    worker_.ParseBufferData(&ctx_, &bb_);
+    bb_.Clear();
+
+    uint64_t absolute_position = ctx_.absolute_position.load(std::memory_order_relaxed);
+    if (absolute_position > parsed_position_)
+    {
+        SPDLOG_DEBUG("StreamParse: parsed {:d} bytes, absolute position: {:d}",
+            absolute_position - parsed_position_, absolute_position);
+        parsed_position_ = absolute_position;
+        progress = true;
+    }
+    return EX_OK;
+}
+
+int StreamParseManager::Commit()
+{
+    if (!configured_)
+        return EX_SOFTWARE;
+
+    if (parsed_position_ == committed_position_)
+        return EX_OK;
+
+    ctx_.CloseFileWriters();
+    spdlog::get("pm_logger")->info("StreamParse: committed file index {:d}, "
+        "parsed {:f} MB", file_index_, parsed_position_ / (1000.0 * 1000.0));
+
+    file_index_++;
+    committed_position_ = parsed_position_;
+    return OpenOutputFiles();
+}
+
+int StreamParseManager::Finalize()
+{
+    if (!configured_)
+        return EX_SOFTWARE;
+
+    ctx_.CloseFileWriters();
+    worker_.ReleaseComponents();
+    ch10_stream_.close();
+    configured_ = false;
+
+    // Initialize metadata after the ch10 file is complete to record
+    // the final hash.
+    int retcode = 0;
+    if ((retcode = metadata_.Initialize(input_path_, config_, parser_paths_)) != EX_OK)
+    {
+        spdlog::get("pm_logger")->error("StreamParse: ParserMetadata::Initialize failure");
+        return retcode;
+    }
+
+    std::vector<const Ch10Context*> ctx_vec{&ctx_};
+    ManagedPath metadata_fname(ParseManager::GetMetadataFilename());
+    if ((retcode = metadata_.RecordMetadata(metadata_fname, ctx_vec)) != EX_OK)
+    {
+        spdlog::get("pm_logger")->error("StreamParse: RecordMetadata failure");
+        return retcode;
+    }
+    return EX_OK;
+}
+
+int StreamParseManager::Follow()
+{
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point now = Clock::now();
+    Clock::time_point last_commit = now;
+    Clock::time_point last_growth = now;
+    std::chrono::seconds commit_interval(config_.stream_commit_sec_);
+    std::chrono::seconds idle_timeout(config_.stream_idle_timeout_sec_);
+
+    spdlog::get("pm_logger")->info("StreamParse: following {:s}", input_path_.RawString());
+
+    int retcode = 0;
+    bool progress = false;
+    uint64_t prev_size = 0;
+    while (true)
+    {
+        prev_size = file_size_;
+        if ((retcode = Poll(progress)) != EX_OK)
+            break;
+
+        now = Clock::now();
+        if (file_size_ > prev_size)
+            last_growth = now;
+
+        if (now - last_commit >= commit_interval)
+        {
+            if ((retcode = Commit()) != EX_OK)
+                break;
+            last_commit = now;
+        }
+
+        // Continue without waiting while catching up to the end of the file.
+        if (progress && parsed_position_ < file_size_)
+            continue;
+
+        if (now - last_growth >= idle_timeout)
+        {
+            spdlog::get("pm_logger")->info("StreamParse: ch10 file has not grown in {:d} sec",
+                config_.stream_idle_timeout_sec_);
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(config_.stream_poll_ms_));
+    }
+
+    // Finalize regardless of a poll error such that committed and
+    // current data remain readable.
+    int final_retcode = Finalize();
+    if (retcode != EX_OK)
+        return retcode;
+
+    spdlog::get("pm_logger")->info("StreamParse: parsed {:f} MB of {:f} MB",
+        parsed_position_ / (1000.0 * 1000.0), file_size_ / (1000.0 * 1000.0));
+    return final_retcode;
+}
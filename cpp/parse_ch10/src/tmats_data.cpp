@@ -11,7 +11,14 @@ const std::map<Ch10PacketType, std::string> TMATSData::TMATS_channel_data_type_m
     {Ch10PacketType::MILSTD1553_F1, "1553IN"},
     {Ch10PacketType::ARINC429_F0, "429IN"},
     {Ch10PacketType::VIDEO_DATA_F0, "VIDIN"},
-    {Ch10PacketType::ETHERNET_DATA_F0, "ETHIN"}
+    {Ch10PacketType::ETHERNET_DATA_F0, "ETHIN"},
+    {Ch10PacketType::PCM_F1, "PCMIN"},
+    {Ch10PacketType::CAN_BUS, "CANIN"},
+    {Ch10PacketType::ETHERNET_DATA_F1, "ETHIN"},
+    {Ch10PacketType::ANALOG_F1, "ANAIN"},
+    {Ch10PacketType::MILSTD1553_F2, "1553IN"},
+    {Ch10PacketType::UART_F0, "UARTIN"},
+    {Ch10PacketType::MESSAGE_F0, "MSGIN"}
 };
 
 bool TMATSData::Parse(const std::string& tmats_data, 
@@ -6,6 +6,7 @@ WorkerConfig::WorkerConfig() : worker_index_(0), start_position_(0), last_positi
         read_bytes_(0),
         append_read_bytes_(0),
         total_bytes_(0),
+        read_time_ns_(0),
         input_stream_(nullptr),
         actual_read_bytes_(0)
     {
@@ -68,9 +69,12 @@ bool WorkerConfig::CheckNonAppendModeConfig()
     spdlog::get("pm_logger")->debug("ConfigureWorker {:d}: start = {:d}, read size = {:d}", 
         this->worker_index_, this->start_position_, this->read_bytes_);
 
+    std::chrono::steady_clock::time_point read_start = std::chrono::steady_clock::now();
     this->actual_read_bytes_ = this->bb_->Initialize(*(this->input_stream_),
                                                this->total_bytes_, 
                                                this->start_position_, this->read_bytes_);
+    this->read_time_ns_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - read_start).count();
 
     if (this->actual_read_bytes_ == UINT64_MAX)
         return false;
@@ -106,10 +110,13 @@ bool WorkerConfig::CheckAppendModeConfig()
         this->worker_index_, this->start_position_, 
         this->append_read_bytes_, this->total_bytes_);
 
+    std::chrono::steady_clock::time_point read_start = std::chrono::steady_clock::now();
     this->actual_read_bytes_ = this->bb_->Initialize(*this->input_stream_,
                                                this->total_bytes_, 
                                                this->start_position_, 
                                                this->append_read_bytes_);
+    this->read_time_ns_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - read_start).count();
 
     if (this->actual_read_bytes_ == UINT64_MAX)
         return false;
@@ -0,0 +1,16 @@
+#ifndef CH10_MILSTD1553F2_COMPONENT_MOCK_H_
+#define CH10_MILSTD1553F2_COMPONENT_MOCK_H_
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_1553f2_component.h"
+
+class MockCh101553F2Component: public Ch101553F2Component
+{
+   public:
+    MockCh101553F2Component(Ch10Context* const ch10ctx) : Ch101553F2Component(ch10ctx) {}
+    MOCK_METHOD1(Parse, Ch10Status(const uint8_t*& data));
+};
+
+
+#endif  // CH10_MILSTD1553F2_COMPONENT_MOCK_H_
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef CH10_ANALOGF1_COMPONENT_MOCK_H_
+#define CH10_ANALOGF1_COMPONENT_MOCK_H_
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_analogf1_component.h"
+
+class MockCh10AnalogF1Component: public Ch10AnalogF1Component
+{
+   public:
+    MockCh10AnalogF1Component(Ch10Context* const ch10ctx) : Ch10AnalogF1Component(ch10ctx) {}
+    MOCK_METHOD1(Parse, Ch10Status(const uint8_t*& data));
+};
+
+
+#endif  // CH10_ANALOGF1_COMPONENT_MOCK_H_
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef CH10_CANBUS_COMPONENT_MOCK_H_
+#define CH10_CANBUS_COMPONENT_MOCK_H_
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_canbus_component.h"
+
+class MockCh10CANBusComponent: public Ch10CANBusComponent
+{
+   public:
+    MockCh10CANBusComponent(Ch10Context* const ch10ctx) : Ch10CANBusComponent(ch10ctx) {}
+    MOCK_METHOD1(Parse, Ch10Status(const uint8_t*& data));
+};
+
+
+#endif  // CH10_CANBUS_COMPONENT_MOCK_H_
\ No newline at end of file
@@ -0,0 +1,105 @@
+#ifndef CH10_COMPONENT_TEST_FIXTURE_H_
+#define CH10_COMPONENT_TEST_FIXTURE_H_
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "sysexits.h"
+#include "ch10_context.h"
+#include "ch10_packet_type.h"
+#include "ch10_header_format.h"
+#include "managed_path.h"
+
+/*
+Fixture for tests of a packet component, of type C, which writes
+parsed data to a Parquet file. The file writer for the packet type
+is created in a temporary file by SetUp and closed and removed by
+TearDown. Tests build packet bodies with the Append functions and
+pass them to MakePacketBody, which updates the context as if the
+packet header had been parsed.
+*/
+template <typename C>
+class Ch10ComponentTest : public ::testing::Test
+{
+   protected:
+    Ch10Context ctx_;
+    C comp_;
+    Ch10PacketHeaderFmt hdr_fmt_;
+    const Ch10PacketType pkt_type_;
+    const uint16_t channel_id_;
+    ManagedPath outfile_;
+
+    Ch10ComponentTest(Ch10PacketType pkt_type, uint16_t channel_id,
+        const std::string& outfile_name) : ctx_(0), comp_(&ctx_), hdr_fmt_{},
+        pkt_type_(pkt_type), channel_id_(channel_id),
+        outfile_(ManagedPath::temp_directory_path() / outfile_name)
+    {
+    }
+
+    void SetUp() override
+    {
+        InitializeFileWriter();
+    }
+
+    void TearDown() override
+    {
+        ctx_.CloseFileWriters();
+        remove(outfile_.string().c_str());
+    }
+
+    void InitializeFileWriter()
+    {
+        std::map<Ch10PacketType, ManagedPath> enabled_paths{{pkt_type_, outfile_}};
+        ASSERT_EQ(EX_OK, ctx_.InitializeFileWriters(enabled_paths));
+    }
+
+    // Append the bytes of an object, such as a time stamp or
+    // intra-packet header, to a packet body.
+    template <typename T>
+    static void AppendObject(std::vector<uint8_t>& body, const T& obj)
+    {
+        size_t pos = body.size();
+        body.resize(pos + sizeof(T));
+        memcpy(body.data() + pos, &obj, sizeof(T));
+    }
+
+    // Append data to a packet body. If pad is true, data of odd length
+    // are followed by a byte of fill to a 16-bit boundary.
+    static void AppendData(std::vector<uint8_t>& body, const std::vector<uint8_t>& data,
+        bool pad = false)
+    {
+        body.insert(body.end(), data.cbegin(), data.cend());
+        if (pad && (data.size() & 1))
+            body.push_back(0);
+    }
+
+    // Update the context for a packet and return the packet body
+    // which begins with the channel specific data word(s).
+    std::vector<uint8_t> MakePacketBody(const std::vector<uint8_t>& csdw,
+        const std::vector<uint8_t>& body)
+    {
+        hdr_fmt_.data_size = static_cast<uint32_t>(csdw.size() + body.size());
+        hdr_fmt_.chanID = channel_id_;
+        hdr_fmt_.data_type = static_cast<uint8_t>(pkt_type_);
+        uint64_t abs_pos = 0;
+        uint64_t rtc = 0;
+        EXPECT_EQ(Ch10Status::OK, ctx_.UpdateContext(abs_pos, &hdr_fmt_, rtc));
+
+        std::vector<uint8_t> packet(csdw);
+        AppendData(packet, body);
+        return packet;
+    }
+
+    template <typename T>
+    std::vector<uint8_t> MakePacketBody(const T& csdw, const std::vector<uint8_t>& body)
+    {
+        std::vector<uint8_t> csdw_bytes;
+        AppendObject(csdw_bytes, csdw);
+        return MakePacketBody(csdw_bytes, body);
+    }
+};
+
+#endif  // CH10_COMPONENT_TEST_FIXTURE_H_
@@ -0,0 +1,16 @@
+#ifndef CH10_ETHERNETF1_COMPONENT_MOCK_H_
+#define CH10_ETHERNETF1_COMPONENT_MOCK_H_
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_ethernetf1_component.h"
+
+class MockCh10EthernetF1Component: public Ch10EthernetF1Component
+{
+   public:
+    MockCh10EthernetF1Component(Ch10Context* const ch10ctx) : Ch10EthernetF1Component(ch10ctx) {}
+    MOCK_METHOD1(Parse, Ch10Status(const uint8_t*& data));
+};
+
+
+#endif  // CH10_ETHERNETF1_COMPONENT_MOCK_H_
\ No newline at end of file
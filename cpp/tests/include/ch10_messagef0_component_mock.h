@@ -0,0 +1,16 @@
+#ifndef CH10_MESSAGEF0_COMPONENT_MOCK_H_
+#define CH10_MESSAGEF0_COMPONENT_MOCK_H_
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_messagef0_component.h"
+
+class MockCh10MessageF0Component: public Ch10MessageF0Component
+{
+   public:
+    MockCh10MessageF0Component(Ch10Context* const ch10ctx) : Ch10MessageF0Component(ch10ctx) {}
+    MOCK_METHOD1(Parse, Ch10Status(const uint8_t*& data));
+};
+
+
+#endif  // CH10_MESSAGEF0_COMPONENT_MOCK_H_
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef CH10_UARTF0_COMPONENT_MOCK_H_
+#define CH10_UARTF0_COMPONENT_MOCK_H_
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_uartf0_component.h"
+
+class MockCh10UARTF0Component: public Ch10UARTF0Component
+{
+   public:
+    MockCh10UARTF0Component(Ch10Context* const ch10ctx) : Ch10UARTF0Component(ch10ctx) {}
+    MOCK_METHOD1(Parse, Ch10Status(const uint8_t*& data));
+};
+
+
+#endif  // CH10_UARTF0_COMPONENT_MOCK_H_
\ No newline at end of file
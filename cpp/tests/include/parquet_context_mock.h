@@ -18,6 +18,7 @@ class MockParquetContext : public ParquetContext
                                std::string print_msg));
     MOCK_METHOD1(EnableEmptyFileDeletion, void(const std::string& path));
     MOCK_METHOD1(IncrementAndWrite, bool(const uint16_t& thread_id));
+    MOCK_METHOD2(IncrementAndWriteRows, bool(size_t row_count, const uint16_t& thread_id));
     MOCK_METHOD3(SetMemLocI64, bool(std::vector<int64_t>& data,
                 const std::string& fieldName, std::vector<uint8_t>* boolField));
     MOCK_METHOD3(SetMemLocI32, bool(std::vector<int32_t>& data,
@@ -30,6 +31,8 @@ class MockParquetContext : public ParquetContext
                 const std::string& fieldName, std::vector<uint8_t>* boolField));
     MOCK_METHOD3(SetMemLocUI8, bool(std::vector<uint8_t>& data,
                 const std::string& fieldName, std::vector<uint8_t>* boolField));
+    MOCK_METHOD4(SetListMemLoc, bool(std::vector<int32_t>& offsets, void* values,
+                const std::string& typeID, const std::string& fieldName));
 };
 
 
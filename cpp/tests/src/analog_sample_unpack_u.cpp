@@ -0,0 +1,145 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "analog_sample_unpack.h"
+
+class AnalogSampleUnpackTest : public ::testing::Test
+{
+   protected:
+    std::vector<uint8_t> data_;
+    std::vector<ChecksumKernels::ISA> isas_;
+
+    AnalogSampleUnpackTest() : data_(1024 + 64), isas_{ChecksumKernels::ISA::SCALAR,
+        ChecksumKernels::ISA::SSE2, ChecksumKernels::ISA::AVX2}
+    {
+        std::mt19937 generator(11);
+        std::uniform_int_distribution<int> dist(0, 255);
+        for (size_t i = 0; i < data_.size(); i++)
+            data_[i] = static_cast<uint8_t>(dist(generator));
+    }
+};
+
+TEST_F(AnalogSampleUnpackTest, IsValid)
+{
+    EXPECT_TRUE(AnalogSampleUnpack::IsValid(12, 0, 12));
+    EXPECT_TRUE(AnalogSampleUnpack::IsValid(16, 4, 12));
+    EXPECT_TRUE(AnalogSampleUnpack::IsValid(32, 0, 32));
+    EXPECT_FALSE(AnalogSampleUnpack::IsValid(0, 0, 1));
+    EXPECT_FALSE(AnalogSampleUnpack::IsValid(33, 0, 32));
+    EXPECT_FALSE(AnalogSampleUnpack::IsValid(16, 0, 0));
+    EXPECT_FALSE(AnalogSampleUnpack::IsValid(16, 5, 12));
+}
+
+TEST_F(AnalogSampleUnpackTest, ScalarKnownValues)
+{
+    AnalogSampleUnpack unpack(ChecksumKernels::ISA::SCALAR);
+    EXPECT_EQ(ChecksumKernels::ISA::SCALAR, unpack.GetISA());
+
+    // 12-bit packed samples 0xABC, 0x123, 0xFFF, 0x000, least significant
+    // bit first
+    std::vector<uint8_t> packed{0xBC, 0x3A, 0x12, 0xFF, 0x0F, 0x00};
+    std::vector<int32_t> out(4);
+    ASSERT_TRUE(unpack.Unpack(packed.data(), packed.size(), 4, 12, 0, 12, out.data()));
+    EXPECT_THAT(out, ::testing::ElementsAre(0xABC, 0x123, 0xFFF, 0x000));
+
+    // 12-bit samples in 16-bit words, padded in the least or most
+    // significant bits
+    std::vector<uint8_t> words{0xC0, 0xAB, 0x30, 0x12};
+    ASSERT_TRUE(unpack.Unpack(words.data(), words.size(), 2, 16, 4, 12, out.data()));
+    EXPECT_EQ(0xABC, out[0]);
+    EXPECT_EQ(0x123, out[1]);
+    ASSERT_TRUE(unpack.Unpack(words.data(), words.size(), 2, 16, 0, 12, out.data()));
+    EXPECT_EQ(0xBC0, out[0]);
+    EXPECT_EQ(0x230, out[1]);
+
+    // 32-bit samples are stored as the bit pattern.
+    std::vector<uint8_t> dwords{0xFF, 0xFF, 0xFF, 0xFF};
+    ASSERT_TRUE(unpack.Unpack(dwords.data(), dwords.size(), 1, 32, 0, 32, out.data()));
+    EXPECT_EQ(-1, out[0]);
+}
+
+TEST_F(AnalogSampleUnpackTest, UnpackRejectsShortStream)
+{
+    AnalogSampleUnpack unpack;
+    std::vector<int32_t> out(8);
+    EXPECT_FALSE(unpack.Unpack(data_.data(), 3, 3, 12, 0, 12, out.data()));
+    EXPECT_TRUE(unpack.Unpack(data_.data(), 3, 2, 12, 0, 12, out.data()));
+    EXPECT_FALSE(unpack.Unpack(data_.data(), 3, 2, 12, 1, 12, out.data()));
+}
+
+TEST_F(AnalogSampleUnpackTest, KernelsMatchScalar)
+{
+    AnalogSampleUnpack scalar(ChecksumKernels::ISA::SCALAR);
+
+    // Counts which exercise the vector loops and scalar tails. The stream
+    // is sized to the samples so that tails are read near its end.
+    std::vector<size_t> counts{0, 1, 7, 8, 9, 15, 16, 17, 33, 100, 257};
+    std::vector<int32_t> expected(300);
+    std::vector<int32_t> out(300);
+    for (std::vector<ChecksumKernels::ISA>::const_iterator it = isas_.cbegin();
+         it != isas_.cend(); ++it)
+    {
+        AnalogSampleUnpack unpack(*it);
+        for (uint32_t stride = 1; stride <= AnalogSampleUnpack::max_sample_bits; stride++)
+        {
+            for (uint32_t shift = 0; shift < stride; shift += (stride > 8 ? 3 : 1))
+            {
+                uint32_t sample_bits = stride - shift;
+                for (std::vector<size_t>::const_iterator count = counts.cbegin();
+                     count != counts.cend(); ++count)
+                {
+                    size_t size = (*count * stride + 7) / 8;
+                    const uint8_t* data = data_.data() + 1;
+                    ASSERT_TRUE(scalar.Unpack(data, size, *count, stride, shift, sample_bits,
+                        expected.data()));
+                    ASSERT_TRUE(unpack.Unpack(data, size, *count, stride, shift, sample_bits,
+                        out.data()));
+                    EXPECT_TRUE(std::equal(expected.begin(), expected.begin() + *count,
+                        out.begin())) << ChecksumKernels::ISAString(unpack.GetISA())
+                        << " stride " << stride << " shift " << shift << " count " << *count;
+                }
+            }
+        }
+    }
+}
+
+// Throughput of each supported kernel in samples/sec. Timing is not
+// asserted. Run with --gtest_also_run_disabled_tests
+// --gtest_filter=*Throughput.
+TEST_F(AnalogSampleUnpackTest, DISABLED_Throughput)
+{
+    const size_t sample_count = 64 * 1024;
+    const size_t total_samples = size_t(1) << 30;
+    const std::vector<uint32_t> strides{12, 16, 24};
+    std::vector<uint8_t> data(sample_count * 4, 0x5A);
+    std::vector<int32_t> out(sample_count);
+
+    for (std::vector<ChecksumKernels::ISA>::const_iterator it = isas_.cbegin();
+         it != isas_.cend(); ++it)
+    {
+        if (!ChecksumKernels::IsSupported(*it))
+            continue;
+        AnalogSampleUnpack unpack(*it);
+        for (std::vector<uint32_t>::const_iterator stride = strides.cbegin();
+             stride != strides.cend(); ++stride)
+        {
+            size_t reps = total_samples / sample_count;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            int64_t sink = 0;
+            for (size_t rep = 0; rep < reps; rep++)
+            {
+                unpack.Unpack(data.data(), data.size(), sample_count, *stride, 0, *stride,
+                    out.data());
+                sink += out[rep % sample_count];
+            }
+            double sec = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+            printf("%-6s stride %2u: %7.1f Msamples/s (%lld)\n",
+                ChecksumKernels::ISAString(*it).c_str(), *stride,
+                reps * sample_count / sec / 1.0e6, static_cast<long long>(sink & 0xFF));
+        }
+    }
+}
@@ -197,6 +197,42 @@ TEST_F(ARINC429DataTest, IdentifyWordValidateOutputSDINegative)
     EXPECT_EQ(table_index_,1);
 }
 
+TEST_F(ARINC429DataTest, IdentifyWordSDIWildcardResolution)
+{
+    SetupMap0();
+    SetupTable0();
+    organized_lookup_map_[21][1][107][-1] = 3;
+    organized_lookup_map_[21][2][107][0] = 4;
+    icd_data_ = ARINC429Data(organized_lookup_map_, element_table_);
+
+    // Exact SDI entry takes precedence over the wildcard
+    EXPECT_TRUE(icd_data_.IdentifyWord(table_index_,chanid_,subchan_,label_,sdi_));
+    EXPECT_EQ(table_index_, 1);
+
+    sdi_ = 2;
+    EXPECT_TRUE(icd_data_.IdentifyWord(table_index_,chanid_,subchan_,label_,sdi_));
+    EXPECT_EQ(table_index_, 3);
+
+    sdi_ = -1;
+    EXPECT_TRUE(icd_data_.IdentifyWord(table_index_,chanid_,subchan_,label_,sdi_));
+    EXPECT_EQ(table_index_, 3);
+
+    // Second bus has no wildcard
+    subchan_ = 1;
+    sdi_ = 0;
+    EXPECT_TRUE(icd_data_.IdentifyWord(table_index_,chanid_,subchan_,label_,sdi_));
+    EXPECT_EQ(table_index_, 4);
+    sdi_ = 1;
+    EXPECT_FALSE(icd_data_.IdentifyWord(table_index_,chanid_,subchan_,label_,sdi_));
+    sdi_ = -1;
+    EXPECT_FALSE(icd_data_.IdentifyWord(table_index_,chanid_,subchan_,label_,sdi_));
+
+    // Labels are 8 bits
+    subchan_ = 0;
+    label_ = 107 + 256;
+    EXPECT_FALSE(icd_data_.IdentifyWord(table_index_,chanid_,subchan_,label_,sdi_));
+}
+
 TEST_F(ARINC429DataTest, GetTableSizeEmptyTable)
 {
     SetupMap0();
@@ -391,4 +427,74 @@ TEST_F(ARINC429DataTest, SetNamesToUniqueIndexMapOutputValid)
     ASSERT_TRUE(icd_data_.SetNamesToUniqueIndexMap(word_names, word_name_to_unique_index_map));
     ASSERT_EQ(3, word_name_to_unique_index_map.size());
 
-}
\ No newline at end of file
+}
+
+TEST_F(ARINC429DataTest, GetLookupKeys)
+{
+    std::set<uint16_t> channelids;
+    std::set<uint16_t> labels;
+    icd_data_.GetLookupKeys(channelids, labels);
+    EXPECT_TRUE(channelids.empty());
+    EXPECT_TRUE(labels.empty());
+
+    SetupMap0();
+    organized_lookup_map_[21][2][110][0] = 2;
+    organized_lookup_map_[5][1][12][-1] = 3;
+    icd_data_ = ARINC429Data(organized_lookup_map_, element_table_);
+    icd_data_.GetLookupKeys(channelids, labels);
+    EXPECT_THAT(channelids, ::testing::ElementsAre(5, 21));
+    EXPECT_THAT(labels, ::testing::ElementsAre(12, 107, 110));
+}
+
+TEST_F(ARINC429DataTest, GetWordElementsNoCopy)
+{
+    SetupMap0();
+    SetupElem();
+    SetupTable0();
+    icd_data_ = ARINC429Data(organized_lookup_map_, element_table_);
+    const std::vector<std::vector<ICDElement>>* arinc_elems = nullptr;
+
+    ASSERT_TRUE(icd_data_.GetWordElements(0, arinc_elems));
+    ASSERT_TRUE(arinc_elems != nullptr);
+    ASSERT_EQ(arinc_elems->size(), 1);
+    ASSERT_EQ(arinc_elems->at(0).size(), 1);
+    EXPECT_EQ(arinc_elems->at(0).at(0).elem_name_, "107_alt");
+
+    EXPECT_FALSE(icd_data_.GetWordElements(1, arinc_elems));
+    EXPECT_TRUE(arinc_elems == nullptr);
+}
+
+TEST_F(ARINC429DataTest, CopiesShareTables)
+{
+    SetupMap0();
+    SetupElem();
+    SetupTable0();
+    SetupTable0();
+    arinc_word_names_[1].push_back("TestWord");
+    icd_data_ = ARINC429Data(organized_lookup_map_, element_table_, arinc_word_names_);
+
+    ASSERT_EQ(2, icd_data_.GetWordGroupNames().size());
+    ASSERT_EQ(1, icd_data_.GetWordGroupNames()[1].size());
+    EXPECT_EQ("TestWord", icd_data_.GetWordGroupNames()[1][0]);
+    EXPECT_EQ(icd_data_.GetNamesToUniqueIndexMap().at("TestWord"),
+        icd_data_.GetWordGroupUniqueIndices()[1][0]);
+
+    ARINC429Data copy(icd_data_);
+    EXPECT_EQ(&icd_data_.GetWordGroupNames(), &copy.GetWordGroupNames());
+    EXPECT_EQ(&icd_data_.GetArincWordNamesMap(), &copy.GetArincWordNamesMap());
+
+    const std::vector<std::vector<ICDElement>>* elems = nullptr;
+    const std::vector<std::vector<ICDElement>>* copy_elems = nullptr;
+    ASSERT_TRUE(icd_data_.GetWordElements(1, elems));
+    ASSERT_TRUE(copy.GetWordElements(1, copy_elems));
+    EXPECT_EQ(elems, copy_elems);
+}
+
+TEST_F(ARINC429DataTest, WordGroupsEmptyWithoutNames)
+{
+    SetupMap0();
+    SetupTable0();
+    icd_data_ = ARINC429Data(organized_lookup_map_, element_table_);
+    EXPECT_EQ(0, icd_data_.GetWordGroupNames().size());
+    EXPECT_EQ(0, icd_data_.GetWordGroupUniqueIndices().size());
+}
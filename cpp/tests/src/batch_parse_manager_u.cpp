@@ -0,0 +1,224 @@
+#include <fstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "batch_parse_manager.h"
+#include "parser_config_params.h"
+#include "argument_validation.h"
+#include "managed_path.h"
+
+class BatchParseManagerTest : public ::testing::Test
+{
+   protected:
+    BatchParseManager bpm_;
+    ArgumentValidation av_;
+    ParserConfigParams config_;
+    std::vector<ManagedPath> input_paths_;
+    std::string batch_dir_;
+
+    BatchParseManagerTest() : bpm_(), av_(), config_(), batch_dir_("batch_parse_test_dir")
+    {
+        std::filesystem::create_directory(batch_dir_);
+    }
+
+    ~BatchParseManagerTest()
+    {
+        std::filesystem::remove_all(batch_dir_);
+    }
+
+    std::string CreateFile(const std::string& name, const std::string& content = "")
+    {
+        std::string path = (std::filesystem::path(batch_dir_) / name).string();
+        std::ofstream ofs(path, std::ios::trunc);
+        ofs << content;
+        ofs.close();
+        return path;
+    }
+};
+
+TEST_F(BatchParseManagerTest, MatchWildcard)
+{
+    EXPECT_TRUE(BatchParseManager::MatchWildcard("*.ch10", "flight1.ch10"));
+    EXPECT_TRUE(BatchParseManager::MatchWildcard("flight?.ch10", "flight1.ch10"));
+    EXPECT_TRUE(BatchParseManager::MatchWildcard("f*t*.c*", "flight.ch10"));
+    EXPECT_TRUE(BatchParseManager::MatchWildcard("*", ""));
+    EXPECT_TRUE(BatchParseManager::MatchWildcard("a**b", "ab"));
+    EXPECT_TRUE(BatchParseManager::MatchWildcard("*ab", "aaab"));
+    EXPECT_FALSE(BatchParseManager::MatchWildcard("flight?.ch10", "flight10.ch10"));
+    EXPECT_FALSE(BatchParseManager::MatchWildcard("*.ch10", "flight1.c10"));
+    EXPECT_FALSE(BatchParseManager::MatchWildcard("?", ""));
+    EXPECT_FALSE(BatchParseManager::MatchWildcard("*ab", "aaba"));
+}
+
+TEST_F(BatchParseManagerTest, GetMaxActiveWorkers)
+{
+    config_.parse_thread_count_ = 8;
+    config_.parse_chunk_bytes_ = 200;
+    config_.memory_limit_mb_ = 0;
+    EXPECT_EQ(8, BatchParseManager::GetMaxActiveWorkers(config_));
+
+    config_.memory_limit_mb_ = 1000;
+    EXPECT_EQ(5, BatchParseManager::GetMaxActiveWorkers(config_));
+
+    config_.memory_limit_mb_ = 100000;
+    EXPECT_EQ(8, BatchParseManager::GetMaxActiveWorkers(config_));
+
+    // At least one worker is always permitted
+    config_.memory_limit_mb_ = 150;
+    EXPECT_EQ(1, BatchParseManager::GetMaxActiveWorkers(config_));
+}
+
+TEST_F(BatchParseManagerTest, CollectInputPathsDirectory)
+{
+    CreateFile("b.ch10");
+    CreateFile("a.C10");
+    CreateFile("c.txt");
+    std::filesystem::create_directory(std::filesystem::path(batch_dir_) / "d.ch10");
+
+    ASSERT_EQ(EX_OK, BatchParseManager::CollectInputPaths(batch_dir_, &av_, input_paths_));
+    ASSERT_EQ(2, input_paths_.size());
+    EXPECT_EQ("a.C10", input_paths_.at(0).filename().RawString());
+    EXPECT_EQ("b.ch10", input_paths_.at(1).filename().RawString());
+}
+
+TEST_F(BatchParseManagerTest, CollectInputPathsDirectoryEmpty)
+{
+    CreateFile("c.txt");
+    EXPECT_EQ(EX_NOINPUT, BatchParseManager::CollectInputPaths(batch_dir_, &av_, 
+        input_paths_));
+    EXPECT_EQ(0, input_paths_.size());
+}
+
+TEST_F(BatchParseManagerTest, CollectInputPathsWildcard)
+{
+    CreateFile("flight2.ch10");
+    CreateFile("flight1.ch10");
+    CreateFile("flight10.ch10");
+    CreateFile("ground1.ch10");
+
+    std::string pattern = (std::filesystem::path(batch_dir_) / "flight?.ch10").string();
+    ASSERT_EQ(EX_OK, BatchParseManager::CollectInputPaths(pattern, &av_, input_paths_));
+    ASSERT_EQ(2, input_paths_.size());
+    EXPECT_EQ("flight1.ch10", input_paths_.at(0).filename().RawString());
+    EXPECT_EQ("flight2.ch10", input_paths_.at(1).filename().RawString());
+}
+
+TEST_F(BatchParseManagerTest, CollectInputPathsList)
+{
+    std::string path1 = CreateFile("z.ch10");
+    std::string path2 = CreateFile("y.c10");
+    std::string list = CreateFile("list.txt", "# comment\n  " + path1 + "  \r\n\n" 
+        + path2 + "\n");
+
+    ASSERT_EQ(EX_OK, BatchParseManager::CollectInputPaths(list, &av_, input_paths_));
+    ASSERT_EQ(2, input_paths_.size());
+
+    // List order is preserved
+    EXPECT_EQ("z.ch10", input_paths_.at(0).filename().RawString());
+    EXPECT_EQ("y.c10", input_paths_.at(1).filename().RawString());
+}
+
+TEST_F(BatchParseManagerTest, CollectInputPathsListInvalidEntry)
+{
+    std::string path1 = CreateFile("z.ch10");
+    std::string list = CreateFile("list.txt", path1 + "\n" + "data.bin\n");
+    EXPECT_EQ(EX_DATAERR, BatchParseManager::CollectInputPaths(list, &av_, input_paths_));
+
+    list = CreateFile("list.txt", path1 + "\n" + "not_a_file.ch10\n");
+    EXPECT_EQ(EX_NOINPUT, BatchParseManager::CollectInputPaths(list, &av_, input_paths_));
+}
+
+TEST_F(BatchParseManagerTest, CollectInputPathsListDuplicateStem)
+{
+    std::string path1 = CreateFile("flight.ch10");
+    std::filesystem::create_directory(std::filesystem::path(batch_dir_) / "sub");
+    std::string path2 = CreateFile("sub/flight.ch10");
+    std::string list = CreateFile("list.txt", path1 + "\n" + path2 + "\n");
+    EXPECT_EQ(EX_DATAERR, BatchParseManager::CollectInputPaths(list, &av_, input_paths_));
+
+    // Same stem with a different extension in one directory
+    CreateFile("flight.c10");
+    EXPECT_EQ(EX_DATAERR, BatchParseManager::CollectInputPaths(batch_dir_, &av_, input_paths_));
+}
+
+TEST_F(BatchParseManagerTest, CollectInputPathsSingleFile)
+{
+    std::string path = CreateFile("single.ch10");
+    ASSERT_EQ(EX_OK, BatchParseManager::CollectInputPaths(path, &av_, input_paths_));
+    ASSERT_EQ(1, input_paths_.size());
+
+    path = CreateFile("single.bin");
+    EXPECT_EQ(EX_DATAERR, BatchParseManager::CollectInputPaths(path, &av_, input_paths_));
+}
+
+TEST_F(BatchParseManagerTest, AdvanceFileAppendMode)
+{
+    BatchFile file(ManagedPath(std::string("file.ch10")));
+    file.work_units_.resize(3);
+    file.configured_ = true;
+    EXPECT_EQ(3, file.ModeWorkerCount());
+    EXPECT_TRUE(file.HasPendingWorker());
+
+    // Pending workers, no transition
+    file.next_worker_ = 2;
+    bpm_.AdvanceFile(&file);
+    EXPECT_FALSE(file.append_mode_);
+
+    // Active workers, no transition
+    file.next_worker_ = 3;
+    file.active_workers_.push_back(2);
+    bpm_.AdvanceFile(&file);
+    EXPECT_FALSE(file.append_mode_);
+
+    file.active_workers_.clear();
+    bpm_.AdvanceFile(&file);
+    EXPECT_TRUE(file.append_mode_);
+    EXPECT_FALSE(file.complete_);
+    EXPECT_EQ(0, file.next_worker_);
+    EXPECT_EQ(2, file.ModeWorkerCount());
+}
+
+TEST_F(BatchParseManagerTest, AdvanceFileFailureCompletes)
+{
+    BatchFile file(ManagedPath(std::string("file.ch10")));
+    file.work_units_.resize(3);
+    file.configured_ = true;
+    file.next_worker_ = 1;
+    file.retcode_ = EX_SOFTWARE;
+
+    bpm_.AdvanceFile(&file);
+    EXPECT_TRUE(file.complete_);
+    EXPECT_FALSE(file.HasPendingWorker());
+    EXPECT_EQ(0, file.work_units_.size());
+}
+
+TEST_F(BatchParseManagerTest, HasPendingWorkerFailure)
+{
+    BatchFile file(ManagedPath(std::string("file.ch10")));
+    file.work_units_.resize(3);
+    file.configured_ = true;
+    file.next_worker_ = 1;
+    EXPECT_TRUE(file.HasPendingWorker());
+
+    // Workers remain but are not scheduled after a failure
+    file.retcode_ = EX_SOFTWARE;
+    EXPECT_FALSE(file.HasPendingWorker());
+}
+
+TEST_F(BatchParseManagerTest, ParseInputsNotExist)
+{
+    config_.parse_thread_count_ = 2;
+    config_.parse_chunk_bytes_ = 200;
+    config_.worker_offset_wait_ms_ = 1;
+    config_.worker_shift_wait_ms_ = 1;
+    input_paths_.push_back(ManagedPath(std::string("not_a_file1.ch10")));
+    input_paths_.push_back(ManagedPath(std::string("not_a_file2.ch10")));
+
+    EXPECT_EQ(EX_IOERR, bpm_.Parse(input_paths_, ManagedPath(batch_dir_), config_));
+    EXPECT_EQ(2, bpm_.failed_count);
+    EXPECT_EQ(0, bpm_.total_bytes);
+}
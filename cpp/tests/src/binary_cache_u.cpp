@@ -0,0 +1,121 @@
+#include <fstream>
+#include <string>
+#include <filesystem>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "managed_path.h"
+#include "binary_cache.h"
+
+class BinaryCacheTest : public ::testing::Test
+{
+   protected:
+    ManagedPath path_;
+    std::string key_;
+    std::string version_;
+
+    BinaryCacheTest() : path_(std::string("binary_cache_test.tipcache")),
+        key_("abc123"), version_("1.2.3")
+    {}
+
+    ~BinaryCacheTest()
+    {
+        std::filesystem::remove(path_.string());
+    }
+
+    void WriteCache()
+    {
+        BinaryCacheWriter writer;
+        writer.Write(static_cast<uint8_t>(7));
+        writer.Write(static_cast<int16_t>(-300));
+        writer.Write(2.5);
+        writer.WriteSize(12);
+        writer.WriteString("hello");
+        writer.WriteString("");
+        ASSERT_EQ(EX_OK, writer.Save(path_, key_, version_));
+    }
+};
+
+TEST_F(BinaryCacheTest, OpenFileNotExist)
+{
+    BinaryCacheReader reader;
+    EXPECT_EQ(EX_NOINPUT, reader.Open(path_, key_, version_));
+    EXPECT_FALSE(reader.ok());
+}
+
+TEST_F(BinaryCacheTest, RoundTrip)
+{
+    WriteCache();
+    EXPECT_FALSE(std::filesystem::exists(path_.string() + ".tmp"));
+
+    BinaryCacheReader reader;
+    ASSERT_EQ(EX_OK, reader.Open(path_, key_, version_));
+
+    uint8_t u8 = 0;
+    int16_t i16 = 0;
+    double dbl = 0.0;
+    size_t size = 0;
+    std::string str1;
+    std::string str2("x");
+    ASSERT_TRUE(reader.Read(u8));
+    EXPECT_EQ(7, u8);
+    ASSERT_TRUE(reader.Read(i16));
+    EXPECT_EQ(-300, i16);
+    ASSERT_TRUE(reader.Read(dbl));
+    EXPECT_EQ(2.5, dbl);
+    EXPECT_FALSE(reader.AtEnd());
+    ASSERT_TRUE(reader.ReadSize(size));
+    EXPECT_EQ(12, size);
+    ASSERT_TRUE(reader.ReadString(str1));
+    EXPECT_EQ("hello", str1);
+    ASSERT_TRUE(reader.ReadString(str2));
+    EXPECT_EQ("", str2);
+    EXPECT_TRUE(reader.AtEnd());
+
+    // Read past the end fails and subsequent reads fail
+    EXPECT_FALSE(reader.Read(u8));
+    EXPECT_FALSE(reader.ok());
+    EXPECT_FALSE(reader.AtEnd());
+}
+
+TEST_F(BinaryCacheTest, OpenKeyOrVersionMismatch)
+{
+    WriteCache();
+
+    BinaryCacheReader reader;
+    EXPECT_EQ(EX_DATAERR, reader.Open(path_, "abc124", version_));
+    EXPECT_EQ(EX_DATAERR, reader.Open(path_, key_, "1.2.4"));
+    EXPECT_EQ(EX_OK, reader.Open(path_, key_, version_));
+}
+
+TEST_F(BinaryCacheTest, OpenNotCacheOrTruncated)
+{
+    {
+        std::ofstream ofs(path_.string(), std::ios::binary | std::ios::trunc);
+        ofs << "not a cache file";
+    }
+    BinaryCacheReader reader;
+    EXPECT_EQ(EX_DATAERR, reader.Open(path_, key_, version_));
+
+    WriteCache();
+    std::filesystem::resize_file(path_.string(), std::filesystem::file_size(path_.string()) - 1);
+    EXPECT_EQ(EX_DATAERR, reader.Open(path_, key_, version_));
+}
+
+TEST_F(BinaryCacheTest, ReadSizeExceedsPayload)
+{
+    BinaryCacheWriter writer;
+    writer.WriteSize(1000);
+    writer.Write(static_cast<uint32_t>(1));
+    ASSERT_EQ(EX_OK, writer.Save(path_, key_, version_));
+
+    BinaryCacheReader reader;
+    ASSERT_EQ(EX_OK, reader.Open(path_, key_, version_));
+    size_t size = 0;
+    EXPECT_FALSE(reader.ReadSize(size));
+    EXPECT_FALSE(reader.ok());
+
+    // Also applies to strings
+    ASSERT_EQ(EX_OK, reader.Open(path_, key_, version_));
+    std::string str;
+    EXPECT_FALSE(reader.ReadString(str));
+}
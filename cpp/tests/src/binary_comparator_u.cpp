@@ -0,0 +1,187 @@
+#include <fstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "managed_path.h"
+#include "binary_comparator.h"
+
+class BinaryComparatorTest : public ::testing::Test
+{
+   protected:
+    std::vector<std::string> files_;
+    std::vector<uint8_t> buff1_;
+    std::vector<uint8_t> buff2_;
+
+    BinaryComparatorTest()
+    {
+        for (size_t i = 0; i < 1000; i++)
+            buff1_.push_back(static_cast<uint8_t>(i * 7));
+        buff2_ = buff1_;
+    }
+
+    ~BinaryComparatorTest()
+    {
+        for (const auto& f : files_)
+            std::filesystem::remove(f);
+    }
+
+    void WriteFile(const std::string& path, const std::vector<uint8_t>& data)
+    {
+        std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+        ofs.write(reinterpret_cast<const char*>(data.data()), data.size());
+        ofs.close();
+        files_.push_back(path);
+    }
+};
+
+TEST_F(BinaryComparatorTest, CountMismatches)
+{
+    uint64_t first = 0;
+    EXPECT_EQ(0, BinaryComparator::CountMismatches(buff1_.data(), buff2_.data(), 
+        buff1_.size(), first));
+    EXPECT_EQ(buff1_.size(), first);
+
+    // Multiple mismatched bits in one byte count as one byte
+    buff2_[9] ^= 0xFF;
+    buff2_[10] ^= 0x80;
+    buff2_[15] ^= 0x01;
+    buff2_[998] ^= 0x10;
+    EXPECT_EQ(4, BinaryComparator::CountMismatches(buff1_.data(), buff2_.data(),
+        buff1_.size(), first));
+    EXPECT_EQ(9, first);
+
+    // Unaligned start and tail shorter than a word
+    EXPECT_EQ(2, BinaryComparator::CountMismatches(buff1_.data() + 10, buff2_.data() + 10,
+        5 + 8 + 3, first));
+    EXPECT_EQ(0, first);
+}
+
+TEST_F(BinaryComparatorTest, CompareBuffersEqual)
+{
+    BinaryComparator comp(4, 16);
+    EXPECT_TRUE(comp.CompareBuffers(buff1_.data(), buff1_.size(), buff2_.data(), 
+        buff2_.size()));
+    EXPECT_EQ(BinaryComparator::kNoMismatch, comp.first_mismatch_offset);
+    EXPECT_EQ(0, comp.mismatch_count);
+    EXPECT_EQ(buff1_.size(), comp.compared_count);
+    EXPECT_FALSE(comp.size_mismatch);
+}
+
+TEST_F(BinaryComparatorTest, CompareBuffersMultipleThreads)
+{
+    buff2_[5] = ~buff2_[5];
+    buff2_[500] = ~buff2_[500];
+    buff2_[501] = ~buff2_[501];
+    buff2_[999] = ~buff2_[999];
+
+    for (int thread_count = 1; thread_count < 9; thread_count++)
+    {
+        BinaryComparator comp(thread_count, 16);
+        EXPECT_FALSE(comp.CompareBuffers(buff1_.data(), buff1_.size(), buff2_.data(), 
+            buff2_.size()));
+        EXPECT_EQ(5, comp.first_mismatch_offset);
+        EXPECT_EQ(4, comp.mismatch_count);
+        EXPECT_EQ(buff1_.size(), comp.compared_count);
+    }
+}
+
+TEST_F(BinaryComparatorTest, CompareBuffersSizeMismatch)
+{
+    buff2_.resize(990);
+    BinaryComparator comp(2, 64);
+    EXPECT_FALSE(comp.CompareBuffers(buff1_.data(), buff1_.size(), buff2_.data(), 
+        buff2_.size()));
+    EXPECT_TRUE(comp.size_mismatch);
+    EXPECT_EQ(990, comp.first_mismatch_offset);
+    EXPECT_EQ(10, comp.mismatch_count);
+
+    buff2_[100] = ~buff2_[100];
+    EXPECT_FALSE(comp.CompareBuffers(buff1_.data(), buff1_.size(), buff2_.data(), 
+        buff2_.size()));
+    EXPECT_EQ(100, comp.first_mismatch_offset);
+    EXPECT_EQ(11, comp.mismatch_count);
+}
+
+TEST_F(BinaryComparatorTest, CompareBuffersMaskedRanges)
+{
+    buff2_[3] = ~buff2_[3];
+    buff2_[100] = ~buff2_[100];
+    buff2_[104] = ~buff2_[104];
+    buff2_[700] = ~buff2_[700];
+
+    BinaryComparator comp(3, 32);
+    ASSERT_TRUE(comp.AddMaskedRange(0, 8));
+    ASSERT_TRUE(comp.AddMaskedRange(100, 4));
+    ASSERT_TRUE(comp.AddMaskedRange(102, 3));
+    ASSERT_TRUE(comp.AddMaskedRange(0x2BC, 1));
+    ASSERT_EQ(3, comp.GetMaskedRanges().size());
+    EXPECT_EQ(100, comp.GetMaskedRanges()[1].first);
+    EXPECT_EQ(105, comp.GetMaskedRanges()[1].second);
+
+    EXPECT_TRUE(comp.CompareBuffers(buff1_.data(), buff1_.size(), buff2_.data(), 
+        buff2_.size()));
+    EXPECT_EQ(buff1_.size() - 8 - 5 - 1, comp.compared_count);
+
+    buff2_[105] = ~buff2_[105];
+    EXPECT_FALSE(comp.CompareBuffers(buff1_.data(), buff1_.size(), buff2_.data(), 
+        buff2_.size()));
+    EXPECT_EQ(105, comp.first_mismatch_offset);
+    EXPECT_EQ(1, comp.mismatch_count);
+}
+
+TEST_F(BinaryComparatorTest, AddMaskedRangeString)
+{
+    BinaryComparator comp;
+    EXPECT_TRUE(comp.AddMaskedRange("0:24"));
+    EXPECT_TRUE(comp.AddMaskedRange("0x1000:0X10"));
+    ASSERT_EQ(2, comp.GetMaskedRanges().size());
+    EXPECT_EQ(0, comp.GetMaskedRanges()[0].first);
+    EXPECT_EQ(24, comp.GetMaskedRanges()[0].second);
+    EXPECT_EQ(4096, comp.GetMaskedRanges()[1].first);
+    EXPECT_EQ(4112, comp.GetMaskedRanges()[1].second);
+
+    EXPECT_FALSE(comp.AddMaskedRange("24"));
+    EXPECT_FALSE(comp.AddMaskedRange("a:24"));
+    EXPECT_FALSE(comp.AddMaskedRange("-1:24"));
+    EXPECT_FALSE(comp.AddMaskedRange("1:"));
+    EXPECT_FALSE(comp.AddMaskedRange("1:0"));
+    EXPECT_FALSE(comp.AddMaskedRange("0xFFFFFFFFFFFFFFFF:2"));
+    EXPECT_EQ(2, comp.GetMaskedRanges().size());
+}
+
+TEST_F(BinaryComparatorTest, CompareFiles)
+{
+    WriteFile("bincomp_truth.bin", buff1_);
+    buff2_[600] = ~buff2_[600];
+    WriteFile("bincomp_test.bin", buff2_);
+
+    bool pass = true;
+    BinaryComparator comp(2, 128);
+    ASSERT_EQ(EX_OK, comp.Compare(ManagedPath(std::string("bincomp_truth.bin")),
+        ManagedPath(std::string("bincomp_test.bin")), pass));
+    EXPECT_FALSE(pass);
+    EXPECT_EQ(600, comp.first_mismatch_offset);
+
+    ASSERT_EQ(EX_OK, comp.Compare(ManagedPath(std::string("bincomp_truth.bin")),
+        ManagedPath(std::string("bincomp_truth.bin")), pass));
+    EXPECT_TRUE(pass);
+
+    EXPECT_EQ(EX_NOINPUT, comp.Compare(ManagedPath(std::string("bincomp_truth.bin")),
+        ManagedPath(std::string("not_a_file.bin")), pass));
+    EXPECT_FALSE(pass);
+}
+
+TEST_F(BinaryComparatorTest, CompareEmptyFiles)
+{
+    WriteFile("bincomp_truth.bin", std::vector<uint8_t>());
+    WriteFile("bincomp_test.bin", std::vector<uint8_t>());
+
+    bool pass = false;
+    BinaryComparator comp(4);
+    ASSERT_EQ(EX_OK, comp.Compare(ManagedPath(std::string("bincomp_truth.bin")),
+        ManagedPath(std::string("bincomp_test.bin")), pass));
+    EXPECT_TRUE(pass);
+    EXPECT_EQ(0, comp.compared_count);
+}
@@ -0,0 +1,122 @@
+#include <set>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "canbus_data.h"
+
+class CANBusDataTest : public ::testing::Test
+{
+   protected:
+    CANBusData can_data_;
+    std::vector<CANBusMsgDef> defs_;
+    size_t msg_index_;
+
+    CANBusDataTest() : can_data_(), defs_(), msg_index_(0)
+    {
+        defs_.push_back(MakeDef("engine", 3, 0x100, false));
+        defs_.push_back(MakeDef("brakes", 3, 0x7FF, false));
+        defs_.push_back(MakeDef("gps", 9, 0x100, false));
+        defs_.push_back(MakeDef("battery", 3, 0x100, true));
+        defs_.push_back(MakeDef("cabin", 3, 0x1FFFFFFF, true));
+    }
+
+    CANBusMsgDef MakeDef(std::string name, uint16_t channel_id, uint32_t can_id,
+        bool extended)
+    {
+        CANBusMsgDef def;
+        def.name = name;
+        def.channel_id = channel_id;
+        def.can_id = can_id;
+        def.extended = extended;
+        return def;
+    }
+};
+
+TEST_F(CANBusDataTest, FindNotInitialized)
+{
+    EXPECT_FALSE(can_data_.Find(3, 0x100, false, msg_index_));
+    EXPECT_FALSE(can_data_.Find(3, 0x100, true, msg_index_));
+}
+
+TEST_F(CANBusDataTest, Find)
+{
+    ASSERT_TRUE(can_data_.Initialize(defs_));
+    ASSERT_EQ(5, can_data_.GetMsgDefs().size());
+
+    ASSERT_TRUE(can_data_.Find(3, 0x100, false, msg_index_));
+    EXPECT_EQ(0, msg_index_);
+    ASSERT_TRUE(can_data_.Find(3, 0x7FF, false, msg_index_));
+    EXPECT_EQ(1, msg_index_);
+    ASSERT_TRUE(can_data_.Find(9, 0x100, false, msg_index_));
+    EXPECT_EQ(2, msg_index_);
+    ASSERT_TRUE(can_data_.Find(3, 0x100, true, msg_index_));
+    EXPECT_EQ(3, msg_index_);
+    ASSERT_TRUE(can_data_.Find(3, 0x1FFFFFFF, true, msg_index_));
+    EXPECT_EQ(4, msg_index_);
+
+    EXPECT_FALSE(can_data_.Find(3, 0x101, false, msg_index_));
+    EXPECT_FALSE(can_data_.Find(4, 0x100, false, msg_index_));
+    EXPECT_FALSE(can_data_.Find(100, 0x100, false, msg_index_));
+    EXPECT_FALSE(can_data_.Find(3, 0x800, false, msg_index_));
+    EXPECT_FALSE(can_data_.Find(9, 0x100, true, msg_index_));
+}
+
+TEST_F(CANBusDataTest, InitializeInvalid)
+{
+    std::vector<CANBusMsgDef> defs = defs_;
+    defs.push_back(MakeDef("engine", 4, 0x1, false));
+    EXPECT_FALSE(can_data_.Initialize(defs));
+
+    defs = defs_;
+    defs.push_back(MakeDef("", 4, 0x1, false));
+    EXPECT_FALSE(can_data_.Initialize(defs));
+
+    defs = defs_;
+    defs.push_back(MakeDef("fuel", 4, 0x800, false));
+    EXPECT_FALSE(can_data_.Initialize(defs));
+
+    defs = defs_;
+    defs.push_back(MakeDef("fuel", 4, 0x20000000, true));
+    EXPECT_FALSE(can_data_.Initialize(defs));
+
+    defs = defs_;
+    defs.push_back(MakeDef("fuel", 3, 0x7FF, false));
+    EXPECT_FALSE(can_data_.Initialize(defs));
+
+    defs = defs_;
+    defs.push_back(MakeDef("fuel", 3, 0x1FFFFFFF, true));
+    EXPECT_FALSE(can_data_.Initialize(defs));
+
+    defs = defs_;
+    ICDElement elem;
+    elem.offset_ = 3;
+    elem.elem_word_count_ = 2;
+    defs[0].elements.push_back(elem);
+    EXPECT_FALSE(can_data_.Initialize(defs));
+
+    // Not modified
+    EXPECT_EQ(0, can_data_.GetMsgDefs().size());
+}
+
+TEST_F(CANBusDataTest, CopySharesTables)
+{
+    ASSERT_TRUE(can_data_.Initialize(defs_));
+    CANBusData copy = can_data_;
+    EXPECT_EQ(&can_data_.GetMsgDefs(), &copy.GetMsgDefs());
+}
+
+TEST_F(CANBusDataTest, GetLookupKeys)
+{
+    ASSERT_TRUE(can_data_.Initialize(defs_));
+    std::set<uint16_t> chanids;
+    std::set<uint32_t> can_ids;
+    can_data_.GetLookupKeys(std::set<size_t>(), chanids, can_ids);
+    EXPECT_THAT(chanids, ::testing::ElementsAre(3, 9));
+    EXPECT_THAT(can_ids, ::testing::ElementsAre(0x100, 0x7FF, 0x1FFFFFFF));
+
+    chanids.clear();
+    can_ids.clear();
+    can_data_.GetLookupKeys(std::set<size_t>{1}, chanids, can_ids);
+    EXPECT_THAT(chanids, ::testing::ElementsAre(3));
+    EXPECT_THAT(can_ids, ::testing::ElementsAre(0x7FF));
+}
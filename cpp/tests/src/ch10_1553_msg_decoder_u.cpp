@@ -0,0 +1,66 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_1553_msg_decoder.h"
+
+class Ch101553MsgDecoderTest : public ::testing::Test
+{
+   protected:
+    Ch101553MsgDecoder decoder_;
+    MilStd1553F1DataHeaderCommWordFmt fmt_;
+    Ch101553DecodedMsg msg_;
+
+    Ch101553MsgDecoderTest() : decoder_(), fmt_{}, msg_()
+    {
+    }
+};
+
+TEST_F(Ch101553MsgDecoderTest, AddAndClear)
+{
+    msg_.abs_time = 10;
+    decoder_.Add(msg_);
+    msg_.abs_time = 20;
+    decoder_.Add(msg_);
+    ASSERT_EQ(2, decoder_.count);
+    EXPECT_EQ(10, decoder_.Get(0).abs_time);
+    EXPECT_EQ(20, decoder_.Get(1).abs_time);
+
+    // Messages added after a clear overwrite the batch from the start.
+    decoder_.Clear();
+    EXPECT_EQ(0, decoder_.count);
+    msg_.abs_time = 30;
+    decoder_.Add(msg_);
+    ASSERT_EQ(1, decoder_.count);
+    EXPECT_EQ(30, decoder_.Get(0).abs_time);
+}
+
+TEST_F(Ch101553MsgDecoderTest, DecodePayloadRTtoBC)
+{
+    // (txcomm, status, data0, data1)
+    uint16_t words[4] = {0x2C22, 0x2800, 0x1111, 0x2222};
+    fmt_.tx1 = 1;
+    fmt_.sub_addr1 = 1;
+    fmt_.word_count1 = 2;
+    fmt_.length = sizeof(words);
+    ASSERT_TRUE(Ch101553MsgDecoder::DecodePayload(words, &fmt_, msg_));
+
+    EXPECT_EQ(&fmt_, msg_.header);
+    EXPECT_EQ(words + 2, msg_.payload);
+    EXPECT_EQ(reinterpret_cast<const MilStd1553F1StatusWordFmt*>(words + 1), msg_.status_word1);
+    EXPECT_EQ(nullptr, msg_.status_word2);
+    EXPECT_EQ(2, msg_.expected_payload_word_count);
+    EXPECT_EQ(2, msg_.calc_payload_word_count);
+    EXPECT_EQ(0, msg_.is_payload_incomplete);
+
+    // One data word is missing.
+    fmt_.length = sizeof(words) - sizeof(uint16_t);
+    ASSERT_TRUE(Ch101553MsgDecoder::DecodePayload(words, &fmt_, msg_));
+    EXPECT_EQ(1, msg_.calc_payload_word_count);
+    EXPECT_EQ(1, msg_.is_payload_incomplete);
+}
+
+TEST_F(Ch101553MsgDecoderTest, DecodePayloadLengthExceedsMaximum)
+{
+    uint16_t words[2] = {0, 0};
+    fmt_.length = Ch101553MsgDecoder::max_byte_count + 2;
+    EXPECT_FALSE(Ch101553MsgDecoder::DecodePayload(words, &fmt_, msg_));
+}
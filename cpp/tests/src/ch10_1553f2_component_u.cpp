@@ -0,0 +1,173 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_1553f2_component.h"
+#include "ch10_component_test_fixture.h"
+
+class Ch101553F2ComponentTest : public Ch10ComponentTest<Ch101553F2Component>
+{
+   protected:
+    Ch101553F2ComponentTest() : Ch10ComponentTest(Ch10PacketType::MILSTD1553_F2, 5,
+        "milstd1553f2_component_test.parquet")
+    {
+    }
+
+    static MilStd1553F2WordFmt MakeWord(uint16_t data)
+    {
+        MilStd1553F2WordFmt word{};
+        word.data = data;
+        return word;
+    }
+
+    // Append a transaction, with time stamp and intra-packet data header.
+    void AppendMessage(std::vector<uint8_t>& body, uint64_t rtc, uint16_t command,
+        uint16_t response, uint16_t status, uint16_t length = 24)
+    {
+        MilStd1553F2DataHeaderFmt hdr{};
+        hdr.length = length;
+        MilStd1553F2WordFmt words[6] = {MakeWord(command), MakeWord(response),
+            MakeWord(command), MakeWord(0), MakeWord(0), MakeWord(status)};
+
+        AppendObject(body, rtc);
+        AppendObject(body, hdr);
+        AppendObject(body, words);
+    }
+
+    std::vector<uint8_t> MakePacket(uint32_t count, const std::vector<uint8_t>& body)
+    {
+        MilStd1553F2CSDWFmt csdw{};
+        csdw.count = count;
+        return MakePacketBody(csdw, body);
+    }
+};
+
+TEST_F(Ch101553F2ComponentTest, DecodeTransaction)
+{
+    MilStd1553F2DataHeaderFmt hdr{};
+    hdr.length = 24;
+    hdr.EE = 1;
+    MilStd1553F2WordFmt words[6] = {MakeWord(0x2C21), MakeWord(0xBEEF), MakeWord(0x2C21),
+        MakeWord(0), MakeWord(0), MakeWord(0x2800)};
+    words[3].PE = 1;
+
+    MilStd1553F1DataHeaderCommWordFmt f1_hdr;
+    Ch101553DecodedMsg msg;
+    Ch101553F2Component::DecodeTransaction(hdr, reinterpret_cast<const uint8_t*>(words),
+        f1_hdr, msg);
+
+    EXPECT_EQ(&f1_hdr, msg.header);
+    EXPECT_EQ(1, f1_hdr.WE);
+    EXPECT_EQ(1, f1_hdr.FE);
+    EXPECT_EQ(0, f1_hdr.TO);
+    EXPECT_EQ(0, f1_hdr.ME);
+    EXPECT_EQ(0, f1_hdr.RR);
+    EXPECT_EQ(6, f1_hdr.length);
+
+    // 0x2C21 = RT 5, transmit, subaddress 1, word count 1
+    EXPECT_EQ(5, f1_hdr.remote_addr1);
+    EXPECT_EQ(1, f1_hdr.tx1);
+    EXPECT_EQ(1, f1_hdr.sub_addr1);
+    EXPECT_EQ(1, f1_hdr.word_count1);
+
+    EXPECT_EQ(0xBEEF, msg.payload[0]);
+    ASSERT_TRUE(msg.status_word1 != nullptr);
+    EXPECT_EQ(5, msg.status_word1->rtaddr);
+    EXPECT_EQ(nullptr, msg.status_word2);
+    EXPECT_EQ(1, msg.expected_payload_word_count);
+    EXPECT_EQ(1, msg.calc_payload_word_count);
+    EXPECT_EQ(0, msg.is_payload_incomplete);
+}
+
+TEST_F(Ch101553F2ComponentTest, DecodeTransactionTimeOut)
+{
+    MilStd1553F2DataHeaderFmt hdr{};
+    hdr.length = 24;
+    hdr.TM = 1;
+    hdr.TE = 1;
+    MilStd1553F2WordFmt words[6] = {MakeWord(0x2C21), MakeWord(0), MakeWord(0x2C21),
+        MakeWord(0), MakeWord(0), MakeWord(0)};
+
+    MilStd1553F1DataHeaderCommWordFmt f1_hdr;
+    Ch101553DecodedMsg msg;
+    Ch101553F2Component::DecodeTransaction(hdr, reinterpret_cast<const uint8_t*>(words),
+        f1_hdr, msg);
+
+    EXPECT_EQ(0, f1_hdr.WE);
+    EXPECT_EQ(1, f1_hdr.TO);
+    EXPECT_EQ(1, f1_hdr.ME);
+    EXPECT_EQ(nullptr, msg.status_word1);
+    EXPECT_EQ(0, msg.calc_payload_word_count);
+    EXPECT_EQ(1, msg.is_payload_incomplete);
+}
+
+TEST_F(Ch101553F2ComponentTest, ParseAppendsPacket)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 0x2C21, 0x1234, 0x2800);
+    AppendMessage(body, 200, 0x1841, 0x5678, 0x1800);
+    std::vector<uint8_t> packet = MakePacket(2, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    ASSERT_EQ(2, comp_.decoder.count);
+
+    const ParquetMilStd1553F1* writer = ctx_.milstd1553f2_pq_writer;
+
+    // RT to BC, written as command word 1
+    EXPECT_EQ(5, writer->channel_id_[0]);
+    EXPECT_EQ(0x2C21, writer->comm_word1_[0]);
+    EXPECT_EQ(5, writer->rtaddr1_[0]);
+    EXPECT_EQ(1, writer->tr1_[0]);
+    EXPECT_EQ(3, writer->totwrdcnt_[0]);
+    EXPECT_EQ(1, writer->calcwrdcnt_[0]);
+    EXPECT_EQ(1, writer->data_.offsets[1]);
+    EXPECT_EQ(0x1234, writer->data_.values[0]);
+    EXPECT_EQ(0x2800, writer->status_word1_[0]);
+    EXPECT_EQ(-1, writer->status_word2_[0]);
+
+    // BC to RT, written as command word 2
+    EXPECT_EQ(0x1841, writer->comm_word2_[1]);
+    EXPECT_EQ(3, writer->rtaddr2_[1]);
+    EXPECT_EQ(0, writer->tr2_[1]);
+    EXPECT_EQ(2, writer->data_.offsets[2]);
+    EXPECT_EQ(0x5678, writer->data_.values[1]);
+    EXPECT_EQ(0x1800, writer->status_word1_[1]);
+}
+
+TEST_F(Ch101553F2ComponentTest, ParseSkipsExtendedTransaction)
+{
+    // Transactions longer than six words are skipped to the next message.
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 0x2C21, 0x1234, 0x2800, 28);
+    body.insert(body.end(), 4, 0xEE);
+    AppendMessage(body, 200, 0x1841, 0x5678, 0x1800);
+    std::vector<uint8_t> packet = MakePacket(2, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    ASSERT_EQ(2, comp_.decoder.count);
+    EXPECT_EQ(0x1841, ctx_.milstd1553f2_pq_writer->comm_word2_[1]);
+}
+
+TEST_F(Ch101553F2ComponentTest, ParseInvalidMsgLength)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 0x2C21, 0x1234, 0x2800);
+    AppendMessage(body, 200, 0x1841, 0x5678, 0x1800, 20);
+    std::vector<uint8_t> packet = MakePacket(2, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::MILSTD1553F2_MSG_LENGTH, comp_.Parse(data));
+
+    // The message which precedes the failure is appended.
+    EXPECT_EQ(1, comp_.decoder.count);
+    EXPECT_EQ(0x2C21, ctx_.milstd1553f2_pq_writer->comm_word1_[0]);
+    EXPECT_EQ(1, ctx_.diagnostics.GetCount("milstd1553f2_msg_length"));
+}
+
+TEST_F(Ch101553F2ComponentTest, ParseMsgCountExceedsPacket)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 0x2C21, 0x1234, 0x2800);
+    std::vector<uint8_t> packet = MakePacket(1000, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::MILSTD1553F2_MSG_LENGTH, comp_.Parse(data));
+    EXPECT_EQ(1, comp_.decoder.count);
+}
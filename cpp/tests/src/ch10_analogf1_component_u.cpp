@@ -0,0 +1,141 @@
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_analogf1_component.h"
+#include "ch10_component_test_fixture.h"
+
+class Ch10AnalogF1ComponentTest : public Ch10ComponentTest<Ch10AnalogF1Component>
+{
+   protected:
+    Ch10AnalogF1ComponentTest() : Ch10ComponentTest(Ch10PacketType::ANALOG_F1, 9,
+        "analogf1_component_test.parquet")
+    {
+    }
+
+    static AnalogF1CSDWFmt MakeCSDW(uint32_t mode, uint32_t length, uint32_t totchan, bool same)
+    {
+        AnalogF1CSDWFmt csdw{};
+        csdw.mode = mode;
+        csdw.length = length;
+        csdw.subchan = 1;
+        csdw.totchan = totchan;
+        csdw.same = same;
+        return csdw;
+    }
+
+    std::vector<uint8_t> MakePacket(const std::vector<AnalogF1CSDWFmt>& csdws,
+        const std::vector<uint8_t>& body)
+    {
+        std::vector<uint8_t> csdw_bytes;
+        for (const auto& csdw : csdws)
+            AppendObject(csdw_bytes, csdw);
+        return MakePacketBody(csdw_bytes, body);
+    }
+
+    // Little-endian 16-bit words
+    static std::vector<uint8_t> Words(const std::vector<uint16_t>& words)
+    {
+        std::vector<uint8_t> bytes(words.size() * 2);
+        memcpy(bytes.data(), words.data(), bytes.size());
+        return bytes;
+    }
+};
+
+TEST_F(Ch10AnalogF1ComponentTest, GetSampleGeometry)
+{
+    uint32_t stride = 0;
+    uint32_t shift = 0;
+    ASSERT_TRUE(Ch10AnalogF1Component::GetSampleGeometry(MakeCSDW(0, 12, 1, true), stride, shift));
+    EXPECT_EQ(12, stride);
+    EXPECT_EQ(0, shift);
+    ASSERT_TRUE(Ch10AnalogF1Component::GetSampleGeometry(MakeCSDW(1, 12, 1, true), stride, shift));
+    EXPECT_EQ(16, stride);
+    EXPECT_EQ(4, shift);
+    ASSERT_TRUE(Ch10AnalogF1Component::GetSampleGeometry(MakeCSDW(3, 24, 1, true), stride, shift));
+    EXPECT_EQ(32, stride);
+    EXPECT_EQ(0, shift);
+    EXPECT_FALSE(Ch10AnalogF1Component::GetSampleGeometry(MakeCSDW(2, 12, 1, true), stride, shift));
+    EXPECT_FALSE(Ch10AnalogF1Component::GetSampleGeometry(MakeCSDW(0, 0, 1, true), stride, shift));
+    EXPECT_FALSE(Ch10AnalogF1Component::GetSampleGeometry(MakeCSDW(0, 33, 1, true), stride, shift));
+}
+
+TEST_F(Ch10AnalogF1ComponentTest, ParseUnpackedSubchannels)
+{
+    // Three frames of two 12-bit subchannels, padded in the least
+    // significant bits, and a partial frame which is ignored
+    std::vector<uint8_t> body = Words({0x0010, 0x0020, 0x0110, 0x0120, 0xFFF0, 0x1230, 0x0070});
+    std::vector<uint8_t> packet = MakePacket({MakeCSDW(1, 12, 2, true)}, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    EXPECT_EQ(3, comp_.frame_count);
+    EXPECT_EQ(2, comp_.subchannel_count);
+
+    // Rows are ordered by subchannel.
+    const ParquetAnalogF1* writer = ctx_.analogf1_pq_writer;
+    EXPECT_THAT(std::vector<int16_t>(writer->subchannel_.begin(), writer->subchannel_.begin() + 6),
+        ::testing::ElementsAre(1, 1, 1, 2, 2, 2));
+    EXPECT_THAT(std::vector<int32_t>(writer->index_.begin(), writer->index_.begin() + 6),
+        ::testing::ElementsAre(0, 1, 2, 0, 1, 2));
+    EXPECT_THAT(std::vector<int32_t>(writer->sample_.begin(), writer->sample_.begin() + 6),
+        ::testing::ElementsAre(0x001, 0x011, 0xFFF, 0x002, 0x012, 0x123));
+    EXPECT_EQ(9, writer->channel_id_[0]);
+}
+
+TEST_F(Ch10AnalogF1ComponentTest, ParsePackedWithSubchannelCSDWs)
+{
+    // Two 12-bit subchannels with a CSDW each, two frames: 0xABC, 0x123,
+    // 0xFFF, 0x000
+    std::vector<AnalogF1CSDWFmt> csdws{MakeCSDW(0, 12, 2, false), MakeCSDW(0, 12, 2, false)};
+    csdws[1].subchan = 2;
+    std::vector<uint8_t> body{0xBC, 0x3A, 0x12, 0xFF, 0x0F, 0x00};
+    std::vector<uint8_t> packet = MakePacket(csdws, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    EXPECT_EQ(2, comp_.frame_count);
+    ASSERT_EQ(2, comp_.csdws.size());
+    EXPECT_EQ(2, comp_.csdws[1].subchan);
+    EXPECT_THAT(std::vector<int32_t>(ctx_.analogf1_pq_writer->sample_.begin(),
+        ctx_.analogf1_pq_writer->sample_.begin() + 4),
+        ::testing::ElementsAre(0xABC, 0xFFF, 0x123, 0x000));
+}
+
+TEST_F(Ch10AnalogF1ComponentTest, ParseDecimated)
+{
+    ctx_.SetAnalogF1Decimation(2);
+    std::vector<uint8_t> body = Words({1, 2, 3, 4, 5});
+    std::vector<uint8_t> packet = MakePacket({MakeCSDW(3, 16, 1, true)}, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    EXPECT_EQ(5, comp_.frame_count);
+    EXPECT_THAT(std::vector<int32_t>(ctx_.analogf1_pq_writer->sample_.begin(),
+        ctx_.analogf1_pq_writer->sample_.begin() + 3), ::testing::ElementsAre(1, 3, 5));
+    EXPECT_THAT(std::vector<int32_t>(ctx_.analogf1_pq_writer->index_.begin(),
+        ctx_.analogf1_pq_writer->index_.begin() + 3), ::testing::ElementsAre(0, 2, 4));
+}
+
+TEST_F(Ch10AnalogF1ComponentTest, ParseCSDWCountExceedsPacket)
+{
+    std::vector<uint8_t> body(4, 0);
+    std::vector<uint8_t> packet = MakePacket({MakeCSDW(0, 12, 8, false)}, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::ANALOGF1_CSDW_COUNT, comp_.Parse(data));
+    EXPECT_EQ(0, comp_.frame_count);
+    EXPECT_EQ(1, ctx_.diagnostics.GetCount("analogf1_csdw_count"));
+}
+
+TEST_F(Ch10AnalogF1ComponentTest, ParseUnsupportedFormat)
+{
+    // Subchannels with different sample lengths
+    std::vector<AnalogF1CSDWFmt> csdws{MakeCSDW(0, 12, 2, false), MakeCSDW(0, 8, 2, false)};
+    std::vector<uint8_t> body(8, 0);
+    std::vector<uint8_t> packet = MakePacket(csdws, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::ANALOGF1_FORMAT, comp_.Parse(data));
+
+    // Reserved mode
+    packet = MakePacket({MakeCSDW(2, 12, 1, true)}, body);
+    data = packet.data();
+    EXPECT_EQ(Ch10Status::ANALOGF1_FORMAT, comp_.Parse(data));
+    EXPECT_EQ(2, ctx_.diagnostics.GetCount("analogf1_format"));
+}
@@ -0,0 +1,111 @@
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_canbus_component.h"
+#include "ch10_component_test_fixture.h"
+
+class Ch10CANBusComponentTest : public Ch10ComponentTest<Ch10CANBusComponent>
+{
+   protected:
+    Ch10CANBusComponentTest() : Ch10ComponentTest(Ch10PacketType::CAN_BUS, 5,
+        "canbus_component_test.parquet")
+    {
+    }
+
+    // Append a message, with time stamp, message header and ID word, and
+    // fill to a 16-bit boundary.
+    void AppendMessage(std::vector<uint8_t>& body, uint64_t rtc, uint32_t subchan,
+        uint32_t id, bool extended, const std::vector<uint8_t>& data)
+    {
+        CANBusMsgHdrFmt hdr{};
+        hdr.length = static_cast<uint32_t>(sizeof(CANBusIDWordFmt) + data.size());
+        hdr.subchan = subchan;
+        CANBusIDWordFmt id_word{};
+        id_word.ID = id;
+        id_word.IDE = extended;
+
+        AppendObject(body, rtc);
+        AppendObject(body, hdr);
+        AppendObject(body, id_word);
+        AppendData(body, data, true);
+    }
+
+    std::vector<uint8_t> MakePacket(uint32_t count, const std::vector<uint8_t>& body)
+    {
+        CANBusCSDWFmt csdw{};
+        csdw.count = count;
+        return MakePacketBody(csdw, body);
+    }
+};
+
+TEST_F(Ch10CANBusComponentTest, AssemblePayload)
+{
+    std::vector<uint8_t> data{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    EXPECT_EQ(0x0807060504030201ULL, Ch10CANBusComponent::AssemblePayload(data.data(), 8));
+    EXPECT_EQ(0x030201ULL, Ch10CANBusComponent::AssemblePayload(data.data(), 3));
+    EXPECT_EQ(0ULL, Ch10CANBusComponent::AssemblePayload(data.data(), 0));
+}
+
+TEST_F(Ch10CANBusComponentTest, ParseAppendsPacket)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 1, 0x123, false, {0xAA, 0xBB, 0xCC});
+    AppendMessage(body, 200, 2, 0x1ABCDEF0, true, {1, 2, 3, 4, 5, 6, 7, 8});
+    AppendMessage(body, 300, 3, 0x7FF, false, {});
+    std::vector<uint8_t> packet = MakePacket(3, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    ASSERT_EQ(3, comp_.parsed_count);
+
+    const ParquetCANBus* writer = ctx_.canbus_pq_writer;
+    EXPECT_EQ(0x123, writer->id_[0]);
+    EXPECT_EQ(0, writer->IDE_[0]);
+    EXPECT_EQ(3, writer->DLC_[0]);
+    EXPECT_EQ(0xCCBBAA, writer->data_[0]);
+    EXPECT_EQ(1, writer->subchannel_[0]);
+    EXPECT_EQ(5, writer->channel_id_[0]);
+
+    EXPECT_EQ(0x1ABCDEF0, writer->id_[1]);
+    EXPECT_EQ(1, writer->IDE_[1]);
+    EXPECT_EQ(8, writer->DLC_[1]);
+    EXPECT_EQ(0x0807060504030201LL, writer->data_[1]);
+
+    EXPECT_EQ(0x7FF, writer->id_[2]);
+    EXPECT_EQ(0, writer->DLC_[2]);
+    EXPECT_EQ(0, writer->data_[2]);
+}
+
+TEST_F(Ch10CANBusComponentTest, ParseInvalidLength)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 1, 0x10, false, {0x01, 0x02});
+    AppendMessage(body, 200, 1, 0x11, false, {0x03, 0x04});
+
+    // Length of the second message exceeds the ID word and eight bytes.
+    CANBusMsgHdrFmt hdr{};
+    size_t second_hdr_pos = 8 + sizeof(CANBusMsgHdrFmt) + sizeof(CANBusIDWordFmt) + 2 + 8;
+    memcpy(&hdr, body.data() + second_hdr_pos, sizeof(hdr));
+    hdr.length = 13;
+    memcpy(body.data() + second_hdr_pos, &hdr, sizeof(hdr));
+
+    std::vector<uint8_t> packet = MakePacket(2, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::CANBUS_MSG_LENGTH, comp_.Parse(data));
+    EXPECT_EQ(1, comp_.parsed_count);
+    EXPECT_EQ(0x10, ctx_.canbus_pq_writer->id_[0]);
+    EXPECT_EQ(1, ctx_.diagnostics.GetCount("canbus_msg_length"));
+}
+
+TEST_F(Ch10CANBusComponentTest, ParseCountExceedsPacket)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 1, 0x10, false, {0x01});
+    std::vector<uint8_t> packet = MakePacket(1000, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::CANBUS_MSG_LENGTH, comp_.Parse(data));
+    EXPECT_EQ(1, comp_.parsed_count);
+
+    // Arrays are not sized by the message count of the CSDW.
+    EXPECT_GE(1, comp_.payload.size());
+}
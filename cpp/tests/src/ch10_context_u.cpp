@@ -883,4 +883,79 @@ TEST(Ch10ContextTest, RegisterUnhandledPacketType)
     EXPECT_TRUE(ctx.RegisterUnhandledPacketType(pcmf1));
     EXPECT_FALSE(ctx.RegisterUnhandledPacketType(pcmf0));
     EXPECT_FALSE(ctx.RegisterUnhandledPacketType(pcmf1));
-}
\ No newline at end of file
+}
+
+TEST(Ch10ContextTest, IsPacketSelected)
+{
+    Ch10Context ctx(0);
+    uint8_t tmats = static_cast<uint8_t>(Ch10PacketType::COMPUTER_GENERATED_DATA_F1);
+    uint8_t tdp = static_cast<uint8_t>(Ch10PacketType::TIME_DATA_F1);
+    uint8_t milstd1553 = static_cast<uint8_t>(Ch10PacketType::MILSTD1553_F1);
+
+    // All packets are selected by default
+    EXPECT_TRUE(ctx.IsPacketSelected(0, 5, milstd1553));
+
+    ctx.SetPacketSelection(1000, std::set<uint16_t>{5, 7});
+    EXPECT_FALSE(ctx.IsPacketSelected(999, 5, milstd1553));
+    EXPECT_TRUE(ctx.IsPacketSelected(1000, 5, milstd1553));
+    EXPECT_TRUE(ctx.IsPacketSelected(2000, 7, milstd1553));
+    EXPECT_FALSE(ctx.IsPacketSelected(2000, 6, milstd1553));
+
+    // TMATS and time packets are always selected
+    EXPECT_TRUE(ctx.IsPacketSelected(0, 0, tmats));
+    EXPECT_TRUE(ctx.IsPacketSelected(0, 6, tdp));
+}
+
+TEST(Ch10ContextTest, ShouldVerifyDataChecksum)
+{
+    Ch10Context ctx(0);
+
+    // All packets are verified by default
+    EXPECT_TRUE(ctx.ShouldVerifyDataChecksum());
+    EXPECT_TRUE(ctx.ShouldVerifyDataChecksum());
+
+    ctx.SetDataChecksumPolicy(Ch10ChecksumPolicy::HEADER_ONLY, 1);
+    EXPECT_FALSE(ctx.ShouldVerifyDataChecksum());
+
+    // Packet count is 3 at this point, such that packets 3, 4 and 5
+    // are checked and only 3 is a multiple of the interval.
+    ctx.SetDataChecksumPolicy(Ch10ChecksumPolicy::SAMPLE, 3);
+    EXPECT_TRUE(ctx.ShouldVerifyDataChecksum());
+    EXPECT_FALSE(ctx.ShouldVerifyDataChecksum());
+    EXPECT_FALSE(ctx.ShouldVerifyDataChecksum());
+    EXPECT_TRUE(ctx.ShouldVerifyDataChecksum());
+
+    // Intervals less than one are treated as one
+    ctx.SetDataChecksumPolicy(Ch10ChecksumPolicy::SAMPLE, 0);
+    EXPECT_TRUE(ctx.ShouldVerifyDataChecksum());
+
+    PerfStats stats = ctx.GetPerfStats();
+    EXPECT_EQ(5, stats.GetCount("data_checksums_verified"));
+    EXPECT_EQ(3, stats.GetCount("data_checksums_skipped"));
+}
+
+TEST(Ch10ContextTest, GetPerfStats)
+{
+    Ch10Context ctx(0);
+    ctx.CountPacket(static_cast<uint8_t>(Ch10PacketType::MILSTD1553_F1));
+    ctx.CountPacket(static_cast<uint8_t>(Ch10PacketType::MILSTD1553_F1));
+    ctx.CountPacket(0x7F);
+    ctx.CountSyncLoss();
+    ctx.CountResyncBytes(3);
+    ctx.CountHeaderChecksumFailure();
+    ctx.CountDataChecksumFailure();
+    ctx.CountRead(1000, 2000);
+    ctx.body_parse_timer.Add(500);
+
+    PerfStats stats = ctx.GetPerfStats();
+    EXPECT_EQ(2, stats.GetCount("packets_milstd1553_f1"));
+    EXPECT_EQ(1, stats.GetCount("packets_type_0x7f"));
+    EXPECT_EQ(1, stats.GetCount("sync_losses"));
+    EXPECT_EQ(3, stats.GetCount("resync_bytes"));
+    EXPECT_EQ(1, stats.GetCount("header_checksum_failures"));
+    EXPECT_EQ(1, stats.GetCount("data_checksum_failures"));
+    EXPECT_EQ(1000, stats.GetCount("bytes_read"));
+    EXPECT_EQ(2000, stats.GetTimeNs("read"));
+    EXPECT_EQ(500, stats.GetTimeNs("body_parse"));
+    EXPECT_EQ(0, stats.GetTimeNs("header_parse"));
+}
@@ -0,0 +1,135 @@
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_ethernetf1_component.h"
+#include "ch10_component_test_fixture.h"
+
+class Ch10EthernetF1ComponentTest : public Ch10ComponentTest<Ch10EthernetF1Component>
+{
+   protected:
+    uint16_t iph_length_;
+
+    Ch10EthernetF1ComponentTest() : Ch10ComponentTest(Ch10PacketType::ETHERNET_DATA_F1, 7,
+        "ethernetf1_component_test.parquet"),
+        iph_length_(sizeof(uint64_t) + sizeof(EthernetF1IPDHFmt))
+    {
+    }
+
+    // Append a message, with time stamp, intra-packet data header and payload.
+    void AppendMessage(std::vector<uint8_t>& body, uint64_t rtc, uint32_t vl,
+        uint32_t dst_port, const std::vector<uint8_t>& data)
+    {
+        EthernetF1IPDHFmt ipdh{};
+        ipdh.data_length = static_cast<uint32_t>(data.size());
+        ipdh.virtual_link = vl;
+        ipdh.src_ip = 0x0A000001;
+        ipdh.dst_ip = 0xE0E00000 | vl;
+        ipdh.src_port = 5000;
+        ipdh.dst_port = dst_port;
+
+        AppendObject(body, rtc);
+        AppendObject(body, ipdh);
+        AppendData(body, data);
+    }
+
+    std::vector<uint8_t> MakePacket(uint32_t count, const std::vector<uint8_t>& body)
+    {
+        EthernetF1CSDW csdw{};
+        csdw.msg_count = count;
+        csdw.iph_length = iph_length_;
+        return MakePacketBody(csdw, body);
+    }
+};
+
+TEST_F(Ch10EthernetF1ComponentTest, ParseAppendsPacket)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 21, 1001, {0xAA, 0xBB, 0xCC});
+    AppendMessage(body, 200, 22, 1002, {});
+    AppendMessage(body, 300, 23, 1003, {1, 2, 3, 4, 5});
+    std::vector<uint8_t> packet = MakePacket(3, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    ASSERT_EQ(3, comp_.parsed_count);
+
+    const ParquetEthernetF1* writer = ctx_.ethernetf1_pq_writer;
+    EXPECT_EQ(7, writer->channel_id_[0]);
+    EXPECT_EQ(21, writer->virtual_link_[0]);
+    EXPECT_EQ(0x0A000001, writer->src_ip_[0]);
+    EXPECT_EQ(static_cast<int32_t>(0xE0E00015), writer->dst_ip_[0]);
+    EXPECT_EQ(5000, writer->src_port_[0]);
+    EXPECT_EQ(1001, writer->dst_port_[0]);
+    EXPECT_EQ(3, writer->payload_size_[0]);
+    EXPECT_EQ(3, writer->payload_.offsets[1]);
+    EXPECT_EQ(static_cast<int8_t>(0xCC), writer->payload_.values[2]);
+
+    EXPECT_EQ(22, writer->virtual_link_[1]);
+    EXPECT_EQ(0, writer->payload_size_[1]);
+    EXPECT_EQ(3, writer->payload_.offsets[2]);
+
+    EXPECT_EQ(23, writer->virtual_link_[2]);
+    EXPECT_EQ(5, writer->payload_size_[2]);
+    EXPECT_EQ(8, writer->payload_.offsets[3]);
+    EXPECT_EQ(1, writer->payload_.values[3]);
+    EXPECT_EQ(5, writer->payload_.values[7]);
+}
+
+TEST_F(Ch10EthernetF1ComponentTest, ParseSkipsExtendedIPH)
+{
+    // Intra-packet headers longer than the known header are skipped.
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 30, 1001, {0x01, 0x02});
+    body.insert(body.begin() + sizeof(uint64_t) + sizeof(EthernetF1IPDHFmt), 4, 0xEE);
+    iph_length_ += 4;
+    std::vector<uint8_t> packet = MakePacket(1, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    ASSERT_EQ(1, comp_.parsed_count);
+    EXPECT_EQ(2, ctx_.ethernetf1_pq_writer->payload_size_[0]);
+    EXPECT_EQ(0x01, ctx_.ethernetf1_pq_writer->payload_.values[0]);
+}
+
+TEST_F(Ch10EthernetF1ComponentTest, ParseInvalidIPHLength)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 30, 1001, {0x01});
+    iph_length_ = sizeof(uint64_t);
+    std::vector<uint8_t> packet = MakePacket(1, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::ETHERNETF1_IPH_LENGTH, comp_.Parse(data));
+    EXPECT_EQ(0, comp_.parsed_count);
+    EXPECT_EQ(1, ctx_.diagnostics.GetCount("ethernetf1_iph_length"));
+}
+
+TEST_F(Ch10EthernetF1ComponentTest, ParseInvalidMsgLength)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 30, 1001, {0x01, 0x02});
+    AppendMessage(body, 200, 31, 1002, {0x03, 0x04});
+
+    // Length of the second payload exceeds the packet body.
+    EthernetF1IPDHFmt ipdh{};
+    size_t second_ipdh_pos = 2 * sizeof(uint64_t) + sizeof(EthernetF1IPDHFmt) + 2;
+    memcpy(&ipdh, body.data() + second_ipdh_pos, sizeof(ipdh));
+    ipdh.data_length = 3;
+    memcpy(body.data() + second_ipdh_pos, &ipdh, sizeof(ipdh));
+
+    std::vector<uint8_t> packet = MakePacket(2, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::ETHERNETF1_MSG_LENGTH, comp_.Parse(data));
+    EXPECT_EQ(1, comp_.parsed_count);
+    EXPECT_EQ(30, ctx_.ethernetf1_pq_writer->virtual_link_[0]);
+    EXPECT_EQ(1, ctx_.diagnostics.GetCount("ethernetf1_msg_length"));
+}
+
+TEST_F(Ch10EthernetF1ComponentTest, ParsePayloadExceedsMaximum)
+{
+    std::vector<uint8_t> payload(Ch10EthernetF1Component::max_payload_size + 1, 0x11);
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 30, 1001, payload);
+    std::vector<uint8_t> packet = MakePacket(1, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::ETHERNETF1_MSG_LENGTH, comp_.Parse(data));
+    EXPECT_EQ(0, comp_.parsed_count);
+}
@@ -0,0 +1,102 @@
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_messagef0_component.h"
+#include "ch10_component_test_fixture.h"
+
+class Ch10MessageF0ComponentTest : public Ch10ComponentTest<Ch10MessageF0Component>
+{
+   protected:
+    Ch10MessageF0ComponentTest() : Ch10ComponentTest(Ch10PacketType::MESSAGE_F0, 4,
+        "messagef0_component_test.parquet")
+    {
+    }
+
+    // Append a message, with time stamp, intra-packet data header and
+    // data padded to an even length.
+    void AppendMessage(std::vector<uint8_t>& body, uint64_t rtc, uint32_t subchannel,
+        const std::vector<uint8_t>& data, uint32_t data_error = 0)
+    {
+        MessageF0DataHeaderFmt hdr{};
+        hdr.length = static_cast<uint32_t>(data.size());
+        hdr.subchannel = subchannel;
+        hdr.DE = data_error;
+
+        AppendObject(body, rtc);
+        AppendObject(body, hdr);
+        AppendData(body, data, true);
+    }
+
+    std::vector<uint8_t> MakePacket(uint32_t count, uint32_t pkt_type,
+        const std::vector<uint8_t>& body)
+    {
+        MessageF0CSDWFmt csdw{};
+        csdw.count = count;
+        csdw.pkt_type = pkt_type;
+        return MakePacketBody(csdw, body);
+    }
+
+    std::string GetValue(size_t row)
+    {
+        const BinaryColumnBuffer& buffer = ctx_.messagef0_pq_writer->data_;
+        return std::string(buffer.values.begin() + buffer.offsets[row],
+                           buffer.values.begin() + buffer.offsets[row + 1]);
+    }
+};
+
+TEST_F(Ch10MessageF0ComponentTest, ParseAppendsPacket)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 5, {'h', 'e', 'l', 'l', 'o'});
+    AppendMessage(body, 200, 6, {'o', 'k'}, 1);
+    std::vector<uint8_t> packet = MakePacket(2, 0, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    ASSERT_EQ(2, comp_.parsed_count);
+
+    const ParquetMessageF0* writer = ctx_.messagef0_pq_writer;
+    EXPECT_EQ(4, writer->channel_id_[0]);
+    EXPECT_EQ(5, writer->subchannel_[0]);
+    EXPECT_EQ(0, writer->data_error_[0]);
+    EXPECT_EQ(6, writer->subchannel_[1]);
+    EXPECT_EQ(1, writer->data_error_[1]);
+    EXPECT_EQ("hello", GetValue(0));
+    EXPECT_EQ("ok", GetValue(1));
+}
+
+TEST_F(Ch10MessageF0ComponentTest, ParseSegment)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 5, {'s', 'e', 'g'});
+    std::vector<uint8_t> packet = MakePacket(1, 2, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    ASSERT_EQ(1, comp_.parsed_count);
+    EXPECT_EQ(2, ctx_.messagef0_pq_writer->pkt_type_[0]);
+    EXPECT_EQ("seg", GetValue(0));
+}
+
+TEST_F(Ch10MessageF0ComponentTest, ParseInvalidMsgLength)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 5, {'a', 'b'});
+    AppendMessage(body, 200, 6, {'c', 'd', 'e', 'f'});
+    body.resize(body.size() - 2);
+    std::vector<uint8_t> packet = MakePacket(2, 0, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::MESSAGEF0_MSG_LENGTH, comp_.Parse(data));
+    EXPECT_EQ(1, comp_.parsed_count);
+    EXPECT_EQ("ab", GetValue(0));
+    EXPECT_EQ(1, ctx_.diagnostics.GetCount("messagef0_msg_length"));
+}
+
+TEST_F(Ch10MessageF0ComponentTest, ParseMsgCountExceedsPacket)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, 100, 5, {'a', 'b'});
+    std::vector<uint8_t> packet = MakePacket(3, 0, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::MESSAGEF0_MSG_LENGTH, comp_.Parse(data));
+    EXPECT_EQ(1, comp_.parsed_count);
+}
@@ -358,6 +358,25 @@ TEST_F(Ch10PacketHeaderComponentTest, VerifyDataChecksum16BitNoSecondaryFalse)
     EXPECT_EQ(status_, Ch10Status::CHECKSUM_FALSE);
 }
 
+TEST_F(Ch10PacketHeaderComponentTest, VerifyDataChecksumFalseRecordsDiagnostic)
+{
+    pkt_hdr_fmt_.checksum_existence = 2;  // 16-bit
+    pkt_hdr_fmt_.secondary_hdr = 0;
+
+    int body_and_footer_len = 222;
+    int corr_total_pkt_len = 0;
+    body_ptr_ = CreateFakeBodyAndFooter16(body_and_footer_len, pkt_hdr_fmt_.secondary_hdr,
+                                          corr_total_pkt_len);
+
+    for (int i = 0; i < 3; i++)
+    {
+        status_ = ch10_pkt_hdr_comp_.VerifyDataChecksum(body_ptr_,
+            pkt_hdr_fmt_.checksum_existence, corr_total_pkt_len + 4, pkt_hdr_fmt_.secondary_hdr);
+        EXPECT_EQ(status_, Ch10Status::CHECKSUM_FALSE);
+    }
+    EXPECT_EQ(3, ctx_.diagnostics.GetCount("data_checksum_false"));
+}
+
 TEST_F(Ch10PacketHeaderComponentTest, VerifyDataChecksum16BitWithSecondaryTrue)
 {
     pkt_hdr_fmt_.checksum_existence = 2;  // 16-bit
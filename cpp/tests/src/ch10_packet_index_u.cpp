@@ -0,0 +1,238 @@
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "ch10_packet_index.h"
+#include "ch10_header_format.h"
+#include "ch10_tdpf1_hdr_format.h"
+#include "parser_config_params.h"
+#include "managed_path.h"
+
+class Ch10PacketIndexTest : public ::testing::Test
+{
+   protected:
+    Ch10PacketIndex index_;
+    Ch10PacketSelection selection_;
+    ParserConfigParams config_;
+    std::vector<uint8_t> data_;
+
+    // Positions of packets in data_
+    std::vector<uint64_t> positions_;
+
+    uint64_t parse_begin_;
+    uint64_t data_begin_;
+    uint64_t parse_end_;
+
+    // RTC is in units of 100 ns
+    const uint64_t rtc_per_sec_ = 10000000;
+
+    Ch10PacketIndexTest() : parse_begin_(0), data_begin_(0), parse_end_(0)
+    {}
+
+    void AppendPacket(uint16_t chanid, uint8_t data_type, uint64_t rtc,
+        const std::vector<uint8_t>& body)
+    {
+        Ch10PacketHeaderFmt hdr;
+        memset(&hdr, 0, sizeof(hdr));
+        hdr.sync = 0xEB25;
+        hdr.chanID = chanid;
+        hdr.pkt_size = static_cast<uint32_t>(sizeof(hdr) + body.size());
+        hdr.data_size = static_cast<uint32_t>(body.size());
+        hdr.data_type = data_type;
+        hdr.rtc1 = static_cast<uint32_t>(rtc & 0xFFFFFFFF);
+        hdr.rtc2 = static_cast<uint32_t>(rtc >> 32);
+        const uint16_t* words = reinterpret_cast<const uint16_t*>(&hdr);
+        uint16_t checksum = 0;
+        for (size_t i = 0; i < (sizeof(hdr) - 2) / 2; i++)
+            checksum += words[i];
+        hdr.checksum = checksum;
+
+        positions_.push_back(data_.size());
+        const uint8_t* hdr_ptr = reinterpret_cast<const uint8_t*>(&hdr);
+        data_.insert(data_.end(), hdr_ptr, hdr_ptr + sizeof(hdr));
+        data_.insert(data_.end(), body.begin(), body.end());
+    }
+
+    // Time data packet with IRIG time 10 seconds after the epoch
+    std::vector<uint8_t> MakeTDPBody()
+    {
+        TDF1CSDWFmt csdw;
+        memset(&csdw, 0, sizeof(csdw));
+        csdw.src = 1;
+        TDF1DataIRIGFmt irig;
+        memset(&irig, 0, sizeof(irig));
+        irig.TSn = 1;
+        irig.Dn = 1;
+
+        std::vector<uint8_t> body(sizeof(csdw) + sizeof(irig) + 2, 0);
+        memcpy(body.data(), &csdw, sizeof(csdw));
+        memcpy(body.data() + sizeof(csdw), &irig, sizeof(irig));
+        return body;
+    }
+
+    // TMATS, TDP, then five 1553 packets at one second intervals
+    // beginning one second after the TDP, with bytes between some
+    // packets which are not headers, and an incomplete final packet.
+    void MakeData()
+    {
+        std::vector<uint8_t> body(8, 0);
+        AppendPacket(0, 0x01, 0, body);
+        AppendPacket(1, 0x11, rtc_per_sec_, MakeTDPBody());
+        for (uint64_t i = 1; i < 6; i++)
+        {
+            AppendPacket(static_cast<uint16_t>(4 + i % 2), 0x19, (i + 1) * rtc_per_sec_, body);
+            data_.insert(data_.end(), 3, 0xEB);
+        }
+        AppendPacket(5, 0x19, 7 * rtc_per_sec_, body);
+        data_.resize(data_.size() - 4);
+        positions_.pop_back();
+    }
+};
+
+TEST_F(Ch10PacketIndexTest, IndexBuffer)
+{
+    MakeData();
+    index_.IndexBuffer(data_.data(), data_.size());
+    ASSERT_EQ(positions_.size(), index_.entries.size());
+
+    for (size_t i = 0; i < positions_.size(); i++)
+        EXPECT_EQ(positions_.at(i), index_.entries.at(i).position);
+
+    EXPECT_EQ(0x01, index_.entries.at(0).data_type);
+    EXPECT_EQ(0x11, index_.entries.at(1).data_type);
+    EXPECT_EQ(1, index_.entries.at(1).channel_id);
+    EXPECT_EQ(5, index_.entries.at(2).channel_id);
+    EXPECT_EQ(4, index_.entries.at(3).channel_id);
+
+    // No absolute time prior to the TDP
+    EXPECT_EQ(0, index_.entries.at(0).abs_time);
+    EXPECT_EQ(uint64_t(10e9), index_.entries.at(1).abs_time);
+    for (size_t i = 2; i < index_.entries.size(); i++)
+    {
+        EXPECT_EQ(uint64_t(10e9) + (i - 1) * uint64_t(1e9), index_.entries.at(i).abs_time);
+        EXPECT_EQ(i * rtc_per_sec_ * 100, index_.entries.at(i).rtc);
+    }
+}
+
+TEST_F(Ch10PacketIndexTest, SelectRangeTime)
+{
+    MakeData();
+    index_.IndexBuffer(data_.data(), data_.size());
+    selection_.has_time_range_ = true;
+    selection_.start_sec_ = 2.0;
+    selection_.end_sec_ = 4.0;
+
+    // Time relative to the TDP, packets 3, 4 and 5
+    ASSERT_TRUE(index_.SelectRange(selection_, parse_begin_, data_begin_, parse_end_));
+    EXPECT_EQ(positions_.at(1), parse_begin_);
+    EXPECT_EQ(positions_.at(3), data_begin_);
+    EXPECT_EQ(positions_.at(5) + index_.entries.at(5).pkt_size, parse_end_);
+}
+
+TEST_F(Ch10PacketIndexTest, SelectRangeBytes)
+{
+    MakeData();
+    index_.IndexBuffer(data_.data(), data_.size());
+    selection_.has_byte_range_ = true;
+    selection_.begin_byte_ = positions_.at(2) + 1;
+    selection_.end_byte_ = positions_.at(4) + 1;
+
+    // Packets which begin in the range, 3 and 4
+    ASSERT_TRUE(index_.SelectRange(selection_, parse_begin_, data_begin_, parse_end_));
+    EXPECT_EQ(positions_.at(1), parse_begin_);
+    EXPECT_EQ(positions_.at(3), data_begin_);
+    EXPECT_EQ(positions_.at(4) + index_.entries.at(4).pkt_size, parse_end_);
+
+    // Intersection with time range
+    selection_.has_time_range_ = true;
+    selection_.start_sec_ = 3.0;
+    selection_.end_sec_ = 10.0;
+    ASSERT_TRUE(index_.SelectRange(selection_, parse_begin_, data_begin_, parse_end_));
+    EXPECT_EQ(positions_.at(4), data_begin_);
+    EXPECT_EQ(positions_.at(4) + index_.entries.at(4).pkt_size, parse_end_);
+}
+
+TEST_F(Ch10PacketIndexTest, SelectRangeEmpty)
+{
+    MakeData();
+    index_.IndexBuffer(data_.data(), data_.size());
+    selection_.has_time_range_ = true;
+    selection_.start_sec_ = 100.0;
+    selection_.end_sec_ = 200.0;
+    EXPECT_FALSE(index_.SelectRange(selection_, parse_begin_, data_begin_, parse_end_));
+
+    // No packets with absolute time
+    index_.IndexBuffer(data_.data(), positions_.at(1));
+    selection_.start_sec_ = 0.0;
+    EXPECT_FALSE(index_.SelectRange(selection_, parse_begin_, data_begin_, parse_end_));
+}
+
+TEST_F(Ch10PacketIndexTest, BuildWriteRead)
+{
+    MakeData();
+    ManagedPath ch10_path(std::string("ch10_packet_index_test.ch10"));
+    ManagedPath index_path = Ch10PacketIndex::GetIndexPath(ch10_path);
+    EXPECT_EQ("ch10_packet_index_test.ch10.tipidx", index_path.filename().string());
+    std::ofstream ofs(ch10_path.string(), std::ios::binary | std::ios::trunc);
+    ofs.write(reinterpret_cast<const char*>(data_.data()), data_.size());
+    ofs.close();
+
+    ASSERT_EQ(EX_OK, index_.LoadOrBuild(ch10_path));
+    ASSERT_EQ(positions_.size(), index_.entries.size());
+    EXPECT_TRUE(index_path.is_regular_file());
+
+    Ch10PacketIndex read_index;
+    ASSERT_EQ(EX_OK, read_index.Read(index_path, ch10_path));
+    ASSERT_EQ(index_.entries.size(), read_index.entries.size());
+    EXPECT_EQ(0, memcmp(index_.entries.data(), read_index.entries.data(),
+        index_.entries.size() * sizeof(Ch10PacketIndexEntry)));
+
+    // A change to the ch10 file makes the index stale
+    ofs.open(ch10_path.string(), std::ios::binary | std::ios::app);
+    ofs.write(reinterpret_cast<const char*>(data_.data()), 10);
+    ofs.close();
+    EXPECT_EQ(EX_DATAERR, read_index.Read(index_path, ch10_path));
+
+    std::filesystem::remove(index_path);
+    EXPECT_EQ(EX_NOINPUT, read_index.Read(index_path, ch10_path));
+    std::filesystem::remove(ch10_path);
+}
+
+TEST_F(Ch10PacketIndexTest, SelectionInitialize)
+{
+    ASSERT_TRUE(selection_.Initialize(config_));
+    EXPECT_FALSE(selection_.IsActive());
+
+    config_.time_range_str_ = "60.5:120";
+    config_.byte_range_str_ = "0x100:4096";
+    config_.channel_ids_str_ = "1,5,12";
+    ASSERT_TRUE(selection_.Initialize(config_));
+    EXPECT_TRUE(selection_.HasRange());
+    EXPECT_DOUBLE_EQ(60.5, selection_.start_sec_);
+    EXPECT_DOUBLE_EQ(120.0, selection_.end_sec_);
+    EXPECT_EQ(256, selection_.begin_byte_);
+    EXPECT_EQ(4096, selection_.end_byte_);
+    EXPECT_THAT(selection_.channel_ids_, ::testing::ElementsAre(1, 5, 12));
+
+    config_.channel_ids_str_ = "";
+    config_.byte_range_str_ = "";
+    config_.time_range_str_ = "120:60";
+    EXPECT_FALSE(selection_.Initialize(config_));
+    config_.time_range_str_ = "60";
+    EXPECT_FALSE(selection_.Initialize(config_));
+    config_.time_range_str_ = "";
+
+    config_.byte_range_str_ = "-1:100";
+    EXPECT_FALSE(selection_.Initialize(config_));
+    config_.byte_range_str_ = "";
+
+    config_.channel_ids_str_ = "1,70000";
+    EXPECT_FALSE(selection_.Initialize(config_));
+    config_.channel_ids_str_ = "1,a";
+    EXPECT_FALSE(selection_.Initialize(config_));
+}
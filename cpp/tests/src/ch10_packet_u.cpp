@@ -18,6 +18,13 @@
 #include "ch10_videof0_component_mock.h"
 #include "ch10_ethernetf0_component_mock.h"
 #include "ch10_arinc429f0_component_mock.h"
+#include "ch10_pcmf1_component_mock.h"
+#include "ch10_canbus_component_mock.h"
+#include "ch10_ethernetf1_component_mock.h"
+#include "ch10_analogf1_component_mock.h"
+#include "ch10_1553f2_component_mock.h"
+#include "ch10_uartf0_component_mock.h"
+#include "ch10_messagef0_component_mock.h"
 
 using ::testing::Return;
 using ::testing::NiceMock;
@@ -37,19 +44,31 @@ class Ch10PacketTest : public ::testing::Test
     NiceMock<MockCh10VideoF0Component> mock_vid_;
     NiceMock<MockCh10EthernetF0Component> mock_eth_;
     NiceMock<MockCh10429F0Component> mock_arinc429_;
+    NiceMock<MockCh10PCMF1Component> mock_pcmf1_;
+    NiceMock<MockCh10CANBusComponent> mock_canbus_;
+    NiceMock<MockCh10EthernetF1Component> mock_ethernetf1_;
+    NiceMock<MockCh10AnalogF1Component> mock_analogf1_;
+    NiceMock<MockCh101553F2Component> mock_milstd1553f2_;
+    NiceMock<MockCh10UARTF0Component> mock_uartf0_;
+    NiceMock<MockCh10MessageF0Component> mock_messagef0_;
     Ch10Packet p_;
 
     Ch10PacketTest() : status_(Ch10Status::NONE), mock_bb_(), mock_ctx_(), mock_ch10_time_(),
         p_(&mock_bb_, &mock_ctx_, &mock_ch10_time_),
         mock_tmats_(&mock_ctx_), mock_tdp_(&mock_ctx_), mock_milstd1553_(&mock_ctx_), mock_vid_(&mock_ctx_),
-        mock_eth_(&mock_ctx_), mock_arinc429_(&mock_ctx_), mock_hdr_(&mock_ctx_)
+        mock_eth_(&mock_ctx_), mock_arinc429_(&mock_ctx_), mock_pcmf1_(&mock_ctx_), mock_canbus_(&mock_ctx_), mock_ethernetf1_(&mock_ctx_), mock_analogf1_(&mock_ctx_), mock_milstd1553f2_(&mock_ctx_), mock_uartf0_(&mock_ctx_), mock_messagef0_(&mock_ctx_), mock_hdr_(&mock_ctx_)
     {
     }
 
     virtual void SetUp()
     {
         p_.SetCh10ComponentParsers(&mock_hdr_, &mock_tmats_, &mock_tdp_, &mock_milstd1553_,
-            &mock_vid_, &mock_eth_, &mock_arinc429_);
+            &mock_vid_, &mock_eth_, &mock_arinc429_, &mock_pcmf1_, &mock_canbus_,
+            &mock_ethernetf1_,
+            &mock_analogf1_,
+            &mock_milstd1553f2_,
+            &mock_uartf0_,
+            &mock_messagef0_);
     }
 };
 
@@ -99,6 +118,20 @@ TEST_F(Ch10PacketTest, ManageHeaderParseStatusBadSyncNotBufferLimited)
     EXPECT_EQ(status_, Ch10Status::BAD_SYNC);
 }
 
+TEST_F(Ch10PacketTest, ManageHeaderParseStatusBadSyncRecordedOncePerSearch)
+{
+    uint64_t pkt_size = 1839;
+    EXPECT_CALL(mock_bb_, AdvanceReadPos(1))
+        .WillRepeatedly(Return(0));
+
+    for (int i = 0; i < 5; i++)
+    {
+        status_ = p_.ManageHeaderParseStatus(Ch10Status::BAD_SYNC, pkt_size);
+        EXPECT_EQ(status_, Ch10Status::BAD_SYNC);
+    }
+    EXPECT_EQ(1, mock_ctx_.diagnostics.GetCount("bad_sync"));
+}
+
 TEST_F(Ch10PacketTest, ManageHeaderParseStatusBadSyncBufferLimited)
 {
     uint64_t pkt_size = 1839;
@@ -536,6 +569,146 @@ TEST_F(Ch10PacketTest, ParseBody429F0)
     EXPECT_EQ(Ch10PacketType::ARINC429_F0, p_.current_pkt_type);
 }
 
+TEST_F(Ch10PacketTest, ParseBodyPCMF1)
+{
+    Ch10PacketHeaderFmt hdr_fmt;
+    hdr_fmt.data_type = static_cast<uint32_t>(Ch10PacketType::PCM_F1);
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::PCM_F1))
+        .WillOnce(Return(false));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::NONE, p_.current_pkt_type);
+
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::PCM_F1))
+        .WillOnce(Return(true));
+    EXPECT_CALL(mock_pcmf1_, Parse(_)).WillOnce(Return(Ch10Status::OK));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::PCM_F1, p_.current_pkt_type);
+}
+
+TEST_F(Ch10PacketTest, ParseBodyCANBus)
+{
+    Ch10PacketHeaderFmt hdr_fmt;
+    hdr_fmt.data_type = static_cast<uint32_t>(Ch10PacketType::CAN_BUS);
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::CAN_BUS))
+        .WillOnce(Return(false));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::NONE, p_.current_pkt_type);
+
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::CAN_BUS))
+        .WillOnce(Return(true));
+    EXPECT_CALL(mock_canbus_, Parse(_)).WillOnce(Return(Ch10Status::OK));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::CAN_BUS, p_.current_pkt_type);
+}
+
+TEST_F(Ch10PacketTest, ParseBodyEthernetF1)
+{
+    Ch10PacketHeaderFmt hdr_fmt;
+    hdr_fmt.data_type = static_cast<uint32_t>(Ch10PacketType::ETHERNET_DATA_F1);
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::ETHERNET_DATA_F1))
+        .WillOnce(Return(false));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::NONE, p_.current_pkt_type);
+
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::ETHERNET_DATA_F1))
+        .WillOnce(Return(true));
+    EXPECT_CALL(mock_ethernetf1_, Parse(_)).WillOnce(Return(Ch10Status::OK));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::ETHERNET_DATA_F1, p_.current_pkt_type);
+}
+
+TEST_F(Ch10PacketTest, ParseBodyAnalogF1)
+{
+    Ch10PacketHeaderFmt hdr_fmt;
+    hdr_fmt.data_type = static_cast<uint32_t>(Ch10PacketType::ANALOG_F1);
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::ANALOG_F1))
+        .WillOnce(Return(false));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::NONE, p_.current_pkt_type);
+
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::ANALOG_F1))
+        .WillOnce(Return(true));
+    EXPECT_CALL(mock_analogf1_, Parse(_)).WillOnce(Return(Ch10Status::OK));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::ANALOG_F1, p_.current_pkt_type);
+}
+
+TEST_F(Ch10PacketTest, ParseBody1553F2)
+{
+    Ch10PacketHeaderFmt hdr_fmt;
+    hdr_fmt.data_type = static_cast<uint32_t>(Ch10PacketType::MILSTD1553_F2);
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::MILSTD1553_F2))
+        .WillOnce(Return(false));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::NONE, p_.current_pkt_type);
+
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::MILSTD1553_F2))
+        .WillOnce(Return(true));
+    EXPECT_CALL(mock_milstd1553f2_, Parse(_)).WillOnce(Return(Ch10Status::OK));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::MILSTD1553_F2, p_.current_pkt_type);
+}
+
+TEST_F(Ch10PacketTest, ParseBodyUARTF0)
+{
+    Ch10PacketHeaderFmt hdr_fmt;
+    hdr_fmt.data_type = static_cast<uint32_t>(Ch10PacketType::UART_F0);
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::UART_F0))
+        .WillOnce(Return(false));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::NONE, p_.current_pkt_type);
+
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::UART_F0))
+        .WillOnce(Return(true));
+    EXPECT_CALL(mock_uartf0_, Parse(_)).WillOnce(Return(Ch10Status::OK));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::UART_F0, p_.current_pkt_type);
+}
+
+TEST_F(Ch10PacketTest, ParseBodyMessageF0)
+{
+    Ch10PacketHeaderFmt hdr_fmt;
+    hdr_fmt.data_type = static_cast<uint32_t>(Ch10PacketType::MESSAGE_F0);
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::MESSAGE_F0))
+        .WillOnce(Return(false));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::NONE, p_.current_pkt_type);
+
+    EXPECT_CALL(mock_hdr_, GetHeader()).WillOnce(Return(&hdr_fmt));
+    EXPECT_CALL(mock_ctx_, IsPacketTypeEnabled(Ch10PacketType::MESSAGE_F0))
+        .WillOnce(Return(true));
+    EXPECT_CALL(mock_messagef0_, Parse(_)).WillOnce(Return(Ch10Status::OK));
+
+    p_.ParseBody();
+    EXPECT_EQ(Ch10PacketType::MESSAGE_F0, p_.current_pkt_type);
+}
+
 TEST_F(Ch10PacketTest, ParseBodyDefault)
 {
     Ch10PacketHeaderFmt hdr_fmt;
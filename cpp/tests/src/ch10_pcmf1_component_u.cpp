@@ -0,0 +1,185 @@
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_pcmf1_component.h"
+#include "ch10_component_test_fixture.h"
+
+class Ch10PCMF1ComponentTest : public Ch10ComponentTest<Ch10PCMF1Component>
+{
+   protected:
+    PCMF1FrameFormat frame_format_;
+    PCMF1CSDWFmt csdw_;
+
+    Ch10PCMF1ComponentTest() : Ch10ComponentTest(Ch10PacketType::PCM_F1, 7,
+        "pcmf1_component_test.parquet"), frame_format_(), csdw_{}
+    {
+        // Four 12-bit words following a 24-bit sync pattern, 72 bits
+        frame_format_.words_per_minor_frame = 4;
+        frame_format_.word_bits = 12;
+        frame_format_.sync_bits = 24;
+        frame_format_.sync_pattern = 0xFAF320;
+    }
+
+    // The file writer depends on the frame format, which is set in the
+    // context by tests which parse minor frames.
+    void SetUp() override
+    {
+    }
+
+    // Write the bit_count least significant bits of value, MSB first,
+    // beginning at bit_pos.
+    void WriteBits(std::vector<uint8_t>& data, uint64_t bit_pos, uint64_t value,
+        uint32_t bit_count)
+    {
+        for (uint32_t i = 0; i < bit_count; i++)
+        {
+            uint64_t pos = bit_pos + i;
+            uint8_t mask = static_cast<uint8_t>(0x80 >> (pos % 8));
+            if ((value >> (bit_count - 1 - i)) & 1)
+                data[pos / 8] |= mask;
+            else
+                data[pos / 8] &= static_cast<uint8_t>(~mask);
+        }
+    }
+
+    std::vector<uint8_t> MakePacket(const std::vector<uint8_t>& body)
+    {
+        return MakePacketBody(csdw_, body);
+    }
+};
+
+TEST_F(Ch10PCMF1ComponentTest, FrameSize)
+{
+    // 72 bits
+    EXPECT_EQ(10, Ch10PCMF1Component::PackedFrameSize(frame_format_, false));
+    EXPECT_EQ(12, Ch10PCMF1Component::PackedFrameSize(frame_format_, true));
+
+    // Two 16-bit words for the sync pattern and one for each data word
+    EXPECT_EQ(12, Ch10PCMF1Component::UnpackedFrameSize(frame_format_, false));
+    EXPECT_EQ(12, Ch10PCMF1Component::UnpackedFrameSize(frame_format_, true));
+
+    frame_format_.words_per_minor_frame = 5;
+    EXPECT_EQ(14, Ch10PCMF1Component::UnpackedFrameSize(frame_format_, false));
+    EXPECT_EQ(16, Ch10PCMF1Component::UnpackedFrameSize(frame_format_, true));
+}
+
+TEST_F(Ch10PCMF1ComponentTest, CopyToBitStream)
+{
+    std::vector<uint8_t> data{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    std::vector<uint8_t> out(data.size());
+
+    Ch10PCMF1Component::CopyToBitStream(data.data(), data.size(), false, out.data());
+    std::vector<uint8_t> expected16{0x02, 0x01, 0x04, 0x03, 0x06, 0x05, 0x08, 0x07};
+    EXPECT_THAT(out, ::testing::ElementsAreArray(expected16));
+
+    Ch10PCMF1Component::CopyToBitStream(data.data(), data.size(), true, out.data());
+    std::vector<uint8_t> expected32{0x04, 0x03, 0x02, 0x01, 0x08, 0x07, 0x06, 0x05};
+    EXPECT_THAT(out, ::testing::ElementsAreArray(expected32));
+}
+
+TEST_F(Ch10PCMF1ComponentTest, ConfigureFrameFormat)
+{
+    PCMF1FrameFormat unconfigured;
+    EXPECT_EQ(Ch10Status::PCMF1_FRAME_FORMAT, comp_.ConfigureFrameFormat(unconfigured));
+
+    PCMF1FrameFormat bad_pattern = frame_format_;
+    bad_pattern.sync_pattern = 0x1FAF320;
+    EXPECT_EQ(Ch10Status::PCMF1_FRAME_FORMAT, comp_.ConfigureFrameFormat(bad_pattern));
+
+    EXPECT_EQ(Ch10Status::OK, comp_.ConfigureFrameFormat(frame_format_));
+    EXPECT_EQ(4, comp_.words.size());
+}
+
+TEST_F(Ch10PCMF1ComponentTest, ParseFrameFormatNotConfigured)
+{
+    csdw_.PM = 1;
+    std::vector<uint8_t> packet = MakePacket(std::vector<uint8_t>(12, 0));
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::PCMF1_FRAME_FORMAT, comp_.Parse(data));
+}
+
+TEST_F(Ch10PCMF1ComponentTest, ParseModeNotSet)
+{
+    ctx_.SetPCMF1FrameFormat(frame_format_);
+    std::vector<uint8_t> packet = MakePacket(std::vector<uint8_t>(12, 0));
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::PCMF1_MODE, comp_.Parse(data));
+}
+
+TEST_F(Ch10PCMF1ComponentTest, DecommutateStream)
+{
+    ASSERT_EQ(Ch10Status::OK, comp_.ConfigureFrameFormat(frame_format_));
+    std::vector<uint8_t> stream(12, 0);
+    WriteBits(stream, 3, 0xFAF320, 24);
+    WriteBits(stream, 27, 0x123, 12);
+    WriteBits(stream, 39, 0x456, 12);
+    WriteBits(stream, 51, 0x789, 12);
+    WriteBits(stream, 63, 0xABC, 12);
+
+    comp_.DecommutateStream(stream.data(), 27);
+    EXPECT_THAT(comp_.words, ::testing::ElementsAre(0x123, 0x456, 0x789, 0xABC));
+}
+
+TEST_F(Ch10PCMF1ComponentTest, DecommutateUnpacked)
+{
+    ASSERT_EQ(Ch10Status::OK, comp_.ConfigureFrameFormat(frame_format_));
+
+    // The sync pattern is right-justified in two words, most significant
+    // word first. Bits above the word size are ignored.
+    std::vector<uint16_t> frame{0x00FA, 0xF320, 0x0123, 0xF456, 0x0789, 0x0ABC};
+    std::vector<uint8_t> data(frame.size() * sizeof(uint16_t));
+    memcpy(data.data(), frame.data(), data.size());
+
+    EXPECT_TRUE(comp_.DecommutateUnpacked(data.data()));
+    EXPECT_THAT(comp_.words, ::testing::ElementsAre(0x123, 0x456, 0x789, 0xABC));
+
+    frame[1] = 0xF321;
+    memcpy(data.data(), frame.data(), data.size());
+    EXPECT_FALSE(comp_.DecommutateUnpacked(data.data()));
+}
+
+TEST_F(Ch10PCMF1ComponentTest, ParseThroughputAcrossPackets)
+{
+    ctx_.SetPCMF1FrameFormat(frame_format_);
+    ASSERT_NO_FATAL_FAILURE(InitializeFileWriter());
+
+    // Three minor frames which begin at bit 5 of a 224-bit stream
+    std::vector<uint8_t> stream(28, 0);
+    uint64_t pos = 5;
+    for (uint32_t frame = 0; frame < 3; frame++)
+    {
+        WriteBits(stream, pos, 0xFAF320, 24);
+        pos += 24;
+        for (uint32_t word = 0; word < 4; word++)
+        {
+            WriteBits(stream, pos, frame * 0x100 + word, 12);
+            pos += 12;
+        }
+    }
+
+    // Recorded in 16-bit words, split between two packets such that the
+    // second minor frame spans both.
+    std::vector<uint8_t> recorded(stream.size());
+    Ch10PCMF1Component::CopyToBitStream(stream.data(), stream.size(), false, recorded.data());
+    csdw_.THR = 1;
+
+    std::vector<uint8_t> packet = MakePacket(std::vector<uint8_t>(recorded.begin(),
+        recorded.begin() + 14));
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+
+    packet = MakePacket(std::vector<uint8_t>(recorded.begin() + 14, recorded.end()));
+    data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+
+    const ParquetPCMF1* writer = ctx_.pcmf1_pq_writer;
+    for (uint32_t frame = 0; frame < 3; frame++)
+    {
+        for (uint32_t word = 0; word < 4; word++)
+            EXPECT_EQ(frame * 0x100 + word, writer->words_[frame * 4 + word]);
+        EXPECT_EQ(1, writer->THR_[frame]);
+        EXPECT_EQ(7, writer->channel_id_[frame]);
+    }
+    EXPECT_EQ(0, ctx_.diagnostics.GetCount("pcmf1_sync_loss"));
+}
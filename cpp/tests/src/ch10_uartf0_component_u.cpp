@@ -0,0 +1,108 @@
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_uartf0_component.h"
+#include "ch10_component_test_fixture.h"
+
+class Ch10UARTF0ComponentTest : public Ch10ComponentTest<Ch10UARTF0Component>
+{
+   protected:
+    Ch10UARTF0ComponentTest() : Ch10ComponentTest(Ch10PacketType::UART_F0, 3,
+        "uartf0_component_test.parquet")
+    {
+    }
+
+    // Append a message, with optional time stamp, intra-packet data header
+    // and data padded to an even length.
+    void AppendMessage(std::vector<uint8_t>& body, bool iph, uint64_t rtc,
+        uint32_t subchannel, const std::vector<uint8_t>& data)
+    {
+        UARTF0DataHeaderFmt hdr{};
+        hdr.data_length = static_cast<uint32_t>(data.size());
+        hdr.subchannel = subchannel;
+
+        if (iph)
+            AppendObject(body, rtc);
+        AppendObject(body, hdr);
+        AppendData(body, data, true);
+    }
+
+    std::vector<uint8_t> MakePacket(bool iph, const std::vector<uint8_t>& body)
+    {
+        UARTF0CSDWFmt csdw{};
+        csdw.IPH = iph;
+        return MakePacketBody(csdw, body);
+    }
+
+    std::string GetValue(size_t row)
+    {
+        const BinaryColumnBuffer& buffer = ctx_.uartf0_pq_writer->data_;
+        return std::string(buffer.values.begin() + buffer.offsets[row],
+                           buffer.values.begin() + buffer.offsets[row + 1]);
+    }
+};
+
+TEST_F(Ch10UARTF0ComponentTest, ParseAppendsPacket)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, true, 100, 1, {'a', 'b', 'c'});
+    AppendMessage(body, true, 200, 2, {});
+    AppendMessage(body, true, 300, 3, {'d', 'e'});
+    std::vector<uint8_t> packet = MakePacket(true, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    ASSERT_EQ(3, comp_.parsed_count);
+
+    const ParquetUARTF0* writer = ctx_.uartf0_pq_writer;
+    EXPECT_EQ(3, writer->channel_id_[0]);
+    EXPECT_EQ(1, writer->subchannel_[0]);
+    EXPECT_EQ(2, writer->subchannel_[1]);
+    EXPECT_EQ(3, writer->subchannel_[2]);
+    EXPECT_EQ("abc", GetValue(0));
+    EXPECT_EQ("", GetValue(1));
+    EXPECT_EQ("de", GetValue(2));
+}
+
+TEST_F(Ch10UARTF0ComponentTest, ParseWithoutIPTS)
+{
+    // Without time stamps all messages have the time of the packet.
+    std::vector<uint8_t> body;
+    AppendMessage(body, false, 0, 1, {'x'});
+    AppendMessage(body, false, 0, 1, {'y', 'z'});
+    std::vector<uint8_t> packet = MakePacket(false, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    ASSERT_EQ(2, comp_.parsed_count);
+
+    const ParquetUARTF0* writer = ctx_.uartf0_pq_writer;
+    EXPECT_EQ(writer->time_stamp_[0], writer->time_stamp_[1]);
+    EXPECT_EQ("x", GetValue(0));
+    EXPECT_EQ("yz", GetValue(1));
+}
+
+TEST_F(Ch10UARTF0ComponentTest, ParseLastMessageWithoutPadding)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, true, 100, 1, {'a'});
+    body.pop_back();
+    std::vector<uint8_t> packet = MakePacket(true, body);
+    const uint8_t* data = packet.data();
+    ASSERT_EQ(Ch10Status::OK, comp_.Parse(data));
+    ASSERT_EQ(1, comp_.parsed_count);
+    EXPECT_EQ("a", GetValue(0));
+}
+
+TEST_F(Ch10UARTF0ComponentTest, ParseInvalidMsgLength)
+{
+    std::vector<uint8_t> body;
+    AppendMessage(body, true, 100, 1, {'a', 'b'});
+    AppendMessage(body, true, 200, 2, {'c', 'd', 'e', 'f'});
+    body.resize(body.size() - 2);
+    std::vector<uint8_t> packet = MakePacket(true, body);
+    const uint8_t* data = packet.data();
+    EXPECT_EQ(Ch10Status::UARTF0_MSG_LENGTH, comp_.Parse(data));
+    EXPECT_EQ(1, comp_.parsed_count);
+    EXPECT_EQ("ab", GetValue(0));
+    EXPECT_EQ(1, ctx_.diagnostics.GetCount("uartf0_msg_length"));
+}
@@ -0,0 +1,138 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "checksum_kernels.h"
+
+class ChecksumKernelsTest : public ::testing::Test
+{
+   protected:
+    std::vector<uint8_t> data_;
+    std::vector<ChecksumKernels::ISA> isas_;
+
+    ChecksumKernelsTest() : data_(4096 + 64), isas_{ChecksumKernels::ISA::SCALAR,
+        ChecksumKernels::ISA::SSE2, ChecksumKernels::ISA::AVX2}
+    {
+        std::mt19937 generator(10);
+        std::uniform_int_distribution<int> dist(0, 255);
+        for (size_t i = 0; i < data_.size(); i++)
+            data_[i] = static_cast<uint8_t>(dist(generator));
+    }
+};
+
+TEST_F(ChecksumKernelsTest, ScalarKnownValues)
+{
+    ChecksumKernels kernels = ChecksumKernels::Select(ChecksumKernels::ISA::SCALAR);
+    EXPECT_EQ(ChecksumKernels::ISA::SCALAR, kernels.isa);
+
+    std::vector<uint8_t> data{0xFF, 0x01, 0x02, 0x00, 0x10, 0x20, 0x30, 0x40};
+    EXPECT_EQ(0x00, kernels.sum8(data.data(), 0));
+    EXPECT_EQ(static_cast<uint8_t>(0xFF + 0x01 + 0x02 + 0x10 + 0x20 + 0x30 + 0x40),
+        kernels.sum8(data.data(), 8));
+
+    // Little-endian words 0x01FF, 0x0002, 0x2010, 0x4030
+    EXPECT_EQ(static_cast<uint16_t>(0x01FF + 0x0002 + 0x2010 + 0x4030),
+        kernels.sum16(data.data(), 4));
+
+    // Little-endian double words 0x000201FF, 0x40302010
+    EXPECT_EQ(static_cast<uint32_t>(0x000201FF + 0x40302010), kernels.sum32(data.data(), 2));
+}
+
+TEST_F(ChecksumKernelsTest, SelectFallsBackToSupported)
+{
+    EXPECT_TRUE(ChecksumKernels::IsSupported(ChecksumKernels::ISA::SCALAR));
+    for (std::vector<ChecksumKernels::ISA>::const_iterator it = isas_.cbegin();
+         it != isas_.cend(); ++it)
+    {
+        ChecksumKernels kernels = ChecksumKernels::Select(*it);
+        EXPECT_LE(static_cast<int>(kernels.isa), static_cast<int>(*it));
+        EXPECT_TRUE(ChecksumKernels::IsSupported(kernels.isa));
+        if (ChecksumKernels::IsSupported(*it))
+        {
+            EXPECT_EQ(*it, kernels.isa);
+        }
+    }
+    EXPECT_TRUE(ChecksumKernels::IsSupported(ChecksumKernels::Dispatched().isa));
+}
+
+TEST_F(ChecksumKernelsTest, KernelsMatchScalar)
+{
+    ChecksumKernels scalar = ChecksumKernels::Select(ChecksumKernels::ISA::SCALAR);
+
+    // Lengths which exercise the vector loops and scalar tails, at
+    // offsets which are not aligned to the vector width.
+    std::vector<size_t> counts{0, 1, 7, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 1000, 2047};
+    for (std::vector<ChecksumKernels::ISA>::const_iterator it = isas_.cbegin();
+         it != isas_.cend(); ++it)
+    {
+        ChecksumKernels kernels = ChecksumKernels::Select(*it);
+        for (size_t offset = 0; offset < 4; offset++)
+        {
+            const uint8_t* data = data_.data() + offset;
+            for (std::vector<size_t>::const_iterator count = counts.cbegin();
+                 count != counts.cend(); ++count)
+            {
+                EXPECT_EQ(scalar.sum8(data, *count), kernels.sum8(data, *count))
+                    << ChecksumKernels::ISAString(kernels.isa) << " count " << *count;
+                EXPECT_EQ(scalar.sum16(data, *count), kernels.sum16(data, *count))
+                    << ChecksumKernels::ISAString(kernels.isa) << " count " << *count;
+                EXPECT_EQ(scalar.sum32(data, *count / 2), kernels.sum32(data, *count / 2))
+                    << ChecksumKernels::ISAString(kernels.isa) << " count " << *count / 2;
+            }
+        }
+    }
+}
+
+TEST_F(ChecksumKernelsTest, ISAString)
+{
+    EXPECT_EQ("scalar", ChecksumKernels::ISAString(ChecksumKernels::ISA::SCALAR));
+    EXPECT_EQ("sse2", ChecksumKernels::ISAString(ChecksumKernels::ISA::SSE2));
+    EXPECT_EQ("avx2", ChecksumKernels::ISAString(ChecksumKernels::ISA::AVX2));
+}
+
+// Throughput of each supported kernel in bytes/sec. Timing is not
+// asserted. Run with --gtest_also_run_disabled_tests
+// --gtest_filter=*Throughput.
+TEST_F(ChecksumKernelsTest, DISABLED_Throughput)
+{
+    // Typical packet body size, which fits in cache, and a large body
+    const std::vector<size_t> byte_counts{64 * 1024, 64 * 1024 * 1024};
+    const size_t total_bytes = size_t(2) * 1024 * 1024 * 1024;
+    std::vector<uint8_t> data(byte_counts.back(), 0x5A);
+
+    for (std::vector<ChecksumKernels::ISA>::const_iterator it = isas_.cbegin();
+         it != isas_.cend(); ++it)
+    {
+        if (!ChecksumKernels::IsSupported(*it))
+            continue;
+        ChecksumKernels kernels = ChecksumKernels::Select(*it);
+        for (std::vector<size_t>::const_iterator bytes = byte_counts.cbegin();
+             bytes != byte_counts.cend(); ++bytes)
+        {
+            size_t reps = total_bytes / *bytes;
+            double sec[3];
+            uint64_t sink = 0;
+            for (int width = 0; width < 3; width++)
+            {
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                for (size_t rep = 0; rep < reps; rep++)
+                {
+                    if (width == 0)
+                        sink += kernels.sum8(data.data(), *bytes);
+                    else if (width == 1)
+                        sink += kernels.sum16(data.data(), *bytes / 2);
+                    else
+                        sink += kernels.sum32(data.data(), *bytes / 4);
+                }
+                sec[width] = std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start).count();
+            }
+            printf("%-6s %9zu bytes: sum8 %7.2f GB/s, sum16 %7.2f GB/s, sum32 %7.2f GB/s (%llu)\n",
+                ChecksumKernels::ISAString(*it).c_str(), *bytes,
+                reps * *bytes / sec[0] / 1.0e9, reps * *bytes / sec[1] / 1.0e9,
+                reps * *bytes / sec[2] / 1.0e9, static_cast<unsigned long long>(sink & 0xFF));
+        }
+    }
+}
@@ -417,6 +417,43 @@ TEST_F(CLIGroupTest, ParseTwoCLIsFailNoIndicators)
     EXPECT_EQ(nullptr, active_cli);
 }
 
+TEST_F(CLIGroupTest, ParseRepeatedVectorOptionBeforeOtherOption)
+{
+    cli_prog_name_ = "mytestprog";
+    cli_desc_ = "not much of a description";
+    cli_nickname_ = "1stcli";
+    std::shared_ptr<CLIGroupMember> clig = cli_group_.AddCLI(cli_prog_name_, cli_desc_, cli_nickname_);
+    std::string str_output = "";
+    clig->AddOption("file_path", "file_path help", str_output, true);
+    int thread_count = 0;
+    clig->AddOption<int>("--thread_count", "-t", "help string", 1, thread_count);
+    std::vector<std::string> mask_output;
+    std::vector<std::string> mask_default{};
+    clig->AddOption<std::vector<std::string>>("--mask", "-M", "mask help string", 
+        mask_default, mask_output);
+
+    ASSERT_TRUE(cli_group_.CheckConfiguration());
+    const int arg_count = 8;
+    int argc = arg_count;
+    char a0[] = "mytestprog";
+    char a1[] = "/path/to/file";
+    char a2[] = "-M";
+    char a3[] = "0:24";
+    char a4[] = "-M";
+    char a5[] = "5000:1";
+    char a6[] = "-t";
+    char a7[] = "4";
+    char* argv[arg_count] = {a0, a1, a2, a3, a4, a5, a6, a7};
+    cli_nickname_ = "";
+    std::shared_ptr<CLIGroupMember> active_cli;
+    ASSERT_EQ(EX_OK, cli_group_.Parse(argc, argv, cli_nickname_, active_cli));
+    EXPECT_EQ("1stcli", cli_nickname_);
+    EXPECT_EQ(4, thread_count);
+    ASSERT_EQ(2, mask_output.size());
+    EXPECT_EQ("0:24", mask_output.at(0));
+    EXPECT_EQ("5000:1", mask_output.at(1));
+}
+
 TEST_F(CLIGroupTest, MakeHelpStringNotConfigured)
 {
     cli_prog_name_ = "mytestprog";
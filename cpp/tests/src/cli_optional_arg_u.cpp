@@ -600,6 +600,25 @@ TEST_F(CLIOptionalArgTest, VectorParseRepeatedIsAdditive)
     ASSERT_EQ(64, output.at(2));
 }
 
+TEST_F(CLIOptionalArgTest, VectorParseRepeatedFollowedByOtherOption)
+{
+    temp_label_ = "--value";  
+    temp_short_label_ = "-v";
+    std::vector<int> output;
+    std::vector<int> def_value{-10};
+    std::shared_ptr<CLIArg> cli = CLIOptionalArg<std::vector<int>>::Make(temp_label_, 
+        temp_short_label_, temp_help_str_, def_value, output);
+
+    std::string user_input = "some_pos_arg -v 33 --value 90 -v 64 --other_opt 4";
+    ASSERT_TRUE(cli->ValidateConfig());
+    ASSERT_TRUE(cli->Parse(user_input));
+    ASSERT_TRUE(cli->IsValid());
+    ASSERT_EQ(3, output.size());
+    ASSERT_EQ(33, output.at(0));
+    ASSERT_EQ(90, output.at(1));
+    ASSERT_EQ(64, output.at(2));
+}
+
 TEST_F(CLIOptionalArgTest, VectorParseRepeatedIsAdditiveWithWhiteSpace)
 {
     temp_label_ = "--value";  
@@ -705,6 +724,24 @@ TEST_F(CLIOptionalArgTest, MapParseRepeatedIsAdditive)
     EXPECT_EQ(203, output.at("C"));
 }
 
+TEST_F(CLIOptionalArgTest, MapParseRepeatedFollowedByOtherOption)
+{
+    temp_label_ = "--value";  
+    temp_short_label_ = "-v";
+    std::map<std::string, int> output;
+    std::map<std::string, int> def_value{{"A", 10}};
+    std::shared_ptr<CLIArg> cli = CLIOptionalArg<std::map<std::string, int>>::Make(temp_label_, 
+        temp_short_label_, temp_help_str_, def_value, output);
+
+    std::string user_input = "some_pos_arg -v Ten:5 --value two:2 --other_opt 4";
+    ASSERT_TRUE(cli->ValidateConfig());
+    ASSERT_TRUE(cli->Parse(user_input));
+    ASSERT_TRUE(cli->IsValid());
+    ASSERT_EQ(2, output.size());
+    ASSERT_EQ(5, output.at("Ten"));
+    ASSERT_EQ(2, output.at("two"));
+}
+
 TEST_F(CLIOptionalArgTest, MapParseRepeatedIsAdditiveWhiteSpace)
 {
     temp_label_ = "--value";  
@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "diagnostics.h"
+
+TEST(DiagnosticsTest, RecordRetainsFirstExemplars)
+{
+    Diagnostics diag(2);
+    EXPECT_TRUE(diag.IsEmpty());
+    EXPECT_EQ(0, diag.GetCount("bad_sync"));
+
+    EXPECT_TRUE(diag.Record("bad_sync", 100));
+    EXPECT_TRUE(diag.Record("bad_sync", 101));
+    EXPECT_FALSE(diag.Record("bad_sync", 102));
+    EXPECT_FALSE(diag.Record("bad_sync", 103));
+    EXPECT_TRUE(diag.Record("frame_count", 7));
+
+    EXPECT_FALSE(diag.IsEmpty());
+    EXPECT_EQ(4, diag.GetCount("bad_sync"));
+    EXPECT_EQ(1, diag.GetCount("frame_count"));
+    EXPECT_EQ(5, diag.GetTotalCount());
+
+    std::map<std::string, std::vector<uint64_t>> offsets = diag.GetExemplarOffsets();
+    EXPECT_THAT(offsets.at("bad_sync"), ::testing::ElementsAre(100, 101));
+    EXPECT_THAT(offsets.at("frame_count"), ::testing::ElementsAre(7));
+
+    std::map<std::string, uint64_t> counts = diag.GetCounts();
+    std::map<std::string, uint64_t> expected{{"bad_sync", 4}, {"frame_count", 1}};
+    EXPECT_EQ(expected, counts);
+}
+
+TEST(DiagnosticsTest, ZeroExemplarLimitOnlyCounts)
+{
+    Diagnostics diag(0);
+    EXPECT_FALSE(diag.Record("bad_sync", 100));
+    EXPECT_EQ(1, diag.GetCount("bad_sync"));
+    EXPECT_EQ(0, diag.GetExemplarOffsets().at("bad_sync").size());
+}
+
+TEST(DiagnosticsTest, MergeRetainsLowestOffsets)
+{
+    Diagnostics a(3);
+    a.Record("bad_sync", 500);
+    a.Record("bad_sync", 501);
+
+    Diagnostics b(3);
+    b.Record("bad_sync", 10);
+    b.Record("bad_sync", 11);
+    b.Record("bad_sync", 12);
+    b.Record("bad_sync", 13);
+    b.Record("frame_count", 20);
+
+    a.Merge(b);
+    EXPECT_EQ(6, a.GetCount("bad_sync"));
+    EXPECT_EQ(1, a.GetCount("frame_count"));
+    EXPECT_THAT(a.GetExemplarOffsets().at("bad_sync"), ::testing::ElementsAre(10, 11, 12));
+    EXPECT_THAT(a.GetExemplarOffsets().at("frame_count"), ::testing::ElementsAre(20));
+}
+
+TEST(DiagnosticsTest, FormatSummary)
+{
+    Diagnostics diag(2);
+    EXPECT_EQ(0, diag.FormatSummary("row").size());
+
+    diag.Record("bad_sync", 100);
+    diag.Record("bad_sync", 200);
+    diag.Record("bad_sync", 300);
+
+    std::vector<std::string> summary = diag.FormatSummary("absolute position");
+    ASSERT_EQ(1, summary.size());
+    EXPECT_EQ("bad_sync: 3 (1 not logged), first at absolute position: 100 200", summary.at(0));
+
+    Diagnostics count_only(0);
+    count_only.Record("frame_count", 5);
+    summary = count_only.FormatSummary("row");
+    ASSERT_EQ(1, summary.size());
+    EXPECT_EQ("frame_count: 1 (1 not logged)", summary.at(0));
+}
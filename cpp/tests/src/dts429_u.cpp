@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "dts429.h"
+#include "binary_cache.h"
+#include "managed_path.h"
 
 
 class DTS429Test : public ::testing::Test
@@ -543,3 +545,59 @@ TEST_F(DTS429Test, BuildNameToICDElementMapValidateOutputMapFeatures)
 
     EXPECT_TRUE(word_elements.count("TestWord"));
 }
+
+TEST_F(DTS429Test, WriteCacheReadCacheRoundTrip)
+{
+    ASSERT_TRUE(dts.IngestLines(yaml_lines_0, word_elements));
+    ASSERT_EQ(1, word_elements.count("TestWord"));
+    ASSERT_EQ(2, word_elements["TestWord"].size());
+
+    ManagedPath cache_path(std::string("dts429_u_test.tipcache"));
+    BinaryCacheWriter writer;
+    dts.WriteCache(writer, word_elements);
+    ASSERT_EQ(EX_OK, writer.Save(cache_path, "key", "version"));
+
+    BinaryCacheReader reader;
+    ASSERT_EQ(EX_OK, reader.Open(cache_path, "key", "version"));
+    std::unordered_map<std::string, std::vector<ICDElement>> cached_word_elements;
+    DTS429 cached_dts;
+    EXPECT_TRUE(cached_dts.ReadCache(reader, cached_word_elements));
+    reader.Close();
+    cache_path.remove();
+
+    ASSERT_EQ(1, cached_word_elements.count("TestWord"));
+    const std::vector<ICDElement>& expected = word_elements["TestWord"];
+    const std::vector<ICDElement>& cached = cached_word_elements["TestWord"];
+    ASSERT_EQ(expected.size(), cached.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ(expected[i].elem_name_, cached[i].elem_name_);
+        EXPECT_EQ(expected[i].label_, cached[i].label_);
+        EXPECT_EQ(expected[i].sdi_, cached[i].sdi_);
+        EXPECT_EQ(expected[i].bus_name_, cached[i].bus_name_);
+        EXPECT_EQ(expected[i].schema_, cached[i].schema_);
+        EXPECT_EQ(expected[i].msb_val_, cached[i].msb_val_);
+        EXPECT_EQ(expected[i].description_, cached[i].description_);
+    }
+}
+
+TEST_F(DTS429Test, ReadCacheTrailingData)
+{
+    ASSERT_TRUE(dts.IngestLines(yaml_lines_0, word_elements));
+
+    ManagedPath cache_path(std::string("dts429_u_test.tipcache"));
+    BinaryCacheWriter writer;
+    dts.WriteCache(writer, word_elements);
+
+    // Extra trailing data is not consumed by ReadCache
+    writer.Write(static_cast<uint8_t>(1));
+    ASSERT_EQ(EX_OK, writer.Save(cache_path, "key", "version"));
+
+    BinaryCacheReader reader;
+    ASSERT_EQ(EX_OK, reader.Open(cache_path, "key", "version"));
+    std::unordered_map<std::string, std::vector<ICDElement>> cached_word_elements;
+    EXPECT_FALSE(dts.ReadCache(reader, cached_word_elements));
+    EXPECT_EQ(0, cached_word_elements.size());
+    reader.Close();
+    cache_path.remove();
+}
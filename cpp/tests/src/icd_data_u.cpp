@@ -2,6 +2,8 @@
 #include "gmock/gmock.h"
 #include "icd_element.h"
 #include "icd_data.h"
+#include "binary_cache.h"
+#include "managed_path.h"
 
 // Needed for ICDDataRealICDQueryTest
 #include "file_reader.h"
@@ -489,6 +491,138 @@ TEST_F(ICDDataPrepareICDQueryTest, ReplaceBusNameWithChannelIDInLookupOneChanIDK
     ASSERT_THAT(icd_.GetLookupTableChannelIDKeys(), ::testing::UnorderedElementsAre(13, 17));
 }
 
+TEST_F(ICDDataPrepareICDQueryTest, FindTableIndices)
+{
+    res_ = icd_.PrepareICDQuery(icd_lines_);
+    ASSERT_EQ(res_, true);
+
+    update_map_["BD1"] = std::set<uint64_t>({13});
+    update_map_["BD3"] = std::set<uint64_t>({14, 21});
+    ASSERT_EQ(icd_.ReplaceBusNameWithChannelIDInLookup(update_map_), true);
+
+    const ICDData& const_icd = icd_;
+    EXPECT_THAT(const_icd.FindTableIndices(14, 23, 19, 0, 4),
+                ::testing::ElementsAreArray(icd_.LookupTableIndex(14, 23, 19, 0, 4)));
+    EXPECT_THAT(const_icd.FindTableIndices(13, 22, 27, 0, 2),
+                ::testing::ElementsAreArray(icd_.LookupTableIndex(13, 22, 27, 0, 2)));
+    EXPECT_FALSE(const_icd.FindTableIndices(14, 23, 19, 0, 4).empty());
+
+    // No match at each level of the lookup
+    EXPECT_TRUE(const_icd.FindTableIndices(15, 23, 19, 0, 4).empty());
+    EXPECT_TRUE(const_icd.FindTableIndices(14, 5, 19, 0, 4).empty());
+    EXPECT_TRUE(const_icd.FindTableIndices(14, 23, 5, 0, 4).empty());
+    EXPECT_TRUE(const_icd.FindTableIndices(14, 23, 19, 5, 4).empty());
+    EXPECT_TRUE(const_icd.FindTableIndices(14, 23, 19, 0, 5).empty());
+
+    // The lookup is not modified
+    std::set<uint16_t> chanids;
+    std::set<uint8_t> xmit_lru_addrs;
+    icd_.GetLookupKeys(std::set<size_t>({0, 1, 2, 3, 4}), chanids, xmit_lru_addrs);
+    EXPECT_THAT(chanids, ::testing::ElementsAre(13, 14, 21));
+}
+
+TEST_F(ICDDataPrepareICDQueryTest, GetLookupKeys)
+{
+    res_ = icd_.PrepareICDQuery(icd_lines_);
+    ASSERT_EQ(res_, true);
+
+    update_map_["BD1"] = std::set<uint64_t>({13});
+    update_map_["BD3"] = std::set<uint64_t>({14, 21});
+    ASSERT_EQ(icd_.ReplaceBusNameWithChannelIDInLookup(update_map_), true);
+
+    std::set<uint16_t> chanids;
+    std::set<uint8_t> xmit_lru_addrs;
+    icd_.GetLookupKeys(std::set<size_t>({0, 1, 2, 3, 4}), chanids, xmit_lru_addrs);
+    EXPECT_THAT(chanids, ::testing::ElementsAre(13, 14, 21));
+    EXPECT_THAT(xmit_lru_addrs, ::testing::ElementsAre(22, 23));
+
+    icd_.GetLookupKeys(std::set<size_t>({1}), chanids, xmit_lru_addrs);
+    EXPECT_THAT(chanids, ::testing::ElementsAre(13));
+    EXPECT_THAT(xmit_lru_addrs, ::testing::ElementsAre(22));
+
+    icd_.GetLookupKeys(std::set<size_t>({2}), chanids, xmit_lru_addrs);
+    EXPECT_THAT(chanids, ::testing::ElementsAre(14, 21));
+    EXPECT_THAT(xmit_lru_addrs, ::testing::ElementsAre(23));
+
+    // Entries inserted by a lookup which does not match do not
+    // contribute keys.
+    EXPECT_EQ(0, icd_.LookupTableIndex(15, 5, 6, 7, 8).size());
+    icd_.GetLookupKeys(std::set<size_t>({0, 1, 2, 3, 4}), chanids, xmit_lru_addrs);
+    EXPECT_THAT(chanids, ::testing::ElementsAre(13, 14, 21));
+    EXPECT_THAT(xmit_lru_addrs, ::testing::ElementsAre(22, 23));
+
+    icd_.GetLookupKeys(std::set<size_t>(), chanids, xmit_lru_addrs);
+    EXPECT_TRUE(chanids.empty());
+    EXPECT_TRUE(xmit_lru_addrs.empty());
+}
+
+TEST_F(ICDDataPrepareICDQueryTest, WriteCacheReadCacheRoundTrip)
+{
+    res_ = icd_.PrepareICDQuery(icd_lines_);
+    ASSERT_EQ(res_, true);
+
+    ManagedPath cache_path(std::string("icd_data_u_test.tipcache"));
+    BinaryCacheWriter writer;
+    icd_.WriteCache(writer);
+    ASSERT_EQ(EX_OK, writer.Save(cache_path, "key", "version"));
+
+    ICDData cached_icd;
+    BinaryCacheReader reader;
+    ASSERT_EQ(EX_OK, reader.Open(cache_path, "key", "version"));
+    EXPECT_TRUE(cached_icd.ReadCache(reader));
+    reader.Close();
+    cache_path.remove();
+
+    EXPECT_EQ(icd_.valid_message_count, cached_icd.valid_message_count);
+    EXPECT_THAT(cached_icd.GetTableNames(), ::testing::ElementsAreArray(icd_.GetTableNames()));
+    EXPECT_THAT(cached_icd.GetTableOrganizationIndices(),
+                ::testing::ElementsAreArray(icd_.GetTableOrganizationIndices()));
+    std::vector<ICDElement> elems = icd_.GetICDElementVector();
+    std::vector<ICDElement> cached_elems = cached_icd.GetICDElementVector();
+    ASSERT_EQ(elems.size(), cached_elems.size());
+    for (size_t i = 0; i < elems.size(); i++)
+    {
+        EXPECT_EQ(elems[i].msg_name_, cached_elems[i].msg_name_);
+        EXPECT_EQ(elems[i].elem_name_, cached_elems[i].elem_name_);
+        EXPECT_EQ(elems[i].xmit_word_, cached_elems[i].xmit_word_);
+        EXPECT_EQ(elems[i].schema_, cached_elems[i].schema_);
+        EXPECT_EQ(elems[i].msb_val_, cached_elems[i].msb_val_);
+    }
+
+    // The restored lookup is equivalent after bus name replacement
+    update_map_["BD1"] = std::set<uint64_t>({13});
+    update_map_["BD3"] = std::set<uint64_t>({14, 21});
+    ASSERT_EQ(icd_.ReplaceBusNameWithChannelIDInLookup(update_map_), true);
+    ASSERT_EQ(cached_icd.ReplaceBusNameWithChannelIDInLookup(update_map_), true);
+    EXPECT_THAT(cached_icd.LookupTableIndex(14, 23, 19, 0, 4),
+                ::testing::ElementsAreArray(icd_.LookupTableIndex(14, 23, 19, 0, 4)));
+    EXPECT_THAT(cached_icd.LookupTableIndex(13, 22, 27, 0, 2),
+                ::testing::ElementsAreArray(icd_.LookupTableIndex(13, 22, 27, 0, 2)));
+}
+
+TEST_F(ICDDataPrepareICDQueryTest, ReadCacheTruncatedResetsState)
+{
+    res_ = icd_.PrepareICDQuery(icd_lines_);
+    ASSERT_EQ(res_, true);
+
+    ManagedPath cache_path(std::string("icd_data_u_test.tipcache"));
+    BinaryCacheWriter writer;
+    icd_.WriteCache(writer);
+    writer.Write(static_cast<uint8_t>(0));
+    ASSERT_EQ(EX_OK, writer.Save(cache_path, "key", "version"));
+
+    ICDData cached_icd;
+    BinaryCacheReader reader;
+    ASSERT_EQ(EX_OK, reader.Open(cache_path, "key", "version"));
+    EXPECT_FALSE(cached_icd.ReadCache(reader));
+    reader.Close();
+    cache_path.remove();
+
+    EXPECT_EQ(0, cached_icd.valid_message_count);
+    EXPECT_EQ(0, cached_icd.GetTableNames().size());
+    EXPECT_EQ(0, cached_icd.GetICDElementVector().size());
+}
+
 TEST_F(ICDDataPrepareICDQueryTest, LookupTableIndex)
 {
     // The final adjusted map can be queried directly using
@@ -121,4 +121,25 @@ TEST(ICDElementTest, FillInvalidBitValues)
         "MIVU,23,ORT,19,00,03,12.50,19,02,03,1,0,12,50,00,0,"
         "description 5,17374824.000000000000,NONE";
     EXPECT_FALSE(ice.Fill(test_str));
-}
\ No newline at end of file
+}
+
+TEST(ICDElementTest, CopySharesInternedStrings)
+{
+    ICDElement ice;
+    std::string test_str =
+        "BL22U,BL22U-20,00000,39030,22,BD3,"
+        "MIVU,23,ORT,19,00,03,12.50,19,02,03,0,0,02,00,00,0,"
+        "description 5,17374824.000000000000,NONE";
+    ASSERT_TRUE(ice.Fill(test_str));
+
+    ICDElement copy(ice);
+    EXPECT_EQ("BL22U", copy.msg_name_);
+    EXPECT_EQ("description 5", copy.description_);
+    EXPECT_EQ(&ice.msg_name_.str(), &copy.msg_name_.str());
+    EXPECT_EQ(&ice.description_.str(), &copy.description_.str());
+
+    // Elements filled separately share equal strings
+    ICDElement other;
+    ASSERT_TRUE(other.Fill(test_str));
+    EXPECT_EQ(&ice.elem_name_.str(), &other.elem_name_.str());
+}
@@ -0,0 +1,121 @@
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "interned_string.h"
+
+TEST(StringPoolTest, InternReturnsSameString)
+{
+    StringPool pool;
+    const std::string* a = pool.Intern("abc");
+    const std::string* b = pool.Intern(std::string("abc"));
+    const std::string* c = pool.Intern("abd");
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ("abc", *a);
+    EXPECT_EQ("abd", *c);
+    EXPECT_EQ(2, pool.Size());
+}
+
+TEST(StringPoolTest, InternEmpty)
+{
+    StringPool pool;
+    EXPECT_EQ(&InternedString::Empty(), pool.Intern(""));
+    EXPECT_EQ(0, pool.Size());
+}
+
+TEST(StringPoolTest, PooledStringsAreStable)
+{
+    StringPool pool;
+    const std::string* first = pool.Intern("first");
+    for (int i = 0; i < 10000; i++)
+        pool.Intern("value" + std::to_string(i));
+    EXPECT_EQ(first, pool.Intern("first"));
+    EXPECT_EQ("first", *first);
+}
+
+TEST(StringPoolTest, InternFromThreads)
+{
+    StringPool pool;
+    std::vector<const std::string*> results(4, nullptr);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        threads.push_back(std::thread([&pool, &results, i]() {
+            for (int j = 0; j < 1000; j++)
+                pool.Intern("name" + std::to_string(j));
+            results[i] = pool.Intern("name0");
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); i++)
+        threads[i].join();
+
+    EXPECT_EQ(1000, pool.Size());
+    for (size_t i = 1; i < results.size(); i++)
+        EXPECT_EQ(results[0], results[i]);
+}
+
+TEST(InternedStringTest, DefaultIsEmpty)
+{
+    InternedString s;
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(0, s.size());
+    EXPECT_EQ("", s);
+    EXPECT_EQ(InternedString(""), s);
+}
+
+TEST(InternedStringTest, AssignAndCompare)
+{
+    InternedString a = "MSG01";
+    InternedString b;
+    b = std::string("MSG01");
+    InternedString c("MSG02");
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(&a.str(), &b.str());
+    EXPECT_TRUE(a == "MSG01");
+    EXPECT_TRUE("MSG01" == a);
+    EXPECT_TRUE(a == std::string("MSG01"));
+    EXPECT_TRUE(std::string("MSG01") == a);
+    EXPECT_TRUE(a != "MSG02");
+    EXPECT_TRUE(a != std::string("MSG02"));
+    EXPECT_TRUE(a < c);
+    EXPECT_FALSE(c < a);
+    EXPECT_EQ(5, a.size());
+    EXPECT_STREQ("MSG01", a.c_str());
+}
+
+TEST(InternedStringTest, ConvertAndConcatenate)
+{
+    InternedString a("MSG01");
+    const std::string& ref = a;
+    EXPECT_EQ("MSG01", ref);
+    EXPECT_EQ("MSG01-01", a + "-01");
+    EXPECT_EQ("MSG01-01", a + std::string("-01"));
+    EXPECT_EQ("_MSG01", "_" + a);
+    EXPECT_EQ("_MSG01", std::string("_") + a);
+
+    std::ostringstream os;
+    os << a;
+    EXPECT_EQ("MSG01", os.str());
+}
+
+TEST(InternedStringTest, Containers)
+{
+    std::unordered_set<InternedString> hashed;
+    hashed.insert("a");
+    hashed.insert(std::string("a"));
+    hashed.insert("b");
+    EXPECT_EQ(2, hashed.size());
+    EXPECT_EQ(1, hashed.count("a"));
+
+    std::set<InternedString> ordered;
+    ordered.insert("b");
+    ordered.insert("a");
+    EXPECT_EQ("a", *ordered.begin());
+}
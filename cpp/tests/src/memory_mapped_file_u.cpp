@@ -0,0 +1,77 @@
+#include <fstream>
+#include <string>
+#include <cstring>
+#include <filesystem>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "managed_path.h"
+#include "memory_mapped_file.h"
+
+class MemoryMappedFileTest : public ::testing::Test
+{
+   protected:
+    ManagedPath path_;
+
+    MemoryMappedFileTest() : path_(std::string("memory_mapped_file_test.bin"))
+    {}
+
+    ~MemoryMappedFileTest()
+    {
+        std::filesystem::remove(path_.string());
+    }
+
+    void WriteFile(const std::string& data)
+    {
+        std::ofstream ofs(path_.string(), std::ios::binary | std::ios::trunc);
+        ofs.write(data.data(), data.size());
+        ofs.close();
+    }
+};
+
+TEST_F(MemoryMappedFileTest, OpenFileNotExist)
+{
+    MemoryMappedFile mmf;
+    EXPECT_EQ(EX_NOINPUT, mmf.Open(ManagedPath(std::string("not_a_file.bin"))));
+    EXPECT_FALSE(mmf.is_open());
+    EXPECT_TRUE(mmf.data() == nullptr);
+    EXPECT_EQ(0, mmf.size());
+}
+
+TEST_F(MemoryMappedFileTest, OpenMapsFileContents)
+{
+    std::string data("abc\x00\x01\x02xyz", 9);
+    WriteFile(data);
+
+    MemoryMappedFile mmf;
+    ASSERT_EQ(EX_OK, mmf.Open(path_));
+    EXPECT_TRUE(mmf.is_open());
+    ASSERT_EQ(data.size(), mmf.size());
+    EXPECT_EQ(0, memcmp(data.data(), mmf.data(), data.size()));
+}
+
+TEST_F(MemoryMappedFileTest, OpenEmptyFile)
+{
+    WriteFile("");
+
+    MemoryMappedFile mmf;
+    ASSERT_EQ(EX_OK, mmf.Open(path_));
+    EXPECT_TRUE(mmf.is_open());
+    EXPECT_EQ(0, mmf.size());
+    EXPECT_TRUE(mmf.data() == nullptr);
+}
+
+TEST_F(MemoryMappedFileTest, CloseResetsState)
+{
+    WriteFile("data");
+
+    MemoryMappedFile mmf;
+    ASSERT_EQ(EX_OK, mmf.Open(path_));
+    mmf.Close();
+    EXPECT_FALSE(mmf.is_open());
+    EXPECT_EQ(0, mmf.size());
+    EXPECT_TRUE(mmf.data() == nullptr);
+
+    // Reopen after close
+    ASSERT_EQ(EX_OK, mmf.Open(path_, false));
+    EXPECT_EQ(4, mmf.size());
+}
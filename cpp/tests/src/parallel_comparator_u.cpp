@@ -0,0 +1,266 @@
+#include <vector>
+#include <string>
+#include <filesystem>
+#include <cmath>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "parquet_context.h"
+#include "parallel_comparator.h"
+
+class ParallelComparatorTest : public ::testing::Test
+{
+   protected:
+    std::vector<std::string> pq_directories;
+    int pq_file_count;
+    ParallelComparatorTest() : pq_file_count(0)
+    {
+    }
+    ~ParallelComparatorTest()
+    {
+        for (size_t i = 0; i < pq_directories.size(); i++)
+        {
+            std::filesystem::remove_all(pq_directories[i]);
+        }
+    }
+
+    // Generate Parquet file with one column per vector
+    // in output
+    template <typename T>
+    bool CreateParquetFile(std::shared_ptr<arrow::DataType> type,
+                           std::string directory,
+                           std::vector<std::vector<T>> output,
+                           int row_group_count)
+    {
+        if (!std::filesystem::exists(directory))
+        {
+            if (!std::filesystem::create_directories(directory))
+                return false;
+        }
+
+        std::filesystem::path pqt_path(directory);
+        pqt_path = pqt_path / std::filesystem::path(
+                                  std::to_string(pq_file_count) + std::string(".parquet"));
+        std::string path = pqt_path.string();
+
+        ParquetContext pc(row_group_count);
+        for (size_t i = 0; i < output.size(); i++)
+        {
+            pc.AddField(type, "data" + std::to_string(i));
+            pc.SetMemoryLocation<T>(output[i], "data" + std::to_string(i));
+        }
+
+        int row_size = static_cast<int>(output[0].size());
+        if (!pc.OpenForWrite(path, true))
+            return false;
+
+        for (int i = 0; i < row_size / row_group_count; i++)
+            pc.WriteColumns(row_group_count, i * row_group_count);
+
+        int remainder = row_size % row_group_count;
+        if (remainder > 0)
+            pc.WriteColumns(remainder, (row_size / row_group_count) * row_group_count);
+
+        pc.Close();
+        pq_directories.push_back(directory);
+        pq_file_count++;
+        return true;
+    }
+};
+
+TEST_F(ParallelComparatorTest, InitializeNoFilesExist)
+{
+    ParallelComparator comp;
+    EXPECT_EQ(EX_NOINPUT, comp.Initialize(ManagedPath(std::string("file1.parquet")),
+                                          ManagedPath(std::string("file2.parquet"))));
+    EXPECT_FALSE(comp.CompareAll());
+}
+
+TEST_F(ParallelComparatorTest, CompareAllMatchingMultipleColumns)
+{
+    std::vector<std::vector<int32_t>> data = {{1, 2, 3, 4, 5, 6, 7},
+                                              {8, 9, 10, 11, 12, 13, 14},
+                                              {0, 0, 0, 0, 0, 0, 1}};
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "file1.parquet", data, 3));
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "file2.parquet", data, 3));
+
+    ParallelComparator comp(3);
+    ASSERT_EQ(EX_OK, comp.Initialize(ManagedPath(std::string("file1.parquet")),
+                                     ManagedPath(std::string("file2.parquet"))));
+    EXPECT_TRUE(comp.CompareAll());
+    for (int col = 1; col < 4; col++)
+    {
+        EXPECT_TRUE(comp.CheckPassed(col));
+        EXPECT_EQ(7, comp.GetComparedCount(col));
+        EXPECT_EQ(-1, comp.GetFirstMismatchRow(col));
+    }
+}
+
+TEST_F(ParallelComparatorTest, CompareAllMisalignedRowGroups)
+{
+    std::vector<std::vector<int64_t>> data1 = {{1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                               {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}};
+    std::vector<std::vector<int64_t>> data2 = {{1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                               {1, 2, 3, 4, 5, 6, 7, 0, 9, 10}};
+    ASSERT_TRUE(CreateParquetFile(arrow::int64(), "file1.parquet", data1, 3));
+    ASSERT_TRUE(CreateParquetFile(arrow::int64(), "file2.parquet", data2, 4));
+
+    ParallelComparator comp(2);
+    ASSERT_EQ(EX_OK, comp.Initialize(ManagedPath(std::string("file1.parquet")),
+                                     ManagedPath(std::string("file2.parquet"))));
+    EXPECT_FALSE(comp.CompareAll());
+    EXPECT_TRUE(comp.CheckPassed(1));
+    EXPECT_EQ(10, comp.GetComparedCount(1));
+    EXPECT_FALSE(comp.CheckPassed(2));
+    EXPECT_EQ(7, comp.GetComparedCount(2));
+    EXPECT_EQ(7, comp.GetFirstMismatchRow(2));
+}
+
+TEST_F(ParallelComparatorTest, CompareAllManyWindowsThreaded)
+{
+    // Row groups of 3 and 4 rows produce more windows than are queued at
+    // once, each compared by all threads.
+    std::vector<std::vector<int32_t>> data1(3);
+    for (int32_t i = 0; i < 50; i++)
+    {
+        data1[0].push_back(i);
+        data1[1].push_back(2 * i);
+        data1[2].push_back(3 * i);
+    }
+    std::vector<std::vector<int32_t>> data2(data1);
+    data2[2][41] = -1;
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "file1.parquet", data1, 3));
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "file2.parquet", data2, 4));
+
+    ParallelComparator comp(2);
+    ASSERT_EQ(EX_OK, comp.Initialize(ManagedPath(std::string("file1.parquet")),
+                                     ManagedPath(std::string("file2.parquet"))));
+    EXPECT_FALSE(comp.CompareAll());
+    for (int col = 1; col < 3; col++)
+    {
+        EXPECT_TRUE(comp.CheckPassed(col));
+        EXPECT_EQ(50, comp.GetComparedCount(col));
+    }
+    EXPECT_FALSE(comp.CheckPassed(3));
+    EXPECT_EQ(41, comp.GetComparedCount(3));
+    EXPECT_EQ(41, comp.GetFirstMismatchRow(3));
+}
+
+TEST_F(ParallelComparatorTest, CompareAllNaNsAreEqual)
+{
+    std::vector<std::vector<double>> data = {{1.0, NAN, 3.0, NAN}};
+    ASSERT_TRUE(CreateParquetFile(arrow::float64(), "file1.parquet", data, 2));
+    ASSERT_TRUE(CreateParquetFile(arrow::float64(), "file2.parquet", data, 3));
+
+    ParallelComparator comp;
+    ASSERT_EQ(EX_OK, comp.Initialize(ManagedPath(std::string("file1.parquet")),
+                                     ManagedPath(std::string("file2.parquet"))));
+    EXPECT_TRUE(comp.CompareAll());
+    EXPECT_EQ(4, comp.GetComparedCount(1));
+}
+
+TEST_F(ParallelComparatorTest, CompareAllRowCountMismatch)
+{
+    std::vector<std::vector<int32_t>> data1 = {{1, 2, 3, 4, 5}};
+    std::vector<std::vector<int32_t>> data2 = {{1, 2, 3, 4, 5, 6}};
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "file1.parquet", data1, 5));
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "file2.parquet", data2, 5));
+
+    ParallelComparator comp;
+    ASSERT_EQ(EX_OK, comp.Initialize(ManagedPath(std::string("file1.parquet")),
+                                     ManagedPath(std::string("file2.parquet"))));
+    EXPECT_FALSE(comp.CompareAll());
+    EXPECT_FALSE(comp.CheckPassed(1));
+    EXPECT_EQ(5, comp.GetComparedCount(1));
+    EXPECT_EQ(5, comp.GetFirstMismatchRow(1));
+}
+
+TEST_F(ParallelComparatorTest, CompareAllSchemaMismatch)
+{
+    std::vector<std::vector<int32_t>> data1 = {{1, 2, 3}, {4, 5, 6}};
+    std::vector<std::vector<int64_t>> data2 = {{1, 2, 3}, {4, 5, 6}};
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "file1.parquet", data1, 3));
+    ASSERT_TRUE(CreateParquetFile(arrow::int64(), "file2.parquet", data2, 3));
+
+    ParallelComparator comp(2);
+    ASSERT_EQ(EX_OK, comp.Initialize(ManagedPath(std::string("file1.parquet")),
+                                     ManagedPath(std::string("file2.parquet"))));
+    EXPECT_FALSE(comp.CompareAll());
+    EXPECT_FALSE(comp.CheckPassed(1));
+    EXPECT_FALSE(comp.CheckPassed(2));
+    EXPECT_EQ(0, comp.GetComparedCount(1));
+}
+
+TEST_F(ParallelComparatorTest, CompareAllStopOnFail)
+{
+    std::vector<std::vector<int32_t>> data1 = {{1, 2, 3, 4}, {5, 6, 7, 8}};
+    std::vector<std::vector<int32_t>> data2 = {{0, 2, 3, 4}, {5, 6, 7, 8}};
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "file1.parquet", data1, 2));
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "file2.parquet", data2, 2));
+
+    ParallelComparator comp(1, true);
+    ASSERT_EQ(EX_OK, comp.Initialize(ManagedPath(std::string("file1.parquet")),
+                                     ManagedPath(std::string("file2.parquet"))));
+    EXPECT_FALSE(comp.CompareAll());
+    EXPECT_FALSE(comp.CheckPassed(1));
+    EXPECT_EQ(0, comp.GetFirstMismatchRow(1));
+
+    // Comparison halted before column 2 was compared
+    EXPECT_EQ(0, comp.GetComparedCount(2));
+}
+
+TEST_F(ParallelComparatorTest, FindFirstMismatch)
+{
+    arrow::Int32Builder builder1;
+    arrow::Int32Builder builder2;
+    std::vector<int32_t> vals1 = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<int32_t> vals2 = {9, 1, 2, 3, 4, 5, 0, 7, 8, 9};
+    ASSERT_TRUE(builder1.AppendValues(vals1).ok());
+    ASSERT_TRUE(builder2.AppendValues(vals2).ok());
+    std::shared_ptr<arrow::Array> arr1;
+    std::shared_ptr<arrow::Array> arr2;
+    ASSERT_TRUE(builder1.Finish(&arr1).ok());
+    ASSERT_TRUE(builder2.Finish(&arr2).ok());
+
+    EXPECT_EQ(0, ParallelComparator::FindFirstMismatch(arr1, 0, arr2, 0, 10));
+    EXPECT_EQ(5, ParallelComparator::FindFirstMismatch(arr1, 1, arr2, 1, 9));
+    EXPECT_EQ(3, ParallelComparator::FindFirstMismatch(arr1, 1, arr2, 1, 3));
+    EXPECT_EQ(3, ParallelComparator::FindFirstMismatch(arr1, 7, arr2, 7, 3));
+}
+
+TEST_F(ParallelComparatorTest, CompareParquetDatasets)
+{
+    std::vector<std::vector<int32_t>> data1 = {{1, 2, 3, 4}};
+    std::vector<std::vector<int32_t>> data2 = {{1, 2, 0, 4}};
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "truth_dir/a.parquet", data1, 2));
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "truth_dir/b.parquet", data1, 2));
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "test_dir/a.parquet", data1, 3));
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "test_dir/b.parquet", data1, 3));
+    pq_directories.push_back("truth_dir");
+    pq_directories.push_back("test_dir");
+
+    bool pass = false;
+    ManagedPath truth_dir(std::string("truth_dir"));
+    ManagedPath test_dir(std::string("test_dir"));
+    ASSERT_EQ(EX_OK, CompareParquetDatasets(truth_dir, test_dir, 2, false, pass));
+    EXPECT_TRUE(pass);
+
+    std::filesystem::remove_all("test_dir/b.parquet");
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "test_dir/b.parquet", data2, 3));
+    ASSERT_EQ(EX_OK, CompareParquetDatasets(truth_dir, test_dir, 2, false, pass));
+    EXPECT_FALSE(pass);
+}
+
+TEST_F(ParallelComparatorTest, CompareParquetDatasetsMissingDataset)
+{
+    std::vector<std::vector<int32_t>> data = {{1, 2, 3, 4}};
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "truth_dir/a.parquet", data, 2));
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "truth_dir/b.parquet", data, 2));
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), "test_dir/a.parquet", data, 2));
+    pq_directories.push_back("truth_dir");
+    pq_directories.push_back("test_dir");
+
+    bool pass = true;
+    ASSERT_EQ(EX_OK, CompareParquetDatasets(ManagedPath(std::string("truth_dir")),
+                                            ManagedPath(std::string("test_dir")), 1, false, pass));
+    EXPECT_FALSE(pass);
+}
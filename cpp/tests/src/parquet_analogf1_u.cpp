@@ -0,0 +1,106 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "parquet_analogf1.h"
+#include "parquet_context_mock.h"
+
+using ::testing::Return;
+using ::testing::Exactly;
+using ::testing::_;
+using ::testing::NiceMock;
+
+class ParquetAnalogF1Test : public ::testing::Test
+{
+   protected:
+    NiceMock<MockParquetContext> mock_pq_ctx_;
+    ParquetAnalogF1 pqanalog_;
+    ManagedPath outf_;
+    bool truncate_;
+    uint16_t thread_id_;
+    uint8_t doy_;
+    uint32_t channel_id_;
+
+    public:
+    ParquetAnalogF1Test() : mock_pq_ctx_(), pqanalog_(&mock_pq_ctx_), outf_("test.parquet"),
+        truncate_(true), thread_id_(4), doy_(1), channel_id_(12)
+    {}
+
+    void ValidateInitializeAddField()
+    {
+        ::testing::Sequence seq;
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int64(), "time", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "doy", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "channelid", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int16(), "subchannel", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "index", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "sample", 0)).InSequence(seq).WillOnce(Return(true));
+    }
+};
+
+TEST_F(ParquetAnalogF1Test, Initialize)
+{
+    ValidateInitializeAddField();
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(ParquetAnalogF1::GetRowGroupRowCount(),
+        ParquetAnalogF1::GetRowGroupBufferCount(), true, "AnalogF1")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, EnableEmptyFileDeletion(outf_.string())).Times(Exactly(1));
+
+    ASSERT_EQ(EX_OK, pqanalog_.Initialize(outf_, thread_id_));
+    EXPECT_EQ(thread_id_, pqanalog_.thread_id_);
+    EXPECT_EQ(outf_.string(), pqanalog_.outfile_);
+
+    size_t expected_size = ParquetAnalogF1::GetRowGroupRowCount() *
+        ParquetAnalogF1::GetRowGroupBufferCount();
+    EXPECT_EQ(expected_size, pqanalog_.time_stamp_.size());
+    EXPECT_EQ(expected_size, pqanalog_.sample_.size());
+}
+
+TEST_F(ParquetAnalogF1Test, InitializeOpenForWriteFail)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(false));
+    ASSERT_EQ(EX_IOERR, pqanalog_.Initialize(outf_, thread_id_));
+}
+
+TEST_F(ParquetAnalogF1Test, AppendNotInitialized)
+{
+    EXPECT_CALL(mock_pq_ctx_, IncrementAndWriteRows(_, _)).Times(Exactly(0));
+    std::vector<int32_t> samples{1, 2};
+    pqanalog_.Append(1000, doy_, channel_id_, 1, samples.data(), 2, 1, 1);
+}
+
+TEST_F(ParquetAnalogF1Test, Append)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(_, _, true, "AnalogF1")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, IncrementAndWriteRows(4, thread_id_)).WillOnce(Return(false));
+    ASSERT_EQ(EX_OK, pqanalog_.Initialize(outf_, thread_id_));
+
+    // Four frames of two subchannels, append the second subchannel.
+    std::vector<int32_t> samples{10, 20, 11, 21, 12, 22, 13, -23};
+    pqanalog_.Append(1000, doy_, channel_id_, 2, samples.data() + 1, 4, 2, 1);
+
+    EXPECT_EQ(1000, pqanalog_.time_stamp_.at(3));
+    EXPECT_EQ(doy_, pqanalog_.doy_.at(3));
+    EXPECT_EQ(channel_id_, pqanalog_.channel_id_.at(3));
+    EXPECT_EQ(2, pqanalog_.subchannel_.at(3));
+    EXPECT_THAT(std::vector<int32_t>(pqanalog_.index_.begin(), pqanalog_.index_.begin() + 4),
+        ::testing::ElementsAre(0, 1, 2, 3));
+    EXPECT_THAT(std::vector<int32_t>(pqanalog_.sample_.begin(), pqanalog_.sample_.begin() + 4),
+        ::testing::ElementsAre(20, 21, 22, -23));
+}
+
+TEST_F(ParquetAnalogF1Test, AppendDecimated)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(_, _, true, "AnalogF1")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, IncrementAndWriteRows(3, thread_id_)).WillOnce(Return(false));
+    ASSERT_EQ(EX_OK, pqanalog_.Initialize(outf_, thread_id_));
+
+    // Frames 0, 3 and 6 of seven
+    std::vector<int32_t> samples{0, 1, 2, 3, 4, 5, 6};
+    pqanalog_.Append(1000, doy_, channel_id_, 1, samples.data(), 7, 1, 3);
+    EXPECT_THAT(std::vector<int32_t>(pqanalog_.index_.begin(), pqanalog_.index_.begin() + 3),
+        ::testing::ElementsAre(0, 3, 6));
+    EXPECT_THAT(std::vector<int32_t>(pqanalog_.sample_.begin(), pqanalog_.sample_.begin() + 3),
+        ::testing::ElementsAre(0, 3, 6));
+}
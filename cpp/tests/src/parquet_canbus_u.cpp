@@ -0,0 +1,125 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_canbus_msg_hdr_format.h"
+#include "parquet_canbus.h"
+#include "parquet_context_mock.h"
+
+using ::testing::Return;
+using ::testing::Exactly;
+using ::testing::_;
+using ::testing::NiceMock;
+
+class ParquetCANBusTest : public ::testing::Test
+{
+   protected:
+    NiceMock<MockParquetContext> mock_pq_ctx_;
+    ParquetCANBus pqcan_;
+    ManagedPath outf_;
+    bool truncate_;
+    uint16_t thread_id_;
+    uint8_t doy_;
+    uint32_t channel_id_;
+
+    public:
+    ParquetCANBusTest() : mock_pq_ctx_(), pqcan_(&mock_pq_ctx_), outf_("test.parquet"),
+        truncate_(true), thread_id_(4), doy_(1), channel_id_(12)
+    {}
+
+    void ValidateInitializeAddField()
+    {
+        ::testing::Sequence seq;
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int64(), "time", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "doy", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "channelid", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int16(), "subchannel", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "DE", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "FE", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "IDE", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "RTR", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "id", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int8(), "DLC", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int64(), "data", 0)).InSequence(seq).WillOnce(Return(true));
+    }
+};
+
+TEST_F(ParquetCANBusTest, Initialize)
+{
+    ValidateInitializeAddField();
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(ParquetCANBus::GetRowGroupRowCount(),
+        ParquetCANBus::GetRowGroupBufferCount(), true, "CANBus")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, EnableEmptyFileDeletion(outf_.string())).Times(Exactly(1));
+
+    ASSERT_EQ(EX_OK, pqcan_.Initialize(outf_, thread_id_));
+    EXPECT_EQ(thread_id_, pqcan_.thread_id_);
+    EXPECT_EQ(outf_.string(), pqcan_.outfile_);
+
+    size_t expected_size = ParquetCANBus::GetRowGroupRowCount() *
+        ParquetCANBus::GetRowGroupBufferCount();
+    EXPECT_EQ(expected_size, pqcan_.time_stamp_.size());
+    EXPECT_EQ(expected_size, pqcan_.data_.size());
+}
+
+TEST_F(ParquetCANBusTest, InitializeOpenForWriteFail)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(false));
+    ASSERT_EQ(EX_IOERR, pqcan_.Initialize(outf_, thread_id_));
+}
+
+TEST_F(ParquetCANBusTest, AppendNotInitialized)
+{
+    EXPECT_CALL(mock_pq_ctx_, IncrementAndWriteRows(_, _)).Times(Exactly(0));
+    std::vector<uint64_t> time_stamp{1};
+    std::vector<CANBusMsgHdrFmt> hdr(1);
+    std::vector<CANBusIDWordFmt> id_word(1);
+    std::vector<uint64_t> payload{0};
+    pqcan_.Append(time_stamp.data(), hdr.data(), id_word.data(), payload.data(), 1, doy_,
+        channel_id_);
+}
+
+TEST_F(ParquetCANBusTest, Append)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(_, _, true, "CANBus")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, IncrementAndWriteRows(2, thread_id_)).WillOnce(Return(false));
+    ASSERT_EQ(EX_OK, pqcan_.Initialize(outf_, thread_id_));
+
+    std::vector<uint64_t> time_stamp{1000, 2000};
+    std::vector<CANBusMsgHdrFmt> hdr(2);
+    std::vector<CANBusIDWordFmt> id_word(2);
+    hdr[0] = CANBusMsgHdrFmt{};
+    hdr[0].length = 12;
+    hdr[0].subchan = 3;
+    hdr[0].DE = 1;
+    hdr[1] = CANBusMsgHdrFmt{};
+    hdr[1].length = 4;
+    hdr[1].FE = 1;
+    id_word[0] = CANBusIDWordFmt{};
+    id_word[0].ID = 0x1FFFFFFF;
+    id_word[0].IDE = 1;
+    id_word[1] = CANBusIDWordFmt{};
+    id_word[1].ID = 0x100;
+    id_word[1].RTR = 1;
+    std::vector<uint64_t> payload{0xFFFFFFFFFFFFFFFFULL, 0};
+    pqcan_.Append(time_stamp.data(), hdr.data(), id_word.data(), payload.data(), 2, doy_,
+        channel_id_);
+
+    EXPECT_EQ(1000, pqcan_.time_stamp_.at(0));
+    EXPECT_EQ(doy_, pqcan_.doy_.at(0));
+    EXPECT_EQ(channel_id_, pqcan_.channel_id_.at(0));
+    EXPECT_EQ(3, pqcan_.subchannel_.at(0));
+    EXPECT_EQ(1, pqcan_.DE_.at(0));
+    EXPECT_EQ(0, pqcan_.FE_.at(0));
+    EXPECT_EQ(1, pqcan_.IDE_.at(0));
+    EXPECT_EQ(0, pqcan_.RTR_.at(0));
+    EXPECT_EQ(0x1FFFFFFF, pqcan_.id_.at(0));
+    EXPECT_EQ(8, pqcan_.DLC_.at(0));
+    EXPECT_EQ(-1, pqcan_.data_.at(0));
+
+    EXPECT_EQ(2000, pqcan_.time_stamp_.at(1));
+    EXPECT_EQ(1, pqcan_.FE_.at(1));
+    EXPECT_EQ(1, pqcan_.RTR_.at(1));
+    EXPECT_EQ(0x100, pqcan_.id_.at(1));
+    EXPECT_EQ(0, pqcan_.DLC_.at(1));
+}
@@ -566,6 +566,27 @@ TEST_F(ParquetContextTest, SmallRowGroupSize)
     ASSERT_FALSE(ret_val);
 }
 
+TEST_F(ParquetContextTest, WrittenCounters)
+{
+    std::vector<int64_t> data = {16, 5, 4, 9, 8};
+    std::string file_name = "./file.parquet";
+
+    ParquetContext pc(3);
+    ASSERT_TRUE(pc.AddField(arrow::int64(), "data"));
+    ASSERT_TRUE(pc.SetMemoryLocation<int64_t>(data, "data"));
+    ASSERT_TRUE(pc.OpenForWrite(file_name, true));
+    EXPECT_EQ(0, pc.written_row_count);
+    EXPECT_EQ(0, pc.written_row_group_count);
+
+    ASSERT_TRUE(pc.WriteColumns(3, 0));
+    ASSERT_TRUE(pc.WriteColumns(2, 3));
+    pc.Close();
+    pq_file = file_name;
+
+    EXPECT_EQ(5, pc.written_row_count);
+    EXPECT_EQ(2, pc.written_row_group_count);
+}
+
 TEST_F(ParquetContextTest, NoCastingDownTest)
 {
     std::vector<int64_t> data = {16, 5, 4, 9, 8};
@@ -2285,6 +2306,347 @@ TEST_F(ParquetContextTest, SetMemoryLocationBeforeField)
     remove(file_name.c_str());
 }
 
+TEST_F(ParquetContextTest, BinaryColumnBufferSet)
+{
+    BinaryColumnBuffer buffer;
+    buffer.Allocate(3, 2);
+    ASSERT_EQ(3, buffer.GetRowCount());
+
+    uint8_t a[3] = {1, 2, 3};
+    uint8_t b[1] = {4};
+    ASSERT_TRUE(buffer.Set(0, a, sizeof(a)));
+    ASSERT_TRUE(buffer.Set(1, b, 0));
+    ASSERT_TRUE(buffer.Set(2, b, sizeof(b)));
+    ASSERT_FALSE(buffer.Set(3, b, sizeof(b)));
+
+    // The values buffer grows to hold the values.
+    ASSERT_THAT(buffer.offsets, ::testing::ElementsAre(0, 3, 3, 4));
+    ASSERT_GE(buffer.values.size(), 4);
+    EXPECT_THAT(std::vector<uint8_t>(buffer.values.begin(), buffer.values.begin() + 4),
+                ::testing::ElementsAre(1, 2, 3, 4));
+}
+
+TEST_F(ParquetContextTest, BinaryMultipleRG)
+{
+    std::vector<std::string> values = {"ab", "", "cde", std::string("\x00\xff", 2), "f"};
+    BinaryColumnBuffer buffer;
+    buffer.Allocate(values.size(), 0);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        ASSERT_TRUE(buffer.Set(i, reinterpret_cast<const uint8_t*>(values[i].data()),
+                               values[i].size()));
+    }
+
+    std::string file_name = "./file.parquet";
+    ParquetContext pc(2);
+    ASSERT_TRUE(pc.AddField(arrow::binary(), "data"));
+    ASSERT_TRUE(pc.SetMemoryLocation(buffer, "data"));
+    ASSERT_TRUE(pc.OpenForWrite(file_name, true));
+    ASSERT_TRUE(pc.WriteColumns(2, 0));
+    ASSERT_TRUE(pc.WriteColumns(2, 2));
+    ASSERT_TRUE(pc.WriteColumns(1, 4));
+    pc.Close();
+    pq_file = file_name;
+
+    ASSERT_TRUE(SetPQPath(file_name));
+    ASSERT_EQ(3, row_group_count_);
+    std::vector<std::string> input;
+    for (int rg = 0; rg < row_group_count_; rg++)
+    {
+        std::shared_ptr<arrow::Table> arrow_table;
+        st_ = arrow_reader_->ReadRowGroup(rg, std::vector<int>({0}), &arrow_table);
+        ASSERT_TRUE(st_.ok());
+#ifdef NEWARROW
+        arrow::BinaryArray data_array(arrow_table->column(0)->chunk(0)->data());
+#else
+        arrow::BinaryArray data_array(arrow_table->column(0)->data()->chunk(0)->data());
+#endif
+        for (int64_t i = 0; i < data_array.length(); i++)
+            input.push_back(data_array.GetString(i));
+    }
+    EXPECT_EQ(values, input);
+}
+
+TEST_F(ParquetContextTest, BinaryInvalidSetup)
+{
+    BinaryColumnBuffer buffer;
+    buffer.Allocate(4, 8);
+    std::vector<int64_t> data(4);
+
+    ParquetContext pc(4);
+
+    // Lists of binary values are not available.
+    ASSERT_FALSE(pc.AddField(arrow::binary(), "list", 2));
+
+    // The column must be added and must be binary.
+    ASSERT_FALSE(pc.SetMemoryLocation(buffer, "data"));
+    ASSERT_TRUE(pc.AddField(arrow::int64(), "data"));
+    ASSERT_FALSE(pc.SetMemoryLocation(buffer, "data"));
+    ASSERT_FALSE(pc.OpenForWrite("./file.parquet", true));
+}
+
+TEST_F(ParquetContextTest, VariableListMultipleRG)
+{
+    // Rows of 2, 0, 3, 1 and 4 words
+    std::vector<std::vector<uint16_t>> values = {{1, 2}, {}, {3, 4, 5}, {6}, {7, 8, 9, 10}};
+    ListColumnBuffer<int32_t> buffer;
+    buffer.Allocate(values.size(), 4);
+    for (size_t i = 0; i < values.size(); i++)
+        ASSERT_TRUE(buffer.Set(i, values[i].data(), values[i].size()));
+
+    std::string file_name = "./file.parquet";
+    ParquetContext pc(2);
+    ASSERT_TRUE(pc.AddField(arrow::int32(), "data", ParquetContext::VARIABLE_LIST_SIZE));
+    ASSERT_TRUE(pc.SetMemoryLocation(buffer, "data"));
+    ASSERT_TRUE(pc.OpenForWrite(file_name, true));
+    ASSERT_TRUE(pc.WriteColumns(2, 0));
+    ASSERT_TRUE(pc.WriteColumns(2, 2));
+    ASSERT_TRUE(pc.WriteColumns(1, 4));
+    pc.Close();
+    pq_file = file_name;
+
+    ASSERT_TRUE(SetPQPath(file_name));
+    ASSERT_EQ(3, row_group_count_);
+    std::vector<std::vector<uint16_t>> input;
+    for (int rg = 0; rg < row_group_count_; rg++)
+    {
+        std::shared_ptr<arrow::Table> arrow_table;
+        st_ = arrow_reader_->ReadRowGroup(rg, std::vector<int>({0}), &arrow_table);
+        ASSERT_TRUE(st_.ok());
+#ifdef NEWARROW
+        arrow::ListArray list_array(arrow_table->column(0)->chunk(0)->data());
+#else
+        arrow::ListArray list_array(arrow_table->column(0)->data()->chunk(0)->data());
+#endif
+        arrow::Int32Array value_array(list_array.values()->data());
+        for (int64_t i = 0; i < list_array.length(); i++)
+        {
+            std::vector<uint16_t> row;
+            for (int32_t j = list_array.value_offset(i); j < list_array.value_offset(i + 1); j++)
+                row.push_back(static_cast<uint16_t>(value_array.Value(j)));
+            input.push_back(row);
+        }
+    }
+    EXPECT_EQ(values, input);
+}
+
+TEST_F(ParquetContextTest, VariableListInvalidSetup)
+{
+    ListColumnBuffer<int32_t> buffer;
+    buffer.Allocate(4, 8);
+    std::vector<int32_t> data(8);
+
+    ParquetContext pc(4);
+
+    // Variable-length lists of bool and string values and negative list
+    // sizes other than VARIABLE_LIST_SIZE are not available.
+    ASSERT_FALSE(pc.AddField(arrow::boolean(), "bool", ParquetContext::VARIABLE_LIST_SIZE));
+    ASSERT_FALSE(pc.AddField(arrow::utf8(), "str", ParquetContext::VARIABLE_LIST_SIZE));
+    ASSERT_FALSE(pc.AddField(arrow::int32(), "neg", -2));
+
+    // A vector can't be set for a variable-length list column.
+    ASSERT_TRUE(pc.AddField(arrow::int32(), "data", ParquetContext::VARIABLE_LIST_SIZE));
+    ASSERT_FALSE(pc.SetMemoryLocation(data, "data"));
+    ASSERT_FALSE(pc.OpenForWrite("./file.parquet", true));
+}
+
+TEST_F(ParquetContextTest, VariableListTypeMismatch)
+{
+    ListColumnBuffer<int16_t> buffer;
+    buffer.Allocate(4, 8);
+
+    // Values are not cast to the column type.
+    ParquetContext pc(4);
+    ASSERT_TRUE(pc.AddField(arrow::int32(), "data", ParquetContext::VARIABLE_LIST_SIZE));
+    ASSERT_FALSE(pc.SetMemoryLocation(buffer, "data"));
+    ASSERT_FALSE(pc.OpenForWrite("./file.parquet", true));
+}
+
+TEST_F(ParquetContextTest, AddColumnHandleSwapBuffers)
+{
+    std::vector<int64_t> time1 = {10, 20, 30};
+    std::vector<int64_t> time2 = {40, 50, 60};
+    std::vector<int32_t> words = {1, 2, 3, 4, 5, 6};
+
+    std::string file_name = "./file.parquet";
+    ParquetContext pc(3);
+    ParquetColumnHandle<arrow::Int64Type> time = pc.AddColumn<arrow::Int64Type>(time1, "time");
+    ParquetColumnHandle<arrow::Int32Type> data = pc.AddColumn<arrow::Int32Type>(words, "data", 2);
+    ASSERT_TRUE(time.IsValid());
+    ASSERT_TRUE(data.IsValid());
+    EXPECT_EQ(0, time.GetIndex());
+    EXPECT_EQ(1, data.GetIndex());
+
+    ASSERT_TRUE(pc.OpenForWrite(file_name, true));
+    ASSERT_TRUE(pc.WriteColumns(3, 0));
+
+    // Point the time column at another buffer between row groups.
+    ASSERT_TRUE(pc.SetMemoryLocation(time, time2));
+    ASSERT_TRUE(pc.WriteColumns(2, 1));
+    pc.Close();
+    pq_file = file_name;
+
+    ASSERT_TRUE(SetPQPath(file_name));
+    ASSERT_EQ(2, row_group_count_);
+    std::vector<int64_t> time_input;
+    ASSERT_TRUE((GetNextRG<int64_t, arrow::NumericArray<arrow::Int64Type>>(0, time_input)));
+    EXPECT_THAT(time_input, ::testing::ElementsAre(10, 20, 30));
+    time_input.clear();
+    ASSERT_TRUE((GetNextRG<int64_t, arrow::NumericArray<arrow::Int64Type>>(0, time_input)));
+    EXPECT_THAT(time_input, ::testing::ElementsAre(50, 60));
+
+    current_row_group_ = 0;
+    std::vector<int32_t> data_input;
+    ASSERT_TRUE((GetNextRG<int32_t, arrow::NumericArray<arrow::Int32Type>>(1, data_input, true)));
+    EXPECT_THAT(data_input, ::testing::ElementsAre(1, 2, 3, 4, 5, 6));
+    data_input.clear();
+    ASSERT_TRUE((GetNextRG<int32_t, arrow::NumericArray<arrow::Int32Type>>(1, data_input, true)));
+    EXPECT_THAT(data_input, ::testing::ElementsAre(3, 4, 5, 6));
+}
+
+TEST_F(ParquetContextTest, AddColumnInvalidHandle)
+{
+    std::vector<int64_t> time(4);
+    std::vector<int64_t> other(4);
+    ParquetContext pc(4);
+
+    ParquetColumnHandle<arrow::Int64Type> handle;
+    EXPECT_FALSE(handle.IsValid());
+    EXPECT_FALSE(pc.SetMemoryLocation(handle, time));
+
+    handle = pc.AddColumn<arrow::Int64Type>(time, "time");
+    ASSERT_TRUE(handle.IsValid());
+
+    // A field name can't be added twice.
+    ParquetColumnHandle<arrow::Int64Type> dup = pc.AddColumn<arrow::Int64Type>(other, "time");
+    EXPECT_FALSE(dup.IsValid());
+    EXPECT_FALSE(pc.AddField(arrow::int32(), "time"));
+}
+
+TEST_F(ParquetContextTest, DirectWriteMatchesArrowWriter)
+{
+    std::vector<int64_t> time = {1, 2, 3, 4, 5};
+    std::vector<int16_t> word = {-1, 2, -3, 4, -5};
+    std::vector<uint16_t> raw = {10, 20, 30, 40, 50};
+    std::vector<uint8_t> flag = {1, 0, 1, 1, 0};
+    std::vector<std::string> name = {"a", "bb", "", "dddd", "e"};
+    std::vector<double> value = {0.5, 1.5, 2.5, 3.5, 4.5};
+    std::vector<uint8_t> valid = {1, 1, 0, 1, 0};
+    std::vector<int32_t> fixed = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    // Rows of 2, 0, 1, 3 and 0 values
+    std::vector<std::vector<int16_t>> rows = {{1, 2}, {}, {3}, {4, 5, 6}, {}};
+    ListColumnBuffer<int16_t> list;
+    list.Allocate(rows.size(), 6);
+    BinaryColumnBuffer bytes;
+    bytes.Allocate(rows.size(), 6);
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        ASSERT_TRUE(list.Set(i, rows[i].data(), rows[i].size()));
+        std::vector<uint8_t> row_bytes(rows[i].begin(), rows[i].end());
+        ASSERT_TRUE(bytes.Set(i, row_bytes.data(), row_bytes.size()));
+    }
+
+    std::vector<std::string> file_names = {"./file.parquet", "./file_direct.parquet"};
+    std::vector<std::shared_ptr<arrow::Table>> tables;
+    for (size_t i = 0; i < file_names.size(); i++)
+    {
+        ParquetContext pc(5);
+        if (i == 1)
+        {
+            ASSERT_TRUE(pc.EnableDirectWrite());
+        }
+        ASSERT_TRUE(pc.AddField(arrow::int64(), "time"));
+        ASSERT_TRUE(pc.AddField(arrow::int16(), "word"));
+        ASSERT_TRUE(pc.AddField(arrow::int32(), "raw"));
+        ASSERT_TRUE(pc.AddField(arrow::boolean(), "flag"));
+        ASSERT_TRUE(pc.AddField(arrow::utf8(), "name"));
+        ASSERT_TRUE(pc.AddField(arrow::float64(), "value"));
+        ASSERT_TRUE(pc.AddField(arrow::int32(), "fixed", 2));
+        ASSERT_TRUE(pc.AddField(arrow::int16(), "list", ParquetContext::VARIABLE_LIST_SIZE));
+        ASSERT_TRUE(pc.AddField(arrow::binary(), "bytes"));
+        ASSERT_TRUE(pc.SetMemoryLocation(time, "time"));
+        ASSERT_TRUE(pc.SetMemoryLocation(word, "word"));
+        ASSERT_TRUE(pc.SetMemoryLocation(raw, "raw"));
+        ASSERT_TRUE(pc.SetMemoryLocation(flag, "flag"));
+        ASSERT_TRUE(pc.SetMemoryLocation(name, "name", &valid));
+        ASSERT_TRUE(pc.SetMemoryLocation(value, "value", &valid));
+        ASSERT_TRUE(pc.SetMemoryLocation(fixed, "fixed"));
+        ASSERT_TRUE(pc.SetMemoryLocation(list, "list"));
+        ASSERT_TRUE(pc.SetMemoryLocation(bytes, "bytes"));
+        ASSERT_TRUE(pc.OpenForWrite(file_names[i], true));
+        ASSERT_TRUE(pc.WriteColumns(3, 0));
+        ASSERT_TRUE(pc.WriteColumns(2, 3));
+
+        // Builders are not used by the direct path.
+        if (i == 1)
+        {
+            EXPECT_EQ(0, pc.build_time_ns);
+        }
+        pc.Close();
+
+        ASSERT_TRUE(SetPQPath(file_names[i]));
+        EXPECT_EQ(2, row_group_count_);
+        std::shared_ptr<arrow::Table> table;
+        st_ = arrow_reader_->ReadTable(&table);
+        ASSERT_TRUE(st_.ok());
+        tables.push_back(table);
+        arrow_file_->Close();
+    }
+
+    EXPECT_TRUE(tables[0]->schema()->Equals(*tables[1]->schema()));
+    ASSERT_EQ(tables[0]->num_columns(), tables[1]->num_columns());
+    for (int i = 0; i < tables[0]->num_columns(); i++)
+        EXPECT_TRUE(tables[0]->column(i)->Equals(tables[1]->column(i)))
+            << tables[0]->schema()->field(i)->name();
+    EXPECT_EQ(2, tables[1]->GetColumnByName("value")->null_count());
+
+    remove(file_names[0].c_str());
+    remove(file_names[1].c_str());
+}
+
+TEST_F(ParquetContextTest, DirectWriteChecksRowRangeBeforeRowGroup)
+{
+    std::vector<int64_t> time = {1, 2, 3, 4};
+    std::vector<int16_t> word = {5, 6};
+    std::string file_name = "./file.parquet";
+    ParquetContext pc(4);
+    ASSERT_TRUE(pc.EnableDirectWrite());
+    ASSERT_TRUE(pc.AddField(arrow::int64(), "time"));
+    ASSERT_TRUE(pc.AddField(arrow::int16(), "word"));
+    ASSERT_TRUE(pc.SetMemoryLocation(time, "time"));
+    ASSERT_TRUE(pc.SetMemoryLocation(word, "word"));
+    ASSERT_TRUE(pc.OpenForWrite(file_name, true));
+
+    // The word column is too short. No row group is appended, such that
+    // a later row group is written intact.
+    EXPECT_FALSE(pc.WriteColumns(4, 0));
+    ASSERT_TRUE(pc.WriteColumns(2, 0));
+    pc.Close();
+
+    ASSERT_TRUE(SetPQPath(file_name));
+    EXPECT_EQ(1, row_group_count_);
+    std::shared_ptr<arrow::Table> table;
+    st_ = arrow_reader_->ReadTable(&table);
+    ASSERT_TRUE(st_.ok());
+    EXPECT_EQ(2, table->num_rows());
+    arrow_file_->Close();
+    remove(file_name.c_str());
+}
+
+TEST_F(ParquetContextTest, EnableDirectWriteAfterOpenForWrite)
+{
+    std::vector<int64_t> time(4);
+    std::string file_name = "./file.parquet";
+    ParquetContext pc(4);
+    ASSERT_TRUE(pc.AddField(arrow::int64(), "time"));
+    ASSERT_TRUE(pc.SetMemoryLocation(time, "time"));
+    ASSERT_TRUE(pc.OpenForWrite(file_name, true));
+    EXPECT_FALSE(pc.EnableDirectWrite());
+    pc.Close();
+    pq_file = file_name;
+}
+
 TEST_F(ParquetContextTest, WriteColumnsCalledBeforeOpenForWrite)
 {
     std::string file_name = "file.parquet";
@@ -2628,6 +2990,33 @@ TEST_F(ParquetContextRowCountTrackingTest, NonIntegerMultRowGroups)
     ASSERT_EQ(confirmed_tot_count, 110);
 }
 
+TEST_F(ParquetContextRowCountTrackingTest, IncrementAndWriteRows)
+{
+    ASSERT_TRUE(Initialize(10, 2));
+    ASSERT_TRUE(pc_.SetupRowCountTracking(10, 2, print_activity_, print_msg_));
+    EXPECT_EQ(20, pc_.GetAvailableRowCount());
+
+    ASSERT_FALSE(pc_.IncrementAndWriteRows(15));
+    EXPECT_EQ(5, pc_.GetAvailableRowCount());
+
+    // More rows than remain in the buffer are not counted.
+    ASSERT_FALSE(pc_.IncrementAndWriteRows(6));
+    EXPECT_EQ(5, pc_.GetAvailableRowCount());
+
+    // Filling the buffer writes both row groups.
+    ASSERT_TRUE(pc_.IncrementAndWriteRows(5));
+    EXPECT_EQ(20, pc_.GetAvailableRowCount());
+
+    ASSERT_FALSE(pc_.IncrementAndWriteRows(3));
+    Done();
+
+    size_t confirmed_rg_count = 0;
+    size_t confirmed_tot_count = 0;
+    ASSERT_TRUE(GetWrittenDataStats(confirmed_rg_count, confirmed_tot_count));
+    EXPECT_EQ(confirmed_rg_count, 3);
+    ASSERT_EQ(confirmed_tot_count, 23);
+}
+
 TEST_F(ParquetContextRowCountTrackingTest, IntegerMultRowGroupsRequestedExceeds)
 {
     // The use of test fixture ParquetContextRowCountTrackingTest
@@ -52,7 +52,7 @@ class ParquetEthernetF0Test : public ::testing::Test
         ::testing::Sequence seq;
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "time", 0)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "channelid", 0)).InSequence(seq).WillOnce(Return(true));
-        EXPECT_CALL(mock_pq_ctx_, AddField(_, "payload", static_cast<int>(pq_eth_.GetDataPayloadListElementCount()))).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(_, "payload", ParquetContext::VARIABLE_LIST_SIZE)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "payload_sz", 0)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "dstmac", 0)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "srcmac", 0)).InSequence(seq).WillOnce(Return(true));
@@ -75,7 +75,7 @@ class ParquetEthernetF0Test : public ::testing::Test
     {
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI64(_, "time", nullptr)).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI32(_, "channelid", nullptr)).WillOnce(Return(true));
-        EXPECT_CALL(mock_pq_ctx_, SetMemLocI16(_, "payload", nullptr)).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, SetListMemLoc(_, _, typeid(int16_t).name(), "payload")).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI64(_, "payload_sz", nullptr)).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocString(_, "dstmac", nullptr)).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocString(_, "srcmac", nullptr)).WillOnce(Return(true));
@@ -99,7 +99,7 @@ class ParquetEthernetF0Test : public ::testing::Test
         ::testing::Sequence seq;
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "time", 0)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "channelid", 0)).InSequence(seq).WillOnce(Return(false));
-        EXPECT_CALL(mock_pq_ctx_, AddField(_, "payload", static_cast<int>(pq_eth_.GetDataPayloadListElementCount()))).InSequence(seq).WillOnce(Return(false));
+        EXPECT_CALL(mock_pq_ctx_, AddField(_, "payload", ParquetContext::VARIABLE_LIST_SIZE)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "payload_sz", 0)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "dstmac", 0)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "srcmac", 0)).InSequence(seq).WillOnce(Return(false));
@@ -122,7 +122,7 @@ class ParquetEthernetF0Test : public ::testing::Test
     {
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI64(_, "time", nullptr)).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI32(_, "channelid", nullptr)).WillOnce(Return(false));
-        EXPECT_CALL(mock_pq_ctx_, SetMemLocI16(_, "payload", nullptr)).WillOnce(Return(false));
+        EXPECT_CALL(mock_pq_ctx_, SetListMemLoc(_, _, typeid(int16_t).name(), "payload")).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI64(_, "payload_sz", nullptr)).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocString(_, "dstmac", nullptr)).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocString(_, "srcmac", nullptr)).WillOnce(Return(false));
@@ -145,7 +145,7 @@ class ParquetEthernetF0Test : public ::testing::Test
     {
         EXPECT_EQ(ParquetEthernetF0::GetRowGroupRowCount() * ParquetEthernetF0::GetRowGroupBufferCount(), pq_eth_.time_stamp_.size());
         EXPECT_EQ(ParquetEthernetF0::GetRowGroupRowCount() * ParquetEthernetF0::GetRowGroupBufferCount(), pq_eth_.channel_id_.size());
-        EXPECT_EQ(ParquetEthernetF0::GetRowGroupRowCount() * ParquetEthernetF0::GetRowGroupBufferCount() * pq_eth_.GetDataPayloadListElementCount(), pq_eth_.payload_.size());
+        EXPECT_EQ(ParquetEthernetF0::GetRowGroupRowCount() * ParquetEthernetF0::GetRowGroupBufferCount(), pq_eth_.payload_.GetRowCount());
         EXPECT_EQ(ParquetEthernetF0::GetRowGroupRowCount() * ParquetEthernetF0::GetRowGroupBufferCount(), pq_eth_.payload_size_.size());
         EXPECT_EQ(ParquetEthernetF0::GetRowGroupRowCount() * ParquetEthernetF0::GetRowGroupBufferCount(), pq_eth_.dst_mac_addr_.size());
         EXPECT_EQ(ParquetEthernetF0::GetRowGroupRowCount() * ParquetEthernetF0::GetRowGroupBufferCount(), pq_eth_.src_mac_addr_.size());
@@ -185,8 +185,11 @@ class ParquetEthernetF0Test : public ::testing::Test
         EXPECT_EQ(eth_data_.dst_port_, pq_eth_.dst_port_.at(0));
         EXPECT_EQ(eth_data_.src_port_, pq_eth_.src_port_.at(0));
 
-        for(size_t i = 0; i < ParquetEthernetF0::GetDataPayloadListElementCount(); i++)
-            EXPECT_EQ(eth_data_.payload_.at(i), pq_eth_.payload_.at(i));
+        // Only the payload_size_ bytes of the frame are stored.
+        ASSERT_EQ(0, pq_eth_.payload_.offsets.at(0));
+        ASSERT_EQ(eth_data_.payload_size_, pq_eth_.payload_.offsets.at(1));
+        for(size_t i = 0; i < eth_data_.payload_size_; i++)
+            EXPECT_EQ(eth_data_.payload_.at(i), pq_eth_.payload_.values.at(i));
     }
 
 };
@@ -203,7 +206,6 @@ TEST_F(ParquetEthernetF0Test, Initialize)
 
     ASSERT_EQ(EX_OK, pq_eth_.Initialize(outf_, thread_id_));
     EXPECT_EQ(thread_id_, pq_eth_.thread_id_);
-    EXPECT_EQ(pq_eth_.payload_ptr_, pq_eth_.payload_.data());
     EXPECT_EQ(outf_.string(), pq_eth_.outfile_);
     ValidateInitializeResize();
 }
@@ -217,7 +219,6 @@ TEST_F(ParquetEthernetF0Test, InitializeOpenForWriteFail)
 
     ASSERT_EQ(EX_IOERR, pq_eth_.Initialize(outf_, thread_id_));
     EXPECT_EQ(thread_id_, pq_eth_.thread_id_);
-    EXPECT_EQ(pq_eth_.payload_ptr_, pq_eth_.payload_.data());
     ValidateInitializeResize();
 }
 
@@ -232,7 +233,6 @@ TEST_F(ParquetEthernetF0Test, InitializeSetupRowCountTrackingFail)
 
     ASSERT_EQ(EX_SOFTWARE, pq_eth_.Initialize(outf_, thread_id_));
     EXPECT_EQ(thread_id_, pq_eth_.thread_id_);
-    EXPECT_EQ(pq_eth_.payload_ptr_, pq_eth_.payload_.data());
     ValidateInitializeResize();
 }
 
@@ -259,7 +259,7 @@ TEST_F(ParquetEthernetF0Test, AppendIncrementAndWriteTrue)
     ASSERT_EQ(EX_OK, pq_eth_.Initialize(outf_, thread_id_));
     pq_eth_.Append(time_stamp_, channel_id_, &eth_data_);
 
-    // Zero comparison payload
-    std::fill(eth_data_.payload_.data(), eth_data_.payload_.data() + pq_eth_.GetDataPayloadListElementCount(), 0);
+    // Payload buffers are not reset after a write. The next row
+    // overwrites the offsets and bytes of the row.
     ValidateAppendedData();
 }
\ No newline at end of file
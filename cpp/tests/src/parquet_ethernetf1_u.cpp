@@ -0,0 +1,126 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_ethernetf1_msg_hdr_format.h"
+#include "parquet_ethernetf1.h"
+#include "parquet_context_mock.h"
+
+using ::testing::Return;
+using ::testing::Exactly;
+using ::testing::_;
+using ::testing::NiceMock;
+
+class ParquetEthernetF1Test : public ::testing::Test
+{
+   protected:
+    NiceMock<MockParquetContext> mock_pq_ctx_;
+    ParquetEthernetF1 pqeth_;
+    ManagedPath outf_;
+    bool truncate_;
+    uint16_t thread_id_;
+    uint8_t doy_;
+    uint32_t channel_id_;
+
+    public:
+    ParquetEthernetF1Test() : mock_pq_ctx_(), pqeth_(&mock_pq_ctx_), outf_("test.parquet"),
+        truncate_(true), thread_id_(4), doy_(1), channel_id_(12)
+    {}
+
+    void ValidateInitializeAddField()
+    {
+        ::testing::Sequence seq;
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int64(), "time", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "doy", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "channelid", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "vl", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "srcip", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "dstip", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "srcport", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "dstport", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int16(), "error", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int16(), "flags", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int16(), "payload_sz", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int8(), "payload",
+            ParquetContext::VARIABLE_LIST_SIZE)).InSequence(seq).WillOnce(Return(true));
+    }
+};
+
+TEST_F(ParquetEthernetF1Test, Initialize)
+{
+    ValidateInitializeAddField();
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(ParquetEthernetF1::GetRowGroupRowCount(),
+        ParquetEthernetF1::GetRowGroupBufferCount(), true, "EthernetF1")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, EnableEmptyFileDeletion(outf_.string())).Times(Exactly(1));
+
+    ASSERT_EQ(EX_OK, pqeth_.Initialize(outf_, thread_id_));
+    EXPECT_EQ(thread_id_, pqeth_.thread_id_);
+    EXPECT_EQ(outf_.string(), pqeth_.outfile_);
+
+    size_t expected_size = ParquetEthernetF1::GetRowGroupRowCount() *
+        ParquetEthernetF1::GetRowGroupBufferCount();
+    EXPECT_EQ(expected_size, pqeth_.time_stamp_.size());
+    EXPECT_EQ(expected_size, pqeth_.virtual_link_.size());
+    EXPECT_EQ(expected_size, pqeth_.payload_.GetRowCount());
+}
+
+TEST_F(ParquetEthernetF1Test, InitializeOpenForWriteFail)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(false));
+    ASSERT_EQ(EX_IOERR, pqeth_.Initialize(outf_, thread_id_));
+}
+
+TEST_F(ParquetEthernetF1Test, AppendNotInitialized)
+{
+    EXPECT_CALL(mock_pq_ctx_, IncrementAndWrite(_)).Times(Exactly(0));
+    EthernetF1IPDHFmt ipdh{};
+    std::vector<uint8_t> payload{1, 2};
+    ipdh.data_length = 2;
+    pqeth_.Append(1000, doy_, channel_id_, ipdh, payload.data());
+}
+
+TEST_F(ParquetEthernetF1Test, Append)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(_, _, true, "EthernetF1")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, IncrementAndWrite(thread_id_)).Times(Exactly(2))
+        .WillRepeatedly(Return(false));
+    ASSERT_EQ(EX_OK, pqeth_.Initialize(outf_, thread_id_));
+
+    EthernetF1IPDHFmt ipdh{};
+    ipdh.data_length = 4;
+    ipdh.error = 2;
+    ipdh.flags = 0x80;
+    ipdh.virtual_link = 0xFFFF;
+    ipdh.src_ip = 0x0A000001;
+    ipdh.dst_ip = 0xE0E00101;
+    ipdh.src_port = 0xFFFE;
+    ipdh.dst_port = 1000;
+    std::vector<uint8_t> payload{0x01, 0x02, 0xFF, 0x04};
+    pqeth_.Append(1000, doy_, channel_id_, ipdh, payload.data());
+
+    EXPECT_EQ(1000, pqeth_.time_stamp_.at(0));
+    EXPECT_EQ(doy_, pqeth_.doy_.at(0));
+    EXPECT_EQ(channel_id_, pqeth_.channel_id_.at(0));
+    EXPECT_EQ(0xFFFF, pqeth_.virtual_link_.at(0));
+    EXPECT_EQ(0x0A000001, pqeth_.src_ip_.at(0));
+    EXPECT_EQ(static_cast<int32_t>(0xE0E00101), pqeth_.dst_ip_.at(0));
+    EXPECT_EQ(0xFFFE, pqeth_.src_port_.at(0));
+    EXPECT_EQ(1000, pqeth_.dst_port_.at(0));
+    EXPECT_EQ(2, pqeth_.error_.at(0));
+    EXPECT_EQ(0x80, pqeth_.flags_.at(0));
+    EXPECT_EQ(4, pqeth_.payload_size_.at(0));
+    ASSERT_EQ(0, pqeth_.payload_.offsets.at(0));
+    ASSERT_EQ(4, pqeth_.payload_.offsets.at(1));
+    EXPECT_THAT(std::vector<int8_t>(pqeth_.payload_.values.begin(), pqeth_.payload_.values.begin() + 4),
+        ::testing::ElementsAre(1, 2, -1, 4));
+
+    // The mock context does not advance the row, so the shorter payload
+    // overwrites the first and only its bytes are held by the row.
+    ipdh.data_length = 1;
+    pqeth_.Append(2000, doy_, channel_id_, ipdh, payload.data() + 3);
+    EXPECT_EQ(2000, pqeth_.time_stamp_.at(0));
+    EXPECT_EQ(1, pqeth_.payload_size_.at(0));
+    ASSERT_EQ(1, pqeth_.payload_.offsets.at(1));
+    EXPECT_EQ(4, pqeth_.payload_.values.at(0));
+}
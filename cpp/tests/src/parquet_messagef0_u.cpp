@@ -0,0 +1,89 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_messagef0_msg_hdr_format.h"
+#include "parquet_messagef0.h"
+#include "parquet_context_mock.h"
+
+using ::testing::Return;
+using ::testing::Exactly;
+using ::testing::_;
+using ::testing::NiceMock;
+
+class ParquetMessageF0Test : public ::testing::Test
+{
+   protected:
+    NiceMock<MockParquetContext> mock_pq_ctx_;
+    ParquetMessageF0 pqmsg_;
+    ManagedPath outf_;
+    bool truncate_;
+    uint16_t thread_id_;
+    uint8_t doy_;
+    uint32_t channel_id_;
+
+    public:
+    ParquetMessageF0Test() : mock_pq_ctx_(), pqmsg_(&mock_pq_ctx_), outf_("test.parquet"),
+        truncate_(true), thread_id_(4), doy_(1), channel_id_(12)
+    {}
+};
+
+TEST_F(ParquetMessageF0Test, Initialize)
+{
+    ::testing::Sequence seq;
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int64(), "time", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "doy", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "channelid", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int16(), "subchannel", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int8(), "pkttype", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "FE", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "DE", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::binary(), "data", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetListMemLoc(_, _, _, "data")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(ParquetMessageF0::GetRowGroupRowCount(),
+        ParquetMessageF0::GetRowGroupBufferCount(), true, "MessageF0")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, EnableEmptyFileDeletion(outf_.string())).Times(Exactly(1));
+
+    ASSERT_EQ(EX_OK, pqmsg_.Initialize(outf_, thread_id_));
+    EXPECT_EQ(thread_id_, pqmsg_.thread_id_);
+    EXPECT_EQ(outf_.string(), pqmsg_.outfile_);
+
+    size_t expected_size = ParquetMessageF0::GetRowGroupRowCount() *
+        ParquetMessageF0::GetRowGroupBufferCount();
+    EXPECT_EQ(expected_size, pqmsg_.time_stamp_.size());
+    EXPECT_EQ(expected_size, pqmsg_.data_.GetRowCount());
+}
+
+TEST_F(ParquetMessageF0Test, InitializeSetupRowCountTrackingFail)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(_, _, true, "MessageF0")).WillOnce(Return(false));
+    ASSERT_EQ(EX_SOFTWARE, pqmsg_.Initialize(outf_, thread_id_));
+}
+
+TEST_F(ParquetMessageF0Test, Append)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(_, _, true, "MessageF0")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, IncrementAndWrite(thread_id_)).Times(Exactly(1))
+        .WillRepeatedly(Return(false));
+    ASSERT_EQ(EX_OK, pqmsg_.Initialize(outf_, thread_id_));
+
+    MessageF0DataHeaderFmt hdr{};
+    hdr.length = 2;
+    hdr.subchannel = 9;
+    hdr.FE = 1;
+    hdr.DE = 0;
+    std::vector<uint8_t> data{0xAB, 0xCD};
+    pqmsg_.Append(1000, doy_, channel_id_, 3, hdr, data.data());
+
+    EXPECT_EQ(1000, pqmsg_.time_stamp_.at(0));
+    EXPECT_EQ(channel_id_, pqmsg_.channel_id_.at(0));
+    EXPECT_EQ(9, pqmsg_.subchannel_.at(0));
+    EXPECT_EQ(3, pqmsg_.pkt_type_.at(0));
+    EXPECT_EQ(1, pqmsg_.format_error_.at(0));
+    EXPECT_EQ(0, pqmsg_.data_error_.at(0));
+    EXPECT_EQ(2, pqmsg_.data_.offsets.at(1));
+    EXPECT_THAT(std::vector<uint8_t>(pqmsg_.data_.values.begin(),
+        pqmsg_.data_.values.begin() + 2), ::testing::ElementsAre(0xAB, 0xCD));
+}
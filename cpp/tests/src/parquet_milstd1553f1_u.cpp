@@ -85,7 +85,7 @@ class ParquetMilStd1553F1Test : public ::testing::Test
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "gap1", 0)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "gap2", 0)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "mode", 0)).InSequence(seq).WillOnce(Return(true));
-        EXPECT_CALL(mock_pq_ctx_, AddField(_, "data", ParquetMilStd1553F1::GetDataPayloadListElementCount())).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(_, "data", ParquetContext::VARIABLE_LIST_SIZE)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "txcommwrd", 0)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "rxcommwrd", 0)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "txrtaddr", 0)).InSequence(seq).WillOnce(Return(true));
@@ -141,7 +141,7 @@ class ParquetMilStd1553F1Test : public ::testing::Test
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI16(_, "gap1", nullptr)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI16(_, "gap2", nullptr)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocUI8(_, "mode", nullptr)).InSequence(seq).WillOnce(Return(true));
-        EXPECT_CALL(mock_pq_ctx_, SetMemLocI32(_, "data", nullptr)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, SetListMemLoc(_, _, typeid(int32_t).name(), "data")).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI32(_, "txcommwrd", nullptr)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI32(_, "rxcommwrd", nullptr)).InSequence(seq).WillOnce(Return(true));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI8(_, "txrtaddr", nullptr)).InSequence(seq).WillOnce(Return(true));
@@ -198,7 +198,7 @@ class ParquetMilStd1553F1Test : public ::testing::Test
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "gap1", 0)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "gap2", 0)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "mode", 0)).InSequence(seq).WillOnce(Return(false));
-        EXPECT_CALL(mock_pq_ctx_, AddField(_, "data", ParquetMilStd1553F1::GetDataPayloadListElementCount())).InSequence(seq).WillOnce(Return(false));
+        EXPECT_CALL(mock_pq_ctx_, AddField(_, "data", ParquetContext::VARIABLE_LIST_SIZE)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "txcommwrd", 0)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "rxcommwrd", 0)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, AddField(_, "txrtaddr", 0)).InSequence(seq).WillOnce(Return(false));
@@ -253,7 +253,7 @@ class ParquetMilStd1553F1Test : public ::testing::Test
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI16(_, "gap1", nullptr)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI16(_, "gap2", nullptr)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocUI8(_, "mode", nullptr)).InSequence(seq).WillOnce(Return(false));
-        EXPECT_CALL(mock_pq_ctx_, SetMemLocI32(_, "data", nullptr)).InSequence(seq).WillOnce(Return(false));
+        EXPECT_CALL(mock_pq_ctx_, SetListMemLoc(_, _, typeid(int32_t).name(), "data")).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI32(_, "txcommwrd", nullptr)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI32(_, "rxcommwrd", nullptr)).InSequence(seq).WillOnce(Return(false));
         EXPECT_CALL(mock_pq_ctx_, SetMemLocI8(_, "txrtaddr", nullptr)).InSequence(seq).WillOnce(Return(false));
@@ -309,7 +309,7 @@ class ParquetMilStd1553F1Test : public ::testing::Test
         EXPECT_EQ(expected_size, pq1553_.gap1_.size());
         EXPECT_EQ(expected_size, pq1553_.gap2_.size());
         EXPECT_EQ(expected_size, pq1553_.mode_code_.size());
-        EXPECT_EQ(expected_size * ParquetMilStd1553F1::GetDataPayloadListElementCount(), pq1553_.data_.size());
+        EXPECT_EQ(expected_size, pq1553_.data_.GetRowCount());
         EXPECT_EQ(expected_size, pq1553_.comm_word1_.size());
         EXPECT_EQ(expected_size, pq1553_.comm_word2_.size());
         EXPECT_EQ(expected_size, pq1553_.rtaddr1_.size());
@@ -327,13 +327,15 @@ class ParquetMilStd1553F1Test : public ::testing::Test
     }
 
     void ValidateAppended1553Words(const std::vector<uint16_t>& input_data, 
-        const std::vector<int32_t>& appended_data, int8_t calcwrdcnt, 
-        size_t offset)
+        const ListColumnBuffer<int32_t>& appended_data, int8_t calcwrdcnt, 
+        size_t row)
     {
-        size_t total_offset = offset * ParquetMilStd1553F1::GetDataPayloadListElementCount();
+        // Only the calculated count of words is stored for the row.
+        size_t total_offset = appended_data.offsets.at(row);
+        ASSERT_EQ(calcwrdcnt, appended_data.offsets.at(row + 1) - total_offset);
         for(int8_t i = 0; i < calcwrdcnt; i++)
         {
-            EXPECT_EQ(input_data.at(i), appended_data.at(total_offset + i));
+            EXPECT_EQ(input_data.at(i), appended_data.values.at(total_offset + i));
         }
     }
 
@@ -525,7 +527,7 @@ TEST_F(ParquetMilStd1553F1Test, AppendRTtoRTModeCodeIncrementAndWriteFalseDoNotZ
     ValidateAppended1553Words(data_vec, pq1553_.data_, calcwrdcnt, 0);
 }
 
-TEST_F(ParquetMilStd1553F1Test, AppendRTtoRTModeCodeIncrementAndWriteTrueZeroData)
+TEST_F(ParquetMilStd1553F1Test, AppendRTtoRTModeCodeIncrementAndWriteTrue)
 {
     // Initialize parameters for RTtoRT, mode code true
     calcwrdcnt = 20;
@@ -550,8 +552,8 @@ TEST_F(ParquetMilStd1553F1Test, AppendRTtoRTModeCodeIncrementAndWriteTrueZeroDat
 
     ValidateAppendedMetadataRTtoRT();
 
-    // Zero input data
-    std::fill(data_vec.begin(), data_vec.end(), 0);
+    // Payload buffers are not reset after a write. The next row
+    // overwrites the offsets and words of the row.
     ValidateAppended1553Words(data_vec, pq1553_.data_, calcwrdcnt, 0);
 }
 
@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_pcmf1_msg_hdr_format.h"
+#include "parquet_pcmf1.h"
+#include "parquet_context_mock.h"
+
+using ::testing::Return;
+using ::testing::Exactly;
+using ::testing::_;
+using ::testing::NiceMock;
+
+class ParquetPCMF1Test : public ::testing::Test
+{
+   protected:
+    NiceMock<MockParquetContext> mock_pq_ctx_;
+    ParquetPCMF1 pqpcm_;
+    ManagedPath outf_;
+    bool truncate_;
+    uint16_t thread_id_;
+    uint32_t words_per_minor_frame_;
+
+    uint64_t time_stamp_;
+    uint8_t doy_;
+    uint32_t channel_id_;
+    PCMF1CSDWFmt csdw_;
+
+    public:
+    ParquetPCMF1Test() : mock_pq_ctx_(), pqpcm_(&mock_pq_ctx_), outf_("test.parquet"),
+        truncate_(true), thread_id_(7), words_per_minor_frame_(4), time_stamp_(192760278),
+        doy_(1), channel_id_(10), csdw_{}
+    {
+        csdw_.THR = 1;
+        csdw_.MJF = 2;
+        csdw_.MNF = 3;
+    }
+
+    void ValidateInitializeAddField()
+    {
+        ::testing::Sequence seq;
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int64(), "time", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "doy", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "channelid", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "THR", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int8(), "MJF", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int8(), "MNF", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int8(), "lockst", 0)).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "words", words_per_minor_frame_))
+            .InSequence(seq).WillOnce(Return(true));
+    }
+};
+
+TEST_F(ParquetPCMF1Test, GetRowGroupRowCount)
+{
+    EXPECT_EQ(ParquetPCMF1::PCMF1_MIN_ROW_GROUP_COUNT, ParquetPCMF1::GetRowGroupRowCount(0));
+    EXPECT_EQ(ParquetPCMF1::PCMF1_ROW_GROUP_WORD_COUNT / 4, ParquetPCMF1::GetRowGroupRowCount(4));
+    EXPECT_EQ(ParquetPCMF1::PCMF1_MIN_ROW_GROUP_COUNT,
+        ParquetPCMF1::GetRowGroupRowCount(ParquetPCMF1::PCMF1_ROW_GROUP_WORD_COUNT));
+}
+
+TEST_F(ParquetPCMF1Test, InitializeWordCountZero)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(_, _)).Times(Exactly(0));
+    ASSERT_EQ(EX_CONFIG, pqpcm_.Initialize(outf_, thread_id_, 0));
+}
+
+TEST_F(ParquetPCMF1Test, Initialize)
+{
+    ValidateInitializeAddField();
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(
+        ParquetPCMF1::GetRowGroupRowCount(words_per_minor_frame_),
+        ParquetPCMF1::GetRowGroupBufferCount(), true, "PCMF1")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, EnableEmptyFileDeletion(outf_.string())).Times(Exactly(1));
+
+    ASSERT_EQ(EX_OK, pqpcm_.Initialize(outf_, thread_id_, words_per_minor_frame_));
+    EXPECT_EQ(thread_id_, pqpcm_.thread_id_);
+    EXPECT_EQ(outf_.string(), pqpcm_.outfile_);
+
+    size_t expected_size = ParquetPCMF1::GetRowGroupRowCount(words_per_minor_frame_) *
+        ParquetPCMF1::GetRowGroupBufferCount();
+    EXPECT_EQ(expected_size, pqpcm_.time_stamp_.size());
+    EXPECT_EQ(expected_size, pqpcm_.lockst_.size());
+    EXPECT_EQ(expected_size * words_per_minor_frame_, pqpcm_.words_.size());
+}
+
+TEST_F(ParquetPCMF1Test, InitializeOpenForWriteFail)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(false));
+    ASSERT_EQ(EX_IOERR, pqpcm_.Initialize(outf_, thread_id_, words_per_minor_frame_));
+}
+
+TEST_F(ParquetPCMF1Test, Append)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(_, _, true, "PCMF1")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, IncrementAndWrite(thread_id_)).WillOnce(Return(false));
+    ASSERT_EQ(EX_OK, pqpcm_.Initialize(outf_, thread_id_, words_per_minor_frame_));
+
+    std::vector<uint32_t> words{0x123, 0xFFFFFFFF, 0, 0xABC};
+    pqpcm_.Append(time_stamp_, doy_, channel_id_, &csdw_, 5, words.data());
+
+    EXPECT_EQ(time_stamp_, pqpcm_.time_stamp_.at(0));
+    EXPECT_EQ(doy_, pqpcm_.doy_.at(0));
+    EXPECT_EQ(channel_id_, pqpcm_.channel_id_.at(0));
+    EXPECT_EQ(1, pqpcm_.THR_.at(0));
+    EXPECT_EQ(2, pqpcm_.MJF_.at(0));
+    EXPECT_EQ(3, pqpcm_.MNF_.at(0));
+    EXPECT_EQ(5, pqpcm_.lockst_.at(0));
+    EXPECT_EQ(0x123, pqpcm_.words_.at(0));
+    EXPECT_EQ(-1, pqpcm_.words_.at(1));
+    EXPECT_EQ(0, pqpcm_.words_.at(2));
+    EXPECT_EQ(0xABC, pqpcm_.words_.at(3));
+}
@@ -260,6 +260,197 @@ TEST_F(ParquetReaderTest, GetNextRGMultipleFilesSingleRowGroup)
     ASSERT_EQ(size, 0);
 }
 
+TEST_F(ParquetReaderTest, GetNextRGTableAllColumns)
+{
+    std::vector<std::vector<int32_t>> data1 = {{1, 2, 3}, {4, 5, 6}};
+    std::vector<std::vector<int32_t>> data2 = {{7, 8, 9}, {10, 11, 12}};
+
+    std::string dirname = "file1.parquet";
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), dirname, data1, 2));
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), dirname, data2, 3));
+
+    ParquetReader pm;
+    ASSERT_TRUE(pm.SetPQPath(dirname));
+
+    std::vector<int64_t> expected_rows = {2, 1, 3};
+    std::vector<int32_t> expected_first_col1 = {1, 3, 7};
+    std::vector<int32_t> expected_first_col2 = {4, 6, 10};
+    std::shared_ptr<arrow::Table> table;
+    for (size_t i = 0; i < expected_rows.size(); i++)
+    {
+        ASSERT_TRUE(pm.GetNextRGTable(table));
+        ASSERT_EQ(2, table->num_columns());
+        ASSERT_EQ(expected_rows[i], table->num_rows());
+        ASSERT_EQ(1, table->column(0)->num_chunks());
+        EXPECT_EQ(expected_first_col1[i], std::static_pointer_cast<arrow::Int32Array>(
+            table->column(0)->chunk(0))->Value(0));
+        EXPECT_EQ(expected_first_col2[i], std::static_pointer_cast<arrow::Int32Array>(
+            table->column(1)->chunk(0))->Value(0));
+    }
+    EXPECT_FALSE(pm.GetNextRGTable(table));
+}
+
+TEST_F(ParquetReaderTest, GetNextRGColumnsProjection)
+{
+    std::vector<std::vector<int32_t>> data1 = {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+    std::vector<std::vector<int32_t>> data2 = {{10, 11}, {12, 13}, {14, 15}};
+
+    std::string dirname = "file1.parquet";
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), dirname, data1, 2));
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), dirname, data2, 2));
+
+    ParquetReader pm;
+    ASSERT_TRUE(pm.SetPQPath(dirname));
+    EXPECT_FALSE(pm.SetColumnProjection({"data2", "junk"}));
+    ASSERT_TRUE(pm.SetColumnProjection({"data2", "data0"}));
+    pm.SetPrefetch(true);
+
+    std::vector<int64_t> expected_rows = {2, 1, 2};
+    std::vector<int32_t> expected_first_col0 = {1, 3, 10};
+    std::vector<int32_t> expected_first_col2 = {7, 9, 14};
+    ParquetRowGroup rg;
+    const int32_t* vals = nullptr;
+    int64_t count = 0;
+    for (size_t i = 0; i < expected_rows.size(); i++)
+    {
+        ASSERT_TRUE(pm.GetNextRGColumns(rg));
+        ASSERT_EQ(expected_rows[i], rg.GetRowCount());
+
+        ASSERT_TRUE(rg.GetValues<arrow::Int32Array>(0, vals, count));
+        ASSERT_EQ(expected_rows[i], count);
+        EXPECT_EQ(expected_first_col0[i], vals[0]);
+
+        ASSERT_TRUE(rg.GetValues<arrow::Int32Array>(2, vals, count));
+        EXPECT_EQ(expected_first_col2[i], vals[0]);
+
+        // Not in the projection
+        EXPECT_FALSE(rg.GetValues<arrow::Int32Array>(1, vals, count));
+        EXPECT_EQ(nullptr, rg.GetArray(1, false));
+    }
+    EXPECT_FALSE(pm.GetNextRGColumns(rg));
+    EXPECT_EQ(0, rg.GetRowCount());
+}
+
+TEST_F(ParquetReaderTest, GetNextRGColumnsPrefetchManualIncrement)
+{
+    std::vector<std::vector<int32_t>> data = {{1, 2, 3, 4, 5, 6, 7}, {8, 9, 10, 11, 12, 13, 14}};
+
+    std::string dirname = "file1.parquet";
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), dirname, data, 2));
+
+    ParquetReader pm;
+    ASSERT_TRUE(pm.SetPQPath(dirname));
+    pm.SetManualRowgroupIncrementMode();
+    pm.SetPrefetch(true);
+
+    ParquetRowGroup rg;
+    std::vector<int64_t> vals;
+    int size = 0;
+
+    // The row group is read again if it is not incremented, regardless
+    // of the prefetched row group.
+    ASSERT_TRUE(pm.GetNextRGColumns(rg));
+    ASSERT_TRUE((rg.CopyValues<int64_t, arrow::Int32Array>(1, vals, size)));
+    ASSERT_EQ(2, size);
+    EXPECT_EQ(8, vals[0]);
+    ASSERT_TRUE(pm.GetNextRGColumns(rg));
+    ASSERT_TRUE((rg.CopyValues<int64_t, arrow::Int32Array>(1, vals, size)));
+    EXPECT_EQ(8, vals[0]);
+
+    pm.IncrementRG();
+    ASSERT_TRUE(pm.GetNextRGColumns(rg));
+    ASSERT_TRUE((rg.CopyValues<int64_t, arrow::Int32Array>(0, vals, size)));
+    EXPECT_EQ(3, vals[0]);
+
+    // Interleaved single column read
+    std::vector<int32_t> out;
+    pm.IncrementRG();
+    ASSERT_TRUE((pm.GetNextRG<int32_t, arrow::NumericArray<arrow::Int32Type>>(0, out, size)));
+    EXPECT_EQ(5, out[0]);
+
+    pm.IncrementRG();
+    ASSERT_TRUE(pm.GetNextRGColumns(rg));
+    ASSERT_EQ(1, rg.GetRowCount());
+    ASSERT_TRUE((rg.CopyValues<int64_t, arrow::Int32Array>(0, vals, size)));
+    EXPECT_EQ(7, vals[0]);
+
+    pm.IncrementRG();
+    EXPECT_FALSE(pm.GetNextRGColumns(rg));
+}
+
+TEST_F(ParquetReaderTest, SetRowGroupFilter)
+{
+    // Row groups of two rows: data0 ranges [1, 2], [3, 4], [5, 6], [7]
+    std::vector<std::vector<int32_t>> data = {{1, 2, 3, 4, 5, 6, 7}, {8, 9, 10, 11, 12, 13, 14}};
+
+    std::string dirname = "file1.parquet";
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), dirname, data, 2));
+
+    ParquetReader pm;
+    ASSERT_TRUE(pm.SetPQPath(dirname));
+    ASSERT_EQ(4, pm.GetRowGroupCount());
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(pm.RowGroupMayMatch(i));
+
+    EXPECT_FALSE(pm.SetRowGroupFilter("junk", {1}));
+    ASSERT_TRUE(pm.SetRowGroupFilter("data0", {4, 7, 20}));
+    EXPECT_FALSE(pm.RowGroupMayMatch(0));
+    EXPECT_TRUE(pm.RowGroupMayMatch(1));
+    EXPECT_FALSE(pm.RowGroupMayMatch(2));
+    EXPECT_TRUE(pm.RowGroupMayMatch(3));
+    EXPECT_TRUE(pm.RowGroupMayMatch(4));
+
+    // All filters must be satisfied
+    ASSERT_TRUE(pm.SetRowGroupFilter("data1", {14}));
+    EXPECT_FALSE(pm.RowGroupMayMatch(1));
+    EXPECT_TRUE(pm.RowGroupMayMatch(3));
+
+    pm.ClearRowGroupFilters();
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(pm.RowGroupMayMatch(i));
+
+    ASSERT_TRUE(pm.SetRowGroupFilter("data0", {5}));
+    EXPECT_FALSE(pm.RowGroupMayMatch(0));
+    ASSERT_TRUE(pm.SetPQPath(dirname));
+    EXPECT_TRUE(pm.RowGroupMayMatch(0));
+}
+
+TEST_F(ParquetReaderTest, SetRowGroupFilterPrefetchSkipsRowGroups)
+{
+    std::vector<std::vector<int32_t>> data = {{1, 2, 3, 4, 5, 6, 7}};
+
+    std::string dirname = "file1.parquet";
+    ASSERT_TRUE(CreateParquetFile(arrow::int32(), dirname, data, 2));
+
+    ParquetReader pm;
+    ASSERT_TRUE(pm.SetPQPath(dirname));
+    pm.SetManualRowgroupIncrementMode();
+    pm.SetPrefetch(true);
+    ASSERT_TRUE(pm.SetRowGroupFilter("data0", {1, 7}));
+
+    // The caller skips row groups which can't match, in which case
+    // the prefetched row group is used.
+    ParquetRowGroup rg;
+    std::vector<int64_t> vals;
+    int size = 0;
+    std::vector<int32_t> expected = {1, 7};
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        while (!pm.RowGroupMayMatch(pm.current_row_group))
+            pm.IncrementRG();
+        ASSERT_TRUE(pm.GetNextRGColumns(rg));
+        ASSERT_TRUE((rg.CopyValues<int64_t, arrow::Int32Array>(0, vals, size)));
+        EXPECT_EQ(expected[i], vals[0]);
+        pm.IncrementRG();
+    }
+    EXPECT_FALSE(pm.GetNextRGColumns(rg));
+}
+
+TEST_F(ParquetReaderTest, StatisticsMayMatchNoStatistics)
+{
+    EXPECT_TRUE(ParquetReader::StatisticsMayMatch(nullptr, {1, 2}));
+}
+
 TEST_F(ParquetReaderTest, GetNextRGManualIncrementInt32)
 {
     int size;
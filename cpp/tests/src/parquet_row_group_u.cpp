@@ -0,0 +1,167 @@
+#include <vector>
+#include <memory>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "parquet_row_group.h"
+
+class ParquetRowGroupTest : public ::testing::Test
+{
+   protected:
+    ParquetRowGroup rg_;
+    std::shared_ptr<arrow::Table> table_;
+
+    ParquetRowGroupTest() : rg_(), table_(nullptr)
+    {}
+
+    // Table with an int32 column without nulls, an int32 column with
+    // a null and a list of int32 column with two values per row.
+    void CreateTable()
+    {
+        arrow::Int32Builder a_builder;
+        ASSERT_TRUE(a_builder.AppendValues({1, 2, 3}).ok());
+        std::shared_ptr<arrow::Array> a_arr;
+        ASSERT_TRUE(a_builder.Finish(&a_arr).ok());
+
+        arrow::Int32Builder b_builder;
+        ASSERT_TRUE(b_builder.Append(4).ok());
+        ASSERT_TRUE(b_builder.AppendNull().ok());
+        ASSERT_TRUE(b_builder.Append(6).ok());
+        std::shared_ptr<arrow::Array> b_arr;
+        ASSERT_TRUE(b_builder.Finish(&b_arr).ok());
+
+        std::shared_ptr<arrow::Int32Builder> val_builder =
+            std::make_shared<arrow::Int32Builder>();
+        arrow::ListBuilder list_builder(arrow::default_memory_pool(), val_builder);
+        for (int32_t i = 0; i < 3; i++)
+        {
+            ASSERT_TRUE(list_builder.Append().ok());
+            ASSERT_TRUE(val_builder->AppendValues({10 * i, 10 * i + 1}).ok());
+        }
+        std::shared_ptr<arrow::Array> list_arr;
+        ASSERT_TRUE(list_builder.Finish(&list_arr).ok());
+
+        std::shared_ptr<arrow::Schema> schema = arrow::schema(
+            {arrow::field("a", arrow::int32()), arrow::field("b", arrow::int32()),
+             arrow::field("c", arrow::list(arrow::int32()))});
+        table_ = arrow::Table::Make(schema, {a_arr, b_arr, list_arr});
+    }
+};
+
+TEST_F(ParquetRowGroupTest, NotSet)
+{
+    const int32_t* vals = nullptr;
+    int64_t count = 5;
+    EXPECT_EQ(0, rg_.GetRowCount());
+    EXPECT_EQ(nullptr, rg_.GetArray(0, false));
+    EXPECT_FALSE(rg_.GetValues<arrow::Int32Array>(0, vals, count));
+    EXPECT_EQ(0, count);
+}
+
+TEST_F(ParquetRowGroupTest, GetValues)
+{
+    CreateTable();
+
+    // Schema column indices differ from table column indices
+    rg_.Set(table_, {2, 5, 7});
+    EXPECT_EQ(3, rg_.GetRowCount());
+
+    const int32_t* vals = nullptr;
+    int64_t count = 0;
+    ASSERT_TRUE(rg_.GetValues<arrow::Int32Array>(2, vals, count));
+    ASSERT_EQ(3, count);
+    EXPECT_THAT(std::vector<int32_t>(vals, vals + count), ::testing::ElementsAre(1, 2, 3));
+
+    // Column with null
+    EXPECT_FALSE(rg_.GetValues<arrow::Int32Array>(5, vals, count));
+
+    // Wrong type
+    const int64_t* vals64 = nullptr;
+    EXPECT_FALSE(rg_.GetValues<arrow::Int64Array>(2, vals64, count));
+
+    // Column not present
+    EXPECT_FALSE(rg_.GetValues<arrow::Int32Array>(0, vals, count));
+
+    // List column
+    EXPECT_FALSE(rg_.GetValues<arrow::Int32Array>(7, vals, count));
+    ASSERT_TRUE(rg_.GetValues<arrow::Int32Array>(7, vals, count, true));
+    ASSERT_EQ(6, count);
+    EXPECT_THAT(std::vector<int32_t>(vals, vals + count),
+                ::testing::ElementsAre(0, 1, 10, 11, 20, 21));
+    EXPECT_FALSE(rg_.GetValues<arrow::Int32Array>(2, vals, count, true));
+
+    rg_.Reset();
+    EXPECT_EQ(0, rg_.GetRowCount());
+}
+
+TEST_F(ParquetRowGroupTest, CopyValues)
+{
+    CreateTable();
+    rg_.Set(table_, {0, 1, 2});
+
+    std::vector<uint16_t> out;
+    int size = 0;
+    ASSERT_TRUE((rg_.CopyValues<uint16_t, arrow::Int32Array>(0, out, size)));
+    ASSERT_EQ(3, size);
+    EXPECT_THAT(out, ::testing::ElementsAre(1, 2, 3));
+
+    // Nulls are zero
+    ASSERT_TRUE((rg_.CopyValues<uint16_t, arrow::Int32Array>(1, out, size)));
+    EXPECT_THAT(out, ::testing::ElementsAre(4, 0, 6));
+
+    ASSERT_TRUE((rg_.CopyValues<uint16_t, arrow::Int32Array>(2, out, size, true)));
+    ASSERT_EQ(6, size);
+    EXPECT_THAT(out, ::testing::ElementsAre(0, 1, 10, 11, 20, 21));
+
+    // The vector is not reduced in size
+    ASSERT_TRUE((rg_.CopyValues<uint16_t, arrow::Int32Array>(0, out, size)));
+    ASSERT_EQ(3, size);
+    EXPECT_EQ(6, out.size());
+
+    EXPECT_FALSE((rg_.CopyValues<uint16_t, arrow::Int8Array>(0, out, size)));
+    EXPECT_EQ(0, size);
+}
+
+TEST_F(ParquetRowGroupTest, CopyListValues)
+{
+    // Rows of 2, 0 and 4 values and a null row
+    std::shared_ptr<arrow::Int32Builder> val_builder =
+        std::make_shared<arrow::Int32Builder>();
+    arrow::ListBuilder list_builder(arrow::default_memory_pool(), val_builder);
+    ASSERT_TRUE(list_builder.Append().ok());
+    ASSERT_TRUE(val_builder->AppendValues({1, 2}).ok());
+    ASSERT_TRUE(list_builder.Append().ok());
+    ASSERT_TRUE(list_builder.Append().ok());
+    ASSERT_TRUE(val_builder->AppendValues({3, 4, 5, 6}).ok());
+    ASSERT_TRUE(list_builder.AppendNull().ok());
+    std::shared_ptr<arrow::Array> list_arr;
+    ASSERT_TRUE(list_builder.Finish(&list_arr).ok());
+
+    std::shared_ptr<arrow::Schema> schema = arrow::schema(
+        {arrow::field("c", arrow::list(arrow::int32()))});
+    rg_.Set(arrow::Table::Make(schema, {list_arr}), {0});
+
+    // Short rows are zero-filled, long rows truncated.
+    std::vector<uint16_t> out(12, 99);
+    int row_count = 0;
+    ASSERT_TRUE((rg_.CopyListValues<uint16_t, arrow::Int32Array>(0, out, row_count, 3)));
+    ASSERT_EQ(4, row_count);
+    EXPECT_THAT(out, ::testing::ElementsAre(1, 2, 0, 0, 0, 0, 3, 4, 5, 0, 0, 0));
+
+    EXPECT_FALSE((rg_.CopyListValues<uint16_t, arrow::Int8Array>(0, out, row_count, 3)));
+    EXPECT_EQ(0, row_count);
+}
+
+TEST_F(ParquetRowGroupTest, CopyListValuesFixedSizeRows)
+{
+    CreateTable();
+    rg_.Set(table_, {0, 1, 2});
+
+    std::vector<uint16_t> out;
+    int row_count = 0;
+    ASSERT_TRUE((rg_.CopyListValues<uint16_t, arrow::Int32Array>(2, out, row_count, 2)));
+    ASSERT_EQ(3, row_count);
+    EXPECT_THAT(out, ::testing::ElementsAre(0, 1, 10, 11, 20, 21));
+
+    // Not a list column
+    EXPECT_FALSE((rg_.CopyListValues<uint16_t, arrow::Int32Array>(0, out, row_count, 2)));
+}
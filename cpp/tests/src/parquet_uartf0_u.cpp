@@ -0,0 +1,94 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "ch10_uartf0_msg_hdr_format.h"
+#include "parquet_uartf0.h"
+#include "parquet_context_mock.h"
+
+using ::testing::Return;
+using ::testing::Exactly;
+using ::testing::_;
+using ::testing::NiceMock;
+
+class ParquetUARTF0Test : public ::testing::Test
+{
+   protected:
+    NiceMock<MockParquetContext> mock_pq_ctx_;
+    ParquetUARTF0 pquart_;
+    ManagedPath outf_;
+    bool truncate_;
+    uint16_t thread_id_;
+    uint8_t doy_;
+    uint32_t channel_id_;
+
+    public:
+    ParquetUARTF0Test() : mock_pq_ctx_(), pquart_(&mock_pq_ctx_), outf_("test.parquet"),
+        truncate_(true), thread_id_(4), doy_(1), channel_id_(12)
+    {}
+};
+
+TEST_F(ParquetUARTF0Test, Initialize)
+{
+    ::testing::Sequence seq;
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int64(), "time", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "doy", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int32(), "channelid", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::int16(), "subchannel", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::boolean(), "PE", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, AddField(arrow::binary(), "data", 0)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetListMemLoc(_, _, _, "data")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(ParquetUARTF0::GetRowGroupRowCount(),
+        ParquetUARTF0::GetRowGroupBufferCount(), true, "UARTF0")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, EnableEmptyFileDeletion(outf_.string())).Times(Exactly(1));
+
+    ASSERT_EQ(EX_OK, pquart_.Initialize(outf_, thread_id_));
+    EXPECT_EQ(thread_id_, pquart_.thread_id_);
+    EXPECT_EQ(outf_.string(), pquart_.outfile_);
+
+    size_t expected_size = ParquetUARTF0::GetRowGroupRowCount() *
+        ParquetUARTF0::GetRowGroupBufferCount();
+    EXPECT_EQ(expected_size, pquart_.time_stamp_.size());
+    EXPECT_EQ(expected_size, pquart_.data_.GetRowCount());
+}
+
+TEST_F(ParquetUARTF0Test, InitializeOpenForWriteFail)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(false));
+    ASSERT_EQ(EX_IOERR, pquart_.Initialize(outf_, thread_id_));
+}
+
+TEST_F(ParquetUARTF0Test, AppendNotInitialized)
+{
+    EXPECT_CALL(mock_pq_ctx_, IncrementAndWrite(_)).Times(Exactly(0));
+    UARTF0DataHeaderFmt hdr{};
+    std::vector<uint8_t> data{1, 2};
+    hdr.data_length = 2;
+    pquart_.Append(1000, doy_, channel_id_, hdr, data.data());
+}
+
+TEST_F(ParquetUARTF0Test, Append)
+{
+    EXPECT_CALL(mock_pq_ctx_, OpenForWrite(outf_.string(), truncate_)).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, SetupRowCountTracking(_, _, true, "UARTF0")).WillOnce(Return(true));
+    EXPECT_CALL(mock_pq_ctx_, IncrementAndWrite(thread_id_)).Times(Exactly(1))
+        .WillRepeatedly(Return(false));
+    ASSERT_EQ(EX_OK, pquart_.Initialize(outf_, thread_id_));
+
+    UARTF0DataHeaderFmt hdr{};
+    hdr.data_length = 3;
+    hdr.subchannel = 0x3FFF;
+    hdr.PE = 1;
+    std::vector<uint8_t> data{0x01, 0xFF, 0x03};
+    pquart_.Append(1000, doy_, channel_id_, hdr, data.data());
+
+    EXPECT_EQ(1000, pquart_.time_stamp_.at(0));
+    EXPECT_EQ(doy_, pquart_.doy_.at(0));
+    EXPECT_EQ(channel_id_, pquart_.channel_id_.at(0));
+    EXPECT_EQ(0x3FFF, pquart_.subchannel_.at(0));
+    EXPECT_EQ(1, pquart_.parity_error_.at(0));
+    EXPECT_EQ(0, pquart_.data_.offsets.at(0));
+    EXPECT_EQ(3, pquart_.data_.offsets.at(1));
+    EXPECT_THAT(std::vector<uint8_t>(pquart_.data_.values.begin(),
+        pquart_.data_.values.begin() + 3), ::testing::ElementsAre(1, 0xFF, 3));
+}
@@ -0,0 +1,231 @@
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "parse_progress.h"
+
+class ParseProgressTest : public ::testing::Test
+{
+   protected:
+    std::chrono::steady_clock::time_point start_;
+
+    ParseProgressTest() : start_(std::chrono::steady_clock::now()) {}
+
+    std::string ReadFile(const ManagedPath& path)
+    {
+        std::stringstream text;
+        std::ifstream file(path.string());
+        text << file.rdbuf();
+        file.close();
+        return text.str();
+    }
+};
+
+TEST_F(ParseProgressTest, SampleNoWorkers)
+{
+    ParseProgress progress(1000, 5000, 10, "");
+    ProgressSample sample = progress.Sample(std::chrono::steady_clock::now());
+    EXPECT_EQ(0, sample.done_bytes);
+    EXPECT_EQ(4000, sample.total_bytes);
+    EXPECT_EQ(0, sample.workers.size());
+    EXPECT_DOUBLE_EQ(-1.0, sample.eta_sec);
+}
+
+TEST_F(ParseProgressTest, SampleEndBeforeBegin)
+{
+    ParseProgress progress(5000, 1000, 10, "");
+    ProgressSample sample = progress.Sample(std::chrono::steady_clock::now());
+    EXPECT_EQ(0, sample.total_bytes);
+    EXPECT_DOUBLE_EQ(0.0, sample.eta_sec);
+}
+
+TEST_F(ParseProgressTest, SampleWorkersClampAndLag)
+{
+    std::atomic<uint64_t> pos0(0);
+    std::atomic<uint64_t> pos1(0);
+    std::atomic<uint64_t> pos2(0);
+    ParseProgress progress(0, 3000000, 10, "");
+    progress.WorkerStarted(0, 0, 1000000, &pos0);
+    progress.WorkerStarted(1, 1000000, 1000000, &pos1);
+    progress.WorkerStarted(2, 2000000, 1000000, &pos2);
+
+    // Worker 0 has read beyond its chunk, worker 1 is partially done
+    // and worker 2 has not initialized its context.
+    pos0.store(1000500);
+    pos1.store(1250000);
+    ProgressSample sample = progress.Sample(std::chrono::steady_clock::now() +
+        std::chrono::seconds(2));
+    ASSERT_EQ(3, sample.workers.size());
+    EXPECT_EQ(1000000, sample.workers[0].done_bytes);
+    EXPECT_EQ(250000, sample.workers[1].done_bytes);
+    EXPECT_EQ(0, sample.workers[2].done_bytes);
+    EXPECT_EQ(0, sample.workers[0].lag_bytes);
+    EXPECT_EQ(750000, sample.workers[1].lag_bytes);
+    EXPECT_EQ(1000000, sample.workers[2].lag_bytes);
+    EXPECT_EQ(1250000, sample.done_bytes);
+    EXPECT_GT(sample.average_mb_per_sec, 0.0);
+    EXPECT_GT(sample.eta_sec, 0.0);
+}
+
+TEST_F(ParseProgressTest, SampleWorkerComplete)
+{
+    std::atomic<uint64_t> pos0(0);
+    std::atomic<uint64_t> pos1(0);
+    ParseProgress progress(0, 2000, 10, "");
+    progress.WorkerStarted(0, 0, 1000, &pos0);
+    progress.WorkerStarted(1, 1000, 1000, &pos1);
+
+    // The context position is not used once complete
+    pos0.store(500);
+    pos1.store(1100);
+    progress.WorkerComplete(0);
+
+    // Unregistered workers are ignored
+    progress.WorkerComplete(7);
+
+    ProgressSample sample = progress.Sample(std::chrono::steady_clock::now() +
+        std::chrono::seconds(1));
+    ASSERT_EQ(2, sample.workers.size());
+    EXPECT_TRUE(sample.workers[0].complete);
+    EXPECT_FALSE(sample.workers[1].complete);
+    EXPECT_EQ(1000, sample.workers[0].done_bytes);
+    EXPECT_EQ(0, sample.workers[0].lag_bytes);
+    EXPECT_EQ(0, sample.workers[1].lag_bytes);
+    EXPECT_EQ(1100, sample.done_bytes);
+
+    progress.WorkerComplete(1);
+    sample = progress.Sample(std::chrono::steady_clock::now() + std::chrono::seconds(2));
+    EXPECT_EQ(2000, sample.done_bytes);
+    EXPECT_DOUBLE_EQ(0.0, sample.eta_sec);
+}
+
+TEST_F(ParseProgressTest, SampleRecentRate)
+{
+    std::atomic<uint64_t> pos0(0);
+    ParseProgress progress(0, 10000000, 10, "");
+    progress.Start();
+    progress.Stop(true);
+    progress.WorkerStarted(0, 0, 10000000, &pos0);
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    pos0.store(2000000);
+    ProgressSample sample = progress.Sample(now + std::chrono::seconds(1000));
+    pos0.store(5000000);
+    sample = progress.Sample(now + std::chrono::seconds(1001));
+
+    // 3 MB in the second since the previous sample
+    EXPECT_NEAR(3.0, sample.mb_per_sec, 1.0e-6);
+    EXPECT_LT(sample.average_mb_per_sec, 1.0);
+}
+
+TEST_F(ParseProgressTest, FormatLog)
+{
+    ProgressSample sample;
+    sample.elapsed_sec = 10.0;
+    sample.done_bytes = 250000000;
+    sample.total_bytes = 1000000000;
+    sample.mb_per_sec = 30.0;
+    sample.average_mb_per_sec = 25.0;
+    sample.eta_sec = 30.0;
+    sample.workers.push_back(WorkerProgress{0, 135000000, 135000000, 13.5, 0, true});
+    sample.workers.push_back(WorkerProgress{1, 115000000, 135000000, 11.5, 0, false});
+    sample.workers.push_back(WorkerProgress{2, 100000000, 135000000, 10.0, 15000000, false});
+
+    EXPECT_EQ("Progress: 25.0% (250.0/1000.0 MB), 30.0 MB/s, ETA 30 s, worker rate/lag: "
+        "01 11.5 MB/s 0.0 MB, 02 10.0 MB/s 15.0 MB", ParseProgress::FormatLog(sample));
+
+    sample.eta_sec = -1.0;
+    sample.workers.clear();
+    EXPECT_EQ("Progress: 25.0% (250.0/1000.0 MB), 30.0 MB/s, ETA unknown",
+        ParseProgress::FormatLog(sample));
+}
+
+TEST_F(ParseProgressTest, FormatJSON)
+{
+    ProgressSample sample;
+    sample.elapsed_sec = 10.0;
+    sample.done_bytes = 250;
+    sample.total_bytes = 1000;
+    sample.mb_per_sec = 1.5;
+    sample.average_mb_per_sec = 1.25;
+    sample.eta_sec = -1.0;
+
+    std::string expected =
+        "{\n"
+        "  \"state\": \"running\",\n"
+        "  \"elapsed_sec\": 10.000,\n"
+        "  \"done_bytes\": 250,\n"
+        "  \"total_bytes\": 1000,\n"
+        "  \"mb_per_sec\": 1.500,\n"
+        "  \"average_mb_per_sec\": 1.250,\n"
+        "  \"eta_sec\": -1.000,\n"
+        "  \"workers\": []\n"
+        "}\n";
+    EXPECT_EQ(expected, ParseProgress::FormatJSON(sample, "running"));
+
+    sample.workers.push_back(WorkerProgress{0, 100, 500, 0.5, 0, true});
+    sample.workers.push_back(WorkerProgress{1, 150, 500, 0.75, 20, false});
+    expected =
+        "{\n"
+        "  \"state\": \"complete\",\n"
+        "  \"elapsed_sec\": 10.000,\n"
+        "  \"done_bytes\": 250,\n"
+        "  \"total_bytes\": 1000,\n"
+        "  \"mb_per_sec\": 1.500,\n"
+        "  \"average_mb_per_sec\": 1.250,\n"
+        "  \"eta_sec\": -1.000,\n"
+        "  \"workers\": [\n"
+        "    {\"worker\": 0, \"done_bytes\": 100, \"chunk_bytes\": 500, \"mb_per_sec\": 0.500, "
+        "\"lag_bytes\": 0, \"complete\": true},\n"
+        "    {\"worker\": 1, \"done_bytes\": 150, \"chunk_bytes\": 500, \"mb_per_sec\": 0.750, "
+        "\"lag_bytes\": 20, \"complete\": false}\n"
+        "  ]\n"
+        "}\n";
+    EXPECT_EQ(expected, ParseProgress::FormatJSON(sample, "complete"));
+}
+
+TEST_F(ParseProgressTest, WriteFile)
+{
+    ManagedPath path(std::string("parse_progress_u_test.json"));
+    ASSERT_EQ(EX_OK, ParseProgress::WriteFile(path, "first"));
+    ASSERT_EQ(EX_OK, ParseProgress::WriteFile(path, "second"));
+    EXPECT_EQ("second", ReadFile(path));
+    EXPECT_FALSE(ManagedPath(path.string() + ".tmp").is_regular_file());
+    path.remove();
+}
+
+TEST_F(ParseProgressTest, WriteFileCantCreate)
+{
+    ManagedPath path(std::string("parse_progress_u_no_such_dir/progress.json"));
+    EXPECT_EQ(EX_CANTCREAT, ParseProgress::WriteFile(path, "text"));
+}
+
+TEST_F(ParseProgressTest, StopWritesFinalState)
+{
+    std::atomic<uint64_t> pos0(0);
+    ManagedPath path(std::string("parse_progress_u_stop.json"));
+    ParseProgress progress(0, 1000, 60, path.RawString());
+    progress.Start();
+    progress.WorkerStarted(0, 0, 1000, &pos0);
+    pos0.store(1000);
+    progress.WorkerComplete(0);
+    progress.Stop(true);
+
+    std::string text = ReadFile(path);
+    EXPECT_THAT(text, ::testing::HasSubstr("\"state\": \"complete\""));
+    EXPECT_THAT(text, ::testing::HasSubstr("\"done_bytes\": 1000,"));
+
+    progress.Start();
+    progress.Stop(false);
+    EXPECT_THAT(ReadFile(path), ::testing::HasSubstr("\"state\": \"failed\""));
+    path.remove();
+}
+
+TEST_F(ParseProgressTest, DestructorStopsThread)
+{
+    ParseProgress* progress = new ParseProgress(0, 1000, 60, "");
+    progress->Start();
+    delete progress;
+}
@@ -1,3 +1,7 @@
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+#include <vector>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "parse_worker.h"
@@ -34,11 +38,69 @@ class ParseWorkerTest : public ::testing::Test
         worker_cfg_.ch10_packet_type_map_[Ch10PacketType::VIDEO_DATA_F0] = false;
         worker_cfg_.ch10_packet_type_map_[Ch10PacketType::ETHERNET_DATA_F0] = false;
         worker_cfg_.ch10_packet_type_map_[Ch10PacketType::ARINC429_F0] = false;
+        worker_cfg_.ch10_packet_type_map_[Ch10PacketType::PCM_F1] = false;
+        worker_cfg_.ch10_packet_type_map_[Ch10PacketType::CAN_BUS] = false;
+        worker_cfg_.ch10_packet_type_map_[Ch10PacketType::ETHERNET_DATA_F1] = false;
+        worker_cfg_.ch10_packet_type_map_[Ch10PacketType::ANALOG_F1] = false;
+        worker_cfg_.ch10_packet_type_map_[Ch10PacketType::MILSTD1553_F2] = false;
+        worker_cfg_.ch10_packet_type_map_[Ch10PacketType::UART_F0] = false;
+        worker_cfg_.ch10_packet_type_map_[Ch10PacketType::MESSAGE_F0] = false;
 
         // Initialize Ch10Context
         ctx_.Initialize(worker_cfg_.start_position_, worker_cfg_.worker_index_);
         ctx_.SetSearchingForTDP(!worker_cfg_.append_mode_);
     }
+
+    // Enable parsing of a single packet type with output to path
+    void EnableOnly(Ch10PacketType pkt_type, const ManagedPath& path)
+    {
+        for (auto& it : worker_cfg_.ch10_packet_type_map_)
+            it.second = (it.first == pkt_type);
+        worker_cfg_.output_file_paths_[pkt_type] = path;
+    }
+
+    // Append a packet with a valid header checksum, without a secondary
+    // header or data checksum, to a buffer of ch10 data.
+    void AppendPacket(std::vector<uint8_t>& buffer, Ch10PacketType pkt_type,
+        uint16_t channel_id, const std::vector<uint8_t>& body)
+    {
+        Ch10PacketHeaderFmt hdr{};
+        hdr.sync = 0xEB25;
+        hdr.chanID = channel_id;
+        hdr.data_size = static_cast<uint32_t>(body.size());
+        hdr.pkt_size = static_cast<uint32_t>(sizeof(Ch10PacketHeaderFmt) + body.size());
+        hdr.data_type = static_cast<uint8_t>(pkt_type);
+
+        uint16_t words[sizeof(Ch10PacketHeaderFmt) / 2];
+        memcpy(words, &hdr, sizeof(Ch10PacketHeaderFmt));
+        uint16_t checksum = 0;
+        for (size_t i = 0; i < sizeof(Ch10PacketHeaderFmt) / 2 - 1; i++)
+            checksum += words[i];
+        hdr.checksum = checksum;
+
+        size_t pos = buffer.size();
+        buffer.resize(pos + sizeof(Ch10PacketHeaderFmt) + body.size());
+        memcpy(buffer.data() + pos, &hdr, sizeof(Ch10PacketHeaderFmt));
+        std::copy(body.cbegin(), body.cend(), buffer.begin() + pos + sizeof(Ch10PacketHeaderFmt));
+    }
+
+    // Parse a buffer of ch10 data as a single call to ParseBufferData. As in
+    // a growing file, the final packet is parsed only if it is followed by
+    // at least one byte.
+    void ParseBuffer(const std::vector<uint8_t>& buffer)
+    {
+        ManagedPath buffer_path = ManagedPath::temp_directory_path() / "parse_worker_buffer.ch10";
+        std::ofstream ofs(buffer_path.string(), std::ios::trunc | std::ios::binary);
+        ofs.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        ofs.close();
+
+        std::ifstream ifs(buffer_path.string(), std::ios::binary);
+        BinBuff bb;
+        ASSERT_EQ(buffer.size(), bb.Initialize(ifs, buffer.size(), 0, buffer.size()));
+        pw_.ParseBufferData(&ctx_, &bb);
+        ifs.close();
+        remove(buffer_path.string().c_str());
+    }
 };
 
 TEST_F(ParseWorkerTest, ConfigureContextSetPacketTypeBadPaths)
@@ -125,3 +187,138 @@ TEST_F(ParseWorkerTest, ConfigureContextNotIfAlreadyConfigured)
     EXPECT_FALSE(ctx_.pkt_type_config_map.at(Ch10PacketType::VIDEO_DATA_F0));
     ctx_.CloseFileWriters();
 }
+
+TEST_F(ParseWorkerTest, ParseBufferDataPcapAcrossBuffers)
+{
+    ManagedPath out_dir = ManagedPath::temp_directory_path() / "parse_worker_pcap_test";
+    std::filesystem::remove_all(out_dir.string());
+    ASSERT_TRUE(out_dir.create_directory());
+    EnableOnly(Ch10PacketType::ETHERNET_DATA_F0, out_dir / "ethernet__000.parquet");
+    ctx_.SetSearchingForTDP(false);
+    ASSERT_EQ(EX_OK, pw_.ConfigureContext(&ctx_, worker_cfg_.ch10_packet_type_map_,
+        worker_cfg_.output_file_paths_));
+
+    // Ethernet II frame with a local experimental ethertype
+    std::vector<uint8_t> frame(60, 0x5A);
+    std::vector<uint8_t> header{0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+                                0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x88, 0xB5};
+    std::copy(header.cbegin(), header.cend(), frame.begin());
+
+    EthernetF0CSDW csdw{};
+    csdw.frame_count = 1;
+    EthernetF0FrameIDWord frame_id{};
+    frame_id.data_length = static_cast<uint32_t>(frame.size());
+
+    // CSDW, intra-packet time stamp, frame ID word and frame
+    std::vector<uint8_t> body(sizeof(EthernetF0CSDW) + 8 + sizeof(EthernetF0FrameIDWord));
+    memcpy(body.data(), &csdw, sizeof(EthernetF0CSDW));
+    memcpy(body.data() + sizeof(EthernetF0CSDW) + 8, &frame_id, sizeof(EthernetF0FrameIDWord));
+    body.insert(body.end(), frame.cbegin(), frame.cend());
+
+    // One frame in each buffer, as in consecutive polls of a growing file
+    for (int poll = 0; poll < 2; poll++)
+    {
+        std::vector<uint8_t> buffer;
+        AppendPacket(buffer, Ch10PacketType::ETHERNET_DATA_F0, 3, body);
+        buffer.push_back(0);
+        ParseBuffer(buffer);
+    }
+    pw_.ReleaseComponents();
+    ctx_.CloseFileWriters();
+
+    // Count the records which follow the 24-byte pcap global header. Each
+    // record header is 16 bytes, including the captured length at byte 8.
+    std::vector<ManagedPath> pcap_paths;
+    for (const auto& entry : std::filesystem::directory_iterator(out_dir.string()))
+    {
+        if (entry.path().extension() == ".pcap")
+            pcap_paths.push_back(ManagedPath(entry.path().string()));
+    }
+    ASSERT_EQ(1, pcap_paths.size());
+
+    std::ifstream ifs(pcap_paths.at(0).string(), std::ios::binary);
+    std::vector<char> pcap((std::istreambuf_iterator<char>(ifs)),
+        std::istreambuf_iterator<char>());
+    ifs.close();
+    size_t record_count = 0;
+    uint32_t captured_length = 0;
+    for (size_t pos = 24; pos + 16 <= pcap.size(); pos += 16 + captured_length)
+    {
+        memcpy(&captured_length, pcap.data() + pos + 8, sizeof(uint32_t));
+        EXPECT_EQ(frame.size(), captured_length);
+        record_count++;
+    }
+    EXPECT_EQ(2, record_count);
+
+    std::filesystem::remove_all(out_dir.string());
+}
+
+TEST_F(ParseWorkerTest, ParseBufferDataPCMThroughputAcrossBuffers)
+{
+    ManagedPath outfile = ManagedPath::temp_directory_path() / "parse_worker_pcmf1.parquet";
+    EnableOnly(Ch10PacketType::PCM_F1, outfile);
+    ctx_.SetSearchingForTDP(false);
+
+    // Four 12-bit words following a 24-bit sync pattern, 72 bits
+    PCMF1FrameFormat frame_format;
+    frame_format.words_per_minor_frame = 4;
+    frame_format.word_bits = 12;
+    frame_format.sync_bits = 24;
+    frame_format.sync_pattern = 0xFAF320;
+    ctx_.SetPCMF1FrameFormat(frame_format);
+    ASSERT_EQ(EX_OK, pw_.ConfigureContext(&ctx_, worker_cfg_.ch10_packet_type_map_,
+        worker_cfg_.output_file_paths_));
+
+    // Three byte-aligned minor frames in which each pair of words
+    // occupies three bytes, followed by a byte of fill
+    std::vector<uint8_t> stream;
+    for (uint32_t frame = 0; frame < 3; frame++)
+    {
+        stream.insert(stream.end(), {0xFA, 0xF3, 0x20});
+        for (uint32_t word = 0; word < 4; word += 2)
+        {
+            uint32_t first = frame * 0x100 + word;
+            uint32_t second = first + 1;
+            stream.push_back(static_cast<uint8_t>(first >> 4));
+            stream.push_back(static_cast<uint8_t>(((first & 0xF) << 4) | (second >> 8)));
+            stream.push_back(static_cast<uint8_t>(second & 0xFF));
+        }
+    }
+    stream.push_back(0);
+
+    // Recorded in 16-bit words, split between packets in two buffers such
+    // that the second minor frame spans both.
+    std::vector<uint8_t> recorded(stream.size());
+    Ch10PCMF1Component::CopyToBitStream(stream.data(), stream.size(), false, recorded.data());
+    PCMF1CSDWFmt csdw{};
+    csdw.THR = 1;
+
+    size_t split = 14;
+    for (int poll = 0; poll < 2; poll++)
+    {
+        std::vector<uint8_t> body(sizeof(PCMF1CSDWFmt));
+        memcpy(body.data(), &csdw, sizeof(PCMF1CSDWFmt));
+        if (poll == 0)
+            body.insert(body.end(), recorded.cbegin(), recorded.cbegin() + split);
+        else
+            body.insert(body.end(), recorded.cbegin() + split, recorded.cend());
+
+        std::vector<uint8_t> buffer;
+        AppendPacket(buffer, Ch10PacketType::PCM_F1, 7, body);
+        buffer.push_back(0);
+        ParseBuffer(buffer);
+    }
+
+    const ParquetPCMF1* writer = ctx_.pcmf1_pq_writer;
+    ASSERT_TRUE(writer != nullptr);
+    for (uint32_t frame = 0; frame < 3; frame++)
+    {
+        for (uint32_t word = 0; word < 4; word++)
+            EXPECT_EQ(frame * 0x100 + word, writer->words_[frame * 4 + word]);
+    }
+    EXPECT_EQ(0, ctx_.diagnostics.GetCount("pcmf1_sync_loss"));
+
+    pw_.ReleaseComponents();
+    ctx_.CloseFileWriters();
+    remove(outfile.string().c_str());
+}
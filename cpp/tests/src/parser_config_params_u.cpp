@@ -123,4 +123,31 @@ TEST_F(ParserConfigParamsTest, EqualityOperatorTrue)
     conf_test.ch10_packet_type_map_ = conf.ch10_packet_type_map_;
 
     ASSERT_TRUE(conf==conf_test);
-}
\ No newline at end of file
+}
+
+TEST_F(ParserConfigParamsTest, MakePCMF1FrameFormat)
+{
+    ParserConfigParams conf;
+    conf.pcm_words_ = 64;
+    conf.pcm_word_bits_ = 12;
+    conf.pcm_sync_bits_ = 24;
+    conf.pcm_sync_pattern_str_ = "faf320";
+
+    PCMF1FrameFormat frame_format;
+    ASSERT_TRUE(conf.MakePCMF1FrameFormat(frame_format));
+    EXPECT_EQ(64, frame_format.words_per_minor_frame);
+    EXPECT_EQ(12, frame_format.word_bits);
+    EXPECT_EQ(24, frame_format.sync_bits);
+    EXPECT_EQ(0xFAF320, frame_format.sync_pattern);
+
+    // Pattern has more bits than the sync pattern bit count
+    conf.pcm_sync_pattern_str_ = "FE6B2840";
+    EXPECT_FALSE(conf.MakePCMF1FrameFormat(frame_format));
+
+    conf.pcm_sync_pattern_str_ = "FAF32G";
+    EXPECT_FALSE(conf.MakePCMF1FrameFormat(frame_format));
+
+    conf.pcm_sync_pattern_str_ = "FAF320";
+    conf.pcm_word_bits_ = 33;
+    EXPECT_FALSE(conf.MakePCMF1FrameFormat(frame_format));
+}
@@ -733,4 +733,22 @@ TEST_F(ParserMetadataTest, AssembleParsedPacketTypesSet)
     pf_.AssembleParsedPacketTypesSet(ctx_vec, parsed_packet_types);
 
     EXPECT_THAT(expected_parsed_packet_types, ::testing::ContainerEq(parsed_packet_types));
-}
\ No newline at end of file
+}
+
+TEST_F(ParserMetadataTest, AssembleDiagnostics)
+{
+    Ch10Context ctx1(1000, 0);
+    Ch10Context ctx2(5000, 1);
+    std::vector<const Ch10Context*> ctx_vec{&ctx1, &ctx2};
+
+    EXPECT_TRUE(ctx1.RecordDiagnostic("bad_sync"));
+    EXPECT_TRUE(ctx2.RecordDiagnostic("bad_sync"));
+    EXPECT_TRUE(ctx2.RecordDiagnostic("ethernetf0_frame_count"));
+
+    Diagnostics diagnostics;
+    pf_.AssembleDiagnostics(ctx_vec, diagnostics);
+    EXPECT_EQ(2, diagnostics.GetCount("bad_sync"));
+    EXPECT_EQ(1, diagnostics.GetCount("ethernetf0_frame_count"));
+    EXPECT_THAT(diagnostics.GetExemplarOffsets().at("bad_sync"), 
+        ::testing::ElementsAre(1000, 5000));
+}
@@ -0,0 +1,138 @@
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "pcm_frame_sync.h"
+
+class PCMFrameSyncTest : public ::testing::Test
+{
+   protected:
+    std::vector<uint8_t> data_;
+    std::vector<ChecksumKernels::ISA> isas_;
+
+    PCMFrameSyncTest() : data_(512), isas_{ChecksumKernels::ISA::SCALAR,
+        ChecksumKernels::ISA::SSE2, ChecksumKernels::ISA::AVX2}
+    {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> dist(0, 255);
+        for (size_t i = 0; i < data_.size(); i++)
+            data_[i] = static_cast<uint8_t>(dist(generator));
+    }
+
+    // Write the bit_count least significant bits of value, MSB first,
+    // beginning at bit_pos.
+    void WriteBits(std::vector<uint8_t>& data, uint64_t bit_pos, uint64_t value,
+        uint32_t bit_count)
+    {
+        for (uint32_t i = 0; i < bit_count; i++)
+        {
+            uint64_t pos = bit_pos + i;
+            uint8_t mask = static_cast<uint8_t>(0x80 >> (pos % 8));
+            if ((value >> (bit_count - 1 - i)) & 1)
+                data[pos / 8] |= mask;
+            else
+                data[pos / 8] &= static_cast<uint8_t>(~mask);
+        }
+    }
+
+    // Exhaustive search for the first match at or after begin_bit
+    uint64_t FindReference(const std::vector<uint8_t>& data, uint64_t pattern,
+        uint32_t pattern_bits, uint64_t begin_bit)
+    {
+        uint64_t total_bits = static_cast<uint64_t>(data.size()) * 8;
+        for (uint64_t pos = begin_bit; pos + pattern_bits <= total_bits; pos++)
+        {
+            if (PCMFrameSync::ReadBits(data.data(), pos, pattern_bits) == pattern)
+                return pos;
+        }
+        return PCMFrameSync::npos;
+    }
+};
+
+TEST_F(PCMFrameSyncTest, ConfigureRejectsInvalidPattern)
+{
+    PCMFrameSync sync;
+    EXPECT_FALSE(sync.Configure(0xFE6B, 15));
+    EXPECT_FALSE(sync.Configure(0xFE6B, 65));
+
+    // Pattern has more bits than pattern_bits
+    EXPECT_FALSE(sync.Configure(0x1FE6B, 16));
+    EXPECT_EQ(0, sync.GetPatternBits());
+
+    EXPECT_TRUE(sync.Configure(0xFE6B2840, 32));
+    EXPECT_EQ(32, sync.GetPatternBits());
+}
+
+TEST_F(PCMFrameSyncTest, ReadBits)
+{
+    std::vector<uint8_t> data{0xFE, 0x6B, 0x28, 0x40, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC};
+    EXPECT_EQ(0xFE6B2840, PCMFrameSync::ReadBits(data.data(), 0, 32));
+    EXPECT_EQ(0x7, PCMFrameSync::ReadBits(data.data(), 0, 3));
+    EXPECT_EQ(0x35, PCMFrameSync::ReadBits(data.data(), 9, 6));
+    EXPECT_EQ(0xE6B28401234567ULL, PCMFrameSync::ReadBits(data.data(), 4, 56));
+    EXPECT_EQ(0xFE6B284012345678ULL, PCMFrameSync::ReadBits(data.data(), 0, 64));
+
+    EXPECT_EQ(0x1A2B3C4DULL, PCMFrameSync::ReadBits(data.data(), 39, 32));
+
+    // Nine-byte span
+    EXPECT_EQ(0xE6B2840123456789ULL, PCMFrameSync::ReadBits(data.data(), 4, 64));
+}
+
+TEST_F(PCMFrameSyncTest, MatchBounds)
+{
+    PCMFrameSync sync;
+    std::vector<uint8_t> data(8, 0);
+    EXPECT_FALSE(sync.Match(data.data(), data.size(), 0));
+
+    ASSERT_TRUE(sync.Configure(0xFE6B2840, 32));
+    WriteBits(data, 13, 0xFE6B2840, 32);
+    EXPECT_TRUE(sync.Match(data.data(), data.size(), 13));
+    EXPECT_FALSE(sync.Match(data.data(), data.size(), 12));
+    EXPECT_FALSE(sync.Match(data.data(), data.size(), 33));
+}
+
+TEST_F(PCMFrameSyncTest, FindAllBitOffsets)
+{
+    std::vector<uint64_t> patterns{0xFE6B, 0xFE6B2840, 0xFAF320, 0xFE6B2840FE6B2840ULL};
+    std::vector<uint32_t> pattern_bits{16, 32, 24, 64};
+    for (size_t p = 0; p < patterns.size(); p++)
+    {
+        for (uint64_t pos = 0; pos < 80; pos += 7)
+        {
+            std::vector<uint8_t> data = data_;
+            uint64_t insert_pos = data.size() * 8 - pattern_bits[p] - pos;
+            WriteBits(data, insert_pos, patterns[p], pattern_bits[p]);
+            uint64_t expected = FindReference(data, patterns[p], pattern_bits[p], 0);
+            ASSERT_NE(PCMFrameSync::npos, expected);
+            for (size_t k = 0; k < isas_.size(); k++)
+            {
+                PCMFrameSync sync;
+                ASSERT_TRUE(sync.Configure(patterns[p], pattern_bits[p], isas_[k]));
+                EXPECT_EQ(expected, sync.Find(data.data(), data.size(), 0));
+                EXPECT_EQ(FindReference(data, patterns[p], pattern_bits[p], expected + 1),
+                    sync.Find(data.data(), data.size(), expected + 1));
+            }
+        }
+    }
+}
+
+TEST_F(PCMFrameSyncTest, FindNoMatch)
+{
+    std::vector<uint8_t> data(300, 0x55);
+    for (size_t k = 0; k < isas_.size(); k++)
+    {
+        PCMFrameSync sync;
+        ASSERT_TRUE(sync.Configure(0xFE6B2840, 32, isas_[k]));
+        EXPECT_EQ(PCMFrameSync::npos, sync.Find(data.data(), data.size(), 0));
+
+        // Match which ends at the last bit
+        WriteBits(data, data.size() * 8 - 32, 0xFE6B2840, 32);
+        EXPECT_EQ(data.size() * 8 - 32, sync.Find(data.data(), data.size(), 0));
+        EXPECT_EQ(PCMFrameSync::npos, sync.Find(data.data(), data.size(),
+            data.size() * 8 - 31));
+        std::fill(data.begin(), data.end(), 0x55);
+
+        // Too few bytes for the pattern
+        EXPECT_EQ(PCMFrameSync::npos, sync.Find(data.data(), 3, 0));
+    }
+}
@@ -0,0 +1,259 @@
+#include <fstream>
+#include <sstream>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "perf_stats.h"
+
+TEST(StageTimerTest, StartStopAccumulates)
+{
+    StageTimer timer;
+    EXPECT_EQ(0, timer.GetElapsedNs());
+
+    timer.Add(100);
+    EXPECT_EQ(100, timer.GetElapsedNs());
+
+    timer.Start();
+    timer.Stop();
+    EXPECT_GE(timer.GetElapsedNs(), 100);
+}
+
+TEST(SampledStageTimerTest, TimesOneOfEveryInterval)
+{
+    SampledStageTimer timer(4);
+    EXPECT_EQ(0, timer.GetElapsedNs());
+
+    for (int i = 0; i < 10; i++)
+    {
+        timer.Start();
+        timer.Stop();
+    }
+    EXPECT_EQ(10, timer.GetCallCount());
+
+    // Calls 0, 4 and 8 are timed
+    EXPECT_EQ(3, timer.GetSampleCount());
+}
+
+TEST(SampledStageTimerTest, GetElapsedNsScalesByCallCount)
+{
+    SampledStageTimer timer(4);
+    timer.Add(300);
+    EXPECT_EQ(300, timer.GetElapsedNs());
+
+    for (int i = 0; i < 8; i++)
+    {
+        timer.Start();
+        timer.Stop();
+    }
+
+    // Two of eight calls are timed, the estimate is at least four
+    // times the added time.
+    EXPECT_GE(timer.GetElapsedNs(), 1200);
+}
+
+TEST(SampledStageTimerTest, ZeroIntervalTimesEveryCall)
+{
+    SampledStageTimer timer(0);
+    timer.Start();
+    timer.Stop();
+    timer.Start();
+    timer.Stop();
+    EXPECT_EQ(2, timer.GetSampleCount());
+}
+
+TEST(PerfStatsTest, AddAndGet)
+{
+    PerfStats stats;
+    EXPECT_TRUE(stats.IsEmpty());
+    EXPECT_EQ(0, stats.GetCount("packets"));
+    EXPECT_EQ(0, stats.GetTimeNs("read"));
+
+    stats.AddCount("packets", 10);
+    stats.AddCount("packets", 5);
+    stats.AddTime("read", 2500000000);
+    EXPECT_FALSE(stats.IsEmpty());
+    EXPECT_EQ(15, stats.GetCount("packets"));
+    EXPECT_EQ(2500000000, stats.GetTimeNs("read"));
+
+    std::map<std::string, double> times_sec = stats.GetTimesSec();
+    ASSERT_EQ(1, times_sec.count("read"));
+    EXPECT_DOUBLE_EQ(2.5, times_sec.at("read"));
+}
+
+TEST(PerfStatsTest, Merge)
+{
+    PerfStats a;
+    a.AddCount("packets", 10);
+    a.AddTime("read", 100);
+
+    PerfStats b;
+    b.AddCount("packets", 3);
+    b.AddCount("bytes", 7);
+    b.AddTime("write", 50);
+
+    a.Merge(b);
+    EXPECT_EQ(13, a.GetCount("packets"));
+    EXPECT_EQ(7, a.GetCount("bytes"));
+    EXPECT_EQ(100, a.GetTimeNs("read"));
+    EXPECT_EQ(50, a.GetTimeNs("write"));
+}
+
+TEST(PerfReportTest, AddWorkerSumsTotal)
+{
+    PerfStats a;
+    a.AddCount("packets", 10);
+    PerfStats b;
+    b.AddCount("packets", 4);
+    b.AddTime("read", 1000000000);
+
+    PerfReport report;
+    report.AddWorker("00", a);
+    report.AddWorker("01", b);
+    report.AddWorker("01", a);
+
+    EXPECT_EQ(24, report.GetTotal().GetCount("packets"));
+    ASSERT_EQ(2, report.GetWorkers().size());
+    EXPECT_EQ(10, report.GetWorkers().at("00").GetCount("packets"));
+    EXPECT_EQ(14, report.GetWorkers().at("01").GetCount("packets"));
+
+    std::map<std::string, std::map<std::string, uint64_t>> counts = report.GetWorkerCounts();
+    EXPECT_EQ(14, counts.at("01").at("packets"));
+    std::map<std::string, std::map<std::string, double>> times = report.GetWorkerTimesSec();
+    EXPECT_DOUBLE_EQ(1.0, times.at("01").at("read"));
+    EXPECT_EQ(0, times.at("00").size());
+}
+
+TEST(PerfReportTest, SanitizeMetricName)
+{
+    EXPECT_EQ("tip_parse_packets_total", PerfReport::SanitizeMetricName("tip_parse_packets_total"));
+    EXPECT_EQ("a_b_c", PerfReport::SanitizeMetricName("a-b.c"));
+    EXPECT_EQ("_abc", PerfReport::SanitizeMetricName("1abc"));
+    EXPECT_EQ("a1:b", PerfReport::SanitizeMetricName("a1:b"));
+}
+
+TEST(PerfReportTest, EscapeString)
+{
+    EXPECT_EQ("abc", PerfReport::EscapeString("abc"));
+    EXPECT_EQ("a\\\"b\\\\c\\n", PerfReport::EscapeString("a\"b\\c\n"));
+}
+
+TEST(PerfReportTest, FormatJSON)
+{
+    PerfStats stats;
+    stats.AddCount("packets", 2);
+    stats.AddTime("read", 500000000);
+    PerfReport report;
+    report.AddWorker("00", stats);
+
+    std::string expected =
+        "{\n"
+        "  \"input\": \"file.ch10\",\n"
+        "  \"total\": {\n"
+        "    \"counts\": {\n"
+        "      \"packets\": 2\n"
+        "    },\n"
+        "    \"times_sec\": {\n"
+        "      \"read\": 0.500000000\n"
+        "    }\n"
+        "  },\n"
+        "  \"workers\": {\n"
+        "    \"00\": {\n"
+        "      \"counts\": {\n"
+        "        \"packets\": 2\n"
+        "      },\n"
+        "      \"times_sec\": {\n"
+        "        \"read\": 0.500000000\n"
+        "      }\n"
+        "    }\n"
+        "  }\n"
+        "}\n";
+    EXPECT_EQ(expected, report.FormatJSON({{"input", "file.ch10"}}));
+}
+
+TEST(PerfReportTest, FormatJSONEmpty)
+{
+    PerfReport report;
+    std::string expected =
+        "{\n"
+        "  \"total\": {\n"
+        "    \"counts\": {},\n"
+        "    \"times_sec\": {}\n"
+        "  },\n"
+        "  \"workers\": {}\n"
+        "}\n";
+    EXPECT_EQ(expected, report.FormatJSON({}));
+}
+
+TEST(PerfReportTest, FormatPrometheus)
+{
+    PerfStats a;
+    a.AddCount("packets", 2);
+    a.AddTime("read", 250000000);
+    PerfStats b;
+    b.AddCount("packets", 3);
+    PerfReport report;
+    report.AddWorker("00", a);
+    report.AddWorker("01", b);
+
+    std::string expected =
+        "# TYPE tip_parse_packets_total counter\n"
+        "tip_parse_packets_total{input=\"file.ch10\",worker=\"00\"} 2\n"
+        "tip_parse_packets_total{input=\"file.ch10\",worker=\"01\"} 3\n"
+        "# TYPE tip_parse_read_seconds_total counter\n"
+        "tip_parse_read_seconds_total{input=\"file.ch10\",worker=\"00\"} 0.250000000\n";
+    EXPECT_EQ(expected, report.FormatPrometheus("tip_parse", {{"input", "file.ch10"}}));
+}
+
+TEST(PerfReportTest, IsSupportedPath)
+{
+    EXPECT_TRUE(PerfReport::IsSupportedPath(ManagedPath(std::string("stats.json"))));
+    EXPECT_TRUE(PerfReport::IsSupportedPath(ManagedPath(std::string("stats.prom"))));
+    EXPECT_FALSE(PerfReport::IsSupportedPath(ManagedPath(std::string("stats.txt"))));
+    EXPECT_FALSE(PerfReport::IsSupportedPath(ManagedPath(std::string("stats"))));
+}
+
+TEST(PerfReportTest, WriteUnsupportedExtension)
+{
+    PerfReport report;
+    ManagedPath path(std::string("perf_stats_u_test.txt"));
+    EXPECT_EQ(EX_USAGE, report.Write(path, "tip_parse", {}));
+    EXPECT_FALSE(path.is_regular_file());
+}
+
+TEST(PerfReportTest, WriteCantCreate)
+{
+    PerfReport report;
+    ManagedPath path(std::string("perf_stats_u_no_such_dir/stats.json"));
+    EXPECT_EQ(EX_CANTCREAT, report.Write(path, "tip_parse", {}));
+}
+
+TEST(PerfReportTest, Write)
+{
+    PerfStats stats;
+    stats.AddCount("packets", 2);
+    PerfReport report;
+    report.AddWorker("00", stats);
+
+    std::map<std::string, std::string> labels{{"input", "file.ch10"}};
+    ManagedPath json_path(std::string("perf_stats_u_test.json"));
+    ManagedPath prom_path(std::string("perf_stats_u_test.prom"));
+    ASSERT_EQ(EX_OK, report.Write(json_path, "tip_parse", labels));
+    ASSERT_EQ(EX_OK, report.Write(prom_path, "tip_parse", labels));
+
+    std::stringstream json_text;
+    std::ifstream json_file(json_path.string());
+    json_text << json_file.rdbuf();
+    json_file.close();
+    EXPECT_EQ(report.FormatJSON(labels), json_text.str());
+
+    std::stringstream prom_text;
+    std::ifstream prom_file(prom_path.string());
+    prom_text << prom_file.rdbuf();
+    prom_file.close();
+    EXPECT_EQ(report.FormatPrometheus("tip_parse", labels), prom_text.str());
+
+    // Temporary files are renamed
+    EXPECT_FALSE(ManagedPath(json_path.string() + ".tmp").is_regular_file());
+
+    json_path.remove();
+    prom_path.remove();
+}
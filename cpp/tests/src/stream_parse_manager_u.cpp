@@ -0,0 +1,139 @@
+#include <fstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "stream_parse_manager.h"
+#include "parser_config_params.h"
+#include "managed_path.h"
+
+class StreamParseManagerTest : public ::testing::Test
+{
+   protected:
+    StreamParseManager spm_;
+    ParserConfigParams config_;
+    std::string stream_dir_;
+    ManagedPath input_path_;
+    ManagedPath output_dir_;
+    bool progress_;
+
+    StreamParseManagerTest() : spm_(), config_(), stream_dir_("stream_parse_test_dir"),
+        progress_(false)
+    {
+        std::filesystem::create_directory(stream_dir_);
+        input_path_ = ManagedPath(std::string(stream_dir_)) / std::string("growing.ch10");
+        output_dir_ = ManagedPath(std::string(stream_dir_));
+        std::ofstream ofs(input_path_.string(), std::ios::trunc | std::ios::binary);
+        ofs.close();
+
+        config_.parse_chunk_bytes_ = 135;
+        config_.stream_poll_ms_ = 1;
+        config_.stream_commit_sec_ = 1;
+        config_.stream_idle_timeout_sec_ = 1;
+        config_.MakeCh10PacketEnabledMap();
+    }
+
+    ~StreamParseManagerTest()
+    {
+        std::filesystem::remove_all(stream_dir_);
+    }
+
+    // Append bytes which do not contain a ch10 sync pattern
+    void AppendBytes(size_t count)
+    {
+        std::ofstream ofs(input_path_.string(), std::ios::app | std::ios::binary);
+        std::vector<char> data(count, 0);
+        ofs.write(data.data(), data.size());
+        ofs.close();
+    }
+};
+
+TEST_F(StreamParseManagerTest, NotConfigured)
+{
+    EXPECT_EQ(EX_SOFTWARE, spm_.Poll(progress_));
+    EXPECT_FALSE(progress_);
+    EXPECT_EQ(EX_SOFTWARE, spm_.Commit());
+    EXPECT_EQ(EX_SOFTWARE, spm_.Finalize());
+}
+
+TEST_F(StreamParseManagerTest, ConfigureInputNotExist)
+{
+    ManagedPath input = output_dir_ / std::string("not_here.ch10");
+    EXPECT_EQ(EX_IOERR, spm_.Configure(input, output_dir_, config_));
+}
+
+TEST_F(StreamParseManagerTest, PollEmptyFile)
+{
+    ASSERT_EQ(EX_OK, spm_.Configure(input_path_, output_dir_, config_));
+    EXPECT_EQ(EX_OK, spm_.Poll(progress_));
+    EXPECT_FALSE(progress_);
+    EXPECT_EQ(0, spm_.file_size);
+    EXPECT_EQ(0, spm_.parsed_position);
+}
+
+TEST_F(StreamParseManagerTest, PollParsesAppendedBytes)
+{
+    ASSERT_EQ(EX_OK, spm_.Configure(input_path_, output_dir_, config_));
+
+    AppendBytes(1000);
+    EXPECT_EQ(EX_OK, spm_.Poll(progress_));
+    EXPECT_TRUE(progress_);
+    EXPECT_EQ(1000, spm_.file_size);
+
+    // Bytes which can't contain a complete header remain unparsed
+    uint64_t position = spm_.parsed_position;
+    EXPECT_GT(position, 0);
+    EXPECT_LT(position, 1000);
+
+    // No new data
+    EXPECT_EQ(EX_OK, spm_.Poll(progress_));
+    EXPECT_FALSE(progress_);
+    EXPECT_EQ(position, spm_.parsed_position);
+
+    // Parsing resumes at the previous position
+    AppendBytes(1000);
+    EXPECT_EQ(EX_OK, spm_.Poll(progress_));
+    EXPECT_TRUE(progress_);
+    EXPECT_EQ(2000, spm_.file_size);
+    EXPECT_EQ(position + 1000, spm_.parsed_position);
+}
+
+TEST_F(StreamParseManagerTest, PollTruncatedFile)
+{
+    ASSERT_EQ(EX_OK, spm_.Configure(input_path_, output_dir_, config_));
+    AppendBytes(1000);
+    EXPECT_EQ(EX_OK, spm_.Poll(progress_));
+
+    std::ofstream ofs(input_path_.string(), std::ios::trunc | std::ios::binary);
+    ofs.close();
+    EXPECT_EQ(EX_DATAERR, spm_.Poll(progress_));
+}
+
+TEST_F(StreamParseManagerTest, CommitOnlyAfterProgress)
+{
+    ASSERT_EQ(EX_OK, spm_.Configure(input_path_, output_dir_, config_));
+    EXPECT_EQ(EX_OK, spm_.Commit());
+    EXPECT_EQ(0, spm_.file_index);
+
+    AppendBytes(1000);
+    EXPECT_EQ(EX_OK, spm_.Poll(progress_));
+    EXPECT_EQ(EX_OK, spm_.Commit());
+    EXPECT_EQ(1, spm_.file_index);
+
+    EXPECT_EQ(EX_OK, spm_.Commit());
+    EXPECT_EQ(1, spm_.file_index);
+}
+
+TEST_F(StreamParseManagerTest, IndexedFileNames)
+{
+    ParserPaths paths;
+    std::map<Ch10PacketType, ManagedPath> dir_map{
+        {Ch10PacketType::MILSTD1553_F1, ManagedPath(std::string("a"))}};
+    std::map<Ch10PacketType, ManagedPath> file_map = paths.CreateCh10PacketIndexedFileNames(
+        12, dir_map, "parquet", StreamParseManager::output_file_index_width_);
+    ASSERT_EQ(1, file_map.size());
+    EXPECT_EQ("000012.parquet", file_map.at(Ch10PacketType::MILSTD1553_F1).filename().string());
+}
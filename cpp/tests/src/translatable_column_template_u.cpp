@@ -160,6 +160,29 @@ TEST_F(TranslatableColumnTemplateTest, AppendRawDataInsufficientDestVectorSize)
     EXPECT_FALSE(result_);
 }
 
+TEST_F(TranslatableColumnTemplateTest, AppendRawDataRecordsDiagnostics)
+{
+    arrow_type_ = arrow::float32();
+    name_ = "col1";
+    icd_elem_.elem_word_count_ = 2;
+    bool ridealong = false;
+    icd_elem_.offset_ = 3;
+    TranslatableColumnTemplate<uint16_t, int32_t> col;
+    result_ = col.Configure(name_, ridealong, arrow_type_, row_group_size_, icd_elem_, thread_index_);
+    EXPECT_TRUE(result_);
+    EXPECT_TRUE(col.GetDiagnostics().IsEmpty());
+
+    // offset_ + words_per_value_ > count. The failed append is counted
+    // toward the row index, such that exemplars identify each row.
+    size_t count = 4;
+    EXPECT_FALSE(col.AppendRawData(data_, count));
+    EXPECT_FALSE(col.AppendRawData(data_, count));
+    EXPECT_FALSE(col.AppendRawData(data_, count));
+    EXPECT_EQ(3, col.GetDiagnostics().GetCount("insufficient_raw_data"));
+    EXPECT_THAT(col.GetDiagnostics().GetExemplarOffsets().at("insufficient_raw_data"),
+        ::testing::ElementsAre(0, 1, 2));
+}
+
 TEST_F(TranslatableColumnTemplateTest, AppendRawData)
 {
     // Configure ridealong column
@@ -233,4 +233,19 @@ TEST_F(TranslateTabularARINC429MainTest, IngestICDSuccess)
     ASSERT_TRUE(IngestICD(&mock_dts429_, &mock_org_429_, mock_data_429_,
         icd_lines_, arinc_message_count_, parser_md_node_, subchan_name_lookup_misses_));
 
-}
\ No newline at end of file
+}
+
+TEST_F(TranslateTabularARINC429MainTest, IngestICDCachedWordElementsSkipsIngestLines)
+{
+    // Word elements restored from the DTS cache are organized
+    // without ingesting the DTS lines.
+    std::unordered_map<std::string, std::vector<ICDElement>> word_elements;
+    word_elements["TestWord"] = std::vector<ICDElement>(1);
+
+    EXPECT_CALL(mock_dts429_, IngestLines(_, _)).Times(Exactly(0));
+    EXPECT_CALL(mock_org_429_, OrganizeICDMap(_,_,organized_lookup_map_,_)).WillOnce(Return(true));
+
+    ASSERT_TRUE(IngestICD(&mock_dts429_, &mock_org_429_, mock_data_429_,
+        icd_lines_, arinc_message_count_, parser_md_node_, subchan_name_lookup_misses_,
+        &word_elements));
+}
@@ -28,6 +28,18 @@ TEST_F(TranslateTabularContext1553Test, Clone)
     EXPECT_THAT(data_col_names, ctx->data_col_names);
 }
 
+TEST_F(TranslateTabularContext1553Test, CloneSharesICDData)
+{
+    std::vector<std::string> data_col_names{"a", "b"};
+    std::vector<std::string> ridealong_col_names;
+    context_.SetColumnNames(ridealong_col_names, data_col_names);
+    std::shared_ptr<TranslateTabularContextBase> ctx = context_.Clone();
+    std::shared_ptr<TranslateTabularContext1553> ctx1553 =
+        std::dynamic_pointer_cast<TranslateTabularContext1553>(ctx);
+    ASSERT_TRUE(ctx1553 != nullptr);
+    EXPECT_EQ(context_.GetICDData().get(), ctx1553->GetICDData().get());
+}
+
 TEST_F(TranslateTabularContext1553Test, IsSelectedMessageNotEnabled)
 {
     bool should_select_msg = false;
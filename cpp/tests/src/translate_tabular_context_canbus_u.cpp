@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "translate_tabular_context_canbus.h"
+
+class TranslateTabularContextCANBusTest : public ::testing::Test
+{
+   protected:
+    CANBusData can_data_;
+
+    TranslateTabularContextCANBusTest() : can_data_()
+    {
+        std::vector<CANBusMsgDef> defs(2);
+        defs[0].name = "engine";
+        defs[0].channel_id = 3;
+        defs[0].can_id = 0x100;
+        defs[1].name = "brakes";
+        defs[1].channel_id = 3;
+        defs[1].can_id = 0x101;
+        can_data_.Initialize(defs);
+    }
+};
+
+TEST_F(TranslateTabularContextCANBusTest, CloneSharesCANBusData)
+{
+    TranslateTabularContextCANBus context(can_data_, std::set<std::string>{"brakes"});
+    std::vector<std::string> data_col_names{"time", "channelid", "id", "IDE", "data"};
+    std::vector<std::string> ridealong_col_names{"time"};
+    context.SetColumnNames(ridealong_col_names, data_col_names);
+    ASSERT_TRUE(context.IsConfigured());
+
+    std::shared_ptr<TranslateTabularContextBase> ctx = context.Clone();
+    ASSERT_TRUE(ctx->IsConfigured());
+    EXPECT_THAT(data_col_names, ctx->data_col_names);
+
+    std::shared_ptr<TranslateTabularContextCANBus> ctx_can =
+        std::dynamic_pointer_cast<TranslateTabularContextCANBus>(ctx);
+    ASSERT_TRUE(ctx_can != nullptr);
+    EXPECT_EQ(&context.GetCANBusData().GetMsgDefs(), &ctx_can->GetCANBusData().GetMsgDefs());
+    EXPECT_THAT(ctx_can->GetSelectedMsgIndices(), ::testing::ElementsAre(1));
+}
+
+TEST_F(TranslateTabularContextCANBusTest, SelectedMsgIndices)
+{
+    TranslateTabularContextCANBus context(can_data_, std::set<std::string>{"engine", "fuel"});
+    EXPECT_THAT(context.GetSelectedMsgIndices(), ::testing::ElementsAre(0));
+
+    TranslateTabularContextCANBus all(can_data_, std::set<std::string>());
+    EXPECT_TRUE(all.GetSelectedMsgIndices().empty());
+}
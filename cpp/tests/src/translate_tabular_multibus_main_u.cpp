@@ -0,0 +1,53 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "translate_tabular_multibus_main.h"
+
+TEST(TranslateTabularMultiBusMainTest, Make429Config)
+{
+    TranslationConfigParams config;
+    config.input_data_path_str_ = "data_1553.parquet";
+    config.input_dts_path_str_ = "dts_1553.yaml";
+    config.output_path_str_ = "out";
+    config.translate_thread_count_ = 3;
+    config.select_specific_messages_ = {"msg1", "msg2"};
+
+    TranslationConfigParams config_429 = transtabmultibus::Make429Config(config,
+        "data_429.parquet", "dts_429.yaml");
+    EXPECT_EQ("data_429.parquet", config_429.input_data_path_str_);
+    EXPECT_EQ("dts_429.yaml", config_429.input_dts_path_str_);
+    EXPECT_EQ("out", config_429.output_path_str_);
+    EXPECT_EQ(3, config_429.translate_thread_count_);
+    EXPECT_TRUE(config_429.select_specific_messages_.empty());
+    EXPECT_EQ("", config_429.perf_stats_path_str_);
+
+    // Shared configuration is unchanged
+    EXPECT_EQ("data_1553.parquet", config.input_data_path_str_);
+    EXPECT_EQ(2, config.select_specific_messages_.size());
+}
+
+TEST(TranslateTabularMultiBusMainTest, MemoryBudgetBytes)
+{
+    EXPECT_EQ(0, transtabmultibus::MemoryBudgetBytes(0));
+    EXPECT_EQ(0, transtabmultibus::MemoryBudgetBytes(-5));
+    EXPECT_EQ(3ULL * 1024 * 1024, transtabmultibus::MemoryBudgetBytes(3));
+    EXPECT_EQ(4096ULL * 1024 * 1024, transtabmultibus::MemoryBudgetBytes(4096));
+}
+
+TEST(TranslateTabularMultiBusMainTest, Make429ConfigPerfStatsPath)
+{
+    TranslationConfigParams config;
+    config.perf_stats_path_str_ = "stats/perf.prom";
+
+    TranslationConfigParams config_429 = transtabmultibus::Make429Config(config,
+        "data_429.parquet", "dts_429.yaml");
+    EXPECT_EQ("stats/perf_arinc429.prom", config_429.perf_stats_path_str_);
+    EXPECT_EQ("stats/perf.prom", config.perf_stats_path_str_);
+}
+
+TEST(TranslateTabularMultiBusMainTest, SuffixPerfStatsPath)
+{
+    EXPECT_EQ("", transtabmultibus::SuffixPerfStatsPath("", "_1553"));
+    EXPECT_EQ("perf_1553.json", transtabmultibus::SuffixPerfStatsPath("perf.json", "_1553"));
+    EXPECT_EQ("a/b/perf_arinc429.prom",
+        transtabmultibus::SuffixPerfStatsPath("a/b/perf.prom", "_arinc429"));
+}
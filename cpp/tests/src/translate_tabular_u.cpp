@@ -1,3 +1,5 @@
+#include <fstream>
+#include <cstdio>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "translate_tabular.h"
@@ -268,4 +270,36 @@ TEST_F(TranslateTabularTest, SetInputFiles)
     ASSERT_TRUE(translate_.file_list.size() == 1);
     EXPECT_EQ(file1.RawString(), translate_.file_list.at(0).RawString());
     EXPECT_TRUE(translate_.is_file_list_valid);
-}
\ No newline at end of file
+}
+
+TEST_F(TranslateTabularTest, CreateManagers)
+{
+    std::vector<std::string> data_col_names{"col1", "col2"};
+    std::vector<std::string> ridealong_col_names;
+    context_->SetColumnNames(ridealong_col_names, data_col_names);
+
+    // Not configured with input files
+    EXPECT_EQ(EX_CONFIG, translate_.CreateManagers(2));
+
+    std::vector<ManagedPath> files;
+    std::vector<std::string> file_names{"translate_tabular_a.parquet", 
+        "translate_tabular_b.parquet", "translate_tabular_c.parquet"};
+    for (size_t i = 0; i < file_names.size(); i++)
+    {
+        std::ofstream(file_names[i]).close();
+        files.push_back(ManagedPath(file_names[i]));
+    }
+    ASSERT_TRUE(translate_.SetInputFiles(files, ".parquet"));
+
+    EXPECT_EQ(EX_OK, translate_.CreateManagers(2));
+    ASSERT_EQ(2, translate_.GetManagers().size());
+    EXPECT_EQ(2, translate_.GetManagers().at(0)->GetInputPaths().size());
+    EXPECT_EQ(1, translate_.GetManagers().at(1)->GetInputPaths().size());
+
+    // Managers are replaced, not appended, and limited by the file count
+    EXPECT_EQ(EX_OK, translate_.CreateManagers(5));
+    EXPECT_EQ(3, translate_.GetManagers().size());
+
+    for (size_t i = 0; i < file_names.size(); i++)
+        std::remove(file_names[i].c_str());
+}
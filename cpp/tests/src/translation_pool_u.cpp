@@ -0,0 +1,192 @@
+#include <atomic>
+#include <fstream>
+#include <filesystem>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "translation_pool.h"
+
+// Count input files consumed by all clones
+class TranslationPoolCountingContext : public TranslateTabularContextBase
+{
+   public:
+    std::shared_ptr<std::atomic<size_t>> consumed_count_;
+
+    TranslationPoolCountingContext() :
+        consumed_count_(std::make_shared<std::atomic<size_t>>(0)) {}
+
+    std::shared_ptr<TranslateTabularContextBase> Clone() override
+    {
+        std::shared_ptr<TranslationPoolCountingContext> temp =
+            std::make_shared<TranslationPoolCountingContext>();
+        temp->SetColumnNames(this->ridealong_col_names_, this->data_col_names_);
+        temp->consumed_count_ = consumed_count_;
+        return temp;
+    }
+
+    TranslateStatus ConsumeFile(const size_t& thread_index) override
+    {
+        (*consumed_count_)++;
+        return TranslateStatus::OK;
+    }
+};
+
+class TranslationPoolTest : public ::testing::Test
+{
+   protected:
+    std::vector<uint64_t> estimates_;
+    std::vector<bool> started_;
+    size_t index_;
+    std::vector<ManagedPath> created_paths_;
+
+    TranslationPoolTest() : index_(0) {}
+
+    ~TranslationPoolTest()
+    {
+        for (size_t i = 0; i < created_paths_.size(); i++)
+            std::filesystem::remove(created_paths_[i].string());
+    }
+
+    ManagedPath CreateFile(const std::string& name, size_t size)
+    {
+        ManagedPath path(name);
+        std::ofstream ofs(path.string(), std::ios::binary | std::ios::trunc);
+        ofs << std::string(size, 'x');
+        ofs.close();
+        created_paths_.push_back(path);
+        return path;
+    }
+};
+
+TEST_F(TranslationPoolTest, ConstructorThreadCountAtLeastOne)
+{
+    TranslationPool pool(0, 100);
+    EXPECT_EQ(1, pool.n_threads);
+    EXPECT_EQ(100, pool.memory_budget);
+}
+
+TEST_F(TranslationPoolTest, SelectWorkNoBudget)
+{
+    estimates_ = {30, 20, 10};
+    started_ = {true, false, false};
+    ASSERT_TRUE(TranslationPool::SelectWork(estimates_, started_, 30, 1, 0, index_));
+    EXPECT_EQ(1, index_);
+
+    started_ = {true, true, true};
+    EXPECT_FALSE(TranslationPool::SelectWork(estimates_, started_, 30, 1, 0, index_));
+}
+
+TEST_F(TranslationPoolTest, SelectWorkLargestWhichFitsBudget)
+{
+    estimates_ = {30, 20, 10};
+    started_ = {true, false, false};
+
+    // 30 running, budget 45: 20 does not fit, 10 does
+    ASSERT_TRUE(TranslationPool::SelectWork(estimates_, started_, 30, 1, 45, index_));
+    EXPECT_EQ(2, index_);
+
+    // Nothing fits
+    EXPECT_FALSE(TranslationPool::SelectWork(estimates_, started_, 40, 2, 45, index_));
+}
+
+TEST_F(TranslationPoolTest, SelectWorkExceedsBudgetNothingRunning)
+{
+    estimates_ = {100, 20};
+    started_ = {false, false};
+
+    // Work larger than the budget starts if nothing is running
+    ASSERT_TRUE(TranslationPool::SelectWork(estimates_, started_, 0, 0, 50, index_));
+    EXPECT_EQ(0, index_);
+
+    // Otherwise it is skipped
+    ASSERT_TRUE(TranslationPool::SelectWork(estimates_, started_, 10, 1, 50, index_));
+    EXPECT_EQ(1, index_);
+}
+
+TEST_F(TranslationPoolTest, EstimateMemory)
+{
+    std::vector<ManagedPath> paths;
+    EXPECT_EQ(0, TranslationPool::EstimateMemory(paths));
+
+    paths.push_back(CreateFile("translation_pool_a.parquet", 10));
+    paths.push_back(CreateFile("translation_pool_b.parquet", 25));
+    paths.push_back(ManagedPath(std::string("translation_pool_not_exist.parquet")));
+    EXPECT_EQ(25, TranslationPool::EstimateMemory(paths));
+}
+
+TEST_F(TranslationPoolTest, TranslateAllTranslatorsShareThreads)
+{
+    std::vector<std::string> ridealong_col_names;
+    std::vector<std::string> data_col_names{"a", "b"};
+
+    std::shared_ptr<TranslationPoolCountingContext> ctx_a =
+        std::make_shared<TranslationPoolCountingContext>();
+    ctx_a->SetColumnNames(ridealong_col_names, data_col_names);
+    std::vector<ManagedPath> files_a{CreateFile("translation_pool_a1.parquet", 10),
+        CreateFile("translation_pool_a2.parquet", 40),
+        CreateFile("translation_pool_a3.parquet", 30)};
+    std::shared_ptr<TranslateTabular> translator_a =
+        std::make_shared<TranslateTabular>(1, ctx_a);
+    ASSERT_TRUE(translator_a->SetInputFiles(files_a, ".parquet"));
+
+    std::shared_ptr<TranslationPoolCountingContext> ctx_b =
+        std::make_shared<TranslationPoolCountingContext>();
+    ctx_b->SetColumnNames(ridealong_col_names, data_col_names);
+    std::vector<ManagedPath> files_b{CreateFile("translation_pool_b1.parquet", 20)};
+    std::shared_ptr<TranslateTabular> translator_b =
+        std::make_shared<TranslateTabular>(1, ctx_b);
+    ASSERT_TRUE(translator_b->SetInputFiles(files_b, ".parquet"));
+
+    // Budget smaller than the largest file
+    TranslationPool pool(2, 35);
+    pool.AddTranslator("a", translator_a);
+    pool.AddTranslator("b", translator_b);
+    EXPECT_EQ(EX_OK, pool.Translate());
+
+    // Managers are created per translator up to the pool thread count
+    EXPECT_EQ(2, translator_a->GetManagers().size());
+    EXPECT_EQ(1, translator_b->GetManagers().size());
+    EXPECT_EQ(3, ctx_a->consumed_count_->load());
+    EXPECT_EQ(1, ctx_b->consumed_count_->load());
+}
+
+TEST_F(TranslationPoolTest, TranslateAssemblePerfReport)
+{
+    std::vector<std::string> ridealong_col_names;
+    std::vector<std::string> data_col_names{"a", "b"};
+
+    std::shared_ptr<TranslationPoolCountingContext> ctx =
+        std::make_shared<TranslationPoolCountingContext>();
+    ctx->SetColumnNames(ridealong_col_names, data_col_names);
+    std::vector<ManagedPath> files{CreateFile("translation_pool_p1.parquet", 10),
+        CreateFile("translation_pool_p2.parquet", 20),
+        CreateFile("translation_pool_p3.parquet", 30)};
+    std::shared_ptr<TranslateTabular> translator = std::make_shared<TranslateTabular>(1, ctx);
+    ASSERT_TRUE(translator->SetInputFiles(files, ".parquet"));
+
+    TranslationPool pool(2, 0);
+    pool.AddTranslator("a", translator);
+    ASSERT_EQ(EX_OK, pool.Translate());
+
+    PerfReport report;
+    translator->AssemblePerfReport(report);
+    EXPECT_EQ(2, report.GetWorkers().size());
+    EXPECT_EQ(1, report.GetWorkers().count("00"));
+    EXPECT_EQ(1, report.GetWorkers().count("01"));
+    EXPECT_EQ(3, report.GetTotal().GetCount("input_files"));
+    EXPECT_EQ(1, report.GetTotal().GetTimesNs().count("consume"));
+}
+
+TEST_F(TranslationPoolTest, TranslateCreateManagersFail)
+{
+    // Translator without input files
+    std::shared_ptr<TranslationPoolCountingContext> ctx =
+        std::make_shared<TranslationPoolCountingContext>();
+    std::vector<std::string> ridealong_col_names;
+    std::vector<std::string> data_col_names{"a", "b"};
+    ctx->SetColumnNames(ridealong_col_names, data_col_names);
+    std::shared_ptr<TranslateTabular> translator = std::make_shared<TranslateTabular>(1, ctx);
+
+    TranslationPool pool(2, 0);
+    pool.AddTranslator("a", translator);
+    EXPECT_EQ(EX_CONFIG, pool.Translate());
+}
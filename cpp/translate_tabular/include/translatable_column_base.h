@@ -10,6 +10,7 @@
 #include "parquet_context.h"
 #include "icd_element.h"
 #include "icd_translate.h"
+#include "diagnostics.h"
 #include "spdlog/spdlog.h"
 
 class TranslatableColumnBase
@@ -57,6 +58,15 @@ class TranslatableColumnBase
     // acted upon.
     size_t thread_index_;
 
+    // Count of rows appended prior to the current row group, such that
+    // the row index of a diagnostic event is row_offset_ plus the append
+    // count of the current row group
+    uint64_t row_offset_;
+
+    // Counts of events which prevented data from being appended, with
+    // the row indices of the first occurrences
+    Diagnostics diagnostics_;
+
    public:
     const std::string& col_name;
     const bool& is_ridealong;
@@ -102,6 +112,9 @@ class TranslatableColumnBase
     */
    virtual const ICDElement& GetICDElement() { return icd_elem_; }
 
+    // Diagnostic events recorded by AppendRawData and AppendRidealongData
+    const Diagnostics& GetDiagnostics() const { return diagnostics_; }
+
     /*
     Get raw data vector size.
 
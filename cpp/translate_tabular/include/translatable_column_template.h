@@ -165,10 +165,13 @@ bool TranslatableColumnTemplate<RawType, TranslatedType>::AppendRawData(
     // Check for sufficient quantity of values in source data.
     if ((payload_offset_ + words_per_translated_value_) > count)
     {
-        SPDLOG_WARN(
-            "{:02d} Column {:s}: Insufficient raw data count ({:d}) given "
-            "payload offset ({:d}) and raw words per translated value ({:d})",
-            thread_index_, col_name_, count, payload_offset_, words_per_translated_value_);
+        if (diagnostics_.Record("insufficient_raw_data", row_offset_ + raw_data_append_count_))
+        {
+            SPDLOG_WARN(
+                "{:02d} Column {:s}: Insufficient raw data count ({:d}) given "
+                "payload offset ({:d}) and raw words per translated value ({:d})",
+                thread_index_, col_name_, count, payload_offset_, words_per_translated_value_);
+        }
 
         // Increment the append count because data should have been added
         // for the current data set (via data ptr). We want the added
@@ -181,22 +184,28 @@ bool TranslatableColumnTemplate<RawType, TranslatedType>::AppendRawData(
     // in raw_data_ vector has been allocated.
     if (raw_data_.size() == 0)
     {
-        SPDLOG_WARN(
-            "{:02d} Column {:s}: raw_data_ vector size is 0. This column "
-            "has not been configured. See Configure()",
-            thread_index_, col_name_);
+        if (diagnostics_.Record("raw_data_not_configured", row_offset_ + raw_data_append_count_))
+        {
+            SPDLOG_WARN(
+                "{:02d} Column {:s}: raw_data_ vector size is 0. This column "
+                "has not been configured. See Configure()",
+                thread_index_, col_name_);
+        }
         return false;
     }
 
     // Check for sufficient remaining allocated vector elements.
     if ((raw_data_append_count_ * words_per_translated_value_ + words_per_translated_value_) > raw_data_.size())
     {
-        SPDLOG_WARN(
-            "{:02d} Column {:s}: Insufficient allocated size in raw_data_"
-            " vector ({:d}) given payload offsest ({:d}) and raw words per "
-            "translated value ({:d})",
-            thread_index_, col_name_,
-            raw_data_.size(), payload_offset_, words_per_translated_value_);
+        if (diagnostics_.Record("raw_data_full", row_offset_ + raw_data_append_count_))
+        {
+            SPDLOG_WARN(
+                "{:02d} Column {:s}: Insufficient allocated size in raw_data_"
+                " vector ({:d}) given payload offsest ({:d}) and raw words per "
+                "translated value ({:d})",
+                thread_index_, col_name_,
+                raw_data_.size(), payload_offset_, words_per_translated_value_);
+        }
         return false;
     }
 
@@ -229,21 +238,29 @@ bool TranslatableColumnTemplate<RawType, TranslatedType>::AppendRidealongData(
     // in raw_data_ vector has been allocated.
     if (translated_data_.size() == 0)
     {
-        SPDLOG_WARN(
-            "{:02d} Column {:s}: translated_data_ vector size is 0. This column "
-            "has not been configured. See Configure()",
-            thread_index_, col_name_);
+        if (diagnostics_.Record("translated_data_not_configured",
+            row_offset_ + translated_data_append_count_))
+        {
+            SPDLOG_WARN(
+                "{:02d} Column {:s}: translated_data_ vector size is 0. This column "
+                "has not been configured. See Configure()",
+                thread_index_, col_name_);
+        }
         return false;
     }
 
     // Check for sufficient remaining allocated vector elements.
     if ((translated_data_append_count_ + 1) > translated_data_.size())
     {
-        SPDLOG_WARN(
-            "{:02d} Column {:s}: Insufficient allocated size in translated_data_"
-            " vector ({:d}) given append_count ({:d})",
-            thread_index_, col_name_,
-            translated_data_.size(), translated_data_append_count_);
+        if (diagnostics_.Record("translated_data_full",
+            row_offset_ + translated_data_append_count_))
+        {
+            SPDLOG_WARN(
+                "{:02d} Column {:s}: Insufficient allocated size in translated_data_"
+                " vector ({:d}) given append_count ({:d})",
+                thread_index_, col_name_,
+                translated_data_.size(), translated_data_append_count_);
+        }
         return false;
     }
 
@@ -264,10 +281,12 @@ bool TranslatableColumnTemplate<RawType, TranslatedType>::Translate(
 {
     if (is_ridealong_)
     {
+        row_offset_ += translated_data_append_count_;
         translated_data_append_count_ = 0;
         return false;
     }
 
+    row_offset_ += raw_data_append_count_;
     raw_data_append_count_ = 0;
 
     if (!icd_translate.TranslateArray(raw_data_, translated_data_, icd_elem_))
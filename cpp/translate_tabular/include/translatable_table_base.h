@@ -12,6 +12,7 @@
 #include "translatable_column_template.h"
 #include "parquet_context.h"
 #include "managed_path.h"
+#include "perf_stats.h"
 #include "spdlog/spdlog.h"
 
 class TranslatableTableBase
@@ -70,6 +71,11 @@ class TranslatableTableBase
     // acted upon.
     size_t thread_index_;
 
+    // Total count of calls to AppendRawData and time spent
+    // translating raw data to engineering units
+    uint64_t appended_row_count_;
+    StageTimer translate_timer_;
+
    public:
     const bool& is_valid;
     const bool& is_pqctx_configured;
@@ -271,9 +277,20 @@ class TranslatableTableBase
     Close the pq_ctx_ output file. Note: if/when the Parquet-
     specific functionality is separated from the base class and
     moved to a derived class. This function will become a generic
-    base class virtual function.
+    base class virtual function. Log a summary of the diagnostic events
+    of each column.
     */
     virtual void CloseOutputFile();
+
+    /*
+    Add the counts and stage times of this table to a PerfStats
+    object. Times of all tables are summed under common names. Diagnostic
+    events of all columns are counted as "diagnostic_<event>".
+
+    Args:
+        stats   --> PerfStats to which values are added
+    */
+    virtual void AddPerfStats(PerfStats& stats) const;
 };
 
 template <typename RawType, typename TranslatedType>
@@ -99,6 +99,43 @@ class TranslateTabular
         return manager_vec_;
     }
 
+    /*
+    Check configuration, allot input files to at most manager_count
+    TranslationManager objects and create the objects. Translate() calls
+    this function prior to running each manager in a dedicated thread.
+    TranslationPool calls it to run the managers of several
+    TranslateTabular objects on a shared set of threads.
+
+    Args:
+        manager_count   --> Maximum count of TranslationManager objects
+                            to create. Fewer are created if there are
+                            fewer input files.
+
+    Return:
+        0 if the managers are created. Nonzero otherwise.
+    */
+    int CreateManagers(size_t manager_count);
+
+    /*
+    Log the status of each TranslationManager created by CreateManagers
+    after all have been run.
+
+    Return:
+        Exit code of the first failed TranslationManager, or EX_OK if
+        none failed.
+    */
+    int CheckManagerStatus();
+
+    /*
+    Add the PerfStats of each TranslationManager to a report, labeled
+    by the zero-padded thread index. Call after all managers have been
+    run.
+
+    Args:
+        report  --> PerfReport to which worker stats are added
+    */
+    void AssemblePerfReport(PerfReport& report) const;
+
     ///////////////////////////////////////////////////////////////////////////
     //                          Internal functions
     ///////////////////////////////////////////////////////////////////////////
@@ -172,6 +172,15 @@ class TranslateTabularContextBase
         return TranslateStatus::OK;
     }
 
+    /*
+    Add the counts and stage times of this context, including those
+    of all tables, to a PerfStats object.
+
+    Args:
+        stats   --> PerfStats to which values are added
+    */
+    virtual void AddPerfStats(PerfStats& stats) const;
+
     /*
     Create an object which derives from TranslatableTableBase and
     store it's shared_ptr in a vector. Create the table columns
@@ -6,17 +6,37 @@
 #include <cstdint>
 #include <set>
 #include <vector>
+#include <type_traits>
 
 /*
 Include parquet_reader.h first
 */
 #include "parquet_reader.h"
+#include "parquet_row_group.h"
 #include "translate_tabular_context_base.h"
 #include "translatable_table_base.h"
 #include "managed_path.h"
 #include "spdlog/spdlog.h"
 
 
+/*
+Data of a single column of the current row group. data() points to
+values in the Arrow buffer held by the ParquetRowGroup if T is the
+Arrow value type and the column has no null values, otherwise to a
+converted copy in buffer_. Valid until the next row group is read.
+*/
+template <typename T>
+class RGColumn
+{
+   public:
+    std::vector<T> buffer_;
+    const T* data_;
+
+    RGColumn() : buffer_(), data_(nullptr) {}
+    const T* data() const { return data_; }
+    const T& operator[](size_t i) const { return data_[i]; }
+};
+
 class TranslateTabularParquet : public TranslateTabularContextBase
 {
 protected:
@@ -27,11 +47,22 @@ protected:
 
     // Read parquet files
     ParquetReader pq_reader_;
+    ParquetRowGroup row_group_;
     size_t input_row_group_count_;
     size_t current_row_group_row_count_;
     size_t row_group_index_;
     std::shared_ptr<arrow::Schema> schema_;
 
+    // Count of row groups of the current input file which were not
+    // read because statistics show they can't contain data to translate
+    size_t skipped_row_group_count_;
+
+    // Totals over all input files, for performance statistics
+    uint64_t total_read_row_group_count_;
+    uint64_t total_skipped_row_group_count_;
+    uint64_t total_read_row_count_;
+    StageTimer read_timer_;
+
     // Indices of messages for which tables have been created
     std::set<size_t> table_indices_;
 
@@ -58,6 +89,7 @@ public:
     virtual TranslateStatus CloseOutputFile(const size_t& thread_index,
                                             bool is_final_file);
     virtual TranslateStatus ConsumeFile(const size_t& thread_index);
+    virtual void AddPerfStats(PerfStats& stats) const;
 
 
 
@@ -110,7 +142,9 @@ public:
 
 
     /*
-    Check if the row_group_index_ is equal to input_row_group_count_. If so,
+    Skip row groups which do not match the filters set by
+    SetRowGroupFilters. Check if the row_group_index_ is equal to
+    input_row_group_count_. If so,
     there are no more row groups to read. Fill the vectors with the current
     row group using the specialized FillRowGroupVectors function, then 
     increment the reader and the row group index for the next read.
@@ -132,30 +166,86 @@ public:
 
 
     /*
-    Helper function to fill a vector from a column in the current
-    row group using ParquetReader::GetNextRG().
+    Set ParquetReader row group filters such that row groups which
+    can't contain data to be translated, according to column chunk
+    statistics, are skipped by ReadRowGroup. Called by OpenInputFile.
+    No filters are set by default.
 
     Args:
-        output_vec  --> Vector into which all data from a column
+        thread_index        --> Current thread index
+
+    Return:
+        True if no errors occur; false otherwise.
+    */
+    virtual bool SetRowGroupFilters(const size_t& thread_index) { return true; }
+
+
+
+    /*
+    Read the ridealong and data columns of the current row group in a
+    single read via ParquetReader::GetNextRGColumns, which reads the
+    following row group in the background. Does not increment the row
+    group. Called by FillRowGroupVectors prior to FillRGColumn.
+
+    Return:
+        True if the row group is read; false otherwise.
+    */
+    bool ReadRowGroupColumns();
+
+
+
+    /*
+    Helper function to get the data of a column in the row group read
+    by ReadRowGroupColumns. The data are not copied if vectype is the
+    value type of arrowtype and no values are null.
+
+    Args:
+        column      --> RGColumn into which data from a column
                         in the current row group will be placed
         col_name    --> Name of column to read from the current
                         row group
         row_count   --> output value, count of rows in the row group
                         read to fill the column. Equivalent to the
-                        count of elements in the vector which are
+                        count of elements in the column which are
                         valid values from the row group
         is_list     --> set to true if the column is a list type
                         column
 
     Return:
-        True if no errors occur with the call to ParquetReader::GetNextRG;
-        false otherwise.
+        True if the column is present in the row group with the
+        expected type; false otherwise.
     */
     template <typename vectype, typename arrowtype>
-    bool FillRGVector(std::vector<vectype>& output_vec, std::string col_name,
+    bool FillRGColumn(RGColumn<vectype>& column, std::string col_name,
                       int& row_count, bool is_list);
 
 
+
+    /*
+    Helper function to get the data of a list column in the row group
+    read by ReadRowGroupColumns with a fixed count of elements per row,
+    regardless of whether the column was written as a fixed-size or a
+    variable-length list. The data are always copied, see
+    ParquetRowGroup::CopyListValues.
+
+    Args:
+        column              --> RGColumn into which data from a column
+                                in the current row group will be placed
+        col_name            --> Name of column to read from the current
+                                row group
+        row_count           --> output value, count of rows in the row
+                                group read to fill the column
+        elements_per_row    --> Count of elements per row of column
+
+    Return:
+        True if the column is present in the row group as a list with
+        the expected value type; false otherwise.
+    */
+    template <typename vectype, typename arrowtype>
+    bool FillRGListColumn(RGColumn<vectype>& column, std::string col_name,
+                          int& row_count, size_t elements_per_row);
+
+
     
     /*
     Fill vectors of data from the current row group. Must update
@@ -198,35 +288,49 @@ public:
 };
 
 template <typename vectype, typename arrowtype>
-bool TranslateTabularParquet::FillRGVector(std::vector<vectype>& output_vec,
-                                               std::string col_name,
-                                               int& row_count, bool is_list)
+bool TranslateTabularParquet::FillRGColumn(RGColumn<vectype>& column,
+                                           std::string col_name,
+                                           int& row_count, bool is_list)
 {
-    if (!pq_reader_.GetNextRG<vectype, arrowtype>(
-            pq_reader_.GetColumnNumberFromName(col_name), output_vec, row_count, is_list))
+    int col = pq_reader_.GetColumnNumberFromName(col_name);
+    if constexpr (std::is_same<vectype, typename arrowtype::TypeClass::c_type>::value)
+    {
+        int64_t count = 0;
+        if (row_group_.GetValues<arrowtype>(col, column.data_, count, is_list))
+        {
+            row_count = static_cast<int>(count);
+            SPDLOG_DEBUG("Mapped column \"{:s}\" with {:d} rows from current row group",
+                         col_name, row_count);
+            return true;
+        }
+    }
+
+    if (!row_group_.CopyValues<vectype, arrowtype>(col, column.buffer_, row_count, is_list))
     {
         SPDLOG_ERROR("Failed to read column \"{:s}\" from current row group", col_name);
         return false;
     }
+    column.data_ = column.buffer_.data();
     SPDLOG_DEBUG("Filled column \"{:s}\" with {:d} rows from current row group", col_name,
                  row_count);
     return true;
 }
 
-template <>
-inline bool TranslateTabularParquet::FillRGVector<uint8_t, arrow::NumericArray<arrow::BooleanType>>(
-    std::vector<uint8_t>& output_vec,
-    std::string col_name,
-    int& row_count, bool is_list)
+template <typename vectype, typename arrowtype>
+bool TranslateTabularParquet::FillRGListColumn(RGColumn<vectype>& column,
+                                               std::string col_name, int& row_count,
+                                               size_t elements_per_row)
 {
-    if (!pq_reader_.GetNextRGBool(
-            pq_reader_.GetColumnNumberFromName(col_name), output_vec, row_count, is_list))
+    int col = pq_reader_.GetColumnNumberFromName(col_name);
+    if (!row_group_.CopyListValues<vectype, arrowtype>(col, column.buffer_, row_count,
+                                                       elements_per_row))
     {
-        SPDLOG_ERROR("Failed to read column \"{:s}\" from current row group", col_name);
+        SPDLOG_ERROR("Failed to read list column \"{:s}\" from current row group", col_name);
         return false;
     }
-    SPDLOG_DEBUG("Filled column \"{:s}\" with {:d} rows from current row group", col_name,
-                 row_count);
+    column.data_ = column.buffer_.data();
+    SPDLOG_DEBUG("Filled list column \"{:s}\" with {:d} rows from current row group",
+                 col_name, row_count);
     return true;
 }
 
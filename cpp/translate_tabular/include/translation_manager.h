@@ -41,6 +41,15 @@ class TranslationManager
     // Hold exit code of function operator()
     std::atomic<int> exit_code_;
 
+    // Count of input files opened and time spent in each context
+    // function, for performance statistics
+    uint64_t input_file_count_;
+    StageTimer open_input_timer_;
+    StageTimer open_output_timer_;
+    StageTimer consume_timer_;
+    StageTimer close_input_timer_;
+    StageTimer close_output_timer_;
+
    public:
     const int& thread_index;
     const std::atomic<bool>& complete;
@@ -50,7 +59,8 @@ class TranslationManager
     TranslationManager() : context_(nullptr), thread_index_(-1), 
         complete_(false), success_(false), thread_index(thread_index_), 
         complete(complete_), success(success_), 
-        status_(TranslateStatus::NONE), exit_code_(0), exit_code(exit_code_)
+        status_(TranslateStatus::NONE), exit_code_(0), exit_code(exit_code_),
+        input_file_count_(0)
     {
     }
 
@@ -89,6 +99,26 @@ class TranslationManager
     {
         return context_;
     }
+
+    /*
+    Get the input file paths with which this object was configured.
+
+    Return:
+        Input file paths
+    */
+    const std::vector<ManagedPath>& GetInputPaths() const
+    {
+        return input_paths_;
+    }
+
+    /*
+    Get the counts and stage times of this object and its context.
+    Call after operator() is complete.
+
+    Return:
+        PerfStats of the work done by this object
+    */
+    PerfStats GetPerfStats() const;
 };
 
 #endif  // #ifndef TRANSLATION_MANAGER_H_
\ No newline at end of file
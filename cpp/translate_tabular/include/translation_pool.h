@@ -0,0 +1,139 @@
+#ifndef TRANSLATION_POOL_H_
+#define TRANSLATION_POOL_H_
+
+// Include first!
+#include "translate_tabular.h"
+//
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include <thread>
+#include <vector>
+#include "sysexits.h"
+#include "spdlog/spdlog.h"
+#include "managed_path.h"
+#include "translation_manager.h"
+
+/*
+Run the TranslationManager objects of several TranslateTabular objects,
+for example 1553 and ARINC 429 translators, on one set of threads. Each
+TranslationManager is a unit of work which translates a group of input
+files of a single translator. Work is started in order of decreasing
+memory estimate, such that the largest work starts first and the smaller
+work of any translator fills threads as they become free.
+
+The memory budget limits the sum of the memory estimates of the work
+which runs concurrently. A TranslationManager is estimated to require
+memory proportional to the largest of its input files, since files are
+translated one at a time and a row group is the largest unit read at
+once. Work which exceeds the budget on its own is started when no other
+work is running.
+*/
+
+class TranslationPool
+{
+   private:
+    // Count of threads shared by all translators
+    size_t n_threads_;
+
+    // Upper limit of the sum of the memory estimates of the
+    // TranslationManager objects which run concurrently, in
+    // bytes. Zero indicates no limit.
+    uint64_t memory_budget_;
+
+    // Translators and names used to identify each in log output
+    std::vector<std::string> names_;
+    std::vector<std::shared_ptr<TranslateTabular>> translators_;
+
+    // Work from all translators, ordered by decreasing memory
+    // estimate, and whether each has been started
+    std::vector<std::shared_ptr<TranslationManager>> work_;
+    std::vector<uint64_t> work_estimates_;
+    std::vector<bool> work_started_;
+
+    // Sum of the estimates and count of work which is running
+    uint64_t running_estimate_;
+    size_t running_count_;
+
+    std::mutex mutex_;
+    std::condition_variable work_complete_cv_;
+
+    // Thread function which runs work until none remains
+    void RunWork();
+
+   public:
+    const size_t& n_threads;
+    const uint64_t& memory_budget;
+
+    /*
+    Args:
+        n_threads       --> Count of threads shared by all translators.
+                            Values less than one are set to one.
+        memory_budget   --> Memory budget in bytes, zero for no limit
+    */
+    TranslationPool(size_t n_threads, uint64_t memory_budget);
+
+    /*
+    Add a translator which has been configured with input files and
+    an output directory. The output directory of each translator
+    ought to be unique since output files are labeled by the index of
+    the TranslationManager within a translator.
+
+    Args:
+        name        --> Name used to identify the translator in log output
+        translator  --> Configured TranslateTabular object
+    */
+    void AddTranslator(const std::string& name, std::shared_ptr<TranslateTabular> translator);
+
+    /*
+    Create the TranslationManager objects of each translator, run them
+    on the shared threads and wait for completion.
+
+    Return:
+        Exit code of the first translator which failed, or EX_OK if
+        all translators succeed.
+    */
+    int Translate();
+
+    ///////////////////////////////////////////////////////////////////////////
+    //                          Internal functions
+    ///////////////////////////////////////////////////////////////////////////
+
+    /*
+    Estimate the memory required to translate a group of input files
+    in a single TranslationManager.
+
+    Args:
+        input_paths --> Input file paths translated sequentially
+
+    Return:
+        Size in bytes of the largest input file
+    */
+    static uint64_t EstimateMemory(const std::vector<ManagedPath>& input_paths);
+
+    /*
+    Select the next work to start.
+
+    Args:
+        estimates       --> Memory estimate of each work item, in
+                            decreasing order
+        started         --> True for each work item which has been
+                            started
+        running_estimate--> Sum of the estimates of running work
+        running_count   --> Count of running work items
+        memory_budget   --> Memory budget, zero for no limit
+        index           --> Index of the selected work item
+
+    Return:
+        True if a work item is selected. False if no work item which
+        has not been started fits within the budget.
+    */
+    static bool SelectWork(const std::vector<uint64_t>& estimates,
+                           const std::vector<bool>& started, uint64_t running_estimate,
+                           size_t running_count, uint64_t memory_budget, size_t& index);
+};
+
+#endif  // TRANSLATION_POOL_H_
@@ -17,7 +17,9 @@ TranslatableColumnBase::TranslatableColumnBase() : is_ridealong_(false),
                                                    translated_data_append_count(translated_data_append_count_),
                                                    icd_elem_(),
                                                    thread_index_(0),
-                                                   thread_index(thread_index_)
+                                                   thread_index(thread_index_),
+                                                   row_offset_(0),
+                                                   diagnostics_()
 {
 }
 
@@ -1,6 +1,6 @@
 #include "translatable_table_base.h"
 
-TranslatableTableBase::TranslatableTableBase() : is_valid_(false), is_valid(is_valid_), name_(""), row_group_size_(0), name(name_), row_group_size(row_group_size_), append_count_(0), ridealong_col_name_to_index_map(ridealong_col_name_to_index_map_), output_path_(""), output_path(output_path_), pq_ctx_(nullptr), is_pqctx_configured_(false), is_pqctx_configured(is_pqctx_configured_), icd_translate_(), thread_index_(0), thread_index(thread_index_)
+TranslatableTableBase::TranslatableTableBase() : is_valid_(false), is_valid(is_valid_), name_(""), row_group_size_(0), name(name_), row_group_size(row_group_size_), append_count_(0), ridealong_col_name_to_index_map(ridealong_col_name_to_index_map_), output_path_(""), output_path(output_path_), pq_ctx_(nullptr), is_pqctx_configured_(false), is_pqctx_configured(is_pqctx_configured_), icd_translate_(), thread_index_(0), thread_index(thread_index_), appended_row_count_(0), translate_timer_()
 {
     icd_translate_.SetAutomaticResizeOutputVector(false);
 }
@@ -78,16 +78,19 @@ bool TranslatableTableBase::_IncrementAndTranslate()
     // write the data.
     // Note that this assumes all ridealong columns have already been copied.
     append_count_++;
+    appended_row_count_++;
     if (append_count_ == row_group_size_)
     {
         SPDLOG_DEBUG("{:02d} Translating columns of table: {:s}", thread_index_, name_);
 
+        translate_timer_.Start();
         for (std::vector<std::shared_ptr<TranslatableColumnBase>>::iterator
                  it = columns_.begin();
              it != columns_.end(); ++it)
         {
             (*it)->Translate(icd_translate_);
         }
+        translate_timer_.Stop();
         append_count_ = 0;
     }
 
@@ -212,15 +215,58 @@ void TranslatableTableBase::CloseOutputFile()
     if (append_count_ > 0)
     {
         SPDLOG_DEBUG("{:02d} Translating columns of table: {:s}", thread_index_, name_);
+        translate_timer_.Start();
         for (std::vector<std::shared_ptr<TranslatableColumnBase>>::iterator
                  it = columns_.begin();
              it != columns_.end(); ++it)
         {
             (*it)->Translate(icd_translate_);
         }
+        translate_timer_.Stop();
         append_count_ = 0;
     }
 
     if (pq_ctx_ != nullptr)
         pq_ctx_->Close(static_cast<uint16_t>(thread_index_));
+
+    // Summarize the diagnostic events of each column, of which only the
+    // first occurrences are logged individually.
+    std::vector<std::string> summary;
+    for (std::vector<std::shared_ptr<TranslatableColumnBase>>::const_iterator
+             it = columns_.cbegin(); it != columns_.cend(); ++it)
+    {
+        if ((*it)->GetDiagnostics().IsEmpty())
+            continue;
+        summary = (*it)->GetDiagnostics().FormatSummary("row");
+        for (std::vector<std::string>::const_iterator line = summary.cbegin();
+             line != summary.cend(); ++line)
+        {
+            SPDLOG_WARN("{:02d} Table \"{:s}\" column {:s}: {:s}", thread_index_, name_,
+                (*it)->col_name, *line);
+        }
+    }
+}
+
+void TranslatableTableBase::AddPerfStats(PerfStats& stats) const
+{
+    stats.AddCount("rows_appended", appended_row_count_);
+    stats.AddTime("eu_translate", translate_timer_.GetElapsedNs());
+
+    std::map<std::string, uint64_t> diagnostic_counts;
+    for (std::vector<std::shared_ptr<TranslatableColumnBase>>::const_iterator
+             it = columns_.cbegin(); it != columns_.cend(); ++it)
+    {
+        diagnostic_counts = (*it)->GetDiagnostics().GetCounts();
+        for (std::map<std::string, uint64_t>::const_iterator count = diagnostic_counts.cbegin();
+             count != diagnostic_counts.cend(); ++count)
+            stats.AddCount("diagnostic_" + count->first, count->second);
+    }
+    if (pq_ctx_ != nullptr)
+    {
+        stats.AddCount("rows_written", pq_ctx_->written_row_count);
+        stats.AddCount("row_groups_written", pq_ctx_->written_row_group_count);
+        stats.AddTime("arrow_build", pq_ctx_->build_time_ns);
+        stats.AddTime("parquet_write", pq_ctx_->write_time_ns);
+        stats.AddTime("parquet_close", pq_ctx_->close_time_ns);
+    }
 }
@@ -44,6 +44,26 @@ void TranslateTabular::SetOutputDir(const ManagedPath& output_dir,
 }
 
 int TranslateTabular::Translate()
+{
+    int retcode = 0;
+    if ((retcode = CreateManagers(n_threads_)) != 0)
+        return retcode;
+
+    // It's possible that fewer managers are required than n_threads_
+    // if there are fewer files than threads. Set n_threads_ equal to
+    // the count of managers to avoid threads without input files.
+    n_threads_ = manager_vec_.size();
+    SPDLOG_INFO("Thread count adjusted: {:d}", n_threads_);
+
+    std::vector<std::thread> thread_vec;
+    StartThreads(thread_vec, manager_vec_);
+
+    JoinThreads(thread_vec, manager_vec_);
+
+    return CheckManagerStatus();
+}
+
+int TranslateTabular::CreateManagers(size_t manager_count)
 {
     int retcode = 0;
     if ((retcode = CheckConfiguration(ctx_)) != 0)
@@ -51,24 +71,18 @@ int TranslateTabular::Translate()
 
     size_t required_thread_count = 0;
     std::vector<std::vector<ManagedPath>> thread_file_paths;
-    AssignFilesToThreads(n_threads_, file_list_, thread_file_paths, required_thread_count);
-
-    // It's possible that required_that_count is less than n_threads_, else it is
-    // equal. required_thread_count is equal to thread_file_paths.size(), so files
-    // may not exist for ingestion for thread index = n_threads_ - 1. Set n_threads_
-    // equal to required_thread_count to avoid this problem.
-    SPDLOG_INFO("Thread count adjusted: {:d}", required_thread_count);
-    n_threads_ = required_thread_count;
+    AssignFilesToThreads(manager_count, file_list_, thread_file_paths, required_thread_count);
 
-    if (!CreateTranslationManagerObjects(ctx_, n_threads_, thread_file_paths,
+    manager_vec_.clear();
+    if (!CreateTranslationManagerObjects(ctx_, required_thread_count, thread_file_paths,
                                          output_dir_, output_base_name_, manager_vec_))
         return EX_SOFTWARE;
 
-    std::vector<std::thread> thread_vec;
-    StartThreads(thread_vec, manager_vec_);
-
-    JoinThreads(thread_vec, manager_vec_);
+    return EX_OK;
+}
 
+int TranslateTabular::CheckManagerStatus()
+{
     // Print thread success results
     std::string status_string = "";
     int exit_code = 0;
@@ -239,3 +253,15 @@ void TranslateTabular::JoinThreads(std::vector<std::thread>& threads,
     }
     SPDLOG_INFO("Joined threads");
 }
+
+void TranslateTabular::AssemblePerfReport(PerfReport& report) const
+{
+    char label[16];
+    for (std::vector<std::shared_ptr<TranslationManager>>::const_iterator it =
+             manager_vec_.cbegin();
+         it != manager_vec_.cend(); ++it)
+    {
+        snprintf(label, sizeof(label), "%02d", (*it)->thread_index);
+        report.AddWorker(label, (*it)->GetPerfStats());
+    }
+}
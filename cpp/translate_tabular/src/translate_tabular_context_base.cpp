@@ -83,3 +83,13 @@ bool TranslateTabularContextBase::AppendColumnPreCheck(
     }
     return true;
 }
+
+void TranslateTabularContextBase::AddPerfStats(PerfStats& stats) const
+{
+    for (std::unordered_map<size_t, std::shared_ptr<TranslatableTableBase>>::const_iterator it =
+             table_index_to_table_map_.cbegin();
+         it != table_index_to_table_map_.cend(); ++it)
+    {
+        it->second->AddPerfStats(stats);
+    }
+}
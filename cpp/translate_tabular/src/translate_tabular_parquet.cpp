@@ -2,7 +2,9 @@
 
 TranslateTabularParquet::TranslateTabularParquet() : TranslateTabularContextBase(),
     pq_reader_(), input_row_group_count_(-1), row_group_index_(-1), output_dir_(""),
-    output_base_path_(""), current_row_group_row_count_(0)
+    output_base_path_(""), current_row_group_row_count_(0), skipped_row_group_count_(0),
+    total_read_row_group_count_(0), total_skipped_row_group_count_(0),
+    total_read_row_count_(0), read_timer_()
 
 { }
 
@@ -30,6 +32,25 @@ TranslateStatus TranslateTabularParquet::OpenInputFile(const ManagedPath& input_
         return TranslateStatus::FAIL;
     }
 
+    // Read only the ridealong and data columns, in a single read per
+    // row group, and read the next row group while the current row
+    // group is translated.
+    std::vector<std::string> col_names(ridealong_col_names_);
+    col_names.insert(col_names.end(), data_col_names_.begin(), data_col_names_.end());
+    if (!pq_reader_.SetColumnProjection(col_names))
+    {
+        SPDLOG_ERROR("{:02d} Failed to set column projection", thread_index);
+        return TranslateStatus::FAIL;
+    }
+    pq_reader_.SetPrefetch(true);
+
+    if (!SetRowGroupFilters(thread_index))
+    {
+        SPDLOG_ERROR("{:02d} Failed to set row group filters", thread_index);
+        return TranslateStatus::FAIL;
+    }
+    skipped_row_group_count_ = 0;
+
     // ParquetReader will return zero on SetPQPath if row group count
     // is zero, so no need to check the value here.
     input_row_group_count_ = pq_reader_.GetRowGroupCount();
@@ -110,14 +131,35 @@ TranslateStatus TranslateTabularParquet::CloseOutputFile(
 TranslateStatus TranslateTabularParquet::ReadRowGroup(const size_t& thread_index,
         const size_t& row_group_count, size_t& row_group_index)
 {
+    // Skip row groups without decompression if statistics show that
+    // they can't contain data to be translated.
+    while (row_group_index < row_group_count &&
+           !pq_reader_.RowGroupMayMatch(pq_reader_.current_row_group))
+    {
+        pq_reader_.IncrementRG();
+        row_group_index++;
+        skipped_row_group_count_++;
+        total_skipped_row_group_count_++;
+    }
+
     if (row_group_index == row_group_count)
+    {
+        if (skipped_row_group_count_ > 0)
+            SPDLOG_DEBUG("{:02d} Skipped {:d} of {:d} row groups by statistics", thread_index,
+                skipped_row_group_count_, row_group_count);
         return TranslateStatus::CONTINUE;
+    }
 
-    if (!FillRowGroupVectors())
+    read_timer_.Start();
+    bool fill_ok = FillRowGroupVectors();
+    read_timer_.Stop();
+    if (!fill_ok)
     {
         SPDLOG_WARN("{:02d} Failed to fill row group vectors", thread_index);
         return TranslateStatus::FAIL;
     }
+    total_read_row_group_count_++;
+    total_read_row_count_ += current_row_group_row_count_;
     pq_reader_.IncrementRG();
     row_group_index++;
     SPDLOG_DEBUG("{:02d} Read {:d} parsed data rows", thread_index,
@@ -126,6 +168,25 @@ TranslateStatus TranslateTabularParquet::ReadRowGroup(const size_t& thread_index
     return TranslateStatus::OK;
 }
 
+void TranslateTabularParquet::AddPerfStats(PerfStats& stats) const
+{
+    stats.AddCount("row_groups_read", total_read_row_group_count_);
+    stats.AddCount("row_groups_skipped", total_skipped_row_group_count_);
+    stats.AddCount("rows_read", total_read_row_count_);
+    stats.AddTime("read", read_timer_.GetElapsedNs());
+    TranslateTabularContextBase::AddPerfStats(stats);
+}
+
+bool TranslateTabularParquet::ReadRowGroupColumns()
+{
+    if (!pq_reader_.GetNextRGColumns(row_group_))
+    {
+        SPDLOG_ERROR("Failed to read row group {:d}", pq_reader_.current_row_group);
+        return false;
+    }
+    return true;
+}
+
 bool TranslateTabularParquet::CreateTableOutputDir(const size_t& thread_index,
     const ManagedPath& table_path, const std::string& table_name)
 {
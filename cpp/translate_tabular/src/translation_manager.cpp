@@ -27,7 +27,9 @@ void TranslationManager::operator()()
         SPDLOG_INFO("Thread {:d} working on input file: {:s}",
                     thread_index_, input_paths_.at(input_file_ind).RawString());
 
+        open_input_timer_.Start();
         status_ = context_->OpenInputFile(input_paths_.at(input_file_ind), thread_index_);
+        open_input_timer_.Stop();
         if (status_ == TranslateStatus::FAIL)
         {
             success_ = false;
@@ -36,9 +38,12 @@ void TranslationManager::operator()()
         }
         else if (status_ == TranslateStatus::CONTINUE)
             continue;
+        input_file_count_++;
 
+        open_output_timer_.Start();
         status_ = context_->OpenOutputFile(output_dir_, output_base_name_,
                                            thread_index_);
+        open_output_timer_.Stop();
         if (status_ == TranslateStatus::FAIL)
         {
             success_ = false;
@@ -48,7 +53,9 @@ void TranslationManager::operator()()
         else if (status_ == TranslateStatus::CONTINUE)
             continue;
 
+        consume_timer_.Start();
         status_ = context_->ConsumeFile(thread_index_);
+        consume_timer_.Stop();
         if (status_ == TranslateStatus::FAIL)
         {
             success_ = false;
@@ -58,7 +65,9 @@ void TranslationManager::operator()()
         else if (status_ == TranslateStatus::CONTINUE)
             continue;
 
+        close_input_timer_.Start();
         status_ = context_->CloseInputFile(thread_index_);
+        close_input_timer_.Stop();
         if (status_ == TranslateStatus::FAIL)
         {
             success_ = false;
@@ -68,7 +77,9 @@ void TranslationManager::operator()()
         else if (status_ == TranslateStatus::CONTINUE)
             continue;
 
+        close_output_timer_.Start();
         status_ = context_->CloseOutputFile(thread_index_, is_final_file);
+        close_output_timer_.Stop();
         if (status_ == TranslateStatus::FAIL)
         {
             success_ = false;
@@ -82,3 +93,17 @@ void TranslationManager::operator()()
     complete_ = true;
     exit_code_ = EX_OK;
 }
+
+PerfStats TranslationManager::GetPerfStats() const
+{
+    PerfStats stats;
+    stats.AddCount("input_files", input_file_count_);
+    stats.AddTime("open_input", open_input_timer_.GetElapsedNs());
+    stats.AddTime("open_output", open_output_timer_.GetElapsedNs());
+    stats.AddTime("consume", consume_timer_.GetElapsedNs());
+    stats.AddTime("close_input", close_input_timer_.GetElapsedNs());
+    stats.AddTime("close_output", close_output_timer_.GetElapsedNs());
+    if (context_ != nullptr)
+        context_->AddPerfStats(stats);
+    return stats;
+}
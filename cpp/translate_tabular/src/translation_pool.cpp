@@ -0,0 +1,149 @@
+#include "translation_pool.h"
+
+TranslationPool::TranslationPool(size_t n_threads, uint64_t memory_budget) :
+    n_threads_(n_threads < 1 ? 1 : n_threads), memory_budget_(memory_budget),
+    running_estimate_(0), running_count_(0), n_threads(n_threads_),
+    memory_budget(memory_budget_)
+{
+}
+
+void TranslationPool::AddTranslator(const std::string& name,
+                                    std::shared_ptr<TranslateTabular> translator)
+{
+    names_.push_back(name);
+    translators_.push_back(translator);
+}
+
+int TranslationPool::Translate()
+{
+    int retcode = 0;
+    std::vector<std::shared_ptr<TranslationManager>> all_work;
+    std::vector<size_t> all_work_translator;
+    for (size_t i = 0; i < translators_.size(); i++)
+    {
+        // Create as many managers as threads for each translator, such
+        // that each translator could use all threads if the other
+        // translators have little work.
+        if ((retcode = translators_[i]->CreateManagers(n_threads_)) != 0)
+        {
+            SPDLOG_ERROR("Failed to configure {:s} translation", names_[i]);
+            return retcode;
+        }
+
+        std::vector<std::shared_ptr<TranslationManager>> managers =
+            translators_[i]->GetManagers();
+        all_work.insert(all_work.end(), managers.begin(), managers.end());
+        all_work_translator.insert(all_work_translator.end(), managers.size(), i);
+        SPDLOG_INFO("{:s}: {:d} work items", names_[i], managers.size());
+    }
+
+    std::vector<uint64_t> all_estimates;
+    std::vector<size_t> order;
+    for (size_t i = 0; i < all_work.size(); i++)
+    {
+        all_estimates.push_back(EstimateMemory(all_work[i]->GetInputPaths()));
+        order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [&all_estimates](size_t a, size_t b)
+                     { return all_estimates[a] > all_estimates[b]; });
+
+    work_.clear();
+    work_estimates_.clear();
+    for (std::vector<size_t>::const_iterator it = order.cbegin(); it != order.cend(); ++it)
+    {
+        work_.push_back(all_work[*it]);
+        work_estimates_.push_back(all_estimates[*it]);
+        SPDLOG_DEBUG("Work item: {:s} thread {:d}, memory estimate {:d}",
+            names_[all_work_translator[*it]], all_work[*it]->thread_index, all_estimates[*it]);
+    }
+    work_started_.assign(work_.size(), false);
+    running_estimate_ = 0;
+    running_count_ = 0;
+
+    size_t thread_count = std::min(n_threads_, work_.size());
+    SPDLOG_INFO("TranslationPool: {:d} work items, {:d} threads, memory budget {:d} bytes",
+        work_.size(), thread_count, memory_budget_);
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < thread_count; i++)
+        threads.push_back(std::thread(&TranslationPool::RunWork, this));
+    for (size_t i = 0; i < threads.size(); i++)
+        threads[i].join();
+    SPDLOG_INFO("Joined threads");
+
+    int exit_code = 0;
+    for (size_t i = 0; i < translators_.size(); i++)
+    {
+        if ((retcode = translators_[i]->CheckManagerStatus()) != 0)
+        {
+            SPDLOG_ERROR("{:s} translation failed with exit code {:d}", names_[i], retcode);
+            if (exit_code == 0)
+                exit_code = retcode;
+        }
+    }
+    return exit_code;
+}
+
+void TranslationPool::RunWork()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    size_t index = 0;
+    while (std::find(work_started_.begin(), work_started_.end(), false) != work_started_.end())
+    {
+        if (!SelectWork(work_estimates_, work_started_, running_estimate_, running_count_,
+                        memory_budget_, index))
+        {
+            // Wait for running work to complete and free budget
+            work_complete_cv_.wait(lock);
+            continue;
+        }
+
+        work_started_[index] = true;
+        running_estimate_ += work_estimates_[index];
+        running_count_++;
+        lock.unlock();
+
+        (*work_[index])();
+
+        lock.lock();
+        running_estimate_ -= work_estimates_[index];
+        running_count_--;
+        work_complete_cv_.notify_all();
+    }
+}
+
+uint64_t TranslationPool::EstimateMemory(const std::vector<ManagedPath>& input_paths)
+{
+    uint64_t estimate = 0;
+    bool success = false;
+    uint64_t size = 0;
+    for (std::vector<ManagedPath>::const_iterator it = input_paths.cbegin();
+         it != input_paths.cend(); ++it)
+    {
+        it->GetFileSize(success, size);
+        if (success && size > estimate)
+            estimate = size;
+    }
+    return estimate;
+}
+
+bool TranslationPool::SelectWork(const std::vector<uint64_t>& estimates,
+                                 const std::vector<bool>& started, uint64_t running_estimate,
+                                 size_t running_count, uint64_t memory_budget, size_t& index)
+{
+    for (size_t i = 0; i < estimates.size(); i++)
+    {
+        if (started.at(i))
+            continue;
+
+        // Always start work if nothing else is running, otherwise work
+        // larger than the budget would never start.
+        if (memory_budget == 0 || running_count == 0 ||
+            running_estimate + estimates[i] <= memory_budget)
+        {
+            index = i;
+            return true;
+        }
+    }
+    return false;
+}
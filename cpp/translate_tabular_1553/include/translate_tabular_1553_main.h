@@ -21,6 +21,7 @@ with re-definitions by spdlog headers of arrow defs.
 #include "spdlog/sinks/rotating_file_sink.h"
 #include "file_reader.h"
 #include "sha256_tools.h"
+#include "binary_cache.h"
 #include "translate_tabular.h"
 #include "translate_tabular_context_1553.h"
 #include "ch10_packet_type.h"
@@ -39,8 +40,89 @@ with re-definitions by spdlog headers of arrow defs.
 
 int TranslateTabular1553Main(int argc, char** argv);
 
+/*
+State shared by the stages of 1553 translation. TranslateTabular1553Main
+runs the stages in order. The multi-bus translator runs the stages of
+each bus and runs the translators of all buses on a shared pool.
+*/
+class Translation1553State
+{
+   public:
+    ManagedPath input_path;
+    ManagedPath icd_path;
+    ManagedPath output_dir;
+    ManagedPath log_dir;
+
+    DTS1553 dts1553;
+    std::map<std::string, std::string> msg_name_substitutions;
+    std::map<std::string, std::string> elem_name_substitutions;
+
+    ManagedPath dts_cache_path;
+    std::string dts_cache_key;
+    bool dts_cache_hit;
+
+    TIPMDDocument parser_md_doc;
+    ProvenanceData prov_data;
+    BusMap bus_map;
+
+    ManagedPath transl_output_dir;
+    ManagedPath output_base_name;
+    std::shared_ptr<TranslateTabular> translator;
+    std::set<std::string> translated_msg_names;
+
+    Translation1553State() : dts_cache_key(""), dts_cache_hit(false),
+        output_base_name(std::string("")), translator(nullptr)
+    {}
+};
+
 namespace transtab1553
 {
+    /*
+    Validate paths, read the DTS cache and validate the DTS1553 schema
+    if the cache is not used. Called prior to logging setup.
+
+    Args:
+        config      --> Translation configuration
+        av          --> ArgumentValidation
+        state       --> Translation1553State in which paths and DTS
+                        cache data are set
+
+    Return:
+        EX_OK if successful, otherwise an exit code
+    */
+    int ValidateInputs(const TranslationConfigParams& config, ArgumentValidation* av,
+                    Translation1553State& state);
+
+    /*
+    Read parsed metadata, ingest the DTS1553, synthesize the bus map,
+    create the translated output directory and create the translator.
+    Called after logging setup.
+
+    Args:
+        config      --> Translation configuration
+        state       --> Translation1553State prepared by ValidateInputs
+
+    Return:
+        EX_OK if successful, otherwise an exit code
+    */
+    int PrepareTranslation(const TranslationConfigParams& config,
+                    Translation1553State& state);
+
+    /*
+    Collect translated message names from the completed translator and
+    record the translated metadata.
+
+    Args:
+        config      --> Translation configuration
+        state       --> Translation1553State of which the translator
+                        has completed
+
+    Return:
+        EX_OK if successful, otherwise an exit code
+    */
+    int FinalizeTranslation(const TranslationConfigParams& config,
+                    Translation1553State& state);
+
     int ValidatePaths(const std::string& str_input_path, const std::string& str_icd_path,
                     const std::string& str_output_dir, const std::string& str_log_dir, 
                     ManagedPath& input_path, ManagedPath& icd_path, ManagedPath& output_dir, 
@@ -55,6 +137,45 @@ namespace transtab1553
                 std::map<std::string, std::string>& elem_name_substitutions,
                 FileReader* fr);
 
+    /*
+    Read the DTS1553 cache in place of ingesting the DTS. The cache is
+    located in cache_dir_str and identified by the DTS SHA-256 hash.
+
+    Args:
+        dts_path                --> DTS1553 path
+        cache_dir_str           --> DTS cache directory
+        av                      --> ArgumentValidation
+        cache_path              --> Output cache file path
+        cache_key               --> Output DTS hash, which identifies the
+                                    cache. Empty if the cache directory is
+                                    not valid or the DTS can't be hashed,
+                                    in which case the cache is disabled.
+        dts1553                 --> DTS1553 object filled from the cache
+        msg_name_substitutions  --> Output message name substitutions
+        elem_name_substitutions --> Output element name substitutions
+
+    Return:
+        True if the cache exists, matches the DTS and TIP version, and
+        was read; false otherwise.
+    */
+    bool ReadDTSCache(const ManagedPath& dts_path, const std::string& cache_dir_str,
+                    ArgumentValidation* av, ManagedPath& cache_path, std::string& cache_key,
+                    DTS1553* dts1553,
+                    std::map<std::string, std::string>& msg_name_substitutions,
+                    std::map<std::string, std::string>& elem_name_substitutions);
+
+    /*
+    Write the DTS1553 cache after the DTS is ingested. Failure to write
+    the cache is logged and is not an error.
+
+    Return:
+        True if the cache was written; false otherwise.
+    */
+    bool WriteDTSCache(const ManagedPath& cache_path, const std::string& cache_key,
+                    const DTS1553& dts1553,
+                    const std::map<std::string, std::string>& msg_name_substitutions,
+                    const std::map<std::string, std::string>& elem_name_substitutions);
+
     bool PrepareBusMap(const ManagedPath& input_path, DTS1553& dts1553, 
                     const TIPMDDocument& parser_md_doc, 
                     const TranslationConfigParams& config_params,
@@ -67,12 +188,45 @@ namespace transtab1553
     bool SetSystemLimits(uint8_t thread_count, size_t message_count);
 
     int Translate(size_t thread_count, const ManagedPath& input_path,
-                const ManagedPath& output_dir, ICDData icd,
+                const ManagedPath& output_dir, const ICDData& icd,
                 const ManagedPath& translated_data_dir,
                 const ManagedPath& output_base_name,
                 const std::vector<std::string>& selected_msg_names,
                 std::set<std::string>& translated_msg_names);
 
+    /*
+    Create the 1553 context and the translator for the parsed files
+    in input_path.
+
+    Args:
+        thread_count        --> Count of threads used by the translator
+        input_path          --> Parsed 1553 directory
+        icd                 --> ICDData with bus names replaced by channel IDs
+        translated_data_dir --> Translated output directory
+        output_base_name    --> Base name of output files
+        selected_msg_names  --> Messages to translate, all if empty
+        translator          --> Output translator
+
+    Return:
+        EX_OK if successful, otherwise an exit code
+    */
+    int CreateTranslator(size_t thread_count, const ManagedPath& input_path,
+                const ICDData& icd, const ManagedPath& translated_data_dir,
+                const ManagedPath& output_base_name,
+                const std::vector<std::string>& selected_msg_names,
+                std::shared_ptr<TranslateTabular>& translator);
+
+    /*
+    Collect the names of the translated messages from the context of
+    each TranslationManager of a completed translator.
+
+    Args:
+        translator              --> Completed translator
+        translated_msg_names    --> Output set of message names
+    */
+    void CollectTranslatedMsgNames(std::shared_ptr<TranslateTabular> translator,
+                std::set<std::string>& translated_msg_names);
+
     bool RecordMetadata(const TranslationConfigParams& config, 
                         const ManagedPath& translated_data_dir,
                         const ManagedPath& dts_path, 
@@ -81,7 +235,7 @@ namespace transtab1553
                         const std::map<std::string, std::string>& msg_name_substitutions,
                         const std::map<std::string, std::string>& elem_name_substitutions,
                         const ProvenanceData& prov_data, const TIPMDDocument& parser_md_doc,
-                        const BusMap* bus_map);
+                        const BusMap* bus_map, const PerfReport& perf_report);
 
     int GetParsed1553Metadata(const ManagedPath* input_md_path, 
         TIPMDDocument* parser_md_doc, FileReader* fr);
@@ -24,7 +24,9 @@ class TranslateTabularContext1553 : public TranslateTabularParquet
    private:
     // Organized data specific to identifying 1553 messages and defining
     // translation metadata for the elements (columns) of each message.
-    ICDData icd_data_;
+    // Not modified after construction and shared by the contexts of all
+    // threads.
+    std::shared_ptr<const ICDData> icd_data_;
 
     // Count of raw payload words per row.
     static const size_t raw_data_count_per_row_;
@@ -41,22 +43,39 @@ class TranslateTabularContext1553 : public TranslateTabularParquet
     bool should_select_msgs_;
 
 
-    // Vectors into which row group data will be read.
-    std::vector<int64_t> time_;
-    std::vector<uint16_t> raw_data_;
-    std::vector<uint16_t> channelid_;
-    std::vector<uint8_t> txrtaddr_;
-    std::vector<uint8_t> rxrtaddr_;
-    std::vector<uint8_t> txsubaddr_;
-    std::vector<uint8_t> rxsubaddr_;
+    // Row group column data. Types match the parsed data schema such
+    // that columns are not copied, except raw_data_, which must be
+    // contiguous uint16_t payload words, raw_data_count_per_row_ per row.
+    RGColumn<int64_t> time_;
+    RGColumn<uint16_t> raw_data_;
+    RGColumn<int32_t> channelid_;
+    RGColumn<int8_t> txrtaddr_;
+    RGColumn<int8_t> rxrtaddr_;
+    RGColumn<int8_t> txsubaddr_;
+    RGColumn<int8_t> rxsubaddr_;
 
    public:
     const std::set<std::string>& translated_msg_names;
 
     TranslateTabularContext1553(ICDData icd,
                                 const std::set<std::string>& selected_msg_names);
+
+    /*
+    Construct a context which shares the ICDData of another context.
+
+    Args:
+        icd                     --> Shared ICDData
+        selected_msg_names      --> User-selected message names
+        selected_table_indices  --> Indices of the tables of the selected
+                                    messages, see ICDData::GetSelectedTableIndicesSet
+    */
+    TranslateTabularContext1553(std::shared_ptr<const ICDData> icd,
+                                const std::set<std::string>& selected_msg_names,
+                                const std::set<size_t>& selected_table_indices);
     virtual ~TranslateTabularContext1553() {}
 
+    const std::shared_ptr<const ICDData>& GetICDData() const { return icd_data_; }
+
 
     //////////////////////////////////////////////////////////////////
     //                     Internal Functions
@@ -79,6 +98,13 @@ class TranslateTabularContext1553 : public TranslateTabularParquet
 
     virtual bool FillRowGroupVectors();
 
+    /*
+    Filter row groups by the channel IDs and transmit RT addresses of
+    the messages in the ICD lookup, limited to the selected messages
+    if messages are selected.
+    */
+    virtual bool SetRowGroupFilters(const size_t& thread_index);
+
 
     /*
     Wrapper function TranslatableTabularContextBase::CreateTranslatableTable() 
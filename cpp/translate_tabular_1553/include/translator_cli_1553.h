@@ -69,6 +69,14 @@ inline bool ConfigureTranslatorCLI(CLIGroup& cli_group, TranslationConfigParams&
         config.log_path_str_)->DefaultUseValueOf(
             config.output_path_str_);
 
+    cli->AddOption<std::string>("--dts_cache_path", "", 
+        Translate1553CLIHelpStrings::dts_cache_dir_help, "<output path directory>",
+        config.dts_cache_dir_str_)->DefaultUseValueOf(
+            config.output_path_str_);
+
+    cli->AddOption<std::string>("--perf_stats", "", 
+        Translate1553CLIHelpStrings::perf_stats_path_help, "", config.perf_stats_path_str_);
+
     cli->AddOption("--thread_count", "-t", 
         Translate1553CLIHelpStrings::translate_thread_count_help, 1,
         config.translate_thread_count_)->ValidateInclusiveRangeIs(
@@ -127,6 +135,9 @@ inline bool ConfigureTranslatorCLI(CLIGroup& cli_group, TranslationConfigParams&
     cli->AddOption("--disable_dts_validation", "", 
         disable_validation_help, false, 
         config.disable_dts_schema_validation_);
+    cli->AddOption("--disable_dts_cache", "", 
+        Translate1553CLIHelpStrings::disable_dts_cache_help, false, 
+        config.disable_dts_cache_);
 
 
     if(!cli_group.CheckConfiguration())
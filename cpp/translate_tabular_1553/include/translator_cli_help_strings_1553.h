@@ -28,6 +28,21 @@ namespace Translate1553CLIHelpStrings
     const std::string log_dir_help = 
         R"(Log files output directory.)";
 
+    const std::string dts_cache_dir_help = 
+        R"(Directory of the DTS cache. The validated and organized content
+        of the DTS is cached in a binary file identified by the DTS SHA-256
+        hash and the TIP version. Later translations with the same DTS read the
+        cache in place of reading, validating and organizing the DTS.)";
+
+    const std::string disable_dts_cache_help = 
+        R"(Neither read nor write the DTS cache.)";
+
+    const std::string perf_stats_path_help = 
+        R"(Write per-worker counters and stage times to this file in addition to
+        _metadata.yaml. The format is JSON if the extension is .json and Prometheus
+        text if the extension is .prom, e.g., for the node exporter textfile
+        collector.)";
+
     const std::string translate_thread_count_help = 
         R"(Number of threads to use for translation valid ranges = [1, Cores * 2])";
 
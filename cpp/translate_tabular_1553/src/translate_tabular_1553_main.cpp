@@ -48,95 +48,30 @@ int TranslateTabular1553Main(int argc, char** argv)
     }
 
     ArgumentValidation av;
-    ManagedPath input_path;
-    ManagedPath icd_path;
-    ManagedPath output_dir;
-    ManagedPath log_dir;
-    if ((retcode = transtab1553::ValidatePaths(config.input_data_path_str_, config.input_dts_path_str_, 
-                       config.output_path_str_, config.log_path_str_, input_path, icd_path,
-                       output_dir, log_dir, &av)) != 0)
+    Translation1553State state;
+    if ((retcode = transtab1553::ValidateInputs(config, &av, state)) != 0)
         return retcode;
 
-    bool check_extension_result = false;
-    if(av.CheckExtension(icd_path.RawString(), {"yaml", "yml"}))
-    {
-        YamlSV ysv;
-        std::string icd_string; 
-        if(!av.ValidateDocument(icd_path, icd_string))
-            return EX_DATAERR;
-        std::vector<LogItem> log_items;
-        if(!ysv.Validate(icd_string, dts_1553_schema, log_items))
-        {
-            printf("Schema validation failed for %s\n", icd_path.RawString().c_str());
-            int print_count = 20;
-            YamlSV::PrintLogItems(log_items, print_count, std::cout);
-            return EX_DATAERR;
-        }
-    }
-    // Don't fail on incorrect extension now. Some legacy ICD input files are
-    // still in text format.
-    // else
-        // return EX_DATAERR;
     spdlog::level::level_enum stdout_level = spdlog::level::from_str(config.stdout_log_level_);
     spdlog::level::level_enum file_level = spdlog::level::from_str(config.file_log_level_);
-    if (!transtab1553::SetupLogging(log_dir, stdout_level, file_level))
+    if (!transtab1553::SetupLogging(state.log_dir, stdout_level, file_level))
         return EX_SOFTWARE;
 
-    TIPMDDocument parser_md_doc;
-    ManagedPath parser_md_path = input_path / "_metadata.yaml";
-    FileReader fr;
-    if((retcode = transtab1553::GetParsed1553Metadata(&parser_md_path, &parser_md_doc, &fr)) != 0)
-        return retcode;
-
-    ProvenanceData prov_data;
-    if((retcode = GetProvenanceData(icd_path.absolute(), 0, prov_data)) != 0)
+    if ((retcode = transtab1553::PrepareTranslation(config, state)) != 0)
         return retcode;
 
-    // Use logger to print and record these values after logging
-    // is implemented.
-    SPDLOG_INFO("{:s} version: {:s}", TRANSLATE_1553_EXE_NAME, prov_data.tip_version);
-    SPDLOG_INFO("Input: {:s}", input_path.RawString());
-    SPDLOG_INFO("Output dir: {:s}", output_dir.RawString());
-    SPDLOG_INFO("Log dir: {:s}", log_dir.RawString());
-    SPDLOG_INFO("DTS1553 path: {:s}", icd_path.RawString());
-    SPDLOG_INFO("DTS1553 hash: {:s}", prov_data.hash);
     size_t thread_count = config.translate_thread_count_;
-    SPDLOG_INFO("Thread count: {:d}", thread_count);
-
-    DTS1553 dts1553;
-    std::map<std::string, std::string> msg_name_substitutions;
-    std::map<std::string, std::string> elem_name_substitutions;
-    if ((retcode = transtab1553::IngestICD(&dts1553, icd_path, msg_name_substitutions,
-        elem_name_substitutions, &fr)) != 0)
-        return retcode;
-
-    BusMap bm;
-    if (!transtab1553::PrepareBusMap(input_path, dts1553, parser_md_doc, config,
-        &bm))
-    {
-        return EX_SOFTWARE;
-    }
-
     if (config.auto_sys_limits_)
     {
         if (!transtab1553::SetSystemLimits(static_cast<uint8_t>(thread_count), 
-            dts1553.ICDDataPtr()->valid_message_count))
+            state.dts1553.ICDDataPtr()->valid_message_count))
             return EX_OSERR;
     }
     else
         SPDLOG_WARN("Automatic system limits (file handle allocation) disabled");
 
     auto start_time = std::chrono::high_resolution_clock::now();
-    ManagedPath transl_output_dir = output_dir.CreatePathObject(input_path, "_translated");
-    if (!transl_output_dir.create_directory())
-        return EX_IOERR;
-    ManagedPath output_base_name("");
-    std::set<std::string> translated_msg_names;
-    SPDLOG_INFO("Translated data output dir: {:s}", transl_output_dir.RawString());
-
-    if ((retcode = transtab1553::Translate(thread_count, input_path, output_dir, dts1553.GetICDData(),
-                   transl_output_dir, output_base_name, config.select_specific_messages_,
-                   translated_msg_names)) != 0)
+    if ((retcode = state.translator->Translate()) != 0)
     {
         SPDLOG_WARN(
             "Failed to configure 1553 translation stage or an error occurred "
@@ -150,13 +85,10 @@ int TranslateTabular1553Main(int argc, char** argv)
     double duration = secs.count();
     SPDLOG_INFO("Duration: {:.3f} sec", duration);
 
-    if(!transtab1553::RecordMetadata(config, transl_output_dir, icd_path,
-                    input_path, translated_msg_names, msg_name_substitutions,
-                    elem_name_substitutions, prov_data, parser_md_doc, &bm))
+    if ((retcode = transtab1553::FinalizeTranslation(config, state)) != 0)
     {
-        SPDLOG_ERROR("RecordMetadata failure");
         spdlog::shutdown();
-        return EX_IOERR;
+        return retcode;
     }
     // Avoid deadlock in windows, see
     // http://stackoverflow.com/questions/10915233/stdthreadjoin-hangs-if-called-after-main-exits-when-using-vs2012-rc
@@ -166,6 +98,137 @@ int TranslateTabular1553Main(int argc, char** argv)
 
 namespace transtab1553
 {
+    int ValidateInputs(const TranslationConfigParams& config, ArgumentValidation* av,
+                    Translation1553State& state)
+    {
+        int retcode = 0;
+        if ((retcode = ValidatePaths(config.input_data_path_str_, config.input_dts_path_str_, 
+                        config.output_path_str_, config.log_path_str_, state.input_path,
+                        state.icd_path, state.output_dir, state.log_dir, av)) != 0)
+            return retcode;
+
+        if (!config.perf_stats_path_str_.empty() &&
+            !PerfReport::IsSupportedPath(ManagedPath(config.perf_stats_path_str_)))
+        {
+            printf("Performance statistics path \"%s\" does not have extension "
+                "\".json\" or \".prom\"\n", config.perf_stats_path_str_.c_str());
+            return EX_USAGE;
+        }
+
+        // Read the DTS cache prior to schema validation. A DTS which matches
+        // the cache has been validated by a previous translation.
+        if (!config.disable_dts_cache_)
+        {
+            state.dts_cache_hit = ReadDTSCache(state.icd_path, config.dts_cache_dir_str_, av,
+                state.dts_cache_path, state.dts_cache_key, &state.dts1553,
+                state.msg_name_substitutions, state.elem_name_substitutions);
+        }
+
+        if(!state.dts_cache_hit && av->CheckExtension(state.icd_path.RawString(), {"yaml", "yml"}))
+        {
+            YamlSV ysv;
+            std::string icd_string; 
+            if(!av->ValidateDocument(state.icd_path, icd_string))
+                return EX_DATAERR;
+            std::vector<LogItem> log_items;
+            if(!ysv.Validate(icd_string, dts_1553_schema, log_items))
+            {
+                printf("Schema validation failed for %s\n", state.icd_path.RawString().c_str());
+                int print_count = 20;
+                YamlSV::PrintLogItems(log_items, print_count, std::cout);
+                return EX_DATAERR;
+            }
+        }
+        // Don't fail on incorrect extension now. Some legacy ICD input files are
+        // still in text format.
+        return EX_OK;
+    }
+
+    int PrepareTranslation(const TranslationConfigParams& config,
+                    Translation1553State& state)
+    {
+        int retcode = 0;
+        ManagedPath parser_md_path = state.input_path / "_metadata.yaml";
+        FileReader fr;
+        if((retcode = GetParsed1553Metadata(&parser_md_path, &state.parser_md_doc, &fr)) != 0)
+            return retcode;
+
+        if((retcode = GetProvenanceData(state.icd_path.absolute(), 0, state.prov_data)) != 0)
+            return retcode;
+
+        // Use logger to print and record these values after logging
+        // is implemented.
+        SPDLOG_INFO("{:s} version: {:s}", TRANSLATE_1553_EXE_NAME, state.prov_data.tip_version);
+        SPDLOG_INFO("Input: {:s}", state.input_path.RawString());
+        SPDLOG_INFO("Output dir: {:s}", state.output_dir.RawString());
+        SPDLOG_INFO("Log dir: {:s}", state.log_dir.RawString());
+        SPDLOG_INFO("DTS1553 path: {:s}", state.icd_path.RawString());
+        SPDLOG_INFO("DTS1553 hash: {:s}", state.prov_data.hash);
+        size_t thread_count = config.translate_thread_count_;
+        SPDLOG_INFO("Thread count: {:d}", thread_count);
+
+        if (state.dts_cache_hit)
+            SPDLOG_INFO("DTS1553 read from cache: {:s}", state.dts_cache_path.RawString());
+        else
+        {
+            if ((retcode = IngestICD(&state.dts1553, state.icd_path, state.msg_name_substitutions,
+                state.elem_name_substitutions, &fr)) != 0)
+                return retcode;
+
+            if (state.dts_cache_key != "")
+                WriteDTSCache(state.dts_cache_path, state.dts_cache_key, state.dts1553,
+                    state.msg_name_substitutions, state.elem_name_substitutions);
+        }
+
+        if (!PrepareBusMap(state.input_path, state.dts1553, state.parser_md_doc, config,
+            &state.bus_map))
+        {
+            return EX_SOFTWARE;
+        }
+
+        state.transl_output_dir = state.output_dir.CreatePathObject(state.input_path, "_translated");
+        if (!state.transl_output_dir.create_directory())
+            return EX_IOERR;
+        SPDLOG_INFO("Translated data output dir: {:s}", state.transl_output_dir.RawString());
+
+        return CreateTranslator(thread_count, state.input_path, *state.dts1553.ICDDataPtr(),
+            state.transl_output_dir, state.output_base_name, config.select_specific_messages_,
+            state.translator);
+    }
+
+    int FinalizeTranslation(const TranslationConfigParams& config,
+                    Translation1553State& state)
+    {
+        CollectTranslatedMsgNames(state.translator, state.translated_msg_names);
+
+        PerfReport perf_report;
+        state.translator->AssemblePerfReport(perf_report);
+
+        if(!RecordMetadata(config, state.transl_output_dir, state.icd_path,
+                        state.input_path, state.translated_msg_names, state.msg_name_substitutions,
+                        state.elem_name_substitutions, state.prov_data, state.parser_md_doc,
+                        &state.bus_map, perf_report))
+        {
+            SPDLOG_ERROR("RecordMetadata failure");
+            return EX_IOERR;
+        }
+
+        if (!config.perf_stats_path_str_.empty())
+        {
+            std::map<std::string, std::string> labels{
+                {"input", state.input_path.filename().RawString()}};
+            if (perf_report.Write(ManagedPath(config.perf_stats_path_str_), "tip_translate_1553",
+                labels) != EX_OK)
+            {
+                SPDLOG_ERROR("Failed to write performance statistics: {:s}",
+                    config.perf_stats_path_str_);
+                return EX_CANTCREAT;
+            }
+            SPDLOG_INFO("Performance statistics: {:s}", config.perf_stats_path_str_);
+        }
+        return EX_OK;
+    }
+
     int ValidatePaths(const std::string& str_input_path, const std::string& str_icd_path,
                     const std::string& str_output_dir, const std::string& str_log_dir, 
                     ManagedPath& input_path, ManagedPath& icd_path, ManagedPath& output_dir, 
@@ -279,6 +342,55 @@ namespace transtab1553
         return EX_OK;
     }
 
+    bool ReadDTSCache(const ManagedPath& dts_path, const std::string& cache_dir_str,
+                    ArgumentValidation* av, ManagedPath& cache_path, std::string& cache_key,
+                    DTS1553* dts1553,
+                    std::map<std::string, std::string>& msg_name_substitutions,
+                    std::map<std::string, std::string>& elem_name_substitutions)
+    {
+        cache_key = "";
+        ManagedPath cache_dir;
+        if (!av->ValidateDirectoryPath(cache_dir_str, cache_dir))
+        {
+            printf("DTS cache path \"%s\" is not a valid directory, DTS cache disabled\n",
+                cache_dir_str.c_str());
+            return false;
+        }
+
+        std::string dts_hash;
+        if (ComputeFileSHA256(dts_path, dts_hash) != 0)
+            return false;
+
+        cache_key = dts_hash;
+        cache_path = cache_dir / ("dts1553_" + dts_hash.substr(0, 16) + ".tipcache");
+        BinaryCacheReader reader;
+        if (reader.Open(cache_path, cache_key, GetVersionString()) != EX_OK)
+            return false;
+
+        if (!dts1553->ReadCache(reader, msg_name_substitutions, elem_name_substitutions))
+        {
+            printf("Failed to read DTS cache %s, ingesting DTS\n", cache_path.RawString().c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool WriteDTSCache(const ManagedPath& cache_path, const std::string& cache_key,
+                    const DTS1553& dts1553,
+                    const std::map<std::string, std::string>& msg_name_substitutions,
+                    const std::map<std::string, std::string>& elem_name_substitutions)
+    {
+        BinaryCacheWriter writer;
+        dts1553.WriteCache(writer, msg_name_substitutions, elem_name_substitutions);
+        if (writer.Save(cache_path, cache_key, GetVersionString()) != EX_OK)
+        {
+            SPDLOG_WARN("Failed to write DTS cache: {:s}", cache_path.RawString());
+            return false;
+        }
+        SPDLOG_INFO("Wrote DTS cache: {:s}", cache_path.RawString());
+        return true;
+    }
+
     bool PrepareBusMap(const ManagedPath& input_path, DTS1553& dts1553,
                     const TIPMDDocument& parser_md_doc,
                     const TranslationConfigParams& config_params,
@@ -443,11 +555,32 @@ namespace transtab1553
     }
 
     int Translate(size_t thread_count, const ManagedPath& input_path,
-                const ManagedPath& output_dir, ICDData icd,
+                const ManagedPath& output_dir, const ICDData& icd,
                 const ManagedPath& translated_data_dir,
                 const ManagedPath& output_base_name,
                 const std::vector<std::string>& selected_msg_names,
                 std::set<std::string>& translated_msg_names)
+    {
+        std::shared_ptr<TranslateTabular> translator;
+        int retcode = 0;
+        if ((retcode = CreateTranslator(thread_count, input_path, icd, translated_data_dir,
+            output_base_name, selected_msg_names, translator)) != 0)
+            return retcode;
+
+        if ((retcode = translator->Translate()) != 0)
+        {
+            return retcode;
+        }
+
+        CollectTranslatedMsgNames(translator, translated_msg_names);
+        return EX_OK;
+    }
+
+    int CreateTranslator(size_t thread_count, const ManagedPath& input_path,
+                const ICDData& icd, const ManagedPath& translated_data_dir,
+                const ManagedPath& output_base_name,
+                const std::vector<std::string>& selected_msg_names,
+                std::shared_ptr<TranslateTabular>& translator)
     {
         // Get list of input files
         bool success = false;
@@ -481,21 +614,21 @@ namespace transtab1553
         context->SetColumnNames(ridealong_col_names, data_col_names);
 
         // Create primary object which controls translation
-        TranslateTabular translate(thread_count, context);
-        if (!translate.SetInputFiles(dir_entries, ".parquet"))
+        translator = std::make_shared<TranslateTabular>(thread_count, context);
+        if (!translator->SetInputFiles(dir_entries, ".parquet"))
         {
             return EX_SOFTWARE;
         }
 
-        translate.SetOutputDir(translated_data_dir, output_base_name);
-        int retcode = 0;
-        if ((retcode = translate.Translate()) != 0)
-        {
-            return retcode;
-        }
+        translator->SetOutputDir(translated_data_dir, output_base_name);
+        return EX_OK;
+    }
 
+    void CollectTranslatedMsgNames(std::shared_ptr<TranslateTabular> translator,
+                std::set<std::string>& translated_msg_names)
+    {
         // Collect the translated message names from each of the Context objects.
-        std::vector<std::shared_ptr<TranslationManager>> managers = translate.GetManagers();
+        std::vector<std::shared_ptr<TranslationManager>> managers = translator->GetManagers();
         std::shared_ptr<TranslateTabularContext1553> ctx;
         for (size_t i = 0; i < managers.size(); i++)
         {
@@ -504,8 +637,6 @@ namespace transtab1553
             translated_msg_names.insert(ctx->translated_msg_names.begin(),
                                         ctx->translated_msg_names.end());
         }
-
-        return EX_OK;
     }
 
     int GetParsed1553Metadata(const ManagedPath* input_md_path,
@@ -553,7 +684,7 @@ namespace transtab1553
                         const std::map<std::string, std::string>& msg_name_substitutions,
                         const std::map<std::string, std::string>& elem_name_substitutions,
                         const ProvenanceData& prov_data, const TIPMDDocument& parser_md_doc,
-                        const BusMap* bus_map)
+                        const BusMap* bus_map, const PerfReport& perf_report)
 
     {
         TIPMDDocument md;
@@ -653,6 +784,14 @@ namespace transtab1553
         md.runtime_category_->SetArbitraryMappedValue("uri_percent_encoded_element_names",
             elem_name_substitutions);
 
+        // Per-worker counts and stage times
+        md.runtime_category_->SetArbitraryMappedValue("perf_counts",
+            perf_report.GetTotal().GetCounts());
+        md.runtime_category_->SetArbitraryMappedValue("perf_times_sec",
+            perf_report.GetTotal().GetTimesSec());
+        md.runtime_category_->SetArbitraryMappedValue("perf_worker_times_sec",
+            perf_report.GetWorkerTimesSec());
+
         // Get a string containing the complete metadata output and
         // and write it to the yaml file.
         md.CreateDocument();
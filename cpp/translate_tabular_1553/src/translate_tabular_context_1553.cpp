@@ -4,20 +4,33 @@ const size_t TranslateTabularContext1553::raw_data_count_per_row_ = 32;
 
 TranslateTabularContext1553::TranslateTabularContext1553(ICDData icd,
                                                          const std::set<std::string>& selected_msg_names) : 
-                                                         TranslateTabularParquet(), icd_data_(icd), 
-                                                         should_select_msgs_(false), 
+                                                         TranslateTabularParquet(), icd_data_(), 
+                                                         should_select_msgs_(!selected_msg_names.empty()), 
                                                          selected_msg_names_(selected_msg_names), 
                                                          translated_msg_names(translated_msg_names_)
 {
-    selected_table_indices_ = icd_data_.GetSelectedTableIndicesSet(selected_msg_names_,
-                                                                   icd_data_.table_names);
+    std::shared_ptr<const ICDData> icd_data = std::make_shared<const ICDData>(std::move(icd));
+    selected_table_indices_ = icd_data->GetSelectedTableIndicesSet(selected_msg_names_,
+                                                                   icd_data->GetTableNames());
+    icd_data_ = icd_data;
 }
 
+TranslateTabularContext1553::TranslateTabularContext1553(std::shared_ptr<const ICDData> icd,
+                                                         const std::set<std::string>& selected_msg_names,
+                                                         const std::set<size_t>& selected_table_indices) : 
+                                                         TranslateTabularParquet(), icd_data_(icd), 
+                                                         should_select_msgs_(!selected_msg_names.empty()), 
+                                                         selected_msg_names_(selected_msg_names), 
+                                                         selected_table_indices_(selected_table_indices),
+                                                         translated_msg_names(translated_msg_names_)
+{}
+
 std::shared_ptr<TranslateTabularContextBase> TranslateTabularContext1553::Clone()
 {
     std::shared_ptr<TranslateTabularContext1553> temp =
         std::make_shared<TranslateTabularContext1553>(this->icd_data_,
-                                                      this->selected_msg_names_);
+                                                      this->selected_msg_names_,
+                                                      this->selected_table_indices_);
     temp->SetColumnNames(this->ridealong_col_names_, this->data_col_names_);
     return temp;
 }
@@ -29,7 +42,7 @@ TranslateStatus TranslateTabularContext1553::ConsumeRowGroup(const size_t& threa
         return status;
 
     // Iterate over each row in the row group
-    std::set<size_t> matching_table_inds;
+    const std::vector<std::string>& table_names = icd_data_->GetTableNames();
     std::set<size_t>::const_iterator table_ind_it;
     ManagedPath output_path;
     std::string table_name = "";
@@ -38,11 +51,12 @@ TranslateStatus TranslateTabularContext1553::ConsumeRowGroup(const size_t& threa
     {
         // Use the ICD lookup created from the DTS1553 to identify all table
         // indices which match the given criteria.
-        matching_table_inds = icd_data_.LookupTableIndex(channelid_[row_ind],
-                                                         txrtaddr_[row_ind],
-                                                         rxrtaddr_[row_ind],
-                                                         txsubaddr_[row_ind],
-                                                         rxsubaddr_[row_ind]);
+        const std::set<size_t>& matching_table_inds = icd_data_->FindTableIndices(
+            static_cast<uint16_t>(channelid_[row_ind]),
+            static_cast<uint8_t>(txrtaddr_[row_ind]),
+            static_cast<uint8_t>(rxrtaddr_[row_ind]),
+            static_cast<uint8_t>(txsubaddr_[row_ind]),
+            static_cast<uint8_t>(rxsubaddr_[row_ind]));
 
         // Iterate over the matching table indices. Create a TranslatableTable
         // or append data to an existing table.
@@ -53,7 +67,7 @@ TranslateStatus TranslateTabularContext1553::ConsumeRowGroup(const size_t& threa
                 selected_table_indices_, *table_ind_it))
                 continue;
 
-            table_name = icd_data_.table_names.at(*table_ind_it);
+            table_name = table_names.at(*table_ind_it);
 
             // If the table index is not present in the set of already created table
             // indices, then create the table and its columns and add it to the set.
@@ -68,7 +82,7 @@ TranslateStatus TranslateTabularContext1553::ConsumeRowGroup(const size_t& threa
 
                 SPDLOG_DEBUG("{:02d} Creating table with index {:d}",
                              thread_index, *table_ind_it);
-                result = CreateTable(icd_data_, *table_ind_it, table_index_to_table_map_,
+                result = CreateTable(*icd_data_, *table_ind_it, table_index_to_table_map_,
                     output_path, thread_index);
 
                 // Add the index to the set to track table creation.
@@ -77,7 +91,7 @@ TranslateStatus TranslateTabularContext1553::ConsumeRowGroup(const size_t& threa
                 if (!result)
                 {
                     SPDLOG_WARN("{:02d} Failed to create table for message: {:s}",
-                                thread_index, icd_data_.table_names.at(*table_ind_it));
+                                thread_index, table_names.at(*table_ind_it));
                     continue;
                 }
                 translated_msg_names_.insert(table_name);
@@ -97,32 +111,37 @@ bool TranslateTabularContext1553::FillRowGroupVectors()
 {
     int row_count = 0;
 
-    // Read relevant columns into vectors.
-    if (!FillRGVector<int64_t, arrow::NumericArray<arrow::Int64Type>>(time_,
+    // Read all relevant columns in a single read.
+    if (!ReadRowGroupColumns())
+        return false;
+
+    if (!FillRGColumn<int64_t, arrow::NumericArray<arrow::Int64Type>>(time_,
                                                                        "time", row_count, false))
         return false;
 
-    if (!FillRGVector<uint16_t, arrow::NumericArray<arrow::Int32Type>>(raw_data_,
-                                                                       "data", row_count, true))
+    // The data column is a variable-length list of the payload words of
+    // each message. Expand to raw_data_count_per_row_ words per row.
+    if (!FillRGListColumn<uint16_t, arrow::NumericArray<arrow::Int32Type>>(raw_data_,
+        "data", row_count, raw_data_count_per_row_))
         return false;
 
-    if (!FillRGVector<uint16_t, arrow::NumericArray<arrow::Int32Type>>(channelid_,
+    if (!FillRGColumn<int32_t, arrow::NumericArray<arrow::Int32Type>>(channelid_,
                                                                        "channelid", row_count, false))
         return false;
 
-    if (!FillRGVector<uint8_t, arrow::NumericArray<arrow::Int8Type>>(txrtaddr_,
+    if (!FillRGColumn<int8_t, arrow::NumericArray<arrow::Int8Type>>(txrtaddr_,
                                                                      "txrtaddr", row_count, false))
         return false;
 
-    if (!FillRGVector<uint8_t, arrow::NumericArray<arrow::Int8Type>>(rxrtaddr_,
+    if (!FillRGColumn<int8_t, arrow::NumericArray<arrow::Int8Type>>(rxrtaddr_,
                                                                      "rxrtaddr", row_count, false))
         return false;
 
-    if (!FillRGVector<uint8_t, arrow::NumericArray<arrow::Int8Type>>(txsubaddr_,
+    if (!FillRGColumn<int8_t, arrow::NumericArray<arrow::Int8Type>>(txsubaddr_,
                                                                      "txsubaddr", row_count, false))
         return false;
 
-    if (!FillRGVector<uint8_t, arrow::NumericArray<arrow::Int8Type>>(rxsubaddr_,
+    if (!FillRGColumn<int8_t, arrow::NumericArray<arrow::Int8Type>>(rxsubaddr_,
                                                                      "rxsubaddr", row_count, false))
         return false;
 
@@ -130,6 +149,33 @@ bool TranslateTabularContext1553::FillRowGroupVectors()
     return true;
 }
 
+bool TranslateTabularContext1553::SetRowGroupFilters(const size_t& thread_index)
+{
+    std::set<size_t> table_inds;
+    if (should_select_msgs_)
+        table_inds = selected_table_indices_;
+    else
+    {
+        for (size_t i = 0; i < icd_data_->GetTableNames().size(); i++)
+            table_inds.insert(i);
+    }
+
+    std::set<uint16_t> chanids;
+    std::set<uint8_t> xmit_lru_addrs;
+    icd_data_->GetLookupKeys(table_inds, chanids, xmit_lru_addrs);
+    SPDLOG_DEBUG("{:02d} Row group filters: {:d} channel IDs, {:d} transmit RT addresses",
+                 thread_index, chanids.size(), xmit_lru_addrs.size());
+
+    if (!pq_reader_.SetRowGroupFilter("channelid",
+        std::set<int64_t>(chanids.cbegin(), chanids.cend())))
+        return false;
+
+    if (!pq_reader_.SetRowGroupFilter("txrtaddr",
+        std::set<int64_t>(xmit_lru_addrs.cbegin(), xmit_lru_addrs.cend())))
+        return false;
+    return true;
+}
+
 bool TranslateTabularContext1553::CreateTable(const ICDData& icd_data, size_t table_index,
                                               std::unordered_map<size_t, std::shared_ptr<TranslatableTableBase>>& table_map,
                                               const ManagedPath& output_path, const size_t& thread_index)
@@ -164,7 +210,7 @@ bool TranslateTabularContext1553::CreateTable(const ICDData& icd_data, size_t ta
         if (!AppendColumnFromICDElement(table_ptr, icd_data.GetElementByIndex(*elem_ind_it)))
         {
             SPDLOG_WARN("{:02d} Failed to create column: {:s}, table: {:s}",
-                        thread_index, icd_data.GetElementByIndex(*elem_ind_it).elem_name_, table_name);
+                        thread_index, icd_data.GetElementByIndex(*elem_ind_it).elem_name_.str(), table_name);
             return false;
         }
     }
@@ -303,7 +349,7 @@ bool TranslateTabularContext1553::AppendColumnFromICDElement(
     if (!result)
     {
         SPDLOG_WARN("Failed to AppendColumn for element: {:s}, schema: value {:d}",
-                    icd_elem.elem_name_, static_cast<uint8_t>(icd_elem.schema_));
+                    icd_elem.elem_name_.str(), static_cast<uint8_t>(icd_elem.schema_));
         return false;
     }
 
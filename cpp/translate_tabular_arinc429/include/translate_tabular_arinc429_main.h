@@ -38,14 +38,100 @@ with re-definitions by spdlog headers of arrow defs.
 #include "translation_config_params.h"
 #include "yaml_schema_validation.h"
 #include "sha256_tools.h"
+#include "binary_cache.h"
 #include "translator_cli_429.h"
 #include "dts_arinc429_schema.h"
 
 
 int TranslateTabularARINC429Main(int argc, char** argv);
 
+/*
+State shared by the stages of ARINC 429 translation. See
+Translation1553State.
+*/
+class Translation429State
+{
+   public:
+    ManagedPath input_path;
+    ManagedPath icd_path;
+    ManagedPath output_dir;
+    ManagedPath log_dir;
+
+    DTS429 dts429;
+    std::unordered_map<std::string, std::vector<ICDElement>> word_elements;
+
+    ManagedPath dts_cache_path;
+    std::string dts_cache_key;
+    bool dts_cache_hit;
+
+    TIPMDDocument parser_md_doc;
+    ProvenanceData prov_data;
+    ARINC429Data arinc429_dts_data;
+    size_t arinc429_message_count;
+
+    // If subchannel name in DTS isn't in parsed metadata, add to following
+    // vector and output subchan names with translated metadata.
+    std::vector<std::string> subchannel_name_lookup_misses;
+
+    ManagedPath transl_output_dir;
+    ManagedPath output_base_name;
+    std::shared_ptr<TranslateTabular> translator;
+    std::set<std::string> translate_word_names;
+    std::map<uint32_t, std::map<uint32_t, std::set<uint16_t>>> chanid_busnum_labels;
+
+    Translation429State() : dts_cache_key(""), dts_cache_hit(false),
+        arinc429_message_count(0), output_base_name(std::string("")), translator(nullptr)
+    {}
+};
+
 namespace transtab429
 {
+    /*
+    Validate paths, read the DTS cache and validate the DTS429 schema
+    if the cache is not used. Called prior to logging setup.
+
+    Args:
+        config      --> Translation configuration
+        av          --> ArgumentValidation
+        state       --> Translation429State in which paths and DTS
+                        cache data are set
+
+    Return:
+        EX_OK if successful, otherwise an exit code
+    */
+    int ValidateInputs(const TranslationConfigParams& config, ArgumentValidation* av,
+                    Translation429State& state);
+
+    /*
+    Read parsed metadata, ingest and organize the DTS429, create the
+    translated output directory and create the translator. Called
+    after logging setup.
+
+    Args:
+        config      --> Translation configuration
+        state       --> Translation429State prepared by ValidateInputs
+
+    Return:
+        EX_OK if successful, otherwise an exit code
+    */
+    int PrepareTranslation(const TranslationConfigParams& config,
+                    Translation429State& state);
+
+    /*
+    Collect translated word names and labels from the completed
+    translator and record the translated metadata.
+
+    Args:
+        config      --> Translation configuration
+        state       --> Translation429State of which the translator
+                        has completed
+
+    Return:
+        EX_OK if successful, otherwise an exit code
+    */
+    int FinalizeTranslation(const TranslationConfigParams& config,
+                    Translation429State& state);
+
     int ValidatePaths(const std::string& str_input_path, const std::string& str_icd_path,
                     const std::string& str_output_dir, const std::string& str_log_dir,
                     ManagedPath& input_path, ManagedPath& icd_path,
@@ -55,10 +141,53 @@ namespace transtab429
         spdlog::level::level_enum stdout_log_level,
         spdlog::level::level_enum file_log_level);
 
+    /*
+    Ingest DTS429 lines and organize the words into ARINC429Data.
+
+    Args:
+        word_elements   --> Optional map of word name to elements. If
+                            not empty, such as if read from the DTS
+                            cache, the lines are not ingested and the
+                            map is organized. Otherwise the map is
+                            filled by ingesting the lines.
+    */
     bool IngestICD(DTS429* dts429, Organize429ICD* org429, ARINC429Data& data429,
                     const std::vector<std::string>& icd_lines, size_t& arinc_message_count,
                     YAML::Node& parser_md_node,
-                    std::vector<std::string>& subchan_name_lookup_misses);
+                    std::vector<std::string>& subchan_name_lookup_misses,
+                    std::unordered_map<std::string, std::vector<ICDElement>>* word_elements = nullptr);
+
+    /*
+    Read the DTS429 cache, located in cache_dir_str and identified by
+    the DTS SHA-256 hash, in place of ingesting the DTS lines.
+
+    Args:
+        cache_path      --> Output cache file path
+        cache_key       --> Output DTS hash, which identifies the cache.
+                            Empty if the cache directory is not valid or
+                            the DTS can't be hashed, in which case the
+                            cache is disabled.
+        word_elements   --> Output map of word name to elements
+
+    Return:
+        True if the cache exists, matches the DTS and TIP version, and
+        was read; false otherwise.
+    */
+    bool ReadDTSCache(const ManagedPath& dts_path, const std::string& cache_dir_str,
+                    ArgumentValidation* av, ManagedPath& cache_path, std::string& cache_key,
+                    DTS429* dts429,
+                    std::unordered_map<std::string, std::vector<ICDElement>>& word_elements);
+
+    /*
+    Write the DTS429 cache after the DTS is ingested. Failure to write
+    the cache is logged and is not an error.
+
+    Return:
+        True if the cache was written; false otherwise.
+    */
+    bool WriteDTSCache(const ManagedPath& cache_path, const std::string& cache_key,
+                    const DTS429& dts429,
+                    const std::unordered_map<std::string, std::vector<ICDElement>>& word_elements);
 
     int GetParsedMetadata(const ManagedPath& input_md_path,
         TIPMDDocument& parser_md_doc);
@@ -74,13 +203,49 @@ namespace transtab429
                 std::set<std::string>& translated_msg_names,
                 std::map<uint32_t, std::map<uint32_t, std::set<uint16_t>>>& chanid_busnum_labels_map);
 
+    /*
+    Create the ARINC 429 context and the translator for the parsed
+    files in input_path.
+
+    Args:
+        thread_count        --> Count of threads used by the translator
+        input_path          --> Parsed ARINC 429 directory
+        icd                 --> Organized ARINC429Data
+        translated_data_dir --> Translated output directory
+        output_base_name    --> Base name of output files
+        translator          --> Output translator
+
+    Return:
+        EX_OK if successful, otherwise an exit code
+    */
+    int CreateTranslator(size_t thread_count, const ManagedPath& input_path,
+                const ARINC429Data& icd, const ManagedPath& translated_data_dir,
+                const ManagedPath& output_base_name,
+                std::shared_ptr<TranslateTabular>& translator);
+
+    /*
+    Collect the translated word names and the channel ID to bus number
+    to labels map from the context of each TranslationManager of a
+    completed translator.
+
+    Args:
+        translator              --> Completed translator
+        translated_msg_names    --> Output set of word names
+        chanid_busnum_labels_map--> Output map of channel ID to bus
+                                    number to labels
+    */
+    void CollectTranslatedMsgNames(std::shared_ptr<TranslateTabular> translator,
+                std::set<std::string>& translated_msg_names,
+                std::map<uint32_t, std::map<uint32_t, std::set<uint16_t>>>& chanid_busnum_labels_map);
+
     bool RecordMetadata(const TranslationConfigParams& config,
                     const ManagedPath& translated_data_dir,
                     const ManagedPath& dts_path,
                     const ManagedPath& input_path,
                     const std::set<std::string>& translated_messages,
                     const ProvenanceData& prov_data, const TIPMDDocument& parser_md_doc,
-                    const std::map<uint32_t, std::map<uint32_t, std::set<uint16_t>>>& chanid_busnum_labels);
+                    const std::map<uint32_t, std::map<uint32_t, std::set<uint16_t>>>& chanid_busnum_labels,
+                    const PerfReport& perf_report);
 }  // namespace transtab429
 
 #endif  // TRANSLATE_TABULAR_ARINC429_MAIN_H_
\ No newline at end of file
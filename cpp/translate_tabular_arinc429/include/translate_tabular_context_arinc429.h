@@ -41,25 +41,25 @@ class TranslateTabularContextARINC429 : public TranslateTabularParquet
 {
 private:
 
-    // manages access to vectors of vectors of ICD elements
+    // manages access to vectors of vectors of ICD elements. The organized
+    // tables are shared by the contexts of all threads.
     ARINC429Data arinc_data_;
 
-    // map providing the arinc word name at a given table_index and vector index matching the
-    // arinc word data vector, vector<vector<ICDElement>>, found in element_table created by
-    // Organize429ICD
-    std::unordered_map<size_t,std::vector<std::string>> arinc_word_names_;
-
-    // Vectors into which row group column data will be copied
-    std::vector<int64_t> time_;       // should all be adjusted to be int64T? compare with 1553 time
-    std::vector<uint16_t> channelid_;
-    std::vector<uint8_t> bus_;
-    std::vector<uint16_t> label_;
-    std::vector<uint8_t> sdi_;
-    std::vector<uint32_t> data_;
-    std::vector<uint8_t> ssm_;
-    std::vector<uint8_t> parity_;
-
-    std::unordered_map<std::string, size_t> arinc_word_name_to_unique_index_map_;
+    // Row group column data. Types match the parsed data schema such
+    // that columns are not copied, except parity_, which is bit-packed.
+    RGColumn<int64_t> time_;
+    RGColumn<int32_t> channelid_;
+    RGColumn<int16_t> bus_;
+    RGColumn<int16_t> label_;
+    RGColumn<int8_t> sdi_;
+    RGColumn<int32_t> data_;
+    RGColumn<int8_t> ssm_;
+    RGColumn<uint8_t> parity_;
+
+    // Word group indices for which a missing word name has already been
+    // reported, such that the warning is logged once per index, not per row.
+    std::set<size_t> unnamed_word_group_indices_;
+
     std::map<uint32_t, std::map<uint32_t, std::set<uint16_t>>> chanid_busnum_labels_;
 
 
@@ -90,6 +90,12 @@ public:
 
     virtual bool FillRowGroupVectors();
 
+    /*
+    Filter row groups by the channel IDs and labels of the words in
+    the ARINC 429 lookup.
+    */
+    virtual bool SetRowGroupFilters(const size_t& thread_index);
+
 
 
     /*
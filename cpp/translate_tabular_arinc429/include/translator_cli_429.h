@@ -68,6 +68,13 @@ inline bool ConfigureTranslatorCLI429(CLIGroup& cli_group, TranslationConfigPara
         TranslateARINC429CLIHelpStrings::log_dir_help, "<output path directory>",
         config.log_path_str_)->DefaultUseValueOf(config.output_path_str_);
 
+    cli->AddOption<std::string>("--dts_cache_path", "", 
+        TranslateARINC429CLIHelpStrings::dts_cache_dir_help, "<output path directory>",
+        config.dts_cache_dir_str_)->DefaultUseValueOf(config.output_path_str_);
+
+    cli->AddOption<std::string>("--perf_stats", "", 
+        TranslateARINC429CLIHelpStrings::perf_stats_path_help, "", config.perf_stats_path_str_);
+
     cli->AddOption("--thread_count", "-t", 
         TranslateARINC429CLIHelpStrings::translate_thread_count_help, 1,
         config.translate_thread_count_)->ValidateInclusiveRangeIs(1, 128);
@@ -86,6 +93,10 @@ inline bool ConfigureTranslatorCLI429(CLIGroup& cli_group, TranslationConfigPara
         TranslateARINC429CLIHelpStrings::auto_sys_limits_help, true, 
         config.auto_sys_limits_);
 
+    cli->AddOption("--disable_dts_cache", "", 
+        TranslateARINC429CLIHelpStrings::disable_dts_cache_help, false, 
+        config.disable_dts_cache_);
+
     if(!cli_group.CheckConfiguration())
         return false;
     return true;
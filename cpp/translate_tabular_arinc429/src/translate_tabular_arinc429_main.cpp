@@ -52,112 +52,28 @@ int TranslateTabularARINC429Main(int argc, char** argv)
     }
 
     ArgumentValidation av;
-    ManagedPath input_path;
-    ManagedPath icd_path;
-    ManagedPath output_dir;
-    ManagedPath log_dir;
-    if ((retcode = transtab429::ValidatePaths(config.input_data_path_str_, config.input_dts_path_str_,
-        config.output_path_str_, config.log_path_str_, input_path, icd_path,
-        output_dir, log_dir, &av)) != 0)
+    Translation429State state;
+    if ((retcode = transtab429::ValidateInputs(config, &av, state)) != 0)
         return retcode;
 
-    if(av.CheckExtension(icd_path.RawString(), {"yaml", "yml"}))
-    {
-        YamlSV ysv;
-        std::string icd_string;
-        if(!av.ValidateDocument(icd_path, icd_string))
-            return EX_DATAERR;
-        std::vector<LogItem> log_items;
-        if(!ysv.Validate(icd_string, dts_429_schema, log_items))
-        {
-            printf("Schema validation failed for %s\n", icd_path.RawString().c_str());
-            int print_count = 20;
-            YamlSV::PrintLogItems(log_items, print_count, std::cout);
-            return EX_DATAERR;
-        }
-    }
-    else
-        return EX_DATAERR;
-
     spdlog::level::level_enum stdout_level = spdlog::level::from_str(config.stdout_log_level_);
     spdlog::level::level_enum file_level = spdlog::level::from_str(config.file_log_level_);
-    if (!transtab429::SetupLogging(log_dir, stdout_level, file_level))
+    if (!transtab429::SetupLogging(state.log_dir, stdout_level, file_level))
         return EX_SOFTWARE;
 
-    TIPMDDocument parser_md_doc;
-    ManagedPath parser_md_path = input_path / "_metadata.yaml";
-    if((retcode = transtab429::GetParsedMetadata(parser_md_path, parser_md_doc)) != 0)
-        return retcode;
-
-    ProvenanceData prov_data;
-    if((retcode = GetProvenanceData(icd_path.absolute(), 0, prov_data)) != 0)
+    if ((retcode = transtab429::PrepareTranslation(config, state)) != 0)
         return retcode;
 
-
-    // Use logger to print and record these values after logging
-    // is implemented.
-    SPDLOG_INFO(TRANSLATE_429_EXE_NAME " version: {:s}", prov_data.tip_version);
-    SPDLOG_INFO("Input: {:s}", input_path.RawString());
-    SPDLOG_INFO("Output dir: {:s}", output_dir.RawString());
-    SPDLOG_INFO("Log dir: {:s}", log_dir.RawString());
-    SPDLOG_INFO("DTS429 path: {:s}", icd_path.RawString());
-    SPDLOG_INFO("DTS429 hash: {:s}", prov_data.hash);
     size_t thread_count = config.translate_thread_count_;
-    SPDLOG_INFO("Thread count: {:d}", thread_count);
-
-    // Begin to read and process DTS429 here
-    size_t arinc429_message_count = 0;
-
-    // If subchannel name in DTS isn't in parsed metadata, add to following
-    // vector and output subchan names with translated metadata.
-    std::vector<std::string> subchannel_name_lookup_misses;
-
-    // get runtime data output from parser metadata
-    FileReader fr;
-    if(fr.ReadFile(parser_md_path.RawString()) != 0)
-    {
-        SPDLOG_ERROR("Failed to read input metadata file: {:s}",
-            parser_md_path.RawString());
-        return EX_NOINPUT;
-    }
-    YAML::Node root_node = YAML::Load(fr.GetDocumentAsString());
-    YAML::Node runtime_node = root_node["runtime"];
-
-    // DTS429 inputs
-    DTS429 dts429;
-    std::vector<std::string> dts429_contents;
-    if(!transtab429::GetFileContents(icd_path.RawString(), dts429_contents))
-        return EX_NOINPUT;
-
-    Organize429ICD org429;
-    ARINC429Data arinc429_dts_data;
-
-    if(!transtab429::IngestICD(&dts429, &org429, arinc429_dts_data,
-        dts429_contents, arinc429_message_count, runtime_node, subchannel_name_lookup_misses))
-    {
-        return EX_SOFTWARE;
-    }
-    SPDLOG_DEBUG(arinc429_dts_data.LookupMapToString());
-    // end reading and processing DTS429
-
     if (config.auto_sys_limits_)
     {
-        if (!transtab429::SetSystemLimits(static_cast<uint8_t>(thread_count), arinc429_message_count))
+        if (!transtab429::SetSystemLimits(static_cast<uint8_t>(thread_count),
+            state.arinc429_message_count))
             return EX_OSERR;
     }
 
     auto start_time = std::chrono::high_resolution_clock::now();
-    ManagedPath transl_output_dir = output_dir.CreatePathObject(input_path, "_translated");
-    if (!transl_output_dir.create_directory())
-        return EX_IOERR;
-    ManagedPath output_base_name("");
-    SPDLOG_INFO("Translated data output dir: {:s}", transl_output_dir.RawString());
-
-    std::set<std::string> translate_word_names;
-    std::map<uint32_t, std::map<uint32_t, std::set<uint16_t>>> chanid_busnum_labels;
-
-    if ((retcode = transtab429::Translate(thread_count, input_path, output_dir, arinc429_dts_data,
-                   transl_output_dir, output_base_name, translate_word_names, chanid_busnum_labels)) != 0)
+    if ((retcode = state.translator->Translate()) != 0)
     {
         SPDLOG_WARN(
             "Failed to configure 429 translation stage or an error occurred "
@@ -171,12 +87,10 @@ int TranslateTabularARINC429Main(int argc, char** argv)
     double duration = secs.count();
     SPDLOG_INFO("Duration: {:.3f} sec", duration);
 
-    if(!transtab429::RecordMetadata(config, transl_output_dir, icd_path,
-                                input_path, translate_word_names, prov_data,
-                                parser_md_doc, chanid_busnum_labels))
+    if ((retcode = transtab429::FinalizeTranslation(config, state)) != 0)
     {
         spdlog::shutdown();
-        return EX_IOERR;
+        return retcode;
     }
 
     // Avoid deadlock in windows, see
@@ -187,6 +101,148 @@ int TranslateTabularARINC429Main(int argc, char** argv)
 
 namespace transtab429
 {
+    int ValidateInputs(const TranslationConfigParams& config, ArgumentValidation* av,
+                    Translation429State& state)
+    {
+        int retcode = 0;
+        if ((retcode = ValidatePaths(config.input_data_path_str_, config.input_dts_path_str_,
+            config.output_path_str_, config.log_path_str_, state.input_path, state.icd_path,
+            state.output_dir, state.log_dir, av)) != 0)
+            return retcode;
+
+        if (!config.perf_stats_path_str_.empty() &&
+            !PerfReport::IsSupportedPath(ManagedPath(config.perf_stats_path_str_)))
+        {
+            printf("Performance statistics path \"%s\" does not have extension "
+                "\".json\" or \".prom\"\n", config.perf_stats_path_str_.c_str());
+            return EX_USAGE;
+        }
+
+        // Read the DTS cache prior to schema validation. A DTS which matches
+        // the cache has been validated by a previous translation.
+        if (!config.disable_dts_cache_)
+        {
+            state.dts_cache_hit = ReadDTSCache(state.icd_path, config.dts_cache_dir_str_, av,
+                state.dts_cache_path, state.dts_cache_key, &state.dts429, state.word_elements);
+        }
+
+        if(!state.dts_cache_hit)
+        {
+            if(av->CheckExtension(state.icd_path.RawString(), {"yaml", "yml"}))
+            {
+                YamlSV ysv;
+                std::string icd_string;
+                if(!av->ValidateDocument(state.icd_path, icd_string))
+                    return EX_DATAERR;
+                std::vector<LogItem> log_items;
+                if(!ysv.Validate(icd_string, dts_429_schema, log_items))
+                {
+                    printf("Schema validation failed for %s\n", state.icd_path.RawString().c_str());
+                    int print_count = 20;
+                    YamlSV::PrintLogItems(log_items, print_count, std::cout);
+                    return EX_DATAERR;
+                }
+            }
+            else
+                return EX_DATAERR;
+        }
+        return EX_OK;
+    }
+
+    int PrepareTranslation(const TranslationConfigParams& config,
+                    Translation429State& state)
+    {
+        int retcode = 0;
+        ManagedPath parser_md_path = state.input_path / "_metadata.yaml";
+        if((retcode = GetParsedMetadata(parser_md_path, state.parser_md_doc)) != 0)
+            return retcode;
+
+        if((retcode = GetProvenanceData(state.icd_path.absolute(), 0, state.prov_data)) != 0)
+            return retcode;
+
+        // Use logger to print and record these values after logging
+        // is implemented.
+        SPDLOG_INFO(TRANSLATE_429_EXE_NAME " version: {:s}", state.prov_data.tip_version);
+        SPDLOG_INFO("Input: {:s}", state.input_path.RawString());
+        SPDLOG_INFO("Output dir: {:s}", state.output_dir.RawString());
+        SPDLOG_INFO("Log dir: {:s}", state.log_dir.RawString());
+        SPDLOG_INFO("DTS429 path: {:s}", state.icd_path.RawString());
+        SPDLOG_INFO("DTS429 hash: {:s}", state.prov_data.hash);
+        size_t thread_count = config.translate_thread_count_;
+        SPDLOG_INFO("Thread count: {:d}", thread_count);
+
+        // get runtime data output from parser metadata
+        FileReader fr;
+        if(fr.ReadFile(parser_md_path.RawString()) != 0)
+        {
+            SPDLOG_ERROR("Failed to read input metadata file: {:s}",
+                parser_md_path.RawString());
+            return EX_NOINPUT;
+        }
+        YAML::Node root_node = YAML::Load(fr.GetDocumentAsString());
+        YAML::Node runtime_node = root_node["runtime"];
+
+        // DTS429 inputs
+        std::vector<std::string> dts429_contents;
+        if(state.dts_cache_hit)
+            SPDLOG_INFO("DTS429 read from cache: {:s}", state.dts_cache_path.RawString());
+        else if(!GetFileContents(state.icd_path.RawString(), dts429_contents))
+            return EX_NOINPUT;
+
+        Organize429ICD org429;
+        if(!IngestICD(&state.dts429, &org429, state.arinc429_dts_data,
+            dts429_contents, state.arinc429_message_count, runtime_node,
+            state.subchannel_name_lookup_misses, &state.word_elements))
+        {
+            return EX_SOFTWARE;
+        }
+
+        if(!state.dts_cache_hit && state.dts_cache_key != "")
+            WriteDTSCache(state.dts_cache_path, state.dts_cache_key, state.dts429,
+                state.word_elements);
+        SPDLOG_DEBUG(state.arinc429_dts_data.LookupMapToString());
+
+        state.transl_output_dir = state.output_dir.CreatePathObject(state.input_path, "_translated");
+        if (!state.transl_output_dir.create_directory())
+            return EX_IOERR;
+        SPDLOG_INFO("Translated data output dir: {:s}", state.transl_output_dir.RawString());
+
+        return CreateTranslator(thread_count, state.input_path, state.arinc429_dts_data,
+            state.transl_output_dir, state.output_base_name, state.translator);
+    }
+
+    int FinalizeTranslation(const TranslationConfigParams& config,
+                    Translation429State& state)
+    {
+        CollectTranslatedMsgNames(state.translator, state.translate_word_names,
+            state.chanid_busnum_labels);
+
+        PerfReport perf_report;
+        state.translator->AssemblePerfReport(perf_report);
+
+        if(!RecordMetadata(config, state.transl_output_dir, state.icd_path,
+                        state.input_path, state.translate_word_names, state.prov_data,
+                        state.parser_md_doc, state.chanid_busnum_labels, perf_report))
+        {
+            return EX_IOERR;
+        }
+
+        if (!config.perf_stats_path_str_.empty())
+        {
+            std::map<std::string, std::string> labels{
+                {"input", state.input_path.filename().RawString()}};
+            if (perf_report.Write(ManagedPath(config.perf_stats_path_str_), "tip_translate_arinc429",
+                labels) != EX_OK)
+            {
+                SPDLOG_ERROR("Failed to write performance statistics: {:s}",
+                    config.perf_stats_path_str_);
+                return EX_CANTCREAT;
+            }
+            SPDLOG_INFO("Performance statistics: {:s}", config.perf_stats_path_str_);
+        }
+        return EX_OK;
+    }
+
     int ValidatePaths(const std::string& str_input_path, const std::string& str_icd_path,
                     const std::string& str_output_dir, const std::string& str_log_dir,
                     ManagedPath& input_path, ManagedPath& icd_path,
@@ -276,7 +332,8 @@ namespace transtab429
     bool IngestICD(DTS429* dts429, Organize429ICD* org429, ARINC429Data& data429,
                     const std::vector<std::string>& icd_lines, size_t& arinc_message_count,
                     YAML::Node& parser_md_runtime_node,
-                    std::vector<std::string>& subchan_name_lookup_misses)
+                    std::vector<std::string>& subchan_name_lookup_misses,
+                    std::unordered_map<std::string, std::vector<ICDElement>>* word_elements)
     {
         auto start_time = std::chrono::high_resolution_clock::now();
 
@@ -289,12 +346,17 @@ namespace transtab429
         // OrganizeICDMap has access to tmats_chanid_to_429_subchan_and_name
 
         // DTS429
-        std::unordered_map<std::string, std::vector<ICDElement>> word_elements;
-        if(!dts429->IngestLines(icd_lines, word_elements))
-            return false;
+        std::unordered_map<std::string, std::vector<ICDElement>> local_word_elements;
+        if(word_elements == nullptr)
+            word_elements = &local_word_elements;
+        if(word_elements->empty())
+        {
+            if(!dts429->IngestLines(icd_lines, *word_elements))
+                return false;
+        }
 
         // Organize429ICD inputs
-        if(!org429->OrganizeICDMap(word_elements, parser_md_runtime_node, organized_lookup_map, element_table))
+        if(!org429->OrganizeICDMap(*word_elements, parser_md_runtime_node, organized_lookup_map, element_table))
             return false;
 
         subchan_name_lookup_misses = org429->GetSubchannelNameLookupMisses();
@@ -312,6 +374,53 @@ namespace transtab429
         return true;
     }
 
+    bool ReadDTSCache(const ManagedPath& dts_path, const std::string& cache_dir_str,
+                    ArgumentValidation* av, ManagedPath& cache_path, std::string& cache_key,
+                    DTS429* dts429,
+                    std::unordered_map<std::string, std::vector<ICDElement>>& word_elements)
+    {
+        cache_key = "";
+        ManagedPath cache_dir;
+        if (!av->ValidateDirectoryPath(cache_dir_str, cache_dir))
+        {
+            printf("DTS cache path \"%s\" is not a valid directory, DTS cache disabled\n",
+                cache_dir_str.c_str());
+            return false;
+        }
+
+        std::string dts_hash;
+        if (ComputeFileSHA256(dts_path, dts_hash) != 0)
+            return false;
+
+        cache_key = dts_hash;
+        cache_path = cache_dir / ("dts429_" + dts_hash.substr(0, 16) + ".tipcache");
+        BinaryCacheReader reader;
+        if (reader.Open(cache_path, cache_key, GetVersionString()) != EX_OK)
+            return false;
+
+        if (!dts429->ReadCache(reader, word_elements))
+        {
+            printf("Failed to read DTS cache %s, ingesting DTS\n", cache_path.RawString().c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool WriteDTSCache(const ManagedPath& cache_path, const std::string& cache_key,
+                    const DTS429& dts429,
+                    const std::unordered_map<std::string, std::vector<ICDElement>>& word_elements)
+    {
+        BinaryCacheWriter writer;
+        dts429.WriteCache(writer, word_elements);
+        if (writer.Save(cache_path, cache_key, GetVersionString()) != EX_OK)
+        {
+            SPDLOG_WARN("Failed to write DTS cache: {:s}", cache_path.RawString());
+            return false;
+        }
+        SPDLOG_INFO("Wrote DTS cache: {:s}", cache_path.RawString());
+        return true;
+    }
+
     int GetParsedMetadata(const ManagedPath& input_md_path,
         TIPMDDocument& parser_md_doc)
     {
@@ -391,6 +500,26 @@ namespace transtab429
             const ManagedPath& output_base_name,
             std::set<std::string>& translated_msg_names,
             std::map<uint32_t, std::map<uint32_t, std::set<uint16_t>>>& chanid_busnum_labels_map)
+    {
+        std::shared_ptr<TranslateTabular> translator;
+        int retcode = 0;
+        if ((retcode = CreateTranslator(thread_count, input_path, icd, translated_data_dir,
+            output_base_name, translator)) != 0)
+            return retcode;
+
+        if ((retcode = translator->Translate()) != 0)
+        {
+            return retcode;
+        }
+
+        CollectTranslatedMsgNames(translator, translated_msg_names, chanid_busnum_labels_map);
+        return EX_OK;
+    }
+
+    int CreateTranslator(size_t thread_count, const ManagedPath& input_path,
+            const ARINC429Data& icd, const ManagedPath& translated_data_dir,
+            const ManagedPath& output_base_name,
+            std::shared_ptr<TranslateTabular>& translator)
     {
         // Get list of input files
         bool success = false;
@@ -419,21 +548,22 @@ namespace transtab429
 
 
         // Create primary object which controls translation
-        TranslateTabular translate(thread_count, context);
-        if (!translate.SetInputFiles(dir_entries, ".parquet"))
+        translator = std::make_shared<TranslateTabular>(thread_count, context);
+        if (!translator->SetInputFiles(dir_entries, ".parquet"))
         {
             return EX_SOFTWARE;
         }
 
-        translate.SetOutputDir(translated_data_dir, output_base_name);
-        int retcode = 0;
-        if ((retcode = translate.Translate()) != 0)
-        {
-            return retcode;
-        }
+        translator->SetOutputDir(translated_data_dir, output_base_name);
+        return EX_OK;
+    }
 
+    void CollectTranslatedMsgNames(std::shared_ptr<TranslateTabular> translator,
+            std::set<std::string>& translated_msg_names,
+            std::map<uint32_t, std::map<uint32_t, std::set<uint16_t>>>& chanid_busnum_labels_map)
+    {
         // Collect the translated message names from each of the Context objects.
-        std::vector<std::shared_ptr<TranslationManager>> managers = translate.GetManagers();
+        std::vector<std::shared_ptr<TranslationManager>> managers = translator->GetManagers();
         std::shared_ptr<TranslateTabularContextARINC429> ctx;
         for (size_t i = 0; i < managers.size(); i++)
         {
@@ -448,8 +578,6 @@ namespace transtab429
             chanid_busnum_labels_map.insert(temp_chanid_busname_labels.begin(),
                                         temp_chanid_busname_labels.end());
         }
-
-        return EX_OK;
     }
 
     bool RecordMetadata(const TranslationConfigParams& config,
@@ -458,7 +586,8 @@ namespace transtab429
                         const ManagedPath& input_path,
                         const std::set<std::string>& translated_messages,
                         const ProvenanceData& prov_data, const TIPMDDocument& parser_md_doc,
-                        const std::map<uint32_t, std::map<uint32_t, std::set<uint16_t>>>& chanid_busnum_labels)
+                        const std::map<uint32_t, std::map<uint32_t, std::set<uint16_t>>>& chanid_busnum_labels,
+                        const PerfReport& perf_report)
 
     {
         TIPMDDocument md;
@@ -518,6 +647,14 @@ namespace transtab429
         md.runtime_category_->SetArbitraryMappedValue("translated_chanid_busnum_labels_mapping",
             chanid_busnum_labels);
 
+        // Per-worker counts and stage times
+        md.runtime_category_->SetArbitraryMappedValue("perf_counts",
+            perf_report.GetTotal().GetCounts());
+        md.runtime_category_->SetArbitraryMappedValue("perf_times_sec",
+            perf_report.GetTotal().GetTimesSec());
+        md.runtime_category_->SetArbitraryMappedValue("perf_worker_times_sec",
+            perf_report.GetWorkerTimesSec());
+
         // Get a string containing the complete metadata output and
         // and write it to the yaml file.
         md.CreateDocument();
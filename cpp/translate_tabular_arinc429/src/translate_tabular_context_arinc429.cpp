@@ -4,13 +4,7 @@ TranslateTabularContextARINC429::TranslateTabularContextARINC429(ARINC429Data ic
                                                                 : TranslateTabularParquet(),
                                                                 arinc_data_(icd),
                                                                 translated_msg_names(translated_msg_names_)
-{
-    arinc_data_ = icd;
-    arinc_word_names_ = arinc_data_.GetArincWordNamesMap();
-
-    arinc_word_name_to_unique_index_map_ = arinc_data_.GetNamesToUniqueIndexMap();
-
-}
+{}
 
 std::shared_ptr<TranslateTabularContextBase> TranslateTabularContextARINC429::Clone()
 {
@@ -31,28 +25,36 @@ TranslateStatus TranslateTabularContextARINC429::ConsumeRowGroup(const size_t& t
     // Iterate over each row in the row group
     size_t table_index = 0;;
     size_t word_group_index = 0;
-    std::vector<std::vector<ICDElement>> indexed_element_vectors;
+    const std::vector<std::vector<ICDElement>>* indexed_element_vectors = nullptr;
     size_t  elem_vec_index;
+    size_t word_name_count = 0;
     ManagedPath output_path;
-    std::string table_name = "";
     bool result = false;
+    uint16_t channelid;
     uint16_t subchannel_id;
+    uint16_t label;
     int8_t sdi;
     int8_t sign = 0;
+    const std::vector<std::vector<std::string>>& word_group_names =
+        arinc_data_.GetWordGroupNames();
+    const std::vector<std::vector<size_t>>& word_group_unique_indices =
+        arinc_data_.GetWordGroupUniqueIndices();
 
     for (size_t row_ind = 0; row_ind < current_row_group_row_count_; row_ind++)
     {
         // Why are these casts necessary? Just because of the argument data types
         // to IdentifyWord? Why is SDI, originally a uint8_t, cast to signed?
+        channelid = static_cast<uint16_t>(channelid_[row_ind]);
         subchannel_id = static_cast<uint16_t>(bus_[row_ind]);
+        label = static_cast<uint16_t>(label_[row_ind]);
         sdi = static_cast<int8_t>(sdi_[row_ind]);
 
         // Use the ICD lookup created from the DTS1553 to identify all table
         // indices which match the given criteria.
         if(!arinc_data_.IdentifyWord( word_group_index,
-                                      channelid_[row_ind],
+                                      channelid,
                                       subchannel_id,
-                                      label_[row_ind],
+                                      label,
                                       sdi))
         {
             // SPDLOG_WARN("Failed to identify word with channelid {:d}, subchannel_id {:d}, "
@@ -71,14 +73,28 @@ TranslateStatus TranslateTabularContextARINC429::ConsumeRowGroup(const size_t& t
             continue;
         }
 
+        word_name_count = 0;
+        if(word_group_index < word_group_names.size())
+            word_name_count = word_group_names[word_group_index].size();
+
         // Iterate over vectors<ICDElement> in indexed_element_vectors
         // Create a TranslatableTable or append data to an existing table.
-        for(elem_vec_index = 0; elem_vec_index < indexed_element_vectors.size();
+        for(elem_vec_index = 0; elem_vec_index < indexed_element_vectors->size();
             elem_vec_index++)
         {
+            if(elem_vec_index >= word_name_count)
+            {
+                if(unnamed_word_group_indices_.insert(word_group_index).second)
+                {
+                    SPDLOG_WARN("No word name for word_group_index = {:d}, position {:d}",
+                        word_group_index, elem_vec_index);
+                }
+                break;
+            }
+
             // table_name = name of ARINC 429 word associated with the ICDElement vector
-            table_name = arinc_word_names_[word_group_index][elem_vec_index];
-            table_index = arinc_word_name_to_unique_index_map_.at(table_name);
+            const std::string& table_name = word_group_names[word_group_index][elem_vec_index];
+            table_index = word_group_unique_indices[word_group_index][elem_vec_index];
 
             SPDLOG_DEBUG("Table Name: {:s}, channelid: {:d}, subchanid: {:d}, "
                         "table_index: {:d}", table_name, channelid_[row_ind],
@@ -99,7 +115,7 @@ TranslateStatus TranslateTabularContextARINC429::ConsumeRowGroup(const size_t& t
 
                 SPDLOG_DEBUG("{:02d} Creating table with index {:d}",
                             thread_index, table_index);
-                result = CreateTable(indexed_element_vectors[elem_vec_index], table_index,
+                result = CreateTable((*indexed_element_vectors)[elem_vec_index], table_index,
                     table_index_to_table_map_, output_path, thread_index,
                     table_name, elem_vec_index);
 
@@ -113,10 +129,10 @@ TranslateStatus TranslateTabularContextARINC429::ConsumeRowGroup(const size_t& t
                     continue;
                 }
                 translated_msg_names_.insert(table_name);
-                chanid_busnum_labels_[channelid_[row_ind]][subchannel_id].insert(label_[row_ind]);
+                chanid_busnum_labels_[channelid][subchannel_id].insert(label);
             }
 
-            if(!arinc_data_.SSMSignForBCD(ssm_[row_ind], sign))
+            if(!arinc_data_.SSMSignForBCD(static_cast<uint8_t>(ssm_[row_ind]), sign))
                 sign = 1;
 
             // Append data to the table if it is valid.
@@ -134,37 +150,40 @@ bool TranslateTabularContextARINC429::FillRowGroupVectors()
 {
     int row_count = 0;
 
-    // Read relevant columns into vectors.
-    if (!FillRGVector<int64_t, arrow::NumericArray<arrow::Int64Type>>(time_,
+    // Read all relevant columns in a single read.
+    if (!ReadRowGroupColumns())
+        return false;
+
+    if (!FillRGColumn<int64_t, arrow::NumericArray<arrow::Int64Type>>(time_,
                                                                        "time", row_count, false))
         return false;
 
-    if (!FillRGVector<uint16_t, arrow::NumericArray<arrow::Int32Type>>(channelid_,
+    if (!FillRGColumn<int32_t, arrow::NumericArray<arrow::Int32Type>>(channelid_,
                                                                        "channelid", row_count, false))
         return false;
 
-    if (!FillRGVector<uint8_t, arrow::NumericArray<arrow::Int16Type>>(bus_,
-                                                                     "bus", row_count, false))
+    if (!FillRGColumn<int16_t, arrow::NumericArray<arrow::Int16Type>>(bus_,
+                                                                       "bus", row_count, false))
         return false;
 
-    if (!FillRGVector<uint16_t, arrow::NumericArray<arrow::Int16Type>>(label_,
-                                                                     "label", row_count, false))
+    if (!FillRGColumn<int16_t, arrow::NumericArray<arrow::Int16Type>>(label_,
+                                                                       "label", row_count, false))
         return false;
 
-    if (!FillRGVector<uint8_t, arrow::NumericArray<arrow::Int8Type>>(sdi_,
+    if (!FillRGColumn<int8_t, arrow::NumericArray<arrow::Int8Type>>(sdi_,
                                                                      "SDI", row_count, false))
         return false;
 
-    if (!FillRGVector<uint32_t, arrow::NumericArray<arrow::Int32Type>>(data_,
-                                                                     "data", row_count, false))
+    if (!FillRGColumn<int32_t, arrow::NumericArray<arrow::Int32Type>>(data_,
+                                                                       "data", row_count, false))
         return false;
 
-    if (!FillRGVector<uint8_t, arrow::NumericArray<arrow::Int8Type>>(ssm_,
+    if (!FillRGColumn<int8_t, arrow::NumericArray<arrow::Int8Type>>(ssm_,
                                                                      "SSM", row_count, false))
         return false;
 
-    if (!FillRGVector<uint8_t, arrow::NumericArray<arrow::BooleanType>>(parity_,
-                                                                     "parity", row_count, false))
+    if (!FillRGColumn<uint8_t, arrow::BooleanArray>(parity_,
+                                                    "parity", row_count, false))
         return false;
 
     current_row_group_row_count_ = row_count;
@@ -172,6 +191,24 @@ bool TranslateTabularContextARINC429::FillRowGroupVectors()
 }
 
 
+bool TranslateTabularContextARINC429::SetRowGroupFilters(const size_t& thread_index)
+{
+    std::set<uint16_t> channelids;
+    std::set<uint16_t> labels;
+    arinc_data_.GetLookupKeys(channelids, labels);
+    SPDLOG_DEBUG("{:02d} Row group filters: {:d} channel IDs, {:d} labels",
+                 thread_index, channelids.size(), labels.size());
+
+    if (!pq_reader_.SetRowGroupFilter("channelid",
+        std::set<int64_t>(channelids.cbegin(), channelids.cend())))
+        return false;
+
+    if (!pq_reader_.SetRowGroupFilter("label",
+        std::set<int64_t>(labels.cbegin(), labels.cend())))
+        return false;
+    return true;
+}
+
 bool TranslateTabularContextARINC429::CreateTable(const std::vector<ICDElement>& icd_data, size_t table_index,
                                               std::unordered_map<size_t, std::shared_ptr<TranslatableTableBase>>& table_map,
                                               const ManagedPath& output_path, const size_t& thread_index,
@@ -206,7 +243,7 @@ bool TranslateTabularContextARINC429::CreateTable(const std::vector<ICDElement>&
         if (!AppendColumnFromICDElement(table_ptr, *it))
         {
             SPDLOG_WARN("{:02d} Failed to create column: {:s}, table: {:s}",
-                        thread_index, it->elem_name_, table_name);
+                        thread_index, it->elem_name_.str(), table_name);
             return false;
         }
     }
@@ -373,7 +410,7 @@ bool TranslateTabularContextARINC429::AppendColumnFromICDElement(
     if (!result)
     {
         SPDLOG_WARN("Failed to AppendColumn for element: {:s}, schema: value {:d}",
-                    icd_elem.elem_name_, static_cast<uint8_t>(icd_elem.schema_));
+                    icd_elem.elem_name_.str(), static_cast<uint8_t>(icd_elem.schema_));
         return false;
     }
 
@@ -0,0 +1,156 @@
+#ifndef CANBUS_DATA_H_
+#define CANBUS_DATA_H_
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "icd_element.h"
+#include "spdlog/spdlog.h"
+
+/*
+Definition of a CAN message to be translated. Elements are located in
+the 8-byte payload as four 16-bit words, where word n holds payload
+bytes 2n (least significant) and 2n + 1, see ICDElement::offset_.
+*/
+class CANBusMsgDef
+{
+   public:
+    // Name of the message and the output table
+    std::string name;
+
+    // Ch10 channel ID of the CAN bus
+    uint16_t channel_id;
+
+    // 11-bit standard or 29-bit extended identifier
+    uint32_t can_id;
+
+    // True if can_id is an extended identifier
+    bool extended;
+
+    // Elements (columns) of the message
+    std::vector<ICDElement> elements;
+
+    CANBusMsgDef() : name(""), channel_id(0), can_id(0), extended(false), elements() {}
+};
+
+/*
+CANBusData identifies CAN messages by channel ID and CAN identifier.
+
+Standard identifiers are looked up in a flat table of 2048 message
+indices per channel ID, such that identifying a frame is two array
+reads. A flat table of the 29-bit extended identifier space is not
+practical, so extended identifiers are looked up in a hash map.
+
+The organized tables are not modified after Initialize. Copies of
+CANBusData, such as those held by the translation context of each
+thread, share a single Tables object.
+*/
+class CANBusData
+{
+   private:
+    struct Tables
+    {
+        std::vector<CANBusMsgDef> msg_defs;
+
+        // Slot of each channel ID in standard_lookup, indexed by
+        // channel ID, or no_slot_ if the channel has no standard
+        // identifier messages.
+        std::vector<uint32_t> channel_slots;
+
+        // Message index for each slot and 11-bit identifier, at
+        // slot * standard_id_count_ + identifier, or no_msg_index_.
+        std::vector<uint32_t> standard_lookup;
+
+        // Message index by (channel ID << 32 | extended identifier)
+        std::unordered_map<uint64_t, uint32_t> extended_lookup;
+    };
+    std::shared_ptr<const Tables> tables_;
+
+    static const uint32_t no_slot_;
+    static const uint32_t no_msg_index_;
+
+   public:
+    static const size_t standard_id_count_;
+    static const uint32_t max_standard_id_;
+    static const uint32_t max_extended_id_;
+
+    // Count of 16-bit words in the 8-byte CAN payload
+    static const size_t payload_word_count_;
+
+    CANBusData() : tables_(std::make_shared<Tables>()) {}
+    virtual ~CANBusData() {}
+
+    /*
+    Validate message definitions and build the lookup tables.
+
+    Args:
+        msg_defs    --> Message definitions. Names must be unique and
+                        not empty, identifiers must be in range for
+                        the identifier type, the (channel ID, identifier,
+                        identifier type) of each message must be unique
+                        and elements must be within the payload.
+
+    Return:
+        True if all definitions are valid; false otherwise, in which
+        case the object is not modified.
+    */
+    bool Initialize(const std::vector<CANBusMsgDef>& msg_defs);
+
+    /*
+    Identify a message.
+
+    Args:
+        channel_id  --> Ch10 channel ID
+        can_id      --> CAN identifier
+        extended    --> True if can_id is an extended identifier
+        msg_index   --> Output, index of the message in GetMsgDefs
+
+    Return:
+        True if a message is defined for the inputs; false otherwise.
+    */
+    bool Find(uint16_t channel_id, uint32_t can_id, bool extended, size_t& msg_index) const
+    {
+        const Tables& tables = *tables_;
+        if (extended)
+        {
+            std::unordered_map<uint64_t, uint32_t>::const_iterator it =
+                tables.extended_lookup.find((static_cast<uint64_t>(channel_id) << 32) | can_id);
+            if (it == tables.extended_lookup.cend())
+                return false;
+            msg_index = it->second;
+            return true;
+        }
+
+        if (channel_id >= tables.channel_slots.size() || can_id > max_standard_id_)
+            return false;
+        uint32_t slot = tables.channel_slots[channel_id];
+        if (slot == no_slot_)
+            return false;
+        uint32_t index = tables.standard_lookup[slot * standard_id_count_ + can_id];
+        if (index == no_msg_index_)
+            return false;
+        msg_index = index;
+        return true;
+    }
+
+    const std::vector<CANBusMsgDef>& GetMsgDefs() const { return tables_->msg_defs; }
+
+    /*
+    Get the channel IDs and identifiers of the messages, i.e., the
+    values of the channelid and id columns of parsed data which may be
+    identified as a message by Find.
+
+    Args:
+        msg_indices --> Indices of the messages, all messages if empty
+        chanids     --> Output set of channel IDs
+        can_ids     --> Output set of identifiers
+    */
+    void GetLookupKeys(const std::set<size_t>& msg_indices, std::set<uint16_t>& chanids,
+                       std::set<uint32_t>& can_ids) const;
+};
+
+#endif  // CANBUS_DATA_H_
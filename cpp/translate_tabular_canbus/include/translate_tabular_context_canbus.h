@@ -0,0 +1,112 @@
+#ifndef TRANSLATE_TABULAR_CONTEXT_CANBUS_H_
+#define TRANSLATE_TABULAR_CONTEXT_CANBUS_H_
+
+#include <string>
+#include <set>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+/*
+Include parquet_reader.h first
+*/
+#include "parquet_reader.h"
+#include "translate_tabular_parquet.h"
+#include "translatable_table_base.h"
+#include "canbus_data.h"
+#include "icd_element.h"
+#include "managed_path.h"
+#include "spdlog/spdlog.h"
+
+/*
+Translate parsed CAN bus data, see ParquetCANBus. Each row is identified
+as a message by CANBusData::Find and the 8-byte payload is passed to the
+table of the message as four 16-bit raw data words.
+
+Data column names must include time, channelid, id, IDE and data.
+*/
+class TranslateTabularContextCANBus : public TranslateTabularParquet
+{
+   private:
+    // Message definitions and lookup, shared by the contexts of all
+    // threads.
+    CANBusData can_data_;
+
+    // User-selected message names and the corresponding indices of
+    // the messages in can_data_. All messages are translated if empty.
+    std::set<std::string> selected_msg_names_;
+    std::set<size_t> selected_msg_indices_;
+
+    // Row group column data. Types match the parsed data schema such
+    // that columns are not copied, except IDE_, which is bit-packed.
+    RGColumn<int64_t> time_;
+    RGColumn<int32_t> channelid_;
+    RGColumn<int32_t> id_;
+    RGColumn<uint8_t> IDE_;
+    RGColumn<int64_t> data_;
+
+   public:
+    const std::set<std::string>& translated_msg_names;
+
+    TranslateTabularContextCANBus(const CANBusData& can_data,
+                                  const std::set<std::string>& selected_msg_names);
+    virtual ~TranslateTabularContextCANBus() {}
+
+    const CANBusData& GetCANBusData() const { return can_data_; }
+    const std::set<size_t>& GetSelectedMsgIndices() const { return selected_msg_indices_; }
+
+
+    //////////////////////////////////////////////////////////////////
+    //                     Internal Functions
+    //////////////////////////////////////////////////////////////////
+
+    virtual std::shared_ptr<TranslateTabularContextBase> Clone();
+
+    /*
+    Get vectors of data from the current row group and iterate
+    over data, identify messages, create tables, and translate as
+    necessary.
+    */
+    virtual TranslateStatus ConsumeRowGroup(const size_t& thread_index);
+
+    virtual bool FillRowGroupVectors();
+
+    /*
+    Filter row groups by the channel IDs and identifiers of the
+    messages, limited to the selected messages if messages are
+    selected.
+    */
+    virtual bool SetRowGroupFilters(const size_t& thread_index);
+
+    /*
+    Create the table of a message with a time column and a column
+    for each element of the message.
+
+    Args:
+        msg_index       --> Index of the message in CANBusData::GetMsgDefs
+        output_path     --> Complete output path for table data
+        thread_index    --> Index of the thread in which the context is
+                            processed
+
+    Return:
+        True if no problems occur; false otherwise.
+    */
+    bool CreateTable(size_t msg_index, const ManagedPath& output_path,
+                     const size_t& thread_index);
+
+    /*
+    Adapt ICDElement data to TranslateTabularContextBase::AppendColumn.
+
+    Args:
+        table_ptr       --> Pointer to table to which a column should be appended
+        icd_elem        --> Configured ICDElement object
+
+    Return:
+        True if no errors; false otherwise.
+    */
+    bool AppendColumnFromICDElement(std::shared_ptr<TranslatableTableBase>& table_ptr,
+                                    const ICDElement& icd_elem);
+};
+
+#endif  // TRANSLATE_TABULAR_CONTEXT_CANBUS_H_
@@ -0,0 +1,88 @@
+#include "canbus_data.h"
+
+const uint32_t CANBusData::no_slot_ = std::numeric_limits<uint32_t>::max();
+const uint32_t CANBusData::no_msg_index_ = std::numeric_limits<uint32_t>::max();
+const size_t CANBusData::standard_id_count_ = 2048;
+const uint32_t CANBusData::max_standard_id_ = 0x7FF;
+const uint32_t CANBusData::max_extended_id_ = 0x1FFFFFFF;
+const size_t CANBusData::payload_word_count_ = 4;
+
+bool CANBusData::Initialize(const std::vector<CANBusMsgDef>& msg_defs)
+{
+    std::shared_ptr<Tables> tables = std::make_shared<Tables>();
+    std::set<std::string> names;
+    for (size_t i = 0; i < msg_defs.size(); i++)
+    {
+        const CANBusMsgDef& def = msg_defs[i];
+        if (def.name.empty() || !names.insert(def.name).second)
+        {
+            SPDLOG_WARN("CAN message name is empty or not unique: \"{:s}\"", def.name);
+            return false;
+        }
+
+        if (def.can_id > (def.extended ? max_extended_id_ : max_standard_id_))
+        {
+            SPDLOG_WARN("CAN message {:s} identifier {:#x} is out of range", def.name,
+                        def.can_id);
+            return false;
+        }
+
+        for (std::vector<ICDElement>::const_iterator it = def.elements.cbegin();
+             it != def.elements.cend(); ++it)
+        {
+            if (static_cast<size_t>(it->offset_) + it->elem_word_count_ > payload_word_count_)
+            {
+                SPDLOG_WARN("CAN message {:s} element {:s} is not within the payload",
+                            def.name, it->elem_name_.str());
+                return false;
+            }
+        }
+
+        uint32_t index = static_cast<uint32_t>(i);
+        if (def.extended)
+        {
+            uint64_t key = (static_cast<uint64_t>(def.channel_id) << 32) | def.can_id;
+            if (!tables->extended_lookup.emplace(key, index).second)
+            {
+                SPDLOG_WARN("CAN message {:s} channel ID and identifier are not unique",
+                            def.name);
+                return false;
+            }
+            continue;
+        }
+
+        if (def.channel_id >= tables->channel_slots.size())
+            tables->channel_slots.resize(static_cast<size_t>(def.channel_id) + 1, no_slot_);
+        uint32_t& slot = tables->channel_slots[def.channel_id];
+        if (slot == no_slot_)
+        {
+            slot = static_cast<uint32_t>(tables->standard_lookup.size() / standard_id_count_);
+            tables->standard_lookup.resize(tables->standard_lookup.size() + standard_id_count_,
+                                           no_msg_index_);
+        }
+        uint32_t& entry = tables->standard_lookup[slot * standard_id_count_ + def.can_id];
+        if (entry != no_msg_index_)
+        {
+            SPDLOG_WARN("CAN message {:s} channel ID and identifier are not unique", def.name);
+            return false;
+        }
+        entry = index;
+    }
+
+    tables->msg_defs = msg_defs;
+    tables_ = tables;
+    return true;
+}
+
+void CANBusData::GetLookupKeys(const std::set<size_t>& msg_indices,
+                               std::set<uint16_t>& chanids, std::set<uint32_t>& can_ids) const
+{
+    const std::vector<CANBusMsgDef>& defs = tables_->msg_defs;
+    for (size_t i = 0; i < defs.size(); i++)
+    {
+        if (!msg_indices.empty() && msg_indices.count(i) == 0)
+            continue;
+        chanids.insert(defs[i].channel_id);
+        can_ids.insert(defs[i].can_id);
+    }
+}
@@ -0,0 +1,237 @@
+#include "translate_tabular_context_canbus.h"
+
+TranslateTabularContextCANBus::TranslateTabularContextCANBus(const CANBusData& can_data,
+    const std::set<std::string>& selected_msg_names) : TranslateTabularParquet(),
+    can_data_(can_data), selected_msg_names_(selected_msg_names), selected_msg_indices_(),
+    translated_msg_names(translated_msg_names_)
+{
+    const std::vector<CANBusMsgDef>& defs = can_data_.GetMsgDefs();
+    for (size_t i = 0; i < defs.size(); i++)
+    {
+        if (selected_msg_names_.count(defs[i].name) == 1)
+            selected_msg_indices_.insert(i);
+    }
+}
+
+std::shared_ptr<TranslateTabularContextBase> TranslateTabularContextCANBus::Clone()
+{
+    std::shared_ptr<TranslateTabularContextCANBus> temp =
+        std::make_shared<TranslateTabularContextCANBus>(this->can_data_,
+                                                        this->selected_msg_names_);
+    temp->SetColumnNames(this->ridealong_col_names_, this->data_col_names_);
+    return temp;
+}
+
+TranslateStatus TranslateTabularContextCANBus::ConsumeRowGroup(const size_t& thread_index)
+{
+    TranslateStatus status = ReadRowGroup(thread_index, input_row_group_count_, row_group_index_);
+    if(status != TranslateStatus::OK)
+        return status;
+
+    const std::vector<CANBusMsgDef>& defs = can_data_.GetMsgDefs();
+    bool should_select_msgs = !selected_msg_names_.empty();
+    ManagedPath output_path;
+    size_t msg_index = 0;
+    bool result = false;
+    for (size_t row_ind = 0; row_ind < current_row_group_row_count_; row_ind++)
+    {
+        if (!can_data_.Find(static_cast<uint16_t>(channelid_[row_ind]),
+                            static_cast<uint32_t>(id_[row_ind]), IDE_[row_ind] != 0, msg_index))
+            continue;
+
+        if (should_select_msgs && selected_msg_indices_.count(msg_index) == 0)
+            continue;
+
+        const std::string& table_name = defs[msg_index].name;
+        if (table_indices_.count(msg_index) == 0)
+        {
+            output_path = CreateTableOutputPath(output_dir_, output_base_path_,
+                                                table_name, thread_index);
+            if(!CreateTableOutputDir(thread_index, output_path, table_name))
+                return TranslateStatus::FAIL;
+
+            SPDLOG_DEBUG("{:02d} Creating table with index {:d}", thread_index, msg_index);
+            result = CreateTable(msg_index, output_path, thread_index);
+            table_indices_.insert(msg_index);
+
+            if (!result)
+            {
+                SPDLOG_WARN("{:02d} Failed to create table for message: {:s}",
+                            thread_index, table_name);
+                continue;
+            }
+            translated_msg_names_.insert(table_name);
+        }
+
+        // The payload is stored as the bit pattern of a little-endian
+        // int64, the bytes of which are the four 16-bit raw data words.
+        AppendTimeAndRawDataToTable(thread_index, table_index_to_table_map_[msg_index],
+            reinterpret_cast<const uint8_t*>(time_.data() + row_ind),
+            reinterpret_cast<const uint8_t*>(data_.data() + row_ind),
+            CANBusData::payload_word_count_, table_name);
+    }
+    return TranslateStatus::OK;
+}
+
+bool TranslateTabularContextCANBus::FillRowGroupVectors()
+{
+    int row_count = 0;
+
+    // Read all relevant columns in a single read.
+    if (!ReadRowGroupColumns())
+        return false;
+
+    if (!FillRGColumn<int64_t, arrow::NumericArray<arrow::Int64Type>>(time_,
+                                                                       "time", row_count, false))
+        return false;
+
+    if (!FillRGColumn<int32_t, arrow::NumericArray<arrow::Int32Type>>(channelid_,
+                                                                       "channelid", row_count, false))
+        return false;
+
+    if (!FillRGColumn<int32_t, arrow::NumericArray<arrow::Int32Type>>(id_,
+                                                                       "id", row_count, false))
+        return false;
+
+    if (!FillRGColumn<uint8_t, arrow::BooleanArray>(IDE_, "IDE", row_count, false))
+        return false;
+
+    if (!FillRGColumn<int64_t, arrow::NumericArray<arrow::Int64Type>>(data_,
+                                                                       "data", row_count, false))
+        return false;
+
+    current_row_group_row_count_ = row_count;
+    return true;
+}
+
+bool TranslateTabularContextCANBus::SetRowGroupFilters(const size_t& thread_index)
+{
+    std::set<uint16_t> chanids;
+    std::set<uint32_t> can_ids;
+
+    // None of the selected messages are defined, so no rows are translated.
+    if (!selected_msg_names_.empty() && selected_msg_indices_.empty())
+        return true;
+
+    can_data_.GetLookupKeys(selected_msg_indices_, chanids, can_ids);
+    SPDLOG_DEBUG("{:02d} Row group filters: {:d} channel IDs, {:d} CAN identifiers",
+                 thread_index, chanids.size(), can_ids.size());
+
+    if (!pq_reader_.SetRowGroupFilter("channelid",
+        std::set<int64_t>(chanids.cbegin(), chanids.cend())))
+        return false;
+
+    if (!pq_reader_.SetRowGroupFilter("id",
+        std::set<int64_t>(can_ids.cbegin(), can_ids.cend())))
+        return false;
+    return true;
+}
+
+bool TranslateTabularContextCANBus::CreateTable(size_t msg_index, const ManagedPath& output_path,
+                                                const size_t& thread_index)
+{
+    const CANBusMsgDef& def = can_data_.GetMsgDefs().at(msg_index);
+    size_t row_group_size = current_row_group_row_count_;
+    if (!CreateTranslatableTable(def.name, row_group_size, msg_index,
+                                 table_index_to_table_map_, output_path, thread_index))
+    {
+        SPDLOG_WARN("{:02d} Failed to Create table: {:s}", thread_index, def.name);
+        return false;
+    }
+
+    std::shared_ptr<TranslatableTableBase>& table_ptr = table_index_to_table_map_[msg_index];
+    ICDElement icd_elem;
+    icd_elem.elem_word_count_ = 1;
+    if (!AppendColumn<uint16_t, int64_t>(table_ptr, "time", true, icd_elem))
+    {
+        SPDLOG_WARN("{:02d} Failed to create \"time\" column", thread_index);
+        return false;
+    }
+
+    for (std::vector<ICDElement>::const_iterator it = def.elements.cbegin();
+         it != def.elements.cend(); ++it)
+    {
+        if (!AppendColumnFromICDElement(table_ptr, *it))
+        {
+            SPDLOG_WARN("{:02d} Failed to create column: {:s}, table: {:s}",
+                        thread_index, it->elem_name_.str(), def.name);
+            return false;
+        }
+    }
+
+    if (!table_ptr->ConfigurePqContext())
+    {
+        SPDLOG_WARN("{:02d} Failed to configure parquet context", thread_index);
+        return false;
+    }
+
+    table_ptr->LogSchema();
+    return true;
+}
+
+bool TranslateTabularContextCANBus::AppendColumnFromICDElement(
+    std::shared_ptr<TranslatableTableBase>& table_ptr,
+    const ICDElement& icd_elem)
+{
+    bool result = false;
+    switch (icd_elem.schema_)
+    {
+        case ICDElementSchema::SIGNEDBITS:
+        case ICDElementSchema::UNSIGNEDBITS:
+        {
+            if (icd_elem.schema_ == ICDElementSchema::UNSIGNEDBITS && icd_elem.bit_count_ == 1)
+            {
+                result = AppendBooleanColumn<uint16_t>(table_ptr, icd_elem.elem_name_,
+                                                       false, icd_elem);
+            }
+            else if (icd_elem.bit_count_ < 25)
+            {
+                result = AppendColumn<uint16_t, float>(table_ptr, icd_elem.elem_name_,
+                                                       false, icd_elem);
+            }
+            else
+            {
+                result = AppendColumn<uint16_t, double>(table_ptr, icd_elem.elem_name_,
+                                                        false, icd_elem);
+            }
+            break;
+        }
+        case ICDElementSchema::ASCII:
+        {
+            result = AppendASCIIColumn<uint16_t>(table_ptr, icd_elem.elem_name_, false,
+                                                 icd_elem);
+            break;
+        }
+        case ICDElementSchema::SIGNED16:
+        case ICDElementSchema::UNSIGNED16:
+        case ICDElementSchema::FLOAT32_IEEE:
+        case ICDElementSchema::FLOAT16:
+        {
+            result = AppendColumn<uint16_t, float>(table_ptr, icd_elem.elem_name_, false,
+                                                   icd_elem);
+            break;
+        }
+        case ICDElementSchema::SIGNED32:
+        case ICDElementSchema::UNSIGNED32:
+        case ICDElementSchema::FLOAT64_IEEE:
+        {
+            result = AppendColumn<uint16_t, double>(table_ptr, icd_elem.elem_name_, false,
+                                                    icd_elem);
+            break;
+        }
+        default:
+        {
+            SPDLOG_WARN("Invalid schema: value {:d}", static_cast<uint8_t>(icd_elem.schema_));
+            return false;
+        }
+    }
+
+    if (!result)
+    {
+        SPDLOG_WARN("Failed to AppendColumn for element: {:s}, schema: value {:d}",
+                    icd_elem.elem_name_.str(), static_cast<uint8_t>(icd_elem.schema_));
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,85 @@
+#ifndef TRANSLATE_TABULAR_MULTIBUS_MAIN_H_
+#define TRANSLATE_TABULAR_MULTIBUS_MAIN_H_
+
+/*
+Include parquet_reader.h first to avoid complications
+with re-definitions by spdlog headers of arrow defs.
+*/
+#include "sysexits.h"
+#include "parquet_reader.h"
+#include <cstdio>
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <string>
+#include "spdlog/spdlog.h"
+#include "spdlog/logger.h"
+#include "spdlog/sinks/stdout_color_sinks.h"
+#include "spdlog/sinks/rotating_file_sink.h"
+#include "translate_tabular_1553_main.h"
+#include "translate_tabular_arinc429_main.h"
+#include "translation_pool.h"
+#include "translation_config_params.h"
+#include "argument_validation.h"
+#include "managed_path.h"
+#include "stream_buffering.h"
+#include "translator_cli_multibus.h"
+
+/*
+Translate parsed 1553 and ARINC 429 data in a single invocation. The
+DTS of each bus is ingested and organized as by the bus-specific
+translators, then the translation work of both buses is run on one
+TranslationPool with a shared thread count and memory budget.
+*/
+int TranslateTabularMultiBusMain(int argc, char** argv);
+
+namespace transtabmultibus
+{
+    bool SetupLogging(const ManagedPath& log_dir, 
+        spdlog::level::level_enum stdout_level,
+        spdlog::level::level_enum file_level);
+
+    /*
+    Create the ARINC 429 configuration from the shared configuration
+    with the ARINC 429 input paths substituted. The performance
+    statistics path, if any, is suffixed with "_arinc429".
+
+    Args:
+        config              --> Shared configuration which holds the
+                                1553 input paths
+        input_data_429_str  --> Parsed ARINC 429 directory
+        input_dts_429_str   --> DTS429 path
+
+    Return:
+        ARINC 429 configuration
+    */
+    TranslationConfigParams Make429Config(const TranslationConfigParams& config,
+        const std::string& input_data_429_str, const std::string& input_dts_429_str);
+
+    /*
+    Convert the memory budget option to bytes.
+
+    Args:
+        memory_budget_mb    --> Memory budget in MB, zero for no limit
+
+    Return:
+        Memory budget in bytes, zero for no limit
+    */
+    uint64_t MemoryBudgetBytes(int memory_budget_mb);
+
+    /*
+    Append a suffix to the stem of the performance statistics path,
+    such that the statistics of each bus are written to a separate file.
+
+    Args:
+        perf_stats_path_str --> Performance statistics path, may be empty
+        suffix              --> Suffix, for example "_1553"
+
+    Return:
+        Suffixed path, or an empty string if perf_stats_path_str is empty
+    */
+    std::string SuffixPerfStatsPath(const std::string& perf_stats_path_str,
+        const std::string& suffix);
+}  // namespace transtabmultibus
+
+#endif  // TRANSLATE_TABULAR_MULTIBUS_MAIN_H_
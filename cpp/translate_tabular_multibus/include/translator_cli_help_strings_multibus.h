@@ -0,0 +1,53 @@
+#ifndef TRANSLATOR_CLI_HELP_STRINGS_MULTIBUS_H_
+#define TRANSLATOR_CLI_HELP_STRINGS_MULTIBUS_H_
+
+#include <string>
+
+// Options shared with the 1553 translator use the help strings in
+// Translate1553CLIHelpStrings.
+namespace TranslateMultiBusCLIHelpStrings
+{
+    const std::string input_parsed_1553_help = 
+        R"(Path to parsed 1553 Parquet data to be translated. Path is
+        "<ch10 name>_1553.parquet" directory which is output during tip_parse.)";
+
+    const std::string input_dts1553_help =
+        R"(Path to DTS1553 yaml file which contains ICD information relevant to the 
+        PARSED_1553 data)";
+
+    const std::string input_parsed_429_help = 
+        R"(Path to parsed ARINC 429 Parquet data to be translated. Path is
+        "<ch10 name>_arinc429.parquet" directory which is output during tip_parse.)";
+
+    const std::string input_dts429_help =
+        R"(Path to DTS429 yaml file which contains ICD information relevant to the 
+        PARSED_ARINC429 data)";
+
+    const std::string output_path_help = 
+        R"(Output directory for artifacts created at translate time. Translated
+        1553 and ARINC 429 data are written to separate directories within the
+        output directory.)";
+
+    const std::string translate_thread_count_help = 
+        R"(Number of threads shared by 1553 and ARINC 429 translation, valid 
+        ranges = [1, Cores * 2])";
+
+    const std::string perf_stats_path_help = 
+        R"(Write per-worker counters and stage times to files in addition to
+        _metadata.yaml. The statistics of each bus are written to a separate
+        file, with "_1553" or "_arinc429" appended to the file stem. The format
+        is JSON if the extension is .json and Prometheus text if the extension
+        is .prom, e.g., for the node exporter textfile collector.)";
+
+    const std::string memory_budget_help = 
+        R"(Approximate limit, in MB, of the memory used by concurrent translation
+        work. Work is estimated to require memory proportional to the largest of
+        its parsed input files. Fewer threads are active if the estimates of
+        the remaining work exceed the budget. Zero for no limit.)";
+
+    const std::string select_specific_messages_help =
+        R"(Translate only the specified 1553 messages. See the 1553 translator 
+        help for details.)";
+}
+
+#endif  // TRANSLATOR_CLI_HELP_STRINGS_MULTIBUS_H_
@@ -0,0 +1,136 @@
+#ifndef TRANSLATOR_CLI_MULTIBUS_H_
+#define TRANSLATOR_CLI_MULTIBUS_H_
+
+#include <memory>
+#include <string>
+#include <set>
+#include <vector>
+#include <map>
+#include <climits>
+#include "cli_group.h"
+#include "translator_cli_help_strings_1553.h"
+#include "translator_cli_help_strings_multibus.h"
+#include "translation_config_params.h"
+
+/*
+Configure the multi-bus translator CLI. The 1553 inputs and all shared
+options are set in config. The ARINC 429 inputs are set in the separate
+strings and are substituted into a copy of config for the ARINC 429
+translator.
+*/
+inline bool ConfigureTranslatorCLIMultiBus(CLIGroup& cli_group, TranslationConfigParams& config, 
+    std::string& input_data_429_str, std::string& input_dts_429_str, int& memory_budget_mb,
+    bool& help_requested, const std::string& high_level_description)
+{
+    ////////////////////////////////////////////////////////////////////////////////
+    //                                  help CLI
+    ////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<CLIGroupMember> cli_help = cli_group.AddCLI(TRANSLATE_MULTIBUS_EXE_NAME, 
+        high_level_description, "clihelp");
+    cli_help->AddOption("--help", "-h", Translate1553CLIHelpStrings::help_request_help, false, 
+        help_requested, true);
+
+
+    ////////////////////////////////////////////////////////////////////////////////
+    //                                  full CLI
+    ////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<CLIGroupMember> cli = cli_group.AddCLI(TRANSLATE_MULTIBUS_EXE_NAME,
+        high_level_description, "clifull");
+
+    // Positional args, required
+    cli->AddOption("input_1553_data", 
+        TranslateMultiBusCLIHelpStrings::input_parsed_1553_help, 
+        config.input_data_path_str_, true);
+    cli->AddOption("input_1553_dts", 
+        TranslateMultiBusCLIHelpStrings::input_dts1553_help, 
+        config.input_dts_path_str_, true);
+    cli->AddOption("input_429_data", 
+        TranslateMultiBusCLIHelpStrings::input_parsed_429_help, 
+        input_data_429_str, true);
+    cli->AddOption("input_429_dts", 
+        TranslateMultiBusCLIHelpStrings::input_dts429_help, 
+        input_dts_429_str, true);
+    
+    // Optional args
+    cli->AddOption<std::string>("--output_path", "-o", 
+        TranslateMultiBusCLIHelpStrings::output_path_help, "<input 1553 path directory>", 
+        config.output_path_str_)->DefaultUseParentDirOf(
+            config.input_data_path_str_);
+
+    cli->AddOption<std::string>("--log_path", "-l", 
+        Translate1553CLIHelpStrings::log_dir_help, "<output path directory>",
+        config.log_path_str_)->DefaultUseValueOf(
+            config.output_path_str_);
+
+    cli->AddOption<std::string>("--dts_cache_path", "", 
+        Translate1553CLIHelpStrings::dts_cache_dir_help, "<output path directory>",
+        config.dts_cache_dir_str_)->DefaultUseValueOf(
+            config.output_path_str_);
+
+    cli->AddOption<std::string>("--perf_stats", "", 
+        TranslateMultiBusCLIHelpStrings::perf_stats_path_help, "", config.perf_stats_path_str_);
+
+    cli->AddOption("--thread_count", "-t", 
+        TranslateMultiBusCLIHelpStrings::translate_thread_count_help, 1,
+        config.translate_thread_count_)->ValidateInclusiveRangeIs(
+            1, 128);
+
+    cli->AddOption("--memory_budget", "-M", 
+        TranslateMultiBusCLIHelpStrings::memory_budget_help, 0,
+        memory_budget_mb)->ValidateInclusiveRangeIs(0, INT_MAX);
+
+    std::map<std::string, std::string> tmats_busname_corrections_default{};
+    cli->AddOption<std::map<std::string, std::string>>("--tmats_busname_corrections", 
+        "-T", Translate1553CLIHelpStrings::tmats_busname_corrections_help, tmats_busname_corrections_default, 
+        config.tmats_busname_corrections_);
+
+    cli->AddOption("--vote_threshold", "-V", 
+        Translate1553CLIHelpStrings::vote_threshold_help, 1, 
+        config.vote_threshold_)->ValidateInclusiveRangeIs(1, INT_MAX); 
+
+    std::vector<std::string> busname_exclusions_default{};
+    cli->AddOption<std::vector<std::string>>("--busname_exclusion", "-b", 
+        Translate1553CLIHelpStrings::bus_name_exclusions_help,
+        busname_exclusions_default, config.bus_name_exclusions_); 
+
+    std::vector<std::string> select_spec_msgs_default{};
+    cli->AddOption<std::vector<std::string>>("--select_msg", "-m", 
+        TranslateMultiBusCLIHelpStrings::select_specific_messages_help,
+        select_spec_msgs_default, config.select_specific_messages_);
+
+    std::set<std::string> permitted_log_levels{"trace", "debug", "info", "warn", "error", 
+        "critical", "off"};
+    cli->AddOption<std::string>("--log_level", "-L", 
+        Translate1553CLIHelpStrings::stdout_log_level_help, "info", 
+        config.stdout_log_level_)->ValidatePermittedValuesAre(permitted_log_levels);
+    cli->AddOption<std::string>("--file_log_level", "-F", 
+        Translate1553CLIHelpStrings::file_log_level_help, "info", config.file_log_level_)
+        ->ValidatePermittedValuesAre(permitted_log_levels);
+
+
+    // Flags
+    cli->AddOption("--tmats", "", 
+        Translate1553CLIHelpStrings::use_tmats_busmap_help, false, 
+        config.use_tmats_busmap_);
+    cli->AddOption("--prompt_user", "-p", 
+        Translate1553CLIHelpStrings::prompt_user_help, false, 
+        config.prompt_user_);
+    cli->AddOption("--check_tmats", "", 
+        Translate1553CLIHelpStrings::vote_method_checks_tmats_help, 
+        false, 
+        config.vote_method_checks_tmats_);
+    cli->AddOption("--disable_sys_limits", "", 
+        Translate1553CLIHelpStrings::auto_sys_limits_help, true, config.auto_sys_limits_);
+    cli->AddOption("--disable_dts_cache", "", 
+        Translate1553CLIHelpStrings::disable_dts_cache_help, false, 
+        config.disable_dts_cache_);
+
+
+    if(!cli_group.CheckConfiguration())
+        return false;
+    return true;
+}
+
+#endif  // TRANSLATOR_CLI_MULTIBUS_H_
@@ -0,0 +1,185 @@
+#include "translate_tabular_multibus_main.h"
+
+int TranslateTabularMultiBusMain(int argc, char** argv)
+{
+    if (!SetLineBuffering(stdout))
+        return EX_OSERR;
+
+    CLIGroup cli_group;
+    TranslationConfigParams config;
+    std::string input_data_429_str("");
+    std::string input_dts_429_str("");
+    int memory_budget_mb = 0;
+    bool help_requested = false;
+    std::string high_level_description("Translate parsed 1553 and ARINC 429 data in Parquet "
+        "format to engineering units in a single invocation, with translation of both buses "
+        "run on a shared set of threads.");
+    if(!ConfigureTranslatorCLIMultiBus(cli_group, config, input_data_429_str, input_dts_429_str,
+        memory_budget_mb, help_requested, high_level_description))
+    {
+        printf("ConfigureTranslatorCLIMultiBus failed\n");
+        return EX_SOFTWARE;
+    }
+
+    std::string nickname = "";
+    std::shared_ptr<CLIGroupMember> cli;
+    int retcode = 0;
+    if ((retcode = cli_group.Parse(argc, argv, nickname, cli)) != 0)
+    {
+        if (argc == 1)
+            printf("%s", cli_group.MakeHelpString().c_str());
+        return retcode;
+    }
+
+    if (help_requested && nickname == "clihelp")
+    {
+        printf("%s", cli_group.MakeHelpString().c_str());
+        return EX_OK;
+    }
+
+    TranslationConfigParams config_429 = transtabmultibus::Make429Config(config,
+        input_data_429_str, input_dts_429_str);
+    config.perf_stats_path_str_ = transtabmultibus::SuffixPerfStatsPath(
+        config.perf_stats_path_str_, "_1553");
+
+    ArgumentValidation av;
+    Translation1553State state_1553;
+    Translation429State state_429;
+    if ((retcode = transtab1553::ValidateInputs(config, &av, state_1553)) != 0)
+        return retcode;
+    if ((retcode = transtab429::ValidateInputs(config_429, &av, state_429)) != 0)
+        return retcode;
+
+    spdlog::level::level_enum stdout_level = spdlog::level::from_str(config.stdout_log_level_);
+    spdlog::level::level_enum file_level = spdlog::level::from_str(config.file_log_level_);
+    if (!transtabmultibus::SetupLogging(state_1553.log_dir, stdout_level, file_level))
+        return EX_SOFTWARE;
+
+    if ((retcode = transtab1553::PrepareTranslation(config, state_1553)) != 0)
+        return retcode;
+    if ((retcode = transtab429::PrepareTranslation(config_429, state_429)) != 0)
+        return retcode;
+
+    // Each thread translates the data of one bus at a time. Request enough
+    // file descriptors for every thread to have the output files of
+    // both buses open.
+    size_t thread_count = config.translate_thread_count_;
+    if (config.auto_sys_limits_)
+    {
+        if (!transtab1553::SetSystemLimits(static_cast<uint8_t>(thread_count), 
+            state_1553.dts1553.ICDDataPtr()->valid_message_count +
+            state_429.arinc429_message_count))
+            return EX_OSERR;
+    }
+    else
+        SPDLOG_WARN("Automatic system limits (file handle allocation) disabled");
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    TranslationPool pool(thread_count, transtabmultibus::MemoryBudgetBytes(memory_budget_mb));
+    pool.AddTranslator("1553", state_1553.translator);
+    pool.AddTranslator("ARINC 429", state_429.translator);
+    if ((retcode = pool.Translate()) != 0)
+    {
+        SPDLOG_WARN(
+            "Failed to configure multi-bus translation stage or an error occurred "
+            "during translation");
+        spdlog::shutdown();
+        return retcode;
+    }
+
+    auto stop_time = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> secs = stop_time - start_time;
+    double duration = secs.count();
+    SPDLOG_INFO("Duration: {:.3f} sec", duration);
+
+    if ((retcode = transtab1553::FinalizeTranslation(config, state_1553)) != 0 ||
+        (retcode = transtab429::FinalizeTranslation(config_429, state_429)) != 0)
+    {
+        spdlog::shutdown();
+        return retcode;
+    }
+
+    // Avoid deadlock in windows, see
+    // http://stackoverflow.com/questions/10915233/stdthreadjoin-hangs-if-called-after-main-exits-when-using-vs2012-rc
+    spdlog::shutdown();
+    return EX_OK;
+}
+
+namespace transtabmultibus
+{
+    bool SetupLogging(const ManagedPath& log_dir, // GCOVR_EXCL_LINE
+        spdlog::level::level_enum stdout_level, // GCOVR_EXCL_LINE
+        spdlog::level::level_enum file_level)  // GCOVR_EXCL_LINE
+    {
+        try
+        {
+            // Set global logging level
+            spdlog::set_level(spdlog::level::trace);  // GCOVR_EXCL_LINE
+
+            // Rotating logs maxima
+            int max_size = 1024 * 1024 * 5;  // GCOVR_EXCL_LINE
+            int max_files = 5;  // GCOVR_EXCL_LINE
+
+            // Console sink
+            auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();  // GCOVR_EXCL_LINE
+            console_sink->set_level(stdout_level);  // GCOVR_EXCL_LINE
+            console_sink->set_pattern("%^[%T %L] %v%$");  // GCOVR_EXCL_LINE
+
+            // file sink
+            ManagedPath trans_log_path = // GCOVR_EXCL_LINE
+                log_dir / (TRANSLATE_MULTIBUS_LOGNAME ".log");  // GCOVR_EXCL_LINE
+            auto trans_log_sink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(trans_log_path.string(),  // GCOVR_EXCL_LINE
+                                                                                        max_size, max_files);  // GCOVR_EXCL_LINE
+            trans_log_sink->set_level(file_level);  // GCOVR_EXCL_LINE
+            trans_log_sink->set_pattern("[%D %T %L] [%@] %v");  // GCOVR_EXCL_LINE
+
+            // List of sinks for translator
+            spdlog::sinks_init_list trans_sinks = {console_sink, trans_log_sink};  // GCOVR_EXCL_LINE
+
+            // Create and register the logger for translator log and console.
+            auto trans_logger = std::make_shared<spdlog::logger>("trans_logger", trans_sinks);  // GCOVR_EXCL_LINE
+            trans_logger->set_level(spdlog::level::trace);  // GCOVR_EXCL_LINE
+            spdlog::register_logger(trans_logger);  // GCOVR_EXCL_LINE
+
+            spdlog::set_default_logger(trans_logger);  // GCOVR_EXCL_LINE
+        }
+        catch (const spdlog::spdlog_ex& ex)  // GCOVR_EXCL_LINE
+        {
+            printf("SetupLogging() failed: %s\n", ex.what());  // GCOVR_EXCL_LINE
+            return false;  // GCOVR_EXCL_LINE
+        }
+        return true;  // GCOVR_EXCL_LINE
+    }
+
+    TranslationConfigParams Make429Config(const TranslationConfigParams& config,
+        const std::string& input_data_429_str, const std::string& input_dts_429_str)
+    {
+        TranslationConfigParams config_429 = config;
+        config_429.input_data_path_str_ = input_data_429_str;
+        config_429.input_dts_path_str_ = input_dts_429_str;
+
+        // Message selection and bus mapping apply to 1553 only
+        config_429.select_specific_messages_.clear();
+        config_429.perf_stats_path_str_ = SuffixPerfStatsPath(config.perf_stats_path_str_,
+            "_arinc429");
+        return config_429;
+    }
+
+    uint64_t MemoryBudgetBytes(int memory_budget_mb)
+    {
+        if (memory_budget_mb <= 0)
+            return 0;
+        return static_cast<uint64_t>(memory_budget_mb) * 1024 * 1024;
+    }
+
+    std::string SuffixPerfStatsPath(const std::string& perf_stats_path_str,
+        const std::string& suffix)
+    {
+        if (perf_stats_path_str.empty())
+            return perf_stats_path_str;
+        ManagedPath path(perf_stats_path_str);
+        ManagedPath suffixed = path.parent_path() / ManagedPath(path.stem().RawString() + 
+            suffix + path.extension().RawString());
+        return suffixed.RawString();
+    }
+}  // namespace transtabmultibus
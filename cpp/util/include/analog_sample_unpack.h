@@ -0,0 +1,84 @@
+#ifndef ANALOG_SAMPLE_UNPACK_H_
+#define ANALOG_SAMPLE_UNPACK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "checksum_kernels.h"
+
+/*
+Unpack fixed-width samples from a bit stream into 32-bit integers.
+
+The bit stream is a sequence of little-endian bytes in which the first
+bit of the stream is the least significant bit of the first byte, such
+that a sample which is stored in a little-endian 16- or 32-bit word
+occupies the same bits of the stream as of the word. Sample i occupies
+the stride_bits bits which begin at bit i * stride_bits. The value of the
+sample is the field shifted right by shift bits and masked to
+sample_bits bits, which removes padding from the least and most
+significant bits of the field respectively.
+
+Strides of 8, 16 and 32 bits, which are the strides of unpacked mode
+analog samples, are unpacked with SSE2 or AVX2 shifts and masks. Other
+strides are unpacked with AVX2 gathers and per-lane shifts, in groups of
+eight samples which span exactly stride_bits bytes. The instruction set
+is detected at run time as for ChecksumKernels.
+*/
+class AnalogSampleUnpack
+{
+   public:
+    static const uint32_t max_sample_bits = 32;
+
+    typedef void (*UnpackFunc)(const uint8_t* data, size_t size, size_t count,
+        uint32_t stride_bits, uint32_t shift, uint32_t mask, int32_t* out);
+
+   private:
+    ChecksumKernels::ISA isa_;
+    UnpackFunc unpack_;
+
+   public:
+    /*
+    Args:
+        isa --> Fastest instruction set to use, primarily for testing.
+                The fastest supported instruction set is used by default.
+    */
+    AnalogSampleUnpack(ChecksumKernels::ISA isa = ChecksumKernels::ISA::AVX2);
+
+    ChecksumKernels::ISA GetISA() const { return isa_; }
+
+    /*
+    Check if the sample geometry is supported.
+
+    Args:
+        stride_bits --> Count of bits from one sample to the next
+        shift       --> Count of padding bits below the sample
+        sample_bits --> Count of bits in the sample
+
+    Return:
+        True if stride_bits and sample_bits are in [1, max_sample_bits]
+        and the sample, with its shift, fits in the stride.
+    */
+    static bool IsValid(uint32_t stride_bits, uint32_t shift, uint32_t sample_bits);
+
+    /*
+    Unpack samples.
+
+    Args:
+        data        --> Bit stream
+        size        --> Count of bytes in the stream, which must hold at
+                        least count * stride_bits bits
+        count       --> Count of samples to unpack
+        stride_bits --> Count of bits from one sample to the next
+        shift       --> Count of padding bits below the sample
+        sample_bits --> Count of bits in the sample
+        out         --> Output of count samples. Samples of 32 bits are
+                        stored as the bit pattern of the sample.
+
+    Return:
+        False if the geometry is not valid, see IsValid, or the stream is
+        too short; true otherwise.
+    */
+    bool Unpack(const uint8_t* data, size_t size, size_t count, uint32_t stride_bits,
+        uint32_t shift, uint32_t sample_bits, int32_t* out) const;
+};
+
+#endif  // ANALOG_SAMPLE_UNPACK_H_
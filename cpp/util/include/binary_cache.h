@@ -0,0 +1,134 @@
+#ifndef BINARY_CACHE_H_
+#define BINARY_CACHE_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "sysexits.h"
+#include "managed_path.h"
+#include "memory_mapped_file.h"
+
+/*
+Binary cache file of data which is expensive to produce from its source,
+such as the organized contents of a DTS file. The file is a header
+followed by a payload of values written by BinaryCacheWriter and read
+in the same order by BinaryCacheReader.
+
+The header records a format version, the TIP version and a key which
+identifies the source, typically the SHA-256 of the source file. A cache
+is only read if all three match, such that a cache is rebuilt if the
+source or the software which wrote it changes. Values are written in
+host byte order and a cache written on a host of different byte order
+is rejected.
+*/
+
+class BinaryCacheWriter
+{
+   private:
+    std::vector<uint8_t> payload_;
+
+   public:
+    BinaryCacheWriter() : payload_() {}
+
+    const std::vector<uint8_t>& payload() const { return payload_; }
+
+    // Append an arithmetic or enum value
+    template <typename T>
+    void Write(const T& value)
+    {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "BinaryCacheWriter::Write requires an arithmetic or enum type");
+        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&value);
+        payload_.insert(payload_.end(), ptr, ptr + sizeof(T));
+    }
+
+    // Append a size or count, written as uint64_t
+    void WriteSize(size_t size) { Write(static_cast<uint64_t>(size)); }
+
+    // Append a length-prefixed string
+    void WriteString(const std::string& value);
+
+    /*
+    Write the header and payload to a file. The file is written to a
+    temporary path and renamed, such that a partially written cache is
+    never read.
+
+    Args:
+        path        --> Output cache file path
+        key         --> Identifier of the cache source, ex: SHA-256
+                        of the source file
+        version     --> Version of the software which wrote the cache
+
+    Return:
+        EX_OK if the file is written, EX_CANTCREAT if it can't be
+        opened or EX_IOERR if the write or rename fails
+    */
+    int Save(const ManagedPath& path, const std::string& key,
+             const std::string& version) const;
+};
+
+class BinaryCacheReader
+{
+   private:
+    MemoryMappedFile file_;
+    const uint8_t* pos_;
+    const uint8_t* end_;
+
+    // False after any read exceeds the payload. Subsequent
+    // reads fail.
+    bool ok_;
+
+    bool ReadBytes(void* dest, size_t count);
+
+   public:
+    static const char magic_[8];
+    static const uint32_t format_version_;
+    static const uint32_t byte_order_mark_;
+
+    BinaryCacheReader() : file_(), pos_(nullptr), end_(nullptr), ok_(false) {}
+
+    /*
+    Map a cache file and validate the header.
+
+    Args:
+        path        --> Cache file path
+        key         --> Expected key, see BinaryCacheWriter::Save
+        version     --> Expected software version
+
+    Return:
+        EX_OK if the header matches, EX_NOINPUT if the file does not
+        exist or can't be mapped, EX_DATAERR if the file is not a
+        cache, is truncated or was written for a different key,
+        version, format or byte order.
+    */
+    int Open(const ManagedPath& path, const std::string& key, const std::string& version);
+
+    // Unmap the file
+    void Close();
+
+    const bool& ok() const { return ok_; }
+
+    // True if the entire payload has been read without error
+    bool AtEnd() const { return ok_ && pos_ == end_; }
+
+    // Read an arithmetic or enum value
+    template <typename T>
+    bool Read(T& value)
+    {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "BinaryCacheReader::Read requires an arithmetic or enum type");
+        return ReadBytes(&value, sizeof(T));
+    }
+
+    // Read a size or count written by BinaryCacheWriter::WriteSize.
+    // Fails if the size exceeds the remaining payload bytes, which
+    // bounds allocations made from a corrupt count.
+    bool ReadSize(size_t& size);
+
+    bool ReadString(std::string& value);
+};
+
+#endif  // BINARY_CACHE_H_
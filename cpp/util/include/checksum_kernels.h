@@ -0,0 +1,75 @@
+#ifndef CHECKSUM_KERNELS_H_
+#define CHECKSUM_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+Modular sums of 8-, 16- and 32-bit little-endian words, as used by the
+Ch10 packet header and data checksums.
+
+Each sum is implemented by a scalar kernel and, on x86 builds with GCC
+or Clang, by SSE2 and AVX2 kernels. The instruction set is detected
+once at run time and the fastest supported kernels are used by
+ChecksumKernels::Dispatched. Kernels of a specific instruction set may
+be selected for testing and benchmarking.
+
+Input data need not be aligned.
+*/
+class ChecksumKernels
+{
+   public:
+    enum class ISA : uint8_t
+    {
+        SCALAR = 0,
+        SSE2 = 1,
+        AVX2 = 2,
+    };
+
+    // Sum count bytes, words or double words beginning at data, modulo
+    // 2^8, 2^16 and 2^32 respectively
+    typedef uint8_t (*Sum8Func)(const uint8_t* data, size_t count);
+    typedef uint16_t (*Sum16Func)(const uint8_t* data, size_t count);
+    typedef uint32_t (*Sum32Func)(const uint8_t* data, size_t count);
+
+    ISA isa;
+    Sum8Func sum8;
+    Sum16Func sum16;
+    Sum32Func sum32;
+
+    /*
+    Kernels of the fastest instruction set supported by the CPU. The
+    instruction set is detected on the first call. Thread safe.
+    */
+    static const ChecksumKernels& Dispatched();
+
+    /*
+    Check if kernels of an instruction set are compiled and supported
+    by the CPU.
+
+    Args:
+        isa --> Instruction set
+
+    Return:
+        True if Select(isa) returns kernels of the instruction set.
+    */
+    static bool IsSupported(ISA isa);
+
+    /*
+    Get the kernels of an instruction set.
+
+    Args:
+        isa --> Instruction set
+
+    Return:
+        Kernels of isa if supported, otherwise the kernels of the
+        fastest supported instruction set which is slower than isa.
+    */
+    static ChecksumKernels Select(ISA isa);
+
+    // Lowercase name of an instruction set, for example "avx2"
+    static std::string ISAString(ISA isa);
+};
+
+#endif  // CHECKSUM_KERNELS_H_
@@ -0,0 +1,113 @@
+#ifndef DIAGNOSTICS_H_
+#define DIAGNOSTICS_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+Rate-limited diagnostic counters.
+
+Per-message paths which encounter malformed data record an event by
+name rather than formatting a log line for every occurrence. Each event
+is counted and the offsets of the first few occurrences are retained as
+exemplars. Record returns true only for occurrences which are retained,
+such that the caller logs the detailed message for exemplars and the
+remainder are summarized when work is complete.
+
+Objects are owned by a single worker and are not synchronized. The
+objects of several workers are combined with Merge.
+*/
+class Diagnostics
+{
+   public:
+    // Count of occurrences of an event and the offsets of the first
+    // occurrences, in ascending order after a Merge
+    struct Event
+    {
+        uint64_t count;
+        std::vector<uint64_t> exemplar_offsets;
+    };
+
+    static const size_t default_exemplar_limit = 10;
+
+   private:
+    // Events mapped by name. std::less<> permits lookup by string_view
+    // without constructing a std::string.
+    std::map<std::string, Event, std::less<>> events_;
+
+    // Maximum count of exemplar offsets retained per event
+    size_t exemplar_limit_;
+
+   public:
+    explicit Diagnostics(size_t exemplar_limit = default_exemplar_limit)
+        : events_(), exemplar_limit_(exemplar_limit) {}
+
+    const std::map<std::string, Event, std::less<>>& GetEvents() const { return events_; }
+    size_t GetExemplarLimit() const { return exemplar_limit_; }
+    bool IsEmpty() const { return events_.empty(); }
+
+    /*
+    Count an occurrence of an event.
+
+    Args:
+        event   --> Event name, for example "bad_sync"
+        offset  --> Location of the occurrence, for example the absolute
+                    position in the input file or a row index
+
+    Return:
+        True if the occurrence is retained as an exemplar, in which case
+        the caller may log the details of the occurrence. False if the
+        occurrence is only counted.
+    */
+    bool Record(std::string_view event, uint64_t offset);
+
+    /*
+    Get the count of an event.
+
+    Args:
+        event   --> Event name
+
+    Return:
+        Count, zero if the event has not been recorded
+    */
+    uint64_t GetCount(std::string_view event) const;
+
+    // Total count of occurrences of all events
+    uint64_t GetTotalCount() const;
+
+    // Counts and exemplar offsets mapped by event name, for metadata
+    // output
+    std::map<std::string, uint64_t> GetCounts() const;
+    std::map<std::string, std::vector<uint64_t>> GetExemplarOffsets() const;
+
+    /*
+    Add the events of another object to this object. Exemplar offsets
+    are combined and the lowest offsets, up to the exemplar limit of this
+    object, are retained.
+
+    Args:
+        other   --> Diagnostics of another worker
+    */
+    void Merge(const Diagnostics& other);
+
+    /*
+    Format one line per event with the count, the count of occurrences
+    which were not logged and the exemplar offsets.
+
+    Args:
+        offset_label    --> Description of offsets, for example
+                            "absolute position"
+
+    Return:
+        Vector of lines, empty if no events have been recorded
+    */
+    std::vector<std::string> FormatSummary(const std::string& offset_label) const;
+};
+
+#endif  // DIAGNOSTICS_H_
@@ -0,0 +1,123 @@
+#ifndef INTERNED_STRING_H_
+#define INTERNED_STRING_H_
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/*
+Pool of immutable strings. Each distinct value is stored once, in blocks
+of string objects which are never moved or freed for the life of the
+pool, such that a pointer to a pooled string is a stable handle which
+may be shared freely between objects and threads.
+
+Intended for the names and descriptions of ICD elements, of which many
+thousands of elements share a small set of distinct values.
+*/
+class StringPool
+{
+   private:
+    // std::deque allocates elements in fixed-size blocks and does not
+    // relocate existing elements when appended to.
+    std::deque<std::string> strings_;
+
+    // Map of value, which views a string in strings_, to the string
+    std::unordered_map<std::string_view, const std::string*> index_;
+
+    mutable std::mutex mutex_;
+
+   public:
+    StringPool() : strings_(), index_() {}
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    // Pool which backs InternedString
+    static StringPool& Global();
+
+    /*
+    Get the pooled string equal to a value, adding the value to the pool
+    if it is not present. Thread safe.
+
+    Args:
+        value   --> String value
+
+    Return:
+        Pointer to the pooled string, valid for the life of the pool
+    */
+    const std::string* Intern(std::string_view value);
+
+    // Count of distinct strings in the pool
+    size_t Size() const;
+};
+
+/*
+Handle to a string in the global StringPool. Copies and equality
+comparisons of handles are pointer operations. Handles are assigned from
+and convert implicitly to const std::string&, such that a handle may be
+used in place of a std::string which is not modified in place.
+*/
+class InternedString
+{
+   private:
+    const std::string* str_;
+
+   public:
+    // Empty string
+    InternedString() : str_(&Empty()) {}
+    InternedString(const std::string& value) : str_(StringPool::Global().Intern(value)) {}
+    InternedString(const char* value) : str_(StringPool::Global().Intern(value)) {}
+
+    static const std::string& Empty();
+
+    const std::string& str() const { return *str_; }
+    operator const std::string&() const { return *str_; }
+
+    const char* c_str() const { return str_->c_str(); }
+    size_t size() const { return str_->size(); }
+    size_t length() const { return str_->length(); }
+    bool empty() const { return str_->empty(); }
+
+    // Equal values share a pooled string
+    bool operator==(const InternedString& rhs) const { return str_ == rhs.str_; }
+    bool operator!=(const InternedString& rhs) const { return str_ != rhs.str_; }
+    bool operator<(const InternedString& rhs) const { return *str_ < *rhs.str_; }
+};
+
+inline bool operator==(const InternedString& lhs, const std::string& rhs) { return lhs.str() == rhs; }
+inline bool operator==(const std::string& lhs, const InternedString& rhs) { return lhs == rhs.str(); }
+inline bool operator==(const InternedString& lhs, const char* rhs) { return lhs.str() == rhs; }
+inline bool operator==(const char* lhs, const InternedString& rhs) { return lhs == rhs.str(); }
+inline bool operator!=(const InternedString& lhs, const std::string& rhs) { return lhs.str() != rhs; }
+inline bool operator!=(const std::string& lhs, const InternedString& rhs) { return lhs != rhs.str(); }
+inline bool operator!=(const InternedString& lhs, const char* rhs) { return lhs.str() != rhs; }
+inline bool operator!=(const char* lhs, const InternedString& rhs) { return lhs != rhs.str(); }
+
+inline std::string operator+(const InternedString& lhs, const std::string& rhs) { return lhs.str() + rhs; }
+inline std::string operator+(const std::string& lhs, const InternedString& rhs) { return lhs + rhs.str(); }
+inline std::string operator+(const InternedString& lhs, const char* rhs) { return lhs.str() + rhs; }
+inline std::string operator+(const char* lhs, const InternedString& rhs) { return lhs + rhs.str(); }
+
+// Hash of the pooled string address, consistent with operator==
+namespace std
+{
+template <>
+struct hash<InternedString>
+{
+    size_t operator()(const InternedString& value) const noexcept
+    {
+        return hash<const std::string*>()(&value.str());
+    }
+};
+}  // namespace std
+
+inline std::ostream& operator<<(std::ostream& os, const InternedString& value)
+{
+    return os << value.str();
+}
+
+#endif  // INTERNED_STRING_H_
@@ -0,0 +1,78 @@
+
+#ifndef MEMORY_MAPPED_FILE_H_
+#define MEMORY_MAPPED_FILE_H_
+
+//This include first to satisfy linter
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined __WIN64
+#include <windows.h>
+#endif  // __linux__
+
+#include <cstdint>
+#include <cstdio>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include "sysexits.h"
+#include "managed_path.h"
+
+/*
+Read-only memory map of an entire file. The mapped bytes remain valid
+until Close() is called or the object is destroyed. Files which are
+larger than physical memory may be mapped; pages are loaded by the
+OS on access.
+*/
+class MemoryMappedFile
+{
+   private:
+    const uint8_t* data_;
+    uint64_t size_;
+    bool is_open_;
+
+#ifdef __linux__
+    int fd_;
+#elif defined __WIN64
+    HANDLE file_handle_;
+    HANDLE map_handle_;
+#endif
+
+   public:
+    MemoryMappedFile();
+    virtual ~MemoryMappedFile();
+
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    const uint8_t* data() const { return data_; }
+    const uint64_t& size() const { return size_; }
+    const bool& is_open() const { return is_open_; }
+
+    /*
+    Map the entire file read-only. A zero-length file is opened
+    successfully with data() == nullptr and size() == 0.
+
+    Args:
+        path            --> Path of file to be mapped
+        sequential      --> Advise the OS that the file will be
+                            read sequentially, which increases
+                            read-ahead
+
+    Return:
+        EX_OK if the file was mapped, EX_NOINPUT if it can't be
+        opened, or EX_IOERR if the size can't be determined or the
+        mapping fails
+    */
+    int Open(const ManagedPath& path, bool sequential = true);
+
+    /*
+    Unmap the file and release handles. Safe to call if the
+    file is not open.
+    */
+    void Close();
+};
+
+#endif  // #ifndef MEMORY_MAPPED_FILE_H_
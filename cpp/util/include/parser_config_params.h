@@ -1,12 +1,14 @@
 #ifndef PARSER_CONFIG_PARAMS_H
 #define PARSER_CONFIG_PARAMS_H
 
+#include <cctype>
 #include <climits>
 #include <string>
 #include <thread>
 #include <map>
 #include <set>
 #include "ch10_packet_type.h"
+#include "ch10_pcmf1_msg_hdr_format.h"
 #include "yaml_reader.h"
 
 class ParserConfigParams
@@ -20,6 +22,13 @@ class ParserConfigParams
     bool disable_videof0_;
     bool disable_eth0_;
     bool disable_arinc0_;
+    bool disable_pcmf1_;
+    bool disable_canbus_;
+    bool disable_eth1_;
+    bool disable_analog1_;
+    bool disable_1553f2_;
+    bool disable_uartf0_;
+    bool disable_messagef0_;
     std::map<std::string, std::string> ch10_packet_type_map_;
     std::map<Ch10PacketType, bool> ch10_packet_enabled_map_;
     int parse_chunk_bytes_;
@@ -30,11 +39,60 @@ class ParserConfigParams
     std::string stdout_log_level_;
     std::string file_log_level_;
 
-    ParserConfigParams() : parse_chunk_bytes_(0), parse_thread_count_(0), 
-        max_chunk_read_count_(0), worker_offset_wait_ms_(0), worker_shift_wait_ms_(0),
-        stdout_log_level_(""), file_log_level_(""),
-        input_path_str_(""), output_path_str_(""), log_path_str_(""), disable_1553f1_(false),
-        disable_videof0_(false), disable_eth0_(false), disable_arinc0_(false)
+    // Batch mode, CLI only (not configurable via yaml)
+    bool batch_mode_;
+    int memory_limit_mb_;
+
+    // Stream mode, CLI only (not configurable via yaml)
+    bool stream_mode_;
+    int stream_poll_ms_;
+    int stream_commit_sec_;
+    int stream_idle_timeout_sec_;
+
+    // Packet selection, CLI only (not configurable via yaml)
+    std::string time_range_str_;
+    std::string byte_range_str_;
+    std::string channel_ids_str_;
+
+    // Performance statistics output, CLI only (not configurable via yaml)
+    std::string perf_stats_path_str_;
+
+    // Progress reporting, CLI only (not configurable via yaml)
+    int progress_interval_sec_;
+    std::string progress_path_str_;
+
+    // Data checksum verification, CLI only (not configurable via yaml).
+    // The sample interval default is shared with the CLI option.
+    static constexpr int DEFAULT_CHECKSUM_SAMPLE_INTERVAL = 100;
+    std::string checksum_policy_str_;
+    int checksum_sample_interval_;
+
+    // PCM minor frame format, CLI only (not configurable via yaml)
+    int pcm_words_;
+    int pcm_word_bits_;
+    int pcm_sync_bits_;
+    std::string pcm_sync_pattern_str_;
+
+    // Analog F1 sample frame decimation, CLI only
+    int analog_decimation_;
+
+    // Write parquet column chunks without Arrow builders, CLI only
+    bool direct_write_;
+
+    ParserConfigParams() : input_path_str_(""), output_path_str_(""), log_path_str_(""),
+        disable_1553f1_(false), disable_videof0_(false), disable_eth0_(false),
+        disable_arinc0_(false), disable_pcmf1_(false), disable_canbus_(false),
+        disable_eth1_(false), disable_analog1_(false), disable_1553f2_(false),
+        disable_uartf0_(false), disable_messagef0_(false), parse_chunk_bytes_(0),
+        parse_thread_count_(0), max_chunk_read_count_(0), worker_offset_wait_ms_(0),
+        worker_shift_wait_ms_(0), stdout_log_level_(""), file_log_level_(""),
+        batch_mode_(false), memory_limit_mb_(0), stream_mode_(false), stream_poll_ms_(0),
+        stream_commit_sec_(0), stream_idle_timeout_sec_(0), time_range_str_(""),
+        byte_range_str_(""), channel_ids_str_(""), perf_stats_path_str_(""),
+        progress_interval_sec_(0), progress_path_str_(""), checksum_policy_str_("always"),
+        checksum_sample_interval_(DEFAULT_CHECKSUM_SAMPLE_INTERVAL), pcm_words_(0),
+        pcm_word_bits_(16), pcm_sync_bits_(32), pcm_sync_pattern_str_("FE6B2840"),
+        analog_decimation_(1), direct_write_(false)
     {}
 
     bool operator==(const ParserConfigParams& rhs) const
@@ -46,6 +104,13 @@ class ParserConfigParams
             (this->disable_videof0_ == rhs.disable_videof0_) &&
             (this->disable_arinc0_ == rhs.disable_arinc0_) &&
             (this->disable_eth0_ == rhs.disable_eth0_) &&
+            (this->disable_pcmf1_ == rhs.disable_pcmf1_) &&
+            (this->disable_canbus_ == rhs.disable_canbus_) &&
+            (this->disable_eth1_ == rhs.disable_eth1_) &&
+            (this->disable_analog1_ == rhs.disable_analog1_) &&
+            (this->disable_1553f2_ == rhs.disable_1553f2_) &&
+            (this->disable_uartf0_ == rhs.disable_uartf0_) &&
+            (this->disable_messagef0_ == rhs.disable_messagef0_) &&
             (this->ch10_packet_enabled_map_ == rhs.ch10_packet_enabled_map_) &&
             (this->ch10_packet_type_map_ == rhs.ch10_packet_type_map_) &&
             (this->parse_chunk_bytes_ == rhs.parse_chunk_bytes_) &&
@@ -54,7 +119,27 @@ class ParserConfigParams
             (this->worker_offset_wait_ms_ == rhs.worker_offset_wait_ms_) &&
             (this->worker_shift_wait_ms_ == rhs.worker_shift_wait_ms_) &&
             (this->stdout_log_level_ == rhs.stdout_log_level_) &&
-            (this->file_log_level_ == rhs.file_log_level_));
+            (this->file_log_level_ == rhs.file_log_level_) &&
+            (this->batch_mode_ == rhs.batch_mode_) &&
+            (this->memory_limit_mb_ == rhs.memory_limit_mb_) &&
+            (this->stream_mode_ == rhs.stream_mode_) &&
+            (this->stream_poll_ms_ == rhs.stream_poll_ms_) &&
+            (this->stream_commit_sec_ == rhs.stream_commit_sec_) &&
+            (this->stream_idle_timeout_sec_ == rhs.stream_idle_timeout_sec_) &&
+            (this->time_range_str_ == rhs.time_range_str_) &&
+            (this->byte_range_str_ == rhs.byte_range_str_) &&
+            (this->channel_ids_str_ == rhs.channel_ids_str_) &&
+            (this->perf_stats_path_str_ == rhs.perf_stats_path_str_) &&
+            (this->progress_interval_sec_ == rhs.progress_interval_sec_) &&
+            (this->progress_path_str_ == rhs.progress_path_str_) &&
+            (this->checksum_policy_str_ == rhs.checksum_policy_str_) &&
+            (this->checksum_sample_interval_ == rhs.checksum_sample_interval_) &&
+            (this->pcm_words_ == rhs.pcm_words_) &&
+            (this->pcm_word_bits_ == rhs.pcm_word_bits_) &&
+            (this->pcm_sync_bits_ == rhs.pcm_sync_bits_) &&
+            (this->pcm_sync_pattern_str_ == rhs.pcm_sync_pattern_str_) &&
+            (this->analog_decimation_ == rhs.analog_decimation_) &&
+            (this->direct_write_ == rhs.direct_write_));
     }
 
     /*
@@ -126,12 +211,59 @@ class ParserConfigParams
         return ValidateConfigParams(yr);
     }
 
+    /*
+	Create the PCM minor frame format from the pcm_* parameters.
+
+	Args:
+		frame_format	--> Output PCMF1FrameFormat
+
+	Return:
+		False if the sync pattern is not a hexadecimal string or has
+		more significant bits than pcm_sync_bits_, or a count is out of
+		range. True otherwise.
+	*/
+    bool MakePCMF1FrameFormat(PCMF1FrameFormat& frame_format) const
+    {
+        if (pcm_words_ < 0 || pcm_word_bits_ < 1 || pcm_word_bits_ > 32 ||
+            pcm_sync_bits_ < 16 || pcm_sync_bits_ > 64)
+            return false;
+        if (pcm_sync_pattern_str_.empty() || pcm_sync_pattern_str_.size() > 16)
+            return false;
+
+        uint64_t pattern = 0;
+        for (std::string::const_iterator it = pcm_sync_pattern_str_.cbegin();
+             it != pcm_sync_pattern_str_.cend(); ++it)
+        {
+            if (!std::isxdigit(static_cast<unsigned char>(*it)))
+                return false;
+            char c = static_cast<char>(std::tolower(static_cast<unsigned char>(*it)));
+            pattern = (pattern << 4) | static_cast<uint64_t>(c <= '9' ? c - '0' : c - 'a' + 10);
+        }
+        if (pcm_sync_bits_ < 64 && (pattern >> pcm_sync_bits_) != 0)
+            return false;
+
+        frame_format.words_per_minor_frame = static_cast<uint32_t>(pcm_words_);
+        frame_format.word_bits = static_cast<uint32_t>(pcm_word_bits_);
+        frame_format.sync_bits = static_cast<uint32_t>(pcm_sync_bits_);
+        frame_format.sync_pattern = pattern;
+        return true;
+    }
+
     void MakeCh10PacketEnabledMap()
     {
         ch10_packet_enabled_map_[Ch10PacketType::MILSTD1553_F1] = !disable_1553f1_;
         ch10_packet_enabled_map_[Ch10PacketType::VIDEO_DATA_F0] = !disable_videof0_;
         ch10_packet_enabled_map_[Ch10PacketType::ETHERNET_DATA_F0] = !disable_eth0_;
         ch10_packet_enabled_map_[Ch10PacketType::ARINC429_F0] = !disable_arinc0_;
+        ch10_packet_enabled_map_[Ch10PacketType::CAN_BUS] = !disable_canbus_;
+        ch10_packet_enabled_map_[Ch10PacketType::ETHERNET_DATA_F1] = !disable_eth1_;
+        ch10_packet_enabled_map_[Ch10PacketType::ANALOG_F1] = !disable_analog1_;
+        ch10_packet_enabled_map_[Ch10PacketType::MILSTD1553_F2] = !disable_1553f2_;
+        ch10_packet_enabled_map_[Ch10PacketType::UART_F0] = !disable_uartf0_;
+        ch10_packet_enabled_map_[Ch10PacketType::MESSAGE_F0] = !disable_messagef0_;
+
+        // PCM minor frames can't be parsed without the frame format.
+        ch10_packet_enabled_map_[Ch10PacketType::PCM_F1] = !disable_pcmf1_ && pcm_words_ > 0;
 
         for(std::map<Ch10PacketType, bool>::const_iterator it = ch10_packet_enabled_map_.cbegin();
             it != ch10_packet_enabled_map_.cend(); ++it)
@@ -0,0 +1,121 @@
+#ifndef PCM_FRAME_SYNC_H_
+#define PCM_FRAME_SYNC_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "checksum_kernels.h"
+
+/*
+Search a PCM bit stream for a minor frame sync pattern which may begin
+at any bit offset.
+
+The bit stream is a sequence of bytes in which the first bit of the
+stream is the most significant bit of the first byte. Sync patterns
+are matched exactly and must be between min_pattern_bits and
+max_pattern_bits long.
+
+A pattern which begins at bit offset s of byte k is the only pattern
+candidate for which byte k + 1 equals pattern bits [8 - s, 16 - s). The
+search compares each stream byte with the (at most eight) distinct
+candidate bytes, 16 or 32 bytes at a time with SSE2 or AVX2, and the
+complete pattern is compared only at candidate positions. The
+instruction set is detected at run time as for ChecksumKernels.
+*/
+class PCMFrameSync
+{
+   public:
+    static const uint32_t min_pattern_bits = 16;
+    static const uint32_t max_pattern_bits = 64;
+
+    // Returned by Find if the pattern is not found
+    static const uint64_t npos = UINT64_MAX;
+
+    // Candidate bytes of a pattern. Bit s of shift_masks[b] is set if
+    // byte value b equals the pattern bits [8 - s, 16 - s).
+    struct CandidateKeys
+    {
+        std::array<uint8_t, 256> shift_masks;
+        std::array<uint8_t, 8> keys;
+        size_t key_count;
+    };
+
+    // Get the index of the first byte in [begin, end) which is one of
+    // the candidate keys, or end if none.
+    typedef size_t (*FindCandidateFunc)(const uint8_t* data, size_t begin, size_t end,
+        const CandidateKeys& keys);
+
+   private:
+    uint64_t pattern_;
+    uint32_t pattern_bits_;
+    CandidateKeys keys_;
+    ChecksumKernels::ISA isa_;
+    FindCandidateFunc find_candidate_;
+
+   public:
+    PCMFrameSync();
+
+    /*
+    Set the sync pattern.
+
+    Args:
+        pattern         --> Sync pattern, right-justified
+        pattern_bits    --> Count of bits in the sync pattern
+        isa             --> Fastest instruction set to use, primarily
+                            for testing. The fastest supported instruction
+                            set is used by default.
+
+    Return:
+        False if pattern_bits is not in [min_pattern_bits, max_pattern_bits]
+        or the pattern has bits set beyond pattern_bits; true otherwise.
+    */
+    bool Configure(uint64_t pattern, uint32_t pattern_bits,
+        ChecksumKernels::ISA isa = ChecksumKernels::ISA::AVX2);
+
+    uint32_t GetPatternBits() const { return pattern_bits_; }
+    ChecksumKernels::ISA GetISA() const { return isa_; }
+
+    /*
+    Read bits from a bit stream.
+
+    Args:
+        data        --> Bit stream
+        bit_pos     --> Position of the first bit to read
+        bit_count   --> Count of bits to read, in [1, 64]. The caller must
+                        ensure that bit_pos + bit_count does not exceed the
+                        size of the stream in bits.
+
+    Return:
+        Bits read, right-justified.
+    */
+    static uint64_t ReadBits(const uint8_t* data, uint64_t bit_pos, uint32_t bit_count);
+
+    /*
+    Check if the sync pattern begins at a bit position.
+
+    Args:
+        data    --> Bit stream
+        size    --> Count of bytes in the stream
+        bit_pos --> Position of the first bit of the pattern
+
+    Return:
+        True if the complete pattern is in the stream at bit_pos.
+    */
+    bool Match(const uint8_t* data, size_t size, uint64_t bit_pos) const;
+
+    /*
+    Find the first complete sync pattern at or after a bit position.
+
+    Args:
+        data        --> Bit stream
+        size        --> Count of bytes in the stream
+        begin_bit   --> First bit position at which a pattern may begin
+
+    Return:
+        Position of the first bit of the pattern, or npos if the pattern
+        is not found or has not been configured.
+    */
+    uint64_t Find(const uint8_t* data, size_t size, uint64_t begin_bit) const;
+};
+
+#endif  // PCM_FRAME_SYNC_H_
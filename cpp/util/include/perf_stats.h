@@ -0,0 +1,224 @@
+#ifndef PERF_STATS_H_
+#define PERF_STATS_H_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include "sysexits.h"
+#include "managed_path.h"
+
+/*
+Lightweight, always-on performance counters and stage timers.
+
+Hot paths accumulate plain integers and StageTimer or SampledStageTimer
+objects which are owned by a single worker, such that no synchronization is required.
+When work is complete, the values are collected into a PerfStats object
+per worker and the PerfStats of all workers are combined in a
+PerfReport, which is recorded in metadata or written to a JSON or
+Prometheus text file.
+*/
+
+// Accumulates the time elapsed between calls to Start and Stop.
+class StageTimer
+{
+   private:
+    std::chrono::steady_clock::time_point start_;
+    uint64_t elapsed_ns_;
+
+   public:
+    StageTimer() : start_(), elapsed_ns_(0) {}
+
+    void Start() { start_ = std::chrono::steady_clock::now(); }
+
+    void Stop()
+    {
+        elapsed_ns_ += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_).count());
+    }
+
+    void Add(uint64_t elapsed_ns) { elapsed_ns_ += elapsed_ns; }
+
+    uint64_t GetElapsedNs() const { return elapsed_ns_; }
+};
+
+// StageTimer for stages which are entered once per packet or row, where
+// reading the clock on every call is a significant fraction of the work.
+// Only one of every interval Start/Stop pairs is timed and the elapsed
+// time is scaled by the ratio of calls to timed calls.
+class SampledStageTimer
+{
+   private:
+    StageTimer timer_;
+    uint64_t interval_;
+    uint64_t call_count_;
+    uint64_t sample_count_;
+    bool sampling_;
+
+   public:
+    explicit SampledStageTimer(uint64_t interval) : timer_(),
+        interval_(interval == 0 ? 1 : interval), call_count_(0),
+        sample_count_(0), sampling_(false) {}
+
+    void Start()
+    {
+        sampling_ = (call_count_++ % interval_ == 0);
+        if (sampling_)
+        {
+            sample_count_++;
+            timer_.Start();
+        }
+    }
+
+    void Stop()
+    {
+        if (sampling_)
+            timer_.Stop();
+    }
+
+    void Add(uint64_t elapsed_ns) { timer_.Add(elapsed_ns); }
+
+    uint64_t GetCallCount() const { return call_count_; }
+    uint64_t GetSampleCount() const { return sample_count_; }
+
+    // Estimated time of all calls, or the accumulated time if no call
+    // has been timed
+    uint64_t GetElapsedNs() const
+    {
+        if (sample_count_ == 0)
+            return timer_.GetElapsedNs();
+        return static_cast<uint64_t>(static_cast<double>(timer_.GetElapsedNs()) *
+            static_cast<double>(call_count_) / static_cast<double>(sample_count_));
+    }
+};
+
+// Named counts and stage times of a single worker or the sum of
+// several workers.
+class PerfStats
+{
+   private:
+    std::map<std::string, uint64_t> counts_;
+
+    // Stage times in nanoseconds
+    std::map<std::string, uint64_t> times_ns_;
+
+   public:
+    PerfStats() : counts_(), times_ns_() {}
+
+    const std::map<std::string, uint64_t>& GetCounts() const { return counts_; }
+    const std::map<std::string, uint64_t>& GetTimesNs() const { return times_ns_; }
+
+    // Add to the count or time with the given name, which is created
+    // if it does not exist
+    void AddCount(const std::string& name, uint64_t count) { counts_[name] += count; }
+    void AddTime(const std::string& name, uint64_t time_ns) { times_ns_[name] += time_ns; }
+
+    /*
+    Get a count or time.
+
+    Args:
+        name    --> Name of count or time
+
+    Return:
+        Value, zero if the name does not exist
+    */
+    uint64_t GetCount(const std::string& name) const;
+    uint64_t GetTimeNs(const std::string& name) const;
+
+    // Stage times in seconds
+    std::map<std::string, double> GetTimesSec() const;
+
+    // Add the counts and times of another object to this object
+    void Merge(const PerfStats& other);
+
+    bool IsEmpty() const { return counts_.empty() && times_ns_.empty(); }
+};
+
+// PerfStats of each worker and their sum
+class PerfReport
+{
+   private:
+    std::map<std::string, PerfStats> workers_;
+    PerfStats total_;
+
+   public:
+    PerfReport() : workers_(), total_() {}
+
+    const PerfStats& GetTotal() const { return total_; }
+    const std::map<std::string, PerfStats>& GetWorkers() const { return workers_; }
+
+    /*
+    Add the stats of a worker. Stats of a label which has already been
+    added are merged.
+
+    Args:
+        label   --> Worker label, for example a zero-padded thread index
+        stats   --> PerfStats of the worker
+    */
+    void AddWorker(const std::string& label, const PerfStats& stats);
+
+    // Counts and times in seconds of each worker, mapped by worker label
+    // then name, for metadata output
+    std::map<std::string, std::map<std::string, uint64_t>> GetWorkerCounts() const;
+    std::map<std::string, std::map<std::string, double>> GetWorkerTimesSec() const;
+
+    /*
+    Format the report as a JSON object with keys "total" and "workers".
+
+    Args:
+        labels  --> Additional string values recorded at the top level of
+                    the object, for example the input file name
+
+    Return:
+        JSON string
+    */
+    std::string FormatJSON(const std::map<std::string, std::string>& labels) const;
+
+    /*
+    Format the report in the Prometheus text exposition format, suitable
+    for the node exporter textfile collector. Counts are written as
+    <prefix>_<name>_total and times as <prefix>_<name>_seconds_total, one
+    sample per worker with a "worker" label.
+
+    Args:
+        prefix  --> Metric name prefix, for example "tip_parse"
+        labels  --> Labels added to every sample
+
+    Return:
+        Prometheus text
+    */
+    std::string FormatPrometheus(const std::string& prefix,
+                                 const std::map<std::string, std::string>& labels) const;
+
+    /*
+    Write the report to a file. The format is selected by the file
+    extension, ".json" for JSON and ".prom" for Prometheus text.
+
+    Args:
+        path    --> Output file path
+        prefix  --> Prometheus metric name prefix
+        labels  --> See FormatJSON and FormatPrometheus
+
+    Return:
+        EX_USAGE if the extension is not recognized, EX_CANTCREAT if the
+        file can't be written, EX_OK otherwise.
+    */
+    int Write(const ManagedPath& path, const std::string& prefix,
+              const std::map<std::string, std::string>& labels) const;
+
+    // True if the extension of path is recognized by Write
+    static bool IsSupportedPath(const ManagedPath& path);
+
+    ///////////////////////////////////////////////////////////////////////////
+    //                          Internal functions
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Replace characters which are not valid in a Prometheus metric name
+    static std::string SanitizeMetricName(const std::string& name);
+
+    // Escape a string for use in a JSON string or Prometheus label value
+    static std::string EscapeString(const std::string& value);
+};
+
+#endif  // PERF_STATS_H_
@@ -30,13 +30,17 @@ class TranslationConfigParams
     std::string stdout_log_level_;
     std::string file_log_level_;
     bool disable_dts_schema_validation_;
+    std::string dts_cache_dir_str_;
+    bool disable_dts_cache_;
+    std::string perf_stats_path_str_;
 
     TranslationConfigParams() : use_tmats_busmap_(false), exit_after_table_creation_(false),
         stop_after_bus_map_(false), vote_threshold_(1), prompt_user_(false),
         vote_method_checks_tmats_(false), auto_sys_limits_(false), translate_thread_count_(1),
         stdout_log_level_(""), input_data_path_str_(""), input_dts_path_str_(""),
         output_path_str_(""), log_path_str_(""), disable_dts_schema_validation_(false),
-        file_log_level_("")
+        file_log_level_(""), dts_cache_dir_str_(""), disable_dts_cache_(false),
+        perf_stats_path_str_("")
     {}
 
     /*
@@ -0,0 +1,227 @@
+#include "analog_sample_unpack.h"
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ANALOG_SAMPLE_UNPACK_X86
+#include <immintrin.h>
+#endif
+
+const uint32_t AnalogSampleUnpack::max_sample_bits;
+
+namespace
+{
+// Unpack samples [begin, end). Fields are read with a single unaligned
+// load except within eight bytes of the end of the stream.
+void UnpackRangeScalar(const uint8_t* data, size_t size, size_t begin, size_t end,
+    uint32_t stride_bits, uint32_t shift, uint32_t mask, int32_t* out)
+{
+    uint64_t bit_pos = static_cast<uint64_t>(begin) * stride_bits;
+    for (size_t i = begin; i < end; i++, bit_pos += stride_bits)
+    {
+        size_t byte = static_cast<size_t>(bit_pos >> 3);
+        uint64_t word = 0;
+        if (byte + sizeof(word) <= size)
+            memcpy(&word, data + byte, sizeof(word));
+        else
+        {
+            for (size_t b = byte; b < size; b++)
+                word |= static_cast<uint64_t>(data[b]) << (8 * (b - byte));
+        }
+        uint32_t field = static_cast<uint32_t>(word >> (bit_pos & 7));
+        out[i] = static_cast<int32_t>((field >> shift) & mask);
+    }
+}
+
+void UnpackScalar(const uint8_t* data, size_t size, size_t count, uint32_t stride_bits,
+    uint32_t shift, uint32_t mask, int32_t* out)
+{
+    UnpackRangeScalar(data, size, 0, count, stride_bits, shift, mask, out);
+}
+
+#ifdef ANALOG_SAMPLE_UNPACK_X86
+
+__attribute__((target("sse2")))
+void UnpackSSE2(const uint8_t* data, size_t size, size_t count, uint32_t stride_bits,
+    uint32_t shift, uint32_t mask, int32_t* out)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i shift_count = _mm_cvtsi32_si128(static_cast<int>(shift));
+    size_t i = 0;
+    if (stride_bits == 8)
+    {
+        const __m128i mask16 = _mm_set1_epi16(static_cast<short>(mask));
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i lo = _mm_and_si128(_mm_srl_epi16(_mm_unpacklo_epi8(v, zero), shift_count),
+                mask16);
+            __m128i hi = _mm_and_si128(_mm_srl_epi16(_mm_unpackhi_epi8(v, zero), shift_count),
+                mask16);
+            __m128i* dst = reinterpret_cast<__m128i*>(out + i);
+            _mm_storeu_si128(dst, _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(hi, zero));
+        }
+    }
+    else if (stride_bits == 16)
+    {
+        const __m128i mask16 = _mm_set1_epi16(static_cast<short>(mask));
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 2 * i));
+            v = _mm_and_si128(_mm_srl_epi16(v, shift_count), mask16);
+            __m128i* dst = reinterpret_cast<__m128i*>(out + i);
+            _mm_storeu_si128(dst, _mm_unpacklo_epi16(v, zero));
+            _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(v, zero));
+        }
+    }
+    else if (stride_bits == 32)
+    {
+        const __m128i mask32 = _mm_set1_epi32(static_cast<int>(mask));
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 4 * i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                _mm_and_si128(_mm_srl_epi32(v, shift_count), mask32));
+        }
+    }
+    UnpackRangeScalar(data, size, i, count, stride_bits, shift, mask, out);
+}
+
+__attribute__((target("avx2")))
+void UnpackAVX2(const uint8_t* data, size_t size, size_t count, uint32_t stride_bits,
+    uint32_t shift, uint32_t mask, int32_t* out)
+{
+    const __m128i shift_count = _mm_cvtsi32_si128(static_cast<int>(shift));
+    const __m256i mask32 = _mm256_set1_epi32(static_cast<int>(mask));
+    size_t i = 0;
+    if (stride_bits == 8)
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m256i lo = _mm256_cvtepu8_epi32(v);
+            __m256i hi = _mm256_cvtepu8_epi32(_mm_srli_si128(v, 8));
+            __m256i* dst = reinterpret_cast<__m256i*>(out + i);
+            _mm256_storeu_si256(dst, _mm256_and_si256(_mm256_srl_epi32(lo, shift_count), mask32));
+            _mm256_storeu_si256(dst + 1,
+                _mm256_and_si256(_mm256_srl_epi32(hi, shift_count), mask32));
+        }
+    }
+    else if (stride_bits == 16)
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 2 * i));
+            __m256i lo = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(v));
+            __m256i hi = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(v, 1));
+            __m256i* dst = reinterpret_cast<__m256i*>(out + i);
+            _mm256_storeu_si256(dst, _mm256_and_si256(_mm256_srl_epi32(lo, shift_count), mask32));
+            _mm256_storeu_si256(dst + 1,
+                _mm256_and_si256(_mm256_srl_epi32(hi, shift_count), mask32));
+        }
+    }
+    else if (stride_bits == 32)
+    {
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 4 * i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                _mm256_and_si256(_mm256_srl_epi32(v, shift_count), mask32));
+        }
+    }
+    else
+    {
+        // Eight samples span exactly stride_bits bytes, so the byte offset
+        // and shift of each lane are the same in every group.
+        int32_t offsets[8];
+        int32_t shifts[8];
+        for (uint32_t lane = 0; lane < 8; lane++)
+        {
+            offsets[lane] = static_cast<int32_t>((lane * stride_bits) >> 3);
+            shifts[lane] = static_cast<int32_t>(((lane * stride_bits) & 7) + shift);
+        }
+        const __m256i offset_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offsets));
+        const __m256i shift_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shifts));
+        const size_t group_bytes = stride_bits;
+
+        if (stride_bits + 7 <= 32)
+        {
+            // A 32-bit load at the byte offset holds the field of each lane.
+            const size_t read_bytes = offsets[7] + sizeof(int32_t);
+            const uint8_t* base = data;
+            for (; i + 8 <= count && (i / 8) * group_bytes + read_bytes <= size;
+                 i += 8, base += group_bytes)
+            {
+                __m256i v = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base),
+                    offset_vec, 1);
+                v = _mm256_and_si256(_mm256_srlv_epi32(v, shift_vec), mask32);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+            }
+        }
+        else
+        {
+            // Fields may span five bytes; gather 64-bit words, four lanes
+            // at a time, and keep the low 32 bits of each.
+            const size_t read_bytes = offsets[7] + sizeof(int64_t);
+            const __m128i offset_lo = _mm256_castsi256_si128(offset_vec);
+            const __m128i offset_hi = _mm256_extracti128_si256(offset_vec, 1);
+            const __m256i shift_lo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(shift_vec));
+            const __m256i shift_hi = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(shift_vec, 1));
+            const __m256i low_dwords = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+            const uint8_t* base = data;
+            for (; i + 8 <= count && (i / 8) * group_bytes + read_bytes <= size;
+                 i += 8, base += group_bytes)
+            {
+                const long long* ptr = reinterpret_cast<const long long*>(base);
+                __m256i lo = _mm256_srlv_epi64(_mm256_i32gather_epi64(ptr, offset_lo, 1),
+                    shift_lo);
+                __m256i hi = _mm256_srlv_epi64(_mm256_i32gather_epi64(ptr, offset_hi, 1),
+                    shift_hi);
+                lo = _mm256_permutevar8x32_epi32(lo, low_dwords);
+                hi = _mm256_permutevar8x32_epi32(hi, low_dwords);
+                __m256i v = _mm256_permute2x128_si256(lo, hi, 0x20);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                    _mm256_and_si256(v, mask32));
+            }
+        }
+    }
+    UnpackRangeScalar(data, size, i, count, stride_bits, shift, mask, out);
+}
+
+#endif  // ANALOG_SAMPLE_UNPACK_X86
+}  // namespace
+
+AnalogSampleUnpack::AnalogSampleUnpack(ChecksumKernels::ISA isa) :
+    isa_(ChecksumKernels::Select(isa).isa), unpack_(&UnpackScalar)
+{
+#ifdef ANALOG_SAMPLE_UNPACK_X86
+    if (isa_ == ChecksumKernels::ISA::AVX2)
+        unpack_ = &UnpackAVX2;
+    else if (isa_ == ChecksumKernels::ISA::SSE2)
+        unpack_ = &UnpackSSE2;
+#endif
+}
+
+bool AnalogSampleUnpack::IsValid(uint32_t stride_bits, uint32_t shift, uint32_t sample_bits)
+{
+    if (stride_bits < 1 || stride_bits > max_sample_bits)
+        return false;
+    if (sample_bits < 1 || sample_bits > max_sample_bits)
+        return false;
+    return shift + sample_bits <= stride_bits;
+}
+
+bool AnalogSampleUnpack::Unpack(const uint8_t* data, size_t size, size_t count,
+    uint32_t stride_bits, uint32_t shift, uint32_t sample_bits, int32_t* out) const
+{
+    if (!IsValid(stride_bits, shift, sample_bits))
+        return false;
+    if (count > (static_cast<uint64_t>(size) * 8) / stride_bits)
+        return false;
+
+    uint32_t mask = sample_bits == 32 ? UINT32_MAX : ((uint32_t(1) << sample_bits) - 1);
+    unpack_(data, size, count, stride_bits, shift, mask, out);
+    return true;
+}
@@ -0,0 +1,142 @@
+#include "binary_cache.h"
+
+const char BinaryCacheReader::magic_[8] = {'T', 'I', 'P', 'C', 'A', 'C', 'H', 'E'};
+const uint32_t BinaryCacheReader::format_version_ = 1;
+const uint32_t BinaryCacheReader::byte_order_mark_ = 0x01020304;
+
+void BinaryCacheWriter::WriteString(const std::string& value)
+{
+    WriteSize(value.size());
+    payload_.insert(payload_.end(), value.begin(), value.end());
+}
+
+int BinaryCacheWriter::Save(const ManagedPath& path, const std::string& key,
+                            const std::string& version) const
+{
+    BinaryCacheWriter header;
+    for (size_t i = 0; i < sizeof(BinaryCacheReader::magic_); i++)
+        header.Write(BinaryCacheReader::magic_[i]);
+    header.Write(BinaryCacheReader::byte_order_mark_);
+    header.Write(BinaryCacheReader::format_version_);
+    header.WriteString(version);
+    header.WriteString(key);
+    header.WriteSize(payload_.size());
+
+    ManagedPath temp_path(path.string() + ".tmp");
+    FILE* file = fopen(temp_path.string().c_str(), "wb");
+    if (file == NULL)
+    {
+        printf("BinaryCacheWriter::Save(): Failed to open %s\n", temp_path.RawString().c_str());
+        return EX_CANTCREAT;
+    }
+
+    bool write_ok = (fwrite(header.payload().data(), 1, header.payload().size(), file) ==
+                     header.payload().size());
+    if (write_ok && payload_.size() > 0)
+        write_ok = (fwrite(payload_.data(), 1, payload_.size(), file) == payload_.size());
+    if (fclose(file) != 0)
+        write_ok = false;
+
+    if (!write_ok)
+    {
+        printf("BinaryCacheWriter::Save(): Failed to write %s\n", temp_path.RawString().c_str());
+        temp_path.remove();
+        return EX_IOERR;
+    }
+
+    std::error_code ec;
+    fs::rename(temp_path, path, ec);
+    if (ec)
+    {
+        printf("BinaryCacheWriter::Save(): Failed to rename %s: %s\n",
+               temp_path.RawString().c_str(), ec.message().c_str());
+        temp_path.remove();
+        return EX_IOERR;
+    }
+    return EX_OK;
+}
+
+int BinaryCacheReader::Open(const ManagedPath& path, const std::string& key,
+                            const std::string& version)
+{
+    Close();
+    if (!path.is_regular_file())
+        return EX_NOINPUT;
+
+    if (file_.Open(path, true) != EX_OK)
+        return EX_NOINPUT;
+
+    pos_ = file_.data();
+    end_ = file_.data() + file_.size();
+    ok_ = true;
+
+    char magic[sizeof(magic_)];
+    if (!ReadBytes(magic, sizeof(magic)) || memcmp(magic, magic_, sizeof(magic_)) != 0)
+    {
+        Close();
+        return EX_DATAERR;
+    }
+
+    uint32_t bom = 0;
+    uint32_t format_version = 0;
+    std::string cache_version;
+    std::string cache_key;
+    size_t payload_size = 0;
+    if (!Read(bom) || bom != byte_order_mark_ ||
+        !Read(format_version) || format_version != format_version_ ||
+        !ReadString(cache_version) || cache_version != version ||
+        !ReadString(cache_key) || cache_key != key ||
+        !ReadSize(payload_size) || payload_size != static_cast<size_t>(end_ - pos_))
+    {
+        Close();
+        return EX_DATAERR;
+    }
+    return EX_OK;
+}
+
+void BinaryCacheReader::Close()
+{
+    file_.Close();
+    pos_ = nullptr;
+    end_ = nullptr;
+    ok_ = false;
+}
+
+bool BinaryCacheReader::ReadBytes(void* dest, size_t count)
+{
+    if (!ok_ || count > static_cast<size_t>(end_ - pos_))
+    {
+        ok_ = false;
+        return false;
+    }
+    if (count > 0)
+        memcpy(dest, pos_, count);
+    pos_ += count;
+    return true;
+}
+
+bool BinaryCacheReader::ReadSize(size_t& size)
+{
+    uint64_t value = 0;
+    if (!Read(value))
+        return false;
+
+    if (value > static_cast<uint64_t>(end_ - pos_))
+    {
+        ok_ = false;
+        return false;
+    }
+    size = static_cast<size_t>(value);
+    return true;
+}
+
+bool BinaryCacheReader::ReadString(std::string& value)
+{
+    size_t size = 0;
+    if (!ReadSize(size))
+        return false;
+
+    value.assign(reinterpret_cast<const char*>(pos_), size);
+    pos_ += size;
+    return true;
+}
@@ -0,0 +1,244 @@
+#include "checksum_kernels.h"
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CHECKSUM_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+//                              Scalar kernels
+///////////////////////////////////////////////////////////////////////////////
+
+// Words are copied rather than dereferenced via a cast pointer because the
+// data need not be aligned.
+
+uint8_t Sum8Scalar(const uint8_t* data, size_t count)
+{
+    uint8_t sum = 0;
+    for (size_t i = 0; i < count; i++)
+        sum += data[i];
+    return sum;
+}
+
+uint16_t Sum16Scalar(const uint8_t* data, size_t count)
+{
+    uint16_t sum = 0;
+    uint16_t word = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        memcpy(&word, data + i * sizeof(uint16_t), sizeof(uint16_t));
+        sum += word;
+    }
+    return sum;
+}
+
+uint32_t Sum32Scalar(const uint8_t* data, size_t count)
+{
+    uint32_t sum = 0;
+    uint32_t word = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        memcpy(&word, data + i * sizeof(uint32_t), sizeof(uint32_t));
+        sum += word;
+    }
+    return sum;
+}
+
+#ifdef CHECKSUM_KERNELS_X86
+
+///////////////////////////////////////////////////////////////////////////////
+//                              SSE2 kernels
+///////////////////////////////////////////////////////////////////////////////
+
+// Lane-wise modular sums are reduced to a single value once at the end of
+// each kernel. The sum of the lanes modulo 2^n is equal to the sum of all
+// words modulo 2^n.
+
+__attribute__((target("sse2")))
+uint8_t Sum8SSE2(const uint8_t* data, size_t count)
+{
+    // psadbw sums each group of 8 bytes into a 64-bit lane, which can't
+    // overflow for any practical count.
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 16));
+        acc0 = _mm_add_epi64(acc0, _mm_sad_epu8(v0, zero));
+        acc1 = _mm_add_epi64(acc1, _mm_sad_epu8(v1, zero));
+    }
+    uint64_t lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi64(acc0, acc1));
+    return static_cast<uint8_t>(lanes[0] + lanes[1] + Sum8Scalar(data + i, count - i));
+}
+
+__attribute__((target("sse2")))
+uint16_t Sum16SSE2(const uint8_t* data, size_t count)
+{
+    const size_t per_vec = sizeof(__m128i) / sizeof(uint16_t);
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 * per_vec <= count; i += 2 * per_vec)
+    {
+        const uint8_t* ptr = data + i * sizeof(uint16_t);
+        acc0 = _mm_add_epi16(acc0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+        acc1 = _mm_add_epi16(acc1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 16)));
+    }
+    uint16_t lanes[per_vec];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi16(acc0, acc1));
+    uint16_t sum = Sum16Scalar(data + i * sizeof(uint16_t), count - i);
+    for (size_t lane = 0; lane < per_vec; lane++)
+        sum += lanes[lane];
+    return sum;
+}
+
+__attribute__((target("sse2")))
+uint32_t Sum32SSE2(const uint8_t* data, size_t count)
+{
+    const size_t per_vec = sizeof(__m128i) / sizeof(uint32_t);
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 * per_vec <= count; i += 2 * per_vec)
+    {
+        const uint8_t* ptr = data + i * sizeof(uint32_t);
+        acc0 = _mm_add_epi32(acc0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+        acc1 = _mm_add_epi32(acc1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + 16)));
+    }
+    uint32_t lanes[per_vec];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi32(acc0, acc1));
+    uint32_t sum = Sum32Scalar(data + i * sizeof(uint32_t), count - i);
+    for (size_t lane = 0; lane < per_vec; lane++)
+        sum += lanes[lane];
+    return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//                              AVX2 kernels
+///////////////////////////////////////////////////////////////////////////////
+
+__attribute__((target("avx2")))
+uint8_t Sum8AVX2(const uint8_t* data, size_t count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 64 <= count; i += 64)
+    {
+        __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 32));
+        acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(v0, zero));
+        acc1 = _mm256_add_epi64(acc1, _mm256_sad_epu8(v1, zero));
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+    return static_cast<uint8_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+        Sum8Scalar(data + i, count - i));
+}
+
+__attribute__((target("avx2")))
+uint16_t Sum16AVX2(const uint8_t* data, size_t count)
+{
+    const size_t per_vec = sizeof(__m256i) / sizeof(uint16_t);
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 2 * per_vec <= count; i += 2 * per_vec)
+    {
+        const uint8_t* ptr = data + i * sizeof(uint16_t);
+        acc0 = _mm256_add_epi16(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));
+        acc1 = _mm256_add_epi16(acc1,
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 32)));
+    }
+    uint16_t lanes[per_vec];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi16(acc0, acc1));
+    uint16_t sum = Sum16Scalar(data + i * sizeof(uint16_t), count - i);
+    for (size_t lane = 0; lane < per_vec; lane++)
+        sum += lanes[lane];
+    return sum;
+}
+
+__attribute__((target("avx2")))
+uint32_t Sum32AVX2(const uint8_t* data, size_t count)
+{
+    const size_t per_vec = sizeof(__m256i) / sizeof(uint32_t);
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 2 * per_vec <= count; i += 2 * per_vec)
+    {
+        const uint8_t* ptr = data + i * sizeof(uint32_t);
+        acc0 = _mm256_add_epi32(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));
+        acc1 = _mm256_add_epi32(acc1,
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 32)));
+    }
+    uint32_t lanes[per_vec];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi32(acc0, acc1));
+    uint32_t sum = Sum32Scalar(data + i * sizeof(uint32_t), count - i);
+    for (size_t lane = 0; lane < per_vec; lane++)
+        sum += lanes[lane];
+    return sum;
+}
+
+#endif  // CHECKSUM_KERNELS_X86
+}  // namespace
+
+const ChecksumKernels& ChecksumKernels::Dispatched()
+{
+    static const ChecksumKernels kernels = Select(ISA::AVX2);
+    return kernels;
+}
+
+bool ChecksumKernels::IsSupported(ISA isa)
+{
+#ifdef CHECKSUM_KERNELS_X86
+    __builtin_cpu_init();
+#endif
+    switch (isa)
+    {
+        case ISA::SCALAR:
+            return true;
+#ifdef CHECKSUM_KERNELS_X86
+        case ISA::SSE2:
+            return __builtin_cpu_supports("sse2");
+        case ISA::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+ChecksumKernels ChecksumKernels::Select(ISA isa)
+{
+#ifdef CHECKSUM_KERNELS_X86
+    if (isa == ISA::AVX2 && IsSupported(ISA::AVX2))
+        return ChecksumKernels{ISA::AVX2, &Sum8AVX2, &Sum16AVX2, &Sum32AVX2};
+    if (isa >= ISA::SSE2 && IsSupported(ISA::SSE2))
+        return ChecksumKernels{ISA::SSE2, &Sum8SSE2, &Sum16SSE2, &Sum32SSE2};
+#endif
+    return ChecksumKernels{ISA::SCALAR, &Sum8Scalar, &Sum16Scalar, &Sum32Scalar};
+}
+
+std::string ChecksumKernels::ISAString(ISA isa)
+{
+    switch (isa)
+    {
+        case ISA::SCALAR:
+            return "scalar";
+        case ISA::SSE2:
+            return "sse2";
+        case ISA::AVX2:
+            return "avx2";
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,99 @@
+#include "diagnostics.h"
+
+const size_t Diagnostics::default_exemplar_limit;
+
+bool Diagnostics::Record(std::string_view event, uint64_t offset)
+{
+    std::map<std::string, Event, std::less<>>::iterator it = events_.find(event);
+    if (it == events_.end())
+        it = events_.emplace(std::string(event), Event{0, {}}).first;
+
+    it->second.count++;
+    if (it->second.exemplar_offsets.size() < exemplar_limit_)
+    {
+        it->second.exemplar_offsets.push_back(offset);
+        return true;
+    }
+    return false;
+}
+
+uint64_t Diagnostics::GetCount(std::string_view event) const
+{
+    std::map<std::string, Event, std::less<>>::const_iterator it = events_.find(event);
+    if (it == events_.cend())
+        return 0;
+    return it->second.count;
+}
+
+uint64_t Diagnostics::GetTotalCount() const
+{
+    uint64_t total = 0;
+    for (std::map<std::string, Event, std::less<>>::const_iterator it = events_.cbegin();
+         it != events_.cend(); ++it)
+        total += it->second.count;
+    return total;
+}
+
+std::map<std::string, uint64_t> Diagnostics::GetCounts() const
+{
+    std::map<std::string, uint64_t> counts;
+    for (std::map<std::string, Event, std::less<>>::const_iterator it = events_.cbegin();
+         it != events_.cend(); ++it)
+        counts[it->first] = it->second.count;
+    return counts;
+}
+
+std::map<std::string, std::vector<uint64_t>> Diagnostics::GetExemplarOffsets() const
+{
+    std::map<std::string, std::vector<uint64_t>> offsets;
+    for (std::map<std::string, Event, std::less<>>::const_iterator it = events_.cbegin();
+         it != events_.cend(); ++it)
+        offsets[it->first] = it->second.exemplar_offsets;
+    return offsets;
+}
+
+void Diagnostics::Merge(const Diagnostics& other)
+{
+    for (std::map<std::string, Event, std::less<>>::const_iterator it = other.events_.cbegin();
+         it != other.events_.cend(); ++it)
+    {
+        Event& event = events_[it->first];
+        event.count += it->second.count;
+        event.exemplar_offsets.insert(event.exemplar_offsets.end(),
+            it->second.exemplar_offsets.cbegin(), it->second.exemplar_offsets.cend());
+        std::sort(event.exemplar_offsets.begin(), event.exemplar_offsets.end());
+        if (event.exemplar_offsets.size() > exemplar_limit_)
+            event.exemplar_offsets.resize(exemplar_limit_);
+    }
+}
+
+std::vector<std::string> Diagnostics::FormatSummary(const std::string& offset_label) const
+{
+    std::vector<std::string> lines;
+    char buffer[64];
+    for (std::map<std::string, Event, std::less<>>::const_iterator it = events_.cbegin();
+         it != events_.cend(); ++it)
+    {
+        const Event& event = it->second;
+        uint64_t suppressed = event.count - std::min<uint64_t>(event.count,
+            event.exemplar_offsets.size());
+        snprintf(buffer, sizeof(buffer), ": %llu (%llu not logged)",
+            static_cast<unsigned long long>(event.count),
+            static_cast<unsigned long long>(suppressed));
+        std::string line = it->first + buffer;
+
+        if (!event.exemplar_offsets.empty())
+        {
+            line += ", first at " + offset_label + ":";
+            for (std::vector<uint64_t>::const_iterator offset = event.exemplar_offsets.cbegin();
+                 offset != event.exemplar_offsets.cend(); ++offset)
+            {
+                snprintf(buffer, sizeof(buffer), " %llu",
+                    static_cast<unsigned long long>(*offset));
+                line += buffer;
+            }
+        }
+        lines.push_back(line);
+    }
+    return lines;
+}
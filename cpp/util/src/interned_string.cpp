@@ -0,0 +1,36 @@
+#include "interned_string.h"
+
+StringPool& StringPool::Global()
+{
+    static StringPool pool;
+    return pool;
+}
+
+const std::string* StringPool::Intern(std::string_view value)
+{
+    if (value.empty())
+        return &InternedString::Empty();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unordered_map<std::string_view, const std::string*>::const_iterator it =
+        index_.find(value);
+    if (it != index_.cend())
+        return it->second;
+
+    strings_.emplace_back(value);
+    const std::string* pooled = &strings_.back();
+    index_[std::string_view(*pooled)] = pooled;
+    return pooled;
+}
+
+size_t StringPool::Size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return strings_.size();
+}
+
+const std::string& InternedString::Empty()
+{
+    static const std::string empty;
+    return empty;
+}
@@ -0,0 +1,153 @@
+#include "memory_mapped_file.h"
+
+MemoryMappedFile::MemoryMappedFile() : data_(nullptr), size_(0), is_open_(false)
+#ifdef __linux__
+    , fd_(-1)
+#elif defined __WIN64
+    , file_handle_(INVALID_HANDLE_VALUE), map_handle_(NULL)
+#endif
+{
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    Close();
+}
+
+#ifdef __linux__
+int MemoryMappedFile::Open(const ManagedPath& path, bool sequential)
+{
+    Close();
+
+    fd_ = open(path.string().c_str(), O_RDONLY);
+    if (fd_ == -1)
+    {
+        printf("MemoryMappedFile::Open(): Failed to open %s: %s\n",
+               path.RawString().c_str(), strerror(errno));
+        return EX_NOINPUT;
+    }
+
+    struct stat file_stat;
+    if (fstat(fd_, &file_stat) != 0)
+    {
+        printf("MemoryMappedFile::Open(): Failed to stat %s: %s\n",
+               path.RawString().c_str(), strerror(errno));
+        Close();
+        return EX_IOERR;
+    }
+    size_ = static_cast<uint64_t>(file_stat.st_size);
+
+    // mmap does not permit zero-length maps
+    if (size_ == 0)
+    {
+        is_open_ = true;
+        return EX_OK;
+    }
+
+    void* addr = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (addr == MAP_FAILED)
+    {
+        printf("MemoryMappedFile::Open(): Failed to map %s: %s\n",
+               path.RawString().c_str(), strerror(errno));
+        Close();
+        return EX_IOERR;
+    }
+    data_ = static_cast<const uint8_t*>(addr);
+
+    // Advice is a hint only, failure is not an error
+    if (sequential)
+        madvise(addr, size_, MADV_SEQUENTIAL);
+
+    is_open_ = true;
+    return EX_OK;
+}
+
+void MemoryMappedFile::Close()
+{
+    if (data_ != nullptr)
+        munmap(const_cast<uint8_t*>(data_), size_);
+
+    if (fd_ != -1)
+        close(fd_);
+
+    data_ = nullptr;
+    size_ = 0;
+    fd_ = -1;
+    is_open_ = false;
+}
+
+#elif defined __WIN64
+int MemoryMappedFile::Open(const ManagedPath& path, bool sequential)
+{
+    Close();
+
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+    if (sequential)
+        flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+
+    file_handle_ = CreateFileA(path.string().c_str(), GENERIC_READ, FILE_SHARE_READ,
+                               NULL, OPEN_EXISTING, flags, NULL);
+    if (file_handle_ == INVALID_HANDLE_VALUE)
+    {
+        printf("MemoryMappedFile::Open(): Failed to open %s\n",
+               path.RawString().c_str());
+        return EX_NOINPUT;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle_, &file_size))
+    {
+        printf("MemoryMappedFile::Open(): Failed to get size of %s\n",
+               path.RawString().c_str());
+        Close();
+        return EX_IOERR;
+    }
+    size_ = static_cast<uint64_t>(file_size.QuadPart);
+
+    // CreateFileMapping does not permit zero-length maps
+    if (size_ == 0)
+    {
+        is_open_ = true;
+        return EX_OK;
+    }
+
+    map_handle_ = CreateFileMappingA(file_handle_, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (map_handle_ == NULL)
+    {
+        printf("MemoryMappedFile::Open(): Failed to create mapping for %s\n",
+               path.RawString().c_str());
+        Close();
+        return EX_IOERR;
+    }
+
+    data_ = static_cast<const uint8_t*>(MapViewOfFile(map_handle_, FILE_MAP_READ, 0, 0, 0));
+    if (data_ == nullptr)
+    {
+        printf("MemoryMappedFile::Open(): Failed to map %s\n",
+               path.RawString().c_str());
+        Close();
+        return EX_IOERR;
+    }
+
+    is_open_ = true;
+    return EX_OK;
+}
+
+void MemoryMappedFile::Close()
+{
+    if (data_ != nullptr)
+        UnmapViewOfFile(data_);
+
+    if (map_handle_ != NULL)
+        CloseHandle(map_handle_);
+
+    if (file_handle_ != INVALID_HANDLE_VALUE)
+        CloseHandle(file_handle_);
+
+    data_ = nullptr;
+    size_ = 0;
+    map_handle_ = NULL;
+    file_handle_ = INVALID_HANDLE_VALUE;
+    is_open_ = false;
+}
+#endif  // #elif defined __WIN64
@@ -0,0 +1,178 @@
+#include "pcm_frame_sync.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PCM_FRAME_SYNC_X86
+#include <immintrin.h>
+#endif
+
+const uint32_t PCMFrameSync::min_pattern_bits;
+const uint32_t PCMFrameSync::max_pattern_bits;
+const uint64_t PCMFrameSync::npos;
+
+namespace
+{
+size_t FindCandidateScalar(const uint8_t* data, size_t begin, size_t end,
+    const PCMFrameSync::CandidateKeys& keys)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        if (keys.shift_masks[data[i]] != 0)
+            return i;
+    }
+    return end;
+}
+
+#ifdef PCM_FRAME_SYNC_X86
+
+__attribute__((target("sse2")))
+size_t FindCandidateSSE2(const uint8_t* data, size_t begin, size_t end,
+    const PCMFrameSync::CandidateKeys& keys)
+{
+    __m128i key_vecs[8];
+    for (size_t k = 0; k < keys.key_count; k++)
+        key_vecs[k] = _mm_set1_epi8(static_cast<char>(keys.keys[k]));
+
+    size_t i = begin;
+    for (; i + 16 <= end; i += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i eq = _mm_cmpeq_epi8(v, key_vecs[0]);
+        for (size_t k = 1; k < keys.key_count; k++)
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi8(v, key_vecs[k]));
+        int mask = _mm_movemask_epi8(eq);
+        if (mask != 0)
+            return i + __builtin_ctz(static_cast<unsigned int>(mask));
+    }
+    return FindCandidateScalar(data, i, end, keys);
+}
+
+__attribute__((target("avx2")))
+size_t FindCandidateAVX2(const uint8_t* data, size_t begin, size_t end,
+    const PCMFrameSync::CandidateKeys& keys)
+{
+    __m256i key_vecs[8];
+    for (size_t k = 0; k < keys.key_count; k++)
+        key_vecs[k] = _mm256_set1_epi8(static_cast<char>(keys.keys[k]));
+
+    size_t i = begin;
+    for (; i + 32 <= end; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i eq = _mm256_cmpeq_epi8(v, key_vecs[0]);
+        for (size_t k = 1; k < keys.key_count; k++)
+            eq = _mm256_or_si256(eq, _mm256_cmpeq_epi8(v, key_vecs[k]));
+        int mask = _mm256_movemask_epi8(eq);
+        if (mask != 0)
+            return i + __builtin_ctz(static_cast<unsigned int>(mask));
+    }
+    return FindCandidateScalar(data, i, end, keys);
+}
+
+#endif  // PCM_FRAME_SYNC_X86
+}  // namespace
+
+PCMFrameSync::PCMFrameSync() : pattern_(0), pattern_bits_(0), keys_(),
+    isa_(ChecksumKernels::ISA::SCALAR), find_candidate_(&FindCandidateScalar)
+{
+    keys_.shift_masks.fill(0);
+    keys_.key_count = 0;
+}
+
+bool PCMFrameSync::Configure(uint64_t pattern, uint32_t pattern_bits, ChecksumKernels::ISA isa)
+{
+    if (pattern_bits < min_pattern_bits || pattern_bits > max_pattern_bits)
+        return false;
+    if (pattern_bits < 64 && (pattern >> pattern_bits) != 0)
+        return false;
+
+    pattern_ = pattern;
+    pattern_bits_ = pattern_bits;
+    keys_.shift_masks.fill(0);
+    keys_.key_count = 0;
+    for (uint32_t shift = 0; shift < 8; shift++)
+    {
+        uint8_t key = static_cast<uint8_t>(pattern >> (pattern_bits - 16 + shift));
+        if (keys_.shift_masks[key] == 0)
+            keys_.keys[keys_.key_count++] = key;
+        keys_.shift_masks[key] |= static_cast<uint8_t>(1 << shift);
+    }
+
+    // Use the same instruction set as the checksum kernels.
+    isa_ = ChecksumKernels::Select(isa).isa;
+    find_candidate_ = &FindCandidateScalar;
+#ifdef PCM_FRAME_SYNC_X86
+    if (isa_ == ChecksumKernels::ISA::AVX2)
+        find_candidate_ = &FindCandidateAVX2;
+    else if (isa_ == ChecksumKernels::ISA::SSE2)
+        find_candidate_ = &FindCandidateSSE2;
+#endif
+    return true;
+}
+
+uint64_t PCMFrameSync::ReadBits(const uint8_t* data, uint64_t bit_pos, uint32_t bit_count)
+{
+    const uint8_t* ptr = data + (bit_pos >> 3);
+    uint32_t shift = static_cast<uint32_t>(bit_pos & 7);
+    uint32_t byte_count = (shift + bit_count + 7) >> 3;
+
+    uint64_t value = 0;
+    uint32_t loaded = byte_count < 8 ? byte_count : 8;
+    for (uint32_t i = 0; i < loaded; i++)
+        value = (value << 8) | ptr[i];
+
+    // The bits span nine bytes. The first byte contributes at most seven
+    // bits and shift is non-zero.
+    if (byte_count == 9)
+    {
+        value = (value << shift) | (ptr[8] >> (8 - shift));
+        return bit_count == 64 ? value : value >> (64 - bit_count);
+    }
+
+    value >>= (byte_count * 8 - shift - bit_count);
+    if (bit_count < 64)
+        value &= (uint64_t(1) << bit_count) - 1;
+    return value;
+}
+
+bool PCMFrameSync::Match(const uint8_t* data, size_t size, uint64_t bit_pos) const
+{
+    if (pattern_bits_ == 0 || bit_pos + pattern_bits_ > static_cast<uint64_t>(size) * 8)
+        return false;
+    return ReadBits(data, bit_pos, pattern_bits_) == pattern_;
+}
+
+uint64_t PCMFrameSync::Find(const uint8_t* data, size_t size, uint64_t begin_bit) const
+{
+    uint64_t total_bits = static_cast<uint64_t>(size) * 8;
+    if (pattern_bits_ == 0 || total_bits < pattern_bits_)
+        return npos;
+    uint64_t last_bit = total_bits - pattern_bits_;
+    if (begin_bit > last_bit)
+        return npos;
+
+    // Candidate byte i corresponds to patterns which begin at bit
+    // positions [8 * (i - 1), 8 * i).
+    size_t end = static_cast<size_t>(last_bit / 8) + 2;
+    if (end > size)
+        end = size;
+    size_t i = static_cast<size_t>(begin_bit / 8) + 1;
+    while (i < end)
+    {
+        i = find_candidate_(data, i, end, keys_);
+        if (i == end)
+            break;
+
+        uint8_t shifts = keys_.shift_masks[data[i]];
+        for (uint32_t shift = 0; shift < 8; shift++)
+        {
+            if ((shifts & (1 << shift)) == 0)
+                continue;
+            uint64_t pos = static_cast<uint64_t>(i - 1) * 8 + shift;
+            if (pos >= begin_bit && pos <= last_bit &&
+                ReadBits(data, pos, pattern_bits_) == pattern_)
+                return pos;
+        }
+        i++;
+    }
+    return npos;
+}
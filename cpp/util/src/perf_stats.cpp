@@ -0,0 +1,262 @@
+#include "perf_stats.h"
+
+uint64_t PerfStats::GetCount(const std::string& name) const
+{
+    std::map<std::string, uint64_t>::const_iterator it = counts_.find(name);
+    if (it == counts_.cend())
+        return 0;
+    return it->second;
+}
+
+uint64_t PerfStats::GetTimeNs(const std::string& name) const
+{
+    std::map<std::string, uint64_t>::const_iterator it = times_ns_.find(name);
+    if (it == times_ns_.cend())
+        return 0;
+    return it->second;
+}
+
+std::map<std::string, double> PerfStats::GetTimesSec() const
+{
+    std::map<std::string, double> times_sec;
+    for (std::map<std::string, uint64_t>::const_iterator it = times_ns_.cbegin();
+         it != times_ns_.cend(); ++it)
+    {
+        times_sec[it->first] = static_cast<double>(it->second) / 1.0e9;
+    }
+    return times_sec;
+}
+
+void PerfStats::Merge(const PerfStats& other)
+{
+    for (std::map<std::string, uint64_t>::const_iterator it = other.counts_.cbegin();
+         it != other.counts_.cend(); ++it)
+    {
+        counts_[it->first] += it->second;
+    }
+    for (std::map<std::string, uint64_t>::const_iterator it = other.times_ns_.cbegin();
+         it != other.times_ns_.cend(); ++it)
+    {
+        times_ns_[it->first] += it->second;
+    }
+}
+
+void PerfReport::AddWorker(const std::string& label, const PerfStats& stats)
+{
+    workers_[label].Merge(stats);
+    total_.Merge(stats);
+}
+
+std::map<std::string, std::map<std::string, uint64_t>> PerfReport::GetWorkerCounts() const
+{
+    std::map<std::string, std::map<std::string, uint64_t>> counts;
+    for (std::map<std::string, PerfStats>::const_iterator it = workers_.cbegin();
+         it != workers_.cend(); ++it)
+    {
+        counts[it->first] = it->second.GetCounts();
+    }
+    return counts;
+}
+
+std::map<std::string, std::map<std::string, double>> PerfReport::GetWorkerTimesSec() const
+{
+    std::map<std::string, std::map<std::string, double>> times;
+    for (std::map<std::string, PerfStats>::const_iterator it = workers_.cbegin();
+         it != workers_.cend(); ++it)
+    {
+        times[it->first] = it->second.GetTimesSec();
+    }
+    return times;
+}
+
+std::string PerfReport::EscapeString(const std::string& value)
+{
+    std::string escaped;
+    for (std::string::const_iterator it = value.cbegin(); it != value.cend(); ++it)
+    {
+        switch (*it)
+        {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            default:
+                escaped += *it;
+                break;
+        }
+    }
+    return escaped;
+}
+
+std::string PerfReport::SanitizeMetricName(const std::string& name)
+{
+    std::string sanitized(name);
+    for (size_t i = 0; i < sanitized.size(); i++)
+    {
+        char c = sanitized[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+              (c >= '0' && c <= '9' && i > 0) || c == '_' || c == ':'))
+            sanitized[i] = '_';
+    }
+    return sanitized;
+}
+
+// Format the counts and times of a single PerfStats object as a
+// JSON object.
+static std::string FormatStatsJSON(const PerfStats& stats, const std::string& indent)
+{
+    char buffer[64];
+    std::string json = "{\n" + indent + "  \"counts\": {";
+    for (std::map<std::string, uint64_t>::const_iterator it = stats.GetCounts().cbegin();
+         it != stats.GetCounts().cend(); ++it)
+    {
+        snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(it->second));
+        json += (it == stats.GetCounts().cbegin() ? "\n" : ",\n") + indent + "    \"" +
+                PerfReport::EscapeString(it->first) + "\": " + buffer;
+    }
+    json += (stats.GetCounts().empty() ? "},\n" : "\n" + indent + "  },\n");
+
+    json += indent + "  \"times_sec\": {";
+    for (std::map<std::string, uint64_t>::const_iterator it = stats.GetTimesNs().cbegin();
+         it != stats.GetTimesNs().cend(); ++it)
+    {
+        snprintf(buffer, sizeof(buffer), "%.9f", static_cast<double>(it->second) / 1.0e9);
+        json += (it == stats.GetTimesNs().cbegin() ? "\n" : ",\n") + indent + "    \"" +
+                PerfReport::EscapeString(it->first) + "\": " + buffer;
+    }
+    json += (stats.GetTimesNs().empty() ? "}\n" : "\n" + indent + "  }\n");
+    json += indent + "}";
+    return json;
+}
+
+std::string PerfReport::FormatJSON(const std::map<std::string, std::string>& labels) const
+{
+    std::string json = "{\n";
+    for (std::map<std::string, std::string>::const_iterator it = labels.cbegin();
+         it != labels.cend(); ++it)
+    {
+        json += "  \"" + EscapeString(it->first) + "\": \"" + EscapeString(it->second) + "\",\n";
+    }
+    json += "  \"total\": " + FormatStatsJSON(total_, "  ") + ",\n";
+    json += "  \"workers\": {";
+    for (std::map<std::string, PerfStats>::const_iterator it = workers_.cbegin();
+         it != workers_.cend(); ++it)
+    {
+        json += (it == workers_.cbegin() ? "\n" : ",\n");
+        json += "    \"" + EscapeString(it->first) + "\": " + FormatStatsJSON(it->second, "    ");
+    }
+    json += (workers_.empty() ? "}\n" : "\n  }\n");
+    json += "}\n";
+    return json;
+}
+
+std::string PerfReport::FormatPrometheus(const std::string& prefix,
+                                         const std::map<std::string, std::string>& labels) const
+{
+    std::string common_labels;
+    for (std::map<std::string, std::string>::const_iterator it = labels.cbegin();
+         it != labels.cend(); ++it)
+    {
+        common_labels += SanitizeMetricName(it->first) + "=\"" + EscapeString(it->second) + "\",";
+    }
+
+    // Group samples by metric name, as required by the format
+    std::map<std::string, std::string> count_samples;
+    std::map<std::string, std::string> time_samples;
+    char buffer[64];
+    for (std::map<std::string, PerfStats>::const_iterator worker = workers_.cbegin();
+         worker != workers_.cend(); ++worker)
+    {
+        std::string sample_labels = "{" + common_labels + "worker=\"" +
+                                    EscapeString(worker->first) + "\"} ";
+        for (std::map<std::string, uint64_t>::const_iterator it =
+                 worker->second.GetCounts().cbegin();
+             it != worker->second.GetCounts().cend(); ++it)
+        {
+            std::string metric = SanitizeMetricName(prefix + "_" + it->first + "_total");
+            snprintf(buffer, sizeof(buffer), "%llu\n",
+                     static_cast<unsigned long long>(it->second));
+            count_samples[metric] += metric + sample_labels + buffer;
+        }
+        for (std::map<std::string, uint64_t>::const_iterator it =
+                 worker->second.GetTimesNs().cbegin();
+             it != worker->second.GetTimesNs().cend(); ++it)
+        {
+            std::string metric = SanitizeMetricName(prefix + "_" + it->first + "_seconds_total");
+            snprintf(buffer, sizeof(buffer), "%.9f\n", static_cast<double>(it->second) / 1.0e9);
+            time_samples[metric] += metric + sample_labels + buffer;
+        }
+    }
+
+    std::string text;
+    for (std::map<std::string, std::string>::const_iterator it = count_samples.cbegin();
+         it != count_samples.cend(); ++it)
+    {
+        text += "# TYPE " + it->first + " counter\n" + it->second;
+    }
+    for (std::map<std::string, std::string>::const_iterator it = time_samples.cbegin();
+         it != time_samples.cend(); ++it)
+    {
+        text += "# TYPE " + it->first + " counter\n" + it->second;
+    }
+    return text;
+}
+
+bool PerfReport::IsSupportedPath(const ManagedPath& path)
+{
+    std::string ext = path.extension().RawString();
+    return (ext == ".json" || ext == ".prom");
+}
+
+int PerfReport::Write(const ManagedPath& path, const std::string& prefix,
+                      const std::map<std::string, std::string>& labels) const
+{
+    std::string text;
+    std::string ext = path.extension().RawString();
+    if (ext == ".json")
+        text = FormatJSON(labels);
+    else if (ext == ".prom")
+        text = FormatPrometheus(prefix, labels);
+    else
+    {
+        printf("PerfReport::Write(): Extension of %s is not .json or .prom\n",
+               path.RawString().c_str());
+        return EX_USAGE;
+    }
+
+    // Write to a temporary file and rename, such that a textfile
+    // collector never reads a partial file.
+    ManagedPath temp_path(path.string() + ".tmp");
+    FILE* file = fopen(temp_path.string().c_str(), "wb");
+    if (file == NULL)
+    {
+        printf("PerfReport::Write(): Failed to open %s\n", temp_path.RawString().c_str());
+        return EX_CANTCREAT;
+    }
+    bool write_ok = (fwrite(text.data(), 1, text.size(), file) == text.size());
+    if (fclose(file) != 0)
+        write_ok = false;
+
+    if (!write_ok)
+    {
+        printf("PerfReport::Write(): Failed to write %s\n", temp_path.RawString().c_str());
+        temp_path.remove();
+        return EX_CANTCREAT;
+    }
+
+    std::error_code ec;
+    fs::rename(temp_path, path, ec);
+    if (ec)
+    {
+        printf("PerfReport::Write(): Failed to rename %s: %s\n",
+               temp_path.RawString().c_str(), ec.message().c_str());
+        temp_path.remove();
+        return EX_CANTCREAT;
+    }
+    return EX_OK;
+}
@@ -0,0 +1,142 @@
+#ifndef BINARY_COMPARATOR_H_
+#define BINARY_COMPARATOR_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <utility>
+#include "sysexits.h"
+#include "managed_path.h"
+#include "memory_mapped_file.h"
+
+/*
+Compare two files byte by byte. Both files are memory mapped and
+the common length is split into contiguous ranges, each compared by
+a separate thread. Blocks are first compared with memcmp, which is
+vectorized by the C library, and only blocks which differ are scanned
+to locate and count mismatched bytes.
+
+Configurable byte ranges may be masked, i.e., excluded from the
+comparison, for example to ignore time stamps in a file header.
+*/
+class BinaryComparator
+{
+   private:
+    // Maximum count of threads used to compare ranges
+    int thread_count_;
+
+    // Count of bytes compared with a single memcmp call
+    uint64_t block_size_;
+
+    // Sorted, non-overlapping [begin, end) byte ranges to ignore
+    std::vector<std::pair<uint64_t, uint64_t>> masked_ranges_;
+
+    // Results of the last comparison
+    uint64_t first_mismatch_offset_;
+    uint64_t mismatch_count_;
+    uint64_t compared_count_;
+    bool size_mismatch_;
+
+    /*
+    Compare [begin, end) of both buffers, skipping masked ranges.
+    Executed by a single thread.
+
+    Args:
+        buff1           --> First buffer
+        buff2           --> Second buffer
+        begin           --> Offset of the first byte to compare
+        end             --> Offset of one past the last byte to compare
+        first_mismatch  --> Output, offset of the first mismatched
+                            byte or UINT64_MAX if none
+        mismatch_count  --> Output, count of mismatched bytes
+        compared_count  --> Output, count of unmasked bytes compared
+    */
+    void CompareRange(const uint8_t* buff1, const uint8_t* buff2,
+                      uint64_t begin, uint64_t end, uint64_t& first_mismatch,
+                      uint64_t& mismatch_count, uint64_t& compared_count) const;
+
+   public:
+    static const uint64_t kNoMismatch = UINT64_MAX;
+
+    const uint64_t& first_mismatch_offset;
+    const uint64_t& mismatch_count;
+    const uint64_t& compared_count;
+    const bool& size_mismatch;
+
+    BinaryComparator(int thread_count = 1, uint64_t block_size = 1 << 20);
+
+    /*
+    Exclude a range of bytes from comparison. Overlapping and
+    adjacent ranges are merged.
+
+    Args:
+        offset          --> Byte offset of the beginning of the range
+        length          --> Count of bytes in the range
+
+    Return:
+        False if length is zero or the range overflows; true otherwise.
+    */
+    bool AddMaskedRange(uint64_t offset, uint64_t length);
+
+    /*
+    Parse a string of the form "<offset>:<length>", in which each
+    value is decimal or hexadecimal with a "0x" prefix, and add the
+    masked range.
+
+    Return:
+        False if the string can't be parsed or the range is invalid;
+        true otherwise.
+    */
+    bool AddMaskedRange(const std::string& range_str);
+
+    const std::vector<std::pair<uint64_t, uint64_t>>& GetMaskedRanges() const
+    { return masked_ranges_; }
+
+    /*
+    Compare two files.
+
+    Args:
+        truth_path      --> Path of truth file
+        test_path       --> Path of test file
+        pass            --> Output, true if the files are equal
+                            outside of masked ranges
+
+    Return:
+        EX_OK if the comparison could be made, otherwise EX_NOINPUT
+        or EX_IOERR
+    */
+    int Compare(const ManagedPath& truth_path, const ManagedPath& test_path, bool& pass);
+
+    /*
+    Compare two buffers. If the sizes differ, the buffers are not equal,
+    the bytes beyond the end of the shorter buffer are counted as
+    mismatched and the first mismatch offset is no greater than the
+    shorter size.
+
+    Return:
+        True if the buffers are equal outside of masked ranges;
+        false otherwise.
+    */
+    bool CompareBuffers(const uint8_t* buff1, uint64_t size1,
+                        const uint8_t* buff2, uint64_t size2);
+
+    /*
+    Count mismatched bytes between two buffers.
+
+    Args:
+        buff1           --> First buffer
+        buff2           --> Second buffer
+        count           --> Count of bytes to compare
+        first_index     --> Output, index of the first mismatched
+                            byte or count if there is no mismatch
+
+    Return:
+        Count of mismatched bytes
+    */
+    static uint64_t CountMismatches(const uint8_t* buff1, const uint8_t* buff2,
+                                    uint64_t count, uint64_t& first_index);
+};
+
+#endif  // BINARY_COMPARATOR_H_
@@ -2,21 +2,18 @@
 #define BINARY_COMPARISON_MAIN_H_
 
 #include <cstdio>
+#include <cinttypes>
 #include <string>
-#include <fstream>
 #include <vector>
-#include <algorithm>
 #include "sysexits.h"
 #include "cli_group.h"
+#include "managed_path.h"
+#include "binary_comparator.h"
 
 int BinCompMain(int argc, char** argv);
 
-bool OpenFile(const char* path, std::ifstream& ifs);
-
-std::streamsize ReadBytes(std::ifstream& ifs, std::streamsize read_count, char* data);
-
 bool ConfigureCLI(CLIGroup& cli_group, bool& help_requested, std::string& truth_path_str,
-    std::string& test_path_str);
+    std::string& test_path_str, int& thread_count, std::vector<std::string>& masked_ranges);
 
 
 
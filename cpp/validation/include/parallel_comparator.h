@@ -0,0 +1,248 @@
+#ifndef PARALLEL_COMPARATOR_H_
+#define PARALLEL_COMPARATOR_H_
+
+#include <arrow/api.h>
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "sysexits.h"
+#include "parquet_reader.h"
+#include "managed_path.h"
+
+/*
+Rows of the truth and test datasets which are compared together: count
+rows beginning at offset1 of table1 and offset2 of table2.
+*/
+class ComparisonWindow
+{
+   public:
+    std::shared_ptr<arrow::Table> table1;
+    int64_t offset1;
+    std::shared_ptr<arrow::Table> table2;
+    int64_t offset2;
+    int64_t count;
+
+    // Absolute row index of the first compared row, used to report
+    // mismatch locations
+    int64_t row_base;
+
+    ComparisonWindow() : table1(nullptr), offset1(0), table2(nullptr), offset2(0),
+        count(0), row_base(0) {}
+    ComparisonWindow(const std::shared_ptr<arrow::Table>& t1, int64_t off1,
+        const std::shared_ptr<arrow::Table>& t2, int64_t off2, int64_t cnt, int64_t base)
+        : table1(t1), offset1(off1), table2(t2), offset2(off2), count(cnt), row_base(base) {}
+};
+
+/*
+Compare two Parquet datasets (single file or directory of files)
+in a single pass. Each row group is read once with all columns and
+the columns are compared concurrently. Row group boundaries need not
+align between the truth and test datasets.
+
+Comparison threads are created once per comparison. Each thread
+compares a fixed stride of the columns over all windows, which are
+queued by the reading thread as row groups are read, so the next row
+group is read while the current window is compared.
+
+Unlike Comparator, no assumption is made about the data type of
+list columns and nulls are only equal to nulls.
+*/
+class ParallelComparator
+{
+   private:
+    ParquetReader pr1_;
+    ParquetReader pr2_;
+
+    // Maximum count of threads used to compare columns
+    int thread_count_;
+
+    // Stop comparing all columns after the first column
+    // mismatch is found
+    bool stop_on_fail_;
+
+    bool failure_;
+
+    // Set by any comparison thread when stop_on_fail_ is true
+    // and a mismatch has been found
+    std::atomic<bool> halt_;
+
+    // Maximum of the column counts of the two datasets
+    int column_count_;
+
+    // Zero-indexed, per-column statistics. uint8_t is used instead
+    // of bool to avoid bit packing, since each element is written
+    // by a different thread.
+    std::vector<int64_t> compared_count_;
+    std::vector<uint8_t> columns_passed_;
+    std::vector<uint8_t> columns_active_;
+    std::vector<int64_t> first_mismatch_row_;
+
+    // Human-readable comparison results
+    std::string report_;
+
+    void InitializeStats();
+
+    /*
+    Compare column names and types. Columns which do not match
+    are marked as failed and excluded from the data comparison.
+
+    Return:
+        False if the column counts are not equal or any column
+        name or type does not match; true otherwise.
+    */
+    bool CompareSchema();
+
+    // Windows queued for the comparison threads. Every thread compares
+    // each window, which is removed when all threads have compared it.
+    std::mutex window_mutex_;
+    std::condition_variable window_cv_;
+    std::deque<ComparisonWindow> windows_;
+
+    // Index of the first window in windows_ and total count of
+    // windows queued
+    int64_t window_base_;
+    int64_t window_count_;
+
+    // Set when no more windows will be queued
+    bool windows_complete_;
+
+    // Index of the next window to be compared by each thread
+    std::vector<int64_t> next_window_;
+
+    // Maximum count of windows queued and not yet compared by all
+    // threads, which limits the count of row groups held in memory
+    static const size_t MAX_QUEUED_WINDOWS;
+
+    /*
+    Queue a window for the comparison threads. Blocks until fewer than
+    MAX_QUEUED_WINDOWS windows are queued.
+    */
+    void QueueWindow(const ComparisonWindow& window);
+
+    /*
+    Compare every stride-th active column beginning at column
+    index first_col over all queued windows, until the queue is
+    complete. Executed by a single thread.
+    */
+    void CompareColumnStride(int first_col, int stride);
+
+    /*
+    Compare count rows of every stride-th active column of a window,
+    beginning at column index first_col.
+    */
+    void CompareWindowColumns(const ComparisonWindow& window, int first_col, int stride);
+
+    void MakeReport(bool pass, bool row_count_mismatch);
+
+   public:
+    ParallelComparator(int thread_count = 1, bool stop_on_fail = false);
+    ~ParallelComparator() {}
+
+    /*
+    Pass the two parquet paths to be compared
+
+    Returns: nonzero -> If either path is invalid
+             0       -> Otherwise
+    */
+    int Initialize(ManagedPath path1, ManagedPath path2);
+
+    /*
+    Compare all rows of all columns in the two datasets.
+
+    Returns: False -> If any column doesn't match, or if
+                      one column doesn't exist in the other dataset
+             True  -> If all columns match
+    */
+    bool CompareAll();
+
+    /*
+    Retrieve the count of rows compared in a given column. Includes
+    rows which matched prior to the first mismatch, if present.
+
+    Args:
+        column      --> One-based column index, for consistency
+                        with Comparator
+
+    Return:
+        Count of rows compared, or 0 if column is out of range
+    */
+    int64_t GetComparedCount(int column) const;
+
+    /*
+    Check if a given column passed the last comparison
+
+    Args:
+        column      --> One-based column index
+
+    Returns: False -> If column didn't match
+             True  -> If column matched
+    */
+    bool CheckPassed(int column) const;
+
+    /*
+    Get the absolute row index, within the dataset, of the first
+    mismatched row of a given column.
+
+    Args:
+        column      --> One-based column index
+
+    Return:
+        Row index or -1 if no mismatched row was found
+    */
+    int64_t GetFirstMismatchRow(int column) const;
+
+    /*
+    Get the human-readable report generated by CompareAll. Results
+    are not printed directly so that multiple comparators may
+    execute concurrently without interleaving output.
+    */
+    const std::string& GetReport() const { return report_; }
+
+    /*
+    Find the first element at which two arrays differ. Floating point
+    NaNs are considered equal.
+
+    Args:
+        arr1        --> First array
+        offset1     --> Index into arr1 at which to start
+        arr2        --> Second array
+        offset2     --> Index into arr2 at which to start
+        count       --> Count of elements to compare
+
+    Return:
+        Zero-based index relative to the offsets of the first
+        mismatched element, or count if all elements are equal
+    */
+    static int64_t FindFirstMismatch(const std::shared_ptr<arrow::Array>& arr1,
+                                     int64_t offset1,
+                                     const std::shared_ptr<arrow::Array>& arr2,
+                                     int64_t offset2, int64_t count);
+};
+
+/*
+Compare each Parquet dataset (entries with ".parquet" in the name)
+in truth_dir against the dataset with the same name in test_dir.
+Datasets are compared concurrently, each by a single-threaded
+ParallelComparator. Reports are printed as each comparison finishes.
+
+Args:
+    truth_dir       --> Directory which contains truth datasets
+    test_dir        --> Directory which contains test datasets
+    thread_count    --> Maximum count of concurrent comparisons
+    stop_on_fail    --> Skip remaining comparisons after the
+                        first failure
+    pass            --> Output, true if all datasets are present
+                        in both directories and match
+
+Return:
+    EX_OK if the comparisons could be made, otherwise a
+    sysexits.h code > 1.
+*/
+int CompareParquetDatasets(const ManagedPath& truth_dir, const ManagedPath& test_dir,
+                           int thread_count, bool stop_on_fail, bool& pass);
+
+#endif  // PARALLEL_COMPARATOR_H_
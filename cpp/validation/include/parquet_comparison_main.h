@@ -5,7 +5,7 @@
 #include <chrono>
 #include <cinttypes>
 #include "sysexits.h"
-#include "comparator.h"
+#include "parallel_comparator.h"
 #include "cli_group.h"
 
 
@@ -14,7 +14,7 @@ typedef std::chrono::high_resolution_clock Clock;
 int PqCompMain(int argc, char** argv);
 
 bool ConfigurePqCompCLI(CLIGroup& cli_group, bool& help_requested, std::string& truth_path_str,
-    std::string& test_path_str);
+    std::string& test_path_str, int& thread_count, bool& stop_on_fail, bool& multi_dataset);
 
 
 #endif  // PARQUET_COMPARISON_MAIN_H_
\ No newline at end of file
@@ -0,0 +1,282 @@
+#include "binary_comparator.h"
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+
+namespace
+{
+bool ParseOffset(const std::string& str, uint64_t& value)
+{
+    if (str.empty())
+        return false;
+
+    int base = 10;
+    std::string digits = str;
+    if (str.size() > 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X'))
+    {
+        base = 16;
+        digits = str.substr(2);
+    }
+
+    // strtoull accepts leading whitespace and sign, neither is permitted
+    if (!isxdigit(static_cast<unsigned char>(digits[0])))
+        return false;
+
+    errno = 0;
+    char* end = nullptr;
+    value = strtoull(digits.c_str(), &end, base);
+    if (errno != 0 || *end != '\0')
+        return false;
+    return true;
+}
+}  // namespace
+
+const uint64_t BinaryComparator::kNoMismatch;
+
+BinaryComparator::BinaryComparator(int thread_count, uint64_t block_size)
+    : thread_count_(thread_count < 1 ? 1 : thread_count),
+      block_size_(block_size == 0 ? 1 : block_size),
+      first_mismatch_offset_(kNoMismatch), mismatch_count_(0),
+      compared_count_(0), size_mismatch_(false),
+      first_mismatch_offset(first_mismatch_offset_), mismatch_count(mismatch_count_),
+      compared_count(compared_count_), size_mismatch(size_mismatch_)
+{
+}
+
+bool BinaryComparator::AddMaskedRange(uint64_t offset, uint64_t length)
+{
+    if (length == 0 || offset > UINT64_MAX - length)
+        return false;
+
+    masked_ranges_.push_back(std::make_pair(offset, offset + length));
+    std::sort(masked_ranges_.begin(), masked_ranges_.end());
+
+    std::vector<std::pair<uint64_t, uint64_t>> merged;
+    for (const auto& range : masked_ranges_)
+    {
+        if (!merged.empty() && range.first <= merged.back().second)
+            merged.back().second = std::max(merged.back().second, range.second);
+        else
+            merged.push_back(range);
+    }
+    masked_ranges_.swap(merged);
+    return true;
+}
+
+bool BinaryComparator::AddMaskedRange(const std::string& range_str)
+{
+    size_t delim_pos = range_str.find(':');
+    if (delim_pos == std::string::npos)
+    {
+        printf("Masked range \"%s\" must be of the form <offset>:<length>\n",
+               range_str.c_str());
+        return false;
+    }
+
+    uint64_t offset = 0;
+    uint64_t length = 0;
+    if (!ParseOffset(range_str.substr(0, delim_pos), offset) ||
+        !ParseOffset(range_str.substr(delim_pos + 1), length))
+    {
+        printf("Masked range \"%s\" offset or length is not an unsigned integer\n",
+               range_str.c_str());
+        return false;
+    }
+
+    if (!AddMaskedRange(offset, length))
+    {
+        printf("Masked range \"%s\" is empty or exceeds the maximum offset\n",
+               range_str.c_str());
+        return false;
+    }
+    return true;
+}
+
+int BinaryComparator::Compare(const ManagedPath& truth_path, const ManagedPath& test_path,
+                              bool& pass)
+{
+    pass = false;
+    MemoryMappedFile truth_file;
+    MemoryMappedFile test_file;
+
+    int retcode = 0;
+    if ((retcode = truth_file.Open(truth_path)) != EX_OK)
+        return retcode;
+    if ((retcode = test_file.Open(test_path)) != EX_OK)
+        return retcode;
+
+    pass = CompareBuffers(truth_file.data(), truth_file.size(),
+                          test_file.data(), test_file.size());
+    return EX_OK;
+}
+
+bool BinaryComparator::CompareBuffers(const uint8_t* buff1, uint64_t size1,
+                                      const uint8_t* buff2, uint64_t size2)
+{
+    first_mismatch_offset_ = kNoMismatch;
+    mismatch_count_ = 0;
+    compared_count_ = 0;
+    size_mismatch_ = (size1 != size2);
+    uint64_t common_size = std::min(size1, size2);
+
+    // Don't start threads which would compare less than one block
+    uint64_t block_count = (common_size + block_size_ - 1) / block_size_;
+    int worker_count = static_cast<int>(
+        std::min(static_cast<uint64_t>(thread_count_), std::max(block_count, uint64_t(1))));
+
+    // Range boundaries are aligned to blocks
+    uint64_t blocks_per_worker = (block_count + worker_count - 1) / worker_count;
+    uint64_t range_size = blocks_per_worker * block_size_;
+
+    std::vector<uint64_t> first_mismatch(worker_count, kNoMismatch);
+    std::vector<uint64_t> mismatches(worker_count, 0);
+    std::vector<uint64_t> compared(worker_count, 0);
+
+    if (worker_count == 1)
+    {
+        CompareRange(buff1, buff2, 0, common_size, first_mismatch[0],
+                     mismatches[0], compared[0]);
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < worker_count; i++)
+        {
+            uint64_t begin = std::min(common_size, i * range_size);
+            uint64_t end = std::min(common_size, begin + range_size);
+            threads.push_back(std::thread(&BinaryComparator::CompareRange, this,
+                                          buff1, buff2, begin, end,
+                                          std::ref(first_mismatch[i]),
+                                          std::ref(mismatches[i]),
+                                          std::ref(compared[i])));
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    for (int i = 0; i < worker_count; i++)
+    {
+        first_mismatch_offset_ = std::min(first_mismatch_offset_, first_mismatch[i]);
+        mismatch_count_ += mismatches[i];
+        compared_count_ += compared[i];
+    }
+
+    if (size_mismatch_)
+    {
+        mismatch_count_ += std::max(size1, size2) - common_size;
+        first_mismatch_offset_ = std::min(first_mismatch_offset_, common_size);
+    }
+
+    return (mismatch_count_ == 0 && !size_mismatch_);
+}
+
+void BinaryComparator::CompareRange(const uint8_t* buff1, const uint8_t* buff2,
+                                    uint64_t begin, uint64_t end,
+                                    uint64_t& first_mismatch, uint64_t& mismatch_count,
+                                    uint64_t& compared_count) const
+{
+    // Accumulate in locals to avoid false sharing between threads
+    // which write to adjacent outputs
+    uint64_t first = kNoMismatch;
+    uint64_t mismatches = 0;
+    uint64_t compared = 0;
+
+    // First masked range which ends after begin
+    auto mask_it = std::upper_bound(masked_ranges_.begin(), masked_ranges_.end(), begin,
+                                    [](uint64_t val, const std::pair<uint64_t, uint64_t>& range)
+                                    { return val < range.second; });
+
+    uint64_t pos = begin;
+    uint64_t segment_end = 0;
+    uint64_t count = 0;
+    uint64_t first_index = 0;
+    while (pos < end)
+    {
+        segment_end = end;
+        if (mask_it != masked_ranges_.end() && mask_it->first < end)
+        {
+            if (mask_it->first <= pos)
+            {
+                pos = std::min(end, mask_it->second);
+                ++mask_it;
+                continue;
+            }
+            segment_end = mask_it->first;
+        }
+
+        for (uint64_t block_pos = pos; block_pos < segment_end; block_pos += count)
+        {
+            count = std::min(block_size_, segment_end - block_pos);
+            compared += count;
+            if (memcmp(buff1 + block_pos, buff2 + block_pos, count) == 0)
+                continue;
+
+            mismatches += CountMismatches(buff1 + block_pos, buff2 + block_pos,
+                                          count, first_index);
+            if (first == kNoMismatch)
+                first = block_pos + first_index;
+        }
+        pos = segment_end;
+    }
+
+    first_mismatch = first;
+    mismatch_count = mismatches;
+    compared_count = compared;
+}
+
+uint64_t BinaryComparator::CountMismatches(const uint8_t* buff1, const uint8_t* buff2,
+                                           uint64_t count, uint64_t& first_index)
+{
+    first_index = count;
+    uint64_t mismatches = 0;
+    uint64_t word1 = 0;
+    uint64_t word2 = 0;
+    uint64_t diff = 0;
+    uint64_t i = 0;
+
+    // Compare eight bytes at a time. Fold the bits of each byte of the
+    // xor into the byte's LSB, such that the popcount is the count of
+    // nonzero bytes.
+    for (; i + sizeof(uint64_t) <= count; i += sizeof(uint64_t))
+    {
+        memcpy(&word1, buff1 + i, sizeof(uint64_t));
+        memcpy(&word2, buff2 + i, sizeof(uint64_t));
+        diff = word1 ^ word2;
+        if (diff == 0)
+            continue;
+
+        if (first_index == count)
+        {
+            for (uint64_t j = i; j < i + sizeof(uint64_t); j++)
+            {
+                if (buff1[j] != buff2[j])
+                {
+                    first_index = j;
+                    break;
+                }
+            }
+        }
+
+        diff |= diff >> 4;
+        diff |= diff >> 2;
+        diff |= diff >> 1;
+        diff &= 0x0101010101010101ULL;
+        mismatches += std::bitset<64>(diff).count();
+    }
+
+    for (; i < count; i++)
+    {
+        if (buff1[i] != buff2[i])
+        {
+            if (first_index == count)
+                first_index = i;
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
@@ -2,14 +2,15 @@
 
 int BinCompMain(int argc, char** argv)
 {
-    std::streamsize read_size = static_cast<int>(1e6);
-
     CLIGroup cli_group;
     bool help_requested = false;
     std::string truth_path_str("");
     std::string test_path_str("");
+    int thread_count = 1;
+    std::vector<std::string> masked_ranges;
 
-    if(!ConfigureCLI(cli_group, help_requested, truth_path_str, test_path_str))
+    if(!ConfigureCLI(cli_group, help_requested, truth_path_str, test_path_str,
+        thread_count, masked_ranges))
         return EX_SOFTWARE;
 
     std::string nickname = "";
@@ -28,85 +29,45 @@ int BinCompMain(int argc, char** argv)
         return EX_OK;
     }
 
-    std::ifstream ifile1;
-    std::ifstream ifile2;
+    BinaryComparator comparator(thread_count);
+    for (const auto& range_str : masked_ranges)
+    {
+        if (!comparator.AddMaskedRange(range_str))
+            return EX_USAGE;
+    }
 
-    // If either file can't be opened, return 1 to indicate a
+    // If either file can't be opened, return >1 to indicate a
     // null comparison.
-    if (!OpenFile(truth_path_str.c_str(), ifile1))
-        return EX_NOINPUT  ;
-    if (!OpenFile(test_path_str.c_str(), ifile2))
-        return EX_NOINPUT;
-
-    std::vector<char> file1_data(read_size);
-    std::vector<char> file2_data(read_size);
-    std::streamsize file1_read_count = 0;
-    std::streamsize file2_read_count = 0;
-
-    bool equal_result = false;
     bool pass = false;
-    int chunk_count = 0;
-    while (true)
-    {
-        file1_read_count = ReadBytes(ifile1, read_size, file1_data.data());
-        file2_read_count = ReadBytes(ifile2, read_size, file2_data.data());
-
-        if (file1_read_count != file2_read_count)
-        {
-            printf("Read count not equal\n");
-            printf("FAIL\n");
-            break;
-        }
-
-        equal_result = std::equal(file1_data.begin(), file1_data.begin() + file1_read_count, file2_data.begin());
-        if (!equal_result)
-        {
-            printf("Comparison of chunk %02d not equal\n", chunk_count);
-            printf("FAIL\n");
-            break;
-        }
-
-        if (file1_read_count != read_size)
-        {
-            printf("PASS\n");
-            pass = true;
-            break;
-        }
-        chunk_count++;
-    }
+    if ((retcode = comparator.Compare(ManagedPath(truth_path_str), 
+        ManagedPath(test_path_str), pass)) != EX_OK)
+        return retcode;
 
-    ifile1.close();
-    ifile2.close();
+    if (comparator.size_mismatch)
+        printf("File sizes not equal\n");
 
-    if(pass)
-        return EX_OK;
-    return 1;
-}
-
-bool OpenFile(const char* path, std::ifstream& ifs)
-{
-    ifs.open(path, std::ios::binary);
-    if (!(ifs.is_open()))
+    if (!pass)
     {
-        printf("Error opening file: %s\n", path);
-        return false;
+        printf("First mismatch at byte offset %" PRIu64 "\n", 
+            comparator.first_mismatch_offset);
+        printf("Mismatched byte count: %" PRIu64 "\n", comparator.mismatch_count);
+        printf("FAIL\n");
+        return 1;
     }
-    return true;
-}
 
-std::streamsize ReadBytes(std::ifstream& ifs, std::streamsize read_count, char* data)
-{
-    ifs.read(data, read_count);
-    return ifs.gcount();
+    printf("PASS\n");
+    return EX_OK;
 }
 
 bool ConfigureCLI(CLIGroup& cli_group, bool& help_requested, std::string& truth_path_str, 
-    std::string& test_path_str)
+    std::string& test_path_str, int& thread_count, std::vector<std::string>& masked_ranges)
 {
     std::string exe_name = "bincompare";
     std::string description = "Compare a test file against a truth file, byte by byte. Print "
         "\"PASS\" (exit code 0) to stdout if equivalent, \"FAIL\" (exit code 1) "
-        "if not equivalent, or NULL (exit code >1) if the comparison can't be made.";
+        "if not equivalent, or NULL (exit code >1) if the comparison can't be made. "
+        "On failure, the offset of the first mismatched byte and the count of "
+        "mismatched bytes are printed.";
     std::shared_ptr<CLIGroupMember> cli_help = cli_group.AddCLI(exe_name, 
     description, "clihelp");
     cli_help->AddOption("--help", "-h", "Show usage information", false, 
@@ -121,6 +82,19 @@ bool ConfigureCLI(CLIGroup& cli_group, bool& help_requested, std::string& truth_
     std::string test_path_help = "Full path to TEST file";
     cli_full->AddOption("test_file_path", test_path_help, test_path_str, true);
 
+    std::string thread_count_help = "Count of threads used to compare ranges of "
+        "the memory-mapped files concurrently";
+    cli_full->AddOption("--thread_count", "-t", thread_count_help, 1, 
+        thread_count)->ValidateInclusiveRangeIs(1, 256);
+
+    std::string masked_ranges_help = "Range of bytes to exclude from the comparison, "
+        "in the form <offset>:<length>. Values may be decimal or hexadecimal with "
+        "a \"0x\" prefix. Pass multiple instances of the option to mask multiple "
+        "ranges: \"-M 0:24 -M 0x1000:8\"";
+    std::vector<std::string> masked_ranges_default{};
+    cli_full->AddOption<std::vector<std::string>>("--mask", "-M", masked_ranges_help,
+        masked_ranges_default, masked_ranges);
+
     if(!cli_group.CheckConfiguration())
         return false;
 
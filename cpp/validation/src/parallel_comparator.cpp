@@ -0,0 +1,525 @@
+#include "parallel_comparator.h"
+#include <thread>
+#include <mutex>
+#include <set>
+#include <algorithm>
+
+namespace
+{
+bool SlicesEqual(const std::shared_ptr<arrow::Array>& arr1, int64_t offset1,
+                 const std::shared_ptr<arrow::Array>& arr2, int64_t offset2,
+                 int64_t count)
+{
+    return arr1->Slice(offset1, count)->Equals(arr2->Slice(offset2, count),
+        arrow::EqualOptions::Defaults().nans_equal(true));
+}
+}  // namespace
+
+const size_t ParallelComparator::MAX_QUEUED_WINDOWS = 2;
+
+ParallelComparator::ParallelComparator(int thread_count, bool stop_on_fail)
+    : thread_count_(thread_count < 1 ? 1 : thread_count), stop_on_fail_(stop_on_fail),
+    failure_(false), halt_(false), column_count_(0), window_base_(0), window_count_(0),
+    windows_complete_(false)
+{}
+
+int ParallelComparator::Initialize(ManagedPath path1, ManagedPath path2)
+{
+    bool is_dir = false;
+    if (path1.is_directory())
+    {
+        is_dir = true;
+    }
+    else if (!path1.is_regular_file())
+    {
+        report_ += fmt::format("\nERROR!! Input path 1 ({:s}) is not a directory or file\n",
+            path1.RawString());
+        failure_ = true;
+        return EX_NOINPUT;
+    }
+
+    if (is_dir && !path2.is_directory())
+    {
+        report_ += fmt::format("\nERROR!! Input path 2 ({:s}) is not a directory\n",
+            path2.RawString());
+        failure_ = true;
+        return EX_NOINPUT;
+    }
+    else if (!is_dir && !path2.is_regular_file())
+    {
+        report_ += fmt::format("\nERROR!! Input path 2 ({:s}) is not a file\n",
+            path2.RawString());
+        failure_ = true;
+        return EX_NOINPUT;
+    }
+
+    if (!pr1_.SetPQPath(path1) || !pr2_.SetPQPath(path2))
+    {
+        failure_ = true;
+        return EX_IOERR;
+    }
+
+    InitializeStats();
+    return EX_OK;
+}
+
+void ParallelComparator::InitializeStats()
+{
+    column_count_ = std::max(pr1_.GetSchema()->num_fields(), pr2_.GetSchema()->num_fields());
+    compared_count_.assign(column_count_, 0);
+    columns_passed_.assign(column_count_, 1);
+    columns_active_.assign(column_count_, 1);
+    first_mismatch_row_.assign(column_count_, -1);
+    halt_ = false;
+}
+
+bool ParallelComparator::CompareSchema()
+{
+    std::shared_ptr<arrow::Schema> schema1 = pr1_.GetSchema();
+    std::shared_ptr<arrow::Schema> schema2 = pr2_.GetSchema();
+    bool schema_equal = (schema1->num_fields() == schema2->num_fields());
+    if (!schema_equal)
+    {
+        report_ += fmt::format("\nERROR!! Column counts do not match: {:d}, {:d}\n",
+            schema1->num_fields(), schema2->num_fields());
+    }
+
+    for (int i = 0; i < column_count_; i++)
+    {
+        if (i >= schema1->num_fields() || i >= schema2->num_fields())
+        {
+            columns_passed_[i] = 0;
+            columns_active_[i] = 0;
+            continue;
+        }
+
+        if (schema1->field(i)->name() != schema2->field(i)->name())
+        {
+            report_ += fmt::format("\nERROR!! Column {:d} names do not match: {:s}, {:s}\n",
+                i + 1, schema1->field(i)->name(), schema2->field(i)->name());
+            columns_passed_[i] = 0;
+            columns_active_[i] = 0;
+            schema_equal = false;
+        }
+        else if (!schema1->field(i)->type()->Equals(schema2->field(i)->type()))
+        {
+            report_ += fmt::format("\nERROR!! Column {:d} ({:s}) datatypes do not match: "
+                "{:s}, {:s}\n", i + 1, schema1->field(i)->name(),
+                schema1->field(i)->type()->ToString(), schema2->field(i)->type()->ToString());
+            columns_passed_[i] = 0;
+            columns_active_[i] = 0;
+            schema_equal = false;
+        }
+    }
+    return schema_equal;
+}
+
+bool ParallelComparator::CompareAll()
+{
+    if (failure_)
+        return false;
+
+    InitializeStats();
+    bool pass = CompareSchema();
+    if (!pass && stop_on_fail_)
+    {
+        MakeReport(pass, false);
+        return false;
+    }
+
+    // Only parquet files with data are added to the parquet paths list
+    // in ParquetReader. If both are empty then only the schema is compared.
+    if (pr1_.GetInputParquetPathsCount() == 0 && pr2_.GetInputParquetPathsCount() == 0)
+    {
+        report_ += "\nBoth truth and test datasets are empty. Comparing schema only.\n";
+        MakeReport(pass, false);
+        return pass;
+    }
+
+    int active_count = 0;
+    for (int i = 0; i < column_count_; i++)
+    {
+        if (columns_active_[i])
+            active_count++;
+    }
+
+    // Start the comparison threads, each of which compares a stride of
+    // the active columns over all windows.
+    int stride = std::min(thread_count_, active_count);
+    windows_.clear();
+    window_base_ = 0;
+    window_count_ = 0;
+    windows_complete_ = false;
+    next_window_.assign(stride, 0);
+    std::vector<std::thread> threads;
+    if (stride > 1)
+    {
+        for (int first_col = 0; first_col < stride; first_col++)
+            threads.push_back(std::thread(&ParallelComparator::CompareColumnStride, this,
+                first_col, stride));
+    }
+
+    std::shared_ptr<arrow::Table> table1;
+    std::shared_ptr<arrow::Table> table2;
+    int64_t offset1 = 0;
+    int64_t offset2 = 0;
+    int64_t row_base = 0;
+    bool have_table1 = pr1_.GetNextRGTable(table1);
+    bool have_table2 = pr2_.GetNextRGTable(table2);
+
+    // Row group sizes may differ between datasets. Compare the overlapping
+    // window of the current row groups, then read the next row group
+    // for whichever dataset has been exhausted.
+    while (have_table1 && have_table2 && !halt_)
+    {
+        if (offset1 >= table1->num_rows())
+        {
+            have_table1 = pr1_.GetNextRGTable(table1);
+            offset1 = 0;
+            continue;
+        }
+        if (offset2 >= table2->num_rows())
+        {
+            have_table2 = pr2_.GetNextRGTable(table2);
+            offset2 = 0;
+            continue;
+        }
+
+        int64_t count = std::min(table1->num_rows() - offset1,
+                                 table2->num_rows() - offset2);
+        ComparisonWindow window(table1, offset1, table2, offset2, count, row_base);
+        if (stride > 1)
+            QueueWindow(window);
+        else if (stride == 1)
+            CompareWindowColumns(window, 0, 1);
+        offset1 += count;
+        offset2 += count;
+        row_base += count;
+    }
+
+    if (stride > 1)
+    {
+        {
+            std::lock_guard<std::mutex> lock(window_mutex_);
+            windows_complete_ = true;
+        }
+        window_cv_.notify_all();
+        for (std::vector<std::thread>::iterator it = threads.begin(); it != threads.end(); ++it)
+            it->join();
+    }
+
+    // If one dataset has remaining rows, including rows in the current
+    // table, the row counts are not equal.
+    bool row_count_mismatch = false;
+    if (!halt_)
+    {
+        bool remaining1 = have_table1 && offset1 < table1->num_rows();
+        bool remaining2 = have_table2 && offset2 < table2->num_rows();
+        while (have_table1 && !remaining1)
+        {
+            if ((have_table1 = pr1_.GetNextRGTable(table1)))
+                remaining1 = table1->num_rows() > 0;
+        }
+        while (have_table2 && !remaining2)
+        {
+            if ((have_table2 = pr2_.GetNextRGTable(table2)))
+                remaining2 = table2->num_rows() > 0;
+        }
+        if (remaining1 || remaining2)
+        {
+            row_count_mismatch = true;
+            for (int i = 0; i < column_count_; i++)
+            {
+                if (columns_passed_[i] && first_mismatch_row_[i] < 0)
+                    first_mismatch_row_[i] = row_base;
+                columns_passed_[i] = 0;
+            }
+        }
+    }
+
+    for (int i = 0; i < column_count_; i++)
+    {
+        if (!columns_passed_[i])
+            pass = false;
+    }
+    if (halt_)
+        pass = false;
+
+    MakeReport(pass, row_count_mismatch);
+    return pass;
+}
+
+void ParallelComparator::QueueWindow(const ComparisonWindow& window)
+{
+    {
+        std::unique_lock<std::mutex> lock(window_mutex_);
+        window_cv_.wait(lock, [this] { return windows_.size() < MAX_QUEUED_WINDOWS; });
+        windows_.push_back(window);
+        window_count_++;
+    }
+    window_cv_.notify_all();
+}
+
+void ParallelComparator::CompareColumnStride(int first_col, int stride)
+{
+    int64_t index = 0;
+    while (true)
+    {
+        ComparisonWindow window;
+        {
+            std::unique_lock<std::mutex> lock(window_mutex_);
+            window_cv_.wait(lock, [this, index] {
+                return index < window_count_ || windows_complete_; });
+            if (index >= window_count_)
+                return;
+            window = windows_[index - window_base_];
+        }
+
+        CompareWindowColumns(window, first_col, stride);
+        index++;
+
+        // Remove the windows which have been compared by all threads.
+        {
+            std::lock_guard<std::mutex> lock(window_mutex_);
+            next_window_[first_col] = index;
+            int64_t min_next = *std::min_element(next_window_.begin(), next_window_.end());
+            while (window_base_ < min_next)
+            {
+                windows_.pop_front();
+                window_base_++;
+            }
+        }
+        window_cv_.notify_all();
+    }
+}
+
+void ParallelComparator::CompareWindowColumns(const ComparisonWindow& window, int first_col,
+                                              int stride)
+{
+    // Stride over the active columns only so that work is evenly
+    // distributed when some columns have already failed.
+    int active_index = -1;
+    for (int col = 0; col < column_count_; col++)
+    {
+        if (!columns_active_[col])
+            continue;
+        active_index++;
+        if (active_index % stride != first_col)
+            continue;
+        if (halt_)
+            return;
+
+        // A column which has already failed is not compared again.
+        if (!columns_passed_[col])
+            continue;
+
+        // GetNextRGTable combines chunks, so each column has a single chunk.
+        std::shared_ptr<arrow::Array> arr1 = window.table1->column(col)->chunk(0);
+        std::shared_ptr<arrow::Array> arr2 = window.table2->column(col)->chunk(0);
+        if (SlicesEqual(arr1, window.offset1, arr2, window.offset2, window.count))
+        {
+            compared_count_[col] += window.count;
+            continue;
+        }
+
+        int64_t mismatch_index = FindFirstMismatch(arr1, window.offset1, arr2,
+                                                   window.offset2, window.count);
+        compared_count_[col] += mismatch_index;
+        first_mismatch_row_[col] = window.row_base + mismatch_index;
+        columns_passed_[col] = 0;
+        if (stop_on_fail_)
+            halt_ = true;
+    }
+}
+
+void ParallelComparator::MakeReport(bool pass, bool row_count_mismatch)
+{
+    std::shared_ptr<arrow::Schema> schema = pr1_.GetSchema();
+    if (schema->num_fields() < pr2_.GetSchema()->num_fields())
+        schema = pr2_.GetSchema();
+
+    std::string passed_cols;
+    std::string failed_cols;
+    for (int i = 0; i < column_count_; i++)
+    {
+        if (columns_passed_[i])
+        {
+            passed_cols += (passed_cols.empty() ? "" : ", ") + std::to_string(i + 1);
+            continue;
+        }
+
+        failed_cols += (failed_cols.empty() ? "" : ", ") + std::to_string(i + 1);
+        if (first_mismatch_row_[i] > -1)
+        {
+            report_ += fmt::format("Column {:d} ({:s}): first mismatch at row {:d}\n",
+                i + 1, schema->field(i)->name(), first_mismatch_row_[i]);
+        }
+    }
+
+    if (row_count_mismatch)
+        report_ += "\nERROR!! Row counts do not match\n";
+    if (halt_)
+        report_ += "\nComparison stopped after first mismatch\n";
+
+    report_ += "\n\n------------Final Results------------\n";
+    report_ += "\nPassed Cols--\n" + passed_cols + "\n\n";
+    report_ += "\nFailed Cols--\n" + failed_cols + "\n";
+    report_ += pass ? "\n\nOverall -> Pass\n" : "\n\nOverall -> Fail\n";
+    report_ += "------------\n\n";
+}
+
+int64_t ParallelComparator::GetComparedCount(int column) const
+{
+    if (column < 1 || column > column_count_)
+        return 0;
+    return compared_count_[column - 1];
+}
+
+bool ParallelComparator::CheckPassed(int column) const
+{
+    if (column < 1 || column > column_count_)
+        return false;
+    return columns_passed_[column - 1] == 1;
+}
+
+int64_t ParallelComparator::GetFirstMismatchRow(int column) const
+{
+    if (column < 1 || column > column_count_)
+        return -1;
+    return first_mismatch_row_[column - 1];
+}
+
+int64_t ParallelComparator::FindFirstMismatch(const std::shared_ptr<arrow::Array>& arr1,
+                                              int64_t offset1,
+                                              const std::shared_ptr<arrow::Array>& arr2,
+                                              int64_t offset2, int64_t count)
+{
+    if (SlicesEqual(arr1, offset1, arr2, offset2, count))
+        return count;
+
+    // Bisect the mismatched range. Each step compares only the first
+    // half, so the total work is proportional to count.
+    int64_t begin = 0;
+    int64_t length = count;
+    while (length > 1)
+    {
+        int64_t half = length / 2;
+        if (SlicesEqual(arr1, offset1 + begin, arr2, offset2 + begin, half))
+        {
+            begin += half;
+            length -= half;
+        }
+        else
+            length = half;
+    }
+    return begin;
+}
+
+int CompareParquetDatasets(const ManagedPath& truth_dir, const ManagedPath& test_dir,
+                           int thread_count, bool stop_on_fail, bool& pass)
+{
+    pass = false;
+    if (!truth_dir.is_directory() || !test_dir.is_directory())
+    {
+        printf("\nERROR!! Truth (%s) and test (%s) paths must be directories\n",
+               truth_dir.RawString().c_str(), test_dir.RawString().c_str());
+        return EX_NOINPUT;
+    }
+
+    bool success = false;
+    std::vector<ManagedPath> truth_entries;
+    std::vector<ManagedPath> test_entries;
+    truth_dir.ListDirectoryEntries(success, truth_entries);
+    if (!success)
+        return EX_IOERR;
+    test_dir.ListDirectoryEntries(success, test_entries);
+    if (!success)
+        return EX_IOERR;
+
+    std::vector<std::string> select_substr({".parquet"});
+    truth_entries = ManagedPath::SelectPathsWithSubString(truth_entries, select_substr);
+    test_entries = ManagedPath::SelectPathsWithSubString(test_entries, select_substr);
+    if (truth_entries.size() == 0)
+    {
+        printf("\nERROR!! No Parquet datasets in truth directory %s\n",
+               truth_dir.RawString().c_str());
+        return EX_NOINPUT;
+    }
+    std::sort(truth_entries.begin(), truth_entries.end());
+
+    bool all_present = true;
+    std::set<std::string> truth_names;
+    for (std::vector<ManagedPath>::const_iterator it = truth_entries.cbegin();
+         it != truth_entries.cend(); ++it)
+        truth_names.insert(it->filename().RawString());
+    for (std::vector<ManagedPath>::const_iterator it = test_entries.cbegin();
+         it != test_entries.cend(); ++it)
+    {
+        if (truth_names.count(it->filename().RawString()) == 0)
+        {
+            printf("\nERROR!! Test dataset not in truth directory: %s\n",
+                   it->filename().RawString().c_str());
+            all_present = false;
+        }
+    }
+
+    std::vector<uint8_t> results(truth_entries.size(), 0);
+    std::vector<uint8_t> compared(truth_entries.size(), 0);
+    std::atomic<size_t> next_index(0);
+    std::atomic<bool> halt(stop_on_fail && !all_present);
+    std::mutex print_mutex;
+
+    auto compare_datasets = [&]()
+    {
+        size_t index = 0;
+        while ((index = next_index++) < truth_entries.size())
+        {
+            if (halt)
+                return;
+
+            ManagedPath truth_path = truth_entries[index];
+            ManagedPath test_path = test_dir;
+            test_path /= truth_path.filename();
+            std::string report;
+            if (!test_path.exists())
+            {
+                report = "\nERROR!! Dataset not in test directory\n";
+            }
+            else
+            {
+                ParallelComparator comp(1, stop_on_fail);
+                if (comp.Initialize(truth_path, test_path) == EX_OK)
+                    results[index] = comp.CompareAll();
+                report = comp.GetReport();
+            }
+
+            compared[index] = 1;
+            if (!results[index] && stop_on_fail)
+                halt = true;
+
+            std::lock_guard<std::mutex> lock(print_mutex);
+            printf("\n ---Comparing Dataset %s--- \n%s%s\n", truth_path.filename().RawString().c_str(),
+                   report.c_str(), results[index] ? "PASSED" : "FAILED");
+        }
+    };
+
+    int dataset_thread_count = std::max(1, std::min(thread_count,
+        static_cast<int>(truth_entries.size())));
+    std::vector<std::thread> threads;
+    for (int i = 0; i < dataset_thread_count; i++)
+        threads.push_back(std::thread(compare_datasets));
+    for (std::vector<std::thread>::iterator it = threads.begin(); it != threads.end(); ++it)
+        it->join();
+
+    pass = all_present && !halt;
+    printf("\n\n------------Dataset Results------------\n");
+    for (size_t i = 0; i < truth_entries.size(); i++)
+    {
+        printf("%s: %s\n", truth_entries[i].filename().RawString().c_str(),
+               compared[i] ? (results[i] ? "Pass" : "Fail") : "Not compared");
+        if (!results[i])
+            pass = false;
+    }
+    printf("\nOverall -> %s\n------------\n\n", pass ? "Pass" : "Fail");
+    return EX_OK;
+}
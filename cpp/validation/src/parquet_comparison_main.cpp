@@ -8,8 +8,12 @@ int PqCompMain(int argc, char** argv)
     bool help_requested = false;
     std::string truth_path_str("");
     std::string test_path_str("");
+    int thread_count = 1;
+    bool stop_on_fail = false;
+    bool multi_dataset = false;
 
-    if(!ConfigurePqCompCLI(cli_group, help_requested, truth_path_str, test_path_str))
+    if(!ConfigurePqCompCLI(cli_group, help_requested, truth_path_str, test_path_str,
+        thread_count, stop_on_fail, multi_dataset))
         return EX_SOFTWARE;
 
     std::string nickname = "";
@@ -28,10 +32,23 @@ int PqCompMain(int argc, char** argv)
         return EX_OK;
     }
 
-    Comparator comp;
-    if((retcode = comp.Initialize(ManagedPath(truth_path_str), ManagedPath(test_path_str))) != 0)
-        return retcode;
-    bool result = comp.CompareAll();
+    bool result = false;
+    if (multi_dataset)
+    {
+        if((retcode = CompareParquetDatasets(ManagedPath(truth_path_str), 
+            ManagedPath(test_path_str), thread_count, stop_on_fail, result)) != 0)
+            return retcode;
+    }
+    else
+    {
+        ParallelComparator comp(thread_count, stop_on_fail);
+        retcode = comp.Initialize(ManagedPath(truth_path_str), ManagedPath(test_path_str));
+        if(retcode == 0)
+            result = comp.CompareAll();
+        printf("%s", comp.GetReport().c_str());
+        if(retcode != 0)
+            return retcode;
+    }
 
     auto t2 = Clock::now();
     printf("\nElapsed Time: %" PRId64 " seconds\n",
@@ -43,7 +60,7 @@ int PqCompMain(int argc, char** argv)
 }
 
 bool ConfigurePqCompCLI(CLIGroup& cli_group, bool& help_requested, std::string& truth_path_str, 
-    std::string& test_path_str)
+    std::string& test_path_str, int& thread_count, bool& stop_on_fail, bool& multi_dataset)
 {
     std::string exe_name = "pqcompare";
     std::string description = "Compare a test parquet path against a truth parquet path. Input Parquet "
@@ -51,7 +68,8 @@ bool ConfigurePqCompCLI(CLIGroup& cli_group, bool& help_requested, std::string&
         "if equivalent, \"FAIL\" (exit code 1) if not equivalent, or \"NULL\" (exit code >1) "
         "if the comparison can't be made. "
         "Column count and schema (column label and data type) will be compared first, followed by element-wise "
-        "comparison of columns as arrays. All list-type columns are assumed to be arrow::Int32Type.";
+        "comparison of columns as arrays. Each row group is read once and columns are compared "
+        "concurrently.";
     std::shared_ptr<CLIGroupMember> cli_help = cli_group.AddCLI(exe_name, 
     description, "clihelp");
     cli_help->AddOption("--help", "-h", "Show usage information", false, 
@@ -66,6 +84,20 @@ bool ConfigurePqCompCLI(CLIGroup& cli_group, bool& help_requested, std::string&
     std::string test_path_help = "Full path to TEST data";
     cli_full->AddOption("test_parquet_path", test_path_help, test_path_str, true);
 
+    std::string thread_count_help = "Maximum count of threads used to compare columns, "
+        "or datasets if --multi_dataset is present";
+    cli_full->AddOption("--thread_count", "-t", thread_count_help, 1, 
+        thread_count)->ValidateInclusiveRangeIs(1, 256);
+
+    std::string stop_on_fail_help = "Stop comparison after the first mismatched column "
+        "or dataset";
+    cli_full->AddOption("--stop_on_fail", "-s", stop_on_fail_help, false, stop_on_fail);
+
+    std::string multi_dataset_help = "Truth and test paths are directories which contain "
+        "multiple Parquet datasets, such as the output directory of tip parse. Datasets "
+        "with the same name are compared concurrently.";
+    cli_full->AddOption("--multi_dataset", "-m", multi_dataset_help, false, multi_dataset);
+
     if(!cli_group.CheckConfiguration())
         return false;
 